@@ -15,6 +15,26 @@
 
 #include "../HYPRE.h"
 
+/*--------------------------------------------------------------------------
+ * hypre_IJMatrixMarkValuesChanged
+ *
+ * Bumps the values versions of diag and offd of the ParCSR object after
+ * values were set or added, so that data derived from them (the SELL-C-sigma
+ * shadows) is not reused. Assemble calls hypre_ParCSRMatrixValuesChanged.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_IJMatrixMarkValuesChanged( hypre_IJMatrix *ijmatrix )
+{
+   hypre_ParCSRMatrix *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(ijmatrix);
+
+   if (par_matrix)
+   {
+      hypre_CSRMatrixValuesChanged(hypre_ParCSRMatrixDiag(par_matrix));
+      hypre_CSRMatrixValuesChanged(hypre_ParCSRMatrixOffd(par_matrix));
+   }
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_IJMatrixCreate
  *--------------------------------------------------------------------------*/
@@ -584,6 +604,8 @@ HYPRE_IJMatrixSetValues2( HYPRE_IJMatrix       matrix,
       }
    }
 
+   hypre_IJMatrixMarkValuesChanged(ijmatrix);
+
    return hypre_error_flag;
 }
 
@@ -602,7 +624,8 @@ HYPRE_IJMatrixSetConstantValues( HYPRE_IJMatrix matrix, HYPRE_Complex value)
 
    if ( hypre_IJMatrixObjectType(ijmatrix) == HYPRE_PARCSR )
    {
-      return( hypre_IJMatrixSetConstantValuesParCSR( ijmatrix, value));
+      hypre_IJMatrixSetConstantValuesParCSR( ijmatrix, value);
+      hypre_IJMatrixMarkValuesChanged(ijmatrix);
    }
    else
    {
@@ -791,6 +814,8 @@ HYPRE_IJMatrixAddToValues2( HYPRE_IJMatrix       matrix,
       }
    }
 
+   hypre_IJMatrixMarkValuesChanged(ijmatrix);
+
    return hypre_error_flag;
 }
 
@@ -815,12 +840,18 @@ HYPRE_IJMatrixAssemble( HYPRE_IJMatrix matrix )
 
       if (exec == HYPRE_EXEC_DEVICE)
       {
-         return( hypre_IJMatrixAssembleParCSRDevice( ijmatrix ) );
+         hypre_IJMatrixAssembleParCSRDevice( ijmatrix );
       }
       else
 #endif
       {
-         return( hypre_IJMatrixAssembleParCSR( ijmatrix ) );
+         hypre_IJMatrixAssembleParCSR( ijmatrix );
+      }
+
+      /* the values may have been changed after a previous assembly */
+      if (hypre_IJMatrixObject(ijmatrix))
+      {
+         hypre_ParCSRMatrixValuesChanged((hypre_ParCSRMatrix *) hypre_IJMatrixObject(ijmatrix));
       }
    }
    else
@@ -1312,6 +1343,80 @@ HYPRE_IJMatrixPrint( HYPRE_IJMatrix  matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_IJMatrixReadBinary
+ *
+ * Reads a matrix written by HYPRE_IJMatrixPrintBinary, on any number of
+ * processors
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixReadBinary( const char     *filename,
+                          MPI_Comm        comm,
+                          HYPRE_Int       type,
+                          HYPRE_IJMatrix *matrix_ptr )
+{
+   HYPRE_IJMatrix      matrix;
+   hypre_ParCSRMatrix *par_matrix;
+   HYPRE_BigInt        base_i, base_j, ilower, jlower;
+
+   if (type != HYPRE_PARCSR)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   hypre_ParCSRMatrixReadBinary(comm, filename, &base_i, &base_j, &par_matrix);
+   if (!par_matrix)
+   {
+      return hypre_error_flag;
+   }
+
+   ilower = hypre_ParCSRMatrixFirstRowIndex(par_matrix) + base_i;
+   jlower = hypre_ParCSRMatrixFirstColDiag(par_matrix) + base_j;
+   HYPRE_IJMatrixCreate(comm, ilower,
+                        ilower + hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(par_matrix)) - 1,
+                        jlower,
+                        jlower + hypre_CSRMatrixNumCols(hypre_ParCSRMatrixDiag(par_matrix)) - 1,
+                        &matrix);
+   HYPRE_IJMatrixSetObjectType(matrix, type);
+
+   hypre_IJMatrixObject(matrix)       = par_matrix;
+   hypre_IJMatrixAssembleFlag(matrix) = 1;
+
+   *matrix_ptr = matrix;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_IJMatrixPrintBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixPrintBinary( HYPRE_IJMatrix  matrix,
+                           const char     *filename )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if ( (hypre_IJMatrixObjectType(matrix) != HYPRE_PARCSR) ||
+        !hypre_IJMatrixAssembleFlag(matrix) )
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_ParCSRMatrixPrintBinary((hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix),
+                                 hypre_IJMatrixGlobalFirstRow(matrix),
+                                 hypre_IJMatrixGlobalFirstCol(matrix), filename);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
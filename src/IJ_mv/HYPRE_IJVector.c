@@ -704,3 +704,68 @@ HYPRE_IJVectorPrint( HYPRE_IJVector  vector,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * HYPRE_IJVectorReadBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJVectorReadBinary( const char     *filename,
+                          MPI_Comm        comm,
+                          HYPRE_Int       type,
+                          HYPRE_IJVector *vector_ptr )
+{
+   HYPRE_IJVector   vector;
+   hypre_ParVector *par_vector;
+   HYPRE_BigInt     base_j, jlower;
+
+   if (type != HYPRE_PARCSR)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   hypre_ParVectorReadBinary(comm, filename, &base_j, &par_vector);
+   if (!par_vector)
+   {
+      return hypre_error_flag;
+   }
+
+   jlower = hypre_ParVectorFirstIndex(par_vector) + base_j;
+   HYPRE_IJVectorCreate(comm, jlower,
+                        jlower + hypre_VectorSize(hypre_ParVectorLocalVector(par_vector)) - 1,
+                        &vector);
+   HYPRE_IJVectorSetObjectType(vector, type);
+
+   hypre_IJVectorObject(vector) = par_vector;
+
+   *vector_ptr = vector;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_IJVectorPrintBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJVectorPrintBinary( HYPRE_IJVector  vector,
+                           const char     *filename )
+{
+   if (!vector)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if ( hypre_IJVectorObjectType(vector) != HYPRE_PARCSR )
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_ParVectorPrintBinary((hypre_ParVector *) hypre_IJVectorObject(vector),
+                              hypre_IJVectorGlobalFirstRow(vector), filename);
+
+   return hypre_error_flag;
+}
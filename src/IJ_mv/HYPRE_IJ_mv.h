@@ -331,6 +331,28 @@ HYPRE_Int HYPRE_IJMatrixRead(const char     *filename,
 HYPRE_Int HYPRE_IJMatrixPrint(HYPRE_IJMatrix  matrix,
                               const char     *filename);
 
+/**
+ * Read the matrix from a binary file written by HYPRE_IJMatrixPrintBinary.
+ * The file can be read on a different number of processors than it was
+ * written on.  If the numbers are the same, the matrix gets the row and
+ * column ranges it was written with, otherwise the rows and columns are
+ * distributed evenly.  Only HYPRE_PARCSR is supported for type.
+ **/
+HYPRE_Int HYPRE_IJMatrixReadBinary(const char     *filename,
+                                   MPI_Comm        comm,
+                                   HYPRE_Int       type,
+                                   HYPRE_IJMatrix *matrix);
+
+/**
+ * Print the assembled matrix to a single binary file, written by all
+ * processors.  The file holds a header, a table of the ranges written by
+ * each processor, and their diagonal and off-diagonal CSR blocks, with
+ * every array aligned to eight bytes so that the file can be memory
+ * mapped.
+ **/
+HYPRE_Int HYPRE_IJMatrixPrintBinary(HYPRE_IJMatrix  matrix,
+                                    const char     *filename);
+
 /**@}*/
 
 /*--------------------------------------------------------------------------
@@ -497,6 +519,21 @@ HYPRE_Int HYPRE_IJVectorRead(const char     *filename,
 HYPRE_Int HYPRE_IJVectorPrint(HYPRE_IJVector  vector,
                               const char     *filename);
 
+/**
+ * Read the vector from a binary file written by HYPRE_IJVectorPrintBinary,
+ * on any number of processors (see HYPRE_IJMatrixReadBinary).
+ **/
+HYPRE_Int HYPRE_IJVectorReadBinary(const char     *filename,
+                                   MPI_Comm        comm,
+                                   HYPRE_Int       type,
+                                   HYPRE_IJVector *vector);
+
+/**
+ * Print the vector to a single binary file (see HYPRE_IJMatrixPrintBinary).
+ **/
+HYPRE_Int HYPRE_IJVectorPrintBinary(HYPRE_IJVector  vector,
+                                    const char     *filename);
+
 /**@}*/
 /**@}*/
 
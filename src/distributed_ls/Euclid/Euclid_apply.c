@@ -34,10 +34,22 @@ void Euclid_dhApply(Euclid_dh ctx, HYPRE_Real *rhs, HYPRE_Real *lhs)
   /* case 1: no preconditioning */
   if (! strcmp(ctx->algo_ilu, "none") || ! strcmp(ctx->algo_par, "none")) {
     HYPRE_Int i, m = ctx->m;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
     for (i=0; i<m; ++i) lhs[i] = rhs[i];
     goto END_OF_FUNCTION;
   } 
 
+  /* case 2: sequential and mpi block jacobi cases, with level scheduled
+     solves; the permutations and the scaling are done in the solves
+   */
+  if ((np_dh == 1 || ! strcmp(ctx->algo_par, "bj")) &&
+      ctx->F->levelRowsL != NULL && ! ctx->F->debug) {
+    Factor_dhSolveSeqLevels(rhs, lhs, ctx); CHECK_V_ERROR;
+    goto END_OF_FUNCTION;
+  }
+
   /*----------------------------------------------------------------
    * permute and scale rhs vector
    *----------------------------------------------------------------*/
@@ -120,8 +132,8 @@ void scale_rhs_private(Euclid_dh ctx, HYPRE_Real *rhs)
 
   /* if matrix was scaled, must scale the rhs */
   if (scale != NULL) {
-#ifdef USING_OPENMP_DH
-#pragma omp for schedule(static)
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
 #endif
     for (i=0; i<m; ++i) { rhs[i] *= scale[i]; }
   } 
@@ -136,6 +148,9 @@ void permute_vec_o2n_private(Euclid_dh ctx, HYPRE_Real *xIN, HYPRE_Real *xOUT)
   START_FUNC_DH
   HYPRE_Int i, m = ctx->m;
   HYPRE_Int *o2n = ctx->sg->o2n_col;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
   for (i=0; i<m; ++i) xOUT[i] = xIN[o2n[i]];
   END_FUNC_DH
 }
@@ -148,6 +163,9 @@ void permute_vec_n2o_private(Euclid_dh ctx, HYPRE_Real *xIN, HYPRE_Real *xOUT)
   START_FUNC_DH
   HYPRE_Int i, m = ctx->m;
   HYPRE_Int *n2o = ctx->sg->n2o_row;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
   for (i=0; i<m; ++i) xOUT[i] = xIN[n2o[i]];
   END_FUNC_DH
 }
@@ -280,6 +280,15 @@ void Euclid_dhSetup(Euclid_dh ctx)
     ctx->timing[SOLVE_SETUP_T] += (hypre_MPI_Wtime() - t1);
   }
 
+  /*-------------------------------------------------------------- 
+   * otherwise, set up the level schedules for threaded solves
+   *--------------------------------------------------------------*/
+  else if (strcmp(ctx->algo_par, "none")) {
+    t1 = hypre_MPI_Wtime();
+    Factor_dhSolveSeqSetup(ctx->F, ctx->sg); CHECK_V_ERROR;
+    ctx->timing[SOLVE_SETUP_T] += (hypre_MPI_Wtime() - t1);
+  }
+
 END_OF_FUNCTION: ;
 
   /*-------------------------------------------------------
@@ -69,6 +69,11 @@ void Factor_dhCreate(Factor_dh *mat)
   tmp->solveIsSetup = false;
   tmp->numbSolve = NULL;
 
+  tmp->numLevelsL = tmp->numLevelsU = 0;
+  tmp->levelStartsL = tmp->levelRowsL = NULL;
+  tmp->levelStartsU = tmp->levelRowsU = NULL;
+  tmp->n2o_col = NULL;
+
   tmp->debug = Parser_dhHasSwitch(parser_dh, "-debug_Factor");
   
   /* initialize MPI request to null */
@@ -105,6 +110,12 @@ void Factor_dhDestroy(Factor_dh mat)
   if (mat->sendindHi != NULL) { FREE_DH(mat->sendindHi); CHECK_V_ERROR; }
 
   if (mat->numbSolve != NULL) { Numbering_dhDestroy(mat->numbSolve); CHECK_V_ERROR; }
+
+  if (mat->levelStartsL != NULL) { FREE_DH(mat->levelStartsL); CHECK_V_ERROR; }
+  if (mat->levelRowsL != NULL) { FREE_DH(mat->levelRowsL); CHECK_V_ERROR; }
+  if (mat->levelStartsU != NULL) { FREE_DH(mat->levelStartsU); CHECK_V_ERROR; }
+  if (mat->levelRowsU != NULL) { FREE_DH(mat->levelRowsU); CHECK_V_ERROR; }
+  if (mat->n2o_col != NULL) { FREE_DH(mat->n2o_col); CHECK_V_ERROR; }
   
   /* cleanup MPI requests */
   for(i=0; i<MAX_MPI_TASKS; i++)
@@ -1081,6 +1092,133 @@ void Factor_dhSolveSeq(HYPRE_Real *rhs, HYPRE_Real *lhs, Euclid_dh ctx)
   END_FUNC_DH
 }
 
+/* sorts the rows 0..m-1 by level; rows of a level stay in increasing order */
+#undef __FUNC__
+#define __FUNC__ "level_schedule_private"
+static void level_schedule_private(HYPRE_Int m, HYPRE_Int *level, HYPRE_Int numLevels,
+                                   HYPRE_Int **startsOUT, HYPRE_Int **rowsOUT)
+{
+  START_FUNC_DH
+  HYPRE_Int i, *starts, *rows;
+
+  starts = (HYPRE_Int*)MALLOC_DH((numLevels+1)*sizeof(HYPRE_Int)); CHECK_V_ERROR;
+  rows = (HYPRE_Int*)MALLOC_DH(m*sizeof(HYPRE_Int)); CHECK_V_ERROR;
+
+  for (i=0; i<=numLevels; ++i) starts[i] = 0;
+  for (i=0; i<m; ++i) starts[level[i]+1] += 1;
+  for (i=0; i<numLevels; ++i) starts[i+1] += starts[i];
+  for (i=0; i<m; ++i) rows[starts[level[i]]++] = i;
+  for (i=numLevels; i>0; --i) starts[i] = starts[i-1];
+  starts[0] = 0;
+
+  *startsOUT = starts;
+  *rowsOUT = rows;
+  END_FUNC_DH
+}
+
+#undef __FUNC__
+#define __FUNC__ "Factor_dhSolveSeqSetup"
+void Factor_dhSolveSeqSetup(Factor_dh mat, SubdomainGraph_dh sg)
+{
+  START_FUNC_DH
+  HYPRE_Int i, j, lev, m = mat->m;
+  HYPRE_Int *rp = mat->rp, *cval = mat->cval, *diag = mat->diag;
+  HYPRE_Int *level;
+
+  if (mat->levelStartsL != NULL) { FREE_DH(mat->levelStartsL); CHECK_V_ERROR; }
+  if (mat->levelRowsL != NULL) { FREE_DH(mat->levelRowsL); CHECK_V_ERROR; }
+  if (mat->levelStartsU != NULL) { FREE_DH(mat->levelStartsU); CHECK_V_ERROR; }
+  if (mat->levelRowsU != NULL) { FREE_DH(mat->levelRowsU); CHECK_V_ERROR; }
+  if (mat->n2o_col != NULL) { FREE_DH(mat->n2o_col); CHECK_V_ERROR; }
+  mat->levelStartsL = mat->levelRowsL = NULL;
+  mat->levelStartsU = mat->levelRowsU = NULL;
+  mat->n2o_col = NULL;
+  mat->numLevelsL = mat->numLevelsU = 0;
+
+  if (m == 0) goto END_OF_FUNCTION;
+
+  level = (HYPRE_Int*)MALLOC_DH(m*sizeof(HYPRE_Int)); CHECK_V_ERROR;
+
+  /* row i of L depends on the rows cval[j] < i of its strict lower part */
+  for (i=0; i<m; ++i) {
+    lev = 0;
+    for (j=rp[i]; j<diag[i]; ++j) lev = MAX(lev, level[cval[j]]+1);
+    level[i] = lev;
+    mat->numLevelsL = MAX(mat->numLevelsL, lev+1);
+  }
+  level_schedule_private(m, level, mat->numLevelsL,
+                         &mat->levelStartsL, &mat->levelRowsL); CHECK_V_ERROR;
+
+  /* row i of U depends on the rows cval[j] > i of its strict upper part */
+  for (i=m-1; i>=0; --i) {
+    lev = 0;
+    for (j=diag[i]+1; j<rp[i+1]; ++j) lev = MAX(lev, level[cval[j]]+1);
+    level[i] = lev;
+    mat->numLevelsU = MAX(mat->numLevelsU, lev+1);
+  }
+  level_schedule_private(m, level, mat->numLevelsU,
+                         &mat->levelStartsU, &mat->levelRowsU); CHECK_V_ERROR;
+
+  FREE_DH(level); CHECK_V_ERROR;
+
+  /* for writing the solution in the original ordering */
+  if (sg != NULL) {
+    mat->n2o_col = (HYPRE_Int*)MALLOC_DH(m*sizeof(HYPRE_Int)); CHECK_V_ERROR;
+    for (i=0; i<m; ++i) mat->n2o_col[sg->o2n_col[i]] = i;
+  }
+
+END_OF_FUNCTION: ;
+
+  END_FUNC_DH
+}
+
+#undef __FUNC__
+#define __FUNC__ "Factor_dhSolveSeqLevels"
+void Factor_dhSolveSeqLevels(HYPRE_Real *rhs, HYPRE_Real *lhs, Euclid_dh ctx)
+{
+  START_FUNC_DH
+  Factor_dh F = ctx->F;
+  HYPRE_Int *rp = F->rp, *cval = F->cval, *diag = F->diag;
+  REAL_DH   *aval = F->aval, *work = ctx->work;
+  HYPRE_Int *n2o_row = (ctx->sg != NULL) ? ctx->sg->n2o_row : NULL;
+  HYPRE_Int *n2o_col = F->n2o_col;
+  REAL_DH   *scale = (ctx->isScaled) ? ctx->scale : NULL;
+  HYPRE_Int lev, k, i, j;
+  REAL_DH   sum;
+
+  /* forward solve lower triangle, with the rhs permuted and scaled
+     on the fly; the rows of a level are independent */
+  for (lev=0; lev<F->numLevelsL; ++lev) {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(k,i,j,sum) HYPRE_SMP_SCHEDULE
+#endif
+    for (k=F->levelStartsL[lev]; k<F->levelStartsL[lev+1]; ++k) {
+      i = F->levelRowsL[k];
+      sum = (n2o_row == NULL) ? rhs[i] : rhs[n2o_row[i]];
+      if (scale != NULL) sum *= scale[i];
+      for (j=rp[i]; j<diag[i]; ++j) sum -= aval[j] * work[cval[j]];
+      work[i] = sum;
+    }
+  }
+
+  /* backward solve upper triangle, with the solution written
+     in the original ordering */
+  for (lev=0; lev<F->numLevelsU; ++lev) {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(k,i,j,sum) HYPRE_SMP_SCHEDULE
+#endif
+    for (k=F->levelStartsU[lev]; k<F->levelStartsU[lev+1]; ++k) {
+      i = F->levelRowsU[k];
+      sum = work[i];
+      for (j=diag[i]+1; j<rp[i+1]; ++j) sum -= aval[j] * work[cval[j]];
+      work[i] = sum*aval[diag[i]];
+      if (n2o_col == NULL) lhs[i] = work[i];
+      else lhs[n2o_col[i]] = work[i];
+    }
+  }
+  END_FUNC_DH
+}
+
 /*---------------------------------------------------------------
  * next two are used by Factor_dhPrintXXX methods
  *---------------------------------------------------------------*/
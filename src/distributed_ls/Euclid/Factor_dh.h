@@ -52,6 +52,16 @@ struct _factor_dh {
   hypre_MPI_Request  requests[MAX_MPI_TASKS];
   hypre_MPI_Status   status[MAX_MPI_TASKS];  
 
+  /* level schedules of L and U for the threaded triangular solves of
+     the sequential and block Jacobi cases (Factor_dhSolveSeqSetup):
+     the rows of level k are levelRowsL[levelStartsL[k]] ...
+     levelRowsL[levelStartsL[k+1]-1], and likewise for U.
+  */
+  HYPRE_Int    numLevelsL, numLevelsU;
+  HYPRE_Int   *levelStartsL, *levelRowsL;
+  HYPRE_Int   *levelStartsU, *levelRowsU;
+  HYPRE_Int   *n2o_col;  /* inverse of sg->o2n_col, or NULL */
+
   bool debug;
 };
 
@@ -75,6 +85,13 @@ extern void Factor_dhSolveSetup(Factor_dh mat, SubdomainGraph_dh sg);
 extern void Factor_dhSolve(HYPRE_Real *rhs, HYPRE_Real *lhs, Euclid_dh ctx);
 extern void Factor_dhSolveSeq(HYPRE_Real *rhs, HYPRE_Real *lhs, Euclid_dh ctx);
 
+extern void Factor_dhSolveSeqSetup(Factor_dh mat, SubdomainGraph_dh sg);
+  /* sets up the level schedules for Factor_dhSolveSeqLevels() */
+extern void Factor_dhSolveSeqLevels(HYPRE_Real *rhs, HYPRE_Real *lhs, Euclid_dh ctx);
+  /* same as permuting and scaling rhs, calling Factor_dhSolveSeq(),
+     and unpermuting lhs, but in two threaded sweeps; rhs is not changed
+   */
+
   /* functions for monitoring stability */
 extern HYPRE_Real Factor_dhCondEst(Factor_dh mat, Euclid_dh ctx);
 extern HYPRE_Real Factor_dhMaxValue(Factor_dh mat);
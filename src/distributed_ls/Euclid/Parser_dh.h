@@ -14,9 +14,9 @@ extern void Parser_dhCreate(Parser_dh *p);
 extern void Parser_dhDestroy(Parser_dh p);
 
 extern bool Parser_dhHasSwitch(Parser_dh p,const char *in);
-extern bool Parser_dhReadString(Parser_dh p, char *in, char **out);
-extern bool Parser_dhReadInt(Parser_dh p, char *in, HYPRE_Int *out);
-extern bool Parser_dhReadDouble(Parser_dh p, char *in, HYPRE_Real *out);
+extern bool Parser_dhReadString(Parser_dh p,const char *in, char **out);
+extern bool Parser_dhReadInt(Parser_dh p,const char *in, HYPRE_Int *out);
+extern bool Parser_dhReadDouble(Parser_dh p,const char *in, HYPRE_Real *out);
   /* if the flag (char *in) is found, these four return 
      true and set "out" accordingly.  If not found, they return 
      false, and "out" is unaltered.
@@ -27,12 +27,12 @@ extern void Parser_dhPrint(Parser_dh p, FILE *fp, bool allPrint);
    * only meaningful when Euclid is compiled in MPI mode
    */
 
-extern void Parser_dhInsert(Parser_dh p, char *name, char *value);
+extern void Parser_dhInsert(Parser_dh p,const char *name,const char *value);
   /* For inserting a new <flag,value> pair, or altering
    * the value of an existing pair from within user apps.
    */
 
-extern void Parser_dhUpdateFromFile(Parser_dh p, char *name);
+extern void Parser_dhUpdateFromFile(Parser_dh p,const char *name);
 
 extern void Parser_dhInit(Parser_dh p, HYPRE_Int argc, char *argv[]);
   /* Init enters <flag,value> pairs in its internal database in
@@ -23,16 +23,6 @@
  * files are included.
  *-----------------------------------------------------------------------*/
 
-#if defined(HYPRE_MODE)
-#include "HYPRE_parcsr_mv.h"
-#include "HYPRE_config.h"
-#include "HYPRE_distributed_matrix_mv.h"
-#include "_hypre_utilities.h"
-
-#elif defined(PETSC_MODE)
-#include "petsc_config.h"
-#endif
-
 #if ( !defined(FAKE_MPI) && defined(USING_MPI) && \
       !defined(HYPRE_MODE) && !defined(PETSC_MODE) )
 #include <mpi.h> 
@@ -122,8 +112,8 @@ extern HYPRE_Int  ref_counter; /* for internal use only!  Reference counter
  * macros defined in "macros_dh.h"
  */
 extern bool  errFlag_dh;
-extern void  setInfo_dh(char *msg, char *function, char *file, HYPRE_Int line);
-extern void  setError_dh(char *msg, char *function, char *file, HYPRE_Int line);
+extern void  setInfo_dh(const char *msg,const char *function,const char *file, HYPRE_Int line);
+extern void  setError_dh(const char *msg,const char *function,const char *file, HYPRE_Int line);
 extern void  printErrorMsg(FILE *fp);
 
 #ifndef hypre_MPI_MAX_ERROR_STRING
@@ -131,7 +121,11 @@ extern void  printErrorMsg(FILE *fp);
 #endif
 
 #define MSG_BUF_SIZE_DH MAX(1024, hypre_MPI_MAX_ERROR_STRING)
+#if defined(HYPRE_USING_RAJA) || defined(HYPRE_USING_KOKKOS) || defined(HYPRE_USING_CUDA)
+static char  msgBuf_dh[MSG_BUF_SIZE_DH];
+#else
 extern char  msgBuf_dh[MSG_BUF_SIZE_DH];
+#endif
 
 /* Each processor (may) open a logfile.
  * The bools are switches for controlling the amount of informational 
@@ -146,15 +140,15 @@ extern bool logFuncsToStderr;
 extern bool logFuncsToFile;
 extern void Error_dhStartFunc(char *function, char *file, HYPRE_Int line);
 extern void Error_dhEndFunc(char *function);
-extern void dh_StartFunc(char *function, char *file, HYPRE_Int line, HYPRE_Int priority);
-extern void dh_EndFunc(char *function, HYPRE_Int priority);
+extern void dh_StartFunc(const char *function,const char *file, HYPRE_Int line, HYPRE_Int priority);
+extern void dh_EndFunc(const char *function, HYPRE_Int priority);
 extern void printFunctionStack(FILE *fp);
 
 extern void EuclidInitialize(HYPRE_Int argc, char *argv[], char *help); /* instantiates global objects */
 extern void EuclidFinalize();    /* deletes global objects */
 extern bool EuclidIsInitialized(); 
-extern void printf_dh(char *fmt, ...);
-extern void fprintf_dh(FILE *fp, char *fmt, ...);
+extern void printf_dh(const char *fmt, ...);
+extern void fprintf_dh(FILE *fp,const char *fmt, ...);
 
   /* echo command line invocation to stdout.
      The "prefix" string is for grepping; it may be NULL.
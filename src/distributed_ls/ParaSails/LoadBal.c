@@ -25,6 +25,11 @@
  * will receive is "num_taken".  Additional donor information is stored in
  * "donor_data_pe" and "donor_data_cost".
  *
+ * The work of a processor is shared by its threads, so the processors are
+ * balanced by their work per thread, i.e., a processor running more threads
+ * receives proportionally more work.  With equal numbers of threads, this
+ * is the same as balancing the work.
+ *
  * local_cost - amount of work that this processor has
  * beta - target load balance factor
  *--------------------------------------------------------------------------*/
@@ -35,6 +40,7 @@ void LoadBalInit(MPI_Comm comm, HYPRE_Real local_cost, HYPRE_Real beta,
 {
     HYPRE_Int mype, npes;
     HYPRE_Real *cost, average, upper, move, accept;
+    HYPRE_Int *threads, num_threads, total_threads;
     HYPRE_Int i, jj, j;
 
     *num_given = 0;
@@ -47,23 +53,31 @@ void LoadBalInit(MPI_Comm comm, HYPRE_Real local_cost, HYPRE_Real beta,
     hypre_MPI_Comm_size(comm, &npes);
 
     cost = hypre_TAlloc(HYPRE_Real, npes , HYPRE_MEMORY_HOST);
+    threads = hypre_TAlloc(HYPRE_Int, npes , HYPRE_MEMORY_HOST);
 
     hypre_MPI_Allgather(&local_cost, 1, hypre_MPI_REAL, cost, 1, hypre_MPI_REAL, comm);
 
-    /* Compute the average cost */
+    num_threads = hypre_NumThreads();
+    hypre_MPI_Allgather(&num_threads, 1, HYPRE_MPI_INT, threads, 1, HYPRE_MPI_INT, comm);
+
+    /* Compute the average cost per thread */
     average = 0.0;
+    total_threads = 0;
     for (i=0; i<npes; i++)
+    {
         average += cost[i];
-    average = average / npes;
+        total_threads += threads[i];
+    }
+    average = average / total_threads;
 
-    /* Maximum cost allowed by load balancer */
+    /* Maximum cost per thread allowed by load balancer */
     upper = average / beta;
 
     for (i=0; i<npes; i++)
     {
-        if (cost[i] > upper)
+        if (cost[i] > upper * threads[i])
         {
-            move = cost[i] - upper;
+            move = cost[i] - upper * threads[i];
 
             /* for j=[i+1:n 1:i-1] */
             for (jj=i+1; jj<=i+npes; jj++)
@@ -72,9 +86,9 @@ void LoadBalInit(MPI_Comm comm, HYPRE_Real local_cost, HYPRE_Real beta,
 		if (j == i)
 		    continue;
 
-                if (cost[j] < average)
+                if (cost[j] < average * threads[j])
                 {
-                    accept = upper - cost[j];
+                    accept = upper * threads[j] - cost[j];
 
                     /* If we are sender, record it */
                     if (mype == i)
@@ -110,7 +124,7 @@ void LoadBalInit(MPI_Comm comm, HYPRE_Real local_cost, HYPRE_Real beta,
                             hypre_printf("moved from %d to %d (%7.1e)\n", i,j,accept);
 #endif
                         /*nummoves = nummoves + 1;*/
-                        move = cost[i] - upper;
+                        move = cost[i] - upper * threads[i];
                     }
                 }
             }
@@ -118,6 +132,7 @@ void LoadBalInit(MPI_Comm comm, HYPRE_Real local_cost, HYPRE_Real beta,
     }
 
     free(cost);
+    free(threads);
 }
 
 /*--------------------------------------------------------------------------
@@ -986,6 +986,387 @@ static void ConstructPatternForEachRowExt(HYPRE_Int symmetric,
     RowPattDestroy(row_patt2);
 }
 
+/*--------------------------------------------------------------------------
+ * OrderRowsByLength - return the rows local_beg_row, ..., mat->end_row of
+ * "mat" sorted by decreasing row length (stable counting sort).  Since the
+ * cost of a local solve grows with the row length, handing out the rows in
+ * this order to threads that pick them up dynamically balances the work
+ * among the threads.  Caller must free the returned array.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int *OrderRowsByLength(Matrix *mat, HYPRE_Int local_beg_row,
+  HYPRE_Int maxlen)
+{
+    HYPRE_Int *order, *count;
+    HYPRE_Int row, len, *ind, i;
+    HYPRE_Real *val;
+
+    count = hypre_CTAlloc(HYPRE_Int, maxlen+2, HYPRE_MEMORY_HOST);
+    order = hypre_TAlloc(HYPRE_Int, mat->end_row - local_beg_row + 1,
+        HYPRE_MEMORY_HOST);
+
+    for (row=local_beg_row; row<=mat->end_row; row++)
+    {
+        MatrixGetRow(mat, row - mat->beg_row, &len, &ind, &val);
+        count[maxlen-len+1]++;
+    }
+
+    for (i=0; i<=maxlen; i++)
+        count[i+1] += count[i];
+
+    for (row=local_beg_row; row<=mat->end_row; row++)
+    {
+        MatrixGetRow(mat, row - mat->beg_row, &len, &ind, &val);
+        order[count[maxlen-len]++] = row;
+    }
+
+    free(count);
+
+    return order;
+}
+
+#ifndef ESSL
+
+/* Local systems of the same size are solved in batches of at most
+   PARASAILS_BATCH_MAX systems, and with about PARASAILS_BATCH_SIZE
+   matrix entries in a batch */
+#define PARASAILS_BATCH_MAX   16
+#define PARASAILS_BATCH_SIZE  32768
+#define PARASAILS_BATCH_COUNT(len) \
+    MAX(1, MIN(PARASAILS_BATCH_MAX, PARASAILS_BATCH_SIZE/MAX(1,(len)*(len))))
+
+/*--------------------------------------------------------------------------
+ * BatchCholeskySolve - factor and solve "nb" symmetric positive definite
+ * systems of size "n" at once.  The systems are stored interleaved, i.e.,
+ * entry (i,j) of matrix k is a[(j*n+i)*nb+k] and entry i of right-hand side
+ * k is b[i*nb+k], so the innermost loops run over the systems of the batch.
+ * Only the lower triangular part of each matrix is referenced; it is
+ * overwritten by the Cholesky factor, and the right-hand sides by the
+ * solutions.  info[k] is nonzero if matrix k is not positive definite.
+ * Unlike the internal LAPACK, this may be called by several threads at once.
+ *--------------------------------------------------------------------------*/
+
+static void BatchCholeskySolve(HYPRE_Int n, HYPRE_Int nb, HYPRE_Real *a,
+  HYPRE_Real *b, HYPRE_Int *info)
+{
+    HYPRE_Int i, j, p, k;
+    HYPRE_Real *ajj, *aij, *aip, *ajp, *bi, *bp;
+
+    for (k=0; k<nb; k++)
+        info[k] = 0;
+
+    /* Factor phase, left-looking by columns */
+    for (j=0; j<n; j++)
+    {
+        ajj = &a[(j*n+j)*nb];
+        for (p=0; p<j; p++)
+        {
+            ajp = &a[(p*n+j)*nb];
+            for (k=0; k<nb; k++)
+                ajj[k] -= ajp[k]*ajp[k];
+        }
+
+        for (k=0; k<nb; k++)
+        {
+            if (ajj[k] <= 0.0)
+            {
+                if (info[k] == 0)
+                    info[k] = j+1;
+                ajj[k] = 1.0;
+            }
+            ajj[k] = sqrt(ajj[k]);
+        }
+
+        for (i=j+1; i<n; i++)
+        {
+            aij = &a[(j*n+i)*nb];
+            for (p=0; p<j; p++)
+            {
+                aip = &a[(p*n+i)*nb];
+                ajp = &a[(p*n+j)*nb];
+                for (k=0; k<nb; k++)
+                    aij[k] -= aip[k]*ajp[k];
+            }
+            for (k=0; k<nb; k++)
+                aij[k] /= ajj[k];
+        }
+    }
+
+    /* Solve phase, L y = b */
+    for (i=0; i<n; i++)
+    {
+        bi = &b[i*nb];
+        for (p=0; p<i; p++)
+        {
+            aip = &a[(p*n+i)*nb];
+            bp  = &b[p*nb];
+            for (k=0; k<nb; k++)
+                bi[k] -= aip[k]*bp[k];
+        }
+        aij = &a[(i*n+i)*nb];
+        for (k=0; k<nb; k++)
+            bi[k] /= aij[k];
+    }
+
+    /* Solve phase, L^T x = y */
+    for (i=n-1; i>=0; i--)
+    {
+        bi = &b[i*nb];
+        for (p=i+1; p<n; p++)
+        {
+            aip = &a[(i*n+p)*nb];
+            bp  = &b[p*nb];
+            for (k=0; k<nb; k++)
+                bi[k] -= aip[k]*bp[k];
+        }
+        aij = &a[(i*n+i)*nb];
+        for (k=0; k<nb; k++)
+            bi[k] /= aij[k];
+    }
+}
+
+/*--------------------------------------------------------------------------
+ * LeastSquaresQR - solve the least squares problem min || ahat x - bhat ||
+ * for the m x n matrix ahat (column-major, m >= n) by Householder QR.  On
+ * return, the solution is in the first n entries of bhat.  ahat is
+ * overwritten, and rdiag (length n) is workspace.  Returns nonzero if ahat
+ * does not have full rank.  Unlike the internal LAPACK, this may be called
+ * by several threads at once.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int LeastSquaresQR(HYPRE_Int m, HYPRE_Int n, HYPRE_Real *ahat,
+  HYPRE_Real *bhat, HYPRE_Real *rdiag)
+{
+    HYPRE_Int i, j, l;
+    HYPRE_Real *v, *y, norm, alpha, tau, s;
+
+    for (j=0; j<n; j++)
+    {
+        /* Householder reflection I - tau v v^T taking column j to alpha e_j */
+        v = &ahat[j*m];
+        norm = 0.0;
+        for (i=j; i<m; i++)
+            norm += v[i]*v[i];
+        norm = sqrt(norm);
+        if (norm == 0.0)
+            return j+1;
+
+        alpha = (v[j] > 0.0) ? -norm : norm;
+        tau = 1.0 / (alpha * (alpha - v[j]));
+        v[j] -= alpha;
+        rdiag[j] = alpha;
+
+        /* Apply the reflection to the remaining columns and to bhat */
+        for (l=j+1; l<=n; l++)
+        {
+            y = (l < n) ? &ahat[l*m] : bhat;
+            s = 0.0;
+            for (i=j; i<m; i++)
+                s += v[i]*y[i];
+            s *= tau;
+            for (i=j; i<m; i++)
+                y[i] -= s*v[i];
+        }
+    }
+
+    /* Back substitution with R */
+    for (j=n-1; j>=0; j--)
+    {
+        s = bhat[j];
+        for (l=j+1; l<n; l++)
+            s -= ahat[l*m+j]*bhat[l];
+        bhat[j] = s / rdiag[j];
+    }
+
+    return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * ComputeValuesSymBatch - compute the values of the "nb" rows "rows" of the
+ * approximate inverse, which all have the same length.  "diag" holds the
+ * local indices of the rows.  marker (all -1 on entry and exit), ahat and
+ * bhat are workspace owned by the calling thread.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int ComputeValuesSymBatch(StoredRows *stored_rows, Matrix *mat,
+  HYPRE_Int symmetric, HYPRE_Int nb, const HYPRE_Int *rows,
+  const HYPRE_Int *diag, HYPRE_Int *marker, HYPRE_Real *ahat, HYPRE_Real *bhat)
+{
+    HYPRE_Int len, *ind, len2, *ind2, loc;
+    HYPRE_Real *val, *val2, temp;
+    HYPRE_Int i, j, k;
+    HYPRE_Int dloc[PARASAILS_BATCH_MAX], info[PARASAILS_BATCH_MAX];
+    HYPRE_Int error = 0;
+
+    MatrixGetRow(mat, rows[0] - mat->beg_row, &len, &ind, &val);
+
+    /* Initialize ahat and bhat to zero */
+    memset(ahat, 0, len*len*nb * sizeof(HYPRE_Real));
+    memset(bhat, 0, len*nb * sizeof(HYPRE_Real));
+
+    for (k=0; k<nb; k++)
+    {
+        /* Retrieve local indices */
+        MatrixGetRow(mat, rows[k] - mat->beg_row, &len, &ind, &val);
+
+        /* Fill marker array in locations of local indices */
+        for (i=0; i<len; i++)
+            marker[ind[i]] = i;
+
+        /* Form ahat matrix, entries correspond to indices in "ind" only */
+        for (i=0; i<len; i++)
+        {
+            StoredRowsGet(stored_rows, ind[i], &len2, &ind2, &val2);
+            hypre_assert(len2 > 0);
+
+            for (j=0; j<len2; j++)
+            {
+                loc = marker[ind2[j]];
+
+                if (loc != -1)
+                    ahat[(i*len+loc)*nb+k] = val2[j];
+            }
+        }
+
+        /* Only the lower triangular part is referenced by the solver */
+        if (symmetric == 2)
+        {
+            for (i=0; i<len; i++)
+            {
+                for (j=i+1; j<len; j++)
+                {
+                    ahat[(i*len+j)*nb+k] =
+                        (ahat[(i*len+j)*nb+k] + ahat[(j*len+i)*nb+k]) / 2.0;
+                }
+            }
+        }
+
+        /* Set the right-hand side */
+        loc = marker[diag[k]];
+        hypre_assert(loc != -1);
+        bhat[loc*nb+k] = 1.0;
+        dloc[k] = loc;
+
+        /* Reset marker array */
+        for (i=0; i<len; i++)
+            marker[ind[i]] = -1;
+    }
+
+    /* Solve local linear systems */
+    BatchCholeskySolve(len, nb, ahat, bhat, info);
+
+    /* Scale the results and store them in the rows */
+    for (k=0; k<nb; k++)
+    {
+        if (info[k] != 0)
+            error = 1;
+
+        MatrixGetRow(mat, rows[k] - mat->beg_row, &len, &ind, &val);
+        temp = 1.0 / sqrt(ABS(bhat[dloc[k]*nb+k]));
+        for (i=0; i<len; i++)
+            val[i] = bhat[i*nb+k] * temp;
+    }
+
+    return error;
+}
+
+/*--------------------------------------------------------------------------
+ * ComputeValuesSym
+ *
+ * The rows are sorted by decreasing length and cut into batches of rows of
+ * equal length, whose local systems are solved together.  The batches are
+ * distributed dynamically among the threads, each with its own workspace.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int ComputeValuesSym(StoredRows *stored_rows, Matrix *mat,
+  HYPRE_Int local_beg_row, Numbering *numb, HYPRE_Int symmetric)
+{
+    HYPRE_Int num_rows = mat->end_row - local_beg_row + 1;
+    HYPRE_Int *order, *diag, *batch_starts, num_batches;
+    HYPRE_Int row, maxlen, len, len2, *ind;
+    HYPRE_Real *val;
+    HYPRE_Int i, k, nb;
+
+    HYPRE_Int error = 0;
+
+    if (num_rows <= 0)
+        return 0;
+
+    /* Determine the length of the longest row of M on this processor */
+    /* This determines the maximum storage required for the ahat matrix */
+    maxlen = 0;
+    for (row=local_beg_row; row<=mat->end_row; row++)
+    {
+        MatrixGetRow(mat, row - mat->beg_row, &len, &ind, &val);
+        maxlen = (len > maxlen ? len : maxlen);
+    }
+
+    order = OrderRowsByLength(mat, local_beg_row, maxlen);
+
+    /* Local indices of the rows, looked up here since the numbering may
+       not be modified by the threads below */
+    diag = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+    NumberingGlobalToLocal(numb, num_rows, order, diag);
+
+    /* Cut the sorted rows into batches of rows of equal length */
+    batch_starts = hypre_TAlloc(HYPRE_Int, num_rows+1, HYPRE_MEMORY_HOST);
+    num_batches = 0;
+    i = 0;
+    while (i < num_rows)
+    {
+        batch_starts[num_batches++] = i;
+        MatrixGetRow(mat, order[i] - mat->beg_row, &len, &ind, &val);
+        nb = PARASAILS_BATCH_COUNT(len);
+        for (k=1, i++; k<nb && i<num_rows; k++, i++)
+        {
+            MatrixGetRow(mat, order[i] - mat->beg_row, &len2, &ind, &val);
+            if (len2 != len)
+                break;
+        }
+    }
+    batch_starts[num_batches] = num_rows;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i, k) reduction(|:error)
+#endif
+    {
+        HYPRE_Int *marker;
+        HYPRE_Real *ahat, *bhat;
+
+        /* Allocate and initialize full length marker array */
+        marker = hypre_TAlloc(HYPRE_Int, numb->num_ind , HYPRE_MEMORY_HOST);
+        for (i=0; i<numb->num_ind; i++)
+            marker[i] = -1;
+
+        ahat = hypre_TAlloc(HYPRE_Real, MAX(PARASAILS_BATCH_SIZE, maxlen*maxlen),
+            HYPRE_MEMORY_HOST);
+        bhat = hypre_TAlloc(HYPRE_Real, maxlen*PARASAILS_BATCH_MAX,
+            HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (k=0; k<num_batches; k++)
+        {
+            error |= ComputeValuesSymBatch(stored_rows, mat, symmetric,
+                batch_starts[k+1] - batch_starts[k], &order[batch_starts[k]],
+                &diag[batch_starts[k]], marker, ahat, bhat);
+        }
+
+        free(marker);
+        free(ahat);
+        free(bhat);
+    }
+
+    free(order);
+    free(diag);
+    free(batch_starts);
+
+    return error;
+}
+
+#else /* ESSL */
+
 /*--------------------------------------------------------------------------
  * ComputeValuesSym
  *--------------------------------------------------------------------------*/
@@ -1000,17 +1381,6 @@ static HYPRE_Int ComputeValuesSym(StoredRows *stored_rows, Matrix *mat,
     HYPRE_Real *ahat, *ahatp;
     HYPRE_Int i, j, len2, *ind2, loc;
     HYPRE_Real *val2, temp;
-    HYPRE_Real time0, time1, timet = 0.0, timea = 0.0;
-
-    HYPRE_Real ahatcost = 0.0;
-
-    HYPRE_Real error = 0;
-
-#ifndef ESSL
-    char uplo = 'L';
-    HYPRE_Int one = 1;
-    HYPRE_Int info;
-#endif
 
     /* Allocate and initialize full length marker array */
     marker = hypre_TAlloc(HYPRE_Int, numb->num_ind , HYPRE_MEMORY_HOST);
@@ -1026,11 +1396,7 @@ static HYPRE_Int ComputeValuesSym(StoredRows *stored_rows, Matrix *mat,
         maxlen = (len > maxlen ? len : maxlen);
     }
 
-#ifdef ESSL
     ahat = hypre_TAlloc(HYPRE_Real, maxlen*(maxlen+1)/2 , HYPRE_MEMORY_HOST);
-#else
-    ahat = hypre_TAlloc(HYPRE_Real, maxlen*maxlen , HYPRE_MEMORY_HOST);
-#endif
 
     /* Compute values for row "row" of approximate inverse */
     for (row=local_beg_row; row<=mat->end_row; row++)
@@ -1043,15 +1409,7 @@ static HYPRE_Int ComputeValuesSym(StoredRows *stored_rows, Matrix *mat,
             marker[ind[i]] = i;
 
         /* Initialize ahat to zero */
-#ifdef ESSL
-/*        bzero((char *) ahat, len*(len+1)/2 * sizeof(HYPRE_Real));*/
         memset(ahat, 0, len*(len+1)/2 * sizeof(HYPRE_Real));
-#else
-/*        bzero((char *) ahat, len*len * sizeof(HYPRE_Real));*/
-        memset(ahat, 0, len*len * sizeof(HYPRE_Real));
-#endif
-
-        time0 = hypre_MPI_Wtime();
 
         /* Form ahat matrix, entries correspond to indices in "ind" only */
         ahatp = ahat;
@@ -1060,7 +1418,6 @@ static HYPRE_Int ComputeValuesSym(StoredRows *stored_rows, Matrix *mat,
             StoredRowsGet(stored_rows, ind[i], &len2, &ind2, &val2);
             hypre_assert(len2 > 0);
 
-#ifdef ESSL
             for (j=0; j<len2; j++)
             {
                 loc = marker[ind2[j]];
@@ -1071,46 +1428,16 @@ static HYPRE_Int ComputeValuesSym(StoredRows *stored_rows, Matrix *mat,
             }
 
             ahatp += (len-i);
-#else
-            for (j=0; j<len2; j++)
-            {
-                loc = marker[ind2[j]];
-
-                if (loc != -1)
-                    ahatp[loc] = val2[j];
-            }
-
-            ahatp += len;
-#endif
         }
 
         if (symmetric == 2)
         {
-#ifdef ESSL
             hypre_printf("Symmetric precon for nonsym problem not yet available\n");
             hypre_printf("for ESSL version.  Please contact the author.\n");
             PARASAILS_EXIT;
-#else
-            HYPRE_Int k, kk;
-            k = 0;
-            for (i=0; i<len; i++)
-            {
-                for (j=0; j<len; j++)
-                {
-                    kk = j*len + i;
-                    ahat[k] = (ahat[k] + ahat[kk]) / 2.0;
-                    k++;
-                }
-            }
-#endif
         }
 
-        time1 = hypre_MPI_Wtime();
-        timea += (time1-time0);
-        ahatcost += (HYPRE_Real) (len*len2);
-
         /* Set the right-hand side */
-/*        bzero((char *) val, len*sizeof(HYPRE_Real));*/
         memset(val, 0, len*sizeof(HYPRE_Real));
         NumberingGlobalToLocal(numb, 1, &row, &loc);
         loc = marker[loc];
@@ -1121,41 +1448,8 @@ static HYPRE_Int ComputeValuesSym(StoredRows *stored_rows, Matrix *mat,
         for (i=0; i<len; i++)
             marker[ind[i]] = -1;
 
-        time0 = hypre_MPI_Wtime();
-
-#ifdef ESSL
         dppf(ahat, len, 1);
         dpps(ahat, len, val, 1);
-#else
-        /* Solve local linear system - factor phase */
-        hypre_dpotrf(&uplo, &len, ahat, &len, &info);
-        if (info != 0)
-        {
-#if 0
-            hypre_printf("Matrix may not be symmetric positive definite.\n");
-            hypre_printf("ParaSails: row %d, dpotrf returned %d.\n", row, info);
-            hypre_printf("ParaSails: len %d, ahat: %f %f %f %f\n", len,
-                ahat[0], ahat[1], ahat[2], ahat[3]);
-            PARASAILS_EXIT;
-#endif
-            error = 1;
-        }
-
-        /* Solve local linear system - solve phase */
-        hypre_dpotrs(&uplo, &len, &one, ahat, &len, val, &len, &info);
-        if (info != 0)
-        {
-#if 0
-            hypre_printf("ParaSails: row %d, dpotrs returned %d.\n", row, info);
-            hypre_printf("ParaSails: len %d, ahat: %f %f %f %f\n", len,
-                ahat[0], ahat[1], ahat[2], ahat[3]);
-            PARASAILS_EXIT;
-#endif
-            error = 1;
-        }
-#endif
-        time1 = hypre_MPI_Wtime();
-        timet += (time1-time0);
 
         /* Scale the result */
         temp = 1.0 / sqrt(ABS(val[loc]));
@@ -1166,193 +1460,203 @@ static HYPRE_Int ComputeValuesSym(StoredRows *stored_rows, Matrix *mat,
     free(marker);
     free(ahat);
 
-#if 0
-    {
-    HYPRE_Int mype;
-    hypre_MPI_Comm_rank(hypre_MPI_COMM_WORLD, &mype);
-    hypre_printf("%d: Time for ahat: %f, for local solves: %f\n", mype, timea, timet);
-    hypre_printf("%d: ahatcost: %7.1e, numrows: %d, maxlen: %d\n",
-        mype, ahatcost, mat->end_row-local_beg_row+1, maxlen);
-    fflush(stdout);
-    }
-#endif
-
-    return error;
+    return 0;
 }
 
+#endif /* ESSL */
+
 /*--------------------------------------------------------------------------
  * ComputeValuesNonsym
+ *
+ * The rows are distributed dynamically among the threads, longest rows
+ * first, and each thread has its own workspace.
  *--------------------------------------------------------------------------*/
 
 static HYPRE_Int ComputeValuesNonsym(StoredRows *stored_rows, Matrix *mat,
   HYPRE_Int local_beg_row, Numbering *numb)
 {
-    HYPRE_Int *marker;
-    HYPRE_Real *ahat, *ahatp, *bhat;
-    HYPRE_Real *work;
-    HYPRE_Int ahat_size = 10000, bhat_size = 1000, work_size = 2000*64;
-
-    HYPRE_Int row, len, *ind;
+    HYPRE_Int num_rows = mat->end_row - local_beg_row + 1;
+    HYPRE_Int *order, *diag;
+    HYPRE_Int row, maxlen, len, *ind;
     HYPRE_Real *val;
+    HYPRE_Int r, i;
 
-    HYPRE_Int i, j, len2, *ind2, loc;
-    HYPRE_Real *val2;
-    HYPRE_Real time0, time1, timet = 0.0, timea = 0.0;
+    HYPRE_Int error = 0;
+
+    if (num_rows <= 0)
+        return 0;
 
-    HYPRE_Int npat;
-    HYPRE_Int pattsize = 1000;
-    HYPRE_Int *patt = hypre_TAlloc(HYPRE_Int, pattsize, HYPRE_MEMORY_HOST);
+    maxlen = 0;
+    for (row=local_beg_row; row<=mat->end_row; row++)
+    {
+        MatrixGetRow(mat, row - mat->beg_row, &len, &ind, &val);
+        maxlen = (len > maxlen ? len : maxlen);
+    }
 
-    HYPRE_Int info;
+    order = OrderRowsByLength(mat, local_beg_row, maxlen);
 
-    HYPRE_Int error = 0;
+    /* Local indices of the rows, looked up here since the numbering may
+       not be modified by the threads below */
+    diag = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+    NumberingGlobalToLocal(numb, num_rows, order, diag);
 
-#ifndef ESSL
-    char trans = 'N';
-    HYPRE_Int one = 1;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(r, i, row, len, ind, val) reduction(|:error)
 #endif
+    {
+        HYPRE_Int *marker;
+        HYPRE_Real *ahat, *ahatp, *bhat;
+        HYPRE_Real *work;
+        HYPRE_Int ahat_size = 10000, bhat_size = 1000;
+        HYPRE_Int work_size = MAX(2000*64, 2*maxlen);
 
-    /* Allocate and initialize marker array */
-    /* Since numb already knows about the indices of the external rows that
-       will be needed, numb_ind is the maximum size of the marker array */
-    marker = hypre_TAlloc(HYPRE_Int, numb->num_ind , HYPRE_MEMORY_HOST);
-    for (i=0; i<numb->num_ind; i++)
-        marker[i] = -1;
+        HYPRE_Int j, len2, *ind2, loc;
+        HYPRE_Real *val2;
 
-    bhat = hypre_TAlloc(HYPRE_Real, bhat_size , HYPRE_MEMORY_HOST);
-    ahat = hypre_TAlloc(HYPRE_Real, ahat_size , HYPRE_MEMORY_HOST);
-    work = hypre_CTAlloc(HYPRE_Real, work_size, HYPRE_MEMORY_HOST);
+        HYPRE_Int npat;
+        HYPRE_Int pattsize = 1000;
+        HYPRE_Int *patt = hypre_TAlloc(HYPRE_Int, pattsize, HYPRE_MEMORY_HOST);
 
-    /* Compute values for row "row" of approximate inverse */
-    for (row=local_beg_row; row<=mat->end_row; row++)
-    {
-        time0 = hypre_MPI_Wtime();
+        HYPRE_Int info;
 
-        /* Retrieve local indices */
-        MatrixGetRow(mat, row - mat->beg_row, &len, &ind, &val);
+#ifndef ESSL
+        char trans = 'N';
+        HYPRE_Int one = 1;
+#endif
 
-        npat = 0;
+        /* Allocate and initialize marker array */
+        /* Since numb already knows about the indices of the external rows
+           that will be needed, numb_ind is the maximum size of the marker
+           array */
+        marker = hypre_TAlloc(HYPRE_Int, numb->num_ind , HYPRE_MEMORY_HOST);
+        for (i=0; i<numb->num_ind; i++)
+            marker[i] = -1;
+
+        bhat = hypre_TAlloc(HYPRE_Real, bhat_size , HYPRE_MEMORY_HOST);
+        ahat = hypre_TAlloc(HYPRE_Real, ahat_size , HYPRE_MEMORY_HOST);
+        work = hypre_CTAlloc(HYPRE_Real, work_size, HYPRE_MEMORY_HOST);
+
+        /* Compute values for row "row" of approximate inverse */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (r=0; r<num_rows; r++)
+        {
+            row = order[r];
 
-        /* Put the diagonal entry into the marker array */
-        NumberingGlobalToLocal(numb, 1, &row, &loc);
-        marker[loc] = npat;
-        patt[npat++] = loc;
+            /* Retrieve local indices */
+            MatrixGetRow(mat, row - mat->beg_row, &len, &ind, &val);
 
-        /* Fill marker array */
-        for (i=0; i<len; i++)
-        {
-            StoredRowsGet(stored_rows, ind[i], &len2, &ind2, &val2);
-            hypre_assert(len2 > 0);
+            npat = 0;
 
-            for (j=0; j<len2; j++)
+            /* Put the diagonal entry into the marker array */
+            loc = diag[r];
+            marker[loc] = npat;
+            patt[npat++] = loc;
+
+            /* Fill marker array */
+            for (i=0; i<len; i++)
             {
-                loc = marker[ind2[j]];
+                StoredRowsGet(stored_rows, ind[i], &len2, &ind2, &val2);
+                hypre_assert(len2 > 0);
 
-                if (loc == -1)
+                for (j=0; j<len2; j++)
                 {
-                    marker[ind2[j]] = npat;
-                    if (npat >= pattsize)
+                    loc = marker[ind2[j]];
+
+                    if (loc == -1)
                     {
-                        pattsize = npat*2;
-                        patt = hypre_TReAlloc(patt,HYPRE_Int,  pattsize, HYPRE_MEMORY_HOST);
+                        marker[ind2[j]] = npat;
+                        if (npat >= pattsize)
+                        {
+                            pattsize = npat*2;
+                            patt = hypre_TReAlloc(patt,HYPRE_Int,  pattsize, HYPRE_MEMORY_HOST);
+                        }
+                        patt[npat++] = ind2[j];
                     }
-                    patt[npat++] = ind2[j];
                 }
             }
-        }
-
-        if (len*npat > ahat_size)
-        {
-            free(ahat);
-            ahat_size = len*npat;
-            ahat = hypre_TAlloc(HYPRE_Real, ahat_size , HYPRE_MEMORY_HOST);
-        }
-
-        /* Initialize ahat to zero */
-/*        bzero((char *) ahat, len*npat * sizeof(HYPRE_Real));*/
-        memset(ahat, 0, len*npat * sizeof(HYPRE_Real));
-
-        /* Form ahat matrix, entries correspond to indices in "ind" only */
-        ahatp = ahat;
-        for (i=0; i<len; i++)
-        {
-            StoredRowsGet(stored_rows, ind[i], &len2, &ind2, &val2);
 
-            for (j=0; j<len2; j++)
+            if (len*npat > ahat_size)
             {
-                loc = marker[ind2[j]];
-                ahatp[loc] = val2[j];
+                free(ahat);
+                ahat_size = len*npat;
+                ahat = hypre_TAlloc(HYPRE_Real, ahat_size , HYPRE_MEMORY_HOST);
             }
-            ahatp += npat;
-        }
 
-        time1 = hypre_MPI_Wtime();
-        timea += (time1-time0);
+            /* Initialize ahat to zero */
+            memset(ahat, 0, len*npat * sizeof(HYPRE_Real));
 
-        /* Reallocate bhat if necessary */
-        if (npat > bhat_size)
-        {
-            free(bhat);
-            bhat_size = npat;
-            bhat = hypre_TAlloc(HYPRE_Real, bhat_size , HYPRE_MEMORY_HOST);
-        }
+            /* Form ahat matrix, entries correspond to indices in "ind" only */
+            ahatp = ahat;
+            for (i=0; i<len; i++)
+            {
+                StoredRowsGet(stored_rows, ind[i], &len2, &ind2, &val2);
 
-        /* Set the right-hand side, bhat */
-/*        bzero((char *) bhat, npat*sizeof(HYPRE_Real));*/
-        memset(bhat, 0, npat*sizeof(HYPRE_Real));
-        NumberingGlobalToLocal(numb, 1, &row, &loc);
-        loc = marker[loc];
-        hypre_assert(loc != -1);
-        bhat[loc] = 1.0;
+                for (j=0; j<len2; j++)
+                {
+                    loc = marker[ind2[j]];
+                    ahatp[loc] = val2[j];
+                }
+                ahatp += npat;
+            }
 
-        /* Reset marker array */
-        for (i=0; i<npat; i++)
-            marker[patt[i]] = -1;
+            /* Reallocate bhat if necessary */
+            if (npat > bhat_size)
+            {
+                free(bhat);
+                bhat_size = npat;
+                bhat = hypre_TAlloc(HYPRE_Real, bhat_size , HYPRE_MEMORY_HOST);
+            }
+
+            /* Set the right-hand side, bhat */
+            memset(bhat, 0, npat*sizeof(HYPRE_Real));
+            loc = marker[diag[r]];
+            hypre_assert(loc != -1);
+            bhat[loc] = 1.0;
 
-        time0 = hypre_MPI_Wtime();
+            /* Reset marker array */
+            for (i=0; i<npat; i++)
+                marker[patt[i]] = -1;
 
 #ifdef ESSL
-        /* rhs in bhat, and put solution in val */
-        dgells(0, ahat, npat, bhat, npat, val, len, NULL, 1.e-12, npat, len, 1,
-            &info, work, work_size);
+            /* rhs in bhat, and put solution in val */
+            dgells(0, ahat, npat, bhat, npat, val, len, NULL, 1.e-12, npat, len, 1,
+                &info, work, work_size);
 #else
-        /* rhs in bhat, and put solution in bhat */
-        hypre_dgels(&trans, &npat, &len, &one, ahat, &npat,
-            bhat, &npat, work, &work_size, &info);
+            /* rhs in bhat, and put solution in bhat */
+            if (npat >= len)
+            {
+                info = LeastSquaresQR(npat, len, ahat, bhat, work);
+            }
+            else
+            {
+                /* underdetermined; the internal LAPACK is not thread safe */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp critical (ParaSails_dgels)
+#endif
+                hypre_dgels(&trans, &npat, &len, &one, ahat, &npat,
+                    bhat, &npat, work, &work_size, &info);
+            }
 
-        if (info != 0)
-        {
-#if 0
-            hypre_printf("ParaSails: row %d, dgels returned %d.\n", row, info);
-            hypre_printf("ParaSails: len %d, ahat: %f %f %f %f\n", len,
-                ahat[0], ahat[1], ahat[2], ahat[3]);
-            PARASAILS_EXIT;
+            if (info != 0)
+                error = 1;
+
+            /* Copy result into row */
+            for (j=0; j<len; j++)
+                val[j] = bhat[j];
 #endif
-            error = 1;
         }
 
-        /* Copy result into row */
-        for (j=0; j<len; j++)
-            val[j] = bhat[j];
-#endif
-        time1 = hypre_MPI_Wtime();
-        timet += (time1-time0);
+        free(patt);
+        free(marker);
+        free(bhat);
+        free(ahat);
+        free(work);
     }
 
-    free(patt);
-    free(marker);
-    free(bhat);
-    free(ahat);
-    free(work);
-
-#if 0
-    {
-    HYPRE_Int mype;
-    hypre_MPI_Comm_rank(hypre_MPI_COMM_WORLD, &mype);
-    hypre_printf("%d: Time for ahat: %f, for local solves: %f\n", mype, timea, timet);
-    fflush(stdout);
-    }
-#endif
+    free(order);
+    free(diag);
 
     return error;
 }
@@ -23,10 +23,19 @@
 #include "../../HYPRE.h"
 #include "../../utilities/_hypre_utilities.h"
 
+/* the preconditioner is applied as a ParCSR matrix */
+#include "../../parcsr_mv/_hypre_parcsr_mv.h"
+
 typedef struct
 {
    MPI_Comm   comm;
    ParaSails *ps;
+
+   /* copy of ps->M and vectors for hypre_ParaSailsApply */
+   hypre_ParCSRMatrix *M;
+   hypre_ParVector    *u;   /* input, data set at each apply */
+   hypre_ParVector    *v;   /* output, data set at each apply */
+   hypre_ParVector    *t;   /* intermediate vector of the factored inverse */
 }
    hypre_ParaSails_struct;
 
@@ -164,6 +173,168 @@ static Matrix *convert_matrix(MPI_Comm comm, HYPRE_DistributedMatrix distmat)
    return mat;
 }
 
+/*--------------------------------------------------------------------------
+ * convert_to_parcsr - Copy the preconditioner into a ParCSR matrix, so that
+ * it is applied with the (threaded) ParCSR matvec and its communication
+ * package.  The rows of ps->M are in the local numbering of M->numb, in
+ * which the local columns come first.
+ *--------------------------------------------------------------------------*/
+
+static void convert_to_parcsr(hypre_ParaSails_struct *internal)
+{
+   ParaSails  *ps   = internal->ps;
+   Matrix     *mat  = ps->M;
+   Numbering  *numb = mat->numb;
+   HYPRE_Int   num_rows = mat->end_row - mat->beg_row + 1;
+   HYPRE_Int   num_loc  = numb->num_loc;
+   HYPRE_Int   num_cols_offd = numb->num_ind - numb->num_loc;
+   HYPRE_Int   npes, row, len, *ind, i, j;
+   HYPRE_Int   diag_nnz, offd_nnz;
+   HYPRE_Int  *ext_to_offd, *perm;
+   HYPRE_BigInt *row_starts, *col_map_offd;
+   HYPRE_Real *val;
+
+   hypre_ParCSRMatrix *M;
+   hypre_CSRMatrix    *diag, *offd;
+   HYPRE_Int          *diag_i, *diag_j, *offd_i, *offd_j;
+   HYPRE_Real         *diag_data, *offd_data;
+
+   hypre_MPI_Comm_size(internal->comm, &npes);
+
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+   row_starts = hypre_CTAlloc(HYPRE_BigInt, 2, HYPRE_MEMORY_HOST);
+   row_starts[0] = (HYPRE_BigInt) mat->beg_row;
+   row_starts[1] = (HYPRE_BigInt) mat->end_row + 1;
+#else
+   row_starts = hypre_CTAlloc(HYPRE_BigInt, npes+1, HYPRE_MEMORY_HOST);
+   for (i=0; i<npes; i++)
+      row_starts[i] = (HYPRE_BigInt) mat->beg_rows[i];
+   row_starts[npes] = (HYPRE_BigInt) mat->end_rows[npes-1] + 1;
+#endif
+
+   /* offd columns in increasing global order */
+   col_map_offd = hypre_TAlloc(HYPRE_BigInt, num_cols_offd, HYPRE_MEMORY_HOST);
+   perm         = hypre_TAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
+   ext_to_offd  = hypre_TAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
+   for (i=0; i<num_cols_offd; i++)
+   {
+      col_map_offd[i] = (HYPRE_BigInt) numb->local_to_global[num_loc+i];
+      perm[i] = i;
+   }
+   hypre_BigQsortbi(col_map_offd, perm, 0, num_cols_offd-1);
+   for (i=0; i<num_cols_offd; i++)
+      ext_to_offd[perm[i]] = i;
+
+   diag_nnz = 0;
+   offd_nnz = 0;
+   for (row=0; row<num_rows; row++)
+   {
+      MatrixGetRow(mat, row, &len, &ind, &val);
+      for (j=0; j<len; j++)
+      {
+         if (ind[j] < num_loc)
+            diag_nnz++;
+         else
+            offd_nnz++;
+      }
+   }
+
+   M = hypre_ParCSRMatrixCreate(internal->comm,
+                                (HYPRE_BigInt) mat->end_rows[npes-1] + 1,
+                                (HYPRE_BigInt) mat->end_rows[npes-1] + 1,
+                                row_starts, row_starts,
+                                num_cols_offd, diag_nnz, offd_nnz);
+   hypre_ParCSRMatrixSetColStartsOwner(M, 0);
+   hypre_ParCSRMatrixInitialize(M);
+
+   diag      = hypre_ParCSRMatrixDiag(M);
+   offd      = hypre_ParCSRMatrixOffd(M);
+   diag_i    = hypre_CSRMatrixI(diag);
+   diag_j    = hypre_CSRMatrixJ(diag);
+   diag_data = hypre_CSRMatrixData(diag);
+   offd_i    = hypre_CSRMatrixI(offd);
+   offd_j    = hypre_CSRMatrixJ(offd);
+   offd_data = hypre_CSRMatrixData(offd);
+
+   diag_nnz = 0;
+   offd_nnz = 0;
+   for (row=0; row<num_rows; row++)
+   {
+      diag_i[row] = diag_nnz;
+      offd_i[row] = offd_nnz;
+
+      MatrixGetRow(mat, row, &len, &ind, &val);
+      for (j=0; j<len; j++)
+      {
+         if (ind[j] < num_loc)
+         {
+            diag_j[diag_nnz]    = ind[j];
+            diag_data[diag_nnz] = val[j];
+            diag_nnz++;
+         }
+         else
+         {
+            offd_j[offd_nnz]    = ext_to_offd[ind[j]-num_loc];
+            offd_data[offd_nnz] = val[j];
+            offd_nnz++;
+         }
+      }
+   }
+   diag_i[num_rows] = diag_nnz;
+   offd_i[num_rows] = offd_nnz;
+
+   for (i=0; i<num_cols_offd; i++)
+      hypre_ParCSRMatrixColMapOffd(M)[i] = col_map_offd[i];
+
+   hypre_TFree(col_map_offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(perm, HYPRE_MEMORY_HOST);
+   hypre_TFree(ext_to_offd, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRMatrixSetNumNonzeros(M);
+   hypre_MatvecCommPkgCreate(M);
+
+   /* shells for the input and output arrays; t owns its data */
+   internal->u = hypre_ParVectorCreate(internal->comm,
+                                       hypre_ParCSRMatrixGlobalNumRows(M),
+                                       hypre_ParCSRMatrixRowStarts(M));
+   hypre_ParVectorSetPartitioningOwner(internal->u, 0);
+   hypre_SeqVectorSetDataOwner(hypre_ParVectorLocalVector(internal->u), 0);
+
+   internal->v = hypre_ParVectorCreate(internal->comm,
+                                       hypre_ParCSRMatrixGlobalNumRows(M),
+                                       hypre_ParCSRMatrixRowStarts(M));
+   hypre_ParVectorSetPartitioningOwner(internal->v, 0);
+   hypre_SeqVectorSetDataOwner(hypre_ParVectorLocalVector(internal->v), 0);
+
+   internal->t = hypre_ParVectorCreate(internal->comm,
+                                       hypre_ParCSRMatrixGlobalNumRows(M),
+                                       hypre_ParCSRMatrixRowStarts(M));
+   hypre_ParVectorSetPartitioningOwner(internal->t, 0);
+   hypre_ParVectorInitialize(internal->t);
+
+   internal->M = M;
+}
+
+/*--------------------------------------------------------------------------
+ * destroy_parcsr - Free the ParCSR copy of the preconditioner.
+ *--------------------------------------------------------------------------*/
+
+static void destroy_parcsr(hypre_ParaSails_struct *internal)
+{
+   if (internal->M == NULL)
+      return;
+
+   hypre_ParVectorDestroy(internal->u);
+   hypre_ParVectorDestroy(internal->v);
+   hypre_ParVectorDestroy(internal->t);
+   hypre_ParCSRMatrixDestroy(internal->M);
+
+   internal->M = NULL;
+   internal->u = NULL;
+   internal->v = NULL;
+   internal->t = NULL;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParaSailsCreate - Return a ParaSails preconditioner object "obj"
  *--------------------------------------------------------------------------*/
@@ -177,6 +348,10 @@ HYPRE_Int hypre_ParaSailsCreate(MPI_Comm comm, hypre_ParaSails *obj)
 
    internal->comm = comm;
    internal->ps   = NULL;
+   internal->M    = NULL;
+   internal->u    = NULL;
+   internal->v    = NULL;
+   internal->t    = NULL;
 
    *obj = (hypre_ParaSails) internal;
 
@@ -191,6 +366,7 @@ HYPRE_Int hypre_ParaSailsDestroy(hypre_ParaSails obj)
 {
    hypre_ParaSails_struct *internal = (hypre_ParaSails_struct *) obj;
 
+   destroy_parcsr(internal);
    ParaSailsDestroy(internal->ps);
 
    hypre_TFree(internal, HYPRE_MEMORY_HOST);
@@ -214,6 +390,7 @@ HYPRE_Int hypre_ParaSailsSetup(hypre_ParaSails obj,
 
    mat = convert_matrix(internal->comm, distmat);
 
+   destroy_parcsr(internal);
    ParaSailsDestroy(internal->ps);
 
    internal->ps = ParaSailsCreate(internal->comm, 
@@ -236,7 +413,12 @@ HYPRE_Int hypre_ParaSailsSetup(hypre_ParaSails obj,
    if (err)
    {
       hypre_error(HYPRE_ERROR_GENERIC);
+      return hypre_error_flag;
    }
+
+   destroy_parcsr(internal);
+   convert_to_parcsr(internal);
+
    return hypre_error_flag;
 }
 
@@ -254,6 +436,7 @@ HYPRE_Int hypre_ParaSailsSetupPattern(hypre_ParaSails obj,
 
    mat = convert_matrix(internal->comm, distmat);
 
+   destroy_parcsr(internal);
    ParaSailsDestroy(internal->ps);
 
    internal->ps = ParaSailsCreate(internal->comm, 
@@ -296,7 +479,12 @@ HYPRE_Int hypre_ParaSailsSetupValues(hypre_ParaSails obj,
    if (err)
    {
       hypre_error(HYPRE_ERROR_GENERIC);
+      return hypre_error_flag;
    }
+
+   destroy_parcsr(internal);
+   convert_to_parcsr(internal);
+
    return hypre_error_flag;
 }
 
@@ -309,7 +497,27 @@ HYPRE_Int hypre_ParaSailsApply(hypre_ParaSails obj, HYPRE_Real *u, HYPRE_Real *v
 {
    hypre_ParaSails_struct *internal = (hypre_ParaSails_struct *) obj;
 
-   ParaSailsApply(internal->ps, u, v);
+   if (internal->M == NULL)
+   {
+      ParaSailsApply(internal->ps, u, v);
+      return hypre_error_flag;
+   }
+
+   hypre_VectorData(hypre_ParVectorLocalVector(internal->u)) = u;
+   hypre_VectorData(hypre_ParVectorLocalVector(internal->v)) = v;
+
+   if (internal->ps->symmetric)
+   {
+      hypre_ParCSRMatrixMatvec(1.0, internal->M, internal->u, 0.0, internal->t);
+      hypre_ParCSRMatrixMatvecT(1.0, internal->M, internal->t, 0.0, internal->v);
+   }
+   else
+   {
+      hypre_ParCSRMatrixMatvec(1.0, internal->M, internal->u, 0.0, internal->v);
+   }
+
+   hypre_VectorData(hypre_ParVectorLocalVector(internal->u)) = NULL;
+   hypre_VectorData(hypre_ParVectorLocalVector(internal->v)) = NULL;
 
    return hypre_error_flag;
 }
@@ -323,7 +531,16 @@ HYPRE_Int hypre_ParaSailsApplyTrans(hypre_ParaSails obj, HYPRE_Real *u, HYPRE_Re
 {
    hypre_ParaSails_struct *internal = (hypre_ParaSails_struct *) obj;
 
-   ParaSailsApplyTrans(internal->ps, u, v);
+   if (internal->M == NULL || internal->ps->symmetric)
+      return hypre_ParaSailsApply(obj, u, v);
+
+   hypre_VectorData(hypre_ParVectorLocalVector(internal->u)) = u;
+   hypre_VectorData(hypre_ParVectorLocalVector(internal->v)) = v;
+
+   hypre_ParCSRMatrixMatvecT(1.0, internal->M, internal->u, 0.0, internal->v);
+
+   hypre_VectorData(hypre_ParVectorLocalVector(internal->u)) = NULL;
+   hypre_VectorData(hypre_ParVectorLocalVector(internal->v)) = NULL;
 
    return hypre_error_flag;
 }
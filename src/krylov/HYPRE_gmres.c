@@ -217,6 +217,24 @@ HYPRE_GMRESGetSkipRealResidualCheck( HYPRE_Solver solver,
    return( hypre_GMRESGetSkipRealResidualCheck( (void *) solver, skip_real_r_check ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_GMRESSetSStep, HYPRE_GMRESGetSStep
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_GMRESSetSStep( HYPRE_Solver solver,
+                     HYPRE_Int    sstep )
+{
+   return( hypre_GMRESSetSStep( (void *) solver, sstep ) );
+}
+
+HYPRE_Int
+HYPRE_GMRESGetSStep( HYPRE_Solver solver,
+                     HYPRE_Int   *sstep )
+{
+   return( hypre_GMRESGetSStep( (void *) solver, sstep ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_GMRESSetPrecond
  *--------------------------------------------------------------------------*/
@@ -178,6 +178,18 @@ HYPRE_Int HYPRE_PCGSetRecomputeResidual(HYPRE_Solver solver,
 HYPRE_Int HYPRE_PCGSetRecomputeResidualP(HYPRE_Solver solver,
                                          HYPRE_Int    recompute_residual_p);
 
+/**
+ * (Optional) Use the pipelined variant of CG (Ghysels and Vanroose), which
+ * overlaps the global reduction of each iteration with the preconditioner
+ * application and the matvec.  It needs six additional vectors and may
+ * converge slightly differently due to rounding.  It is not combined with
+ * the relative-change, residual tolerance, convergence-factor and
+ * final-residual-recomputation options; the standard iteration is used if
+ * any of these is set.  The default is 0 (off).
+ **/
+HYPRE_Int HYPRE_PCGSetPipelined(HYPRE_Solver solver,
+                                HYPRE_Int    pipelined);
+
 /**
  * (Optional) Set the preconditioner to use.
  **/
@@ -259,6 +271,11 @@ HYPRE_Int HYPRE_PCGGetTwoNorm(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_PCGGetRelChange(HYPRE_Solver  solver,
                                 HYPRE_Int    *rel_change);
 
+/**
+ **/
+HYPRE_Int HYPRE_PCGGetPipelined(HYPRE_Solver  solver,
+                                HYPRE_Int    *pipelined);
+
 /**
  **/
 HYPRE_Int HYPRE_GMRESGetSkipRealResidualCheck(HYPRE_Solver solver,
@@ -376,6 +393,20 @@ HYPRE_Int HYPRE_GMRESSetRelChange(HYPRE_Solver solver,
 HYPRE_Int HYPRE_GMRESSetSkipRealResidualCheck(HYPRE_Solver solver,
                                               HYPRE_Int    skip_real_r_check);
 
+/**
+ * (Optional) Use s-step (communication-avoiding) GMRES with block size
+ * \e sstep.  Each block of \e sstep basis vectors is generated with a Newton
+ * basis, shifted by Leja-ordered Ritz values of the first restart cycle, and
+ * orthogonalized with one block Gram-Schmidt/Cholesky QR step, so that one
+ * global reduction (two if reorthogonalization is needed) replaces the
+ * \e sstep reductions of the standard iteration.  The first restart cycle
+ * uses blocks of size one.  Not combined with the relative change and the
+ * convergence factor tests; the standard iteration is used if either is set.
+ * The default is 1 (standard GMRES).
+ **/
+HYPRE_Int HYPRE_GMRESSetSStep(HYPRE_Solver solver,
+                              HYPRE_Int    sstep);
+
 /**
  * (Optional) Set the preconditioner to use.
  **/
@@ -457,6 +488,11 @@ HYPRE_Int HYPRE_GMRESGetKDim(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_GMRESGetRelChange(HYPRE_Solver  solver,
                                   HYPRE_Int    *rel_change);
 
+/**
+ **/
+HYPRE_Int HYPRE_GMRESGetSStep(HYPRE_Solver  solver,
+                              HYPRE_Int    *sstep);
+
 /**
  **/
 HYPRE_Int HYPRE_GMRESGetPrecond(HYPRE_Solver  solver,
@@ -151,6 +151,7 @@ hypre_BiCGSTABSetup( void *bicgstab_vdata,
     * compute phases of matvec and the preconditioner.
     *--------------------------------------------------*/
  
+   hypre_MemoryStatsPushCategory(HYPRE_MEMORY_CATEGORY_KRYLOV);
    if ((bicgstab_data -> p) == NULL)
       (bicgstab_data -> p) = (*(bicgstab_functions->CreateVector))(b);
    if ((bicgstab_data -> q) == NULL)
@@ -163,6 +164,7 @@ hypre_BiCGSTABSetup( void *bicgstab_vdata,
       (bicgstab_data -> s) = (*(bicgstab_functions->CreateVector))(b);
    if ((bicgstab_data -> v) == NULL)
       (bicgstab_data -> v) = (*(bicgstab_functions->CreateVector))(b);
+   hypre_MemoryStatsPopCategory();
  
    if ((bicgstab_data -> matvec_data) == NULL) 
       (bicgstab_data -> matvec_data) =
@@ -210,6 +210,7 @@ hypre_FlexGMRESSetup( void *fgmres_vdata,
     * compute phases of matvec and the preconditioner.
     *--------------------------------------------------*/
  
+   hypre_MemoryStatsPushCategory(HYPRE_MEMORY_CATEGORY_KRYLOV);
    if ((fgmres_data -> p) == NULL)
 	   (fgmres_data -> p) = (void**)(*(fgmres_functions->CreateVectorArray))(k_dim+1,x);
    if ((fgmres_data -> r) == NULL)
@@ -225,6 +226,7 @@ hypre_FlexGMRESSetup( void *fgmres_vdata,
  
    /* fgmres mod */
    (fgmres_data -> pre_vecs) = (void**)(*(fgmres_functions->CreateVectorArray))(k_dim+1,x); 
+   hypre_MemoryStatsPopCategory();
    /*---*/
 
 
@@ -58,6 +58,7 @@ hypre_GMRESFunctionsCreate(
    gmres_functions->ClearVector = ClearVector;
    gmres_functions->ScaleVector = ScaleVector;
    gmres_functions->Axpy = Axpy;
+   gmres_functions->BlockInnerProd = NULL;
 /* default preconditioner must be set here but can be changed later... */
    gmres_functions->precond_setup = PrecondSetup;
    gmres_functions->precond       = Precond;
@@ -90,6 +91,7 @@ hypre_GMRESCreate( hypre_GMRESFunctions *gmres_functions )
    (gmres_data -> stop_crit)      = 0; /* rel. residual norm  - this is obsolete!*/
    (gmres_data -> converged)      = 0;
    (gmres_data -> hybrid)         = 0;
+   (gmres_data -> sstep)          = 1;
    (gmres_data -> precond_data)   = NULL;
    (gmres_data -> print_level)    = 0;
    (gmres_data -> logging)        = 0;
@@ -196,6 +198,7 @@ hypre_GMRESSetup( void *gmres_vdata,
     * compute phases of matvec and the preconditioner.
     *--------------------------------------------------*/
  
+   hypre_MemoryStatsPushCategory(HYPRE_MEMORY_CATEGORY_KRYLOV);
    if ((gmres_data -> p) == NULL)
       (gmres_data -> p) = (void**)(*(gmres_functions->CreateVectorArray))(k_dim+1,x);
    if ((gmres_data -> r) == NULL)
@@ -208,6 +211,7 @@ hypre_GMRESSetup( void *gmres_vdata,
       if ((gmres_data -> w_2) == NULL)
          (gmres_data -> w_2) = (*(gmres_functions->CreateVector))(b);
    }
+   hypre_MemoryStatsPopCategory();
    
 
    if ((gmres_data -> matvec_data) == NULL)
@@ -298,6 +302,11 @@ hypre_GMRESSolve(void  *gmres_vdata,
 
    HYPRE_Real real_r_norm_old, real_r_norm_new;
 
+   if ((gmres_data -> sstep) > 1 && !rel_change && cf_tol <= 0.0)
+   {
+      return hypre_GMRESSStepSolve(gmres_vdata, A, b, x);
+   }
+
    (gmres_data -> converged) = 0;
    /*-----------------------------------------------------------------------
     * With relative change convergence test on, it is possible to attempt
@@ -1102,6 +1111,37 @@ hypre_GMRESGetSkipRealResidualCheck( void      *gmres_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_GMRESSetSStep, hypre_GMRESGetSStep
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GMRESSetSStep( void     *gmres_vdata,
+                     HYPRE_Int sstep )
+{
+   hypre_GMRESData *gmres_data = (hypre_GMRESData *)gmres_vdata;
+
+   if (sstep < 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   (gmres_data -> sstep) = sstep;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_GMRESGetSStep( void      *gmres_vdata,
+                     HYPRE_Int *sstep )
+{
+   hypre_GMRESData *gmres_data = (hypre_GMRESData *)gmres_vdata;
+
+   *sstep = (gmres_data -> sstep);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_GMRESSetStopCrit, hypre_GMRESGetStopCrit
  *
@@ -65,6 +65,11 @@ typedef struct
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+   /* optional: result[j*nx+i] = <x[i],y[j]> with a single reduction, for the
+      s-step solver (may be NULL, then InnerProd is used) */
+   HYPRE_Int    (*BlockInnerProd)( HYPRE_Int nx, void **x, HYPRE_Int ny, void **y,
+                                   HYPRE_Real *result );
+
    HYPRE_Int    (*precond)       ();
    HYPRE_Int    (*precond_setup) ();
 
@@ -84,6 +89,7 @@ typedef struct
    HYPRE_Int      stop_crit;
    HYPRE_Int      converged;
    HYPRE_Int      hybrid;
+   HYPRE_Int      sstep; /* s-step block size, 1 for the standard iteration */
    HYPRE_Real   tol;
    HYPRE_Real   cf_tol;
    HYPRE_Real   a_tol;
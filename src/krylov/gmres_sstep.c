@@ -0,0 +1,1059 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * s-step (communication-avoiding) GMRES
+ *
+ * Each restart cycle generates its basis in blocks of s vectors.  Starting
+ * from the last orthonormal vector q_m, the block
+ *
+ *    v_0 = q_m,   v_{j+1} = (A M^{-1} - theta_j) v_j / sigma
+ *
+ * is built with a Newton basis (complex conjugate shift pairs are applied in
+ * real arithmetic), so that A M^{-1} V_{0:s-1} = V_{0:s} B with a small
+ * (s+1) x s matrix B.  The s new vectors are orthogonalized against the
+ * current basis and against each other with one block classical Gram-Schmidt
+ * step and a Cholesky QR of the projected block, both computed from a single
+ * block of inner products (one global reduction).  If the projection cancels
+ * too much, the step is repeated once on the projected block.  The Hessenberg
+ * columns of the block then follow from the coefficients of the
+ * orthogonalization and B, as in M. Hoemmen, "Communication-avoiding Krylov
+ * subspace methods", PhD thesis, UC Berkeley, 2010.
+ *
+ * The shifts theta_j are Ritz values from the first restart cycle, which is
+ * run with blocks of size one, taken in modified Leja order.  sigma is the
+ * largest Ritz value modulus.
+ *
+ *****************************************************************************/
+
+#include "krylov.h"
+#include "_hypre_utilities.h"
+
+/* threshold on ||projected v||^2 / ||v||^2 below which the block
+   orthogonalization is repeated */
+#define HYPRE_GMRES_SSTEP_REORTH_TOL 1.0e-4
+
+/*--------------------------------------------------------------------------
+ * hypre_GMRESSStepBlockInnerProd
+ *
+ * result[j*nx+i] = <x[i],y[j]>, using the block inner product of the
+ * interface if it provides one, and InnerProd calls otherwise.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_GMRESSStepBlockInnerProd( hypre_GMRESFunctions *gmres_functions,
+                                HYPRE_Int             nx,
+                                void                **x,
+                                HYPRE_Int             ny,
+                                void                **y,
+                                HYPRE_Real           *result )
+{
+   HYPRE_Int i, j;
+
+   if (gmres_functions -> BlockInnerProd)
+   {
+      (*(gmres_functions->BlockInnerProd))(nx, x, ny, y, result);
+   }
+   else
+   {
+      for (j = 0; j < ny; j++)
+      {
+         for (i = 0; i < nx; i++)
+         {
+            result[j*nx+i] = (*(gmres_functions->InnerProd))(x[i], y[j]);
+         }
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GMRESSStepCholesky
+ *
+ * Upper triangular R with G = R^T R for the n x n column-major matrix G.
+ * Returns 1 if G is not numerically positive definite.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_GMRESSStepCholesky( HYPRE_Int   n,
+                          HYPRE_Real *G,
+                          HYPRE_Real *R )
+{
+   HYPRE_Int  i, j, k;
+   HYPRE_Real t;
+
+   for (j = 0; j < n; j++)
+   {
+      for (i = 0; i < n; i++)
+      {
+         R[i+j*n] = 0.0;
+      }
+   }
+
+   for (j = 0; j < n; j++)
+   {
+      t = G[j+j*n];
+      for (k = 0; k < j; k++)
+      {
+         t -= R[k+j*n]*R[k+j*n];
+      }
+      if (!(t > 0.0))
+      {
+         return 1;
+      }
+      R[j+j*n] = sqrt(t);
+
+      for (i = j+1; i < n; i++)
+      {
+         t = G[j+i*n];
+         for (k = 0; k < j; k++)
+         {
+            t -= R[k+j*n]*R[k+i*n];
+         }
+         R[j+i*n] = t / R[j+j*n];
+      }
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GMRESSStepReflect
+ *
+ * Applies the Householder reflector I - tau v v^T (v of length m <= 3) that
+ * maps the vector v0 given on input to a multiple of e_1, from the left to
+ * rows k..k+m-1 (columns c0..c1) and from the right to columns k..k+m-1
+ * (rows r0..r1) of the row-major n x n matrix a.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_GMRESSStepReflect( HYPRE_Int   n,
+                         HYPRE_Real *a,
+                         HYPRE_Int   m,
+                         HYPRE_Real *v,
+                         HYPRE_Int   k,
+                         HYPRE_Int   c0,
+                         HYPRE_Int   c1,
+                         HYPRE_Int   r0,
+                         HYPRE_Int   r1 )
+{
+   HYPRE_Real alpha, vtv, tau, d;
+   HYPRE_Int  i, j;
+
+   alpha = 0.0;
+   for (i = 0; i < m; i++)
+   {
+      alpha += v[i]*v[i];
+   }
+   if (alpha == 0.0)
+   {
+      return;
+   }
+   alpha = (v[0] >= 0.0) ? -sqrt(alpha) : sqrt(alpha);
+   v[0] -= alpha;
+   vtv = 0.0;
+   for (i = 0; i < m; i++)
+   {
+      vtv += v[i]*v[i];
+   }
+   tau = 2.0/vtv;
+
+   for (j = c0; j <= c1; j++)
+   {
+      d = 0.0;
+      for (i = 0; i < m; i++)
+      {
+         d += v[i]*a[(k+i)*n+j];
+      }
+      d *= tau;
+      for (i = 0; i < m; i++)
+      {
+         a[(k+i)*n+j] -= d*v[i];
+      }
+   }
+   for (j = r0; j <= r1; j++)
+   {
+      d = 0.0;
+      for (i = 0; i < m; i++)
+      {
+         d += a[j*n+k+i]*v[i];
+      }
+      d *= tau;
+      for (i = 0; i < m; i++)
+      {
+         a[j*n+k+i] -= d*v[i];
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GMRESSStepHessenbergEigenvalues
+ *
+ * Eigenvalues (wr + i wi) of the n x n upper Hessenberg matrix H, given as
+ * H[row][col], by the Francis double-shift QR iteration (Golub and Van Loan,
+ * Matrix Computations, Sec. 7.5) restricted to the unreduced diagonal block
+ * that is not yet deflated.  Complex conjugate pairs are returned next to
+ * each other, the one with wi > 0 second.  Returns 1 if the iteration does
+ * not converge.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_HQR(i,j) a[(i)*n+(j)]
+
+static HYPRE_Int
+hypre_GMRESSStepHessenbergEigenvalues( HYPRE_Int    n,
+                                       HYPRE_Real **H,
+                                       HYPRE_Real  *wr,
+                                       HYPRE_Real  *wi )
+{
+   HYPRE_Real *a;
+   HYPRE_Real  v[3], tr, det, p, disc, h_norm, tol;
+   HYPRE_Int   lo, hi, i, j, k, its = 0, ierr = 0;
+
+   a = hypre_CTAlloc(HYPRE_Real, n*n, HYPRE_MEMORY_HOST);
+   h_norm = 0.0;
+   for (i = 0; i < n; i++)
+   {
+      for (j = hypre_max(i-1, 0); j < n; j++)
+      {
+         hypre_HQR(i,j) = H[i][j];
+         h_norm = hypre_max(h_norm, fabs(H[i][j]));
+      }
+   }
+
+   hi = n-1;
+   while (hi >= 0)
+   {
+      /* lo: first row of the unreduced block ending in row hi */
+      for (lo = hi; lo > 0; lo--)
+      {
+         tol = fabs(hypre_HQR(lo-1,lo-1)) + fabs(hypre_HQR(lo,lo));
+         tol = HYPRE_REAL_EPSILON * (tol > 0.0 ? tol : h_norm);
+         if (fabs(hypre_HQR(lo,lo-1)) <= tol)
+         {
+            hypre_HQR(lo,lo-1) = 0.0;
+            break;
+         }
+      }
+
+      if (lo == hi)
+      {
+         wr[hi] = hypre_HQR(hi,hi);
+         wi[hi] = 0.0;
+         hi--;
+         its = 0;
+         continue;
+      }
+
+      /* shifts: eigenvalues of the trailing 2 x 2 block */
+      tr  = hypre_HQR(hi-1,hi-1) + hypre_HQR(hi,hi);
+      det = hypre_HQR(hi-1,hi-1)*hypre_HQR(hi,hi) - hypre_HQR(hi-1,hi)*hypre_HQR(hi,hi-1);
+
+      if (lo == hi-1)
+      {
+         p    = 0.5*(hypre_HQR(hi-1,hi-1) - hypre_HQR(hi,hi));
+         disc = p*p + hypre_HQR(hi-1,hi)*hypre_HQR(hi,hi-1);
+         if (disc >= 0.0)
+         {
+            /* larger root from the sum, smaller one from the product */
+            p = 0.5*tr + ((tr >= 0.0) ? sqrt(disc) : -sqrt(disc));
+            wr[hi-1] = p;
+            wr[hi]   = (p != 0.0) ? det/p : 0.0;
+            wi[hi-1] = wi[hi] = 0.0;
+         }
+         else
+         {
+            wr[hi-1] = wr[hi] = 0.5*tr;
+            wi[hi-1] = -sqrt(-disc);
+            wi[hi]   =  sqrt(-disc);
+         }
+         hi -= 2;
+         its = 0;
+         continue;
+      }
+
+      if (its == 30*(hi-lo+1))
+      {
+         ierr = 1;
+         break;
+      }
+      if (its > 0 && its % 10 == 0)
+      {
+         /* ad hoc shifts to break a cycle */
+         p   = fabs(hypre_HQR(hi,hi-1)) + fabs(hypre_HQR(hi-1,hi-2));
+         tr  = 1.5*p;
+         det = p*p;
+      }
+      its++;
+
+      /* first column of (H - s1 I)(H - s2 I), and bulge chase */
+      v[0] = hypre_HQR(lo,lo)*hypre_HQR(lo,lo) + hypre_HQR(lo,lo+1)*hypre_HQR(lo+1,lo) -
+             tr*hypre_HQR(lo,lo) + det;
+      v[1] = hypre_HQR(lo+1,lo)*(hypre_HQR(lo,lo) + hypre_HQR(lo+1,lo+1) - tr);
+      v[2] = hypre_HQR(lo+1,lo)*hypre_HQR(lo+2,lo+1);
+      for (k = lo; k <= hi-2; k++)
+      {
+         hypre_GMRESSStepReflect(n, a, 3, v, k, hypre_max(k-1, lo), hi,
+                                 lo, hypre_min(k+3, hi));
+         if (k > lo)
+         {
+            hypre_HQR(k+1,k-1) = hypre_HQR(k+2,k-1) = 0.0;
+         }
+         v[0] = hypre_HQR(k+1,k);
+         v[1] = hypre_HQR(k+2,k);
+         if (k < hi-2)
+         {
+            v[2] = hypre_HQR(k+3,k);
+         }
+      }
+      hypre_GMRESSStepReflect(n, a, 2, v, hi-1, hi-2, hi, lo, hi);
+      hypre_HQR(hi,hi-2) = 0.0;
+   }
+
+   hypre_TFree(a, HYPRE_MEMORY_HOST);
+
+   return ierr;
+}
+
+#undef hypre_HQR
+
+/*--------------------------------------------------------------------------
+ * hypre_GMRESSStepShifts
+ *
+ * Computes num_shifts Newton shifts (shift_re + i shift_im) from the
+ * Ritz values of the n x n leading block of the Hessenberg matrix H, in
+ * modified Leja order: each conjugate pair is listed as (a,b), (a,-b) with
+ * b > 0.  Returns the scaling sigma of the basis (largest Ritz value
+ * modulus).  If the Ritz values are not available, the shifts are zero.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Real
+hypre_GMRESSStepShifts( HYPRE_Int    n,
+                        HYPRE_Real **H,
+                        HYPRE_Int    num_shifts,
+                        HYPRE_Real  *shift_re,
+                        HYPRE_Real  *shift_im )
+{
+   HYPRE_Real *wr, *wi, val, best_val, d, sigma = 0.0;
+   HYPRE_Int  *used;
+   HYPRE_Int   i, k, l, best, count = 0;
+
+   for (i = 0; i < num_shifts; i++)
+   {
+      shift_re[i] = 0.0;
+      shift_im[i] = 0.0;
+   }
+   if (n < 1)
+   {
+      return 1.0;
+   }
+
+   wr   = hypre_CTAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+   wi   = hypre_CTAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+   used = hypre_CTAlloc(HYPRE_Int,  n, HYPRE_MEMORY_HOST);
+
+   if (hypre_GMRESSStepHessenbergEigenvalues(n, H, wr, wi) == 0)
+   {
+      for (k = 0; k < n; k++)
+      {
+         sigma = hypre_max(sigma, sqrt(wr[k]*wr[k] + wi[k]*wi[k]));
+      }
+
+      /* modified Leja ordering; conjugates (wi < 0) follow their partner */
+      while (count < num_shifts)
+      {
+         best = -1;
+         best_val = 0.0;
+         for (k = 0; k < n; k++)
+         {
+            if (used[k] || wi[k] < 0.0)
+            {
+               continue;
+            }
+            if (count == 0)
+            {
+               val = sqrt(wr[k]*wr[k] + wi[k]*wi[k]);
+            }
+            else
+            {
+               val = 0.0;
+               for (l = 0; l < count; l++)
+               {
+                  d = sqrt( (wr[k]-shift_re[l])*(wr[k]-shift_re[l]) +
+                            (wi[k]-shift_im[l])*(wi[k]-shift_im[l]) );
+                  if (d == 0.0)
+                  {
+                     break;
+                  }
+                  val += log(d);
+               }
+               if (l < count)
+               {
+                  /* repeated Ritz value */
+                  used[k] = 1;
+                  continue;
+               }
+            }
+            if (best < 0 || val > best_val)
+            {
+               best = k;
+               best_val = val;
+            }
+         }
+         if (best < 0)
+         {
+            break;
+         }
+
+         used[best] = 1;
+         shift_re[count] = wr[best];
+         shift_im[count] = wi[best];
+         count++;
+         if (wi[best] > 0.0 && count < num_shifts)
+         {
+            shift_re[count] = wr[best];
+            shift_im[count] = -wi[best];
+            count++;
+         }
+      }
+   }
+
+   hypre_TFree(wr, HYPRE_MEMORY_HOST);
+   hypre_TFree(wi, HYPRE_MEMORY_HOST);
+   hypre_TFree(used, HYPRE_MEMORY_HOST);
+
+   return (sigma > 0.0) ? sigma : 1.0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GMRESSStepBlock
+ *
+ * Extends the orthonormal basis p[0..m] by the bs vectors p[m+1..m+bs] and
+ * computes the columns m..m+bs-1 of the (unrotated) Hessenberg matrix hh.
+ * work must hold 4*(k_dim+1)*bs + 4*bs*bs reals.
+ *
+ * Returns 1 if the block is numerically rank deficient and bs > 1 (the
+ * caller then retries with bs = 1).  For bs = 1, an invariant subspace gives
+ * a zero subdiagonal entry (*breakdown = 1).
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_GMRESSStepBlock( hypre_GMRESData *gmres_data,
+                       void            *A,
+                       HYPRE_Int        m,
+                       HYPRE_Int        bs,
+                       HYPRE_Real      *shift_re,
+                       HYPRE_Real      *shift_im,
+                       HYPRE_Real       sigma,
+                       HYPRE_Real     **hh,
+                       HYPRE_Real      *work,
+                       HYPRE_Int       *breakdown )
+{
+   hypre_GMRESFunctions *gmres_functions = gmres_data->functions;
+   HYPRE_Int           (*precond)(void*,void*,void*,void*) = (gmres_functions -> precond);
+   void                 *precond_data = (gmres_data -> precond_data);
+   void                 *matvec_data  = (gmres_data -> matvec_data);
+   HYPRE_Int             k_dim        = (gmres_data -> k_dim);
+   void                **p            = (gmres_data -> p);
+   void                 *r            = (gmres_data -> r);
+
+   HYPRE_Int   nx = m + bs + 1;   /* basis vectors after the block */
+   HYPRE_Int   mc = m + 1;        /* rows of the projection coefficients */
+   HYPRE_Real *gram, *C, *G, *Gp, *R, *B, *Y, *T;
+   HYPRE_Real  a, b2 = 0.0, t;
+   HYPRE_Int   i, j, l, pass, reorth, fail;
+
+   *breakdown = 0;
+
+   gram = work;                    /* nx x bs   */
+   C    = gram + (k_dim+1)*bs;     /* mc x bs   */
+   Y    = C    + (k_dim+1)*bs;     /* nx x bs   */
+   B    = Y    + (k_dim+1)*bs;     /* bs+1 x bs */
+   G    = B    + (k_dim+1)*bs;     /* bs x bs   */
+   Gp   = G    + bs*bs;
+   R    = Gp   + bs*bs;
+   T    = R    + bs*bs;
+
+   /*-----------------------------------------------------------------------
+    * Newton basis: A M^{-1} V_{0:bs-1} = V_{0:bs} B
+    *-----------------------------------------------------------------------*/
+
+   for (i = 0; i < (bs+1)*bs; i++)
+   {
+      B[i] = 0.0;
+   }
+   for (j = 0; j < bs; j++)
+   {
+      (*(gmres_functions->ClearVector))(r);
+      precond(precond_data, A, p[m+j], r);
+      (*(gmres_functions->Matvec))(matvec_data, 1.0, A, r, 0.0, p[m+j+1]);
+
+      a = shift_re[j];
+      if (a != 0.0)
+      {
+         (*(gmres_functions->Axpy))(-a, p[m+j], p[m+j+1]);
+      }
+      B[j+j*(bs+1)]   = a;
+      B[j+1+j*(bs+1)] = sigma;
+      if (shift_im[j] < 0.0 && j > 0)
+      {
+         /* second vector of a conjugate pair: ((A-a)^2 + b^2) v_{j-1} */
+         (*(gmres_functions->Axpy))(b2/sigma, p[m+j-1], p[m+j+1]);
+         B[j-1+j*(bs+1)] = -b2/sigma;
+      }
+      b2 = shift_im[j]*shift_im[j];
+      (*(gmres_functions->ScaleVector))(1.0/sigma, p[m+j+1]);
+   }
+
+   /*-----------------------------------------------------------------------
+    * Block classical Gram-Schmidt and Cholesky QR: V_{1:bs} = Q C + Q_new R
+    *-----------------------------------------------------------------------*/
+
+   for (i = 0; i < mc*bs; i++)
+   {
+      C[i] = 0.0;
+   }
+
+   fail = 0;
+   for (pass = 0; pass < 2; pass++)
+   {
+      hypre_GMRESSStepBlockInnerProd(gmres_functions, nx, p, bs, p+m+1, gram);
+
+      for (j = 0; j < bs; j++)
+      {
+         for (i = 0; i < mc; i++)
+         {
+            C[i+j*mc] += gram[j*nx+i];
+            (*(gmres_functions->Axpy))(-gram[j*nx+i], p[i], p[m+1+j]);
+         }
+         for (i = 0; i < bs; i++)
+         {
+            G[i+j*bs] = gram[j*nx+m+1+i];
+            t = G[i+j*bs];
+            for (l = 0; l < mc; l++)
+            {
+               t -= gram[i*nx+l]*gram[j*nx+l];
+            }
+            Gp[i+j*bs] = t;
+         }
+      }
+
+      fail = hypre_GMRESSStepCholesky(bs, Gp, R);
+      reorth = fail;
+      for (j = 0; j < bs && !reorth; j++)
+      {
+         if (R[j+j*bs]*R[j+j*bs] < HYPRE_GMRES_SSTEP_REORTH_TOL * G[j+j*bs])
+         {
+            reorth = 1;
+         }
+      }
+      if (!reorth)
+      {
+         break;
+      }
+   }
+
+   if (fail)
+   {
+      if (bs > 1)
+      {
+         return 1;
+      }
+      /* invariant subspace */
+      R[0] = 0.0;
+      *breakdown = 1;
+   }
+
+   /* Q_new = W R^{-1} */
+   for (j = 0; j < bs && !(*breakdown); j++)
+   {
+      for (l = 0; l < j; l++)
+      {
+         (*(gmres_functions->Axpy))(-R[l+j*bs], p[m+1+l], p[m+1+j]);
+      }
+      (*(gmres_functions->ScaleVector))(1.0/R[j+j*bs], p[m+1+j]);
+   }
+
+   /*-----------------------------------------------------------------------
+    * Hessenberg columns m..m+bs-1:
+    *
+    *   H_new = (Rfull B - [H_old E; 0]) T^{-1},
+    *
+    * with V_{0:bs} = Q_{0:m+bs} Rfull, V_{0:bs-1} = Q_{0:m-1} E + Q_{m:m+bs-1} T
+    *-----------------------------------------------------------------------*/
+
+   for (j = 0; j < bs; j++)
+   {
+      for (i = 0; i < nx; i++)
+      {
+         Y[i+j*nx] = 0.0;
+      }
+
+      /* Rfull B: column 0 of Rfull is e_m, column l+1 is [C(:,l); R(:,l)] */
+      for (l = 0; l <= bs; l++)
+      {
+         t = B[l+j*(bs+1)];
+         if (t == 0.0)
+         {
+            continue;
+         }
+         if (l == 0)
+         {
+            Y[m+j*nx] += t;
+         }
+         else
+         {
+            for (i = 0; i < mc; i++)
+            {
+               Y[i+j*nx] += t*C[i+(l-1)*mc];
+            }
+            for (i = 0; i < l; i++)
+            {
+               Y[mc+i+j*nx] += t*R[i+(l-1)*bs];
+            }
+         }
+      }
+
+      /* - H_old E: column 0 of E is zero, column j is C(0:m-1,j-1) */
+      if (j > 0)
+      {
+         for (l = 0; l < m; l++)
+         {
+            t = C[l+(j-1)*mc];
+            for (i = 0; i <= l+1; i++)
+            {
+               Y[i+j*nx] -= hh[i][l]*t;
+            }
+         }
+      }
+
+      /* T(0,0) = 1, T(0,j) = C(m,j-1), T(i,j) = R(i-1,j-1) */
+      for (i = 0; i < bs; i++)
+      {
+         T[i+j*bs] = 0.0;
+      }
+      if (j == 0)
+      {
+         T[0] = 1.0;
+      }
+      else
+      {
+         T[j*bs] = C[m+(j-1)*mc];
+         for (i = 1; i <= j; i++)
+         {
+            T[i+j*bs] = R[i-1+(j-1)*bs];
+         }
+      }
+
+      /* right triangular solve */
+      for (l = 0; l < j; l++)
+      {
+         t = T[l+j*bs];
+         for (i = 0; i < nx; i++)
+         {
+            Y[i+j*nx] -= Y[i+l*nx]*t;
+         }
+      }
+      for (i = 0; i < nx; i++)
+      {
+         Y[i+j*nx] /= T[j+j*bs];
+      }
+
+      for (i = 0; i <= m+j+1; i++)
+      {
+         hh[i][m+j] = Y[i+j*nx];
+      }
+      for (i = m+j+2; i < k_dim+1; i++)
+      {
+         hh[i][m+j] = 0.0;
+      }
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_GMRESSStepSolve
+ *
+ * Called from hypre_GMRESSolve if sstep > 1.  Same stopping criteria,
+ * restarts and output as the standard solver, without the relative change
+ * and convergence factor tests.
+ *-------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GMRESSStepSolve(void  *gmres_vdata,
+                      void  *A,
+                      void  *b,
+                      void  *x)
+{
+   hypre_GMRESData      *gmres_data         = (hypre_GMRESData *)gmres_vdata;
+   hypre_GMRESFunctions *gmres_functions    = gmres_data->functions;
+   HYPRE_Int             k_dim              = (gmres_data -> k_dim);
+   HYPRE_Int             min_iter           = (gmres_data -> min_iter);
+   HYPRE_Int             max_iter           = (gmres_data -> max_iter);
+   HYPRE_Int             skip_real_r_check  = (gmres_data -> skip_real_r_check);
+   HYPRE_Int             hybrid             = (gmres_data -> hybrid);
+   HYPRE_Int             sstep              = hypre_min((gmres_data -> sstep), k_dim);
+   HYPRE_Real            r_tol              = (gmres_data -> tol);
+   HYPRE_Real            a_tol              = (gmres_data -> a_tol);
+   void                 *matvec_data        = (gmres_data -> matvec_data);
+   void                 *r                  = (gmres_data -> r);
+   void                 *w                  = (gmres_data -> w);
+   void                **p                  = (gmres_data -> p);
+
+   HYPRE_Int           (*precond)(void*,void*,void*,void*) = (gmres_functions -> precond);
+   HYPRE_Int            *precond_data = (HYPRE_Int*) (gmres_data -> precond_data);
+
+   HYPRE_Int             print_level        = (gmres_data -> print_level);
+   HYPRE_Int             logging            = (gmres_data -> logging);
+   HYPRE_Real           *norms              = (gmres_data -> norms);
+
+   HYPRE_Int        i, j, k, m, bs, breakdown, converged_in_cycle;
+   HYPRE_Real      *rs, **hh, **rr, *c, *s, *work;
+   HYPRE_Real      *shift_re, *shift_im, *zero_shift, sigma = 1.0;
+   HYPRE_Int        have_shifts = 0;
+   HYPRE_Int        iter;
+   HYPRE_Int        my_id, num_procs;
+   HYPRE_Real       epsilon = 0.0, gamma, t, r_norm, b_norm, den_norm;
+   HYPRE_Real       epsmac = 1.e-16;
+   HYPRE_Real       ieee_check = 0.;
+   HYPRE_Real       real_r_norm_old, real_r_norm_new;
+
+   (gmres_data -> converged) = 0;
+
+   (*(gmres_functions->CommInfo))(A,&my_id,&num_procs);
+
+   /* initialize work arrays */
+   rs = hypre_CTAllocF(HYPRE_Real,k_dim+1,gmres_functions, HYPRE_MEMORY_HOST);
+   c = hypre_CTAllocF(HYPRE_Real,k_dim,gmres_functions, HYPRE_MEMORY_HOST);
+   s = hypre_CTAllocF(HYPRE_Real,k_dim,gmres_functions, HYPRE_MEMORY_HOST);
+   hh = hypre_CTAllocF(HYPRE_Real*,k_dim+1,gmres_functions, HYPRE_MEMORY_HOST);
+   rr = hypre_CTAllocF(HYPRE_Real*,k_dim+1,gmres_functions, HYPRE_MEMORY_HOST);
+   for (i=0; i < k_dim+1; i++)
+   {
+      hh[i] = hypre_CTAllocF(HYPRE_Real,k_dim,gmres_functions, HYPRE_MEMORY_HOST);
+      rr[i] = hypre_CTAllocF(HYPRE_Real,k_dim,gmres_functions, HYPRE_MEMORY_HOST);
+   }
+   work = hypre_CTAllocF(HYPRE_Real, 4*(k_dim+1)*sstep + 4*sstep*sstep,
+                         gmres_functions, HYPRE_MEMORY_HOST);
+   shift_re   = hypre_CTAllocF(HYPRE_Real, sstep, gmres_functions, HYPRE_MEMORY_HOST);
+   shift_im   = hypre_CTAllocF(HYPRE_Real, sstep, gmres_functions, HYPRE_MEMORY_HOST);
+   zero_shift = hypre_CTAllocF(HYPRE_Real, sstep, gmres_functions, HYPRE_MEMORY_HOST);
+
+   (*(gmres_functions->CopyVector))(b,p[0]);
+
+   /* compute initial residual */
+   (*(gmres_functions->Matvec))(matvec_data,-1.0, A, x, 1.0, p[0]);
+
+   b_norm = sqrt((*(gmres_functions->InnerProd))(b,b));
+   real_r_norm_old = b_norm;
+   r_norm = sqrt((*(gmres_functions->InnerProd))(p[0],p[0]));
+
+   if (b_norm != 0.)
+   {
+      ieee_check = b_norm/b_norm; /* INF -> NaN conversion */
+   }
+   if (r_norm != 0. && ieee_check == ieee_check)
+   {
+      ieee_check = r_norm/r_norm;
+   }
+   if (ieee_check != ieee_check)
+   {
+      if (logging > 0 || print_level > 0)
+      {
+         hypre_printf("\n\nERROR detected by Hypre ... BEGIN\n");
+         hypre_printf("ERROR -- hypre_GMRESSolve: INFs and/or NaNs detected in input.\n");
+         hypre_printf("User probably placed non-numerics in supplied A, x_0 or b.\n");
+         hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+         hypre_printf("ERROR detected by Hypre ... END\n\n\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+      r_norm = 0.0;
+      iter = 0;
+      goto finish;
+   }
+
+   if ( logging>0 || print_level > 0)
+   {
+      norms[0] = r_norm;
+      if ( print_level>1 && my_id == 0 )
+      {
+         hypre_printf("L2 norm of b: %e\n", b_norm);
+         if (b_norm == 0.0)
+         {
+            hypre_printf("Rel_resid_norm actually contains the residual norm\n");
+         }
+         hypre_printf("Initial L2 norm of residual: %e\n", r_norm);
+      }
+   }
+   iter = 0;
+
+   /* convergence criterion |r_i| <= max(a_tol, r_tol * den_norm), where
+      den_norm = |b|, or |r_0| if |b| = 0 */
+   den_norm = (b_norm > 0.0) ? b_norm : r_norm;
+   epsilon = hypre_max(a_tol,r_tol*den_norm);
+
+   if ( print_level>1 && my_id == 0 )
+   {
+      hypre_printf("=============================================\n\n");
+      hypre_printf("s-step GMRES, s = %d\n", sstep);
+      if (b_norm > 0.0)
+      {
+         hypre_printf("Iters     resid.norm     conv.rate  rel.res.norm\n");
+         hypre_printf("-----    ------------    ---------- ------------\n");
+      }
+      else
+      {
+         hypre_printf("Iters     resid.norm     conv.rate\n");
+         hypre_printf("-----    ------------    ----------\n");
+      }
+   }
+
+   /* outer iteration cycle */
+   while (iter < max_iter)
+   {
+      rs[0] = r_norm;
+      if (r_norm == 0.0)
+      {
+         break;
+      }
+
+      /* see if we are already converged */
+      if (r_norm  <= epsilon && iter >= min_iter)
+      {
+         (*(gmres_functions->CopyVector))(b,r);
+         (*(gmres_functions->Matvec))(matvec_data,-1.0,A,x,1.0,r);
+         r_norm = sqrt((*(gmres_functions->InnerProd))(r,r));
+         if (r_norm  <= epsilon)
+         {
+            if ( print_level>1 && my_id == 0)
+            {
+               hypre_printf("\n\n");
+               hypre_printf("Final L2 norm of residual: %e\n\n", r_norm);
+            }
+            (gmres_data -> converged) = 1;
+            break;
+         }
+         else if ( print_level>0 && my_id == 0)
+         {
+            hypre_printf("false convergence 1\n");
+         }
+      }
+
+      t = 1.0 / r_norm;
+      (*(gmres_functions->ScaleVector))(t,p[0]);
+
+      /***RESTART CYCLE (right-preconditioning), in blocks ***/
+      m = 0;
+      converged_in_cycle = 0;
+      breakdown = 0;
+      while (m < k_dim && iter < max_iter && !converged_in_cycle && !breakdown)
+      {
+         bs = have_shifts ? hypre_min(sstep, k_dim - m) : 1;
+         bs = hypre_min(bs, max_iter - iter);
+
+         if (hypre_GMRESSStepBlock(gmres_data, A, m, bs,
+                                   have_shifts ? shift_re : zero_shift, shift_im,
+                                   sigma, hh, work, &breakdown))
+         {
+            if (print_level > 1 && my_id == 0)
+            {
+               hypre_printf("s-step GMRES: rank deficient block, using block size 1\n");
+            }
+            bs = 1;
+            hypre_GMRESSStepBlock(gmres_data, A, m, bs, zero_shift, zero_shift,
+                                  1.0, hh, work, &breakdown);
+         }
+
+         /* update the QR factorization of the Hessenberg matrix */
+         for (k = m; k < m + bs; k++)
+         {
+            i = k + 1;
+            iter++;
+            for (j = 0; j <= i; j++)
+            {
+               rr[j][k] = hh[j][k];
+            }
+            for (j = 1; j < i; j++)
+            {
+               t = rr[j-1][i-1];
+               rr[j-1][i-1] = s[j-1]*rr[j][i-1] + c[j-1]*t;
+               rr[j][i-1] = -s[j-1]*t + c[j-1]*rr[j][i-1];
+            }
+            t= rr[i][i-1]*rr[i][i-1];
+            t+= rr[i-1][i-1]*rr[i-1][i-1];
+            gamma = sqrt(t);
+            if (gamma == 0.0)
+            {
+               gamma = epsmac;
+            }
+            c[i-1] = rr[i-1][i-1]/gamma;
+            s[i-1] = rr[i][i-1]/gamma;
+            rs[i] = -rr[i][i-1]*rs[i-1];
+            rs[i] /=  gamma;
+            rs[i-1] = c[i-1]*rs[i-1];
+            /* determine residual norm */
+            rr[i-1][i-1] = s[i-1]*rr[i][i-1] + c[i-1]*rr[i-1][i-1];
+            r_norm = fabs(rs[i]);
+            if ( print_level>0 )
+            {
+               norms[iter] = r_norm;
+               if ( print_level>1 && my_id == 0 )
+               {
+                  if (b_norm > 0.0)
+                  {
+                     hypre_printf("% 5d    %e    %f   %e\n", iter,
+                                  norms[iter],norms[iter]/norms[iter-1],
+                                  norms[iter]/b_norm);
+                  }
+                  else
+                  {
+                     hypre_printf("% 5d    %e    %f\n", iter, norms[iter],
+                                  norms[iter]/norms[iter-1]);
+                  }
+               }
+            }
+            if (r_norm <= epsilon && iter >= min_iter)
+            {
+               converged_in_cycle = 1;
+               k++;
+               break;
+            }
+         }
+         m = k;
+      } /*** end of restart cycle ***/
+
+      i = m;
+
+      /* Newton shifts from the Ritz values of the first cycle */
+      if (!have_shifts && !converged_in_cycle && !breakdown)
+      {
+         sigma = hypre_GMRESSStepShifts(i, hh, sstep, shift_re, shift_im);
+         have_shifts = 1;
+      }
+
+      /* now compute solution, first solve upper triangular system */
+      rs[i-1] = rs[i-1]/rr[i-1][i-1];
+      for (k = i-2; k >= 0; k--)
+      {
+         t = 0.0;
+         for (j = k+1; j < i; j++)
+         {
+            t -= rr[k][j]*rs[j];
+         }
+         t += rs[k];
+         rs[k] = t/rr[k][k];
+      }
+
+      (*(gmres_functions->CopyVector))(p[i-1],w);
+      (*(gmres_functions->ScaleVector))(rs[i-1],w);
+      for (j = i-2; j >=0; j--)
+      {
+         (*(gmres_functions->Axpy))(rs[j], p[j], w);
+      }
+
+      (*(gmres_functions->ClearVector))(r);
+      /* find correction (in r) */
+      precond(precond_data, A, w, r);
+
+      /* update current solution x (in x) */
+      (*(gmres_functions->Axpy))(1.0,r,x);
+
+      /* check for convergence by evaluating the actual residual */
+      if (r_norm  <= epsilon && iter >= min_iter)
+      {
+         if (skip_real_r_check)
+         {
+            (gmres_data -> converged) = 1;
+            break;
+         }
+
+         /* calculate actual residual norm*/
+         (*(gmres_functions->CopyVector))(b,r);
+         (*(gmres_functions->Matvec))(matvec_data,-1.0,A,x,1.0,r);
+         real_r_norm_new = r_norm = sqrt( (*(gmres_functions->InnerProd))(r,r) );
+
+         if (r_norm <= epsilon || real_r_norm_new >= real_r_norm_old)
+         {
+            /* converged, or the real residual norm has not decreased */
+            if ( print_level>1 && my_id == 0 )
+            {
+               hypre_printf("\n\n");
+               hypre_printf("Final L2 norm of residual: %e\n\n", r_norm);
+            }
+            (gmres_data -> converged) = 1;
+            break;
+         }
+
+         /* report discrepancy between real/GMRES residuals and restart */
+         if ( print_level>0 && my_id == 0)
+         {
+            hypre_printf("false convergence 2, L2 norm of residual: %e\n", r_norm);
+         }
+         (*(gmres_functions->CopyVector))(r,p[0]);
+         i = 0;
+         real_r_norm_old = real_r_norm_new;
+      }
+
+      /* compute residual vector and continue loop */
+      for (j=i ; j > 0; j--)
+      {
+         rs[j-1] = -s[j-1]*rs[j];
+         rs[j] = c[j-1]*rs[j];
+      }
+
+      if (i) (*(gmres_functions->Axpy))(rs[i]-1.0,p[i],p[i]);
+      for (j=i-1 ; j > 0; j--)
+         (*(gmres_functions->Axpy))(rs[j],p[j],p[i]);
+
+      if (i)
+      {
+         (*(gmres_functions->Axpy))(rs[0]-1.0,p[0],p[0]);
+         (*(gmres_functions->Axpy))(1.0,p[i],p[0]);
+      }
+   } /* END of iteration while loop */
+
+finish:
+
+   if ( print_level>1 && my_id == 0 )
+   {
+      hypre_printf("\n\n");
+   }
+
+   (gmres_data -> num_iterations) = iter;
+
+   if (b_norm > 0.0)
+   {
+      (gmres_data -> rel_residual_norm) = r_norm/b_norm;
+   }
+
+   if (b_norm == 0.0)
+   {
+      (gmres_data -> rel_residual_norm) = r_norm;
+   }
+
+   if (iter >= max_iter && r_norm > epsilon && epsilon > 0 && hybrid != -1)
+   {
+      hypre_error(HYPRE_ERROR_CONV);
+   }
+
+   hypre_TFreeF(c, gmres_functions);
+   hypre_TFreeF(s, gmres_functions);
+   hypre_TFreeF(rs, gmres_functions);
+   for (i=0; i < k_dim+1; i++)
+   {
+      hypre_TFreeF(hh[i],gmres_functions);
+      hypre_TFreeF(rr[i],gmres_functions);
+   }
+   hypre_TFreeF(hh, gmres_functions);
+   hypre_TFreeF(rr, gmres_functions);
+   hypre_TFreeF(work, gmres_functions);
+   hypre_TFreeF(shift_re, gmres_functions);
+   hypre_TFreeF(shift_im, gmres_functions);
+   hypre_TFreeF(zero_shift, gmres_functions);
+
+   return hypre_error_flag;
+}
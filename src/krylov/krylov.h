@@ -412,6 +412,11 @@ extern "C" {
     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
     HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+    /* optional: result[j*nx+i] = <x[i],y[j]> with a single reduction, for the
+       s-step solver (may be NULL, then InnerProd is used) */
+    HYPRE_Int    (*BlockInnerProd)( HYPRE_Int nx, void **x, HYPRE_Int ny, void **y,
+                                    HYPRE_Real *result );
+
     HYPRE_Int    (*precond)       (void *vdata , void *A , void *b , void *x);
     HYPRE_Int    (*precond_setup) (void *vdata , void *A , void *b , void *x);
 
@@ -431,6 +436,7 @@ extern "C" {
     HYPRE_Int      stop_crit;
     HYPRE_Int      converged;
     HYPRE_Int      hybrid;
+    HYPRE_Int      sstep; /* s-step block size, 1 for the standard iteration */
     HYPRE_Real   tol;
     HYPRE_Real   cf_tol;
     HYPRE_Real   a_tol;
@@ -1062,6 +1068,12 @@ extern "C" {
     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
     HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+    /* optional: non-blocking inner products for the pipelined solver (may be
+       NULL, then InnerProd is used) */
+    HYPRE_Int    (*InnerProdsStart)  ( HYPRE_Int num, void **x, void **y,
+                                       HYPRE_Real *result, void **request );
+    HYPRE_Int    (*InnerProdsFinish) ( void *request );
+
     HYPRE_Int    (*precond)(void *vdata , void *A , void *b , void *x);
     HYPRE_Int    (*precond_setup)(void *vdata , void *A , void *b , void *x);
 
@@ -1100,6 +1112,10 @@ extern "C" {
      every "recompute_residual_p" iterations.  This can be expensive and degrade the
      convergence. Use it only if you have seen a problem with the regular residual
      computation.
+     - pipelined!=0 means: use the pipelined CG of Ghysels and Vanroose, with one
+     (non-blocking) reduction per iteration that overlaps the preconditioner and
+     the matvec.  Not combined with rel_change, rtol, cf_tol or recompute_residual;
+     if any of these are set, the standard iteration is used.
      */
 
   typedef struct
@@ -1117,12 +1133,14 @@ extern "C" {
     HYPRE_Int      stop_crit;
     HYPRE_Int      converged;
     HYPRE_Int      hybrid;
+    HYPRE_Int      pipelined;
 
     void    *A;
     void    *p;
     void    *s;
     void    *r; /* ...contains the residual.  This is currently kept permanently.
                    If that is ever changed, it still must be kept if logging>1 */
+    void    *u, *w, *m, *n, *z, *q; /* additional vectors of the pipelined CG */
 
     HYPRE_Int      owns_matvec_data;  /* normally 1; if 0, don't delete it */
     void    *matvec_data;
@@ -1139,6 +1157,13 @@ extern "C" {
     HYPRE_Real  *norms;
     HYPRE_Real  *rel_norms;
 
+    /* iteration time breakdown of the last pipelined solve */
+    HYPRE_Real   time_precond;
+    HYPRE_Real   time_matvec;
+    HYPRE_Real   time_reduce; /* local inner products and reduction waits */
+    HYPRE_Real   time_update;
+    HYPRE_Real   time_total;
+
   } hypre_PCGData;
 
 #define hypre_PCGDataOwnsMatvecData(pcgdata)  ((pcgdata) -> owns_matvec_data)
@@ -1255,6 +1280,8 @@ extern "C" {
   HYPRE_Int hypre_GMRESGetRelChange ( void *gmres_vdata , HYPRE_Int *rel_change );
   HYPRE_Int hypre_GMRESSetSkipRealResidualCheck ( void *gmres_vdata , HYPRE_Int skip_real_r_check );
   HYPRE_Int hypre_GMRESGetSkipRealResidualCheck ( void *gmres_vdata , HYPRE_Int *skip_real_r_check );
+  HYPRE_Int hypre_GMRESSetSStep ( void *gmres_vdata , HYPRE_Int sstep );
+  HYPRE_Int hypre_GMRESGetSStep ( void *gmres_vdata , HYPRE_Int *sstep );
   HYPRE_Int hypre_GMRESSetStopCrit ( void *gmres_vdata , HYPRE_Int stop_crit );
   HYPRE_Int hypre_GMRESGetStopCrit ( void *gmres_vdata , HYPRE_Int *stop_crit );
   HYPRE_Int hypre_GMRESSetPrecond ( void *gmres_vdata , HYPRE_Int (*precond )(void*,void*,void*,void*), HYPRE_Int (*precond_setup )(void*,void*,void*,void*), void *precond_data );
@@ -1268,6 +1295,9 @@ extern "C" {
   HYPRE_Int hypre_GMRESGetConverged ( void *gmres_vdata , HYPRE_Int *converged );
   HYPRE_Int hypre_GMRESGetFinalRelativeResidualNorm ( void *gmres_vdata , HYPRE_Real *relative_residual_norm );
 
+  /* gmres_sstep.c */
+  HYPRE_Int hypre_GMRESSStepSolve ( void *gmres_vdata , void *A , void *b , void *x );
+
   /* cogmres.c */
   void *hypre_COGMRESCreate ( hypre_COGMRESFunctions *gmres_functions );
   HYPRE_Int hypre_COGMRESDestroy ( void *gmres_vdata );
@@ -1424,6 +1454,8 @@ extern "C" {
   HYPRE_Int HYPRE_GMRESGetRelChange ( HYPRE_Solver solver , HYPRE_Int *rel_change );
   HYPRE_Int HYPRE_GMRESSetSkipRealResidualCheck ( HYPRE_Solver solver , HYPRE_Int skip_real_r_check );
   HYPRE_Int HYPRE_GMRESGetSkipRealResidualCheck ( HYPRE_Solver solver , HYPRE_Int *skip_real_r_check );
+  HYPRE_Int HYPRE_GMRESSetSStep ( HYPRE_Solver solver , HYPRE_Int sstep );
+  HYPRE_Int HYPRE_GMRESGetSStep ( HYPRE_Solver solver , HYPRE_Int *sstep );
   HYPRE_Int HYPRE_GMRESSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToSolverFcn precond , HYPRE_PtrToSolverFcn precond_setup , HYPRE_Solver precond_solver );
   HYPRE_Int HYPRE_GMRESGetPrecond ( HYPRE_Solver solver , HYPRE_Solver *precond_data_ptr );
   HYPRE_Int HYPRE_GMRESSetPrintLevel ( HYPRE_Solver solver , HYPRE_Int level );
@@ -1559,6 +1591,8 @@ extern "C" {
   HYPRE_Int HYPRE_PCGGetConverged ( HYPRE_Solver solver , HYPRE_Int *converged );
   HYPRE_Int HYPRE_PCGGetFinalRelativeResidualNorm ( HYPRE_Solver solver , HYPRE_Real *norm );
   HYPRE_Int HYPRE_PCGGetResidual ( HYPRE_Solver solver , void *residual );
+  HYPRE_Int HYPRE_PCGSetPipelined ( HYPRE_Solver solver , HYPRE_Int pipelined );
+  HYPRE_Int HYPRE_PCGGetPipelined ( HYPRE_Solver solver , HYPRE_Int *pipelined );
 
   /* pcg.c */
   void *hypre_PCGCreate ( hypre_PCGFunctions *pcg_functions );
@@ -1595,6 +1629,8 @@ extern "C" {
   HYPRE_Int hypre_PCGSetLogging ( void *pcg_vdata , HYPRE_Int level );
   HYPRE_Int hypre_PCGGetLogging ( void *pcg_vdata , HYPRE_Int *level );
   HYPRE_Int hypre_PCGSetHybrid ( void *pcg_vdata , HYPRE_Int level );
+  HYPRE_Int hypre_PCGSetPipelined ( void *pcg_vdata , HYPRE_Int pipelined );
+  HYPRE_Int hypre_PCGGetPipelined ( void *pcg_vdata , HYPRE_Int *pipelined );
   HYPRE_Int hypre_PCGGetNumIterations ( void *pcg_vdata , HYPRE_Int *num_iterations );
   HYPRE_Int hypre_PCGGetConverged ( void *pcg_vdata , HYPRE_Int *converged );
   HYPRE_Int hypre_PCGPrintLogging ( void *pcg_vdata , HYPRE_Int myid );
@@ -65,6 +65,8 @@ hypre_PCGFunctionsCreate(
    pcg_functions->ClearVector = ClearVector;
    pcg_functions->ScaleVector = ScaleVector;
    pcg_functions->Axpy = Axpy;
+   pcg_functions->InnerProdsStart = NULL;
+   pcg_functions->InnerProdsFinish = NULL;
 /* default preconditioner must be set here but can be changed later... */
    pcg_functions->precond_setup = PrecondSetup;
    pcg_functions->precond       = Precond;
@@ -99,6 +101,7 @@ hypre_PCGCreate( hypre_PCGFunctions *pcg_functions )
    (pcg_data -> stop_crit)    = 0;
    (pcg_data -> converged)    = 0;
    (pcg_data -> hybrid)       = 0;
+   (pcg_data -> pipelined)    = 0;
    (pcg_data -> owns_matvec_data ) = 1;
    (pcg_data -> matvec_data)  = NULL;
    (pcg_data -> precond_data) = NULL;
@@ -109,10 +112,44 @@ hypre_PCGCreate( hypre_PCGFunctions *pcg_functions )
    (pcg_data -> p)            = NULL;
    (pcg_data -> s)            = NULL;
    (pcg_data -> r)            = NULL;
+   (pcg_data -> u)            = NULL;
+   (pcg_data -> w)            = NULL;
+   (pcg_data -> m)            = NULL;
+   (pcg_data -> n)            = NULL;
+   (pcg_data -> z)            = NULL;
+   (pcg_data -> q)            = NULL;
 
    return (void *) pcg_data;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGDestroyPipelinedVectors
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PCGDestroyPipelinedVectors( hypre_PCGData *pcg_data )
+{
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+   void              **vectors[6];
+   HYPRE_Int           k;
+
+   vectors[0] = &(pcg_data -> u);
+   vectors[1] = &(pcg_data -> w);
+   vectors[2] = &(pcg_data -> m);
+   vectors[3] = &(pcg_data -> n);
+   vectors[4] = &(pcg_data -> z);
+   vectors[5] = &(pcg_data -> q);
+
+   for (k = 0; k < 6; k++)
+   {
+      if ( *vectors[k] != NULL )
+      {
+         (*(pcg_functions->DestroyVector))(*vectors[k]);
+         *vectors[k] = NULL;
+      }
+   }
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGDestroy
  *--------------------------------------------------------------------------*/
@@ -155,6 +192,7 @@ hypre_PCGDestroy( void *pcg_vdata )
          (*(pcg_functions->DestroyVector))(pcg_data -> r);
          pcg_data -> r = NULL;
       }
+      hypre_PCGDestroyPipelinedVectors( pcg_data );
       hypre_TFreeF( pcg_data, pcg_functions );
       hypre_TFreeF( pcg_functions, pcg_functions );
    }
@@ -200,6 +238,7 @@ hypre_PCGSetup( void *pcg_vdata,
     * compute phases of matvec and the preconditioner.
     *--------------------------------------------------*/
 
+   hypre_MemoryStatsPushCategory(HYPRE_MEMORY_CATEGORY_KRYLOV);
    if ( pcg_data -> p != NULL )
       (*(pcg_functions->DestroyVector))(pcg_data -> p);
    (pcg_data -> p) = (*(pcg_functions->CreateVector))(x);
@@ -211,6 +250,10 @@ hypre_PCGSetup( void *pcg_vdata,
    if ( pcg_data -> r != NULL )
       (*(pcg_functions->DestroyVector))(pcg_data -> r);
    (pcg_data -> r) = (*(pcg_functions->CreateVector))(b);
+   hypre_MemoryStatsPopCategory();
+
+   /* the pipelined solve creates its vectors when first used */
+   hypre_PCGDestroyPipelinedVectors( pcg_data );
 
    if ( pcg_data -> matvec_data != NULL && pcg_data->owns_matvec_data )
       (*(pcg_functions->MatvecDestroy))(pcg_data -> matvec_data);
@@ -238,6 +281,369 @@ hypre_PCGSetup( void *pcg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGInnerProdsStart, hypre_PCGInnerProdsFinish
+ *
+ * result[k] = <x[k],y[k]>, k < num, using the non-blocking inner products of
+ * the interface if it provides them, and blocking InnerProd calls otherwise.
+ *--------------------------------------------------------------------------*/
+
+static void *
+hypre_PCGInnerProdsStart( hypre_PCGFunctions *pcg_functions,
+                          HYPRE_Int           num,
+                          void              **x,
+                          void              **y,
+                          HYPRE_Real         *result )
+{
+   void      *request = NULL;
+   HYPRE_Int  k;
+
+   if (pcg_functions -> InnerProdsStart && pcg_functions -> InnerProdsFinish)
+   {
+      (*(pcg_functions->InnerProdsStart))(num, x, y, result, &request);
+   }
+   else
+   {
+      for (k = 0; k < num; k++)
+      {
+         result[k] = (*(pcg_functions->InnerProd))(x[k], y[k]);
+      }
+   }
+
+   return request;
+}
+
+static void
+hypre_PCGInnerProdsFinish( hypre_PCGFunctions *pcg_functions,
+                           void               *request )
+{
+   if (request)
+   {
+      (*(pcg_functions->InnerProdsFinish))(request);
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGPipelinedSolve
+ *
+ * Pipelined preconditioned CG (P. Ghysels and W. Vanroose, Parallel Computing
+ * 40, 2014, Alg. 4).  The inner products <r,u>, <w,u> (and <r,r> for the
+ * two-norm) of an iteration are combined in one reduction, which is started
+ * before and completed after the preconditioner application m = C*w and the
+ * matvec n = A*m.  Besides r = b - A*x, the recurrences maintain u = C*r,
+ * w = A*u, and the search directions p, s = A*p, q = C*s and z = A*q.
+ *
+ * Called from hypre_PCGSolve after the stopping tolerance has been set, with
+ * the same stopping test and iteration count as the standard iteration.  If
+ * recompute_residual_p is set, r, u and w are recomputed from scratch every
+ * recompute_residual_p iterations and the recurrences are restarted.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PCGPipelinedSolve( void       *pcg_vdata,
+                         void       *A,
+                         void       *b,
+                         void       *x,
+                         HYPRE_Real  bi_prod,
+                         HYPRE_Real  eps )
+{
+   hypre_PCGData  *pcg_data     =  (hypre_PCGData *)pcg_vdata;
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+
+   HYPRE_Int       max_iter     = (pcg_data -> max_iter);
+   HYPRE_Int       two_norm     = (pcg_data -> two_norm);
+   HYPRE_Int       recompute_residual_p = (pcg_data -> recompute_residual_p);
+   HYPRE_Int       stop_crit    = (pcg_data -> stop_crit);
+   HYPRE_Int       rel_change   = (pcg_data -> rel_change);
+   HYPRE_Real      atolf        = (pcg_data -> atolf);
+   HYPRE_Int       hybrid       = (pcg_data -> hybrid);
+   void           *matvec_data  = (pcg_data -> matvec_data);
+   HYPRE_Int     (*precond)(void*,void*,void*,void*)   = (pcg_functions -> precond);
+   void           *precond_data = (pcg_data -> precond_data);
+   HYPRE_Int       print_level  = (pcg_data -> print_level);
+   HYPRE_Int       logging      = (pcg_data -> logging);
+   HYPRE_Real     *norms        = (pcg_data -> norms);
+   HYPRE_Real     *rel_norms    = (pcg_data -> rel_norms);
+
+   void           *r, *u, *w, *m, *n, *p, *s, *q, *z;
+   void           *dot_x[3], *dot_y[3];
+   void           *request;
+   HYPRE_Real      dots[3];
+   HYPRE_Int       num_dots;
+
+   HYPRE_Real      alpha = 0.0, alpha_old = 0.0, beta, denom;
+   HYPRE_Real      gamma, gamma_old = 0.0, delta;
+   HYPRE_Real      i_prod = 0.0;
+   HYPRE_Real      ieee_check = 0.;
+   HYPRE_Real      t0, t_start;
+   HYPRE_Int       restart;
+
+   HYPRE_Int       i = 0;
+   HYPRE_Int       my_id, num_procs;
+
+   (*(pcg_functions->CommInfo))(A,&my_id,&num_procs);
+
+   t_start = hypre_MPI_Wtime();
+   (pcg_data -> time_precond) = 0.0;
+   (pcg_data -> time_matvec)  = 0.0;
+   (pcg_data -> time_reduce)  = 0.0;
+   (pcg_data -> time_update)  = 0.0;
+
+   hypre_MemoryStatsPushCategory(HYPRE_MEMORY_CATEGORY_KRYLOV);
+   if ( pcg_data -> u == NULL )
+   {
+      (pcg_data -> u) = (*(pcg_functions->CreateVector))(pcg_data -> p);
+      (pcg_data -> w) = (*(pcg_functions->CreateVector))(pcg_data -> r);
+      (pcg_data -> m) = (*(pcg_functions->CreateVector))(pcg_data -> p);
+      (pcg_data -> n) = (*(pcg_functions->CreateVector))(pcg_data -> r);
+      (pcg_data -> z) = (*(pcg_functions->CreateVector))(pcg_data -> r);
+      (pcg_data -> q) = (*(pcg_functions->CreateVector))(pcg_data -> p);
+   }
+   hypre_MemoryStatsPopCategory();
+   r = (pcg_data -> r);
+   p = (pcg_data -> p);
+   s = (pcg_data -> s);
+   u = (pcg_data -> u);
+   w = (pcg_data -> w);
+   m = (pcg_data -> m);
+   n = (pcg_data -> n);
+   z = (pcg_data -> z);
+   q = (pcg_data -> q);
+
+   /* gamma = <r,u>, delta = <w,u> and, for the two-norm, <r,r> */
+   dot_x[0] = r; dot_y[0] = u;
+   dot_x[1] = w; dot_y[1] = u;
+   dot_x[2] = r; dot_y[2] = r;
+   num_dots = two_norm ? 3 : 2;
+
+   restart = 1;
+   while (1)
+   {
+      if (restart)
+      {
+         /* r = b - Ax, u = C*r, w = A*u */
+         t0 = hypre_MPI_Wtime();
+         (*(pcg_functions->CopyVector))(b, r);
+         (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+         (pcg_data -> time_matvec) += hypre_MPI_Wtime() - t0;
+
+         t0 = hypre_MPI_Wtime();
+         (*(pcg_functions->ClearVector))(u);
+         precond(precond_data, A, r, u);
+         (pcg_data -> time_precond) += hypre_MPI_Wtime() - t0;
+
+         t0 = hypre_MPI_Wtime();
+         (*(pcg_functions->Matvec))(matvec_data, 1.0, A, u, 0.0, w);
+         (pcg_data -> time_matvec) += hypre_MPI_Wtime() - t0;
+      }
+
+      /*--------------------------------------------------------------------
+       * start the reduction, overlap it with m = C*w and n = A*m
+       *--------------------------------------------------------------------*/
+
+      t0 = hypre_MPI_Wtime();
+      request = hypre_PCGInnerProdsStart(pcg_functions, num_dots, dot_x, dot_y, dots);
+      (pcg_data -> time_reduce) += hypre_MPI_Wtime() - t0;
+
+      if (i < max_iter)
+      {
+         t0 = hypre_MPI_Wtime();
+         (*(pcg_functions->ClearVector))(m);
+         precond(precond_data, A, w, m);
+         (pcg_data -> time_precond) += hypre_MPI_Wtime() - t0;
+
+         t0 = hypre_MPI_Wtime();
+         (*(pcg_functions->Matvec))(matvec_data, 1.0, A, m, 0.0, n);
+         (pcg_data -> time_matvec) += hypre_MPI_Wtime() - t0;
+      }
+
+      t0 = hypre_MPI_Wtime();
+      hypre_PCGInnerProdsFinish(pcg_functions, request);
+      (pcg_data -> time_reduce) += hypre_MPI_Wtime() - t0;
+
+      gamma  = dots[0];
+      delta  = dots[1];
+      i_prod = two_norm ? dots[2] : gamma;
+
+      /*--------------------------------------------------------------------
+       * log, print and test the residual r_i
+       *--------------------------------------------------------------------*/
+
+      if (i == 0)
+      {
+         if (gamma != 0.) ieee_check = gamma/gamma; /* INF -> NaN conversion */
+         if (ieee_check != ieee_check)
+         {
+            if (print_level > 0 || logging > 0)
+            {
+              hypre_printf("\n\nERROR detected by Hypre ...  BEGIN\n");
+              hypre_printf("ERROR -- hypre_PCGSolve: INFs and/or NaNs detected in input.\n");
+              hypre_printf("User probably placed non-numerics in supplied A or x_0.\n");
+              hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+              hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
+            }
+            hypre_error(HYPRE_ERROR_GENERIC);
+            return hypre_error_flag;
+         }
+
+         if ( logging>0 || print_level>0 ) norms[0] = sqrt(i_prod);
+         if ( print_level > 1 && my_id==0 )
+         {
+            hypre_printf("\n\n");
+            if (two_norm)
+            {
+               if ( stop_crit && !rel_change && atolf==0 )  /* pure absolute tolerance */
+               {
+                  hypre_printf("Iters       ||r||_2     conv.rate\n");
+                  hypre_printf("-----    ------------   ---------\n");
+               }
+               else
+               {
+                  hypre_printf("Iters       ||r||_2     conv.rate  ||r||_2/||b||_2\n");
+                  hypre_printf("-----    ------------   ---------  ------------ \n");
+               }
+            }
+            else  /* !two_norm */
+            {
+               hypre_printf("Iters       ||r||_C     conv.rate  ||r||_C/||b||_C\n");
+               hypre_printf("-----    ------------    ---------  ------------ \n");
+            }
+         }
+      }
+      else
+      {
+         if ( logging>0 || print_level>0 )
+         {
+            norms[i]     = sqrt(i_prod);
+            rel_norms[i] = bi_prod ? sqrt(i_prod/bi_prod) : 0;
+         }
+         if ( print_level > 1 && my_id==0 )
+         {
+            if ( two_norm && stop_crit && !rel_change && atolf==0 )
+            {
+               hypre_printf("% 5d    %e    %f\n", i, norms[i],
+                            norms[i]/norms[i-1] );
+            }
+            else
+            {
+               hypre_printf("% 5d    %e    %f    %e\n", i, norms[i],
+                            norms[i]/norms[i-1], rel_norms[i] );
+            }
+         }
+
+         if (i_prod / bi_prod < eps)
+         {
+            (pcg_data -> converged) = 1;
+            break;
+         }
+      }
+
+      if (i >= max_iter)
+      {
+         break;
+      }
+
+      if (! (gamma > HYPRE_REAL_MIN) )
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Subnormal gamma value in PCG");
+         break;
+      }
+
+      /*--------------------------------------------------------------------
+       * scalars and vector updates
+       *--------------------------------------------------------------------*/
+
+      if (restart)
+      {
+         beta  = 0.0;
+         denom = delta;
+      }
+      else
+      {
+         beta  = gamma / gamma_old;
+         denom = delta - beta * gamma / alpha_old;
+      }
+      if ( denom==0.0 )
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Zero sdotp value in PCG");
+         break;
+      }
+      alpha = gamma / denom;
+      if (! (alpha > HYPRE_REAL_MIN) )
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Subnormal alpha value in PCG");
+         break;
+      }
+
+      t0 = hypre_MPI_Wtime();
+      if (restart)
+      {
+         /* z = n, q = m, s = w, p = u */
+         (*(pcg_functions->CopyVector))(n, z);
+         (*(pcg_functions->CopyVector))(m, q);
+         (*(pcg_functions->CopyVector))(w, s);
+         (*(pcg_functions->CopyVector))(u, p);
+      }
+      else
+      {
+         /* z = n + beta z, q = m + beta q, s = w + beta s, p = u + beta p */
+         (*(pcg_functions->ScaleVector))(beta, z);
+         (*(pcg_functions->Axpy))(1.0, n, z);
+         (*(pcg_functions->ScaleVector))(beta, q);
+         (*(pcg_functions->Axpy))(1.0, m, q);
+         (*(pcg_functions->ScaleVector))(beta, s);
+         (*(pcg_functions->Axpy))(1.0, w, s);
+         (*(pcg_functions->ScaleVector))(beta, p);
+         (*(pcg_functions->Axpy))(1.0, u, p);
+      }
+
+      /* x = x + alpha p, r = r - alpha s, u = u - alpha q, w = w - alpha z */
+      (*(pcg_functions->Axpy))(alpha, p, x);
+      (*(pcg_functions->Axpy))(-alpha, s, r);
+      (*(pcg_functions->Axpy))(-alpha, q, u);
+      (*(pcg_functions->Axpy))(-alpha, z, w);
+      (pcg_data -> time_update) += hypre_MPI_Wtime() - t0;
+
+      gamma_old = gamma;
+      alpha_old = alpha;
+      i++;
+
+      /* At user request, periodically recompute r, u = C*r and w = A*u from
+         scratch and restart the recurrences */
+      restart = recompute_residual_p && !(i%recompute_residual_p);
+      if (restart && print_level > 1 && my_id == 0)
+      {
+         hypre_printf("Recomputing the residual...\n");
+      }
+   }
+
+   (pcg_data -> time_total) = hypre_MPI_Wtime() - t_start;
+
+   /*--------------------------------------------------------------------
+    * Finish up with some outputs.
+    *--------------------------------------------------------------------*/
+
+   if ( print_level > 1 && my_id==0 )
+   {
+      hypre_printf("\n\n");
+      hypre_printf("Pipelined PCG time breakdown (rank 0, seconds):\n");
+      hypre_printf("   precond %e   matvec %e   reduction %e   update %e   total %e\n",
+                   pcg_data -> time_precond, pcg_data -> time_matvec, pcg_data -> time_reduce,
+                   pcg_data -> time_update, pcg_data -> time_total);
+      hypre_printf("\n\n");
+   }
+
+   if (i >= max_iter && (i_prod/bi_prod) >= eps && eps > 0 && hybrid != -1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_CONV, "Reached max iterations in PCG before convergence");
+   }
+
+   (pcg_data -> num_iterations) = i;
+   (pcg_data -> rel_residual_norm) = sqrt(i_prod/bi_prod);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGSolve
  *--------------------------------------------------------------------------
@@ -408,6 +814,12 @@ hypre_PCGSolve( void *pcg_vdata,
          action to force iterations even though the exact value was known. */
    };
 
+   if ( (pcg_data -> pipelined) && !rel_change && !rtol && cf_tol <= 0.0 &&
+        !recompute_residual )
+   {
+      return hypre_PCGPipelinedSolve(pcg_vdata, A, b, x, bi_prod, eps);
+   }
+
    /* r = b - Ax */
    (*(pcg_functions->CopyVector))(b, r);
 
@@ -1008,6 +1420,32 @@ hypre_PCGGetRecomputeResidualP( void *pcg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetPipelined, hypre_PCGGetPipelined
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetPipelined( void *pcg_vdata,
+                       HYPRE_Int   pipelined  )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   (pcg_data -> pipelined) = pipelined;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGGetPipelined( void *pcg_vdata,
+                       HYPRE_Int * pipelined  )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   *pipelined = (pcg_data -> pipelined);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGSetStopCrit, hypre_PCGGetStopCrit
  *--------------------------------------------------------------------------*/
@@ -1195,6 +1633,12 @@ hypre_PCGPrintLogging( void *pcg_vdata,
             hypre_printf("Relative residual norm[%d] = %e\n", i, rel_norms[i]);
          }
       }
+      if (print_level > 0 && (pcg_data -> pipelined) && (pcg_data -> u))
+      {
+         hypre_printf("Pipelined PCG time: precond %e  matvec %e  reduction %e  update %e  total %e\n",
+                      pcg_data -> time_precond, pcg_data -> time_matvec, pcg_data -> time_reduce,
+                      pcg_data -> time_update, pcg_data -> time_total);
+      }
    }
 
    return hypre_error_flag;
@@ -64,6 +64,12 @@ typedef struct
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
    HYPRE_Int    (*Axpy)          ( HYPRE_Complex alpha, void *x, void *y );
 
+   /* optional: non-blocking inner products for the pipelined solver (may be
+      NULL, then InnerProd is used) */
+   HYPRE_Int    (*InnerProdsStart)  ( HYPRE_Int num, void **x, void **y,
+                                      HYPRE_Real *result, void **request );
+   HYPRE_Int    (*InnerProdsFinish) ( void *request );
+
    HYPRE_Int    (*precond)();
    HYPRE_Int    (*precond_setup)();
 
@@ -102,6 +108,10 @@ typedef struct
  every "recompute_residual_p" iterations.  This can be expensive and degrade the
  convergence. Use it only if you have seen a problem with the regular residual
  computation.
+ - pipelined!=0 means: use the pipelined CG of Ghysels and Vanroose, with one
+ (non-blocking) reduction per iteration that overlaps the preconditioner and
+ the matvec.  Not combined with rel_change, rtol, cf_tol or recompute_residual;
+ if any of these are set, the standard iteration is used.
 */
 
 typedef struct
@@ -119,12 +129,14 @@ typedef struct
    HYPRE_Int    stop_crit;
    HYPRE_Int    converged;
    HYPRE_Int    hybrid;
+   HYPRE_Int    pipelined;
 
    void    *A;
    void    *p;
    void    *s;
    void    *r; /* ...contains the residual.  This is currently kept permanently.
                   If that is ever changed, it still must be kept if logging>1 */
+   void    *u, *w, *m, *n, *z, *q; /* additional vectors of the pipelined CG */
 
    HYPRE_Int  owns_matvec_data;  /* normally 1; if 0, don't delete it */
    void      *matvec_data;
@@ -141,6 +153,13 @@ typedef struct
    HYPRE_Real  *norms;
    HYPRE_Real  *rel_norms;
 
+   /* iteration time breakdown of the last pipelined solve */
+   HYPRE_Real   time_precond;
+   HYPRE_Real   time_matvec;
+   HYPRE_Real   time_reduce; /* local inner products and reduction waits */
+   HYPRE_Real   time_update;
+   HYPRE_Real   time_total;
+
 } hypre_PCGData;
 
 #define hypre_PCGDataOwnsMatvecData(pcgdata)  ((pcgdata) -> owns_matvec_data)
@@ -160,6 +160,16 @@ HYPRE_Int HYPRE_ADSSetPrintLevel(HYPRE_Solver solver,
    return hypre_ADSSetPrintLevel((void *) solver, print_level);
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ADSSetConcurrentSolve
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int HYPRE_ADSSetConcurrentSolve(HYPRE_Solver solver,
+                                      HYPRE_Int concurrent_solve)
+{
+   return hypre_ADSSetConcurrentSolve((void *) solver, concurrent_solve);
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ADSSetSmoothingOptions
  *--------------------------------------------------------------------------*/
@@ -208,6 +208,16 @@ HYPRE_Int HYPRE_AMSSetPrintLevel(HYPRE_Solver solver,
    return hypre_AMSSetPrintLevel((void *) solver, print_level);
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_AMSSetConcurrentSolve
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int HYPRE_AMSSetConcurrentSolve(HYPRE_Solver solver,
+                                      HYPRE_Int concurrent_solve)
+{
+   return hypre_AMSSetConcurrentSolve((void *) solver, concurrent_solve);
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_AMSSetSmoothingOptions
  *--------------------------------------------------------------------------*/
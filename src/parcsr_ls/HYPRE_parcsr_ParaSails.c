@@ -501,6 +501,33 @@ HYPRE_ParaSailsSolve( HYPRE_Solver solver,
 #endif
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParaSailsSolveT - Apply the transpose of ParaSails, e.g., for CGNR.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParaSailsSolveT( HYPRE_Solver solver,
+                       HYPRE_ParCSRMatrix A,
+                       HYPRE_ParVector b,
+                       HYPRE_ParVector x     )
+{
+#ifdef HYPRE_MIXEDINT
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC,"ParaSails not usable in mixedint mode!");
+   return hypre_error_flag;
+#else
+
+   HYPRE_Real *rhs, *soln;
+   Secret *secret = (Secret *) solver;
+
+   rhs  = hypre_VectorData(hypre_ParVectorLocalVector((hypre_ParVector *) b));
+   soln = hypre_VectorData(hypre_ParVectorLocalVector((hypre_ParVector *) x));
+
+   hypre_ParaSailsApplyTrans(secret->obj, rhs, soln);
+
+   return hypre_error_flag;
+#endif
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParaSailsSetParams - Set the parameters "thresh" and "nlevels"
  * for a ParaSails object.
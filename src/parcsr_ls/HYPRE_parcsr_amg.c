@@ -288,6 +288,157 @@ HYPRE_BoomerAMGSetSabs( HYPRE_Solver solver,
                                    Sabs ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetMixedPrecisionLevel, HYPRE_BoomerAMGGetMixedPrecisionLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetMixedPrecisionLevel( HYPRE_Solver solver,
+                                       HYPRE_Int    mixed_prec_level  )
+{
+   return( hypre_BoomerAMGSetMixedPrecisionLevel( (void *) solver,
+                                                  mixed_prec_level ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGGetMixedPrecisionLevel( HYPRE_Solver solver,
+                                       HYPRE_Int  * mixed_prec_level  )
+{
+   return( hypre_BoomerAMGGetMixedPrecisionLevel( (void *) solver,
+                                                  mixed_prec_level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetSetupReuse, HYPRE_BoomerAMGGetSetupReuse
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetSetupReuse( HYPRE_Solver solver,
+                              HYPRE_Int    setup_reuse  )
+{
+   return( hypre_BoomerAMGSetSetupReuse( (void *) solver,
+                                         setup_reuse ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGGetSetupReuse( HYPRE_Solver solver,
+                              HYPRE_Int  * setup_reuse  )
+{
+   return( hypre_BoomerAMGGetSetupReuse( (void *) solver,
+                                         setup_reuse ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetSetupArena, HYPRE_BoomerAMGGetSetupArena
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetSetupArena( HYPRE_Solver solver,
+                              HYPRE_Int    setup_arena  )
+{
+   return( hypre_BoomerAMGSetSetupArena( (void *) solver,
+                                         setup_arena ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGGetSetupArena( HYPRE_Solver solver,
+                              HYPRE_Int  * setup_arena  )
+{
+   return( hypre_BoomerAMGGetSetupArena( (void *) solver,
+                                         setup_arena ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetNodeAwareLevel, HYPRE_BoomerAMGGetNodeAwareLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetNodeAwareLevel( HYPRE_Solver solver,
+                                  HYPRE_Int    node_aware_level  )
+{
+   return( hypre_BoomerAMGSetNodeAwareLevel( (void *) solver,
+                                             node_aware_level ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGGetNodeAwareLevel( HYPRE_Solver solver,
+                                  HYPRE_Int  * node_aware_level  )
+{
+   return( hypre_BoomerAMGGetNodeAwareLevel( (void *) solver,
+                                             node_aware_level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetNeighborCommLevel, HYPRE_BoomerAMGGetNeighborCommLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetNeighborCommLevel( HYPRE_Solver solver,
+                                     HYPRE_Int    neighbor_comm_level  )
+{
+   return( hypre_BoomerAMGSetNeighborCommLevel( (void *) solver,
+                                                neighbor_comm_level ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGGetNeighborCommLevel( HYPRE_Solver solver,
+                                     HYPRE_Int  * neighbor_comm_level  )
+{
+   return( hypre_BoomerAMGGetNeighborCommLevel( (void *) solver,
+                                                neighbor_comm_level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetRedistributeThreshold, HYPRE_BoomerAMGGetRedistributeThreshold
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetRedistributeThreshold( HYPRE_Solver solver,
+                                         HYPRE_Int    redist_threshold  )
+{
+   return( hypre_BoomerAMGSetRedistributeThreshold( (void *) solver,
+                                                    redist_threshold ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGGetRedistributeThreshold( HYPRE_Solver solver,
+                                         HYPRE_Int  * redist_threshold  )
+{
+   return( hypre_BoomerAMGGetRedistributeThreshold( (void *) solver,
+                                                    redist_threshold ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetProfile, HYPRE_BoomerAMGGetProfile, HYPRE_BoomerAMGPrintProfile
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetProfile( HYPRE_Solver solver,
+                           HYPRE_Int    profile  )
+{
+   return( hypre_BoomerAMGSetProfile( (void *) solver,
+                                      profile ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGGetProfile( HYPRE_Solver solver,
+                           HYPRE_Int    level,
+                           HYPRE_Int    phase,
+                           HYPRE_Int    stat,
+                           HYPRE_Real  *value  )
+{
+   return( hypre_BoomerAMGGetProfile( (void *) solver,
+                                      level, phase, stat, value ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGPrintProfile( HYPRE_Solver  solver,
+                             const char   *filename  )
+{
+   return( hypre_BoomerAMGPrintProfile( (void *) solver,
+                                        filename ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetMaxRowSum, HYPRE_BoomerAMGGetMaxRowSum
  *--------------------------------------------------------------------------*/
@@ -1645,6 +1796,17 @@ HYPRE_BoomerAMGSetChebyEigEst( HYPRE_Solver  solver,
    return( hypre_BoomerAMGSetChebyEigEst( (void *) solver, eig_est ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetChebyEigReuse
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetChebyEigReuse( HYPRE_Solver  solver,
+                                 HYPRE_Int     eig_reuse )
+{
+   return( hypre_BoomerAMGSetChebyEigReuse( (void *) solver, eig_reuse ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetInterpVectors
  *--------------------------------------------------------------------------*/
@@ -107,6 +107,14 @@ HYPRE_Int HYPRE_BoomerAMGSetup(HYPRE_Solver       solver,
  * If used as a preconditioner, this function should be passed
  * to the iterative solver \e SetPrecond function.
  *
+ * If b and x are multivectors, all right hand sides are solved at once.  With
+ * l1-Jacobi smoothing (relax type 18, no CF-ordering), the cycle is applied
+ * to all vectors together and stops when every vector has converged; the
+ * number of iterations and the final relative residual norm are those of the
+ * slowest vector.  Other configurations, including coarse grids gathered
+ * onto fewer processors (redistribution, sequential or redundant coarse
+ * solves), solve one vector at a time.
+ *
  * @param solver [IN] solver or preconditioner object to be applied.
  * @param A [IN] ParCSR matrix, matrix of the linear system to be solved
  * @param b [IN] right hand side of the linear system to be solved
@@ -730,6 +738,14 @@ HYPRE_Int HYPRE_BoomerAMGSetGridRelaxType(HYPRE_Solver  solver,
  *    - 16 : Chebyshev
  *    - 17 : FCF-Jacobi
  *    - 18 : \f$\ell_1\f$-scaled jacobi
+ *    - 40 : multicolor \f$\ell_1\f$ Gauss-Seidel, forward solve
+ *    - 41 : multicolor \f$\ell_1\f$ Gauss-Seidel, backward solve
+ *    - 42 : multicolor \f$\ell_1\f$ symmetric Gauss-Seidel
+ *
+ * The multicolor smoothers color the rows of each processor in the setup,
+ * such that the rows of a color are not coupled, and relax the rows of a
+ * color in parallel.  Unlike the hybrid smoothers, their result does not
+ * depend on the number of threads.
  **/
 HYPRE_Int HYPRE_BoomerAMGSetRelaxType(HYPRE_Solver  solver,
                                       HYPRE_Int     relax_type);
@@ -867,6 +883,12 @@ HYPRE_Int HYPRE_BoomerAMGSetChebyScale (HYPRE_Solver solver,
 /**
  * (Optional) Defines which polynomial variant should be used.
  *  The default is 0 (i.e., scaled).
+ *
+ *    - 0 : standard Chebyshev polynomial
+ *    - 1 : modified Chebyshev polynomial
+ *    - 2 : fourth-kind Chebyshev polynomial, which only needs the largest
+ *          eigenvalue (the fraction is ignored)
+ *    - 3 : fourth-kind Chebyshev polynomial with optimized weights
  **/
 HYPRE_Int HYPRE_BoomerAMGSetChebyVariant (HYPRE_Solver solver,
                                            HYPRE_Int   variant);
@@ -882,6 +904,16 @@ HYPRE_Int HYPRE_BoomerAMGSetChebyVariant (HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetChebyEigEst (HYPRE_Solver solver,
                                            HYPRE_Int   eig_est);
 
+/**
+ * (Optional) Reuses the eigenvalue estimates of the Chebyshev smoother in
+ *  numeric-only re-setups (see HYPRE_BoomerAMGSetSetupReuse).  If eig_reuse
+ *  is a positive number n, the estimates of the last full estimation are
+ *  kept for n re-setups; only the coefficients and the diagonal scaling are
+ *  recomputed.  The default is 0 (i.e., estimate at every setup).
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetChebyEigReuse (HYPRE_Solver solver,
+                                           HYPRE_Int   eig_reuse);
+
 /**
  * (Optional) Enables the use of more complex smoothers.
  * The following options exist for \e smooth_type:
@@ -1258,6 +1290,178 @@ HYPRE_Int HYPRE_BoomerAMGSetIsolatedFPoints(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_BoomerAMGSetSabs (HYPRE_Solver solver,
                                   HYPRE_Int Sabs );
 
+/**
+ * (Optional) Stores the interpolation operators P (and R) of all levels
+ * >= mixed_prec_level, and the coarse-grid operators A of those levels
+ * that are only applied through matrix-vector products, in single
+ * precision.  Vectors and all arithmetic stay in double precision.  The
+ * operators A are converted on levels that use Chebyshev (16) or l1-Jacobi
+ * (18, without CF-relaxation) smoothing on both the down and up cycle; the
+ * fine grid matrix and the coarsest grid matrix are never converted.  This
+ * option is host only and is ignored for additive cycles and block mode.
+ * A report of the memory saved is printed if the print level is 1 or 3.
+ * Default is -1, i.e. all operators are stored in double precision.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetMixedPrecisionLevel (HYPRE_Solver solver,
+                                                 HYPRE_Int    mixed_prec_level);
+
+/**
+ * (Optional) Returns the level set by HYPRE_BoomerAMGSetMixedPrecisionLevel.
+ **/
+HYPRE_Int HYPRE_BoomerAMGGetMixedPrecisionLevel (HYPRE_Solver solver,
+                                                 HYPRE_Int   *mixed_prec_level);
+
+/**
+ * (Optional) Enables a numeric-only re-setup for a sequence of matrices
+ * with the same sparsity pattern, e.g. in nonlinear or time-stepping loops.
+ * The setup following a setup with this option keeps the C/F splittings,
+ * the sparsity patterns of the interpolation operators and the symbolic
+ * Galerkin products A*P and P^T*(A*P), and only recomputes their values
+ * and the smoother data (l1 norms, Chebyshev coefficients, coarse grid
+ * factorization).  There are the following options for \e setup_reuse:
+ *
+ *    - 0 : full setup every time
+ *    - 1 : keep the patterns; recompute the weights of P on its pattern by
+ *          direct interpolation (interpolation types 3 and 15 without
+ *          aggressive coarsening only; other interpolations do a full setup)
+ *    - 2 : keep P; only recompute the coarse grid operators
+ *
+ * The re-setup is used if the new matrix has the same local number of rows
+ * and nonzeros as the previous one; otherwise, and for configurations it
+ * does not support (block systems, non-Galerkin or AIR coarse grids,
+ * additive cycles, complex smoothers, redundant coarse grid solves, device
+ * memory), a full setup is done.
+ * With print level 1 or 3 the time spent in each setup phase is printed.
+ * The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetSetupReuse (HYPRE_Solver solver,
+                                        HYPRE_Int    setup_reuse);
+
+/**
+ * (Optional) Returns the option set by HYPRE_BoomerAMGSetSetupReuse.
+ **/
+HYPRE_Int HYPRE_BoomerAMGGetSetupReuse (HYPRE_Solver solver,
+                                        HYPRE_Int   *setup_reuse);
+
+/**
+ * (Optional) If set to 1, the short-lived host work arrays of the
+ * interpolation routines (markers, fine-to-coarse maps, row counters) are
+ * taken from a bump allocator with one sub-arena per thread, which is
+ * rewound after each level and released at the end of the setup.  This
+ * replaces many malloc/free pairs by a few large allocations, at the cost
+ * of keeping the work arrays of one level alive until the level is done.
+ * The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetSetupArena (HYPRE_Solver solver,
+                                        HYPRE_Int    setup_arena);
+
+/**
+ * (Optional) Returns the option set by HYPRE_BoomerAMGSetSetupArena.
+ **/
+HYPRE_Int HYPRE_BoomerAMGGetSetupArena (HYPRE_Solver solver,
+                                        HYPRE_Int   *setup_arena);
+
+/**
+ * (Optional) From level {\tt node\_aware\_level} on, the halo exchanges of
+ * the matrices A, P and R are node-aware: the entries between two nodes are
+ * aggregated on one processor of each node, so that every pair of nodes
+ * exchanges one message, and are distributed on the node by on-node
+ * messages.  This pays off on the coarse levels, where each processor has
+ * few rows but many neighbors.  The nodes are the shared-memory domains of
+ * MPI\_Comm\_split\_type (see also HYPRE\_SetNodeAwareRanksPerNode).  The
+ * exchanges are blocking and use host memory.  The default is -1, i.e.,
+ * point-to-point exchanges on all levels.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetNodeAwareLevel (HYPRE_Solver solver,
+                                            HYPRE_Int    node_aware_level);
+
+/**
+ * (Optional) Returns the option set by HYPRE_BoomerAMGSetNodeAwareLevel.
+ **/
+HYPRE_Int HYPRE_BoomerAMGGetNodeAwareLevel (HYPRE_Solver solver,
+                                            HYPRE_Int   *node_aware_level);
+
+/**
+ * (Optional) Selects the backend of the halo exchanges of the matrices A, P
+ * and R per level: levels below {\tt neighbor\_comm\_level} use
+ * point-to-point messages, the levels from {\tt neighbor\_comm\_level} on
+ * use MPI neighborhood collectives (see HYPRE\_SetNeighborComm), so that
+ * the per-level wait times of both backends can be compared in the AMG
+ * profile.  Building the graph communicators is collective.  The default
+ * is -1, i.e., the backend chosen with HYPRE\_SetNeighborComm when the
+ * matrices were created.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetNeighborCommLevel (HYPRE_Solver solver,
+                                               HYPRE_Int    neighbor_comm_level);
+
+/**
+ * (Optional) Returns the option set by HYPRE_BoomerAMGSetNeighborCommLevel.
+ **/
+HYPRE_Int HYPRE_BoomerAMGGetNeighborCommLevel (HYPRE_Solver solver,
+                                               HYPRE_Int   *neighbor_comm_level);
+
+/**
+ * (Optional) Gathers the coarse levels onto fewer processors once they have
+ * less than {\tt redist\_threshold} rows per processor on average.  The
+ * rows of such a level are moved to every k-th processor, with k chosen such
+ * that these get about {\tt redist\_threshold} rows each, and the remaining
+ * levels are built and cycled on them only, while the other processors are
+ * idle.  Further down, the levels are gathered again, in the same way.
+ * This cuts the latency of the halo exchanges on the coarse levels, where
+ * the processors have few rows but many neighbors.  The default is 0, i.e.,
+ * no redistribution.  Not used with the additive cycles, the nodal systems
+ * and the block matrices.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetRedistributeThreshold (HYPRE_Solver solver,
+                                                   HYPRE_Int    redist_threshold);
+
+/**
+ * (Optional) Returns the option set by HYPRE_BoomerAMGSetRedistributeThreshold.
+ **/
+HYPRE_Int HYPRE_BoomerAMGGetRedistributeThreshold (HYPRE_Solver solver,
+                                                   HYPRE_Int   *redist_threshold);
+
+/**
+ * (Optional) Enables a per-level profile of the setup and the solve phase.
+ * For each level it records the wall clock time, the time spent waiting
+ * for halo exchanges, and the number of messages and bytes sent in the
+ * following phases:
+ *
+ *    - 0 : strength matrix (setup)
+ *    - 1 : coarsening (setup)
+ *    - 2 : interpolation (setup)
+ *    - 3 : coarse grid operator (setup)
+ *    - 4 : relaxation (solve)
+ *    - 5 : restriction, including the residual (solve)
+ *    - 6 : interpolation (solve)
+ *
+ * The profile has to be enabled before the setup.  Each setup clears it,
+ * while the solve phases are accumulated over all following solves.
+ * Disabling the profile discards it.  The default is 0 (off).
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetProfile (HYPRE_Solver solver,
+                                     HYPRE_Int    profile);
+
+/**
+ * (Optional) Returns the local value of a profile statistic for the given
+ * level and phase (see HYPRE_BoomerAMGSetProfile).  The statistics are
+ * 0: wall clock time, 1: communication wait time, 2: messages sent,
+ * 3: bytes sent, 4: number of calls.
+ **/
+HYPRE_Int HYPRE_BoomerAMGGetProfile (HYPRE_Solver solver,
+                                     HYPRE_Int    level,
+                                     HYPRE_Int    phase,
+                                     HYPRE_Int    stat,
+                                     HYPRE_Real  *value);
+
+/**
+ * (Optional) Writes the profile in JSON format to the given file.  Times
+ * are the maximum and messages and bytes the sum over all processors.
+ * Must be called by all processors; the file is written by processor 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGPrintProfile (HYPRE_Solver  solver,
+                                       const char   *filename);
+
 /**@}*/
 
 /*--------------------------------------------------------------------------
@@ -1311,6 +1515,21 @@ HYPRE_Int HYPRE_ParaSailsSolve(HYPRE_Solver       solver,
                                HYPRE_ParVector    b,
                                HYPRE_ParVector    x);
 
+/**
+ * Apply the transpose of the ParaSails preconditioner.  This is the same
+ * as \e HYPRE_ParaSailsSolve for the symmetric case, and is meant to be
+ * passed as the transpose preconditioner to \e HYPRE_CGNRSetPrecond.
+ *
+ * @param solver [IN] Preconditioner object to apply.
+ * @param A Ignored by this function.
+ * @param b [IN] Vector to precondition.
+ * @param x [OUT] Preconditioned vector.
+ **/
+HYPRE_Int HYPRE_ParaSailsSolveT(HYPRE_Solver       solver,
+                                HYPRE_ParCSRMatrix A,
+                                HYPRE_ParVector    b,
+                                HYPRE_ParVector    x);
+
 /**
  * Set the threshold and levels parameter for the ParaSails
  * preconditioner.  The accuracy and cost of ParaSails are
@@ -1866,6 +2085,22 @@ HYPRE_Int HYPRE_AMSSetCycleType(HYPRE_Solver solver,
 HYPRE_Int HYPRE_AMSSetPrintLevel(HYPRE_Solver solver,
                                  HYPRE_Int    print_level);
 
+/**
+ * (Optional) Solve the subspace problems of the additive cycle types
+ * concurrently (1) instead of one after the other (0). In the first run of
+ * additive corrections of the cycle, the BoomerAMG subspace problems of
+ * the vertex (1), vector vertex (2) or vertex component (3, 4, 5) spaces are redistributed onto disjoint groups of processors, one group
+ * per subspace, and solved at the same time, with BoomerAMG solvers of the
+ * same parameters set up on the groups in the first solve. This shortens each
+ * cycle at the cost of extra setup and memory. The corrections are not the
+ * same as with 0, since the AMG hierarchies depend on the distribution of the
+ * rows. It requires at least as many processors as subspaces, otherwise the
+ * subspace problems are solved one after the other.
+ * The default is 0.
+ **/
+HYPRE_Int HYPRE_AMSSetConcurrentSolve(HYPRE_Solver solver,
+                                      HYPRE_Int    concurrent_solve);
+
 /**
  * (Optional) Sets relaxation parameters for \f$A\f$.
  * The defaults are 2, 1, 1.0, 1.0.
@@ -2128,6 +2363,23 @@ HYPRE_Int HYPRE_ADSSetCycleType(HYPRE_Solver solver ,
 HYPRE_Int HYPRE_ADSSetPrintLevel(HYPRE_Solver solver ,
                                  HYPRE_Int    print_level);
 
+/**
+ * (Optional) Solve the subspace problems of the additive cycle types
+ * concurrently (1) instead of one after the other (0). In the first run of
+ * additive corrections of the cycle, the BoomerAMG subspace problems of
+ * the vector vertex (2) or vertex component (3, 4, 5) spaces are redistributed onto disjoint groups of processors, one group
+ * per subspace, and solved at the same time, with BoomerAMG solvers of the
+ * same parameters set up on the groups in the first solve. This shortens each
+ * cycle at the cost of extra setup and memory. The corrections are not the
+ * same as with 0, since the AMG hierarchies depend on the distribution of the
+ * rows. It requires at least as many processors as subspaces, otherwise the
+ * subspace problems are solved one after the other.
+ * The AMS subspace (1) is still solved on all processors, before the others.
+ * The default is 0.
+ **/
+HYPRE_Int HYPRE_ADSSetConcurrentSolve(HYPRE_Solver solver ,
+                                      HYPRE_Int    concurrent_solve);
+
 /**
  * (Optional) Sets relaxation parameters for \f$A\f$.
  * The defaults are 2, 1, 1.0, 1.0.
@@ -3876,6 +4128,48 @@ HYPRE_ILUSetType( HYPRE_Solver solver, HYPRE_Int ilu_type );
 HYPRE_Int
 HYPRE_ILUSetLocalReordering( HYPRE_Solver solver, HYPRE_Int reordering_type );
 
+/**
+ * (Optional) Set the type of the triangular solves with the local L and U
+ * factors of the block Jacobi (0, 1) and RAS (30, 31) ILU types, and of the
+ * ILU preconditioner of the Schur complement GMRES.
+ *
+ * Options for \e tri_solve are:
+ *    - 0 : sequential forward and backward substitution (default)
+ *    - 1 : level-scheduled substitution. The rows are grouped into levels of
+ *          independent rows in the setup and the rows of a level are solved
+ *          for in parallel with OpenMP. The results are the same as with 0.
+ *    - 2 : approximate solves by Jacobi iterations, see
+ *          \e HYPRE_ILUSetLowerJacobiIters and \e HYPRE_ILUSetUpperJacobiIters.
+ *          All rows are updated in parallel in each iteration.
+ **/
+HYPRE_Int
+HYPRE_ILUSetTriSolve( HYPRE_Solver solver, HYPRE_Int tri_solve );
+
+/**
+ * (Optional) Set the number of Jacobi iterations for the L solve when
+ * \e tri_solve is 2. The default is 5.
+ **/
+HYPRE_Int
+HYPRE_ILUSetLowerJacobiIters( HYPRE_Solver solver, HYPRE_Int lower_jacobi_iters );
+
+/**
+ * (Optional) Set the number of Jacobi iterations for the U solve when
+ * \e tri_solve is 2. The default is 5.
+ **/
+HYPRE_Int
+HYPRE_ILUSetUpperJacobiIters( HYPRE_Solver solver, HYPRE_Int upper_jacobi_iters );
+
+/**
+ * (Optional) Compute the block Jacobi ILU(k) factors (ILU type 0) by
+ * \e iter_setup_sweeps fixed-point sweeps over all their entries (Chow and
+ * Patel), in parallel with OpenMP, instead of the exact row-by-row
+ * factorization. The factors approach the exact ones with the number of
+ * sweeps; a few sweeps are usually enough for a preconditioner. The default
+ * is 0 (exact factorization).
+ **/
+HYPRE_Int
+HYPRE_ILUSetIterativeSetupSweeps( HYPRE_Solver solver, HYPRE_Int iter_setup_sweeps );
+
 /**
  * (Optional) Set the print level to print setup and solve information.
  *
@@ -31,6 +31,9 @@ HYPRE_ParCSRPCGCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovClearVector,
          hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
          hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
+   /* non-blocking inner products for the pipelined iteration */
+   pcg_functions->InnerProdsStart  = hypre_ParKrylovInnerProdsStart;
+   pcg_functions->InnerProdsFinish = hypre_ParKrylovInnerProdsFinish;
    *solver = ( (HYPRE_Solver) hypre_PCGCreate( pcg_functions ) );
 
    return hypre_error_flag;
@@ -30,6 +30,40 @@ typedef struct { HYPRE_Int prev; HYPRE_Int next; } Link;
 
 #include "par_csr_block_matrix.h"
 
+/*--------------------------------------------------------------------------
+ * Phases of the setup timed in hypre_ParAMGData setup_times
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_AMG_SETUP_TIME_STRENGTH  0
+#define HYPRE_AMG_SETUP_TIME_COARSEN   1
+#define HYPRE_AMG_SETUP_TIME_INTERP    2
+#define HYPRE_AMG_SETUP_TIME_RAP       3
+#define HYPRE_AMG_SETUP_TIME_SMOOTHER  4
+#define HYPRE_AMG_SETUP_TIME_OTHER     5
+#define HYPRE_AMG_SETUP_TIME_TOTAL     6
+#define HYPRE_AMG_SETUP_NUM_TIMES      7
+
+/*--------------------------------------------------------------------------
+ * Phases and statistics of the per-level profile (see par_amg_profile.c).
+ * The setup phases have the numbers of the corresponding setup times.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_AMG_PROFILE_STRENGTH     0
+#define HYPRE_AMG_PROFILE_COARSEN      1
+#define HYPRE_AMG_PROFILE_INTERP       2
+#define HYPRE_AMG_PROFILE_RAP          3
+#define HYPRE_AMG_PROFILE_RELAX        4
+#define HYPRE_AMG_PROFILE_RESTRICT     5
+#define HYPRE_AMG_PROFILE_PROLONG      6
+#define HYPRE_AMG_PROFILE_NUM_PHASES   7
+
+#define HYPRE_AMG_PROFILE_TIME         0
+#define HYPRE_AMG_PROFILE_WAIT         1
+#define HYPRE_AMG_PROFILE_MESSAGES     2
+#define HYPRE_AMG_PROFILE_BYTES        3
+#define HYPRE_AMG_PROFILE_CALLS        4
+#define HYPRE_AMG_PROFILE_NUM_STATS    5
+
 /*--------------------------------------------------------------------------
  * hypre_ParAMGData
  *--------------------------------------------------------------------------*/
@@ -79,6 +113,12 @@ typedef struct
    HYPRE_Int      redundant;
    HYPRE_Int      participate;
    HYPRE_Int      Sabs;
+   HYPRE_Int      mixed_prec_level;
+   HYPRE_Int      setup_reuse;
+   HYPRE_Int      setup_arena;
+   HYPRE_Int      node_aware_level;
+   HYPRE_Int      neighbor_comm_level;
+   HYPRE_Int      redist_threshold;
 
    /* solve params */
    HYPRE_Int      max_iter;
@@ -124,6 +164,20 @@ typedef struct
    HYPRE_Int            num_levels;
    hypre_Vector       **l1_norms;
 
+   /* data kept for a numeric-only re-setup (setup_reuse > 0) */
+   hypre_ParCSRMatrix **AP_array;
+   hypre_ParCSRMatMatPlan **AP_plan_array;
+   hypre_ParCSRMatMatPlan **RAP_plan_array;
+   HYPRE_Int            reuse_num_rows;
+   HYPRE_Int            reuse_num_nonzeros;
+   HYPRE_Int            setup_reused;
+   HYPRE_Real           setup_times[HYPRE_AMG_SETUP_NUM_TIMES];
+
+   /* per-level profile, [level][phase][stat] */
+   HYPRE_Int            profile;
+   HYPRE_Int            profile_num_levels;
+   HYPRE_Real          *profile_data;
+
    /* Block data */
    hypre_ParCSRBlockMatrix **A_block_array;
    hypre_ParCSRBlockMatrix **P_block_array;
@@ -155,6 +209,8 @@ typedef struct
    HYPRE_Real          *max_eig_est;
    HYPRE_Real          *min_eig_est;
    HYPRE_Int            cheby_eig_est;
+   HYPRE_Int            cheby_eig_reuse;
+   HYPRE_Int            cheby_eig_age;
    HYPRE_Int            cheby_order;
    HYPRE_Int            cheby_variant;
    HYPRE_Int            cheby_scale;
@@ -162,6 +218,11 @@ typedef struct
    HYPRE_Real         **cheby_ds;
    HYPRE_Real         **cheby_coefs;
 
+   /* data for multicolor Gauss-Seidel */
+   HYPRE_Int           *mc_num_colors;
+   HYPRE_Int          **mc_color_starts;
+   HYPRE_Int          **mc_color_rows;
+
    /* data needed for non-Galerkin option */
    HYPRE_Int           nongalerk_num_tol;
    HYPRE_Real         *nongalerk_tol;
@@ -222,6 +283,7 @@ typedef struct
    hypre_ParVector     *f_coarse;
    hypre_ParVector     *u_coarse;
    MPI_Comm             new_comm;
+   MPI_Comm             redist_comm;
 
    /* store matrix, vector and communication info for Gaussian elimination */
    HYPRE_Int   gs_setup;
@@ -287,6 +349,12 @@ typedef struct
 #define hypre_ParAMGDataStrongThresholdR(amg_data)     ((amg_data) -> strong_thresholdR)
 #define hypre_ParAMGDataFilterThresholdR(amg_data)     ((amg_data) -> filter_thresholdR)
 #define hypre_ParAMGDataSabs(amg_data)                 ((amg_data) -> Sabs)
+#define hypre_ParAMGDataMixedPrecLevel(amg_data)       ((amg_data) -> mixed_prec_level)
+#define hypre_ParAMGDataSetupReuse(amg_data)           ((amg_data) -> setup_reuse)
+#define hypre_ParAMGDataSetupArena(amg_data)           ((amg_data) -> setup_arena)
+#define hypre_ParAMGDataNodeAwareLevel(amg_data)       ((amg_data) -> node_aware_level)
+#define hypre_ParAMGDataNeighborCommLevel(amg_data)    ((amg_data) -> neighbor_comm_level)
+#define hypre_ParAMGDataRedistThreshold(amg_data)      ((amg_data) -> redist_threshold)
 #define hypre_ParAMGDataMaxRowSum(amg_data)            ((amg_data) -> max_row_sum)
 #define hypre_ParAMGDataTruncFactor(amg_data)          ((amg_data) -> trunc_factor)
 #define hypre_ParAMGDataAggTruncFactor(amg_data)       ((amg_data) -> agg_trunc_factor)
@@ -361,6 +429,16 @@ typedef struct
 #define hypre_ParAMGDataPointDofMapArray(amg_data) \
 ((amg_data)->point_dof_map_array)
 #define hypre_ParAMGDataNumLevels(amg_data) ((amg_data)->num_levels)
+#define hypre_ParAMGDataAPArray(amg_data) ((amg_data)->AP_array)
+#define hypre_ParAMGDataAPPlanArray(amg_data) ((amg_data)->AP_plan_array)
+#define hypre_ParAMGDataRAPPlanArray(amg_data) ((amg_data)->RAP_plan_array)
+#define hypre_ParAMGDataReuseNumRows(amg_data) ((amg_data)->reuse_num_rows)
+#define hypre_ParAMGDataReuseNumNonzeros(amg_data) ((amg_data)->reuse_num_nonzeros)
+#define hypre_ParAMGDataSetupReused(amg_data) ((amg_data)->setup_reused)
+#define hypre_ParAMGDataSetupTimes(amg_data) ((amg_data)->setup_times)
+#define hypre_ParAMGDataProfile(amg_data) ((amg_data)->profile)
+#define hypre_ParAMGDataProfileNumLevels(amg_data) ((amg_data)->profile_num_levels)
+#define hypre_ParAMGDataProfileData(amg_data) ((amg_data)->profile_data)
 #define hypre_ParAMGDataSmoothType(amg_data) ((amg_data)->smooth_type)
 #define hypre_ParAMGDataSmoothNumLevels(amg_data) \
 ((amg_data)->smooth_num_levels)
@@ -390,11 +468,18 @@ typedef struct
 #define hypre_ParAMGDataChebyOrder(amg_data) ((amg_data)->cheby_order)
 #define hypre_ParAMGDataChebyFraction(amg_data) ((amg_data)->cheby_fraction)
 #define hypre_ParAMGDataChebyEigEst(amg_data) ((amg_data)->cheby_eig_est)
+#define hypre_ParAMGDataChebyEigReuse(amg_data) ((amg_data)->cheby_eig_reuse)
+#define hypre_ParAMGDataChebyEigAge(amg_data) ((amg_data)->cheby_eig_age)
 #define hypre_ParAMGDataChebyVariant(amg_data) ((amg_data)->cheby_variant)
 #define hypre_ParAMGDataChebyScale(amg_data) ((amg_data)->cheby_scale)
 #define hypre_ParAMGDataChebyDS(amg_data) ((amg_data)->cheby_ds)
 #define hypre_ParAMGDataChebyCoefs(amg_data) ((amg_data)->cheby_coefs)
 
+/* multicolor Gauss-Seidel */
+#define hypre_ParAMGDataMCNumColors(amg_data) ((amg_data)->mc_num_colors)
+#define hypre_ParAMGDataMCColorStarts(amg_data) ((amg_data)->mc_color_starts)
+#define hypre_ParAMGDataMCColorRows(amg_data) ((amg_data)->mc_color_rows)
+
 /* block */
 #define hypre_ParAMGDataABlockArray(amg_data) ((amg_data)->A_block_array)
 #define hypre_ParAMGDataPBlockArray(amg_data) ((amg_data)->P_block_array)
@@ -456,6 +541,7 @@ typedef struct
 #define hypre_ParAMGDataFCoarse(amg_data) ((amg_data)->f_coarse)
 #define hypre_ParAMGDataUCoarse(amg_data) ((amg_data)->u_coarse)
 #define hypre_ParAMGDataNewComm(amg_data) ((amg_data)->new_comm)
+#define hypre_ParAMGDataRedistComm(amg_data) ((amg_data)->redist_comm)
 #define hypre_ParAMGDataRedundant(amg_data) ((amg_data)->redundant)
 #define hypre_ParAMGDataParticipate(amg_data) ((amg_data)->participate)
 
@@ -530,6 +616,7 @@ HYPRE_Int hypre_ADSSetMaxIter ( void *solver , HYPRE_Int maxit );
 HYPRE_Int hypre_ADSSetTol ( void *solver , HYPRE_Real tol );
 HYPRE_Int hypre_ADSSetCycleType ( void *solver , HYPRE_Int cycle_type );
 HYPRE_Int hypre_ADSSetPrintLevel ( void *solver , HYPRE_Int print_level );
+HYPRE_Int hypre_ADSSetConcurrentSolve ( void *solver , HYPRE_Int concurrent_solve );
 HYPRE_Int hypre_ADSSetSmoothingOptions ( void *solver , HYPRE_Int A_relax_type , HYPRE_Int A_relax_times , HYPRE_Real A_relax_weight , HYPRE_Real A_omega );
 HYPRE_Int hypre_ADSSetChebySmoothingOptions ( void *solver , HYPRE_Int A_cheby_order , HYPRE_Int A_cheby_fraction );
 HYPRE_Int hypre_ADSSetAMSOptions ( void *solver , HYPRE_Int B_C_cycle_type , HYPRE_Int B_C_coarsen_type , HYPRE_Int B_C_agg_levels , HYPRE_Int B_C_relax_type , HYPRE_Real B_C_theta , HYPRE_Int B_C_interp_type , HYPRE_Int B_C_Pmax );
@@ -651,6 +738,7 @@ HYPRE_Int hypre_AMSSetMaxIter ( void *solver , HYPRE_Int maxit );
 HYPRE_Int hypre_AMSSetTol ( void *solver , HYPRE_Real tol );
 HYPRE_Int hypre_AMSSetCycleType ( void *solver , HYPRE_Int cycle_type );
 HYPRE_Int hypre_AMSSetPrintLevel ( void *solver , HYPRE_Int print_level );
+HYPRE_Int hypre_AMSSetConcurrentSolve ( void *solver , HYPRE_Int concurrent_solve );
 HYPRE_Int hypre_AMSSetSmoothingOptions ( void *solver , HYPRE_Int A_relax_type , HYPRE_Int A_relax_times , HYPRE_Real A_relax_weight , HYPRE_Real A_omega );
 HYPRE_Int hypre_AMSSetChebySmoothingOptions ( void *solver , HYPRE_Int A_cheby_order , HYPRE_Int A_cheby_fraction );
 HYPRE_Int hypre_AMSSetAlphaAMGOptions ( void *solver , HYPRE_Int B_Pi_coarsen_type , HYPRE_Int B_Pi_agg_levels , HYPRE_Int B_Pi_relax_type , HYPRE_Real B_Pi_theta , HYPRE_Int B_Pi_interp_type , HYPRE_Int B_Pi_Pmax );
@@ -662,7 +750,9 @@ HYPRE_Int hypre_AMSComputePixyz ( hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *G
 HYPRE_Int hypre_AMSComputeGPi ( hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *G , hypre_ParVector *Gx , hypre_ParVector *Gy , hypre_ParVector *Gz , HYPRE_Int dim , hypre_ParCSRMatrix **GPi_ptr );
 HYPRE_Int hypre_AMSSetup ( void *solver , hypre_ParCSRMatrix *A , hypre_ParVector *b , hypre_ParVector *x );
 HYPRE_Int hypre_AMSSolve ( void *solver , hypre_ParCSRMatrix *A , hypre_ParVector *b , hypre_ParVector *x );
-HYPRE_Int hypre_ParCSRSubspacePrec ( hypre_ParCSRMatrix *A0 , HYPRE_Int A0_relax_type , HYPRE_Int A0_relax_times , HYPRE_Real *A0_l1_norms , HYPRE_Real A0_relax_weight , HYPRE_Real A0_omega , HYPRE_Real A0_max_eig_est , HYPRE_Real A0_min_eig_est , HYPRE_Int A0_cheby_order , HYPRE_Real A0_cheby_fraction , hypre_ParCSRMatrix **A , HYPRE_Solver *B , HYPRE_PtrToSolverFcn *HB , hypre_ParCSRMatrix **P , hypre_ParVector **r , hypre_ParVector **g , hypre_ParVector *x , hypre_ParVector *y , hypre_ParVector *r0 , hypre_ParVector *g0 , char *cycle , hypre_ParVector *z );
+HYPRE_Int hypre_ParCSRSubspacePrec ( hypre_ParCSRMatrix *A0 , HYPRE_Int A0_relax_type , HYPRE_Int A0_relax_times , HYPRE_Real *A0_l1_norms , HYPRE_Real A0_relax_weight , HYPRE_Real A0_omega , HYPRE_Real A0_max_eig_est , HYPRE_Real A0_min_eig_est , HYPRE_Int A0_cheby_order , HYPRE_Real A0_cheby_fraction , hypre_ParCSRMatrix **A , HYPRE_Solver *B , HYPRE_PtrToSolverFcn *HB , hypre_ParCSRMatrix **P , hypre_ParVector **r , hypre_ParVector **g , hypre_ParVector *x , hypre_ParVector *y , hypre_ParVector *r0 , hypre_ParVector *g0 , char *cycle , hypre_ParVector *z , void *concurrent );
+HYPRE_Int hypre_ParCSRSubspaceConcurrentSetup ( hypre_ParCSRMatrix *A0 , hypre_ParCSRMatrix **A , HYPRE_Solver *B , HYPRE_PtrToSolverFcn *HB , hypre_ParVector **r , char *cycle , void **concurrent_ptr );
+HYPRE_Int hypre_ParCSRSubspaceConcurrentDestroy ( void *concurrent );
 HYPRE_Int hypre_AMSGetNumIterations ( void *solver , HYPRE_Int *num_iterations );
 HYPRE_Int hypre_AMSGetFinalRelativeResidualNorm ( void *solver , HYPRE_Real *rel_resid_norm );
 HYPRE_Int hypre_AMSProjectOutGradients ( void *solver , hypre_ParVector *x );
@@ -723,6 +813,7 @@ HYPRE_Int HYPRE_ADSSetMaxIter ( HYPRE_Solver solver , HYPRE_Int maxit );
 HYPRE_Int HYPRE_ADSSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
 HYPRE_Int HYPRE_ADSSetCycleType ( HYPRE_Solver solver , HYPRE_Int cycle_type );
 HYPRE_Int HYPRE_ADSSetPrintLevel ( HYPRE_Solver solver , HYPRE_Int print_level );
+HYPRE_Int HYPRE_ADSSetConcurrentSolve ( HYPRE_Solver solver , HYPRE_Int concurrent_solve );
 HYPRE_Int HYPRE_ADSSetSmoothingOptions ( HYPRE_Solver solver , HYPRE_Int relax_type , HYPRE_Int relax_times , HYPRE_Real relax_weight , HYPRE_Real omega );
 HYPRE_Int HYPRE_ADSSetChebySmoothingOptions ( HYPRE_Solver solver , HYPRE_Int cheby_order , HYPRE_Int cheby_fraction );
 HYPRE_Int HYPRE_ADSSetAMSOptions ( HYPRE_Solver solver , HYPRE_Int cycle_type , HYPRE_Int coarsen_type , HYPRE_Int agg_levels , HYPRE_Int relax_type , HYPRE_Real strength_threshold , HYPRE_Int interp_type , HYPRE_Int Pmax );
@@ -763,6 +854,7 @@ HYPRE_Int HYPRE_AMSSetMaxIter ( HYPRE_Solver solver , HYPRE_Int maxit );
 HYPRE_Int HYPRE_AMSSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
 HYPRE_Int HYPRE_AMSSetCycleType ( HYPRE_Solver solver , HYPRE_Int cycle_type );
 HYPRE_Int HYPRE_AMSSetPrintLevel ( HYPRE_Solver solver , HYPRE_Int print_level );
+HYPRE_Int HYPRE_AMSSetConcurrentSolve ( HYPRE_Solver solver , HYPRE_Int concurrent_solve );
 HYPRE_Int HYPRE_AMSSetSmoothingOptions ( HYPRE_Solver solver , HYPRE_Int relax_type , HYPRE_Int relax_times , HYPRE_Real relax_weight , HYPRE_Real omega );
 HYPRE_Int HYPRE_AMSSetChebySmoothingOptions ( HYPRE_Solver solver , HYPRE_Int cheby_order , HYPRE_Int cheby_fraction );
 HYPRE_Int HYPRE_AMSSetAlphaAMGOptions ( HYPRE_Solver solver , HYPRE_Int alpha_coarsen_type , HYPRE_Int alpha_agg_levels , HYPRE_Int alpha_relax_type , HYPRE_Real alpha_strength_threshold , HYPRE_Int alpha_interp_type , HYPRE_Int alpha_Pmax );
@@ -805,6 +897,21 @@ HYPRE_Int HYPRE_BoomerAMGSetFilterThresholdR ( HYPRE_Solver solver , HYPRE_Real
 HYPRE_Int HYPRE_BoomerAMGGetFilterThresholdR ( HYPRE_Solver solver , HYPRE_Real *filter_threshold );
 HYPRE_Int HYPRE_BoomerAMGSetGMRESSwitchR ( HYPRE_Solver solver , HYPRE_Int gmres_switch );
 HYPRE_Int HYPRE_BoomerAMGSetSabs ( HYPRE_Solver solver , HYPRE_Int Sabs );
+HYPRE_Int HYPRE_BoomerAMGSetMixedPrecisionLevel ( HYPRE_Solver solver , HYPRE_Int mixed_prec_level );
+HYPRE_Int HYPRE_BoomerAMGGetMixedPrecisionLevel ( HYPRE_Solver solver , HYPRE_Int *mixed_prec_level );
+HYPRE_Int HYPRE_BoomerAMGSetSetupReuse ( HYPRE_Solver solver , HYPRE_Int setup_reuse );
+HYPRE_Int HYPRE_BoomerAMGGetSetupReuse ( HYPRE_Solver solver , HYPRE_Int *setup_reuse );
+HYPRE_Int HYPRE_BoomerAMGSetSetupArena ( HYPRE_Solver solver , HYPRE_Int setup_arena );
+HYPRE_Int HYPRE_BoomerAMGGetSetupArena ( HYPRE_Solver solver , HYPRE_Int *setup_arena );
+HYPRE_Int HYPRE_BoomerAMGSetNodeAwareLevel ( HYPRE_Solver solver , HYPRE_Int node_aware_level );
+HYPRE_Int HYPRE_BoomerAMGGetNodeAwareLevel ( HYPRE_Solver solver , HYPRE_Int *node_aware_level );
+HYPRE_Int HYPRE_BoomerAMGSetNeighborCommLevel ( HYPRE_Solver solver , HYPRE_Int neighbor_comm_level );
+HYPRE_Int HYPRE_BoomerAMGGetNeighborCommLevel ( HYPRE_Solver solver , HYPRE_Int *neighbor_comm_level );
+HYPRE_Int HYPRE_BoomerAMGSetRedistributeThreshold ( HYPRE_Solver solver , HYPRE_Int redist_threshold );
+HYPRE_Int HYPRE_BoomerAMGGetRedistributeThreshold ( HYPRE_Solver solver , HYPRE_Int *redist_threshold );
+HYPRE_Int HYPRE_BoomerAMGSetProfile ( HYPRE_Solver solver , HYPRE_Int profile );
+HYPRE_Int HYPRE_BoomerAMGGetProfile ( HYPRE_Solver solver , HYPRE_Int level , HYPRE_Int phase , HYPRE_Int stat , HYPRE_Real *value );
+HYPRE_Int HYPRE_BoomerAMGPrintProfile ( HYPRE_Solver solver , const char *filename );
 HYPRE_Int HYPRE_BoomerAMGSetMaxRowSum ( HYPRE_Solver solver , HYPRE_Real max_row_sum );
 HYPRE_Int HYPRE_BoomerAMGGetMaxRowSum ( HYPRE_Solver solver , HYPRE_Real *max_row_sum );
 HYPRE_Int HYPRE_BoomerAMGSetTruncFactor ( HYPRE_Solver solver , HYPRE_Real trunc_factor );
@@ -925,6 +1032,7 @@ HYPRE_Int HYPRE_BoomerAMGGetGridHierarchy(HYPRE_Solver solver, HYPRE_Int *cgrid
 HYPRE_Int HYPRE_BoomerAMGSetChebyOrder ( HYPRE_Solver solver , HYPRE_Int order );
 HYPRE_Int HYPRE_BoomerAMGSetChebyFraction ( HYPRE_Solver solver , HYPRE_Real ratio );
 HYPRE_Int HYPRE_BoomerAMGSetChebyEigEst ( HYPRE_Solver solver , HYPRE_Int eig_est );
+HYPRE_Int HYPRE_BoomerAMGSetChebyEigReuse ( HYPRE_Solver solver , HYPRE_Int eig_reuse );
 HYPRE_Int HYPRE_BoomerAMGSetChebyVariant ( HYPRE_Solver solver , HYPRE_Int variant );
 HYPRE_Int HYPRE_BoomerAMGSetChebyScale ( HYPRE_Solver solver , HYPRE_Int scale );
 HYPRE_Int HYPRE_BoomerAMGSetInterpVectors ( HYPRE_Solver solver , HYPRE_Int num_vectors , HYPRE_ParVector *vectors );
@@ -1274,6 +1382,19 @@ HYPRE_Int hypre_BoomerAMGGetStrongThresholdR ( void *data , HYPRE_Real *strong_t
 HYPRE_Int hypre_BoomerAMGSetFilterThresholdR ( void *data , HYPRE_Real filter_threshold );
 HYPRE_Int hypre_BoomerAMGGetFilterThresholdR ( void *data , HYPRE_Real *filter_threshold );
 HYPRE_Int hypre_BoomerAMGSetSabs ( void *data , HYPRE_Int Sabs );
+HYPRE_Int hypre_BoomerAMGSetMixedPrecisionLevel ( void *data , HYPRE_Int mixed_prec_level );
+HYPRE_Int hypre_BoomerAMGGetMixedPrecisionLevel ( void *data , HYPRE_Int *mixed_prec_level );
+HYPRE_Int hypre_BoomerAMGSetSetupReuse ( void *data , HYPRE_Int setup_reuse );
+HYPRE_Int hypre_BoomerAMGGetSetupReuse ( void *data , HYPRE_Int *setup_reuse );
+HYPRE_Int hypre_BoomerAMGSetSetupArena ( void *data , HYPRE_Int setup_arena );
+HYPRE_Int hypre_BoomerAMGGetSetupArena ( void *data , HYPRE_Int *setup_arena );
+HYPRE_Int hypre_BoomerAMGSetNodeAwareLevel ( void *data , HYPRE_Int node_aware_level );
+HYPRE_Int hypre_BoomerAMGGetNodeAwareLevel ( void *data , HYPRE_Int *node_aware_level );
+HYPRE_Int hypre_BoomerAMGSetNeighborCommLevel ( void *data , HYPRE_Int neighbor_comm_level );
+HYPRE_Int hypre_BoomerAMGGetNeighborCommLevel ( void *data , HYPRE_Int *neighbor_comm_level );
+HYPRE_Int hypre_BoomerAMGSetRedistributeThreshold ( void *data , HYPRE_Int redist_threshold );
+HYPRE_Int hypre_BoomerAMGGetRedistributeThreshold ( void *data , HYPRE_Int *redist_threshold );
+HYPRE_Int hypre_BoomerAMGSetProfile ( void *data , HYPRE_Int profile );
 HYPRE_Int hypre_BoomerAMGSetMaxRowSum ( void *data , HYPRE_Real max_row_sum );
 HYPRE_Int hypre_BoomerAMGGetMaxRowSum ( void *data , HYPRE_Real *max_row_sum );
 HYPRE_Int hypre_BoomerAMGSetTruncFactor ( void *data , HYPRE_Real trunc_factor );
@@ -1407,6 +1528,7 @@ HYPRE_Int hypre_BoomerAMGSetEuBJ ( void *data , HYPRE_Int eu_bj );
 HYPRE_Int hypre_BoomerAMGSetChebyOrder ( void *data , HYPRE_Int order );
 HYPRE_Int hypre_BoomerAMGSetChebyFraction ( void *data , HYPRE_Real ratio );
 HYPRE_Int hypre_BoomerAMGSetChebyEigEst ( void *data , HYPRE_Int eig_est );
+HYPRE_Int hypre_BoomerAMGSetChebyEigReuse ( void *data , HYPRE_Int eig_reuse );
 HYPRE_Int hypre_BoomerAMGSetChebyVariant ( void *data , HYPRE_Int variant );
 HYPRE_Int hypre_BoomerAMGSetChebyScale ( void *data , HYPRE_Int scale );
 HYPRE_Int hypre_BoomerAMGSetInterpVectors ( void *solver , HYPRE_Int num_vectors , hypre_ParVector **interp_vectors );
@@ -1438,6 +1560,33 @@ HYPRE_Int hypre_BoomerAMGSetFPoints( void *data, HYPRE_Int isolated, HYPRE_Int n
 /* par_amg_setup.c */
 HYPRE_Int hypre_BoomerAMGSetup ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
 
+/* par_amg_mixed_prec.c */
+HYPRE_Int hypre_BoomerAMGSetupMixedPrecision ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGRestoreDoublePrecision ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGCheckMixedPrecision ( void *amg_vdata );
+
+/* par_amg_resetup.c */
+HYPRE_Int hypre_BoomerAMGResetupSupported ( void *amg_vdata , hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_BoomerAMGResetupInitialize ( void *amg_vdata , hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_BoomerAMGResetupDestroy ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGResetup ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u , HYPRE_Int *done );
+
+/* par_amg_profile.c */
+HYPRE_Int hypre_BoomerAMGProfileInitialize ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGProfileStart ( void *amg_vdata , HYPRE_Real *mark );
+HYPRE_Int hypre_BoomerAMGProfileStop ( void *amg_vdata , HYPRE_Int level , HYPRE_Int phase , HYPRE_Real *mark );
+HYPRE_Int hypre_BoomerAMGGetProfile ( void *data , HYPRE_Int level , HYPRE_Int phase , HYPRE_Int stat , HYPRE_Real *value );
+HYPRE_Int hypre_BoomerAMGPrintProfile ( void *data , const char *filename );
+
+/* par_amg_redistribute.c */
+HYPRE_Solver hypre_BoomerAMGRedistributeSolverCreate ( hypre_ParAMGData *amg_data , HYPRE_Int p_level );
+HYPRE_Int hypre_ParCSRMatrixCreateFromGlobalRows ( MPI_Comm comm , HYPRE_BigInt global_rows , HYPRE_BigInt first_row , HYPRE_Int num_rows , HYPRE_Int *rows_i , HYPRE_BigInt *rows_j , HYPRE_Complex *rows_data , hypre_ParCSRMatrix **A_ptr );
+HYPRE_Int hypre_BoomerAMGRedistributeSetup ( hypre_ParAMGData *amg_data , HYPRE_Int p_level );
+HYPRE_Int hypre_BoomerAMGRedistributeCycle ( hypre_ParAMGData *amg_data , HYPRE_Int p_level , hypre_ParVector **F_array , hypre_ParVector **U_array );
+
+/* par_amg_multi_solve.c */
+HYPRE_Int hypre_BoomerAMGMultiSolve ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
+
 /* par_amg_solve.c */
 HYPRE_Int hypre_BoomerAMGSolve ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
 
@@ -1626,6 +1775,11 @@ HYPRE_Int hypre_LINPACKcgtql1 ( HYPRE_Int *n , HYPRE_Real *d , HYPRE_Real *e , H
 HYPRE_Real hypre_LINPACKcgpthy ( HYPRE_Real *a , HYPRE_Real *b );
 HYPRE_Int hypre_ParCSRRelax_L1_Jacobi ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_points , HYPRE_Real relax_weight , HYPRE_Real *l1_norms , hypre_ParVector *u , hypre_ParVector *Vtemp );
 
+/* par_relax_multicolor.c */
+HYPRE_Int hypre_BoomerAMGRelaxMulticolorSetup ( hypre_ParCSRMatrix *A , HYPRE_Int *num_colors_ptr , HYPRE_Int **color_starts_ptr , HYPRE_Int **color_rows_ptr );
+HYPRE_Int hypre_BoomerAMGRelaxMulticolor ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_points , HYPRE_Int direction , HYPRE_Real relax_weight , HYPRE_Int num_colors , HYPRE_Int *color_starts , HYPRE_Int *color_rows , hypre_ParVector *u );
+HYPRE_Int hypre_BoomerAMGRelaxMulticolorIF ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_order , HYPRE_Int cycle_type , HYPRE_Real relax_weight , HYPRE_Int num_colors , HYPRE_Int *color_starts , HYPRE_Int *color_rows , hypre_ParVector *u );
+
 /* par_rotate_7pt.c */
 HYPRE_ParCSRMatrix GenerateRotate7pt ( MPI_Comm comm , HYPRE_BigInt nx , HYPRE_BigInt ny , HYPRE_Int P , HYPRE_Int Q , HYPRE_Int p , HYPRE_Int q , HYPRE_Real alpha , HYPRE_Real eps );
 
@@ -1652,6 +1806,7 @@ HYPRE_Int hypre_SchwarzSetDofFunc ( void *data , HYPRE_Int *dof_func );
 /* par_stats.c */
 HYPRE_Int hypre_BoomerAMGSetupStats ( void *amg_vdata , hypre_ParCSRMatrix *A );
 HYPRE_Int hypre_BoomerAMGWriteSolverParams ( void *data );
+HYPRE_Int hypre_BoomerAMGSetupTimesPrint ( void *amg_vdata , MPI_Comm comm );
 
 /* par_strength.c */
 HYPRE_Int hypre_BoomerAMGCreateS ( hypre_ParCSRMatrix *A , HYPRE_Real strength_threshold , HYPRE_Real max_row_sum , HYPRE_Int num_functions , HYPRE_Int *dof_func , hypre_ParCSRMatrix **S_ptr );
@@ -1715,6 +1870,9 @@ HYPRE_Int hypre_ParKrylovMatvec ( void *matvec_data , HYPRE_Complex alpha , void
 HYPRE_Int hypre_ParKrylovMatvecT ( void *matvec_data , HYPRE_Complex alpha , void *A , void *x , HYPRE_Complex beta , void *y );
 HYPRE_Int hypre_ParKrylovMatvecDestroy ( void *matvec_data );
 HYPRE_Real hypre_ParKrylovInnerProd ( void *x , void *y );
+HYPRE_Int hypre_ParKrylovInnerProdsStart ( HYPRE_Int num , void **x , void **y , HYPRE_Real *result , void **request_ptr );
+HYPRE_Int hypre_ParKrylovInnerProdsFinish ( void *request_vdata );
+HYPRE_Int hypre_ParKrylovBlockInnerProd ( HYPRE_Int nx , void **x , HYPRE_Int ny , void **y , HYPRE_Real *result );
 HYPRE_Int hypre_ParKrylovMassInnerProd ( void *x , void **y, HYPRE_Int k, HYPRE_Int unroll, void *result );
 HYPRE_Int hypre_ParKrylovMassDotpTwo ( void *x , void *y , void **z, HYPRE_Int k, HYPRE_Int unroll, void *result_x, void *result_y );
 HYPRE_Int hypre_ParKrylovMassAxpy( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k, HYPRE_Int unroll);
@@ -1853,6 +2011,10 @@ HYPRE_Int hypre_ILUSolve( void *ilu_vdata, hypre_ParCSRMatrix *A, hypre_ParVecto
 HYPRE_Int hypre_ILUSetPrintLevel( void *ilu_vdata, HYPRE_Int print_level );
 HYPRE_Int hypre_ILUSetLogging( void *ilu_vdata, HYPRE_Int logging );
 HYPRE_Int hypre_ILUSetLocalReordering( void *ilu_vdata, HYPRE_Int ordering_type );
+HYPRE_Int hypre_ILUSetTriSolve( void *ilu_vdata, HYPRE_Int tri_solve );
+HYPRE_Int hypre_ILUSetLowerJacobiIters( void *ilu_vdata, HYPRE_Int lower_jacobi_iters );
+HYPRE_Int hypre_ILUSetUpperJacobiIters( void *ilu_vdata, HYPRE_Int upper_jacobi_iters );
+HYPRE_Int hypre_ILUSetIterativeSetupSweeps( void *ilu_vdata, HYPRE_Int iter_setup_sweeps );
 HYPRE_Int hypre_ILUSetSchurSolverKDIM( void *ilu_vdata, HYPRE_Int ss_kDim );
 HYPRE_Int hypre_ILUSetSchurSolverMaxIter( void *ilu_vdata, HYPRE_Int ss_max_iter );
 HYPRE_Int hypre_ILUSetSchurSolverTol( void *ilu_vdata, HYPRE_Real ss_tol );
@@ -1890,6 +2052,8 @@ HYPRE_Int hypre_ILUGetInteriorExteriorPerm(hypre_ParCSRMatrix *A, HYPRE_Int **pe
 HYPRE_Int hypre_ILUGetLocalPerm(hypre_ParCSRMatrix *A, HYPRE_Int **perm, HYPRE_Int *nLU, HYPRE_Int reordering_type);
 HYPRE_Int hypre_ILUWriteSolverParams(void *ilu_vdata);
 HYPRE_Int hypre_ILUBuildRASExternalMatrix(hypre_ParCSRMatrix *A, HYPRE_Int *rperm, HYPRE_Int **E_i, HYPRE_Int **E_j, HYPRE_Real **E_data);
+HYPRE_Int hypre_ILUSetupLevelSchedule(hypre_CSRMatrix *T, HYPRE_Real *D, HYPRE_Int lower, HYPRE_Int *num_levels_ptr, HYPRE_Int **level_starts_ptr, HYPRE_Int **level_rows_ptr, hypre_CSRMatrix **T_lvl_ptr, HYPRE_Real **D_lvl_ptr);
+HYPRE_Int hypre_ILUSetupIterative(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int *perm, HYPRE_Int num_sweeps, hypre_ParCSRMatrix **Lptr, HYPRE_Real **Dptr, hypre_ParCSRMatrix **Uptr);
 HYPRE_Int hypre_ILUSetupILU0(hypre_ParCSRMatrix *A, HYPRE_Int *perm, HYPRE_Int *qperm, HYPRE_Int nLU, HYPRE_Int nI, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr, hypre_ParCSRMatrix **Sptr, HYPRE_Int **u_end);
 HYPRE_Int hypre_ILUSetupILUK(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int *perm, HYPRE_Int *qperm, HYPRE_Int nLU, HYPRE_Int nI, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr, hypre_ParCSRMatrix **Sptr, HYPRE_Int **u_end);
 HYPRE_Int hypre_ILUSetupILUKSymbolic(HYPRE_Int n, HYPRE_Int *A_diag_i, HYPRE_Int *A_diag_j, HYPRE_Int lfil, HYPRE_Int *perm, HYPRE_Int *rperm, HYPRE_Int *iw, HYPRE_Int nLU, HYPRE_Int *L_diag_i, HYPRE_Int *U_diag_i, HYPRE_Int *S_diag_i, HYPRE_Int **L_diag_j, HYPRE_Int **U_diag_j, HYPRE_Int **S_diag_j, HYPRE_Int **u_end);
@@ -1902,6 +2066,9 @@ HYPRE_Int hypre_ILUSolveLU(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParV
 HYPRE_Int hypre_ILUSolveSchurGMRES(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int *qperm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParCSRMatrix *S, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Solver schur_solver, HYPRE_Solver schur_precond, hypre_ParVector *rhs, hypre_ParVector *x, HYPRE_Int *u_end);
 HYPRE_Int hypre_ILUSolveSchurNSH(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParCSRMatrix *S, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Solver schur_solver, hypre_ParVector *rhs, hypre_ParVector *x, HYPRE_Int *u_end);
 HYPRE_Int hypre_ILUSolveLURAS(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Real *fext, HYPRE_Real *uext);
+HYPRE_Int hypre_ILUSolveLevelSchedule(HYPRE_Int num_levels, HYPRE_Int *level_starts, HYPRE_Int *level_rows, hypre_CSRMatrix *T_lvl, HYPRE_Real *D_lvl, HYPRE_Real *w);
+HYPRE_Int hypre_ILUSolveLULevelSchedule(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int L_num_levels, HYPRE_Int *L_level_starts, HYPRE_Int *L_level_rows, hypre_CSRMatrix *L_lvl, HYPRE_Int U_num_levels, HYPRE_Int *U_level_starts, HYPRE_Int *U_level_rows, hypre_CSRMatrix *U_lvl, HYPRE_Real *D_lvl, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Real *fext, HYPRE_Real *uext, HYPRE_Real *w);
+HYPRE_Int hypre_ILUSolveLUIter(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Real *fext, HYPRE_Real *uext, HYPRE_Int lower_iters, HYPRE_Int upper_iters, HYPRE_Real *work);
 HYPRE_Int hypre_ILUSetSchurNSHDropThreshold( void *ilu_vdata, HYPRE_Real threshold);
 HYPRE_Int hypre_ILUSetSchurNSHDropThresholdArray( void *ilu_vdata, HYPRE_Real *threshold);
 HYPRE_Int hypre_ILULocalRCM( hypre_CSRMatrix *A, HYPRE_Int start, HYPRE_Int end, HYPRE_Int **permp, HYPRE_Int **qpermp, HYPRE_Int sym);
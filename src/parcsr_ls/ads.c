@@ -28,6 +28,7 @@ void * hypre_ADSCreate()
    ads_data -> tol = 1e-6;             /* convergence tolerance */
    ads_data -> print_level = 1;        /* print residual norm at each step */
    ads_data -> cycle_type = 1;         /* a 3-level multiplicative solver */
+   ads_data -> concurrent_solve = 0;   /* sequential subspace corrections */
    ads_data -> A_relax_type = 2;       /* offd-l1-scaled GS */
    ads_data -> A_relax_times = 1;      /* one relaxation sweep */
    ads_data -> A_relax_weight = 1.0;   /* damping parameter */
@@ -79,6 +80,8 @@ void * hypre_ADSCreate()
    ads_data -> r2  = NULL;
    ads_data -> g2  = NULL;
 
+   ads_data -> concurrent_data = NULL;
+
    ads_data -> A_l1_norms = NULL;
    ads_data -> A_max_eig_est = 0;
    ads_data -> A_min_eig_est = 0;
@@ -155,6 +158,8 @@ HYPRE_Int hypre_ADSDestroy(void *solver)
 
    hypre_SeqVectorDestroy(ads_data -> A_l1_norms);
 
+   hypre_ParCSRSubspaceConcurrentDestroy(ads_data -> concurrent_data);
+
    /* C, G, x, y and z are not destroyed */
 
    if (ads_data)
@@ -346,6 +351,22 @@ HYPRE_Int hypre_ADSSetPrintLevel(void *solver,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ADSSetConcurrentSolve
+ *
+ * Solve the subspace problems of the additive cycles concurrently on
+ * separate groups of processors (1) instead of one after the other on all
+ * processors (0). The default is 0.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_ADSSetConcurrentSolve(void *solver,
+                                      HYPRE_Int concurrent_solve)
+{
+   hypre_ADSData *ads_data = (hypre_ADSData *) solver;
+   ads_data -> concurrent_solve = concurrent_solve;
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ADSSetSmoothingOptions
  *
@@ -892,6 +913,11 @@ HYPRE_Int hypre_ADSSetup(void *solver,
 
    ads_data -> A = A;
 
+   /* The concurrent subspace solvers of a previous setup belong to the old
+      subspace matrices; they are built again in the next solve */
+   hypre_ParCSRSubspaceConcurrentDestroy(ads_data -> concurrent_data);
+   ads_data -> concurrent_data = NULL;
+
    /* Make sure that the first entry in each row is the diagonal one. */
    /* hypre_CSRMatrixReorder(hypre_ParCSRMatrixDiag(ads_data -> A)); */
 
@@ -1292,6 +1318,11 @@ HYPRE_Int hypre_ADSSolve(void *solver,
          break;
    }
 
+   /* the concurrent subspace solvers are set up in the first solve */
+   if (ads_data -> concurrent_solve && !ads_data -> concurrent_data)
+      hypre_ParCSRSubspaceConcurrentSetup(ads_data -> A, Ai, Bi, HBi, ri, cycle,
+                                          (void **) &ads_data -> concurrent_data);
+
    for (i = 0; i < ads_data -> maxit; i++)
    {
       /* Compute initial residual norms */
@@ -1332,7 +1363,8 @@ HYPRE_Int hypre_ADSSolve(void *solver,
                                ads_data -> r0,
                                ads_data -> g0,
                                cycle,
-                               z);
+                               z,
+                               ads_data -> concurrent_data);
 
       /* Compute new residual norms */
       if (ads_data -> maxit > 1)
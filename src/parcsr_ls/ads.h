@@ -53,6 +53,10 @@ typedef struct
    HYPRE_Int cycle_type;
    HYPRE_Int print_level;
 
+   /* Solve the additive subspace corrections concurrently? */
+   HYPRE_Int concurrent_solve;
+   hypre_ParCSRSubspaceConcurrentData *concurrent_data;
+
    /* Smoothing options for A */
    HYPRE_Int A_relax_type;
    HYPRE_Int A_relax_times;
@@ -115,6 +119,7 @@ typedef struct
 #define hypre_ADSDataTol(ads_data) ((ads_data)->tol)
 #define hypre_ADSDataCycleType(ads_data) ((ads_data)->cycle_type)
 #define hypre_ADSDataPrintLevel(ads_data) ((ads_data)->print_level)
+#define hypre_ADSDataConcurrentSolve(ads_data) ((ads_data)->concurrent_solve)
 
 /* Smoothing options */
 #define hypre_ADSDataARelaxType(ads_data) ((ads_data)->A_relax_type)
@@ -546,6 +546,8 @@ HYPRE_Int hypre_ParCSRMatrixFixZeroRows(hypre_ParCSRMatrix *A)
                A_offd_data[j] = 0.0;
       }
    }
+   hypre_CSRMatrixValuesChanged(A_diag);
+   hypre_CSRMatrixValuesChanged(A_offd);
 
    return hypre_error_flag;
 }
@@ -843,6 +845,7 @@ void * hypre_AMSCreate()
    ams_data -> tol = 1e-6;             /* convergence tolerance */
    ams_data -> print_level = 1;        /* print residual norm at each step */
    ams_data -> cycle_type = 1;         /* a 3-level multiplicative solver */
+   ams_data -> concurrent_solve = 0;   /* sequential subspace corrections */
    ams_data -> A_relax_type = 2;       /* offd-l1-scaled GS */
    ams_data -> A_relax_times = 1;      /* one relaxation sweep */
    ams_data -> A_relax_weight = 1.0;   /* damping parameter */
@@ -907,6 +910,8 @@ void * hypre_AMSCreate()
    ams_data -> B_G0                 = 0;
    ams_data -> projection_frequency = 5;
 
+   ams_data -> concurrent_data = NULL;
+
    ams_data -> A_l1_norms = NULL;
    ams_data -> A_max_eig_est = 0;
    ams_data -> A_min_eig_est = 0;
@@ -993,6 +998,8 @@ HYPRE_Int hypre_AMSDestroy(void *solver)
 
    hypre_SeqVectorDestroy(ams_data -> A_l1_norms);
 
+   hypre_ParCSRSubspaceConcurrentDestroy(ams_data -> concurrent_data);
+
    /* G, x, y ,z, Gx, Gy and Gz are not destroyed */
 
    if (ams_data)
@@ -1294,6 +1301,22 @@ HYPRE_Int hypre_AMSSetPrintLevel(void *solver,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_AMSSetConcurrentSolve
+ *
+ * Solve the subspace problems of the additive cycles concurrently on
+ * separate groups of processors (1) instead of one after the other on all
+ * processors (0). The default is 0.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_AMSSetConcurrentSolve(void *solver,
+                                      HYPRE_Int concurrent_solve)
+{
+   hypre_AMSData *ams_data = (hypre_AMSData *) solver;
+   ams_data -> concurrent_solve = concurrent_solve;
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_AMSSetSmoothingOptions
  *
@@ -2024,6 +2047,11 @@ HYPRE_Int hypre_AMSSetup(void *solver,
 
    ams_data -> A = A;
 
+   /* The concurrent subspace solvers of a previous setup belong to the old
+      subspace matrices; they are built again in the next solve */
+   hypre_ParCSRSubspaceConcurrentDestroy(ams_data -> concurrent_data);
+   ams_data -> concurrent_data = NULL;
+
    /* Modifications for problems with zero-conductivity regions */
    if (ams_data -> interior_nodes)
    {
@@ -2809,6 +2837,11 @@ HYPRE_Int hypre_AMSSolve(void *solver,
       }
    }
 
+   /* the concurrent subspace solvers are set up in the first solve */
+   if (ams_data -> concurrent_solve && !ams_data -> concurrent_data)
+      hypre_ParCSRSubspaceConcurrentSetup(ams_data -> A, Ai, Bi, HBi, ri, cycle,
+                                          (void **) &ams_data -> concurrent_data);
+
    for (i = 0; i < ams_data -> maxit; i++)
    {
       /* Compute initial residual norms */
@@ -2849,7 +2882,8 @@ HYPRE_Int hypre_AMSSolve(void *solver,
                                ams_data -> r0,
                                ams_data -> g0,
                                cycle,
-                               z);
+                               z,
+                               ams_data -> concurrent_data);
 
       /* Compute new residual norms */
       if (ams_data -> maxit > 1)
@@ -2890,6 +2924,367 @@ HYPRE_Int hypre_AMSSolve(void *solver,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRSubspaceConcurrentSetup
+ *
+ * Set up the concurrent corrections of the first run of additive subspace
+ * corrections ("+i+j...") in the cycle with at least two subspaces that are
+ * solved by BoomerAMG.  The processors are split into one contiguous group
+ * per subspace; processor p of the group of subspace i receives the rows of
+ * A[i] of a contiguous range of processors, so the global numbering of the
+ * rows is kept.  Each group sets up a BoomerAMG solver with the parameters
+ * of B[i] on its copy of A[i].  Returns NULL in concurrent_ptr if there is
+ * no such run or fewer processors than subspaces (collective over the
+ * communicator of A0).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_ParCSRSubspaceConcurrentSetup(hypre_ParCSRMatrix *A0,
+                                              hypre_ParCSRMatrix **A,
+                                              HYPRE_Solver *B,
+                                              HYPRE_PtrToSolverFcn *HB,
+                                              hypre_ParVector **r,
+                                              char *cycle,
+                                              void **concurrent_ptr)
+{
+   MPI_Comm comm = hypre_ParCSRMatrixComm(A0);
+   hypre_ParCSRSubspaceConcurrentData *data;
+
+   HYPRE_Int num_procs, my_id, num_groups = 0, my_group;
+   HYPRE_Int subspaces[5], group_starts[6];
+   HYPRE_Int i, j, k, s, cnt, group_size;
+   char *op;
+
+   /* rows sent to each group and received from the processors of mine */
+   HYPRE_BigInt send_info[5][3], *recv_info;
+   HYPRE_Int *row_sizes[5], num_nonzeros[5];
+   HYPRE_BigInt *big_j[5];
+   HYPRE_Complex *big_data[5];
+   HYPRE_Int num_recvs, *recv_procs, red_rows, red_nnz, *red_i;
+   HYPRE_BigInt *red_j, *vec_starts;
+   HYPRE_Complex *red_data;
+   HYPRE_Int num_starts, dim;
+   hypre_MPI_Request *requests;
+
+   *concurrent_ptr = NULL;
+
+   /* the first run with at least two AMG subspaces */
+   op = cycle;
+   while (*op != '\0' && num_groups < 2)
+   {
+      num_groups = 0;
+      for ( ; op[0] == '+' && op[1] >= '1' && op[1] <= '5'; op += 2)
+      {
+         i = op[1] - '1';
+         if (A[i] && B[i] &&
+             (HB[i] == (HYPRE_PtrToSolverFcn) hypre_BoomerAMGSolve ||
+              HB[i] == (HYPRE_PtrToSolverFcn) hypre_BoomerAMGBlockSolve))
+         {
+            subspaces[num_groups++] = i;
+         }
+      }
+      if (*op != '\0')
+         op++;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   if (num_groups < 2 || num_procs < num_groups)
+      return hypre_error_flag;
+
+   data = hypre_CTAlloc(hypre_ParCSRSubspaceConcurrentData, 1, HYPRE_MEMORY_HOST);
+   data -> num_groups = num_groups;
+   for (s = 0; s < num_groups; s++)
+      data -> subspaces[s] = subspaces[s];
+
+   /* contiguous groups of processors */
+   for (s = 0; s <= num_groups; s++)
+      group_starts[s] = (HYPRE_Int) (((HYPRE_BigInt) s * num_procs) / num_groups);
+   for (my_group = 0; group_starts[my_group+1] <= my_id; my_group++);
+   data -> my_group = my_group;
+   hypre_MPI_Comm_split(comm, my_group, my_id, &data -> group_comm);
+
+   /* receiving processor in each group and the processors received from */
+   for (s = 0; s < num_groups; s++)
+   {
+      group_size = group_starts[s+1] - group_starts[s];
+      data -> send_procs[s] = group_starts[s] +
+         (HYPRE_Int) (((HYPRE_BigInt) my_id * group_size) / num_procs);
+   }
+   group_size = group_starts[my_group+1] - group_starts[my_group];
+   num_recvs = 0;
+   for (k = 0; k < num_procs; k++)
+      if (group_starts[my_group] + (HYPRE_Int) (((HYPRE_BigInt) k * group_size) / num_procs) == my_id)
+         num_recvs++;
+   recv_procs = hypre_CTAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   num_recvs = 0;
+   for (k = 0; k < num_procs; k++)
+      if (group_starts[my_group] + (HYPRE_Int) (((HYPRE_BigInt) k * group_size) / num_procs) == my_id)
+         recv_procs[num_recvs++] = k;
+   data -> num_recvs  = num_recvs;
+   data -> recv_procs = recv_procs;
+
+   /*-----------------------------------------------------------------------
+    * Local rows of the subspace matrices, with global column indices (diag
+    * part first, so that the diagonal stays the first entry of each row)
+    *-----------------------------------------------------------------------*/
+
+   for (s = 0; s < num_groups; s++)
+   {
+      hypre_ParCSRMatrix *As = A[subspaces[s]];
+      hypre_CSRMatrix *As_diag = hypre_ParCSRMatrixDiag(As);
+      hypre_CSRMatrix *As_offd = hypre_ParCSRMatrixOffd(As);
+      HYPRE_Int *As_diag_i = hypre_CSRMatrixI(As_diag);
+      HYPRE_Int *As_diag_j = hypre_CSRMatrixJ(As_diag);
+      HYPRE_Complex *As_diag_data = hypre_CSRMatrixData(As_diag);
+      HYPRE_Int *As_offd_i = hypre_CSRMatrixI(As_offd);
+      HYPRE_Int *As_offd_j = hypre_CSRMatrixJ(As_offd);
+      HYPRE_Complex *As_offd_data = hypre_CSRMatrixData(As_offd);
+      HYPRE_BigInt *col_map_offd = hypre_ParCSRMatrixColMapOffd(As);
+      HYPRE_BigInt first_row = hypre_ParCSRMatrixFirstRowIndex(As);
+      HYPRE_Int num_rows = hypre_CSRMatrixNumRows(As_diag);
+
+      num_nonzeros[s] = As_diag_i[num_rows] + As_offd_i[num_rows];
+      row_sizes[s] = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+      big_j[s]     = hypre_CTAlloc(HYPRE_BigInt, num_nonzeros[s], HYPRE_MEMORY_HOST);
+      big_data[s]  = hypre_CTAlloc(HYPRE_Complex, num_nonzeros[s], HYPRE_MEMORY_HOST);
+      cnt = 0;
+      for (i = 0; i < num_rows; i++)
+      {
+         row_sizes[s][i] = As_diag_i[i+1] - As_diag_i[i] + As_offd_i[i+1] - As_offd_i[i];
+         for (j = As_diag_i[i]; j < As_diag_i[i+1]; j++)
+         {
+            big_j[s][cnt]      = first_row + (HYPRE_BigInt) As_diag_j[j];
+            big_data[s][cnt++] = As_diag_data[j];
+         }
+         for (j = As_offd_i[i]; j < As_offd_i[i+1]; j++)
+         {
+            big_j[s][cnt]      = col_map_offd[As_offd_j[j]];
+            big_data[s][cnt++] = As_offd_data[j];
+         }
+      }
+
+      send_info[s][0] = first_row;
+      send_info[s][1] = (HYPRE_BigInt) num_rows;
+      send_info[s][2] = (HYPRE_BigInt) num_nonzeros[s];
+   }
+
+   /* first rows and sizes of the received rows */
+   recv_info = hypre_CTAlloc(HYPRE_BigInt, 3*num_recvs, HYPRE_MEMORY_HOST);
+   requests  = hypre_CTAlloc(hypre_MPI_Request, 3*(num_groups + num_recvs), HYPRE_MEMORY_HOST);
+   cnt = 0;
+   for (k = 0; k < num_recvs; k++)
+      hypre_MPI_Irecv(&recv_info[3*k], 3, HYPRE_MPI_BIG_INT, recv_procs[k], 250, comm,
+                      &requests[cnt++]);
+   for (s = 0; s < num_groups; s++)
+      hypre_MPI_Isend(send_info[s], 3, HYPRE_MPI_BIG_INT, data -> send_procs[s], 250, comm,
+                      &requests[cnt++]);
+   hypre_MPI_Waitall(cnt, requests, hypre_MPI_STATUSES_IGNORE);
+
+   red_rows = 0;
+   red_nnz  = 0;
+   data -> recv_starts = hypre_CTAlloc(HYPRE_Int, num_recvs + 1, HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_recvs; k++)
+   {
+      red_rows += (HYPRE_Int) recv_info[3*k+1];
+      red_nnz  += (HYPRE_Int) recv_info[3*k+2];
+   }
+   red_i    = hypre_CTAlloc(HYPRE_Int, red_rows + 1, HYPRE_MEMORY_HOST);
+   red_j    = hypre_CTAlloc(HYPRE_BigInt, red_nnz, HYPRE_MEMORY_HOST);
+   red_data = hypre_CTAlloc(HYPRE_Complex, red_nnz, HYPRE_MEMORY_HOST);
+
+   /* the rows */
+   cnt = 0;
+   red_rows = 0;
+   red_nnz  = 0;
+   for (k = 0; k < num_recvs; k++)
+   {
+      HYPRE_Int num_rows = (HYPRE_Int) recv_info[3*k+1];
+      HYPRE_Int nnz      = (HYPRE_Int) recv_info[3*k+2];
+
+      hypre_MPI_Irecv(&red_i[red_rows+1], num_rows, HYPRE_MPI_INT, recv_procs[k], 251, comm,
+                      &requests[cnt++]);
+      hypre_MPI_Irecv(&red_j[red_nnz], nnz, HYPRE_MPI_BIG_INT, recv_procs[k], 252, comm,
+                      &requests[cnt++]);
+      hypre_MPI_Irecv(&red_data[red_nnz], nnz, HYPRE_MPI_COMPLEX, recv_procs[k], 253, comm,
+                      &requests[cnt++]);
+      red_rows += num_rows;
+      red_nnz  += nnz;
+   }
+   for (s = 0; s < num_groups; s++)
+   {
+      hypre_MPI_Isend(row_sizes[s], (HYPRE_Int) send_info[s][1], HYPRE_MPI_INT,
+                      data -> send_procs[s], 251, comm, &requests[cnt++]);
+      hypre_MPI_Isend(big_j[s], num_nonzeros[s], HYPRE_MPI_BIG_INT,
+                      data -> send_procs[s], 252, comm, &requests[cnt++]);
+      hypre_MPI_Isend(big_data[s], num_nonzeros[s], HYPRE_MPI_COMPLEX,
+                      data -> send_procs[s], 253, comm, &requests[cnt++]);
+   }
+   hypre_MPI_Waitall(cnt, requests, hypre_MPI_STATUSES_IGNORE);
+   hypre_TFree(requests, HYPRE_MEMORY_HOST);
+
+   for (s = 0; s < num_groups; s++)
+   {
+      hypre_TFree(row_sizes[s], HYPRE_MEMORY_HOST);
+      hypre_TFree(big_j[s], HYPRE_MEMORY_HOST);
+      hypre_TFree(big_data[s], HYPRE_MEMORY_HOST);
+   }
+   for (i = 0; i < red_rows; i++)
+      red_i[i+1] += red_i[i];
+
+   /*-----------------------------------------------------------------------
+    * Subspace matrix, vectors and AMG solver on the group
+    *-----------------------------------------------------------------------*/
+
+   i = subspaces[my_group];
+   hypre_ParCSRMatrixCreateFromGlobalRows(data -> group_comm,
+                                          hypre_ParCSRMatrixGlobalNumRows(A[i]),
+                                          recv_info[0], red_rows,
+                                          red_i, red_j, red_data, &data -> A_red);
+   hypre_TFree(red_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(red_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(red_data, HYPRE_MEMORY_HOST);
+
+   /* the subspace vectors may be block vectors with dim entries per row */
+   dim = (HYPRE_Int) (hypre_ParVectorGlobalSize(r[i]) / hypre_ParCSRMatrixGlobalNumRows(A[i]));
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+   num_starts = 2;
+#else
+   num_starts = group_size + 1;
+#endif
+   vec_starts = hypre_CTAlloc(HYPRE_BigInt, num_starts, HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_starts; k++)
+      vec_starts[k] = dim * hypre_ParCSRMatrixRowStarts(data -> A_red)[k];
+   data -> r_red = hypre_ParVectorCreate(data -> group_comm, hypre_ParVectorGlobalSize(r[i]),
+                                         vec_starts);
+   data -> g_red = hypre_ParVectorCreate(data -> group_comm, hypre_ParVectorGlobalSize(r[i]),
+                                         vec_starts);
+   hypre_ParVectorSetPartitioningOwner(data -> g_red, 0);
+   hypre_ParVectorInitialize(data -> r_red);
+   hypre_ParVectorInitialize(data -> g_red);
+
+   for (k = 0; k < num_recvs; k++)
+      data -> recv_starts[k+1] = data -> recv_starts[k] + dim * (HYPRE_Int) recv_info[3*k+1];
+   hypre_TFree(recv_info, HYPRE_MEMORY_HOST);
+
+   data -> B_red = hypre_BoomerAMGRedistributeSolverCreate((hypre_ParAMGData *) B[i], 0);
+   hypre_BoomerAMGSetup(data -> B_red, data -> A_red, data -> r_red, data -> g_red);
+
+   /* send buffers for the subspace vectors */
+   for (s = 0; s < num_groups; s++)
+      data -> send_starts[s+1] = data -> send_starts[s] +
+         hypre_VectorSize(hypre_ParVectorLocalVector(r[subspaces[s]]));
+   data -> send_data = hypre_CTAlloc(HYPRE_Real, data -> send_starts[num_groups], HYPRE_MEMORY_HOST);
+
+   *concurrent_ptr = (void *) data;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRSubspaceConcurrentDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int hypre_ParCSRSubspaceConcurrentDestroy(void *concurrent)
+{
+   hypre_ParCSRSubspaceConcurrentData *data =
+      (hypre_ParCSRSubspaceConcurrentData *) concurrent;
+
+   if (!data)
+      return hypre_error_flag;
+
+   HYPRE_BoomerAMGDestroy(data -> B_red);
+   hypre_ParVectorDestroy(data -> g_red);
+   hypre_ParVectorDestroy(data -> r_red);
+   hypre_ParCSRMatrixDestroy(data -> A_red);
+   hypre_MPI_Comm_free(&data -> group_comm);
+   hypre_TFree(data -> recv_procs, HYPRE_MEMORY_HOST);
+   hypre_TFree(data -> recv_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(data -> send_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRSubspaceConcurrentCorrect
+ *
+ * The concurrent part of the additive corrections: y += sum_i P[i] g[i] with
+ * the subspace solves g[i] = B[i]^{-1} P[i]^t r0 of all groups done at the
+ * same time on their processors.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRSubspaceConcurrentCorrect(hypre_ParCSRSubspaceConcurrentData *data,
+                                      MPI_Comm comm,
+                                      HYPRE_PtrToSolverFcn *HB,
+                                      hypre_ParCSRMatrix **P,
+                                      hypre_ParVector **r,
+                                      hypre_ParVector **g,
+                                      hypre_ParVector *y,
+                                      hypre_ParVector *r0,
+                                      hypre_ParVector *g0)
+{
+   HYPRE_Int num_groups = data -> num_groups;
+   HYPRE_Int num_recvs = data -> num_recvs;
+   HYPRE_Int *send_starts = data -> send_starts;
+   HYPRE_Int *recv_starts = data -> recv_starts;
+   HYPRE_Real *send_data = data -> send_data;
+   HYPRE_Real *r_red_data = hypre_VectorData(hypre_ParVectorLocalVector(data -> r_red));
+   HYPRE_Real *g_red_data = hypre_VectorData(hypre_ParVectorLocalVector(data -> g_red));
+   HYPRE_Real *r_data, *g_data;
+   hypre_MPI_Request *requests;
+   HYPRE_Int i, j, k, s, cnt;
+
+   requests = hypre_CTAlloc(hypre_MPI_Request, num_groups + num_recvs, HYPRE_MEMORY_HOST);
+
+   /* restrict the residual to the subspaces and send it to the groups */
+   cnt = 0;
+   for (k = 0; k < num_recvs; k++)
+      hypre_MPI_Irecv(&r_red_data[recv_starts[k]], recv_starts[k+1] - recv_starts[k],
+                      HYPRE_MPI_REAL, data -> recv_procs[k], 254, comm, &requests[cnt++]);
+   for (s = 0; s < num_groups; s++)
+   {
+      i = data -> subspaces[s];
+      hypre_ParCSRMatrixMatvecT(1.0, P[i], r0, 0.0, r[i]);
+      r_data = hypre_VectorData(hypre_ParVectorLocalVector(r[i]));
+      for (j = send_starts[s]; j < send_starts[s+1]; j++)
+         send_data[j] = r_data[j - send_starts[s]];
+      hypre_MPI_Isend(&send_data[send_starts[s]], send_starts[s+1] - send_starts[s],
+                      HYPRE_MPI_REAL, data -> send_procs[s], 254, comm, &requests[cnt++]);
+   }
+   hypre_MPI_Waitall(cnt, requests, hypre_MPI_STATUSES_IGNORE);
+
+   /* the subspace solve of this group */
+   i = data -> subspaces[data -> my_group];
+   hypre_ParVectorSetConstantValues(data -> g_red, 0.0);
+   (*HB[i]) (data -> B_red, (HYPRE_Matrix) data -> A_red,
+             (HYPRE_Vector) data -> r_red, (HYPRE_Vector) data -> g_red);
+
+   /* return the subspace corrections and interpolate them */
+   cnt = 0;
+   for (s = 0; s < num_groups; s++)
+      hypre_MPI_Irecv(&send_data[send_starts[s]], send_starts[s+1] - send_starts[s],
+                      HYPRE_MPI_REAL, data -> send_procs[s], 255, comm, &requests[cnt++]);
+   for (k = 0; k < num_recvs; k++)
+      hypre_MPI_Isend(&g_red_data[recv_starts[k]], recv_starts[k+1] - recv_starts[k],
+                      HYPRE_MPI_REAL, data -> recv_procs[k], 255, comm, &requests[cnt++]);
+   hypre_MPI_Waitall(cnt, requests, hypre_MPI_STATUSES_IGNORE);
+   hypre_TFree(requests, HYPRE_MEMORY_HOST);
+
+   for (s = 0; s < num_groups; s++)
+   {
+      i = data -> subspaces[s];
+      g_data = hypre_VectorData(hypre_ParVectorLocalVector(g[i]));
+      for (j = send_starts[s]; j < send_starts[s+1]; j++)
+         g_data[j - send_starts[s]] = send_data[j];
+      hypre_ParCSRMatrixMatvec(1.0, P[i], g[i], 0.0, g0);
+      hypre_ParVectorAxpy(1.0, g0, y);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRSubspacePrec
  *
@@ -2901,6 +3296,10 @@ HYPRE_Int hypre_AMSSolve(void *solver,
  *
  * The default mode is multiplicative, '+' changes the next correction
  * to additive, based on residual computed at '('.
+ *
+ * If concurrent is not NULL, the additive corrections of its subspaces are
+ * done concurrently on separate groups of processors, see
+ * hypre_ParCSRSubspaceConcurrentSetup.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Int hypre_ParCSRSubspacePrec(/* fine space matrix */
@@ -2936,10 +3335,15 @@ HYPRE_Int hypre_ParCSRSubspacePrec(/* fine space matrix */
                                    hypre_ParVector *g0,
                                    char *cycle,
                                    /* temporary vector */
-                                   hypre_ParVector *z)
+                                   hypre_ParVector *z,
+                                   /* concurrent corrections (or NULL) */
+                                   void *concurrent)
 {
+   hypre_ParCSRSubspaceConcurrentData *concurrent_data =
+      (hypre_ParCSRSubspaceConcurrentData *) concurrent;
    char *op;
    HYPRE_Int use_saved_residual = 0;
+   HYPRE_Int concurrent_done = 0, is_concurrent, s;
 
    for (op = cycle; *op != '\0'; op++)
    {
@@ -2957,6 +3361,24 @@ HYPRE_Int hypre_ParCSRSubspacePrec(/* fine space matrix */
       /* switch to additive correction */
       else if (*op == '+')
       {
+         /* the concurrent subspaces are corrected all at once */
+         is_concurrent = 0;
+         if (concurrent_data)
+            for (s = 0; s < concurrent_data -> num_groups; s++)
+               if (op[1] - '1' == concurrent_data -> subspaces[s])
+                  is_concurrent = 1;
+         if (is_concurrent)
+         {
+            if (!concurrent_done)
+            {
+               hypre_ParCSRSubspaceConcurrentCorrect(concurrent_data,
+                                                     hypre_ParCSRMatrixComm(A0),
+                                                     HB, P, r, g, y, r0, g0);
+               concurrent_done = 1;
+            }
+            op++;
+            continue;
+         }
          use_saved_residual = 1;
          continue;
       }
@@ -8,6 +8,40 @@
 #ifndef hypre_AMS_DATA_HEADER
 #define hypre_AMS_DATA_HEADER
 
+/*--------------------------------------------------------------------------
+ * Concurrent additive subspace corrections: each of the subspaces is
+ * redistributed onto its own group of processors, where it is solved at the
+ * same time as the other subspaces
+ *--------------------------------------------------------------------------*/
+typedef struct
+{
+   /* Number of groups and the subspace (index in the cycle minus 1) of each */
+   HYPRE_Int num_groups;
+   HYPRE_Int subspaces[5];
+
+   /* Group of this processor and its communicator */
+   HYPRE_Int my_group;
+   MPI_Comm group_comm;
+
+   /* Processor receiving the local rows of each subspace, and offsets of the
+      local rows of the subspace vectors in send_data */
+   HYPRE_Int send_procs[5];
+   HYPRE_Int send_starts[6];
+   HYPRE_Real *send_data;
+
+   /* Processors whose rows of the subspace of my_group are received, and
+      offsets of their rows in the local part of r_red and g_red */
+   HYPRE_Int num_recvs;
+   HYPRE_Int *recv_procs;
+   HYPRE_Int *recv_starts;
+
+   /* Redistributed subspace matrix, its AMG solver and vectors */
+   hypre_ParCSRMatrix *A_red;
+   HYPRE_Solver B_red;
+   hypre_ParVector *r_red, *g_red;
+
+} hypre_ParCSRSubspaceConcurrentData;
+
 /*--------------------------------------------------------------------------
  * Auxiliary space Maxwell Solver data
  *--------------------------------------------------------------------------*/
@@ -72,6 +106,10 @@ typedef struct
    HYPRE_Int cycle_type;
    HYPRE_Int print_level;
 
+   /* Solve the additive subspace corrections concurrently? */
+   HYPRE_Int concurrent_solve;
+   hypre_ParCSRSubspaceConcurrentData *concurrent_data;
+
    /* Smoothing options for A */
    HYPRE_Int A_relax_type;
    HYPRE_Int A_relax_times;
@@ -145,6 +183,7 @@ typedef struct
 #define hypre_AMSDataTol(ams_data) ((ams_data)->tol)
 #define hypre_AMSDataCycleType(ams_data) ((ams_data)->cycle_type)
 #define hypre_AMSDataPrintLevel(ams_data) ((ams_data)->print_level)
+#define hypre_AMSDataConcurrentSolve(ams_data) ((ams_data)->concurrent_solve)
 
 /* Smoothing and AMG options */
 #define hypre_AMSDataARelaxType(ams_data) ((ams_data)->A_relax_type)
@@ -67,6 +67,9 @@ hypre_BoomerAMGAdditiveCycle( void              *amg_vdata)
    HYPRE_Real     *r_global;
    HYPRE_Real     *relax_weight;
    HYPRE_Real     *omega;
+   HYPRE_Int      *mc_num_colors;
+   HYPRE_Int     **mc_color_starts;
+   HYPRE_Int     **mc_color_rows;
 
 #if 0
    HYPRE_Real   *D_mat;
@@ -99,6 +102,9 @@ hypre_BoomerAMGAdditiveCycle( void              *amg_vdata)
    omega             = hypre_ParAMGDataOmega(amg_data);
    rlx_order         = hypre_ParAMGDataRelaxOrder(amg_data);
    num_grid_sweeps   = hypre_ParAMGDataNumGridSweeps(amg_data);
+   mc_num_colors     = hypre_ParAMGDataMCNumColors(amg_data);
+   mc_color_starts   = hypre_ParAMGDataMCColorStarts(amg_data);
+   mc_color_rows     = hypre_ParAMGDataMCColorRows(amg_data);
 
    /* Initialize */
 
@@ -147,6 +153,18 @@ hypre_BoomerAMGAdditiveCycle( void              *amg_vdata)
             }
          }
 
+         else if (rlx_down >= 40 && rlx_down <= 42)
+         {
+            for (j=0; j < num_grid_sweeps[1]; j++)
+            {
+               hypre_BoomerAMGRelaxMulticolorIF(A_array[fine_grid],F_array[fine_grid],
+                     CF_marker_array[fine_grid], rlx_down,rlx_order,1,
+                   relax_weight[fine_grid], mc_num_colors[fine_grid],
+                   mc_color_starts[fine_grid], mc_color_rows[fine_grid],
+                   U_array[fine_grid]);
+            }
+            hypre_ParVectorCopy(F_array[fine_grid],Vtemp);
+         }
          else if (rlx_down != 18)
          {
             /*hypre_BoomerAMGRelax(A_array[fine_grid],F_array[fine_grid],NULL,rlx_down,0,*/
@@ -244,6 +262,14 @@ hypre_BoomerAMGAdditiveCycle( void              *amg_vdata)
                               l1_norms[fine_grid] ? hypre_VectorData(l1_norms[fine_grid]) : NULL,
                               1.0, 1.0 ,0,0,0,0,
                               U_array[fine_grid], Vtemp, Ztemp);
+         else if (rlx_coarse >= 40 && rlx_coarse <= 42)
+            hypre_BoomerAMGRelaxMulticolorIF(A_array[fine_grid],F_array[fine_grid],
+                                             NULL, rlx_coarse,0,3,
+                                             relax_weight[fine_grid],
+                                             mc_num_colors[fine_grid],
+                                             mc_color_starts[fine_grid],
+                                             mc_color_rows[fine_grid],
+                                             U_array[fine_grid]);
          else
             hypre_BoomerAMGRelaxIF(A_array[fine_grid],F_array[fine_grid],
                                    NULL, rlx_coarse,0,0,
@@ -265,7 +291,17 @@ hypre_BoomerAMGAdditiveCycle( void              *amg_vdata)
          hypre_ParCSRMatrixMatvec(alpha, P_array[fine_grid],
                                      U_array[coarse_grid],
                                      beta, U_array[fine_grid]);
-         if (rlx_up != 18)
+         if (rlx_up >= 40 && rlx_up <= 42)
+            for (j=0; j < num_grid_sweeps[2]; j++)
+              hypre_BoomerAMGRelaxMulticolorIF(A_array[fine_grid],F_array[fine_grid],
+                                               CF_marker_array[fine_grid],
+                                               rlx_up,rlx_order,2,
+                                               relax_weight[fine_grid],
+                                               mc_num_colors[fine_grid],
+                                               mc_color_starts[fine_grid],
+                                               mc_color_rows[fine_grid],
+                                               U_array[fine_grid]);
+         else if (rlx_up != 18)
             /*hypre_BoomerAMGRelax(A_array[fine_grid],F_array[fine_grid],NULL,rlx_up,0,*/
             for (j=0; j < num_grid_sweeps[2]; j++)
               hypre_BoomerAMGRelaxIF(A_array[fine_grid],F_array[fine_grid],
@@ -64,6 +64,12 @@ hypre_BoomerAMGCreate()
    HYPRE_Int    CR_use_CG;
    HYPRE_Int    cgc_its;
    HYPRE_Int    seq_threshold;
+   HYPRE_Int    mixed_prec_level;
+   HYPRE_Int    setup_reuse;
+   HYPRE_Int    setup_arena;
+   HYPRE_Int    node_aware_level;
+   HYPRE_Int    neighbor_comm_level;
+   HYPRE_Int    redist_threshold;
    HYPRE_Int    redundant;
 
    /* solve params */
@@ -99,6 +105,7 @@ hypre_BoomerAMGCreate()
 
    HYPRE_Int cheby_order;
    HYPRE_Int cheby_eig_est;
+   HYPRE_Int cheby_eig_reuse;
    HYPRE_Int cheby_variant;
    HYPRE_Int cheby_scale;
    HYPRE_Real cheby_eig_ratio;
@@ -136,6 +143,12 @@ hypre_BoomerAMGCreate()
    max_coarse_size = 9;
    min_coarse_size = 0;
    seq_threshold = 0;
+   mixed_prec_level = -1;
+   setup_reuse = 0;
+   setup_arena = 0;
+   node_aware_level = -1;
+   neighbor_comm_level = -1;
+   redist_threshold = 0;
    redundant = 0;
    coarsen_cut_factor = 0;
    strong_threshold = 0.25;
@@ -214,6 +227,7 @@ hypre_BoomerAMGCreate()
    cheby_variant = 0;
    cheby_scale = 1;
    cheby_eig_est = 10;
+   cheby_eig_reuse = 0;
    cheby_eig_ratio = .3;
 
    block_mode = 0;
@@ -263,6 +277,12 @@ hypre_BoomerAMGCreate()
    hypre_BoomerAMGSetStrongThresholdR(amg_data, strong_threshold_R);
    hypre_BoomerAMGSetFilterThresholdR(amg_data, filter_threshold_R);
    hypre_BoomerAMGSetSabs(amg_data, Sabs);
+   hypre_BoomerAMGSetMixedPrecisionLevel(amg_data, mixed_prec_level);
+   hypre_BoomerAMGSetSetupReuse(amg_data, setup_reuse);
+   hypre_BoomerAMGSetSetupArena(amg_data, setup_arena);
+   hypre_BoomerAMGSetNodeAwareLevel(amg_data, node_aware_level);
+   hypre_BoomerAMGSetNeighborCommLevel(amg_data, neighbor_comm_level);
+   hypre_BoomerAMGSetRedistributeThreshold(amg_data, redist_threshold);
    hypre_BoomerAMGSetMaxRowSum(amg_data, max_row_sum);
    hypre_BoomerAMGSetTruncFactor(amg_data, trunc_factor);
    hypre_BoomerAMGSetAggTruncFactor(amg_data, agg_trunc_factor);
@@ -329,6 +349,7 @@ hypre_BoomerAMGCreate()
    hypre_BoomerAMGSetChebyOrder(amg_data, cheby_order);
    hypre_BoomerAMGSetChebyFraction(amg_data, cheby_eig_ratio);
    hypre_BoomerAMGSetChebyEigEst(amg_data, cheby_eig_est);
+   hypre_BoomerAMGSetChebyEigReuse(amg_data, cheby_eig_reuse);
    hypre_BoomerAMGSetChebyVariant(amg_data, cheby_variant);
    hypre_BoomerAMGSetChebyScale(amg_data, cheby_scale);
 
@@ -378,6 +399,13 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataPointDofMapArray(amg_data) = NULL;
    hypre_ParAMGDataSmoother(amg_data) = NULL;
    hypre_ParAMGDataL1Norms(amg_data) = NULL;
+   hypre_ParAMGDataAPArray(amg_data) = NULL;
+   hypre_ParAMGDataAPPlanArray(amg_data) = NULL;
+   hypre_ParAMGDataRAPPlanArray(amg_data) = NULL;
+   hypre_ParAMGDataSetupReused(amg_data) = 0;
+   hypre_ParAMGDataProfile(amg_data) = 0;
+   hypre_ParAMGDataProfileNumLevels(amg_data) = 0;
+   hypre_ParAMGDataProfileData(amg_data) = NULL;
 
    hypre_ParAMGDataABlockArray(amg_data) = NULL;
    hypre_ParAMGDataPBlockArray(amg_data) = NULL;
@@ -391,6 +419,12 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataMinEigEst(amg_data) = NULL;
    hypre_ParAMGDataChebyDS(amg_data) = NULL;
    hypre_ParAMGDataChebyCoefs(amg_data) = NULL;
+   hypre_ParAMGDataChebyEigAge(amg_data) = 0;
+
+   /* Stuff for multicolor Gauss-Seidel */
+   hypre_ParAMGDataMCNumColors(amg_data) = NULL;
+   hypre_ParAMGDataMCColorStarts(amg_data) = NULL;
+   hypre_ParAMGDataMCColorRows(amg_data) = NULL;
 
    /* BM Oct 22, 2006 */
    hypre_ParAMGDataPlotGrids(amg_data) = 0;
@@ -421,6 +455,7 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataFCoarse(amg_data) = NULL;
    hypre_ParAMGDataUCoarse(amg_data) = NULL;
    hypre_ParAMGDataNewComm(amg_data) = hypre_MPI_COMM_NULL;
+   hypre_ParAMGDataRedistComm(amg_data) = hypre_MPI_COMM_NULL;
 
    /* for Gaussian elimination coarse grid solve */
    hypre_ParAMGDataGSSetup(amg_data) = 0;
@@ -475,6 +510,7 @@ hypre_BoomerAMGDestroy( void *data )
    HYPRE_Solver *smoother = hypre_ParAMGDataSmoother(amg_data);
    void *amg = hypre_ParAMGDataCoarseSolver(amg_data);
    MPI_Comm new_comm = hypre_ParAMGDataNewComm(amg_data);
+   MPI_Comm redist_comm = hypre_ParAMGDataRedistComm(amg_data);
    HYPRE_Int i;
    HYPRE_Int *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
 
@@ -547,6 +583,9 @@ hypre_BoomerAMGDestroy( void *data )
       hypre_TFree(hypre_ParAMGDataGridRelaxPoints(amg_data), HYPRE_MEMORY_HOST);
       hypre_ParAMGDataGridRelaxPoints(amg_data) = NULL;
    }
+   hypre_BoomerAMGResetupDestroy(amg_data);
+   hypre_BoomerAMGSetProfile(amg_data, 0);
+
    for (i=1; i < num_levels; i++)
    {
       hypre_ParVectorDestroy(hypre_ParAMGDataFArray(amg_data)[i]);
@@ -629,6 +668,18 @@ hypre_BoomerAMGDestroy( void *data )
       hypre_TFree(hypre_ParAMGDataChebyDS(amg_data), HYPRE_MEMORY_HOST);
    }
 
+   if (hypre_ParAMGDataMCNumColors(amg_data))
+   {
+      for (i=0; i < num_levels; i++)
+      {
+         hypre_TFree(hypre_ParAMGDataMCColorStarts(amg_data)[i], HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParAMGDataMCColorRows(amg_data)[i], HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(hypre_ParAMGDataMCNumColors(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataMCColorStarts(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataMCColorRows(amg_data), HYPRE_MEMORY_HOST);
+   }
+
    if (hypre_ParAMGDataDinv(amg_data))
       hypre_TFree(hypre_ParAMGDataDinv(amg_data), HYPRE_MEMORY_HOST);
 
@@ -795,6 +846,10 @@ hypre_BoomerAMGDestroy( void *data )
    {
       hypre_MPI_Comm_free (&new_comm);
    }
+   if (redist_comm != hypre_MPI_COMM_NULL)
+   {
+      hypre_MPI_Comm_free (&redist_comm);
+   }
    hypre_TFree(amg_data, HYPRE_MEMORY_HOST);
 
    HYPRE_ANNOTATION_END("BoomerAMG.destroy");
@@ -1280,6 +1335,269 @@ hypre_BoomerAMGSetSabs( void         *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetMixedPrecisionLevel( void      *data,
+                                       HYPRE_Int  mixed_prec_level )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataMixedPrecLevel(amg_data) = mixed_prec_level;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetMixedPrecisionLevel( void      *data,
+                                       HYPRE_Int *mixed_prec_level )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *mixed_prec_level = hypre_ParAMGDataMixedPrecLevel(amg_data);
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetSetupReuse( void      *data,
+                              HYPRE_Int  setup_reuse )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (setup_reuse < 0 || setup_reuse > 2)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataSetupReuse(amg_data) = setup_reuse;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetSetupReuse( void      *data,
+                              HYPRE_Int *setup_reuse )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *setup_reuse = hypre_ParAMGDataSetupReuse(amg_data);
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetSetupArena( void      *data,
+                              HYPRE_Int  setup_arena )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (setup_arena < 0 || setup_arena > 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataSetupArena(amg_data) = setup_arena;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetSetupArena( void      *data,
+                              HYPRE_Int *setup_arena )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *setup_arena = hypre_ParAMGDataSetupArena(amg_data);
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetNodeAwareLevel( void      *data,
+                                  HYPRE_Int  node_aware_level )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (node_aware_level < -1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataNodeAwareLevel(amg_data) = node_aware_level;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetNodeAwareLevel( void      *data,
+                                  HYPRE_Int *node_aware_level )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *node_aware_level = hypre_ParAMGDataNodeAwareLevel(amg_data);
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetNeighborCommLevel( void      *data,
+                                     HYPRE_Int  neighbor_comm_level )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (neighbor_comm_level < -1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataNeighborCommLevel(amg_data) = neighbor_comm_level;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetNeighborCommLevel( void      *data,
+                                     HYPRE_Int *neighbor_comm_level )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *neighbor_comm_level = hypre_ParAMGDataNeighborCommLevel(amg_data);
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetRedistributeThreshold( void      *data,
+                                         HYPRE_Int  redist_threshold )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (redist_threshold < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataRedistThreshold(amg_data) = redist_threshold;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetRedistributeThreshold( void      *data,
+                                         HYPRE_Int *redist_threshold )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *redist_threshold = hypre_ParAMGDataRedistThreshold(amg_data);
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetProfile( void      *data,
+                           HYPRE_Int  profile )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   /* the ParCSR communication counters stay enabled while any solver profiles */
+   profile = (profile != 0);
+   if (profile != hypre_ParAMGDataProfile(amg_data))
+   {
+      hypre_HandleCommStats(hypre_handle()) += profile ? 1 : -1;
+   }
+   hypre_ParAMGDataProfile(amg_data) = profile;
+
+   if (!profile)
+   {
+      hypre_TFree(hypre_ParAMGDataProfileData(amg_data), HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataProfileNumLevels(amg_data) = 0;
+   }
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_BoomerAMGSetMaxRowSum( void     *data,
                           HYPRE_Real    max_row_sum )
@@ -4040,6 +4358,26 @@ hypre_BoomerAMGSetChebyEigEst( void     *data,
    return hypre_error_flag;
 }
 HYPRE_Int
+hypre_BoomerAMGSetChebyEigReuse( void     *data,
+                                 HYPRE_Int     cheby_eig_reuse)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (cheby_eig_reuse < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataChebyEigReuse(amg_data) = cheby_eig_reuse;
+
+   return hypre_error_flag;
+}
+HYPRE_Int
 hypre_BoomerAMGSetChebyVariant( void     *data,
                               HYPRE_Int     cheby_variant)
 {
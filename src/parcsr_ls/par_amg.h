@@ -12,6 +12,40 @@
 
 #include "par_csr_block_matrix.h"
 
+/*--------------------------------------------------------------------------
+ * Phases of the setup timed in hypre_ParAMGData setup_times
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_AMG_SETUP_TIME_STRENGTH  0
+#define HYPRE_AMG_SETUP_TIME_COARSEN   1
+#define HYPRE_AMG_SETUP_TIME_INTERP    2
+#define HYPRE_AMG_SETUP_TIME_RAP       3
+#define HYPRE_AMG_SETUP_TIME_SMOOTHER  4
+#define HYPRE_AMG_SETUP_TIME_OTHER     5
+#define HYPRE_AMG_SETUP_TIME_TOTAL     6
+#define HYPRE_AMG_SETUP_NUM_TIMES      7
+
+/*--------------------------------------------------------------------------
+ * Phases and statistics of the per-level profile (see par_amg_profile.c).
+ * The setup phases have the numbers of the corresponding setup times.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_AMG_PROFILE_STRENGTH     0
+#define HYPRE_AMG_PROFILE_COARSEN      1
+#define HYPRE_AMG_PROFILE_INTERP       2
+#define HYPRE_AMG_PROFILE_RAP          3
+#define HYPRE_AMG_PROFILE_RELAX        4
+#define HYPRE_AMG_PROFILE_RESTRICT     5
+#define HYPRE_AMG_PROFILE_PROLONG      6
+#define HYPRE_AMG_PROFILE_NUM_PHASES   7
+
+#define HYPRE_AMG_PROFILE_TIME         0
+#define HYPRE_AMG_PROFILE_WAIT         1
+#define HYPRE_AMG_PROFILE_MESSAGES     2
+#define HYPRE_AMG_PROFILE_BYTES        3
+#define HYPRE_AMG_PROFILE_CALLS        4
+#define HYPRE_AMG_PROFILE_NUM_STATS    5
+
 /*--------------------------------------------------------------------------
  * hypre_ParAMGData
  *--------------------------------------------------------------------------*/
@@ -61,6 +95,12 @@ typedef struct
    HYPRE_Int      redundant;
    HYPRE_Int      participate;
    HYPRE_Int      Sabs;
+   HYPRE_Int      mixed_prec_level;
+   HYPRE_Int      setup_reuse;
+   HYPRE_Int      setup_arena;
+   HYPRE_Int      node_aware_level;
+   HYPRE_Int      neighbor_comm_level;
+   HYPRE_Int      redist_threshold;
 
    /* solve params */
    HYPRE_Int      max_iter;
@@ -106,6 +146,20 @@ typedef struct
    HYPRE_Int            num_levels;
    hypre_Vector       **l1_norms;
 
+   /* data kept for a numeric-only re-setup (setup_reuse > 0) */
+   hypre_ParCSRMatrix **AP_array;
+   hypre_ParCSRMatMatPlan **AP_plan_array;
+   hypre_ParCSRMatMatPlan **RAP_plan_array;
+   HYPRE_Int            reuse_num_rows;
+   HYPRE_Int            reuse_num_nonzeros;
+   HYPRE_Int            setup_reused;
+   HYPRE_Real           setup_times[HYPRE_AMG_SETUP_NUM_TIMES];
+
+   /* per-level profile, [level][phase][stat] */
+   HYPRE_Int            profile;
+   HYPRE_Int            profile_num_levels;
+   HYPRE_Real          *profile_data;
+
    /* Block data */
    hypre_ParCSRBlockMatrix **A_block_array;
    hypre_ParCSRBlockMatrix **P_block_array;
@@ -137,6 +191,8 @@ typedef struct
    HYPRE_Real          *max_eig_est;
    HYPRE_Real          *min_eig_est;
    HYPRE_Int            cheby_eig_est;
+   HYPRE_Int            cheby_eig_reuse;
+   HYPRE_Int            cheby_eig_age;
    HYPRE_Int            cheby_order;
    HYPRE_Int            cheby_variant;
    HYPRE_Int            cheby_scale;
@@ -144,6 +200,11 @@ typedef struct
    HYPRE_Real         **cheby_ds;
    HYPRE_Real         **cheby_coefs;
 
+   /* data for multicolor Gauss-Seidel */
+   HYPRE_Int           *mc_num_colors;
+   HYPRE_Int          **mc_color_starts;
+   HYPRE_Int          **mc_color_rows;
+
    /* data needed for non-Galerkin option */
    HYPRE_Int           nongalerk_num_tol;
    HYPRE_Real         *nongalerk_tol;
@@ -204,6 +265,7 @@ typedef struct
    hypre_ParVector     *f_coarse;
    hypre_ParVector     *u_coarse;
    MPI_Comm             new_comm;
+   MPI_Comm             redist_comm;
 
    /* store matrix, vector and communication info for Gaussian elimination */
    HYPRE_Int   gs_setup;
@@ -269,6 +331,12 @@ typedef struct
 #define hypre_ParAMGDataStrongThresholdR(amg_data)     ((amg_data) -> strong_thresholdR)
 #define hypre_ParAMGDataFilterThresholdR(amg_data)     ((amg_data) -> filter_thresholdR)
 #define hypre_ParAMGDataSabs(amg_data)                 ((amg_data) -> Sabs)
+#define hypre_ParAMGDataMixedPrecLevel(amg_data)       ((amg_data) -> mixed_prec_level)
+#define hypre_ParAMGDataSetupReuse(amg_data)           ((amg_data) -> setup_reuse)
+#define hypre_ParAMGDataSetupArena(amg_data)           ((amg_data) -> setup_arena)
+#define hypre_ParAMGDataNodeAwareLevel(amg_data)       ((amg_data) -> node_aware_level)
+#define hypre_ParAMGDataNeighborCommLevel(amg_data)    ((amg_data) -> neighbor_comm_level)
+#define hypre_ParAMGDataRedistThreshold(amg_data)      ((amg_data) -> redist_threshold)
 #define hypre_ParAMGDataMaxRowSum(amg_data)            ((amg_data) -> max_row_sum)
 #define hypre_ParAMGDataTruncFactor(amg_data)          ((amg_data) -> trunc_factor)
 #define hypre_ParAMGDataAggTruncFactor(amg_data)       ((amg_data) -> agg_trunc_factor)
@@ -343,6 +411,16 @@ typedef struct
 #define hypre_ParAMGDataPointDofMapArray(amg_data) \
 ((amg_data)->point_dof_map_array)
 #define hypre_ParAMGDataNumLevels(amg_data) ((amg_data)->num_levels)
+#define hypre_ParAMGDataAPArray(amg_data) ((amg_data)->AP_array)
+#define hypre_ParAMGDataAPPlanArray(amg_data) ((amg_data)->AP_plan_array)
+#define hypre_ParAMGDataRAPPlanArray(amg_data) ((amg_data)->RAP_plan_array)
+#define hypre_ParAMGDataReuseNumRows(amg_data) ((amg_data)->reuse_num_rows)
+#define hypre_ParAMGDataReuseNumNonzeros(amg_data) ((amg_data)->reuse_num_nonzeros)
+#define hypre_ParAMGDataSetupReused(amg_data) ((amg_data)->setup_reused)
+#define hypre_ParAMGDataSetupTimes(amg_data) ((amg_data)->setup_times)
+#define hypre_ParAMGDataProfile(amg_data) ((amg_data)->profile)
+#define hypre_ParAMGDataProfileNumLevels(amg_data) ((amg_data)->profile_num_levels)
+#define hypre_ParAMGDataProfileData(amg_data) ((amg_data)->profile_data)
 #define hypre_ParAMGDataSmoothType(amg_data) ((amg_data)->smooth_type)
 #define hypre_ParAMGDataSmoothNumLevels(amg_data) \
 ((amg_data)->smooth_num_levels)
@@ -372,11 +450,18 @@ typedef struct
 #define hypre_ParAMGDataChebyOrder(amg_data) ((amg_data)->cheby_order)
 #define hypre_ParAMGDataChebyFraction(amg_data) ((amg_data)->cheby_fraction)
 #define hypre_ParAMGDataChebyEigEst(amg_data) ((amg_data)->cheby_eig_est)
+#define hypre_ParAMGDataChebyEigReuse(amg_data) ((amg_data)->cheby_eig_reuse)
+#define hypre_ParAMGDataChebyEigAge(amg_data) ((amg_data)->cheby_eig_age)
 #define hypre_ParAMGDataChebyVariant(amg_data) ((amg_data)->cheby_variant)
 #define hypre_ParAMGDataChebyScale(amg_data) ((amg_data)->cheby_scale)
 #define hypre_ParAMGDataChebyDS(amg_data) ((amg_data)->cheby_ds)
 #define hypre_ParAMGDataChebyCoefs(amg_data) ((amg_data)->cheby_coefs)
 
+/* multicolor Gauss-Seidel */
+#define hypre_ParAMGDataMCNumColors(amg_data) ((amg_data)->mc_num_colors)
+#define hypre_ParAMGDataMCColorStarts(amg_data) ((amg_data)->mc_color_starts)
+#define hypre_ParAMGDataMCColorRows(amg_data) ((amg_data)->mc_color_rows)
+
 /* block */
 #define hypre_ParAMGDataABlockArray(amg_data) ((amg_data)->A_block_array)
 #define hypre_ParAMGDataPBlockArray(amg_data) ((amg_data)->P_block_array)
@@ -438,6 +523,7 @@ typedef struct
 #define hypre_ParAMGDataFCoarse(amg_data) ((amg_data)->f_coarse)
 #define hypre_ParAMGDataUCoarse(amg_data) ((amg_data)->u_coarse)
 #define hypre_ParAMGDataNewComm(amg_data) ((amg_data)->new_comm)
+#define hypre_ParAMGDataRedistComm(amg_data) ((amg_data)->redist_comm)
 #define hypre_ParAMGDataRedundant(amg_data) ((amg_data)->redundant)
 #define hypre_ParAMGDataParticipate(amg_data) ((amg_data)->participate)
 
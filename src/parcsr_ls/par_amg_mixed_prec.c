@@ -0,0 +1,292 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Reduced-precision storage of the BoomerAMG hierarchy
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+
+/*--------------------------------------------------------------------------
+ * Storage of the local part of a ParCSR matrix (values, column indices and
+ * row pointers of diag and offd) and the part of it saved by reduced-precision
+ * values.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGMixedPrecBytes( hypre_ParCSRMatrix *A,
+                               HYPRE_Real         *bytes,
+                               HYPRE_Real         *saved )
+{
+   hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *A_offd = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Real       nnz;
+
+   nnz = (HYPRE_Real) (hypre_CSRMatrixNumNonzeros(A_diag) +
+                       hypre_CSRMatrixNumNonzeros(A_offd));
+
+   *bytes = nnz * (HYPRE_Real) (sizeof(HYPRE_Complex) + sizeof(HYPRE_Int)) +
+            (HYPRE_Real) (2 * (hypre_CSRMatrixNumRows(A_diag) + 1)) * sizeof(HYPRE_Int);
+   *saved = nnz * (HYPRE_Real) (sizeof(HYPRE_Complex) - sizeof(hypre_ComplexSP));
+}
+
+/*--------------------------------------------------------------------------
+ * A is only applied through matrix-vector products if the down and up
+ * smoothers are Chebyshev or l1-Jacobi without CF-relaxation.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGMixedPrecAMatvecOnly( hypre_ParAMGData *amg_data )
+{
+   HYPRE_Int *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int  relax_order     = hypre_ParAMGDataRelaxOrder(amg_data);
+   HYPRE_Int  relax_type, cycle_param;
+
+   for (cycle_param = 1; cycle_param < 3; cycle_param++)
+   {
+      relax_type = grid_relax_type[cycle_param];
+      if ( !(relax_type == 16 || (relax_type == 18 && relax_order == 0)) )
+      {
+         return 0;
+      }
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSetupMixedPrecision
+ *
+ * Called at the end of hypre_BoomerAMGSetup.  Converts the operators of the
+ * levels >= mixed_prec_level to reduced-precision storage:
+ *
+ *   - P (and R, if built) from every such level, since they are only used
+ *     in matrix-vector products during the cycle;
+ *   - A on such levels, except the fine and the coarsest grid, if both the
+ *     down and up relaxations only apply A through matrix-vector products
+ *     (Chebyshev, and l1-Jacobi without CF-relaxation).
+ *
+ * Prints the memory saved per level if the print level is 1 or 3.  The
+ * conversion is undone by hypre_BoomerAMGRestoreDoublePrecision (numeric
+ * re-setup) and, for A, by hypre_BoomerAMGCheckMixedPrecision (relaxation
+ * types changed after the setup).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSetupMixedPrecision( void *amg_vdata )
+{
+   hypre_ParAMGData    *amg_data          = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int            mixed_prec_level  = hypre_ParAMGDataMixedPrecLevel(amg_data);
+   HYPRE_Int            num_levels        = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRMatrix **A_array           = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix **P_array           = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix **R_array           = hypre_ParAMGDataRArray(amg_data);
+   HYPRE_Int            smooth_num_levels = hypre_ParAMGDataSmoothNumLevels(amg_data);
+   HYPRE_Int            print_level       = hypre_ParAMGDataPrintLevel(amg_data);
+   HYPRE_Int            additive          = hypre_ParAMGDataAdditive(amg_data);
+   HYPRE_Int            mult_additive     = hypre_ParAMGDataMultAdditive(amg_data);
+   HYPRE_Int            simple            = hypre_ParAMGDataSimple(amg_data);
+   MPI_Comm             comm;
+
+   HYPRE_Int            A_matvec_only;
+   HYPRE_Int           *A_converted;
+   HYPRE_Real          *local_bytes, *global_bytes;
+   HYPRE_Real           bytes, saved, total_bytes, total_saved;
+   HYPRE_Int            level, my_id;
+
+   if (mixed_prec_level < 0 || num_levels < 2 || hypre_ParAMGDataBlockMode(amg_data))
+   {
+      return hypre_error_flag;
+   }
+
+   /* the additive cycles build their own operators from A and P */
+   if ( (additive > -1 && additive < num_levels) ||
+        (mult_additive > -1 && mult_additive < num_levels) ||
+        (simple > -1 && simple < num_levels) )
+   {
+      return hypre_error_flag;
+   }
+
+   if (hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A_array[0])) != hypre_MEMORY_HOST)
+   {
+      return hypre_error_flag;
+   }
+
+   A_matvec_only = hypre_BoomerAMGMixedPrecAMatvecOnly(amg_data);
+
+   A_converted = hypre_CTAlloc(HYPRE_Int, num_levels, HYPRE_MEMORY_HOST);
+
+   for (level = hypre_max(mixed_prec_level, 0); level < num_levels - 1; level++)
+   {
+      hypre_ParCSRMatrixConvertToSP(P_array[level]);
+      if (R_array[level] && R_array[level] != P_array[level])
+      {
+         hypre_ParCSRMatrixConvertToSP(R_array[level]);
+      }
+
+      if (level > 0 && A_matvec_only && level >= smooth_num_levels)
+      {
+         hypre_ParCSRMatrixConvertToSP(A_array[level]);
+         A_converted[level] = 1;
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Report: storage of A and P (and R) per level before the conversion,
+    * and the part of it saved
+    *-----------------------------------------------------------------------*/
+
+   if (print_level == 1 || print_level == 3)
+   {
+      comm = hypre_ParCSRMatrixComm(A_array[0]);
+      hypre_MPI_Comm_rank(comm, &my_id);
+
+      local_bytes  = hypre_CTAlloc(HYPRE_Real, 2*num_levels, HYPRE_MEMORY_HOST);
+      global_bytes = hypre_CTAlloc(HYPRE_Real, 2*num_levels, HYPRE_MEMORY_HOST);
+
+      for (level = 0; level < num_levels; level++)
+      {
+         hypre_BoomerAMGMixedPrecBytes(A_array[level], &bytes, &saved);
+         local_bytes[2*level] += bytes;
+         if (A_converted[level])
+         {
+            local_bytes[2*level+1] += saved;
+         }
+
+         if (level < num_levels - 1)
+         {
+            hypre_BoomerAMGMixedPrecBytes(P_array[level], &bytes, &saved);
+            local_bytes[2*level] += bytes;
+            if (level >= mixed_prec_level)
+            {
+               local_bytes[2*level+1] += saved;
+            }
+            if (R_array[level] && R_array[level] != P_array[level])
+            {
+               hypre_BoomerAMGMixedPrecBytes(R_array[level], &bytes, &saved);
+               local_bytes[2*level] += bytes;
+               if (level >= mixed_prec_level)
+               {
+                  local_bytes[2*level+1] += saved;
+               }
+            }
+         }
+      }
+
+      hypre_MPI_Allreduce(local_bytes, global_bytes, 2*num_levels, HYPRE_MPI_REAL,
+                          hypre_MPI_SUM, comm);
+
+      if (my_id == 0)
+      {
+         total_bytes = 0.0;
+         total_saved = 0.0;
+
+         hypre_printf("\n\n BoomerAMG mixed precision storage (levels >= %d):\n\n",
+                      mixed_prec_level);
+         hypre_printf(" lev   A    P     storage (MB)   saved (MB)\n");
+         for (level = 0; level < num_levels; level++)
+         {
+            hypre_printf(" %3d   %s   %s   %12.3f   %10.3f\n", level,
+                         A_converted[level] ? "sp" : "dp",
+                         level < num_levels - 1 ? (level >= mixed_prec_level ? "sp" : "dp") : "--",
+                         global_bytes[2*level] / 1.0e6, global_bytes[2*level+1] / 1.0e6);
+            total_bytes += global_bytes[2*level];
+            total_saved += global_bytes[2*level+1];
+         }
+         hypre_printf("\n Total saved: %.3f MB of %.3f MB (%.1f%%)\n\n",
+                      total_saved / 1.0e6, total_bytes / 1.0e6,
+                      total_bytes > 0.0 ? 100.0 * total_saved / total_bytes : 0.0);
+      }
+
+      hypre_TFree(local_bytes, HYPRE_MEMORY_HOST);
+      hypre_TFree(global_bytes, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_TFree(A_converted, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRestoreDoublePrecision
+ *
+ * Restores the HYPRE_Complex coefficients of the operators converted by
+ * hypre_BoomerAMGSetupMixedPrecision, e.g. before a numeric re-setup that
+ * recomputes them.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRestoreDoublePrecision( void *amg_vdata )
+{
+   hypre_ParAMGData    *amg_data   = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int            num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRMatrix **A_array    = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix **P_array    = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix **R_array    = hypre_ParAMGDataRArray(amg_data);
+   HYPRE_Int            level;
+
+   if (!A_array)
+   {
+      return hypre_error_flag;
+   }
+
+   for (level = 0; level < num_levels; level++)
+   {
+      if (A_array[level])
+      {
+         hypre_ParCSRMatrixConvertToDP(A_array[level]);
+      }
+      if (level < num_levels - 1)
+      {
+         if (P_array && P_array[level])
+         {
+            hypre_ParCSRMatrixConvertToDP(P_array[level]);
+         }
+         if (R_array && R_array[level] && R_array[level] != P_array[level])
+         {
+            hypre_ParCSRMatrixConvertToDP(R_array[level]);
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGCheckMixedPrecision
+ *
+ * Called before a solve.  If the relaxation types were changed after the
+ * setup such that the smoothers access the coefficients of A directly,
+ * restores the HYPRE_Complex coefficients of A on all levels.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGCheckMixedPrecision( void *amg_vdata )
+{
+   hypre_ParAMGData    *amg_data   = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int            num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRMatrix **A_array    = hypre_ParAMGDataAArray(amg_data);
+   HYPRE_Int            level;
+
+   if (!A_array || hypre_BoomerAMGMixedPrecAMatvecOnly(amg_data))
+   {
+      return hypre_error_flag;
+   }
+
+   for (level = 1; level < num_levels; level++)
+   {
+      if (A_array[level] && hypre_CSRMatrixDataSP(hypre_ParCSRMatrixDiag(A_array[level])))
+      {
+         hypre_ParCSRMatrixConvertToDP(A_array[level]);
+      }
+   }
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,588 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * AMG solve routine for several right-hand sides at once
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+
+/*--------------------------------------------------------------------------
+ * Block solve data: multivectors F, U and V (residual) on each level
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_ParAMGData    *amg_data;
+   HYPRE_Int            num_vectors;
+   hypre_ParVector    **F_array;
+   hypre_ParVector    **U_array;
+   hypre_ParVector    **V_array;
+
+} hypre_BoomerAMGMultiData;
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMultiSolveSupported
+ *
+ * The block cycle implements the host V- and W-cycles with l1-Jacobi
+ * smoothing (relax type 18 without CF-ordering) and Gaussian elimination or
+ * l1-Jacobi on the coarsest grid.  Coarse grids gathered onto fewer ranks
+ * (redistribution, seq_threshold or redundant solves) are cycled on subsets
+ * of the ranks and are not supported.  The answer is the same on all ranks.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGMultiSolveSupportedLocal( hypre_ParAMGData *amg_data )
+{
+   HYPRE_Int            num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int           *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   hypre_Vector       **l1_norms        = hypre_ParAMGDataL1Norms(amg_data);
+   HYPRE_Int            additive        = hypre_ParAMGDataAdditive(amg_data);
+   HYPRE_Int            mult_additive   = hypre_ParAMGDataMultAdditive(amg_data);
+   HYPRE_Int            simple          = hypre_ParAMGDataSimple(amg_data);
+   hypre_ParCSRMatrix **A_array         = hypre_ParAMGDataAArray(amg_data);
+   HYPRE_Int            cycle_param, relax_type, level;
+
+   if (num_levels < 2 || l1_norms == NULL ||
+       hypre_ParAMGDataBlockMode(amg_data) ||
+       hypre_ParAMGDataFCycle(amg_data) ||
+       hypre_ParAMGDataRelaxOrder(amg_data) ||
+       hypre_ParAMGDataGridRelaxPoints(amg_data) ||
+       hypre_ParAMGDataSmoothNumLevels(amg_data) > 0 ||
+       hypre_ParAMGDataParticipate(amg_data) ||
+       hypre_ParAMGDataSeqThreshold(amg_data) > 0 ||
+       hypre_ParAMGDataRedundant(amg_data) ||
+       hypre_ParAMGDataRedistComm(amg_data) != hypre_MPI_COMM_NULL ||
+       (additive > -1 && additive < num_levels) ||
+       (mult_additive > -1 && mult_additive < num_levels) ||
+       (simple > -1 && simple < num_levels))
+   {
+      return 0;
+   }
+
+#ifdef HYPRE_USING_DSUPERLU
+   if (hypre_ParAMGDataDSLUSolver(amg_data) != NULL)
+   {
+      return 0;
+   }
+#endif
+
+   if (hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A_array[0])) != hypre_MEMORY_HOST)
+   {
+      return 0;
+   }
+
+   for (cycle_param = 1; cycle_param < 4; cycle_param++)
+   {
+      relax_type = grid_relax_type[cycle_param];
+      if (relax_type == 18)
+      {
+         continue;
+      }
+      if (cycle_param == 3 && (relax_type == 9 || relax_type == 99 || relax_type == 199))
+      {
+         continue;
+      }
+      return 0;
+   }
+
+   for (level = 0; level < num_levels; level++)
+   {
+      if (l1_norms[level] == NULL && (level < num_levels - 1 || grid_relax_type[3] == 18))
+      {
+         return 0;
+      }
+   }
+
+   return 1;
+}
+
+static HYPRE_Int
+hypre_BoomerAMGMultiSolveSupported( MPI_Comm          comm,
+                                    hypre_ParAMGData *amg_data )
+{
+   HYPRE_Int  local_supported = hypre_BoomerAMGMultiSolveSupportedLocal(amg_data);
+   HYPRE_Int  supported;
+
+   hypre_MPI_Allreduce(&local_supported, &supported, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+
+   return supported;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMultiRelax
+ *
+ * num_sweeps sweeps of u += w*(f - A*u)/d for all vectors, where d are the
+ * l1 row norms of A.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGMultiRelax( hypre_ParCSRMatrix *A,
+                           hypre_ParVector    *f,
+                           hypre_ParVector    *u,
+                           hypre_ParVector    *v,
+                           HYPRE_Real         *l1_norms,
+                           HYPRE_Real          relax_weight,
+                           HYPRE_Int           num_sweeps )
+{
+   hypre_Vector  *u_local     = hypre_ParVectorLocalVector(u);
+   hypre_Vector  *v_local     = hypre_ParVectorLocalVector(v);
+   HYPRE_Complex *u_data      = hypre_VectorData(u_local);
+   HYPRE_Complex *v_data      = hypre_VectorData(v_local);
+   HYPRE_Int      n           = hypre_VectorSize(u_local);
+   HYPRE_Int      num_vectors = hypre_VectorNumVectors(u_local);
+   HYPRE_Int      u_vecstride = hypre_VectorVectorStride(u_local);
+   HYPRE_Int      u_idxstride = hypre_VectorIndexStride(u_local);
+   HYPRE_Int      v_vecstride = hypre_VectorVectorStride(v_local);
+   HYPRE_Int      v_idxstride = hypre_VectorIndexStride(v_local);
+   HYPRE_Int      i, jv, sweep;
+
+   for (sweep = 0; sweep < num_sweeps; sweep++)
+   {
+      hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A, u, 1.0, f, v);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,jv) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < n; i++)
+      {
+         HYPRE_Real scale = relax_weight / l1_norms[i];
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            u_data[jv*u_vecstride + i*u_idxstride] += scale * v_data[jv*v_vecstride + i*v_idxstride];
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMultiCopyColumn
+ *
+ * Copies vector jv of the multivector x into the single vector y (to_single
+ * = 1), or vice versa.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGMultiCopyColumn( hypre_ParVector *x,
+                                HYPRE_Int        jv,
+                                hypre_ParVector *y,
+                                HYPRE_Int        to_single )
+{
+   hypre_Vector  *x_local   = hypre_ParVectorLocalVector(x);
+   HYPRE_Complex *x_data    = hypre_VectorData(x_local) + jv*hypre_VectorVectorStride(x_local);
+   HYPRE_Int      idxstride = hypre_VectorIndexStride(x_local);
+   HYPRE_Complex *y_data    = hypre_VectorData(hypre_ParVectorLocalVector(y));
+   HYPRE_Int      n         = hypre_VectorSize(x_local);
+   HYPRE_Int      i;
+
+   if (to_single)
+   {
+      for (i = 0; i < n; i++)
+      {
+         y_data[i] = x_data[i*idxstride];
+      }
+   }
+   else
+   {
+      for (i = 0; i < n; i++)
+      {
+         x_data[i*idxstride] = y_data[i];
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMultiCycle
+ *
+ * One multiplicative cycle on level and below.  On levels below the finest,
+ * the coarse-grid correction is applied cycle_type times (V- and W-cycles).
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGMultiCycle( hypre_BoomerAMGMultiData *data,
+                           HYPRE_Int                 level )
+{
+   hypre_ParAMGData    *amg_data        = data -> amg_data;
+   HYPRE_Int            num_vectors     = data -> num_vectors;
+   hypre_ParVector    **F_array         = data -> F_array;
+   hypre_ParVector    **U_array         = data -> U_array;
+   hypre_ParVector    **V_array         = data -> V_array;
+
+   HYPRE_Int            num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRMatrix **A_array         = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix **P_array         = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix **R_array         = hypre_ParAMGDataRArray(amg_data);
+   HYPRE_Int           *num_grid_sweeps = hypre_ParAMGDataNumGridSweeps(amg_data);
+   HYPRE_Int           *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Real          *relax_weight    = hypre_ParAMGDataRelaxWeight(amg_data);
+   hypre_Vector       **l1_norms        = hypre_ParAMGDataL1Norms(amg_data);
+   HYPRE_Int            cycle_type      = hypre_ParAMGDataCycleType(amg_data);
+   HYPRE_Int            restri_type     = hypre_ParAMGDataRestriction(amg_data);
+   HYPRE_Int            coarse_grid     = level + 1;
+   HYPRE_Int            relax_type, j, jv, num_visits;
+
+   /*-----------------------------------------------------------------------
+    * Coarsest grid: Gaussian elimination one vector at a time, or sweeps
+    *-----------------------------------------------------------------------*/
+
+   if (level == num_levels - 1)
+   {
+      relax_type = grid_relax_type[3];
+      if (relax_type == 9 || relax_type == 99 || relax_type == 199)
+      {
+         hypre_ParVector *F_coarse = hypre_ParAMGDataFArray(amg_data)[level];
+         hypre_ParVector *U_coarse = hypre_ParAMGDataUArray(amg_data)[level];
+
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            hypre_BoomerAMGMultiCopyColumn(F_array[level], jv, F_coarse, 1);
+            hypre_BoomerAMGMultiCopyColumn(U_array[level], jv, U_coarse, 1);
+            for (j = 0; j < num_grid_sweeps[3]; j++)
+            {
+               hypre_GaussElimSolve(amg_data, level, relax_type);
+            }
+            hypre_BoomerAMGMultiCopyColumn(U_array[level], jv, U_coarse, 0);
+         }
+      }
+      else
+      {
+         hypre_BoomerAMGMultiRelax(A_array[level], F_array[level], U_array[level], V_array[level],
+                                   hypre_VectorData(l1_norms[level]), relax_weight[level],
+                                   num_grid_sweeps[3]);
+      }
+
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Pre-smoothing, then num_visits times: restriction of the residual,
+    * coarse-grid correction, interpolation and post-smoothing.  As in
+    * hypre_BoomerAMGCycle, the post-smoothing of one visit is the
+    * pre-smoothing of the next.
+    *-----------------------------------------------------------------------*/
+
+   hypre_BoomerAMGMultiRelax(A_array[level], F_array[level], U_array[level], V_array[level],
+                             hypre_VectorData(l1_norms[level]), relax_weight[level],
+                             num_grid_sweeps[1]);
+
+   num_visits = (level == 0) ? 1 : cycle_type;
+   for (j = 0; j < num_visits; j++)
+   {
+      hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A_array[level], U_array[level],
+                                         1.0, F_array[level], V_array[level]);
+      if (restri_type)
+      {
+         hypre_ParCSRMatrixMatvec(1.0, R_array[level], V_array[level], 0.0, F_array[coarse_grid]);
+      }
+      else
+      {
+         hypre_ParCSRMatrixMatvecT(1.0, R_array[level], V_array[level], 0.0, F_array[coarse_grid]);
+      }
+
+      hypre_ParVectorSetConstantValues(U_array[coarse_grid], 0.0);
+
+      hypre_BoomerAMGMultiCycle(data, coarse_grid);
+
+      hypre_ParCSRMatrixMatvec(1.0, P_array[level], U_array[coarse_grid], 1.0, U_array[level]);
+
+      hypre_BoomerAMGMultiRelax(A_array[level], F_array[level], U_array[level], V_array[level],
+                                hypre_VectorData(l1_norms[level]), relax_weight[level],
+                                num_grid_sweeps[2]);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMultiNorms
+ *
+ * norms[jv] = ||v_jv||_2 for every vector jv of the multivector v
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGMultiNorms( hypre_ParVector *v,
+                           HYPRE_Real      *norms )
+{
+   MPI_Comm       comm        = hypre_ParVectorComm(v);
+   hypre_Vector  *v_local     = hypre_ParVectorLocalVector(v);
+   HYPRE_Complex *v_data      = hypre_VectorData(v_local);
+   HYPRE_Int      n           = hypre_VectorSize(v_local);
+   HYPRE_Int      num_vectors = hypre_VectorNumVectors(v_local);
+   HYPRE_Int      vecstride   = hypre_VectorVectorStride(v_local);
+   HYPRE_Int      idxstride   = hypre_VectorIndexStride(v_local);
+   HYPRE_Real    *local_norms;
+   HYPRE_Real     sum;
+   HYPRE_Int      i, jv;
+
+   local_norms = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+
+   for (jv = 0; jv < num_vectors; jv++)
+   {
+      sum = 0.0;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) reduction(+:sum) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < n; i++)
+      {
+         sum += v_data[jv*vecstride + i*idxstride] * v_data[jv*vecstride + i*idxstride];
+      }
+      local_norms[jv] = sum;
+   }
+
+   /* one reduction for all vectors */
+   hypre_MPI_Allreduce(local_norms, norms, num_vectors, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+
+   for (jv = 0; jv < num_vectors; jv++)
+   {
+      norms[jv] = sqrt(norms[jv]);
+   }
+
+   hypre_TFree(local_norms, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMultiSolve
+ *
+ * Solves A*u = f for all vectors of the multivectors f and u.  Every cycle
+ * applies the smoothers, restriction and interpolation to all vectors at
+ * once, so each matrix is streamed once per cycle and the halo of all
+ * vectors travels in one message per neighbor.  The cycle stops when every
+ * vector satisfies the stopping criterion of hypre_BoomerAMGSolve;
+ * NumIterations and FinalRelativeResidualNorm refer to the slowest vector.
+ *
+ * Configurations the block cycle does not cover (see
+ * hypre_BoomerAMGMultiSolveSupported) are solved one vector at a time.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGMultiSolve( void               *amg_vdata,
+                           hypre_ParCSRMatrix *A,
+                           hypre_ParVector    *f,
+                           hypre_ParVector    *u )
+{
+   MPI_Comm                  comm        = hypre_ParCSRMatrixComm(A);
+   hypre_ParAMGData         *amg_data    = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int                 num_vectors = hypre_ParVectorNumVectors(f);
+   HYPRE_Int                 num_levels  = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRMatrix      **A_array     = hypre_ParAMGDataAArray(amg_data);
+   HYPRE_Int                 print_level = hypre_ParAMGDataPrintLevel(amg_data);
+   HYPRE_Int                 converge_type = hypre_ParAMGDataConvergeType(amg_data);
+   HYPRE_Real                tol         = hypre_ParAMGDataTol(amg_data);
+   HYPRE_Int                 min_iter    = hypre_ParAMGDataMinIter(amg_data);
+   HYPRE_Int                 max_iter    = hypre_ParAMGDataMaxIter(amg_data);
+
+   hypre_BoomerAMGMultiData  data;
+   hypre_ParVector          *f_single, *u_single;
+   HYPRE_Real               *resid_nrm, *resid_nrm_init, *rhs_norm;
+   HYPRE_Real                relative_resid, max_relative_resid;
+   HYPRE_Int                 cycle_count, max_cycle_count;
+   HYPRE_Int                 level, jv, my_id;
+
+   if (num_vectors != hypre_ParVectorNumVectors(u))
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   /*-----------------------------------------------------------------------
+    * Fallback: one vector at a time
+    *-----------------------------------------------------------------------*/
+
+   if (!hypre_BoomerAMGMultiSolveSupported(comm, amg_data))
+   {
+      f_single = hypre_ParVectorCreate(comm, hypre_ParVectorGlobalSize(f),
+                                       hypre_ParVectorPartitioning(f));
+      hypre_ParVectorSetPartitioningOwner(f_single, 0);
+      hypre_ParVectorInitialize(f_single);
+      u_single = hypre_ParVectorCreate(comm, hypre_ParVectorGlobalSize(u),
+                                       hypre_ParVectorPartitioning(u));
+      hypre_ParVectorSetPartitioningOwner(u_single, 0);
+      hypre_ParVectorInitialize(u_single);
+
+      max_cycle_count = 0;
+      max_relative_resid = 0.0;
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         hypre_BoomerAMGMultiCopyColumn(f, jv, f_single, 1);
+         hypre_BoomerAMGMultiCopyColumn(u, jv, u_single, 1);
+         hypre_BoomerAMGSolve(amg_vdata, A, f_single, u_single);
+         hypre_BoomerAMGMultiCopyColumn(u, jv, u_single, 0);
+
+         max_cycle_count = hypre_max(max_cycle_count, hypre_ParAMGDataNumIterations(amg_data));
+         max_relative_resid = hypre_max(max_relative_resid,
+                                        hypre_ParAMGDataRelativeResidualNorm(amg_data));
+      }
+      hypre_ParAMGDataNumIterations(amg_data) = max_cycle_count;
+      hypre_ParAMGDataRelativeResidualNorm(amg_data) = max_relative_resid;
+
+      hypre_ParVectorDestroy(f_single);
+      hypre_ParVectorDestroy(u_single);
+
+      return hypre_error_flag;
+   }
+
+   HYPRE_ANNOTATION_BEGIN("BoomerAMG.multisolve");
+
+   /* the relaxation types may have changed since the setup */
+   hypre_BoomerAMGCheckMixedPrecision(amg_data);
+
+   /*-----------------------------------------------------------------------
+    * Level multivectors
+    *-----------------------------------------------------------------------*/
+
+   data.amg_data    = amg_data;
+   data.num_vectors = num_vectors;
+   data.F_array     = hypre_CTAlloc(hypre_ParVector*, num_levels, HYPRE_MEMORY_HOST);
+   data.U_array     = hypre_CTAlloc(hypre_ParVector*, num_levels, HYPRE_MEMORY_HOST);
+   data.V_array     = hypre_CTAlloc(hypre_ParVector*, num_levels, HYPRE_MEMORY_HOST);
+
+   A_array[0] = A;
+   data.F_array[0] = f;
+   data.U_array[0] = u;
+   for (level = 0; level < num_levels; level++)
+   {
+      hypre_ParCSRMatrix *A_level = A_array[level];
+
+      if (level > 0)
+      {
+         data.F_array[level] = hypre_ParMultiVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A_level),
+                                                          hypre_ParCSRMatrixRowStarts(A_level),
+                                                          num_vectors);
+         hypre_ParVectorSetPartitioningOwner(data.F_array[level], 0);
+         hypre_ParVectorInitialize(data.F_array[level]);
+
+         data.U_array[level] = hypre_ParMultiVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A_level),
+                                                          hypre_ParCSRMatrixRowStarts(A_level),
+                                                          num_vectors);
+         hypre_ParVectorSetPartitioningOwner(data.U_array[level], 0);
+         hypre_ParVectorInitialize(data.U_array[level]);
+      }
+
+      data.V_array[level] = hypre_ParMultiVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A_level),
+                                                       hypre_ParCSRMatrixRowStarts(A_level),
+                                                       num_vectors);
+      hypre_ParVectorSetPartitioningOwner(data.V_array[level], 0);
+      hypre_ParVectorInitialize(data.V_array[level]);
+   }
+
+   /*-----------------------------------------------------------------------
+    * Initial residuals
+    *-----------------------------------------------------------------------*/
+
+   resid_nrm      = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   resid_nrm_init = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   rhs_norm       = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+
+   max_relative_resid = 1.0;
+   if (tol > 0.)
+   {
+      hypre_BoomerAMGMultiNorms(f, rhs_norm);
+      hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A, u, 1.0, f, data.V_array[0]);
+      hypre_BoomerAMGMultiNorms(data.V_array[0], resid_nrm_init);
+
+      max_relative_resid = 0.0;
+      for (jv = 0; jv < num_vectors; jv++)
+      {
+         if (resid_nrm_init[jv] != resid_nrm_init[jv])
+         {
+            if (print_level > 0 && my_id == 0)
+            {
+               hypre_printf("ERROR -- hypre_BoomerAMGMultiSolve: INFs and/or NaNs detected in input.\n");
+            }
+            hypre_error(HYPRE_ERROR_GENERIC);
+            max_iter = 0;
+         }
+         relative_resid = (0 == converge_type) ?
+                          (rhs_norm[jv] ? resid_nrm_init[jv] / rhs_norm[jv] : resid_nrm_init[jv]) : 1.0;
+         max_relative_resid = hypre_max(max_relative_resid, relative_resid);
+      }
+   }
+
+   if (my_id == 0 && print_level > 1)
+   {
+      hypre_printf("\n\nAMG SOLUTION INFO (%d right-hand sides):\n", num_vectors);
+      hypre_printf("               max relative residual\n");
+      hypre_printf("    Initial    %e\n", max_relative_resid);
+   }
+
+   /*-----------------------------------------------------------------------
+    * Main cycle loop
+    *-----------------------------------------------------------------------*/
+
+   cycle_count = 0;
+   while ( (max_relative_resid >= tol || cycle_count < min_iter) && cycle_count < max_iter )
+   {
+      hypre_BoomerAMGMultiCycle(&data, 0);
+
+      if (tol > 0.)
+      {
+         hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A, u, 1.0, f, data.V_array[0]);
+         hypre_BoomerAMGMultiNorms(data.V_array[0], resid_nrm);
+
+         max_relative_resid = 0.0;
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            if (0 == converge_type)
+            {
+               relative_resid = rhs_norm[jv] ? resid_nrm[jv] / rhs_norm[jv] : resid_nrm[jv];
+            }
+            else
+            {
+               relative_resid = resid_nrm_init[jv] ? resid_nrm[jv] / resid_nrm_init[jv] : resid_nrm[jv];
+            }
+            max_relative_resid = hypre_max(max_relative_resid, relative_resid);
+         }
+         hypre_ParAMGDataRelativeResidualNorm(amg_data) = max_relative_resid;
+      }
+
+      ++cycle_count;
+      hypre_ParAMGDataNumIterations(amg_data) = cycle_count;
+
+      if (my_id == 0 && print_level > 1)
+      {
+         hypre_printf("    Cycle %2d   %e\n", cycle_count, max_relative_resid);
+      }
+   }
+
+   if (cycle_count == max_iter && tol > 0.)
+   {
+      hypre_error(HYPRE_ERROR_CONV);
+   }
+
+   /*-----------------------------------------------------------------------
+    * Clean up
+    *-----------------------------------------------------------------------*/
+
+   for (level = 0; level < num_levels; level++)
+   {
+      if (level > 0)
+      {
+         hypre_ParVectorDestroy(data.F_array[level]);
+         hypre_ParVectorDestroy(data.U_array[level]);
+      }
+      hypre_ParVectorDestroy(data.V_array[level]);
+   }
+   hypre_TFree(data.F_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(data.U_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(data.V_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(resid_nrm, HYPRE_MEMORY_HOST);
+   hypre_TFree(resid_nrm_init, HYPRE_MEMORY_HOST);
+   hypre_TFree(rhs_norm, HYPRE_MEMORY_HOST);
+
+   HYPRE_ANNOTATION_END("BoomerAMG.multisolve");
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,310 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/*****************************************************************************
+ *
+ * Per-level profile of BoomerAMG
+ *
+ * For each level and each phase of the setup (strength, coarsening,
+ * interpolation, coarse operator) and of the cycle (relaxation, restriction,
+ * interpolation) the profile accumulates the wall clock time, the time spent
+ * waiting for ParCSR halo exchanges, and the number of messages and bytes
+ * sent by them (see the communication counters of the hypre handle).  The
+ * setup phases describe the last setup; the cycle phases are accumulated
+ * over all solves since then.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+
+#define hypre_AMGProfileIndex(level, phase, stat) \
+   (((level) * HYPRE_AMG_PROFILE_NUM_PHASES + (phase)) * HYPRE_AMG_PROFILE_NUM_STATS + (stat))
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGProfileInitialize
+ *
+ * Allocates (or clears) the profile at the beginning of a setup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGProfileInitialize( void *amg_vdata )
+{
+   hypre_ParAMGData *amg_data   = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int         max_levels = hypre_ParAMGDataMaxLevels(amg_data);
+   HYPRE_Int         size       = max_levels * HYPRE_AMG_PROFILE_NUM_PHASES *
+                                  HYPRE_AMG_PROFILE_NUM_STATS;
+   HYPRE_Int         i;
+
+   if (!hypre_ParAMGDataProfile(amg_data))
+   {
+      return hypre_error_flag;
+   }
+
+   if (hypre_ParAMGDataProfileNumLevels(amg_data) != max_levels)
+   {
+      hypre_TFree(hypre_ParAMGDataProfileData(amg_data), HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataProfileData(amg_data) = hypre_CTAlloc(HYPRE_Real, size, HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataProfileNumLevels(amg_data) = max_levels;
+   }
+   else
+   {
+      for (i = 0; i < size; i++)
+      {
+         hypre_ParAMGDataProfileData(amg_data)[i] = 0.0;
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGProfileStart
+ *
+ * Records the wall clock time and the communication counters in mark
+ * (HYPRE_AMG_PROFILE_NUM_STATS entries).  The time is always recorded.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGProfileStart( void       *amg_vdata,
+                             HYPRE_Real *mark )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) amg_vdata;
+   hypre_Handle     *handle;
+
+   mark[HYPRE_AMG_PROFILE_TIME] = hypre_MPI_Wtime();
+
+   if (hypre_ParAMGDataProfile(amg_data))
+   {
+      handle = hypre_handle();
+      mark[HYPRE_AMG_PROFILE_WAIT]     = hypre_HandleCommWaitTime(handle);
+      mark[HYPRE_AMG_PROFILE_MESSAGES] = hypre_HandleCommNumMessages(handle);
+      mark[HYPRE_AMG_PROFILE_BYTES]    = hypre_HandleCommNumBytes(handle);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGProfileStop
+ *
+ * Adds the time and communication since mark to the given level and phase,
+ * and restarts mark for the next phase
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGProfileStop( void       *amg_vdata,
+                            HYPRE_Int   level,
+                            HYPRE_Int   phase,
+                            HYPRE_Real *mark )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Real       *entry;
+   HYPRE_Real        begin[HYPRE_AMG_PROFILE_NUM_STATS];
+   HYPRE_Int         stat;
+
+   if (!hypre_ParAMGDataProfile(amg_data) || !hypre_ParAMGDataProfileData(amg_data) ||
+       level < 0 || level >= hypre_ParAMGDataProfileNumLevels(amg_data))
+   {
+      return hypre_BoomerAMGProfileStart(amg_vdata, mark);
+   }
+
+   for (stat = 0; stat < HYPRE_AMG_PROFILE_CALLS; stat++)
+   {
+      begin[stat] = mark[stat];
+   }
+   hypre_BoomerAMGProfileStart(amg_vdata, mark);
+
+   entry = hypre_ParAMGDataProfileData(amg_data) + hypre_AMGProfileIndex(level, phase, 0);
+   for (stat = 0; stat < HYPRE_AMG_PROFILE_CALLS; stat++)
+   {
+      entry[stat] += mark[stat] - begin[stat];
+   }
+   entry[HYPRE_AMG_PROFILE_CALLS] += 1.0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGGetProfile
+ *
+ * Returns the local value of one statistic of the profile
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGGetProfile( void       *data,
+                           HYPRE_Int   level,
+                           HYPRE_Int   phase,
+                           HYPRE_Int   stat,
+                           HYPRE_Real *value )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (level < 0 || level >= hypre_ParAMGDataNumLevels(amg_data))
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   if (phase < 0 || phase >= HYPRE_AMG_PROFILE_NUM_PHASES)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+   if (stat < 0 || stat >= HYPRE_AMG_PROFILE_NUM_STATS)
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+   if (!value)
+   {
+      hypre_error_in_arg(5);
+      return hypre_error_flag;
+   }
+
+   *value = 0.0;
+   if (hypre_ParAMGDataProfileData(amg_data) && level < hypre_ParAMGDataProfileNumLevels(amg_data))
+   {
+      *value = hypre_ParAMGDataProfileData(amg_data)[hypre_AMGProfileIndex(level, phase, stat)];
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGPrintProfile
+ *
+ * Writes the profile to filename in JSON format.  Times are the maximum and
+ * messages and bytes the sum over all processors; the bandwidth is the
+ * number of bytes over the time of the phase.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGPrintProfile( void       *data,
+                             const char *filename )
+{
+   hypre_ParAMGData    *amg_data = (hypre_ParAMGData*) data;
+   hypre_ParCSRMatrix **A_array;
+   MPI_Comm             comm;
+   HYPRE_Int            num_levels, num_procs, my_id;
+   HYPRE_Int            level, phase, first, last, size;
+   hypre_ParCSRCommPkg *comm_pkg;
+   HYPRE_Real          *local, *max_data, *sum_data;
+   HYPRE_Real           time, bytes;
+   FILE                *fp;
+
+   const char          *phase_names[HYPRE_AMG_PROFILE_NUM_PHASES] =
+   {"strength", "coarsen", "interp", "rap", "relax", "restrict", "interp"};
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (!filename)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   A_array    = hypre_ParAMGDataAArray(amg_data);
+   num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   if (!A_array || !A_array[0] || !hypre_ParAMGDataProfileData(amg_data))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "No BoomerAMG profile: enable it before the setup\n");
+      return hypre_error_flag;
+   }
+   num_levels = hypre_min(num_levels, hypre_ParAMGDataProfileNumLevels(amg_data));
+
+   comm = hypre_ParCSRMatrixComm(A_array[0]);
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   size     = num_levels * HYPRE_AMG_PROFILE_NUM_PHASES * HYPRE_AMG_PROFILE_NUM_STATS;
+   local    = hypre_ParAMGDataProfileData(amg_data);
+   max_data = hypre_CTAlloc(HYPRE_Real, size, HYPRE_MEMORY_HOST);
+   sum_data = hypre_CTAlloc(HYPRE_Real, size, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allreduce(local, max_data, size, HYPRE_MPI_REAL, hypre_MPI_MAX, comm);
+   hypre_MPI_Allreduce(local, sum_data, size, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+
+   if (my_id == 0)
+   {
+      if ((fp = fopen(filename, "w")) == NULL)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open output file for the profile\n");
+         hypre_TFree(max_data, HYPRE_MEMORY_HOST);
+         hypre_TFree(sum_data, HYPRE_MEMORY_HOST);
+         return hypre_error_flag;
+      }
+
+      hypre_fprintf(fp, "{\n");
+      hypre_fprintf(fp, "  \"solver\": \"BoomerAMG\",\n");
+      hypre_fprintf(fp, "  \"num_procs\": %d,\n", num_procs);
+      hypre_fprintf(fp, "  \"num_levels\": %d,\n", num_levels);
+      hypre_fprintf(fp, "  \"setup_reused\": %d,\n", hypre_ParAMGDataSetupReused(amg_data));
+      /* the default backend of the halo exchanges; each level records the
+       * backend of its matrix, to compare the per-level wait times */
+      hypre_fprintf(fp, "  \"comm_backend\": \"%s\",\n",
+                    hypre_HandleNeighborComm(hypre_handle()) ? "neighbor" :
+                    hypre_HandlePersistentComm(hypre_handle()) ? "persistent" : "isend_irecv");
+      hypre_fprintf(fp, "  \"node_aware_level\": %d,\n", hypre_ParAMGDataNodeAwareLevel(amg_data));
+      hypre_fprintf(fp, "  \"neighbor_comm_level\": %d,\n",
+                    hypre_ParAMGDataNeighborCommLevel(amg_data));
+      hypre_fprintf(fp, "  \"redist_threshold\": %d,\n", hypre_ParAMGDataRedistThreshold(amg_data));
+      hypre_fprintf(fp, "  \"levels\": [\n");
+      for (level = 0; level < num_levels; level++)
+      {
+         hypre_fprintf(fp, "    {\n");
+         hypre_fprintf(fp, "      \"level\": %d,\n", level);
+         hypre_fprintf(fp, "      \"rows\": %b,\n",
+                       A_array[level] ? hypre_ParCSRMatrixGlobalNumRows(A_array[level]) : 0);
+         hypre_fprintf(fp, "      \"nonzeros\": %.0f,\n",
+                       A_array[level] ? hypre_ParCSRMatrixDNumNonzeros(A_array[level]) : 0.0);
+         comm_pkg = A_array[level] ? hypre_ParCSRMatrixCommPkg(A_array[level]) : NULL;
+         hypre_fprintf(fp, "      \"comm_backend\": \"%s\",\n",
+                       (comm_pkg && hypre_ParCSRCommPkgUseNeighborComm(comm_pkg)) ? "neighbor" :
+                       (comm_pkg && hypre_ParCSRCommPkgNodeAware(comm_pkg)) ? "node_aware" :
+                       hypre_HandlePersistentComm(hypre_handle()) ? "persistent" : "isend_irecv");
+         for (first = 0; first < HYPRE_AMG_PROFILE_NUM_PHASES; first = last)
+         {
+            last = (first == 0) ? HYPRE_AMG_PROFILE_RELAX : HYPRE_AMG_PROFILE_NUM_PHASES;
+            hypre_fprintf(fp, "      \"%s\": {\n", (first == 0) ? "setup" : "solve");
+            for (phase = first; phase < last; phase++)
+            {
+               HYPRE_Int k = hypre_AMGProfileIndex(level, phase, 0);
+
+               time  = max_data[k + HYPRE_AMG_PROFILE_TIME];
+               bytes = sum_data[k + HYPRE_AMG_PROFILE_BYTES];
+               hypre_fprintf(fp, "        \"%s\": {\"time\": %e, \"wait\": %e, "
+                             "\"messages\": %.0f, \"bytes\": %.0f, \"calls\": %.0f, "
+                             "\"gbytes_per_s\": %e}%s\n",
+                             phase_names[phase], time,
+                             max_data[k + HYPRE_AMG_PROFILE_WAIT],
+                             sum_data[k + HYPRE_AMG_PROFILE_MESSAGES], bytes,
+                             max_data[k + HYPRE_AMG_PROFILE_CALLS],
+                             (time > 0.0) ? bytes / time * 1.0e-9 : 0.0,
+                             (phase < last - 1) ? "," : "");
+            }
+            hypre_fprintf(fp, "      }%s\n", (last < HYPRE_AMG_PROFILE_NUM_PHASES) ? "," : "");
+         }
+         hypre_fprintf(fp, "    }%s\n", (level < num_levels - 1) ? "," : "");
+      }
+      hypre_fprintf(fp, "  ]\n");
+      hypre_fprintf(fp, "}\n");
+
+      fclose(fp);
+   }
+
+   hypre_TFree(max_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(sum_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,470 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Redistribution of the coarse BoomerAMG levels onto fewer processors
+ *
+ * Once the average number of rows per processor of a coarse level drops
+ * below redist_threshold, the level is gathered onto every k-th processor:
+ * processor g*k receives the rows of processors g*k, ..., g*k+k-1, with k
+ * chosen such that the receiving processors get about redist_threshold rows
+ * each.  Since the row partitions are contiguous, the global numbering of
+ * the rows is kept.  The remaining levels are built by a BoomerAMG solver on
+ * the sub-communicator of the receiving processors, which inherits the
+ * parameters of this one and may thus redistribute again further down.
+ *
+ * In the cycle, the coarse grid solve of the redistributed level gathers f
+ * and u onto the receiving processors, which run one cycle of their solver,
+ * and scatters u back.  The other processors are idle in the meantime.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRedistributeSolverCreate
+ *
+ * Creates the solver of the levels below level p_level, with the
+ * parameters of amg_data.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Solver
+hypre_BoomerAMGRedistributeSolverCreate( hypre_ParAMGData *amg_data,
+                                         HYPRE_Int         p_level )
+{
+   HYPRE_Int   *grid_relax_type  = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int   *num_grid_sweeps  = hypre_ParAMGDataNumGridSweeps(amg_data);
+   HYPRE_Int    agg_num_levels   = hypre_ParAMGDataAggNumLevels(amg_data);
+   HYPRE_Int    node_aware_level = hypre_ParAMGDataNodeAwareLevel(amg_data);
+   HYPRE_Int    neighbor_comm_level = hypre_ParAMGDataNeighborCommLevel(amg_data);
+   HYPRE_Int    k;
+   HYPRE_Solver coarse_solver;
+
+   HYPRE_BoomerAMGCreate(&coarse_solver);
+   HYPRE_BoomerAMGSetMaxLevels(coarse_solver, hypre_ParAMGDataMaxLevels(amg_data) - p_level);
+   HYPRE_BoomerAMGSetMaxCoarseSize(coarse_solver, hypre_ParAMGDataMaxCoarseSize(amg_data));
+   HYPRE_BoomerAMGSetMinCoarseSize(coarse_solver, hypre_ParAMGDataMinCoarseSize(amg_data));
+   HYPRE_BoomerAMGSetSeqThreshold(coarse_solver, hypre_ParAMGDataSeqThreshold(amg_data));
+   HYPRE_BoomerAMGSetRedundant(coarse_solver, hypre_ParAMGDataRedundant(amg_data));
+   HYPRE_BoomerAMGSetRedistributeThreshold(coarse_solver,
+                                           hypre_ParAMGDataRedistThreshold(amg_data));
+
+   /* coarsening and interpolation */
+   HYPRE_BoomerAMGSetStrongThreshold(coarse_solver, hypre_ParAMGDataStrongThreshold(amg_data));
+   HYPRE_BoomerAMGSetMaxRowSum(coarse_solver, hypre_ParAMGDataMaxRowSum(amg_data));
+   HYPRE_BoomerAMGSetCoarsenType(coarse_solver, hypre_ParAMGDataCoarsenType(amg_data));
+   HYPRE_BoomerAMGSetMeasureType(coarse_solver, hypre_ParAMGDataMeasureType(amg_data));
+   HYPRE_BoomerAMGSetInterpType(coarse_solver, hypre_ParAMGDataInterpType(amg_data));
+   HYPRE_BoomerAMGSetTruncFactor(coarse_solver, hypre_ParAMGDataTruncFactor(amg_data));
+   HYPRE_BoomerAMGSetPMaxElmts(coarse_solver, hypre_ParAMGDataPMaxElmts(amg_data));
+   HYPRE_BoomerAMGSetRestriction(coarse_solver, hypre_ParAMGDataRestriction(amg_data));
+   HYPRE_BoomerAMGSetAggNumLevels(coarse_solver, hypre_max(agg_num_levels - p_level, 0));
+   HYPRE_BoomerAMGSetNumPaths(coarse_solver, hypre_ParAMGDataNumPaths(amg_data));
+   HYPRE_BoomerAMGSetAggInterpType(coarse_solver, hypre_ParAMGDataAggInterpType(amg_data));
+   HYPRE_BoomerAMGSetNumFunctions(coarse_solver, hypre_ParAMGDataNumFunctions(amg_data));
+
+   /* cycle: the first level of the solver is an intermediate level here, so
+    * only the down (1), up (2) and coarsest (3) settings are passed on */
+   HYPRE_BoomerAMGSetCycleType(coarse_solver, hypre_ParAMGDataCycleType(amg_data));
+   for (k = 1; k < 4; k++)
+   {
+      HYPRE_BoomerAMGSetCycleRelaxType(coarse_solver, grid_relax_type[k], k);
+      HYPRE_BoomerAMGSetCycleNumSweeps(coarse_solver, num_grid_sweeps[k], k);
+   }
+   HYPRE_BoomerAMGSetRelaxOrder(coarse_solver, hypre_ParAMGDataRelaxOrder(amg_data));
+   HYPRE_BoomerAMGSetRelaxWt(coarse_solver, hypre_ParAMGDataUserRelaxWeight(amg_data));
+
+   HYPRE_BoomerAMGSetSetupArena(coarse_solver, hypre_ParAMGDataSetupArena(amg_data));
+   if (node_aware_level > -1)
+   {
+      HYPRE_BoomerAMGSetNodeAwareLevel(coarse_solver, hypre_max(node_aware_level - p_level, 0));
+   }
+   if (neighbor_comm_level > -1)
+   {
+      HYPRE_BoomerAMGSetNeighborCommLevel(coarse_solver,
+                                          hypre_max(neighbor_comm_level - p_level, 0));
+   }
+
+   HYPRE_BoomerAMGSetMaxIter(coarse_solver, 1);
+   HYPRE_BoomerAMGSetTol(coarse_solver, 0);
+
+   return coarse_solver;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixCreateFromGlobalRows
+ *
+ * Creates the square matrix with the rows first_row, ..., first_row +
+ * num_rows - 1 on this processor (collective over comm).  The rows are given
+ * in CSR format with global column indices; the row partition must be
+ * contiguous in the ranks of comm.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixCreateFromGlobalRows( MPI_Comm             comm,
+                                        HYPRE_BigInt         global_rows,
+                                        HYPRE_BigInt         first_row,
+                                        HYPRE_Int            num_rows,
+                                        HYPRE_Int           *rows_i,
+                                        HYPRE_BigInt        *rows_j,
+                                        HYPRE_Complex       *rows_data,
+                                        hypre_ParCSRMatrix **A_ptr )
+{
+   hypre_ParCSRMatrix *A;
+   hypre_CSRMatrix    *diag, *offd;
+   HYPRE_Int          *diag_i, *diag_j, *offd_i, *offd_j;
+   HYPRE_Complex      *diag_data, *offd_data;
+   HYPRE_BigInt       *col_map_offd;
+   HYPRE_BigInt       *row_starts;
+   HYPRE_BigInt        last_row;
+   HYPRE_Int           num_nonzeros = rows_i[num_rows];
+   HYPRE_Int           num_cols_offd, diag_nnz, offd_nnz;
+   HYPRE_Int           i, j, cnt;
+
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+   row_starts = hypre_CTAlloc(HYPRE_BigInt, 2, HYPRE_MEMORY_HOST);
+   row_starts[0] = first_row;
+   row_starts[1] = first_row + (HYPRE_BigInt) num_rows;
+#else
+   {
+      HYPRE_Int num_procs;
+
+      hypre_MPI_Comm_size(comm, &num_procs);
+      row_starts = hypre_CTAlloc(HYPRE_BigInt, num_procs + 1, HYPRE_MEMORY_HOST);
+      hypre_MPI_Allgather(&first_row, 1, HYPRE_MPI_BIG_INT, row_starts, 1, HYPRE_MPI_BIG_INT,
+                          comm);
+      row_starts[num_procs] = global_rows;
+   }
+#endif
+   last_row = first_row + (HYPRE_BigInt) num_rows - 1;
+
+   /* columns of the offd part */
+   offd_nnz = 0;
+   for (j = 0; j < num_nonzeros; j++)
+   {
+      offd_nnz += (rows_j[j] < first_row || rows_j[j] > last_row);
+   }
+   diag_nnz = num_nonzeros - offd_nnz;
+   col_map_offd = hypre_CTAlloc(HYPRE_BigInt, offd_nnz, HYPRE_MEMORY_HOST);
+   cnt = 0;
+   for (j = 0; j < num_nonzeros; j++)
+   {
+      if (rows_j[j] < first_row || rows_j[j] > last_row)
+      {
+         col_map_offd[cnt++] = rows_j[j];
+      }
+   }
+   hypre_BigQsort0(col_map_offd, 0, offd_nnz - 1);
+   num_cols_offd = 0;
+   for (j = 0; j < offd_nnz; j++)
+   {
+      if (num_cols_offd == 0 || col_map_offd[j] != col_map_offd[num_cols_offd - 1])
+      {
+         col_map_offd[num_cols_offd++] = col_map_offd[j];
+      }
+   }
+
+   A = hypre_ParCSRMatrixCreate(comm, global_rows, global_rows,
+                                row_starts, row_starts,
+                                num_cols_offd, diag_nnz, offd_nnz);
+   hypre_ParCSRMatrixInitialize_v2(A, HYPRE_MEMORY_HOST);
+   diag      = hypre_ParCSRMatrixDiag(A);
+   offd      = hypre_ParCSRMatrixOffd(A);
+   diag_i    = hypre_CSRMatrixI(diag);
+   diag_j    = hypre_CSRMatrixJ(diag);
+   diag_data = hypre_CSRMatrixData(diag);
+   offd_i    = hypre_CSRMatrixI(offd);
+   offd_j    = hypre_CSRMatrixJ(offd);
+   offd_data = hypre_CSRMatrixData(offd);
+
+   diag_nnz = 0;
+   offd_nnz = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      diag_i[i] = diag_nnz;
+      offd_i[i] = offd_nnz;
+      for (j = rows_i[i]; j < rows_i[i+1]; j++)
+      {
+         if (rows_j[j] < first_row || rows_j[j] > last_row)
+         {
+            offd_j[offd_nnz]    = hypre_BigBinarySearch(col_map_offd, rows_j[j], num_cols_offd);
+            offd_data[offd_nnz] = rows_data[j];
+            offd_nnz++;
+         }
+         else
+         {
+            diag_j[diag_nnz]    = (HYPRE_Int) (rows_j[j] - first_row);
+            diag_data[diag_nnz] = rows_data[j];
+            diag_nnz++;
+         }
+      }
+   }
+   diag_i[num_rows] = diag_nnz;
+   offd_i[num_rows] = offd_nnz;
+
+   for (j = 0; j < num_cols_offd; j++)
+   {
+      hypre_ParCSRMatrixColMapOffd(A)[j] = col_map_offd[j];
+   }
+   hypre_TFree(col_map_offd, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRMatrixSetNumNonzeros(A);
+   hypre_ParCSRMatrixSetDNumNonzeros(A);
+   hypre_MatvecCommPkgCreate(A);
+
+   *A_ptr = A;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRedistributeSetup
+ *
+ * Gathers A_array[p_level] onto fewer processors and sets up the solver of
+ * the remaining levels on them (collective over the communicator of A).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRedistributeSetup( hypre_ParAMGData *amg_data,
+                                  HYPRE_Int         p_level )
+{
+   hypre_ParCSRMatrix  *A             = hypre_ParAMGDataAArray(amg_data)[p_level];
+   HYPRE_Int           *dof_func      = NULL;
+   HYPRE_Int            num_functions = hypre_ParAMGDataNumFunctions(amg_data);
+   HYPRE_Int            threshold     = hypre_ParAMGDataRedistThreshold(amg_data);
+   MPI_Comm             comm          = hypre_ParCSRMatrixComm(A);
+   HYPRE_BigInt         global_rows   = hypre_ParCSRMatrixGlobalNumRows(A);
+
+   hypre_CSRMatrix     *A_diag        = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix     *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int           *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int           *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Complex       *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int           *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int           *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Complex       *A_offd_data   = hypre_CSRMatrixData(A_offd);
+   HYPRE_BigInt        *col_map_offd  = hypre_ParCSRMatrixColMapOffd(A);
+   HYPRE_Int            num_rows      = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_BigInt         first_row     = hypre_ParCSRMatrixFirstRowIndex(A);
+
+   MPI_Comm             redist_comm, new_comm;
+   HYPRE_Int            num_procs, my_id, group_size, group_id, num_members;
+   HYPRE_Int            num_nonzeros;
+   HYPRE_Int           *row_sizes, *big_sizes = NULL;
+   HYPRE_BigInt        *big_j;
+   HYPRE_Complex       *big_data;
+   HYPRE_Int           *row_counts = NULL, *row_displs = NULL;
+   HYPRE_Int           *nnz_counts = NULL, *nnz_displs = NULL;
+
+   /* gathered rows, receiving processors only */
+   HYPRE_Int            red_rows = 0, red_nnz = 0;
+   HYPRE_Int           *red_i = NULL;
+   HYPRE_BigInt        *red_j = NULL;
+   HYPRE_Complex       *red_data = NULL;
+   HYPRE_Int           *red_dof_func = NULL;
+
+   HYPRE_Int            i, j, cnt;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   /* group size such that the receiving processors get about threshold rows */
+   group_size = (HYPRE_Int) ceil((HYPRE_Real) threshold * (HYPRE_Real) num_procs /
+                                 (HYPRE_Real) hypre_max(global_rows, 1));
+   group_size = hypre_min(hypre_max(group_size, 2), num_procs);
+   group_id   = my_id / group_size;
+
+   hypre_MPI_Comm_split(comm, group_id, my_id, &redist_comm);
+   hypre_MPI_Comm_split(comm, (my_id % group_size) ? hypre_MPI_UNDEFINED : 0, my_id, &new_comm);
+   hypre_MPI_Comm_size(redist_comm, &num_members);
+
+   /*-----------------------------------------------------------------------
+    * Rows of the group, with global column indices (diag part first, so
+    * that the diagonal stays the first entry of each row)
+    *-----------------------------------------------------------------------*/
+
+   num_nonzeros = A_diag_i[num_rows] + A_offd_i[num_rows];
+   row_sizes = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   big_j     = hypre_CTAlloc(HYPRE_BigInt, num_nonzeros, HYPRE_MEMORY_HOST);
+   big_data  = hypre_CTAlloc(HYPRE_Complex, num_nonzeros, HYPRE_MEMORY_HOST);
+   cnt = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      row_sizes[i] = A_diag_i[i+1] - A_diag_i[i] + A_offd_i[i+1] - A_offd_i[i];
+      for (j = A_diag_i[i]; j < A_diag_i[i+1]; j++)
+      {
+         big_j[cnt]      = first_row + (HYPRE_BigInt) A_diag_j[j];
+         big_data[cnt++] = A_diag_data[j];
+      }
+      for (j = A_offd_i[i]; j < A_offd_i[i+1]; j++)
+      {
+         big_j[cnt]      = col_map_offd[A_offd_j[j]];
+         big_data[cnt++] = A_offd_data[j];
+      }
+   }
+
+   if (new_comm != hypre_MPI_COMM_NULL)
+   {
+      row_counts = hypre_CTAlloc(HYPRE_Int, num_members, HYPRE_MEMORY_HOST);
+      row_displs = hypre_CTAlloc(HYPRE_Int, num_members + 1, HYPRE_MEMORY_HOST);
+      nnz_counts = hypre_CTAlloc(HYPRE_Int, num_members, HYPRE_MEMORY_HOST);
+      nnz_displs = hypre_CTAlloc(HYPRE_Int, num_members + 1, HYPRE_MEMORY_HOST);
+   }
+   hypre_MPI_Gather(&num_rows, 1, HYPRE_MPI_INT, row_counts, 1, HYPRE_MPI_INT, 0, redist_comm);
+   hypre_MPI_Gather(&num_nonzeros, 1, HYPRE_MPI_INT, nnz_counts, 1, HYPRE_MPI_INT, 0, redist_comm);
+   if (new_comm != hypre_MPI_COMM_NULL)
+   {
+      for (i = 0; i < num_members; i++)
+      {
+         row_displs[i+1] = row_displs[i] + row_counts[i];
+         nnz_displs[i+1] = nnz_displs[i] + nnz_counts[i];
+      }
+      red_rows  = row_displs[num_members];
+      red_nnz   = nnz_displs[num_members];
+      big_sizes = hypre_CTAlloc(HYPRE_Int, red_rows, HYPRE_MEMORY_HOST);
+      red_i     = hypre_CTAlloc(HYPRE_Int, red_rows + 1, HYPRE_MEMORY_HOST);
+      red_j     = hypre_CTAlloc(HYPRE_BigInt, red_nnz, HYPRE_MEMORY_HOST);
+      red_data  = hypre_CTAlloc(HYPRE_Complex, red_nnz, HYPRE_MEMORY_HOST);
+      if (num_functions > 1)
+      {
+         red_dof_func = hypre_CTAlloc(HYPRE_Int, red_rows, HYPRE_MEMORY_HOST);
+      }
+   }
+   hypre_MPI_Gatherv(row_sizes, num_rows, HYPRE_MPI_INT, big_sizes, row_counts, row_displs,
+                     HYPRE_MPI_INT, 0, redist_comm);
+   hypre_MPI_Gatherv(big_j, num_nonzeros, HYPRE_MPI_BIG_INT, red_j, nnz_counts, nnz_displs,
+                     HYPRE_MPI_BIG_INT, 0, redist_comm);
+   hypre_MPI_Gatherv(big_data, num_nonzeros, HYPRE_MPI_COMPLEX, red_data, nnz_counts, nnz_displs,
+                     HYPRE_MPI_COMPLEX, 0, redist_comm);
+   if (num_functions > 1)
+   {
+      dof_func = hypre_ParAMGDataDofFuncArray(amg_data)[p_level];
+      hypre_MPI_Gatherv(dof_func, num_rows, HYPRE_MPI_INT, red_dof_func, row_counts, row_displs,
+                        HYPRE_MPI_INT, 0, redist_comm);
+   }
+
+   hypre_TFree(row_sizes, HYPRE_MEMORY_HOST);
+   hypre_TFree(big_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(big_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_displs, HYPRE_MEMORY_HOST);
+   hypre_TFree(nnz_counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(nnz_displs, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Matrix and vectors on the receiving processors, and the solver of the
+    * remaining levels
+    *-----------------------------------------------------------------------*/
+
+   if (new_comm != hypre_MPI_COMM_NULL)
+   {
+      hypre_ParCSRMatrix *A_red;
+      hypre_ParVector    *F_red, *U_red;
+      HYPRE_BigInt       *row_starts;
+      HYPRE_Solver        coarse_solver;
+
+      for (i = 0; i < red_rows; i++)
+      {
+         red_i[i+1] = red_i[i] + big_sizes[i];
+      }
+      hypre_TFree(big_sizes, HYPRE_MEMORY_HOST);
+
+      hypre_ParCSRMatrixCreateFromGlobalRows(new_comm, global_rows, first_row, red_rows,
+                                             red_i, red_j, red_data, &A_red);
+      hypre_TFree(red_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(red_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(red_data, HYPRE_MEMORY_HOST);
+      row_starts = hypre_ParCSRMatrixRowStarts(A_red);
+
+      F_red = hypre_ParVectorCreate(new_comm, global_rows, row_starts);
+      U_red = hypre_ParVectorCreate(new_comm, global_rows, row_starts);
+      hypre_ParVectorOwnsPartitioning(F_red) = 0;
+      hypre_ParVectorOwnsPartitioning(U_red) = 0;
+      hypre_ParVectorInitialize(F_red);
+      hypre_ParVectorInitialize(U_red);
+
+      coarse_solver = hypre_BoomerAMGRedistributeSolverCreate(amg_data, p_level);
+      if (num_functions > 1)
+      {
+         HYPRE_BoomerAMGSetDofFunc(coarse_solver, red_dof_func);
+      }
+      hypre_BoomerAMGSetup(coarse_solver, A_red, F_red, U_red);
+
+      hypre_ParAMGDataCoarseSolver(amg_data) = coarse_solver;
+      hypre_ParAMGDataACoarse(amg_data)      = A_red;
+      hypre_ParAMGDataFCoarse(amg_data)      = F_red;
+      hypre_ParAMGDataUCoarse(amg_data)      = U_red;
+   }
+
+   hypre_ParAMGDataNewComm(amg_data)    = new_comm;
+   hypre_ParAMGDataRedistComm(amg_data) = redist_comm;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRedistributeCycle
+ *
+ * Coarse grid solve of the redistributed level p_level: one cycle of the
+ * solver of the remaining levels on the receiving processors.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRedistributeCycle( hypre_ParAMGData *amg_data,
+                                  HYPRE_Int         p_level,
+                                  hypre_ParVector **F_array,
+                                  hypre_ParVector **U_array )
+{
+   MPI_Comm         redist_comm = hypre_ParAMGDataRedistComm(amg_data);
+   HYPRE_Solver     coarse_solver = hypre_ParAMGDataCoarseSolver(amg_data);
+   hypre_ParVector *F_red = hypre_ParAMGDataFCoarse(amg_data);
+   hypre_ParVector *U_red = hypre_ParAMGDataUCoarse(amg_data);
+   HYPRE_Complex   *f_data = hypre_VectorData(hypre_ParVectorLocalVector(F_array[p_level]));
+   HYPRE_Complex   *u_data = hypre_VectorData(hypre_ParVectorLocalVector(U_array[p_level]));
+   HYPRE_Int        n = hypre_VectorSize(hypre_ParVectorLocalVector(U_array[p_level]));
+   HYPRE_Complex   *f_red_data = NULL, *u_red_data = NULL;
+   HYPRE_Int       *counts = NULL, *displs = NULL;
+   HYPRE_Int        num_members, i;
+
+   hypre_MPI_Comm_size(redist_comm, &num_members);
+
+   if (coarse_solver)
+   {
+      counts = hypre_CTAlloc(HYPRE_Int, num_members, HYPRE_MEMORY_HOST);
+      displs = hypre_CTAlloc(HYPRE_Int, num_members + 1, HYPRE_MEMORY_HOST);
+      f_red_data = hypre_VectorData(hypre_ParVectorLocalVector(F_red));
+      u_red_data = hypre_VectorData(hypre_ParVectorLocalVector(U_red));
+   }
+   hypre_MPI_Gather(&n, 1, HYPRE_MPI_INT, counts, 1, HYPRE_MPI_INT, 0, redist_comm);
+   if (coarse_solver)
+   {
+      for (i = 0; i < num_members; i++)
+      {
+         displs[i+1] = displs[i] + counts[i];
+      }
+   }
+
+   hypre_MPI_Gatherv(f_data, n, HYPRE_MPI_COMPLEX, f_red_data, counts, displs,
+                     HYPRE_MPI_COMPLEX, 0, redist_comm);
+   hypre_MPI_Gatherv(u_data, n, HYPRE_MPI_COMPLEX, u_red_data, counts, displs,
+                     HYPRE_MPI_COMPLEX, 0, redist_comm);
+
+   if (coarse_solver)
+   {
+      hypre_BoomerAMGSolve(coarse_solver, hypre_ParAMGDataACoarse(amg_data), F_red, U_red);
+   }
+
+   hypre_MPI_Scatterv(u_red_data, counts, displs, HYPRE_MPI_COMPLEX,
+                      u_data, n, HYPRE_MPI_COMPLEX, 0, redist_comm);
+
+   hypre_TFree(counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(displs, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,785 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Numeric-only re-setup of BoomerAMG for matrices with a fixed sparsity
+ * pattern (see HYPRE_BoomerAMGSetSetupReuse)
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetupSupported
+ *
+ * Returns 1 if the hierarchy built with the current parameters can be
+ * updated by hypre_BoomerAMGResetup, i.e. consists of C/F splittings, P and
+ * Galerkin coarse grid operators P^T (A P) only, and the smoothers only
+ * store data that hypre_BoomerAMGResetupSmoothers recomputes.  Recomputing
+ * P (setup_reuse 1) requires direct interpolation on all levels.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGResetupSupported( void               *amg_vdata,
+                                 hypre_ParCSRMatrix *A )
+{
+   hypre_ParAMGData *amg_data        = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int        *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int         interp_type     = hypre_ParAMGDataInterpType(amg_data);
+   HYPRE_Int         i;
+
+   if (hypre_ParAMGDataSetupReuse(amg_data) == 0)
+   {
+      return 0;
+   }
+
+   if (hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST)
+   {
+      return 0;
+   }
+
+   /* the weights of P are recomputed by direct interpolation only */
+   if (hypre_ParAMGDataSetupReuse(amg_data) == 1 &&
+       ((interp_type != 3 && interp_type != 15) ||
+        hypre_ParAMGDataAggNumLevels(amg_data) > 0))
+   {
+      return 0;
+   }
+
+   /* block systems */
+   if ((interp_type >= 20 && interp_type != 100) || interp_type == 11 || interp_type == 10)
+   {
+      return 0;
+   }
+   for (i = 0; i < 4; i++)
+   {
+      if (grid_relax_type[i] >= 20 || grid_relax_type[i] == 15)
+      {
+         return 0;
+      }
+   }
+
+   /* coarse grid operators other than P^T A P */
+   if (hypre_ParAMGDataRestriction(amg_data) ||
+       hypre_ParAMGDataNonGalerkNumTol(amg_data) > 0 ||
+       hypre_ParAMGDataNonGalTolArray(amg_data) ||
+       hypre_ParAMGDataADropTol(amg_data) > 0.0)
+   {
+      return 0;
+   }
+
+   /* additive cycles, complex smoothers and post-processed P */
+   if (hypre_ParAMGDataAdditive(amg_data) > -1 ||
+       hypre_ParAMGDataMultAdditive(amg_data) > -1 ||
+       hypre_ParAMGDataSimple(amg_data) > -1 ||
+       hypre_ParAMGDataSmoothNumLevels(amg_data) > 0 ||
+       hypre_ParAMGInterpRefine(amg_data) > 0 ||
+       hypre_ParAMGInterpVecVariant(amg_data) > 0)
+   {
+      return 0;
+   }
+
+   /* redundant or redistributed coarse grid solves */
+   if (hypre_ParAMGDataSeqThreshold(amg_data) > 0 ||
+       hypre_ParAMGDataRedistThreshold(amg_data) > 0)
+   {
+      return 0;
+   }
+#ifdef HYPRE_USING_DSUPERLU
+   if (hypre_ParAMGDataDSLUThreshold(amg_data) > 0)
+   {
+      return 0;
+   }
+#endif
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetupInitialize
+ *
+ * Called by a full setup that supports the re-setup: allocates the arrays
+ * of the products A*P kept for the next setup and of the plans of the
+ * products A*P and P^T*(A*P), and records the size of A.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGResetupInitialize( void               *amg_vdata,
+                                  hypre_ParCSRMatrix *A )
+{
+   hypre_ParAMGData *amg_data   = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Int         max_levels = hypre_ParAMGDataMaxLevels(amg_data);
+
+   hypre_BoomerAMGResetupDestroy(amg_data);
+
+   if (max_levels > 1)
+   {
+      hypre_ParAMGDataAPArray(amg_data) =
+         hypre_CTAlloc(hypre_ParCSRMatrix*, max_levels-1, HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataAPPlanArray(amg_data) =
+         hypre_CTAlloc(hypre_ParCSRMatMatPlan*, max_levels-1, HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataRAPPlanArray(amg_data) =
+         hypre_CTAlloc(hypre_ParCSRMatMatPlan*, max_levels-1, HYPRE_MEMORY_HOST);
+   }
+   hypre_ParAMGDataReuseNumRows(amg_data) =
+      hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+   hypre_ParAMGDataReuseNumNonzeros(amg_data) =
+      hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(A)) +
+      hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(A));
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetupDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGResetupDestroy( void *amg_vdata )
+{
+   hypre_ParAMGData        *amg_data       = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRMatrix     **AP_array       = hypre_ParAMGDataAPArray(amg_data);
+   hypre_ParCSRMatMatPlan **AP_plan_array  = hypre_ParAMGDataAPPlanArray(amg_data);
+   hypre_ParCSRMatMatPlan **RAP_plan_array = hypre_ParAMGDataRAPPlanArray(amg_data);
+   HYPRE_Int                num_levels     = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int                level;
+
+   if (AP_array)
+   {
+      for (level = 0; level < num_levels-1; level++)
+      {
+         hypre_ParCSRMatrixDestroy(AP_array[level]);
+      }
+      hypre_TFree(AP_array, HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataAPArray(amg_data) = NULL;
+   }
+   if (AP_plan_array)
+   {
+      for (level = 0; level < num_levels-1; level++)
+      {
+         hypre_ParCSRMatMatPlanDestroy(AP_plan_array[level]);
+         hypre_ParCSRMatMatPlanDestroy(RAP_plan_array[level]);
+      }
+      hypre_TFree(AP_plan_array, HYPRE_MEMORY_HOST);
+      hypre_TFree(RAP_plan_array, HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataAPPlanArray(amg_data) = NULL;
+      hypre_ParAMGDataRAPPlanArray(amg_data) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetupInterp
+ *
+ * Recomputes the weights of P, built by direct interpolation (see
+ * hypre_BoomerAMGBuildDirInterp), on its pattern.  If the interpolatory
+ * points of an F-row are not all neighbors of the row in A, or its diagonal
+ * is zero, P was not built this way and an error is returned, so that the
+ * caller falls back to a full setup instead of mixing new and old weights.
+ * Returns the global number of rows recomputed in *num_rows_ptr.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGResetupInterp( hypre_ParCSRMatrix *A,
+                              HYPRE_Int          *CF_marker,
+                              HYPRE_Int           num_functions,
+                              HYPRE_Int          *dof_func,
+                              hypre_ParCSRMatrix *P,
+                              HYPRE_BigInt       *num_rows_ptr )
+{
+   MPI_Comm             comm            = hypre_ParCSRMatrixComm(A);
+   hypre_ParCSRCommPkg *comm_pkg;
+   hypre_ParCSRCommHandle *comm_handle;
+
+   hypre_CSRMatrix *A_diag          = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int       *A_diag_i        = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j        = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Real      *A_diag_data     = hypre_CSRMatrixData(A_diag);
+   hypre_CSRMatrix *A_offd          = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int       *A_offd_i        = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int       *A_offd_j        = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Real      *A_offd_data     = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int        num_cols_A_offd = hypre_CSRMatrixNumCols(A_offd);
+   HYPRE_Int        n_fine          = hypre_CSRMatrixNumRows(A_diag);
+
+   hypre_CSRMatrix *P_diag          = hypre_ParCSRMatrixDiag(P);
+   HYPRE_Int       *P_diag_i        = hypre_CSRMatrixI(P_diag);
+   HYPRE_Int       *P_diag_j        = hypre_CSRMatrixJ(P_diag);
+   HYPRE_Real      *P_diag_data     = hypre_CSRMatrixData(P_diag);
+   hypre_CSRMatrix *P_offd          = hypre_ParCSRMatrixOffd(P);
+   HYPRE_Int       *P_offd_i        = hypre_CSRMatrixI(P_offd);
+   HYPRE_Int       *P_offd_j        = hypre_CSRMatrixJ(P_offd);
+   HYPRE_Real      *P_offd_data     = hypre_CSRMatrixData(P_offd);
+   HYPRE_Int        num_cols_P_diag = hypre_CSRMatrixNumCols(P_diag);
+   HYPRE_Int        num_cols_P_offd = hypre_CSRMatrixNumCols(P_offd);
+   HYPRE_BigInt    *col_map_offd_P  = hypre_ParCSRMatrixColMapOffd(P);
+   HYPRE_BigInt     first_coarse    = hypre_ParCSRMatrixFirstColDiag(P);
+
+   HYPRE_Int       *fine_to_coarse;
+   HYPRE_Int       *CF_marker_offd = NULL;
+   HYPRE_Int       *dof_func_offd  = NULL;
+   HYPRE_Int       *A_offd_to_P    = NULL;
+   HYPRE_BigInt    *big_buf_data   = NULL;
+   HYPRE_BigInt    *fine_to_coarse_offd = NULL;
+   HYPRE_Int       *int_buf_data   = NULL;
+   HYPRE_Int        num_sends, start, index, i, j, num_coarse;
+   HYPRE_BigInt     local_num_rows = 0;
+   HYPRE_Int        num_mismatch = 0;
+   HYPRE_Int        local_ok, ok;
+
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+   comm_pkg  = hypre_ParCSRMatrixCommPkg(A);
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+
+   /* local fine-to-coarse map; P_diag columns are numbered in the order of
+    * the C-points */
+   fine_to_coarse = hypre_TAlloc(HYPRE_Int, n_fine, HYPRE_MEMORY_HOST);
+   num_coarse = 0;
+   for (i = 0; i < n_fine; i++)
+   {
+      fine_to_coarse[i] = CF_marker[i] >= 0 ? num_coarse++ : -1;
+   }
+   /* collective, since the exchanges below involve all neighbors */
+   local_ok = (num_coarse == num_cols_P_diag);
+   hypre_MPI_Allreduce(&local_ok, &ok, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+   if (!ok)
+   {
+      hypre_TFree(fine_to_coarse, HYPRE_MEMORY_HOST);
+      *num_rows_ptr = 0;
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "C/F splitting does not match P!\n");
+      return hypre_error_flag;
+   }
+
+   /* CF_marker, dof_func and the global coarse index of the columns of A_offd */
+   if (num_cols_A_offd)
+   {
+      CF_marker_offd      = hypre_CTAlloc(HYPRE_Int,    num_cols_A_offd, HYPRE_MEMORY_HOST);
+      fine_to_coarse_offd = hypre_CTAlloc(HYPRE_BigInt, num_cols_A_offd, HYPRE_MEMORY_HOST);
+      A_offd_to_P         = hypre_CTAlloc(HYPRE_Int,    num_cols_A_offd, HYPRE_MEMORY_HOST);
+      if (num_functions > 1)
+      {
+         dof_func_offd = hypre_CTAlloc(HYPRE_Int, num_cols_A_offd, HYPRE_MEMORY_HOST);
+      }
+   }
+
+   int_buf_data = hypre_CTAlloc(HYPRE_Int, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                HYPRE_MEMORY_HOST);
+   big_buf_data = hypre_CTAlloc(HYPRE_BigInt, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                HYPRE_MEMORY_HOST);
+
+   index = 0;
+   for (i = 0; i < num_sends; i++)
+   {
+      start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+      for (j = start; j < hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1); j++)
+      {
+         int_buf_data[index] = CF_marker[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j)];
+         big_buf_data[index] = first_coarse +
+                               (HYPRE_BigInt) fine_to_coarse[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j)];
+         index++;
+      }
+   }
+   comm_handle = hypre_ParCSRCommHandleCreate(11, comm_pkg, int_buf_data, CF_marker_offd);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+   comm_handle = hypre_ParCSRCommHandleCreate(21, comm_pkg, big_buf_data, fine_to_coarse_offd);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   if (num_functions > 1)
+   {
+      index = 0;
+      for (i = 0; i < num_sends; i++)
+      {
+         start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+         for (j = start; j < hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1); j++)
+         {
+            int_buf_data[index++] = dof_func[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, j)];
+         }
+      }
+      comm_handle = hypre_ParCSRCommHandleCreate(11, comm_pkg, int_buf_data, dof_func_offd);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+   }
+
+   for (i = 0; i < num_cols_A_offd; i++)
+   {
+      A_offd_to_P[i] = CF_marker_offd[i] >= 0 ?
+                       hypre_BigBinarySearch(col_map_offd_P, fine_to_coarse_offd[i], num_cols_P_offd) : -1;
+   }
+
+   hypre_TFree(int_buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(big_buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(fine_to_coarse_offd, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i,j) reduction(+:local_num_rows,num_mismatch)
+#endif
+   {
+      HYPRE_Int  *P_marker      = hypre_TAlloc(HYPRE_Int, num_cols_P_diag, HYPRE_MEMORY_HOST);
+      HYPRE_Int  *P_marker_offd = hypre_TAlloc(HYPRE_Int, num_cols_P_offd, HYPRE_MEMORY_HOST);
+      HYPRE_Int   jj, i1, c, row_size, num_found;
+      HYPRE_Real  diagonal, a, sum_N_pos, sum_N_neg, sum_P_pos, sum_P_neg, alfa, beta;
+
+      for (j = 0; j < num_cols_P_diag; j++)
+      {
+         P_marker[j] = -1;
+      }
+      for (j = 0; j < num_cols_P_offd; j++)
+      {
+         P_marker_offd[j] = -1;
+      }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < n_fine; i++)
+      {
+         row_size = P_diag_i[i+1] - P_diag_i[i] + P_offd_i[i+1] - P_offd_i[i];
+         if (CF_marker[i] >= 0 || row_size == 0)
+         {
+            continue;
+         }
+
+         for (jj = P_diag_i[i]; jj < P_diag_i[i+1]; jj++)
+         {
+            P_marker[P_diag_j[jj]] = jj;
+         }
+         for (jj = P_offd_i[i]; jj < P_offd_i[i+1]; jj++)
+         {
+            P_marker_offd[P_offd_j[jj]] = jj;
+         }
+
+         /* sums over all neighbors (N) and the interpolatory points (P) */
+         diagonal  = A_diag_data[A_diag_i[i]];
+         sum_N_pos = sum_N_neg = sum_P_pos = sum_P_neg = 0.0;
+         num_found = 0;
+         for (jj = A_diag_i[i]+1; jj < A_diag_i[i+1]; jj++)
+         {
+            i1 = A_diag_j[jj];
+            a  = A_diag_data[jj];
+            if (num_functions == 1 || dof_func[i1] == dof_func[i])
+            {
+               if (a > 0) sum_N_pos += a; else sum_N_neg += a;
+            }
+            c = fine_to_coarse[i1];
+            if (c >= 0 && P_marker[c] >= 0)
+            {
+               if (a > 0) sum_P_pos += a; else sum_P_neg += a;
+               num_found++;
+            }
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         {
+            i1 = A_offd_j[jj];
+            a  = A_offd_data[jj];
+            if (num_functions == 1 || dof_func_offd[i1] == dof_func[i])
+            {
+               if (a > 0) sum_N_pos += a; else sum_N_neg += a;
+            }
+            c = A_offd_to_P[i1];
+            if (c >= 0 && P_marker_offd[c] >= 0)
+            {
+               if (a > 0) sum_P_pos += a; else sum_P_neg += a;
+               num_found++;
+            }
+         }
+
+         if (num_found == row_size && diagonal != 0.0)
+         {
+            alfa = sum_P_neg ? sum_N_neg/sum_P_neg/diagonal : 0.0;
+            beta = sum_P_pos ? sum_N_pos/sum_P_pos/diagonal : 0.0;
+
+            for (jj = A_diag_i[i]+1; jj < A_diag_i[i+1]; jj++)
+            {
+               c = fine_to_coarse[A_diag_j[jj]];
+               if (c >= 0 && P_marker[c] >= 0)
+               {
+                  a = A_diag_data[jj];
+                  P_diag_data[P_marker[c]] = a > 0 ? -beta*a : -alfa*a;
+               }
+            }
+            for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+            {
+               c = A_offd_to_P[A_offd_j[jj]];
+               if (c >= 0 && P_marker_offd[c] >= 0)
+               {
+                  a = A_offd_data[jj];
+                  P_offd_data[P_marker_offd[c]] = a > 0 ? -beta*a : -alfa*a;
+               }
+            }
+            local_num_rows++;
+         }
+         else
+         {
+            num_mismatch++;
+         }
+
+         for (jj = P_diag_i[i]; jj < P_diag_i[i+1]; jj++)
+         {
+            P_marker[P_diag_j[jj]] = -1;
+         }
+         for (jj = P_offd_i[i]; jj < P_offd_i[i+1]; jj++)
+         {
+            P_marker_offd[P_offd_j[jj]] = -1;
+         }
+      }
+
+      hypre_TFree(P_marker, HYPRE_MEMORY_HOST);
+      hypre_TFree(P_marker_offd, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_TFree(fine_to_coarse, HYPRE_MEMORY_HOST);
+   hypre_TFree(CF_marker_offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(dof_func_offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(A_offd_to_P, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRMatrixValuesChanged(P);
+
+   hypre_MPI_Allreduce(&local_num_rows, num_rows_ptr, 1, HYPRE_MPI_BIG_INT, hypre_MPI_SUM, comm);
+
+   if (num_mismatch)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "P is not a direct interpolation of A!\n");
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetupSmoothers
+ *
+ * Recomputes the smoother data that depends on the values of the operators:
+ * l1 norms, Chebyshev eigenvalue estimates and coefficients, and the
+ * Gaussian elimination on the coarsest grid.  Follows the choices made at
+ * the end of hypre_BoomerAMGSetup.  The Chebyshev eigenvalue estimates are
+ * kept for cheby_eig_reuse re-setups after they have been computed.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGResetupSmoothers( hypre_ParAMGData *amg_data )
+{
+   hypre_ParCSRMatrix **A_array         = hypre_ParAMGDataAArray(amg_data);
+   HYPRE_Int          **CF_marker_array = hypre_ParAMGDataCFMarkerArray(amg_data);
+   HYPRE_Int            num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int           *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int            relax_order     = hypre_ParAMGDataRelaxOrder(amg_data);
+   hypre_Vector       **l1_norms        = hypre_ParAMGDataL1Norms(amg_data);
+   HYPRE_Real          *max_eig_est     = hypre_ParAMGDataMaxEigEst(amg_data);
+   HYPRE_Real          *min_eig_est     = hypre_ParAMGDataMinEigEst(amg_data);
+   HYPRE_Real         **cheby_ds        = hypre_ParAMGDataChebyDS(amg_data);
+   HYPRE_Real         **cheby_coefs     = hypre_ParAMGDataChebyCoefs(amg_data);
+   HYPRE_Int            eig_reuse       = hypre_ParAMGDataChebyEigAge(amg_data) <
+                                          hypre_ParAMGDataChebyEigReuse(amg_data);
+   HYPRE_Int            rt1 = grid_relax_type[1];
+   HYPRE_Int            rt2 = grid_relax_type[2];
+   HYPRE_Int            rt3 = grid_relax_type[3];
+   HYPRE_Int            j, last, option, use_cf;
+
+   for (j = 0; j < num_levels; j++)
+   {
+      last = (j == num_levels-1);
+
+      /* l1 norms: the option of the last matching case in the setup */
+      option = 0;
+      use_cf = 0;
+      if (!last && (rt1 == 8 || rt1 == 13 || rt1 == 14 || rt2 == 8 || rt2 == 13 || rt2 == 14))
+      {
+         option = 4;
+         use_cf = relax_order;
+      }
+      else if (last && (rt3 == 8 || rt3 == 13 || rt3 == 14))
+      {
+         option = 4;
+      }
+      if (!last && (rt1 == 18 || rt2 == 18))
+      {
+         option = 1;
+         use_cf = relax_order;
+      }
+      else if (last && rt3 == 18)
+      {
+         option = 1;
+         use_cf = 0;
+      }
+      if (rt1 == 7 || rt2 == 7 || (last && rt3 == 7))
+      {
+         option = 5;
+         use_cf = 0;
+      }
+
+      if (option && l1_norms && l1_norms[j])
+      {
+         HYPRE_Real *l1_norm_data = NULL;
+
+         hypre_ParCSRComputeL1Norms(A_array[j], option, use_cf ? CF_marker_array[j] : NULL,
+                                    &l1_norm_data);
+         hypre_SeqVectorDestroy(l1_norms[j]);
+         l1_norms[j] = hypre_SeqVectorCreate(hypre_ParCSRMatrixNumRows(A_array[j]));
+         hypre_VectorData(l1_norms[j]) = l1_norm_data;
+         hypre_SeqVectorInitialize_v2(l1_norms[j], hypre_ParCSRMatrixMemoryLocation(A_array[j]));
+      }
+
+      /* Chebyshev */
+      if (option != 5 && cheby_coefs && (rt1 == 16 || rt2 == 16 || (last && rt3 == 16)))
+      {
+         HYPRE_Int   scale         = hypre_ParAMGDataChebyScale(amg_data);
+         HYPRE_Int   variant       = hypre_ParAMGDataChebyVariant(amg_data);
+         HYPRE_Int   cheby_order   = hypre_ParAMGDataChebyOrder(amg_data);
+         HYPRE_Int   cheby_eig_est = hypre_ParAMGDataChebyEigEst(amg_data);
+         HYPRE_Real  cheby_fraction = hypre_ParAMGDataChebyFraction(amg_data);
+         HYPRE_Real  max_eig, min_eig = 0;
+
+         if (eig_reuse)
+         {
+            max_eig = max_eig_est[j];
+            min_eig = min_eig_est[j];
+         }
+         else if (cheby_eig_est)
+         {
+            hypre_ParCSRMaxEigEstimateCG(A_array[j], scale, cheby_eig_est, &max_eig, &min_eig);
+         }
+         else
+         {
+            hypre_ParCSRMaxEigEstimate(A_array[j], scale, &max_eig);
+         }
+         max_eig_est[j] = max_eig;
+         min_eig_est[j] = min_eig;
+
+         hypre_TFree(cheby_coefs[j], HYPRE_MEMORY_HOST);
+         hypre_TFree(cheby_ds[j], HYPRE_MEMORY_HOST);
+         hypre_ParCSRRelax_Cheby_Setup(A_array[j], max_eig, min_eig, cheby_fraction,
+                                       cheby_order, scale, variant,
+                                       &cheby_coefs[j], &cheby_ds[j]);
+      }
+   }
+
+   if (cheby_coefs)
+   {
+      hypre_ParAMGDataChebyEigAge(amg_data) = eig_reuse ? hypre_ParAMGDataChebyEigAge(amg_data) + 1 : 0;
+   }
+
+   /* Gaussian elimination on the coarsest grid */
+   if ((rt3 == 9 || rt3 == 99 || rt3 == 199) && hypre_ParAMGDataGSSetup(amg_data))
+   {
+      MPI_Comm new_comm = hypre_ParAMGDataNewComm(amg_data);
+
+      hypre_TFree(hypre_ParAMGDataAMat(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataAInv(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataBVec(amg_data), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParAMGDataCommInfo(amg_data), HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataAMat(amg_data)     = NULL;
+      hypre_ParAMGDataAInv(amg_data)     = NULL;
+      hypre_ParAMGDataBVec(amg_data)     = NULL;
+      hypre_ParAMGDataCommInfo(amg_data) = NULL;
+      if (new_comm != hypre_MPI_COMM_NULL)
+      {
+         hypre_MPI_Comm_free(&new_comm);
+         hypre_ParAMGDataNewComm(amg_data) = hypre_MPI_COMM_NULL;
+      }
+
+      hypre_GaussElimSetup(amg_data, num_levels-1, rt3);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetup
+ *
+ * Numeric-only re-setup of the hierarchy of the previous setup for the
+ * matrix A with the same sparsity pattern: keeps the C/F splittings, the
+ * patterns of P and of the Galerkin products, and recomputes
+ *
+ *   - the weights of P on its pattern (setup_reuse 1, direct interpolation),
+ *   - AP = A*P and A_c = P^T*AP into their patterns,
+ *   - the smoother data.
+ *
+ * Sets *done to 1 on success.  Otherwise, e.g. if the size of A changed
+ * or a product leaves the stored pattern on any processor, *done is 0 and
+ * the caller does a full setup, which rebuilds the partially updated
+ * hierarchy.  Such a fallback is not reported as an error.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGResetup( void               *amg_vdata,
+                        hypre_ParCSRMatrix *A,
+                        hypre_ParVector    *f,
+                        hypre_ParVector    *u,
+                        HYPRE_Int          *done )
+{
+   MPI_Comm             comm          = hypre_ParCSRMatrixComm(A);
+   hypre_ParAMGData    *amg_data      = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRMatrix **A_array       = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix **P_array       = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix **AP_array      = hypre_ParAMGDataAPArray(amg_data);
+   hypre_ParCSRMatMatPlan **AP_plan_array  = hypre_ParAMGDataAPPlanArray(amg_data);
+   hypre_ParCSRMatMatPlan **RAP_plan_array = hypre_ParAMGDataRAPPlanArray(amg_data);
+   HYPRE_Int          **CF_marker_array = hypre_ParAMGDataCFMarkerArray(amg_data);
+   HYPRE_Int          **dof_func_array  = hypre_ParAMGDataDofFuncArray(amg_data);
+   HYPRE_Int            num_levels    = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int            num_functions = hypre_ParAMGDataNumFunctions(amg_data);
+   HYPRE_Int            setup_reuse   = hypre_ParAMGDataSetupReuse(amg_data);
+   HYPRE_Real          *setup_times   = hypre_ParAMGDataSetupTimes(amg_data);
+   HYPRE_Int            print_level   = hypre_ParAMGDataPrintLevel(amg_data);
+   HYPRE_Int            error_flag_in = hypre_error_flag;
+   HYPRE_BigInt         num_rows, total_rows = 0;
+   HYPRE_Int            local_ok, ok, level, i, my_id;
+   HYPRE_Real           time_begin, time_phase;
+   HYPRE_Real           profile_mark[HYPRE_AMG_PROFILE_NUM_STATS];
+
+   *done = 0;
+
+   if (!AP_array || !A_array || !A_array[0] ||
+       !hypre_BoomerAMGResetupSupported(amg_data, A))
+   {
+      return hypre_error_flag;
+   }
+
+   /* same local size and number of nonzeros on all processors */
+   local_ok = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A)) ==
+              hypre_ParAMGDataReuseNumRows(amg_data) &&
+              hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(A)) +
+              hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(A)) ==
+              hypre_ParAMGDataReuseNumNonzeros(amg_data);
+   hypre_MPI_Allreduce(&local_ok, &ok, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+   if (!ok)
+   {
+      return hypre_error_flag;
+   }
+
+   time_begin = hypre_MPI_Wtime();
+   for (i = 0; i < HYPRE_AMG_SETUP_NUM_TIMES; i++)
+   {
+      setup_times[i] = 0.0;
+   }
+
+   /* P, R and A are recomputed from the HYPRE_Complex coefficients */
+   hypre_BoomerAMGRestoreDoublePrecision(amg_data);
+
+   /* a new matrix object: objects sharing the partitioning of the old one */
+   if (A != A_array[0])
+   {
+      HYPRE_BigInt    *row_starts = hypre_ParCSRMatrixRowStarts(A);
+      hypre_ParVector *vecs[5];
+
+      vecs[0] = hypre_ParAMGDataVtemp(amg_data);
+      vecs[1] = hypre_ParAMGDataRtemp(amg_data);
+      vecs[2] = hypre_ParAMGDataPtemp(amg_data);
+      vecs[3] = hypre_ParAMGDataZtemp(amg_data);
+      vecs[4] = hypre_ParAMGDataResidual(amg_data);
+      for (i = 0; i < 5; i++)
+      {
+         if (vecs[i] && !hypre_ParVectorOwnsPartitioning(vecs[i]))
+         {
+            hypre_ParVectorPartitioning(vecs[i]) = row_starts;
+         }
+      }
+      if (num_levels > 1)
+      {
+         if (!hypre_ParCSRMatrixOwnsRowStarts(P_array[0]))
+         {
+            hypre_ParCSRMatrixRowStarts(P_array[0]) = row_starts;
+         }
+         if (!hypre_ParCSRMatrixOwnsRowStarts(AP_array[0]))
+         {
+            hypre_ParCSRMatrixRowStarts(AP_array[0]) = row_starts;
+         }
+      }
+      A_array[0] = A;
+   }
+   /* the values of A may have been changed in place: drop derived data such
+    * as the SELL-C-sigma shadows of its blocks */
+   hypre_ParCSRMatrixValuesChanged(A);
+   hypre_ParAMGDataFArray(amg_data)[0] = f;
+   hypre_ParAMGDataUArray(amg_data)[0] = u;
+
+   /* numeric products level by level; failures are collective */
+   hypre_error_flag = 0;
+   for (level = 0; level < num_levels-1; level++)
+   {
+      if (setup_reuse == 1)
+      {
+         time_phase = hypre_MPI_Wtime();
+         hypre_BoomerAMGProfileStart(amg_data, profile_mark);
+         hypre_BoomerAMGResetupInterp(A_array[level], CF_marker_array[level], num_functions,
+                                      dof_func_array[level], P_array[level], &num_rows);
+         total_rows += num_rows;
+         hypre_BoomerAMGProfileStop(amg_data, level, HYPRE_AMG_PROFILE_INTERP, profile_mark);
+         setup_times[HYPRE_AMG_SETUP_TIME_INTERP] += hypre_MPI_Wtime() - time_phase;
+      }
+
+      /* the plans of the products are built by the first re-setup */
+      time_phase = hypre_MPI_Wtime();
+      hypre_BoomerAMGProfileStart(amg_data, profile_mark);
+      if (!hypre_error_flag && !AP_plan_array[level])
+      {
+         hypre_ParCSRMatMatPlanCreate(A_array[level], P_array[level], AP_array[level], 0,
+                                      &AP_plan_array[level]);
+      }
+      if (!hypre_error_flag)
+      {
+         hypre_ParCSRMatMatPlanExecute(AP_plan_array[level],
+                                       A_array[level], P_array[level], AP_array[level]);
+      }
+      if (!hypre_error_flag && !RAP_plan_array[level])
+      {
+         hypre_ParCSRMatMatPlanCreate(P_array[level], AP_array[level], A_array[level+1], 1,
+                                      &RAP_plan_array[level]);
+      }
+      if (!hypre_error_flag)
+      {
+         hypre_ParCSRMatMatPlanExecute(RAP_plan_array[level],
+                                       P_array[level], AP_array[level], A_array[level+1]);
+      }
+      hypre_BoomerAMGProfileStop(amg_data, level, HYPRE_AMG_PROFILE_RAP, profile_mark);
+      setup_times[HYPRE_AMG_SETUP_TIME_RAP] += hypre_MPI_Wtime() - time_phase;
+
+      local_ok = (hypre_error_flag == 0);
+      hypre_MPI_Allreduce(&local_ok, &ok, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+      if (!ok)
+      {
+         /* the full setup that follows starts a new profile */
+         hypre_BoomerAMGProfileInitialize(amg_data);
+         hypre_error_flag = error_flag_in;
+         return hypre_error_flag;
+      }
+   }
+   hypre_error_flag = error_flag_in;
+
+   time_phase = hypre_MPI_Wtime();
+   hypre_BoomerAMGResetupSmoothers(amg_data);
+   setup_times[HYPRE_AMG_SETUP_TIME_SMOOTHER] = hypre_MPI_Wtime() - time_phase;
+
+   setup_times[HYPRE_AMG_SETUP_TIME_TOTAL] = hypre_MPI_Wtime() - time_begin;
+   setup_times[HYPRE_AMG_SETUP_TIME_OTHER] = setup_times[HYPRE_AMG_SETUP_TIME_TOTAL] -
+                                             setup_times[HYPRE_AMG_SETUP_TIME_INTERP] -
+                                             setup_times[HYPRE_AMG_SETUP_TIME_RAP] -
+                                             setup_times[HYPRE_AMG_SETUP_TIME_SMOOTHER];
+   hypre_ParAMGDataSetupReused(amg_data) = 1;
+   *done = 1;
+
+   if (print_level == 1 || print_level == 3)
+   {
+      hypre_MPI_Comm_rank(comm, &my_id);
+      if (my_id == 0)
+      {
+         hypre_printf("\n BoomerAMG numeric re-setup: %d levels", num_levels);
+         if (setup_reuse == 1)
+         {
+            hypre_printf(", %b rows of P recomputed", total_rows);
+         }
+         hypre_printf("\n");
+      }
+      hypre_BoomerAMGSetupTimesPrint(amg_data, comm);
+   }
+
+   return hypre_error_flag;
+}
@@ -13,6 +13,123 @@
 #define PRINT_CF 0
 
 #define DEBUG_SAVE_ALL_OPS 0
+
+/*--------------------------------------------------------------------------
+ * Adds the time since phase_mark to the current setup phase and switches to
+ * the phase new_phase (see HYPRE_AMG_SETUP_TIME_* in par_amg.h) on the given
+ * level.  The per-level profile gets the phase on the level it started on.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGSetupPhase( hypre_ParAMGData *amg_data,
+                           HYPRE_Int        *phase_ptr,
+                           HYPRE_Int        *level_ptr,
+                           HYPRE_Real       *phase_mark,
+                           HYPRE_Int         new_phase,
+                           HYPRE_Int         level )
+{
+   HYPRE_Real time = hypre_MPI_Wtime();
+
+   hypre_ParAMGDataSetupTimes(amg_data)[*phase_ptr] += time - phase_mark[HYPRE_AMG_PROFILE_TIME];
+   if (*phase_ptr <= HYPRE_AMG_SETUP_TIME_RAP)
+   {
+      hypre_BoomerAMGProfileStop(amg_data, *level_ptr, *phase_ptr, phase_mark);
+   }
+   else
+   {
+      hypre_BoomerAMGProfileStart(amg_data, phase_mark);
+   }
+   *phase_ptr = new_phase;
+   *level_ptr = level;
+}
+
+/*--------------------------------------------------------------------------
+ * Builds the node-aware halo exchanges (see par_csr_node_aware.c) of the
+ * matrices of the levels from hypre_ParAMGDataNodeAwareLevel on, whose
+ * matvecs and relaxation sweeps then send one message per pair of nodes.
+ * Packages that are already node-aware, e.g., after a reused setup, are
+ * kept.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGSetupNodeAware( hypre_ParAMGData *amg_data )
+{
+   HYPRE_Int            node_aware_level = hypre_ParAMGDataNodeAwareLevel(amg_data);
+   HYPRE_Int            num_levels       = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRMatrix **A_array          = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix **P_array          = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix **R_array          = hypre_ParAMGDataRArray(amg_data);
+   hypre_ParCSRMatrix  *M[3];
+   HYPRE_Int            level, i;
+
+   if (node_aware_level < 0)
+   {
+      return;
+   }
+
+   for (level = node_aware_level; level < num_levels; level++)
+   {
+      M[0] = A_array[level];
+      M[1] = (level < num_levels - 1) ? P_array[level] : NULL;
+      M[2] = (level < num_levels - 1 && R_array[level] != M[1]) ? R_array[level] : NULL;
+      for (i = 0; i < 3; i++)
+      {
+         if (M[i] == NULL)
+         {
+            continue;
+         }
+         if (!hypre_ParCSRMatrixCommPkg(M[i]))
+         {
+            hypre_MatvecCommPkgCreate(M[i]);
+         }
+         hypre_ParCSRCommPkgCreateNodeAware(hypre_ParCSRMatrixCommPkg(M[i]));
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * Selects the backend of the halo exchanges of A, P and R on each level if
+ * hypre_ParAMGDataNeighborCommLevel is set: point-to-point messages below
+ * that level, neighborhood collectives from that level on.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_BoomerAMGSetupNeighborComm( hypre_ParAMGData *amg_data )
+{
+   HYPRE_Int            neighbor_comm_level = hypre_ParAMGDataNeighborCommLevel(amg_data);
+   HYPRE_Int            num_levels          = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRMatrix **A_array             = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix **P_array             = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix **R_array             = hypre_ParAMGDataRArray(amg_data);
+   hypre_ParCSRMatrix  *M[3];
+   HYPRE_Int            level, i;
+
+   if (neighbor_comm_level < 0)
+   {
+      return;
+   }
+
+   for (level = 0; level < num_levels; level++)
+   {
+      M[0] = A_array[level];
+      M[1] = (level < num_levels - 1) ? P_array[level] : NULL;
+      M[2] = (level < num_levels - 1 && R_array[level] != M[1]) ? R_array[level] : NULL;
+      for (i = 0; i < 3; i++)
+      {
+         if (M[i] == NULL)
+         {
+            continue;
+         }
+         if (!hypre_ParCSRMatrixCommPkg(M[i]))
+         {
+            hypre_MatvecCommPkgCreate(M[i]);
+         }
+         hypre_ParCSRCommPkgSetNeighborComm(hypre_ParCSRMatrixCommPkg(M[i]),
+                                            level >= neighbor_comm_level);
+      }
+   }
+}
+
 /*****************************************************************************
  *
  * Routine for driving the setup phase of AMG
@@ -108,6 +225,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    hypre_Vector       **l1_norms = NULL;
    HYPRE_Real         **cheby_ds = NULL;
    HYPRE_Real         **cheby_coefs = NULL;
+   HYPRE_Int            mc_relax[4];
 
    HYPRE_Int       old_num_levels, num_levels;
    HYPRE_Int       level;
@@ -121,9 +239,11 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    HYPRE_Int       rest, tms, indx;
    HYPRE_Real      size;
    HYPRE_Int       not_finished_coarsening = 1;
+   HYPRE_Int       redistribute = 0;
    HYPRE_Int       coarse_threshold = hypre_ParAMGDataMaxCoarseSize(amg_data);
    HYPRE_Int       min_coarse_size = hypre_ParAMGDataMinCoarseSize(amg_data);
    HYPRE_Int       seq_threshold = hypre_ParAMGDataSeqThreshold(amg_data);
+   HYPRE_Int       redist_threshold = hypre_ParAMGDataRedistThreshold(amg_data);
    HYPRE_Int       j, k;
    HYPRE_Int       num_procs,my_id,num_threads;
    HYPRE_Int      *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
@@ -204,6 +324,17 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    HYPRE_Real      wall_time;   /* for debugging instrumentation */
    HYPRE_Int       add_end;
 
+   /* numeric-only re-setup and setup phase times */
+   HYPRE_Int       setup_reuse;
+   HYPRE_Int       setup_reused = 0;
+   hypre_Arena    *setup_arena = NULL;
+   hypre_Arena    *prev_arena;
+   HYPRE_Int       prev_stats_level;
+   HYPRE_Int       setup_phase  = HYPRE_AMG_SETUP_TIME_OTHER;
+   HYPRE_Real      setup_begin  = hypre_MPI_Wtime();
+   HYPRE_Int       phase_level  = 0;
+   HYPRE_Real      phase_mark[HYPRE_AMG_PROFILE_NUM_STATS];
+
 #ifdef HYPRE_USING_DSUPERLU
    HYPRE_Int       dslu_threshold = hypre_ParAMGDataDSLUThreshold(amg_data);
 #endif
@@ -280,6 +411,28 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    if (num_procs == 1) seq_threshold = 0;
    if (setup_type == 0) return hypre_error_flag;
 
+   for (i = 0; i < HYPRE_AMG_SETUP_NUM_TIMES; i++)
+   {
+      hypre_ParAMGDataSetupTimes(amg_data)[i] = 0.0;
+   }
+   hypre_ParAMGDataSetupReused(amg_data) = 0;
+   hypre_BoomerAMGProfileInitialize(amg_data);
+   hypre_BoomerAMGProfileStart(amg_data, phase_mark);
+   phase_mark[HYPRE_AMG_PROFILE_TIME] = setup_begin;
+
+   hypre_MemoryStatsPushCategory(HYPRE_MEMORY_CATEGORY_AMG);
+
+   /* numeric-only update of the previous hierarchy, if possible */
+   hypre_BoomerAMGResetup(amg_data, A, f, u, &setup_reused);
+   if (setup_reused)
+   {
+      hypre_BoomerAMGSetupNodeAware(amg_data);
+      hypre_BoomerAMGSetupNeighborComm(amg_data);
+      hypre_BoomerAMGSetupMixedPrecision(amg_data);
+      hypre_MemoryStatsPopCategory();
+      return hypre_error_flag;
+   }
+
    S = NULL;
 
    A_array = hypre_ParAMGDataAArray(amg_data);
@@ -332,7 +485,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    /* probably should disable stuff like smooth num levels at some point */
 
 
-   if (grid_relax_type[0] >= 20) /* block relaxation choosen */
+   /* block relaxation choosen (not the multicolor Gauss-Seidel, 40-42) */
+   if (grid_relax_type[0] >= 20 && (grid_relax_type[0] < 40 || grid_relax_type[0] > 42))
    {
 
       if (!((interp_type >= 20 && interp_type != 100) || interp_type == 11 || interp_type == 10 ) )
@@ -343,7 +497,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
       for (i=1; i < 3; i++)
       {
-         if (grid_relax_type[i] < 20)
+         if (grid_relax_type[i] < 20 || (grid_relax_type[i] >= 40 && grid_relax_type[i] <= 42))
          {
             grid_relax_type[i] = 23;
          }
@@ -363,7 +517,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       }
       for (i=0; i < 3; i++)
       {
-         if (grid_relax_type[i] < 20)
+         if (grid_relax_type[i] < 20 || (grid_relax_type[i] >= 40 && grid_relax_type[i] <= 42))
             grid_relax_type[i] = 23;
       }
 
@@ -380,6 +534,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    /* free up storage in case of new setup without previous destroy */
 
+   hypre_BoomerAMGResetupDestroy(amg_data);
+
    if (A_array || A_block_array || P_array || P_block_array || CF_marker_array ||
        dof_func_array || R_array || R_block_array)
    {
@@ -517,6 +673,12 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          hypre_ParAMGDataNewComm(amg_data) = hypre_MPI_COMM_NULL;
       }
 
+      if (hypre_ParAMGDataRedistComm(amg_data) != hypre_MPI_COMM_NULL)
+      {
+         hypre_MPI_Comm_free (&hypre_ParAMGDataRedistComm(amg_data));
+         hypre_ParAMGDataRedistComm(amg_data) = hypre_MPI_COMM_NULL;
+      }
+
       if (amg)
       {
          hypre_BoomerAMGDestroy (amg);
@@ -541,6 +703,17 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
          hypre_TFree(hypre_ParAMGDataL1Norms(amg_data), HYPRE_MEMORY_HOST);
       }
+      if (hypre_ParAMGDataMCNumColors(amg_data))
+      {
+         for (i = 0; i < old_num_levels; i++)
+         {
+            hypre_TFree(hypre_ParAMGDataMCColorStarts(amg_data)[i], HYPRE_MEMORY_HOST);
+            hypre_TFree(hypre_ParAMGDataMCColorRows(amg_data)[i], HYPRE_MEMORY_HOST);
+         }
+         hypre_TFree(hypre_ParAMGDataMCNumColors(amg_data), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParAMGDataMCColorStarts(amg_data), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParAMGDataMCColorRows(amg_data), HYPRE_MEMORY_HOST);
+      }
       if (smooth_num_levels && smoother)
       {
          if (smooth_num_levels > old_num_levels-1)
@@ -867,12 +1040,35 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_ParAMGDataSmoother(amg_data) = smoother;
    }
 
+   /* keep the products A*P for a numeric-only re-setup */
+   setup_reuse = hypre_BoomerAMGResetupSupported(amg_data, A);
+   if (setup_reuse)
+   {
+      hypre_BoomerAMGResetupInitialize(amg_data, A);
+   }
+
+   /* host work arrays of the interpolation routines are taken from an
+    * arena that is rewound at each level (NULL: regular allocations) */
+   if (hypre_ParAMGDataSetupArena(amg_data))
+   {
+      setup_arena = hypre_ArenaCreate(0);
+   }
+   prev_arena = hypre_HandleSetupArena(hypre_handle());
+   hypre_HandleSetupArena(hypre_handle()) = setup_arena;
+   prev_stats_level = hypre_MemoryStatsSetLevel(-1);
+
    /*-----------------------------------------------------
     *  Enter Coarsening Loop
     *-----------------------------------------------------*/
 
    while (not_finished_coarsening)
    {
+      hypre_ArenaReset(setup_arena);
+      hypre_MemoryStatsSetLevel(level);
+
+      hypre_BoomerAMGSetupPhase(amg_data, &setup_phase, &phase_level, phase_mark,
+                                HYPRE_AMG_SETUP_TIME_OTHER, level);
+
       /* only do nodal coarsening on a fixed number of levels */
       if (level >= nodal_levels)
       {
@@ -975,6 +1171,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
          /**** Get the Strength Matrix ****/
 
+         hypre_BoomerAMGSetupPhase(amg_data, &setup_phase, &phase_level, phase_mark,
+                                HYPRE_AMG_SETUP_TIME_STRENGTH, level);
+
          if (hypre_ParAMGDataGSMG(amg_data) == 0)
          {
             if (nodal) /* if we are solving systems and
@@ -1087,6 +1286,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
          /**** Do the appropriate coarsening ****/
 
+         hypre_BoomerAMGSetupPhase(amg_data, &setup_phase, &phase_level, phase_mark,
+                                HYPRE_AMG_SETUP_TIME_COARSEN, level);
+
          if (nodal == 0) /* no nodal coarsening */
          {
             if (coarsen_type == 6)
@@ -1108,6 +1310,10 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
            {
 #ifdef HYPRE_MIXEDINT
               hypre_error_w_msg(HYPRE_ERROR_GENERIC,"CGC coarsening is not available in mixedint mode!");
+              hypre_HandleSetupArena(hypre_handle()) = prev_arena;
+              hypre_ArenaDestroy(setup_arena);
+              hypre_MemoryStatsSetLevel(prev_stats_level);
+              hypre_MemoryStatsPopCategory();
               return hypre_error_flag;
 #endif
               hypre_BoomerAMGCoarsenCGCb(S, A_array[level], measure_type, coarsen_type,
@@ -1499,6 +1705,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
 
          /*****xxxxxxxxxxxxx changes for min_coarse_size  end */
+         hypre_BoomerAMGSetupPhase(amg_data, &setup_phase, &phase_level, phase_mark,
+                                HYPRE_AMG_SETUP_TIME_INTERP, level);
+
          if (level < agg_num_levels)
          {
             if (nodal == 0)
@@ -2618,6 +2827,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
        * Build coarse-grid operator, A_array[level+1] by R*A*P
        *--------------------------------------------------------------*/
 
+      hypre_BoomerAMGSetupPhase(amg_data, &setup_phase, &phase_level, phase_mark,
+                                HYPRE_AMG_SETUP_TIME_RAP, level);
+
       if (debug_flag==1) wall_time = time_getWallclockSeconds();
 
       if (block_mode)
@@ -2711,7 +2923,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             hypre_ParCSRMatrixPrintIJ(A_H, 1, 1, file);
 #endif
          }
-         else if (rap2)
+         else if (rap2 || setup_reuse)
          {
             /* Use two matrix products to generate A_H */
             hypre_ParCSRMatrix *Q = NULL;
@@ -2732,8 +2944,16 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
             {
                hypre_MatvecCommPkgCreate(A_H);
             }
-            /* Delete AP */
-            hypre_ParCSRMatrixDestroy(Q);
+            if (setup_reuse)
+            {
+               /* keep AP, the re-setup computes its values in place */
+               hypre_ParAMGDataAPArray(amg_data)[level] = Q;
+            }
+            else
+            {
+               /* Delete AP */
+               hypre_ParCSRMatrixDestroy(Q);
+            }
          }
          else
          {
@@ -2802,11 +3022,31 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          {
             not_finished_coarsening = 0;
          }
+         /* gather the remaining levels onto fewer processors */
+         else if (redist_threshold > 0 && num_procs > 1 && !block_mode && !nodal &&
+                  additive < 0 && mult_additive < 0 && simple < 0 &&
+                  coarse_size < (HYPRE_BigInt) redist_threshold * (HYPRE_BigInt) num_procs)
+         {
+            not_finished_coarsening = 0;
+            redistribute = 1;
+         }
       }
    }  /* end of coarsening loop: while (not_finished_coarsening) */
 
+   hypre_HandleSetupArena(hypre_handle()) = prev_arena;
+   hypre_ArenaDestroy(setup_arena);
+   hypre_MemoryStatsSetLevel(prev_stats_level);
+
+   hypre_BoomerAMGSetupPhase(amg_data, &setup_phase, &phase_level, phase_mark,
+                                HYPRE_AMG_SETUP_TIME_SMOOTHER, level);
+
+   /* redistributed coarse levels */
+   if (redistribute)
+   {
+      hypre_BoomerAMGRedistributeSetup(amg_data, level);
+   }
    /* redundant coarse grid solve */
-   if (  (seq_threshold >= coarse_threshold) && (coarse_size > (HYPRE_BigInt)coarse_threshold) && (level != max_levels-1))
+   else if (  (seq_threshold >= coarse_threshold) && (coarse_size > (HYPRE_BigInt)coarse_threshold) && (level != max_levels-1))
    {
       hypre_seqAMGSetup( amg_data, level, coarse_threshold);
 
@@ -2903,6 +3143,25 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_ParAMGDataL1Norms(amg_data) = l1_norms;
    }
 
+   /* multicolor Gauss-Seidel: coloring of the rows of each level */
+   for (j = 0; j < 4; j++)
+   {
+      mc_relax[j] = (grid_relax_type[j] >= 40 && grid_relax_type[j] <= 42);
+   }
+   if (mc_relax[1] || mc_relax[2] || mc_relax[3])
+   {
+      hypre_ParAMGDataMCNumColors(amg_data) = hypre_CTAlloc(HYPRE_Int, num_levels, HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataMCColorStarts(amg_data) = hypre_CTAlloc(HYPRE_Int *, num_levels, HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataMCColorRows(amg_data) = hypre_CTAlloc(HYPRE_Int *, num_levels, HYPRE_MEMORY_HOST);
+      for (j = 0; j < num_levels; j++)
+      {
+         hypre_BoomerAMGRelaxMulticolorSetup(A_array[j],
+                                             &hypre_ParAMGDataMCNumColors(amg_data)[j],
+                                             &hypre_ParAMGDataMCColorStarts(amg_data)[j],
+                                             &hypre_ParAMGDataMCColorRows(amg_data)[j]);
+      }
+   }
+
    /* Chebyshev */
    if (grid_relax_type[0] == 16 ||grid_relax_type[1] == 16 || grid_relax_type[2] == 16 || grid_relax_type[3] == 16)
    {
@@ -2914,6 +3173,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       cheby_coefs = hypre_CTAlloc(HYPRE_Real *, num_levels, HYPRE_MEMORY_HOST);
       hypre_ParAMGDataChebyDS(amg_data) = cheby_ds;
       hypre_ParAMGDataChebyCoefs(amg_data) = cheby_coefs;
+      hypre_ParAMGDataChebyEigAge(amg_data) = 0;
    }
 
    /* CG */
@@ -3135,6 +3395,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       {
 #ifdef HYPRE_MIXEDINT
          hypre_error_w_msg(HYPRE_ERROR_GENERIC,"Euclid smoothing is not available in mixedint mode!");
+         hypre_MemoryStatsPopCategory();
          return hypre_error_flag;
 #endif
          HYPRE_EuclidCreate(comm, &smoother[j]);
@@ -3176,6 +3437,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       {
 #ifdef HYPRE_MIXEDINT
          hypre_error_w_msg(HYPRE_ERROR_GENERIC,"ParaSails smoothing is not available in mixedint mode!");
+         hypre_MemoryStatsPopCategory();
          return hypre_error_flag;
 #endif
          HYPRE_ParCSRParaSailsCreate(comm, &smoother[j]);
@@ -3191,6 +3453,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       {
 #ifdef HYPRE_MIXEDINT
          hypre_error_w_msg(HYPRE_ERROR_GENERIC,"pilut smoothing is not available in mixedint mode!");
+         hypre_MemoryStatsPopCategory();
          return hypre_error_flag;
 #endif
          HYPRE_ParCSRPilutCreate(comm, &smoother[j]);
@@ -3242,6 +3505,10 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_CreateLambda(amg_data);
    }
 
+   hypre_BoomerAMGSetupPhase(amg_data, &setup_phase, &phase_level, phase_mark,
+                                HYPRE_AMG_SETUP_TIME_OTHER, level);
+   hypre_ParAMGDataSetupTimes(amg_data)[HYPRE_AMG_SETUP_TIME_TOTAL] = hypre_MPI_Wtime() - setup_begin;
+
    /*-----------------------------------------------------------------------
     * Print some stuff
     *-----------------------------------------------------------------------*/
@@ -3249,6 +3516,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    if (amg_print_level == 1 || amg_print_level == 3)
    {
       hypre_BoomerAMGSetupStats(amg_data,A);
+      hypre_BoomerAMGSetupTimesPrint(amg_data, comm);
    }
 
    /* print out CF info to plot grids in matlab (see 'tools/AMGgrids.m') */
@@ -3424,6 +3692,22 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 }
 #endif
 
+   /* the coarse grid operators use the SELL-C-sigma options of A */
+   for (j = 1; j < num_levels; j++)
+   {
+      hypre_ParCSRMatrixSetSellCSigma(A_array[j],
+                                      hypre_CSRMatrixSellChunkSize(hypre_ParCSRMatrixDiag(A_array[0])),
+                                      hypre_CSRMatrixSellSortScope(hypre_ParCSRMatrixDiag(A_array[0])));
+   }
+
+   hypre_BoomerAMGSetupNodeAware(amg_data);
+   hypre_BoomerAMGSetupNeighborComm(amg_data);
+
+   /* store (parts of) the hierarchy in reduced precision */
+   hypre_BoomerAMGSetupMixedPrecision(amg_data);
+
+   hypre_MemoryStatsPopCategory();
+
    HYPRE_ANNOTATION_END("BoomerAMG.setup");
 
    return(hypre_error_flag);
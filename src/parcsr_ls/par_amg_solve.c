@@ -80,6 +80,12 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
    hypre_ParVector  *Vtemp;
    hypre_ParVector  *Residual;
 
+   /* several right-hand sides: block cycle */
+   if (hypre_ParVectorNumVectors(f) > 1)
+   {
+      return hypre_BoomerAMGMultiSolve(amg_vdata, A, f, u);
+   }
+
    HYPRE_ANNOTATION_BEGIN("BoomerAMG.solve");
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm,&my_id);
@@ -110,6 +116,9 @@ hypre_BoomerAMGSolve( void               *amg_vdata,
 
    A_block_array = hypre_ParAMGDataABlockArray(amg_data);
 
+   /* the relaxation types may have changed since the setup */
+   hypre_BoomerAMGCheckMixedPrecision(amg_data);
+
 
    /*   Vtemp = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A_array[0]),
         hypre_ParCSRMatrixGlobalNumRows(A_array[0]),
@@ -32,9 +32,20 @@ this is rlx 11 if scale = 0, and 16 if scale == 1
 variant 1: modified cheby: T(t)* f(t) where f(t) = (1-b/t)
 this is rlx 15 if scale = 0, and 17 if scale == 1
 
+variant 2: fourth-kind chebyshev (Lottes, "Optimal polynomial smoothers
+for multigrid V-cycles", 2023), applied with its three-term recurrence
+instead of explicit coefficients.  Only the upper bound of the spectrum is
+used, i.e., min_eig and fraction are ignored.
+
+variant 3: fourth-kind chebyshev with the optimized weights of Lottes
+
 ratio indicates the percentage of the whole spectrum to use (so .5
 means half, and .1 means 10percent)
 
+The solve makes one pass over the matrix for each power of A: the matvec
+is fused with the update of the polynomial recurrence, and the vectors
+are streamed only once per step.
+
 
 *******************************************************************************/
 
@@ -88,7 +99,26 @@ HYPRE_Int hypre_ParCSRRelax_Cheby_Setup(hypre_ParCSRMatrix *A, /* matrix to rela
    theta = (upper_bound + lower_bound)/2;
    delta = (upper_bound - lower_bound)/2;
 
-   if (variant == 1 )
+   if (variant == 2 || variant == 3)
+   {
+      /* fourth kind: coefs[0] is the inverse of the upper bound, coefs[k]
+         the weight of the k-th correction.  The optimized weights minimize
+         max_t t p(t)^2/(1 - p(t)^2) over (0,1], p the error polynomial. */
+      static const HYPRE_Real opt_weights[4][4] =
+      {
+         {1.12500000000000, 0.0, 0.0, 0.0},
+         {1.02387287570313, 1.26408905371085, 0.0, 0.0},
+         {1.00842544782028, 1.08867839208730, 1.33753125909618, 0.0},
+         {1.00391310427285, 1.04035811188593, 1.14863498546254, 1.38268869241000}
+      };
+
+      coefs[0] = 1.0/upper_bound;
+      for (j = 1; j <= order; j++)
+      {
+         coefs[j] = (variant == 3) ? opt_weights[order-1][j-1] : 1.0;
+      }
+   }
+   else if (variant == 1 )
    {
       switch ( cheby_order ) /* these are the corresponding cheby polynomials: u = u_o + s(A)r_0  - so order is
                                 one less that  resid poly: r(t) = 1 - t*s(t) */ 
@@ -187,6 +217,253 @@ HYPRE_Int hypre_ParCSRRelax_Cheby_Setup(hypre_ParCSRMatrix *A, /* matrix to rela
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Helpers for the fused kernels: the off-processor values of x, and the
+ * product of row i of A with x
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRRelax_ChebyExchange(hypre_ParCSRMatrix *A,
+                                HYPRE_Real         *x_data,
+                                HYPRE_Real         *x_buf_data,
+                                HYPRE_Real         *x_ext_data)
+{
+   hypre_ParCSRCommPkg    *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   hypre_ParCSRCommHandle *comm_handle;
+   HYPRE_Int               num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int               begin = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+   HYPRE_Int               end   = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+   HYPRE_Int              *send_map = hypre_ParCSRCommPkgSendMapElmts(comm_pkg);
+   HYPRE_Int               i;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = begin; i < end; i++)
+   {
+      x_buf_data[i - begin] = x_data[send_map[i]];
+   }
+
+   comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, x_buf_data, x_ext_data);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   return hypre_error_flag;
+}
+
+static inline HYPRE_Real
+hypre_ParCSRRelax_ChebyRowProduct(hypre_CSRMatrix *A_diag,
+                                  hypre_CSRMatrix *A_offd,
+                                  HYPRE_Int        i,
+                                  HYPRE_Real      *x_data,
+                                  HYPRE_Real      *x_ext_data)
+{
+   HYPRE_Real *A_diag_data = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int  *A_diag_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int  *A_diag_j    = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Real *A_offd_data = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int  *A_offd_i    = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int  *A_offd_j    = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Real  sum = 0.0;
+   HYPRE_Int   jj;
+
+   for (jj = A_diag_i[i]; jj < A_diag_i[i+1]; jj++)
+   {
+      sum += A_diag_data[jj] * x_data[A_diag_j[jj]];
+   }
+   for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+   {
+      sum += A_offd_data[jj] * x_ext_data[A_offd_j[jj]];
+   }
+
+   return sum;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRelax_ChebySolveMatvec
+ *
+ * Same recurrences as hypre_ParCSRRelax_Cheby_Solve, with the products by A
+ * done by hypre_ParCSRMatrixMatvec, for matrices whose coefficients the
+ * fused kernels cannot read (reduced-precision storage) or that the matvec
+ * multiplies in SELL-C-sigma format.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRRelax_ChebySolveMatvec(hypre_ParCSRMatrix *A,
+                                   hypre_ParVector    *f,
+                                   HYPRE_Real         *ds_data,
+                                   HYPRE_Real         *coefs,
+                                   HYPRE_Int           order,
+                                   HYPRE_Int           scale,
+                                   HYPRE_Int           variant,
+                                   hypre_ParVector    *u,
+                                   hypre_ParVector    *v,
+                                   hypre_ParVector    *r)
+{
+   HYPRE_Real      *u_data = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Real      *f_data = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Real      *r_data = hypre_VectorData(hypre_ParVectorLocalVector(r));
+   HYPRE_Int        num_rows = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+   hypre_ParVector *tmp_vec, *ax_vec, *x_old, *x_new_vec, *x_swap;
+   HYPRE_Real      *x_old_data, *x_new_data, *ax_data;
+   HYPRE_Real       mult, a, b, w_prev, w_last, dinv, s, x_new;
+   HYPRE_Int        i, k, cheby_order = order - 1;
+
+   tmp_vec = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A),
+                                   hypre_ParCSRMatrixGlobalNumRows(A),
+                                   hypre_ParCSRMatrixRowStarts(A));
+   hypre_ParVectorInitialize(tmp_vec);
+   hypre_ParVectorSetPartitioningOwner(tmp_vec,0);
+   ax_vec = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A),
+                                  hypre_ParCSRMatrixGlobalNumRows(A),
+                                  hypre_ParCSRMatrixRowStarts(A));
+   hypre_ParVectorInitialize(ax_vec);
+   hypre_ParVectorSetPartitioningOwner(ax_vec,0);
+   ax_data = hypre_VectorData(hypre_ParVectorLocalVector(ax_vec));
+
+   x_old = v;
+   x_new_vec = tmp_vec;
+   x_old_data = hypre_VectorData(hypre_ParVectorLocalVector(x_old));
+
+   hypre_ParCSRMatrixMatvec(1.0, A, u, 0.0, ax_vec);
+
+   if (variant == 2 || variant == 3)
+   {
+      HYPRE_Real rho_inv = coefs[0];
+
+      mult = 4.0/3.0 * rho_inv;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,s,dinv) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         s = f_data[i] - ax_data[i];
+         dinv = scale ? ds_data[i]*ds_data[i] : 1.0;
+         r_data[i] = s;
+         x_old_data[i] = mult * dinv * s;
+      }
+
+      if (order == 1)
+      {
+         w_last = coefs[1];
+         for (i = 0; i < num_rows; i++)
+         {
+            u_data[i] += w_last * x_old_data[i];
+         }
+      }
+
+      for (k = 2; k <= order; k++)
+      {
+         a = (2.0*k - 3.0)/(2.0*k + 1.0);
+         b = (8.0*k - 4.0)/(2.0*k + 1.0) * rho_inv;
+         w_prev = coefs[k-1];
+         w_last = (k == order) ? coefs[k] : 0.0;
+
+         hypre_ParCSRMatrixMatvec(1.0, A, x_old, 0.0, ax_vec);
+         x_new_data = hypre_VectorData(hypre_ParVectorLocalVector(x_new_vec));
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,s,dinv,x_new) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+         {
+            s = r_data[i] - ax_data[i];
+            dinv = scale ? ds_data[i]*ds_data[i] : 1.0;
+            r_data[i] = s;
+            x_new = a * x_old_data[i] + b * dinv * s;
+            x_new_data[i] = x_new;
+            u_data[i] += w_prev * x_old_data[i] + w_last * x_new;
+         }
+
+         x_swap = x_old; x_old = x_new_vec; x_new_vec = x_swap;
+         x_old_data = x_new_data;
+      }
+   }
+   else
+   {
+      mult = coefs[cheby_order];
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,s) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         s = f_data[i] - ax_data[i];
+         if (scale)
+         {
+            s *= ds_data[i]*ds_data[i];
+         }
+         r_data[i] = s;
+         x_old_data[i] = mult * s;
+      }
+
+      if (cheby_order == 0)
+      {
+         for (i = 0; i < num_rows; i++)
+         {
+            u_data[i] += x_old_data[i];
+         }
+      }
+
+      for (k = cheby_order - 1; k >= 0; k--)
+      {
+         mult = coefs[k];
+
+         hypre_ParCSRMatrixMatvec(1.0, A, x_old, 0.0, ax_vec);
+         x_new_data = hypre_VectorData(hypre_ParVectorLocalVector(x_new_vec));
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,s,x_new) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+         {
+            s = ax_data[i];
+            if (scale)
+            {
+               s *= ds_data[i]*ds_data[i];
+            }
+            x_new = mult * r_data[i] + s;
+            if (k)
+            {
+               x_new_data[i] = x_new;
+            }
+            else
+            {
+               u_data[i] += x_new;
+            }
+         }
+
+         x_swap = x_old; x_old = x_new_vec; x_new_vec = x_swap;
+         x_old_data = x_new_data;
+      }
+   }
+
+   hypre_ParVectorDestroy(tmp_vec);
+   hypre_ParVectorDestroy(ax_vec);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRelax_Cheby_Solve
+ *
+ * u = u + p(A)r with the polynomial from hypre_ParCSRRelax_Cheby_Setup.
+ *
+ * Variants 0 and 1 use Horner's scheme on the coefficients of p.  With
+ * D = diag(A) (scaled) or D = I (unscaled), q = D^{-1}(f - Au) and
+ * y = D^{1/2} s_k(D^{-1/2}AD^{-1/2}) D^{1/2} q, every step is
+ * y_new = coefs[k] q + D^{-1} A y.
+ *
+ * Variants 2 and 3 use the recurrence of the fourth-kind polynomials:
+ * r_k = r_{k-1} - A d_{k-1},
+ * d_k = (2k-3)/(2k+1) d_{k-1} + (8k-4)/(2k+1) D^{-1} r_k / rho,
+ * u = u + w_k d_k, with d_1 = 4/3 D^{-1} r_0 / rho.
+ *
+ * Each step is a single pass over the rows of A that computes the row of
+ * the matvec and updates the vectors of the recurrence in place.  The
+ * update of u lags one step behind, as u is read by the first step only.
+ * Matrices stored in reduced precision or with a SELL-C-sigma shadow of
+ * diag use hypre_ParCSRMatrixMatvec.  The halo exchange goes through
+ * hypre_ParCSRCommHandleCreate, so persistent and neighborhood
+ * communication are used as in the matvec.
+ *--------------------------------------------------------------------------*/
+
 HYPRE_Int hypre_ParCSRRelax_Cheby_Solve(hypre_ParCSRMatrix *A, /* matrix to relax with */
                             hypre_ParVector *f,    /* right-hand side */
                             HYPRE_Real *ds_data,
@@ -199,24 +476,27 @@ HYPRE_Int hypre_ParCSRRelax_Cheby_Solve(hypre_ParCSRMatrix *A, /* matrix to rela
                             hypre_ParVector *r    /*another temp vector */  )
 {
    hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix *A_offd = hypre_ParCSRMatrixOffd(A);
    HYPRE_Real *u_data = hypre_VectorData(hypre_ParVectorLocalVector(u));
    HYPRE_Real *f_data = hypre_VectorData(hypre_ParVectorLocalVector(f));
    HYPRE_Real *v_data = hypre_VectorData(hypre_ParVectorLocalVector(v));
 
    HYPRE_Real  *r_data = hypre_VectorData(hypre_ParVectorLocalVector(r));
 
-   HYPRE_Int i, j;
+   HYPRE_Int i, k;
    HYPRE_Int num_rows = hypre_CSRMatrixNumRows(A_diag);
- 
-   HYPRE_Real mult;
-   HYPRE_Real *orig_u;
+   HYPRE_Int num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   HYPRE_Int num_procs;
+
+   HYPRE_Real mult, a, b, w_prev, w_last, dinv, s, x_new;
+   HYPRE_Real *x_old, *x_new_data, *x_swap;
+   HYPRE_Real *x_buf_data = NULL;
+   HYPRE_Real *x_ext_data = NULL;
    
    HYPRE_Int cheby_order;
 
    HYPRE_Real  *tmp_data;
 
-   hypre_ParVector    *tmp_vec;
-
    /* u = u + p(A)r */
 
    if (order > 4)
@@ -226,120 +506,166 @@ HYPRE_Int hypre_ParCSRRelax_Cheby_Solve(hypre_ParCSRMatrix *A, /* matrix to rela
 
    /* we are using the order of p(A) */
    cheby_order = order -1;
-   
-   orig_u = hypre_CTAlloc(HYPRE_Real,  num_rows, HYPRE_MEMORY_HOST);
 
-   if (!scale)
+   if (hypre_CSRMatrixDataSP(A_diag) || hypre_CSRMatrixDataSP(A_offd) ||
+       hypre_CSRMatrixSellChunkSize(A_diag) > 0)
+   {
+      return hypre_ParCSRRelax_ChebySolveMatvec(A, f, ds_data, coefs, order, scale,
+                                                variant, u, v, r);
+   }
+
+   hypre_MPI_Comm_size(hypre_ParCSRMatrixComm(A), &num_procs);
+   if (num_procs > 1)
    {
-      /* get residual: r = f - A*u */
-      hypre_ParVectorCopy(f, r); 
-      hypre_ParCSRMatrixMatvec(-1.0, A, u, 1.0, r);
+      hypre_ParCSRCommPkg *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
 
-      for ( i = 0; i < num_rows; i++ ) 
+      if (!comm_pkg)
       {
-         orig_u[i] = u_data[i];
-         u_data[i] = r_data[i] * coefs[cheby_order]; 
+         hypre_MatvecCommPkgCreate(A);
+         comm_pkg = hypre_ParCSRMatrixCommPkg(A);
       }
-      for (i = cheby_order - 1; i >= 0; i-- ) 
+      x_buf_data = hypre_CTAlloc(HYPRE_Real,
+                                 hypre_ParCSRCommPkgSendMapStart(comm_pkg,
+                                    hypre_ParCSRCommPkgNumSends(comm_pkg)),
+                                 HYPRE_MEMORY_HOST);
+      x_ext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+      hypre_ParCSRRelax_ChebyExchange(A, u_data, x_buf_data, x_ext_data);
+   }
+
+   tmp_data = hypre_CTAlloc(HYPRE_Real, num_rows, HYPRE_MEMORY_HOST);
+
+   if (variant == 2 || variant == 3)
+   {
+      /* fourth kind: r holds the residual, v and tmp the directions */
+      HYPRE_Real rho_inv = coefs[0];
+
+      x_old = v_data;
+      x_new_data = tmp_data;
+
+      /* r = f - A*u, d_1 = 4/3 D^{-1} r / rho */
+      mult = 4.0/3.0 * rho_inv;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,s,dinv) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
       {
-         hypre_ParCSRMatrixMatvec(1.0, A, u, 0.0, v);
-         mult = coefs[i];
+         s = f_data[i] - hypre_ParCSRRelax_ChebyRowProduct(A_diag, A_offd, i, u_data, x_ext_data);
+         dinv = scale ? ds_data[i]*ds_data[i] : 1.0;
+         r_data[i] = s;
+         x_old[i] = mult * dinv * s;
+      }
+
+      if (order == 1)
+      {
+         w_last = coefs[1];
 #ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE 
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
 #endif
-         for ( j = 0; j < num_rows; j++ )
+         for (i = 0; i < num_rows; i++)
          {
-            u_data[j] = mult * r_data[j] + v_data[j];
+            u_data[i] += w_last * x_old[i];
          }
       }
 
-#ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE 
-#endif
-      for ( i = 0; i < num_rows; i++ ) 
+      for (k = 2; k <= order; k++)
       {
-         u_data[i] = orig_u[i] + u_data[i];
-      }
-   }
-   else /* scaling! */
-   {
-      
-      /*grab 1/sqrt(diagonal) */
-      
-      tmp_vec = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A),
-                                      hypre_ParCSRMatrixGlobalNumRows(A),
-                                      hypre_ParCSRMatrixRowStarts(A));
-      hypre_ParVectorInitialize(tmp_vec);
-      hypre_ParVectorSetPartitioningOwner(tmp_vec,0);
-      tmp_data = hypre_VectorData(hypre_ParVectorLocalVector(tmp_vec));
+         a = (2.0*k - 3.0)/(2.0*k + 1.0);
+         b = (8.0*k - 4.0)/(2.0*k + 1.0) * rho_inv;
+         w_prev = coefs[k-1];
+         w_last = (k == order) ? coefs[k] : 0.0;
 
-    /* get ds_data and get scaled residual: r = D^(-1/2)f -
-       * D^(-1/2)A*u */
+         if (num_procs > 1)
+         {
+            hypre_ParCSRRelax_ChebyExchange(A, x_old, x_buf_data, x_ext_data);
+         }
 
-      hypre_ParCSRMatrixMatvec(-1.0, A, u, 0.0, tmp_vec);
+         /* r -= A*d_old, d_new = a d_old + b D^{-1} r, u += w_{k-1} d_old (+ w_k d_new) */
 #ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE 
+#pragma omp parallel for private(i,s,dinv,x_new) HYPRE_SMP_SCHEDULE
 #endif
-      for ( j = 0; j < num_rows; j++ ) 
-      {
-         r_data[j] = ds_data[j] * (f_data[j] + tmp_data[j]);
-      }
+         for (i = 0; i < num_rows; i++)
+         {
+            s = r_data[i] - hypre_ParCSRRelax_ChebyRowProduct(A_diag, A_offd, i, x_old, x_ext_data);
+            dinv = scale ? ds_data[i]*ds_data[i] : 1.0;
+            r_data[i] = s;
+            x_new = a * x_old[i] + b * dinv * s;
+            x_new_data[i] = x_new;
+            u_data[i] += w_prev * x_old[i] + w_last * x_new;
+         }
 
-      /* save original u, then start 
-         the iteration by multiplying r by the cheby coef.*/
+         x_swap = x_old; x_old = x_new_data; x_new_data = x_swap;
+      }
+   }
+   else
+   {
+      /* Horner: r holds q = D^{-1}(f - A*u), v and tmp the iterates y */
+      x_old = v_data;
+      x_new_data = tmp_data;
 
+      mult = coefs[cheby_order];
 #ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE 
+#pragma omp parallel for private(i,s) HYPRE_SMP_SCHEDULE
 #endif
-      for ( j = 0; j < num_rows; j++ ) 
+      for (i = 0; i < num_rows; i++)
       {
-         orig_u[j] = u_data[j]; /* orig, unscaled u */
-
-         u_data[j] = r_data[j] * coefs[cheby_order]; 
+         s = f_data[i] - hypre_ParCSRRelax_ChebyRowProduct(A_diag, A_offd, i, u_data, x_ext_data);
+         if (scale)
+         {
+            s *= ds_data[i]*ds_data[i];
+         }
+         r_data[i] = s;
+         x_old[i] = mult * s;
       }
 
-      /* now do the other coefficients */   
-      for (i = cheby_order - 1; i >= 0; i-- ) 
+      if (cheby_order == 0)
       {
-         /* v = D^(-1/2)AD^(-1/2)u */
 #ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE 
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
 #endif
-         for ( j = 0; j < num_rows; j++ )
+         for (i = 0; i < num_rows; i++)
          {
-            tmp_data[j]  =  ds_data[j] * u_data[j];
+            u_data[i] += x_old[i];
          }
-         hypre_ParCSRMatrixMatvec(1.0, A, tmp_vec, 0.0, v);
+      }
 
-         /* u_new = coef*r + v*/
-         mult = coefs[i];
+      for (k = cheby_order - 1; k >= 0; k--)
+      {
+         mult = coefs[k];
 
-#ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE 
-#endif
-         for ( j = 0; j < num_rows; j++ )
+         if (num_procs > 1)
          {
-            u_data[j] = mult * r_data[j] + ds_data[j]*v_data[j];
+            hypre_ParCSRRelax_ChebyExchange(A, x_old, x_buf_data, x_ext_data);
          }
-         
-      } /* end of cheby_order loop */
-
-      /* now we have to scale u_data before adding it to u_orig*/
 
+         /* y_new = coef*q + D^{-1}A*y, added to u in the last step */
 #ifdef HYPRE_USING_OPENMP
-#pragma omp parallel for private(j) HYPRE_SMP_SCHEDULE 
+#pragma omp parallel for private(i,s,x_new) HYPRE_SMP_SCHEDULE
 #endif
-      for ( j = 0; j < num_rows; j++ ) 
-      {
-         u_data[j] = orig_u[j] + ds_data[j]*u_data[j];
-      }
-   
-      hypre_ParVectorDestroy(tmp_vec);  
+         for (i = 0; i < num_rows; i++)
+         {
+            s = hypre_ParCSRRelax_ChebyRowProduct(A_diag, A_offd, i, x_old, x_ext_data);
+            if (scale)
+            {
+               s *= ds_data[i]*ds_data[i];
+            }
+            x_new = mult * r_data[i] + s;
+            if (k)
+            {
+               x_new_data[i] = x_new;
+            }
+            else
+            {
+               u_data[i] += x_new;
+            }
+         }
 
-   }/* end of scaling code */
+         x_swap = x_old; x_old = x_new_data; x_new_data = x_swap;
+      }
+   }
 
-   hypre_TFree(orig_u, HYPRE_MEMORY_HOST);
+   hypre_TFree(tmp_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(x_buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(x_ext_data, HYPRE_MEMORY_HOST);
   
    return hypre_error_flag;
 }
-
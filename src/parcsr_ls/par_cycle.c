@@ -77,6 +77,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
    HYPRE_Int       i, j, jj;
    HYPRE_Int       level;
    HYPRE_Int       cycle_param;
+   HYPRE_Real      profile_mark[HYPRE_AMG_PROFILE_NUM_STATS];
    HYPRE_Int       coarse_grid;
    HYPRE_Int       fine_grid;
    HYPRE_Int       Not_Finished;
@@ -259,6 +260,8 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
    cali_set_int(iter_attr, level);
 #endif
 
+   hypre_BoomerAMGProfileStart(amg_data, profile_mark);
+
    while (Not_Finished)
    {
       if (num_levels > 1)
@@ -325,7 +328,11 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          l1_norms_level = NULL;
       }
 
-      if (cycle_param == 3 && seq_cg)
+      if (cycle_param == 3 && hypre_ParAMGDataRedistComm(amg_data) != hypre_MPI_COMM_NULL)
+      {
+         hypre_BoomerAMGRedistributeCycle(amg_data, level, F_array, U_array);
+      }
+      else if (cycle_param == 3 && seq_cg)
       {
          hypre_seqAMGCycle(amg_data, level, F_array, U_array);
       }
@@ -484,7 +491,10 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                                        Vtemp,
                                        Ztemp);
 #else
-                     if ( hypre_NumThreads() == 1 )
+                     /* the matvec-based version uses the SELL-C-sigma kernels if enabled,
+                        and is the only one for single precision storage of A */
+                     if ( hypre_NumThreads() == 1 || hypre_CSRMatrixSellChunkSize(hypre_ParCSRMatrixDiag(A_array[level])) > 0 ||
+                          hypre_CSRMatrixDataSP(hypre_ParCSRMatrixDiag(A_array[level])) )
                      {
                         hypre_ParCSRRelax(A_array[level],
                                           Aux_F,
@@ -550,6 +560,33 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                                                     Aux_U, Vtemp);
                   }
                }
+               else if (relax_type >= 40 && relax_type <= 42)
+               {  /* multicolor Gauss-Seidel */
+                  HYPRE_Int i;
+                  HYPRE_Int loc_relax_points[2] = {0, 0};
+                  HYPRE_Int num_passes = 1;
+                  HYPRE_Int direction = (relax_type == 40) ? 1 : (relax_type == 41) ? -1 : 0;
+
+                  if (relax_order == 1 && cycle_param < 3)
+                  {
+                     num_passes = 2;
+                     loc_relax_points[0] = (cycle_type < 2) ? 1 : -1;
+                     loc_relax_points[1] = -loc_relax_points[0];
+                  }
+                  for (i = 0; i < num_passes; i++)
+                  {
+                     hypre_BoomerAMGRelaxMulticolor(A_array[level],
+                                                    Aux_F,
+                                                    CF_marker_array[level],
+                                                    loc_relax_points[i],
+                                                    direction,
+                                                    relax_weight[level],
+                                                    hypre_ParAMGDataMCNumColors(amg_data)[level],
+                                                    hypre_ParAMGDataMCColorStarts(amg_data)[level],
+                                                    hypre_ParAMGDataMCColorRows(amg_data)[level],
+                                                    Aux_U);
+                  }
+               }
                else if (old_version)
                {
                   /*
@@ -631,6 +668,8 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          }
       }
 
+      hypre_BoomerAMGProfileStop(amg_data, level, HYPRE_AMG_PROFILE_RELAX, profile_mark);
+
       /*------------------------------------------------------------------
        * Decrement the control counter and determine which grid to visit next
        *-----------------------------------------------------------------*/
@@ -690,6 +729,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                                          beta, F_array[coarse_grid]);
             }
          }
+         hypre_BoomerAMGProfileStop(amg_data, fine_grid, HYPRE_AMG_PROFILE_RESTRICT, profile_mark);
 
          ++level;
          lev_counter[level] = hypre_max(lev_counter[level], cycle_type);
@@ -727,6 +767,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                                      beta, U_array[fine_grid]);
             /* printf("Proc %d: level %d, n %d, Interpolation done\n", my_id, level, local_size); */
          }
+         hypre_BoomerAMGProfileStop(amg_data, fine_grid, HYPRE_AMG_PROFILE_PROLONG, profile_mark);
 
          --level;
 
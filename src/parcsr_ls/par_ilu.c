@@ -76,6 +76,22 @@ hypre_ILUCreate()
    /* reordering_type default to use local RCM */
    (ilu_data -> reordering_type) = 1;
 
+   /* sequential triangular solves by default */
+   (ilu_data -> tri_solve)             = 0;
+   (ilu_data -> lower_jacobi_iters)    = 5;
+   (ilu_data -> upper_jacobi_iters)    = 5;
+   (ilu_data -> iter_setup_sweeps)     = 0;
+   (ilu_data -> L_num_levels)          = 0;
+   (ilu_data -> L_level_starts)        = NULL;
+   (ilu_data -> L_level_rows)          = NULL;
+   (ilu_data -> matL_lvl)              = NULL;
+   (ilu_data -> U_num_levels)          = 0;
+   (ilu_data -> U_level_starts)        = NULL;
+   (ilu_data -> U_level_rows)          = NULL;
+   (ilu_data -> matU_lvl)              = NULL;
+   (ilu_data -> matD_lvl)              = NULL;
+   (ilu_data -> tri_work)              = NULL;
+
    /* see hypre_ILUSetType for more default values */
 
    return (void *)                     ilu_data;
@@ -166,6 +182,23 @@ hypre_ILUDestroy( void *data )
       hypre_ParCSRMatrixDestroy((ilu_data -> matS));
       (ilu_data -> matS) = NULL;
    }
+   /* level schedules */
+   hypre_TFree(hypre_ParILUDataLLevelStarts(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataLLevelRows(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataULevelStarts(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataULevelRows(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataMatDLvl(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataTriWork(ilu_data), HYPRE_MEMORY_HOST);
+   if(hypre_ParILUDataMatLLvl(ilu_data))
+   {
+      hypre_CSRMatrixDestroy(hypre_ParILUDataMatLLvl(ilu_data));
+      hypre_ParILUDataMatLLvl(ilu_data) = NULL;
+   }
+   if(hypre_ParILUDataMatULvl(ilu_data))
+   {
+      hypre_CSRMatrixDestroy(hypre_ParILUDataMatULvl(ilu_data));
+      hypre_ParILUDataMatULvl(ilu_data) = NULL;
+   }
    if(ilu_data -> schur_solver)
    {
       switch(ilu_data -> ilu_type){
@@ -384,6 +417,40 @@ hypre_ILUSetLocalReordering( void *ilu_vdata, HYPRE_Int ordering_type )
    return hypre_error_flag;
 }
 
+/* Set type of triangular solves */
+HYPRE_Int
+hypre_ILUSetTriSolve( void *ilu_vdata, HYPRE_Int tri_solve )
+{
+   hypre_ParILUData   *ilu_data = (hypre_ParILUData*) ilu_vdata;
+   (ilu_data -> tri_solve) = tri_solve;
+   return hypre_error_flag;
+}
+
+/* Set number of Jacobi iterations for the L solve (tri_solve = 2) */
+HYPRE_Int
+hypre_ILUSetLowerJacobiIters( void *ilu_vdata, HYPRE_Int lower_jacobi_iters )
+{
+   hypre_ParILUData   *ilu_data = (hypre_ParILUData*) ilu_vdata;
+   (ilu_data -> lower_jacobi_iters) = lower_jacobi_iters;
+   return hypre_error_flag;
+}
+/* Set number of Jacobi iterations for the U solve (tri_solve = 2) */
+HYPRE_Int
+hypre_ILUSetUpperJacobiIters( void *ilu_vdata, HYPRE_Int upper_jacobi_iters )
+{
+   hypre_ParILUData   *ilu_data = (hypre_ParILUData*) ilu_vdata;
+   (ilu_data -> upper_jacobi_iters) = upper_jacobi_iters;
+   return hypre_error_flag;
+}
+/* Set number of sweeps of the iterative factorization */
+HYPRE_Int
+hypre_ILUSetIterativeSetupSweeps( void *ilu_vdata, HYPRE_Int iter_setup_sweeps )
+{
+   hypre_ParILUData   *ilu_data = (hypre_ParILUData*) ilu_vdata;
+   (ilu_data -> iter_setup_sweeps) = iter_setup_sweeps;
+   return hypre_error_flag;
+}
+
 /* Set KDim (for GMRES) for Solver of Schur System */
 HYPRE_Int
 hypre_ILUSetSchurSolverKDIM( void *ilu_vdata, HYPRE_Int ss_kDim )
@@ -2968,6 +3035,7 @@ hypre_CSRMatrixScale(hypre_CSRMatrix *A, HYPRE_Real scalar)
    {
       data[i] *= scalar;
    }
+   hypre_CSRMatrixValuesChanged(A);
    return hypre_error_flag;
 }
 
@@ -3140,6 +3208,7 @@ hypre_CSRMatrixDropInplace(hypre_CSRMatrix *A, HYPRE_Real droptol, HYPRE_Int max
    hypre_CSRMatrixData(A) = new_data;
    hypre_CSRMatrixNumNonzeros(A) = ctrA;
    hypre_CSRMatrixOwnsData(A) = 1;
+   hypre_CSRMatrixValuesChanged(A);
 
    hypre_TFree(idx, HYPRE_MEMORY_DEVICE);
    hypre_TFree(data, HYPRE_MEMORY_DEVICE);
@@ -85,6 +85,25 @@ typedef struct hypre_ParILUData_struct
    
    /* local reordering */
    HYPRE_Int 	reordering_type;
+
+   /* triangular solves: 0 sequential, 1 level-scheduled, 2 Jacobi iterations */
+   HYPRE_Int            tri_solve;
+   HYPRE_Int            lower_jacobi_iters;
+   HYPRE_Int            upper_jacobi_iters;
+   /* number of sweeps of the iterative factorization, 0 for exact factorization */
+   HYPRE_Int            iter_setup_sweeps;
+   /* level schedules and level-ordered copies of the factors (tri_solve = 1)
+    * and work space of the triangular solves (tri_solve = 1, 2) */
+   HYPRE_Int            L_num_levels;
+   HYPRE_Int            *L_level_starts;
+   HYPRE_Int            *L_level_rows;
+   hypre_CSRMatrix      *matL_lvl;
+   HYPRE_Int            U_num_levels;
+   HYPRE_Int            *U_level_starts;
+   HYPRE_Int            *U_level_rows;
+   hypre_CSRMatrix      *matU_lvl;
+   HYPRE_Real           *matD_lvl;
+   HYPRE_Real           *tri_work;
    
 } hypre_ParILUData;
 
@@ -128,6 +147,20 @@ typedef struct hypre_ParILUData_struct
 #define hypre_ParILUDataRhs(ilu_data)                          ((ilu_data) -> rhs)
 #define hypre_ParILUDataX(ilu_data)                            ((ilu_data) -> x)
 #define hypre_ParILUDataReorderingType(ilu_data)                            ((ilu_data) -> reordering_type)
+#define hypre_ParILUDataTriSolve(ilu_data)                     ((ilu_data) -> tri_solve)
+#define hypre_ParILUDataLowerJacobiIters(ilu_data)             ((ilu_data) -> lower_jacobi_iters)
+#define hypre_ParILUDataUpperJacobiIters(ilu_data)             ((ilu_data) -> upper_jacobi_iters)
+#define hypre_ParILUDataIterSetupSweeps(ilu_data)              ((ilu_data) -> iter_setup_sweeps)
+#define hypre_ParILUDataLNumLevels(ilu_data)                   ((ilu_data) -> L_num_levels)
+#define hypre_ParILUDataLLevelStarts(ilu_data)                 ((ilu_data) -> L_level_starts)
+#define hypre_ParILUDataLLevelRows(ilu_data)                   ((ilu_data) -> L_level_rows)
+#define hypre_ParILUDataMatLLvl(ilu_data)                      ((ilu_data) -> matL_lvl)
+#define hypre_ParILUDataUNumLevels(ilu_data)                   ((ilu_data) -> U_num_levels)
+#define hypre_ParILUDataULevelStarts(ilu_data)                 ((ilu_data) -> U_level_starts)
+#define hypre_ParILUDataULevelRows(ilu_data)                   ((ilu_data) -> U_level_rows)
+#define hypre_ParILUDataMatULvl(ilu_data)                      ((ilu_data) -> matU_lvl)
+#define hypre_ParILUDataMatDLvl(ilu_data)                      ((ilu_data) -> matD_lvl)
+#define hypre_ParILUDataTriWork(ilu_data)                      ((ilu_data) -> tri_work)
 /* Schur System */
 #define hypre_ParILUDataSchurGMRESKDim(ilu_data)               ((ilu_data) -> ss_kDim)
 #define hypre_ParILUDataSchurNSHMaxNumIter(ilu_data)           ((ilu_data) -> ss_kDim)
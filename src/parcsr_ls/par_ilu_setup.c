@@ -83,6 +83,8 @@ hypre_ILUSetup( void               *ilu_vdata,
    hypre_MPI_Comm_size(comm,&num_procs);
    hypre_MPI_Comm_rank(comm,&my_id);
 
+   hypre_MemoryStatsPushCategory(HYPRE_MEMORY_CATEGORY_ILU);
+
    /* Free Previously allocated data, if any not destroyed */
    if(matL)
    {
@@ -111,6 +113,24 @@ hypre_ILUSetup( void               *ilu_vdata,
    }
 
 
+   /* clear old level schedules, if created */
+   hypre_TFree(hypre_ParILUDataLLevelStarts(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataLLevelRows(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataULevelStarts(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataULevelRows(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataMatDLvl(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataTriWork(ilu_data), HYPRE_MEMORY_HOST);
+   if(hypre_ParILUDataMatLLvl(ilu_data))
+   {
+      hypre_CSRMatrixDestroy(hypre_ParILUDataMatLLvl(ilu_data));
+      hypre_ParILUDataMatLLvl(ilu_data) = NULL;
+   }
+   if(hypre_ParILUDataMatULvl(ilu_data))
+   {
+      hypre_CSRMatrixDestroy(hypre_ParILUDataMatULvl(ilu_data));
+      hypre_ParILUDataMatULvl(ilu_data) = NULL;
+   }
+
    /* clear old l1_norm data, if created */
    if(hypre_ParILUDataL1Norms(ilu_data))
    {
@@ -233,7 +253,15 @@ hypre_ILUSetup( void               *ilu_vdata,
    /* factorization */
    switch(ilu_type)
    {
-      case 0:  hypre_ILUSetupILUK(matA, fill_level, perm, perm, n, n, &matL, &matD, &matU, &matS, &u_end); //BJ + hypre_iluk()
+      case 0:  if(hypre_ParILUDataIterSetupSweeps(ilu_data) > 0)
+               {
+                  hypre_ILUSetupIterative(matA, fill_level, perm, hypre_ParILUDataIterSetupSweeps(ilu_data),
+                        &matL, &matD, &matU); //BJ + iterative ilu(k)
+               }
+               else
+               {
+                  hypre_ILUSetupILUK(matA, fill_level, perm, perm, n, n, &matL, &matD, &matU, &matS, &u_end); //BJ + hypre_iluk()
+               }
                break;
       case 1:  hypre_ILUSetupILUT(matA, max_row_elmts, droptol, perm, perm, n, n, &matL, &matD, &matU, &matS, &u_end); //BJ + hypre_ilut()
                break;
@@ -253,9 +281,51 @@ hypre_ILUSetup( void               *ilu_vdata,
                break;
       case 41: hypre_ILUSetupILUT(matA, max_row_elmts, droptol, perm, qperm, nLU, nI, &matL, &matD, &matU, &matS, &u_end); //ddPQ + GMRES + hypre_ilut()
                break;
-      default: hypre_ILUSetupILU0(matA, perm, perm, n, n, &matL, &matD, &matU, &matS, &u_end);//BJ + hypre_ilu0()
+      default: if(hypre_ParILUDataIterSetupSweeps(ilu_data) > 0)
+               {
+                  hypre_ILUSetupIterative(matA, 0, perm, hypre_ParILUDataIterSetupSweeps(ilu_data),
+                        &matL, &matD, &matU); //BJ + iterative ilu0
+               }
+               else
+               {
+                  hypre_ILUSetupILU0(matA, perm, perm, n, n, &matL, &matD, &matU, &matS, &u_end);//BJ + hypre_ilu0()
+               }
                break;
    }
+   /* level schedules of the factors or work space of the Jacobi iterations
+    * for the triangular solves, the solves with the Schur complement remain
+    * sequential */
+   if(hypre_ParILUDataTriSolve(ilu_data) == 2)
+   {
+      switch(ilu_type)
+      {
+         case 10: case 11: case 20: case 21: case 40: case 41:
+            break;
+         default:
+            hypre_ParILUDataTriWork(ilu_data) = hypre_TAlloc(HYPRE_Real,
+                  3*hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(matL)), HYPRE_MEMORY_HOST);
+            break;
+      }
+   }
+   else if(hypre_ParILUDataTriSolve(ilu_data) == 1)
+   {
+      switch(ilu_type)
+      {
+         case 10: case 11: case 20: case 21: case 40: case 41:
+            break;
+         default:
+            hypre_ILUSetupLevelSchedule(hypre_ParCSRMatrixDiag(matL), NULL, 1,
+                  &hypre_ParILUDataLNumLevels(ilu_data), &hypre_ParILUDataLLevelStarts(ilu_data),
+                  &hypre_ParILUDataLLevelRows(ilu_data), &hypre_ParILUDataMatLLvl(ilu_data), NULL);
+            hypre_ILUSetupLevelSchedule(hypre_ParCSRMatrixDiag(matU), matD, 0,
+                  &hypre_ParILUDataUNumLevels(ilu_data), &hypre_ParILUDataULevelStarts(ilu_data),
+                  &hypre_ParILUDataULevelRows(ilu_data), &hypre_ParILUDataMatULvl(ilu_data),
+                  &hypre_ParILUDataMatDLvl(ilu_data));
+            hypre_ParILUDataTriWork(ilu_data) = hypre_TAlloc(HYPRE_Real,
+                  hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(matL)), HYPRE_MEMORY_HOST);
+            break;
+      }
+   }
    /* setup Schur solver */
    switch(ilu_type)
    {
@@ -283,6 +353,10 @@ hypre_ILUSetup( void               *ilu_vdata,
             HYPRE_ILUSetDropThresholdArray(schur_precond, (ilu_data -> sp_ilu_droptol));
             hypre_ILUSetOwnDropThreshold  (schur_precond, 0);/* using exist droptol */
             HYPRE_ILUSetPrintLevel        (schur_precond, (ilu_data -> sp_print_level));
+            HYPRE_ILUSetTriSolve          (schur_precond, (ilu_data -> tri_solve));
+            HYPRE_ILUSetLowerJacobiIters  (schur_precond, (ilu_data -> lower_jacobi_iters));
+            HYPRE_ILUSetUpperJacobiIters  (schur_precond, (ilu_data -> upper_jacobi_iters));
+            HYPRE_ILUSetIterativeSetupSweeps(schur_precond, (ilu_data -> iter_setup_sweeps));
             HYPRE_ILUSetMaxIter           (schur_precond, (ilu_data -> sp_max_iter));
             //HYPRE_ILUSetTol               (schur_precond, (ilu_data -> sp_tol));
             HYPRE_ILUSetTol               (schur_precond, 0.); /* set tol for preconditioner to zero. Avoids triggering hypre error for non convergence -DOK*/
@@ -296,6 +370,7 @@ hypre_ILUSetup( void               *ilu_vdata,
             if (schur_precond_gotten != (schur_precond))
             {
                hypre_printf("Schur complement got bad precond\n");
+               hypre_MemoryStatsPopCategory();
                return(-1);
             }
 
@@ -455,6 +530,491 @@ hypre_ILUSetup( void               *ilu_vdata,
    rel_res_norms = hypre_CTAlloc(HYPRE_Real, (ilu_data -> max_iter), HYPRE_MEMORY_HOST);
    (ilu_data -> rel_res_norms) = rel_res_norms;
 
+   hypre_MemoryStatsPopCategory();
+
+   return hypre_error_flag;
+}
+
+/* Level scheduling of a triangular factor for the triangular solves
+ * T = strictly lower (lower = 1) or strictly upper (lower = 0) triangular
+ *    factor, the diagonal is the identity or given by D (stored as its inverse)
+ * A row is in the level after the last level of the rows it depends on, so
+ *    the rows of one level can be solved for in parallel.
+ * num_levels, level_starts = number of levels and their starts in level_rows,
+ *    the rows sorted by level (increasing within a level)
+ * T_lvl, D_lvl = copies of T and D with the rows in the order of level_rows
+ *    and the column indices unchanged. D_lvl is only formed if D is given.
+ */
+HYPRE_Int
+hypre_ILUSetupLevelSchedule(hypre_CSRMatrix *T, HYPRE_Real *D, HYPRE_Int lower,
+      HYPRE_Int *num_levels_ptr, HYPRE_Int **level_starts_ptr, HYPRE_Int **level_rows_ptr,
+      hypre_CSRMatrix **T_lvl_ptr, HYPRE_Real **D_lvl_ptr)
+{
+   HYPRE_Int         n           = hypre_CSRMatrixNumRows(T);
+   HYPRE_Int         *T_i        = hypre_CSRMatrixI(T);
+   HYPRE_Int         *T_j        = hypre_CSRMatrixJ(T);
+   HYPRE_Real        *T_data     = hypre_CSRMatrixData(T);
+   HYPRE_Int         nnz         = T_i[n];
+
+   hypre_CSRMatrix   *T_lvl;
+   HYPRE_Int         *T_lvl_i, *T_lvl_j;
+   HYPRE_Real        *T_lvl_data;
+   HYPRE_Real        *D_lvl      = NULL;
+   HYPRE_Int         *level, *level_starts, *level_rows, *next;
+   HYPRE_Int         num_levels  = 0;
+   HYPRE_Int         i, ii, k, j, lev;
+
+   /* level of each row, in the order of the substitution */
+   level = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   for(ii = 0 ; ii < n ; ii ++)
+   {
+      i = lower ? ii : n-1-ii;
+      lev = 0;
+      for(j = T_i[i] ; j < T_i[i+1] ; j ++)
+      {
+         lev = hypre_max(lev, level[T_j[j]] + 1);
+      }
+      level[i] = lev;
+      num_levels = hypre_max(num_levels, lev + 1);
+   }
+
+   /* rows sorted by level */
+   level_starts = hypre_CTAlloc(HYPRE_Int, num_levels + 1, HYPRE_MEMORY_HOST);
+   level_rows = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   next = hypre_TAlloc(HYPRE_Int, num_levels, HYPRE_MEMORY_HOST);
+   for(i = 0 ; i < n ; i ++)
+   {
+      level_starts[level[i]+1]++;
+   }
+   for(lev = 0 ; lev < num_levels ; lev ++)
+   {
+      level_starts[lev+1] += level_starts[lev];
+      next[lev] = level_starts[lev];
+   }
+   for(i = 0 ; i < n ; i ++)
+   {
+      level_rows[next[level[i]]++] = i;
+   }
+
+   /* copy of the factor in level order */
+   T_lvl = hypre_CSRMatrixCreate(n, n, nnz);
+   hypre_CSRMatrixInitialize_v2(T_lvl, 0, HYPRE_MEMORY_HOST);
+   T_lvl_i = hypre_CSRMatrixI(T_lvl);
+   T_lvl_j = hypre_CSRMatrixJ(T_lvl);
+   T_lvl_data = hypre_CSRMatrixData(T_lvl);
+   if(D)
+   {
+      D_lvl = hypre_TAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+   }
+   T_lvl_i[0] = 0;
+   for(k = 0 ; k < n ; k ++)
+   {
+      i = level_rows[k];
+      T_lvl_i[k+1] = T_lvl_i[k];
+      for(j = T_i[i] ; j < T_i[i+1] ; j ++)
+      {
+         T_lvl_j[T_lvl_i[k+1]] = T_j[j];
+         T_lvl_data[T_lvl_i[k+1]] = T_data[j];
+         T_lvl_i[k+1]++;
+      }
+      if(D)
+      {
+         D_lvl[k] = D[i];
+      }
+   }
+
+   hypre_TFree(level, HYPRE_MEMORY_HOST);
+   hypre_TFree(next, HYPRE_MEMORY_HOST);
+
+   *num_levels_ptr = num_levels;
+   *level_starts_ptr = level_starts;
+   *level_rows_ptr = level_rows;
+   *T_lvl_ptr = T_lvl;
+   if(D_lvl_ptr)
+   {
+      *D_lvl_ptr = D_lvl;
+   }
+
+   return hypre_error_flag;
+}
+
+/* Iterative ILU(k) (Chow and Patel, "Fine-grained parallel incomplete LU
+ *    factorization", SIAM J. Sci. Comput. 37, 2015) for block Jacobi
+ * The entries of the factors on the ILU(k) pattern are fixed points of
+ *    l_ij = (a_ij - sum_{k<j} l_ik*u_kj) / u_jj,  i > j,
+ *    u_ij =  a_ij - sum_{k<i} l_ik*u_kj,          i <= j,
+ *    which are computed by num_sweeps sweeps over all entries, starting from
+ *    l_ij = a_ij/a_jj and u_ij = a_ij. All entries of a sweep are updated in
+ *    parallel from the values of the previous sweep, so the factors do not
+ *    depend on the number of threads.
+ * A = input matrix
+ * lfil = level of fill-in, the k in ILU(k)
+ * perm = permutation array indicating ordering of rows and columns
+ * num_sweeps = number of sweeps
+ * Lptr, Dptr, Uptr = L, D, U factors, in the format of hypre_ILUSetupILU0.
+ */
+HYPRE_Int
+hypre_ILUSetupIterative(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int *perm, HYPRE_Int num_sweeps,
+      hypre_ParCSRMatrix **Lptr, HYPRE_Real **Dptr, hypre_ParCSRMatrix **Uptr)
+{
+   MPI_Comm                comm           = hypre_ParCSRMatrixComm(A);
+
+   /* data objects for A */
+   hypre_CSRMatrix         *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real              *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int               *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int               *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Int               n              = hypre_CSRMatrixNumRows(A_diag);
+
+   /* data objects for L, D, U */
+   hypre_ParCSRMatrix      *matL;
+   hypre_ParCSRMatrix      *matU;
+   hypre_CSRMatrix         *L_diag;
+   hypre_CSRMatrix         *U_diag;
+   HYPRE_Real              *D_data;
+   HYPRE_Int               *L_diag_i, *L_diag_j = NULL;
+   HYPRE_Real              *L_diag_data = NULL;
+   HYPRE_Int               *U_diag_i, *U_diag_j = NULL;
+   HYPRE_Real              *U_diag_data = NULL;
+   HYPRE_Int               *S_diag_i, *S_diag_j = NULL, *u_end = NULL;
+   HYPRE_Int               nnz_L, nnz_U;
+   HYPRE_Real              local_nnz, total_nnz;
+
+   /* U by columns, with the diagonal as last entry of each column */
+   HYPRE_Int               *Ut_i, *Ut_j, *U_to_Ut;
+   HYPRE_Real              *Ut_data;
+
+   /* entries of A on the pattern, current values and values of the previous sweep */
+   HYPRE_Real              *L_a, *Ut_a, *L_data, *L_old, *Ut_old, *w, *tmp;
+   HYPRE_Int               *rperm, *iw;
+   HYPRE_Int               i, ii, j, jj, k, kl, ku, kl_end, ku_end, col, sweep;
+   HYPRE_Real              s, dd;
+
+   /* reverse permutation */
+   rperm = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   for(i = 0 ; i < n ; i ++)
+   {
+      rperm[perm[i]] = i;
+   }
+
+   /*
+    * 1: pattern of L and U (strictly upper), rows with increasing columns
+    */
+   L_diag_i = hypre_CTAlloc(HYPRE_Int, n+1, HYPRE_MEMORY_DEVICE);
+   U_diag_i = hypre_CTAlloc(HYPRE_Int, n+1, HYPRE_MEMORY_DEVICE);
+   if(lfil == 0)
+   {
+      for(ii = 0 ; ii < n ; ii ++)
+      {
+         i = perm[ii];
+         L_diag_i[ii+1] = L_diag_i[ii];
+         U_diag_i[ii+1] = U_diag_i[ii];
+         for(j = A_diag_i[i] ; j < A_diag_i[i+1] ; j ++)
+         {
+            col = rperm[A_diag_j[j]];
+            if(col < ii)
+            {
+               L_diag_i[ii+1]++;
+            }
+            else if(col > ii)
+            {
+               U_diag_i[ii+1]++;
+            }
+         }
+      }
+      L_diag_j = hypre_TAlloc(HYPRE_Int, L_diag_i[n], HYPRE_MEMORY_DEVICE);
+      U_diag_j = hypre_TAlloc(HYPRE_Int, U_diag_i[n], HYPRE_MEMORY_DEVICE);
+      for(ii = 0 ; ii < n ; ii ++)
+      {
+         i = perm[ii];
+         kl = L_diag_i[ii];
+         ku = U_diag_i[ii];
+         for(j = A_diag_i[i] ; j < A_diag_i[i+1] ; j ++)
+         {
+            col = rperm[A_diag_j[j]];
+            if(col < ii)
+            {
+               L_diag_j[kl++] = col;
+            }
+            else if(col > ii)
+            {
+               U_diag_j[ku++] = col;
+            }
+         }
+      }
+   }
+   else
+   {
+      iw = hypre_CTAlloc(HYPRE_Int, 3*n, HYPRE_MEMORY_HOST);
+      S_diag_i = hypre_CTAlloc(HYPRE_Int, 1, HYPRE_MEMORY_DEVICE);
+      hypre_ILUSetupILUKSymbolic(n, A_diag_i, A_diag_j, lfil, perm, rperm, iw,
+            n, L_diag_i, U_diag_i, S_diag_i, &L_diag_j, &U_diag_j, &S_diag_j, &u_end);
+      hypre_TFree(iw, HYPRE_MEMORY_HOST);
+      hypre_TFree(S_diag_i, HYPRE_MEMORY_DEVICE);
+      hypre_TFree(S_diag_j, HYPRE_MEMORY_DEVICE);
+      hypre_TFree(u_end, HYPRE_MEMORY_HOST);
+   }
+   nnz_L = L_diag_i[n];
+   nnz_U = U_diag_i[n];
+   for(ii = 0 ; ii < n ; ii ++)
+   {
+      hypre_qsort0(L_diag_j, L_diag_i[ii], L_diag_i[ii+1]-1);
+      hypre_qsort0(U_diag_j, U_diag_i[ii], U_diag_i[ii+1]-1);
+   }
+   L_diag_data = hypre_TAlloc(HYPRE_Real, nnz_L, HYPRE_MEMORY_DEVICE);
+   U_diag_data = hypre_TAlloc(HYPRE_Real, nnz_U, HYPRE_MEMORY_DEVICE);
+   D_data = hypre_TAlloc(HYPRE_Real, n, HYPRE_MEMORY_DEVICE);
+
+   /* U by columns, rows increasing since U is built row by row */
+   Ut_i = hypre_CTAlloc(HYPRE_Int, n+1, HYPRE_MEMORY_HOST);
+   Ut_j = hypre_TAlloc(HYPRE_Int, nnz_U+n, HYPRE_MEMORY_HOST);
+   U_to_Ut = hypre_TAlloc(HYPRE_Int, nnz_U, HYPRE_MEMORY_HOST);
+   for(j = 0 ; j < nnz_U ; j ++)
+   {
+      Ut_i[U_diag_j[j]+1]++;
+   }
+   for(i = 0 ; i < n ; i ++)
+   {
+      Ut_i[i+1] += Ut_i[i] + 1;
+   }
+   iw = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   for(i = 0 ; i < n ; i ++)
+   {
+      iw[i] = Ut_i[i];
+   }
+   for(ii = 0 ; ii < n ; ii ++)
+   {
+      for(j = U_diag_i[ii] ; j < U_diag_i[ii+1] ; j ++)
+      {
+         col = U_diag_j[j];
+         U_to_Ut[j] = iw[col];
+         Ut_j[iw[col]++] = ii;
+      }
+   }
+   for(i = 0 ; i < n ; i ++)
+   {
+      Ut_j[iw[i]] = i;
+   }
+   hypre_TFree(iw, HYPRE_MEMORY_HOST);
+
+   /*
+    * 2: entries of A on the pattern and initial guess
+    */
+   L_a = hypre_CTAlloc(HYPRE_Real, nnz_L, HYPRE_MEMORY_HOST);
+   Ut_a = hypre_CTAlloc(HYPRE_Real, nnz_U+n, HYPRE_MEMORY_HOST);
+   L_data = hypre_TAlloc(HYPRE_Real, nnz_L, HYPRE_MEMORY_HOST);
+   L_old = hypre_TAlloc(HYPRE_Real, nnz_L, HYPRE_MEMORY_HOST);
+   Ut_old = hypre_TAlloc(HYPRE_Real, nnz_U+n, HYPRE_MEMORY_HOST);
+   Ut_data = hypre_TAlloc(HYPRE_Real, nnz_U+n, HYPRE_MEMORY_HOST);
+   w = hypre_CTAlloc(HYPRE_Real, n, HYPRE_MEMORY_HOST);
+   for(ii = 0 ; ii < n ; ii ++)
+   {
+      i = perm[ii];
+      for(j = A_diag_i[i] ; j < A_diag_i[i+1] ; j ++)
+      {
+         w[rperm[A_diag_j[j]]] = A_diag_data[j];
+      }
+      for(j = L_diag_i[ii] ; j < L_diag_i[ii+1] ; j ++)
+      {
+         L_a[j] = w[L_diag_j[j]];
+      }
+      for(j = U_diag_i[ii] ; j < U_diag_i[ii+1] ; j ++)
+      {
+         Ut_a[U_to_Ut[j]] = w[U_diag_j[j]];
+      }
+      Ut_a[Ut_i[ii+1]-1] = w[ii];
+      for(j = A_diag_i[i] ; j < A_diag_i[i+1] ; j ++)
+      {
+         w[rperm[A_diag_j[j]]] = 0.0;
+      }
+   }
+   hypre_TFree(w, HYPRE_MEMORY_HOST);
+
+   for(j = 0 ; j < nnz_U+n ; j ++)
+   {
+      Ut_data[j] = Ut_a[j];
+   }
+   for(ii = 0 ; ii < n ; ii ++)
+   {
+      for(j = L_diag_i[ii] ; j < L_diag_i[ii+1] ; j ++)
+      {
+         dd = Ut_a[Ut_i[L_diag_j[j]+1]-1];
+         L_data[j] = L_a[j] / (fabs(dd) < MAT_TOL ? 1.0e-6 : dd);
+      }
+   }
+
+   /*
+    * 3: sweeps, the sums run over the common entries of row i of L and
+    *    column j of U, both with increasing indices
+    */
+   for(sweep = 0 ; sweep < num_sweeps ; sweep ++)
+   {
+      tmp = L_old; L_old = L_data; L_data = tmp;
+      tmp = Ut_old; Ut_old = Ut_data; Ut_data = tmp;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i,j,jj,k,kl,ku,kl_end,ku_end,col,s,dd)
+#endif
+      {
+         /* L entries by rows */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for(i = 0 ; i < n ; i ++)
+         {
+            for(j = L_diag_i[i] ; j < L_diag_i[i+1] ; j ++)
+            {
+               col = L_diag_j[j];
+               s = L_a[j];
+               kl = L_diag_i[i]; kl_end = j;
+               ku = Ut_i[col]; ku_end = Ut_i[col+1]-1;
+               while(kl < kl_end && ku < ku_end)
+               {
+                  k = Ut_j[ku];
+                  if(L_diag_j[kl] < k)
+                  {
+                     kl++;
+                  }
+                  else if(L_diag_j[kl] > k)
+                  {
+                     ku++;
+                  }
+                  else
+                  {
+                     s -= L_old[kl++] * Ut_old[ku++];
+                  }
+               }
+               dd = Ut_old[Ut_i[col+1]-1];
+               L_data[j] = s / (fabs(dd) < MAT_TOL ? 1.0e-6 : dd);
+            }
+         }
+
+         /* U entries (including the diagonal) by columns */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for(col = 0 ; col < n ; col ++)
+         {
+            for(jj = Ut_i[col] ; jj < Ut_i[col+1] ; jj ++)
+            {
+               i = Ut_j[jj];
+               s = Ut_a[jj];
+               kl = L_diag_i[i]; kl_end = L_diag_i[i+1];
+               ku = Ut_i[col]; ku_end = jj;
+               while(kl < kl_end && ku < ku_end)
+               {
+                  k = Ut_j[ku];
+                  if(L_diag_j[kl] < k)
+                  {
+                     kl++;
+                  }
+                  else if(L_diag_j[kl] > k)
+                  {
+                     ku++;
+                  }
+                  else
+                  {
+                     s -= L_old[kl++] * Ut_old[ku++];
+                  }
+               }
+               Ut_data[jj] = s;
+            }
+         }
+      }
+   }
+
+   /*
+    * 4: L, D (stored as inverse) and U by rows
+    */
+   hypre_TMemcpy(L_diag_data, L_data, HYPRE_Real, nnz_L, HYPRE_MEMORY_DEVICE, HYPRE_MEMORY_HOST);
+   for(i = 0 ; i < n ; i ++)
+   {
+      dd = Ut_data[Ut_i[i+1]-1];
+      if(fabs(dd) < MAT_TOL)
+      {
+         dd = 1.0e-6;
+      }
+      D_data[i] = 1./dd;
+   }
+   for(j = 0 ; j < nnz_U ; j ++)
+   {
+      U_diag_data[j] = Ut_data[U_to_Ut[j]];
+   }
+
+   hypre_TFree(rperm, HYPRE_MEMORY_HOST);
+   hypre_TFree(Ut_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(Ut_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(U_to_Ut, HYPRE_MEMORY_HOST);
+   hypre_TFree(Ut_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(Ut_old, HYPRE_MEMORY_HOST);
+   hypre_TFree(Ut_a, HYPRE_MEMORY_HOST);
+   hypre_TFree(L_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(L_old, HYPRE_MEMORY_HOST);
+   hypre_TFree(L_a, HYPRE_MEMORY_HOST);
+
+   /*
+    * 5: create the ParCSR factors
+    */
+   matL = hypre_ParCSRMatrixCreate( comm,
+         hypre_ParCSRMatrixGlobalNumRows(A),
+         hypre_ParCSRMatrixGlobalNumRows(A),
+         hypre_ParCSRMatrixRowStarts(A),
+         hypre_ParCSRMatrixColStarts(A),
+         0,
+         nnz_L,
+         0 );
+
+   /* Have A own row/col partitioning instead of L */
+   hypre_ParCSRMatrixSetColStartsOwner(matL,0);
+   hypre_ParCSRMatrixSetRowStartsOwner(matL,0);
+   L_diag = hypre_ParCSRMatrixDiag(matL);
+   hypre_CSRMatrixI(L_diag) = L_diag_i;
+   if (nnz_L)
+   {
+      hypre_CSRMatrixData(L_diag) = L_diag_data;
+      hypre_CSRMatrixJ(L_diag) = L_diag_j;
+   }
+   else
+   {
+      hypre_TFree(L_diag_j,HYPRE_MEMORY_DEVICE);
+      hypre_TFree(L_diag_data,HYPRE_MEMORY_DEVICE);
+   }
+   local_nnz = (HYPRE_Real) nnz_L;
+   hypre_MPI_Allreduce(&local_nnz, &total_nnz, 1, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+   hypre_ParCSRMatrixDNumNonzeros(matL) = total_nnz;
+
+   matU = hypre_ParCSRMatrixCreate( comm,
+         hypre_ParCSRMatrixGlobalNumRows(A),
+         hypre_ParCSRMatrixGlobalNumRows(A),
+         hypre_ParCSRMatrixRowStarts(A),
+         hypre_ParCSRMatrixColStarts(A),
+         0,
+         nnz_U,
+         0 );
+
+   /* Have A own row/col partitioning instead of U */
+   hypre_ParCSRMatrixSetColStartsOwner(matU,0);
+   hypre_ParCSRMatrixSetRowStartsOwner(matU,0);
+   U_diag = hypre_ParCSRMatrixDiag(matU);
+   hypre_CSRMatrixI(U_diag) = U_diag_i;
+   if (nnz_U)
+   {
+      hypre_CSRMatrixData(U_diag) = U_diag_data;
+      hypre_CSRMatrixJ(U_diag) = U_diag_j;
+   }
+   else
+   {
+      hypre_TFree(U_diag_j,HYPRE_MEMORY_DEVICE);
+      hypre_TFree(U_diag_data,HYPRE_MEMORY_DEVICE);
+   }
+   local_nnz = (HYPRE_Real) nnz_U;
+   hypre_MPI_Allreduce(&local_nnz, &total_nnz, 1, HYPRE_MPI_REAL, hypre_MPI_SUM, comm);
+   hypre_ParCSRMatrixDNumNonzeros(matU) = total_nnz;
+
+   *Lptr = matL;
+   *Dptr = D_data;
+   *Uptr = matU;
+
    return hypre_error_flag;
 }
 
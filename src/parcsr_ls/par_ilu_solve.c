@@ -75,6 +75,14 @@ hypre_ILUSolve( void               *ilu_vdata,
    HYPRE_Int            nLU            = hypre_ParILUDataNLU(ilu_data);
    HYPRE_Int            *u_end         = hypre_ParILUDataUEnd(ilu_data);
 
+   /* level-scheduled triangular solves */
+   hypre_CSRMatrix      *matL_lvl      = hypre_ParILUDataMatLLvl(ilu_data);
+   hypre_CSRMatrix      *matU_lvl      = hypre_ParILUDataMatULvl(ilu_data);
+   /* Jacobi iterations for the triangular solves */
+   HYPRE_Int            tri_solve      = hypre_ParILUDataTriSolve(ilu_data);
+   HYPRE_Int            lower_iters    = hypre_ParILUDataLowerJacobiIters(ilu_data);
+   HYPRE_Int            upper_iters    = hypre_ParILUDataUpperJacobiIters(ilu_data);
+
    /* Schur system solve */
    HYPRE_Solver         schur_solver   = hypre_ParILUDataSchurSolver(ilu_data);
    HYPRE_Solver         schur_precond  = hypre_ParILUDataSchurPrecond(ilu_data);
@@ -210,7 +218,24 @@ hypre_ILUSolve( void               *ilu_vdata,
       /* Do one solve on LUe=r */
       switch(ilu_type){
          case 0: case 1:
-            hypre_ILUSolveLU(matA, F_array, U_array, perm, n, matL, matD, matU, Utemp, Ftemp); //BJ
+            if(matL_lvl)
+            {
+               hypre_ILUSolveLULevelSchedule(matA, F_array, U_array, perm,
+                     hypre_ParILUDataLNumLevels(ilu_data), hypre_ParILUDataLLevelStarts(ilu_data),
+                     hypre_ParILUDataLLevelRows(ilu_data), matL_lvl,
+                     hypre_ParILUDataUNumLevels(ilu_data), hypre_ParILUDataULevelStarts(ilu_data),
+                     hypre_ParILUDataULevelRows(ilu_data), matU_lvl, hypre_ParILUDataMatDLvl(ilu_data),
+                     Ftemp, Utemp, NULL, NULL, hypre_ParILUDataTriWork(ilu_data)); //BJ, level-scheduled
+            }
+            else if(tri_solve == 2)
+            {
+               hypre_ILUSolveLUIter(matA, F_array, U_array, perm, matL, matD, matU, Ftemp, Utemp,
+                     NULL, NULL, lower_iters, upper_iters, hypre_ParILUDataTriWork(ilu_data)); //BJ, Jacobi
+            }
+            else
+            {
+               hypre_ILUSolveLU(matA, F_array, U_array, perm, n, matL, matD, matU, Utemp, Ftemp); //BJ
+            }
             break;
          case 10: case 11:
             hypre_ILUSolveSchurGMRES(matA, F_array, U_array, perm, perm, nLU, matL, matD, matU, matS,
@@ -221,14 +246,48 @@ hypre_ILUSolve( void               *ilu_vdata,
                   Utemp, Ftemp, schur_solver, rhs, x, u_end); //MR+NSH
             break;
          case 30: case 31:
-            hypre_ILUSolveLURAS(matA, F_array, U_array, perm, matL, matD, matU, Utemp, Utemp, fext, uext); //RAS
+            if(matL_lvl)
+            {
+               hypre_ILUSolveLULevelSchedule(matA, F_array, U_array, perm,
+                     hypre_ParILUDataLNumLevels(ilu_data), hypre_ParILUDataLLevelStarts(ilu_data),
+                     hypre_ParILUDataLLevelRows(ilu_data), matL_lvl,
+                     hypre_ParILUDataUNumLevels(ilu_data), hypre_ParILUDataULevelStarts(ilu_data),
+                     hypre_ParILUDataULevelRows(ilu_data), matU_lvl, hypre_ParILUDataMatDLvl(ilu_data),
+                     Utemp, Utemp, fext, uext, hypre_ParILUDataTriWork(ilu_data)); //RAS, level-scheduled
+            }
+            else if(tri_solve == 2)
+            {
+               hypre_ILUSolveLUIter(matA, F_array, U_array, perm, matL, matD, matU, Utemp, Utemp,
+                     fext, uext, lower_iters, upper_iters, hypre_ParILUDataTriWork(ilu_data)); //RAS, Jacobi
+            }
+            else
+            {
+               hypre_ILUSolveLURAS(matA, F_array, U_array, perm, matL, matD, matU, Utemp, Utemp, fext, uext); //RAS
+            }
             break;
          case 40: case 41:
             hypre_ILUSolveSchurGMRES(matA, F_array, U_array, perm, qperm, nLU, matL, matD, matU, matS,
                   Utemp, Ftemp, schur_solver, schur_precond, rhs, x, u_end); //GMRES
             break;
          default:
-            hypre_ILUSolveLU(matA, F_array, U_array, perm, n, matL, matD, matU, Utemp, Ftemp); //BJ
+            if(matL_lvl)
+            {
+               hypre_ILUSolveLULevelSchedule(matA, F_array, U_array, perm,
+                     hypre_ParILUDataLNumLevels(ilu_data), hypre_ParILUDataLLevelStarts(ilu_data),
+                     hypre_ParILUDataLLevelRows(ilu_data), matL_lvl,
+                     hypre_ParILUDataUNumLevels(ilu_data), hypre_ParILUDataULevelStarts(ilu_data),
+                     hypre_ParILUDataULevelRows(ilu_data), matU_lvl, hypre_ParILUDataMatDLvl(ilu_data),
+                     Ftemp, Utemp, NULL, NULL, hypre_ParILUDataTriWork(ilu_data)); //BJ, level-scheduled
+            }
+            else if(tri_solve == 2)
+            {
+               hypre_ILUSolveLUIter(matA, F_array, U_array, perm, matL, matD, matU, Ftemp, Utemp,
+                     NULL, NULL, lower_iters, upper_iters, hypre_ParILUDataTriWork(ilu_data)); //BJ, Jacobi
+            }
+            else
+            {
+               hypre_ILUSolveLU(matA, F_array, U_array, perm, n, matL, matD, matU, Utemp, Ftemp); //BJ
+            }
             break;
 
       }
@@ -912,6 +971,309 @@ hypre_ILUSolveLURAS(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
    return hypre_error_flag;
 }
 
+/* Level-scheduled triangular solve
+ * Solves T*w = w in place for the factor level scheduled by
+ * hypre_ILUSetupLevelSchedule, i.e. the rows of T_lvl are in the order of
+ * level_rows and the diagonal is the identity (D_lvl = NULL) or the inverse
+ * of D_lvl. The levels are processed one after the other and the rows of a
+ * level in parallel. Each row is updated in the same order as in the
+ * sequential substitution, so the result does not depend on the number of
+ * threads.
+*/
+
+HYPRE_Int
+hypre_ILUSolveLevelSchedule(HYPRE_Int num_levels, HYPRE_Int *level_starts,
+                  HYPRE_Int *level_rows, hypre_CSRMatrix *T_lvl,
+                  HYPRE_Real *D_lvl, HYPRE_Real *w)
+{
+   HYPRE_Int         *T_lvl_i = hypre_CSRMatrixI(T_lvl);
+   HYPRE_Int         *T_lvl_j = hypre_CSRMatrixJ(T_lvl);
+   HYPRE_Real        *T_lvl_data = hypre_CSRMatrixData(T_lvl);
+
+   HYPRE_Int         lev, k, i, j;
+   HYPRE_Real        wi;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(lev,k,i,j,wi)
+#endif
+   for(lev = 0 ; lev < num_levels ; lev ++)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for(k = level_starts[lev] ; k < level_starts[lev+1] ; k ++)
+      {
+         i = level_rows[k];
+         wi = w[i];
+         for(j = T_lvl_i[k] ; j < T_lvl_i[k+1] ; j ++)
+         {
+            wi -= T_lvl_data[j] * w[T_lvl_j[j]];
+         }
+         /* diagonal scaling (D is stored as its inverse) */
+         if(D_lvl)
+         {
+            wi *= D_lvl[k];
+         }
+         w[i] = wi;
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/* Incomplete LU solve with level-scheduled triangular solves
+ * Applies the block Jacobi (fext = NULL) or RAS factors like hypre_ILUSolveLU
+ * and hypre_ILUSolveLURAS, with the L and U solves of
+ * hypre_ILUSolveLevelSchedule on the work array w. The first n entries of w
+ * hold the local unknowns in the order of the factors and the remaining ones
+ * the external unknowns of RAS.
+*/
+
+HYPRE_Int
+hypre_ILUSolveLULevelSchedule(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
+                  hypre_ParVector    *u, HYPRE_Int *perm,
+                  HYPRE_Int L_num_levels, HYPRE_Int *L_level_starts,
+                  HYPRE_Int *L_level_rows, hypre_CSRMatrix *L_lvl,
+                  HYPRE_Int U_num_levels, HYPRE_Int *U_level_starts,
+                  HYPRE_Int *U_level_rows, hypre_CSRMatrix *U_lvl,
+                  HYPRE_Real *D_lvl, hypre_ParVector *ftemp,
+                  hypre_ParVector *utemp, HYPRE_Real *fext,
+                  HYPRE_Real *uext, HYPRE_Real *w)
+{
+   hypre_ParCSRCommPkg        *comm_pkg;
+   hypre_ParCSRCommHandle     *comm_handle;
+   HYPRE_Int                  num_sends, begin, end;
+
+   HYPRE_Int                  n = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+   HYPRE_Int                  n_total = hypre_CSRMatrixNumRows(L_lvl);
+
+   hypre_Vector               *utemp_local = hypre_ParVectorLocalVector(utemp);
+   HYPRE_Real                 *utemp_data  = hypre_VectorData(utemp_local);
+
+   hypre_Vector               *ftemp_local = hypre_ParVectorLocalVector(ftemp);
+   HYPRE_Real                 *ftemp_data  = hypre_VectorData(ftemp_local);
+
+   HYPRE_Real                 alpha;
+   HYPRE_Real                 beta;
+   HYPRE_Int                  i;
+
+   /* begin */
+   alpha = -1.0;
+   beta = 1.0;
+
+   /* compute residual */
+   hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A, u, beta, f, ftemp);
+
+   /* communication to get external data for RAS */
+   if(fext)
+   {
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      if(!comm_pkg)
+      {
+         hypre_MatvecCommPkgCreate(A);
+         comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      }
+      num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      begin = hypre_ParCSRCommPkgSendMapStart(comm_pkg,0);
+      end = hypre_ParCSRCommPkgSendMapStart(comm_pkg,num_sends);
+
+      /* borrow uext as send buffer */
+      for(i = begin ; i < end ; i ++)
+      {
+         uext[i-begin] = ftemp_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg,i)];
+      }
+      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, uext, fext);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+   }
+
+   /* gather the rhs in the order of the factors */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for( i = 0; i < n; i++ )
+   {
+      w[i] = ftemp_data[perm[i]];
+   }
+   for( i = n; i < n_total; i++ )
+   {
+      w[i] = fext[i-n];
+   }
+
+   /* L solve - Forward solve */
+   hypre_ILUSolveLevelSchedule(L_num_levels, L_level_starts, L_level_rows, L_lvl, NULL, w);
+
+   /* U solve - Backward substitution */
+   hypre_ILUSolveLevelSchedule(U_num_levels, U_level_starts, U_level_rows, U_lvl, D_lvl, w);
+
+   /* scatter the local part of the correction */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for( i = 0; i < n; i++ )
+   {
+      utemp_data[perm[i]] = w[i];
+   }
+
+   /* Update solution */
+   hypre_ParVectorAxpy(beta, utemp, u);
+
+   return hypre_error_flag;
+}
+
+/* Incomplete LU solve with Jacobi iterations for the triangular solves
+ * Applies the block Jacobi (fext = NULL) or RAS factors like hypre_ILUSolveLU
+ * and hypre_ILUSolveLURAS, with the L and U solves replaced by lower_iters
+ * and upper_iters Jacobi iterations,
+ *    y <- b - (L-I)*y,          starting from y = b,
+ *    x <- D*(y - (U-D^{-1})*x), starting from x = D*y.
+ * The iterations only need matrix-vector products, so all rows are updated in
+ * parallel. They converge to the exact triangular solves after as many
+ * iterations as there are levels in the factors.
+ * work = array of length 3*n_total, with n_total the number of rows of L.
+*/
+
+HYPRE_Int
+hypre_ILUSolveLUIter(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
+                  hypre_ParVector    *u, HYPRE_Int *perm,
+                  hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U,
+                  hypre_ParVector *ftemp, hypre_ParVector *utemp,
+                  HYPRE_Real *fext, HYPRE_Real *uext,
+                  HYPRE_Int lower_iters, HYPRE_Int upper_iters, HYPRE_Real *work)
+{
+   hypre_ParCSRCommPkg        *comm_pkg;
+   hypre_ParCSRCommHandle     *comm_handle;
+   HYPRE_Int                  num_sends, begin, end;
+
+   hypre_CSRMatrix            *L_diag = hypre_ParCSRMatrixDiag(L);
+   HYPRE_Real                 *L_diag_data = hypre_CSRMatrixData(L_diag);
+   HYPRE_Int                  *L_diag_i = hypre_CSRMatrixI(L_diag);
+   HYPRE_Int                  *L_diag_j = hypre_CSRMatrixJ(L_diag);
+
+   hypre_CSRMatrix            *U_diag = hypre_ParCSRMatrixDiag(U);
+   HYPRE_Real                 *U_diag_data = hypre_CSRMatrixData(U_diag);
+   HYPRE_Int                  *U_diag_i = hypre_CSRMatrixI(U_diag);
+   HYPRE_Int                  *U_diag_j = hypre_CSRMatrixJ(U_diag);
+
+   HYPRE_Int                  n = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
+   HYPRE_Int                  n_total = hypre_CSRMatrixNumRows(L_diag);
+
+   hypre_Vector               *utemp_local = hypre_ParVectorLocalVector(utemp);
+   HYPRE_Real                 *utemp_data  = hypre_VectorData(utemp_local);
+
+   hypre_Vector               *ftemp_local = hypre_ParVectorLocalVector(ftemp);
+   HYPRE_Real                 *ftemp_data  = hypre_VectorData(ftemp_local);
+
+   HYPRE_Real                 *b, *y, *x, *tmp;
+   HYPRE_Real                 alpha;
+   HYPRE_Real                 beta;
+   HYPRE_Real                 t;
+   HYPRE_Int                  i, j, iter;
+
+   /* begin */
+   alpha = -1.0;
+   beta = 1.0;
+   b = work;
+   y = work + n_total;
+   x = work + 2*n_total;
+
+   /* compute residual */
+   hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A, u, beta, f, ftemp);
+
+   /* communication to get external data for RAS */
+   if(fext)
+   {
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      if(!comm_pkg)
+      {
+         hypre_MatvecCommPkgCreate(A);
+         comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+      }
+      num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      begin = hypre_ParCSRCommPkgSendMapStart(comm_pkg,0);
+      end = hypre_ParCSRCommPkgSendMapStart(comm_pkg,num_sends);
+
+      /* borrow uext as send buffer */
+      for(i = begin ; i < end ; i ++)
+      {
+         uext[i-begin] = ftemp_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg,i)];
+      }
+      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, uext, fext);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+   }
+
+   /* gather the rhs in the order of the factors */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for( i = 0; i < n; i++ )
+   {
+      b[i] = ftemp_data[perm[i]];
+      y[i] = b[i];
+   }
+   for( i = n; i < n_total; i++ )
+   {
+      b[i] = fext[i-n];
+      y[i] = b[i];
+   }
+
+   /* L solve - Jacobi iterations, b and y in use */
+   for(iter = 0 ; iter < lower_iters ; iter ++)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j,t) HYPRE_SMP_SCHEDULE
+#endif
+      for( i = 0; i < n_total; i++ )
+      {
+         t = b[i];
+         for(j = L_diag_i[i] ; j < L_diag_i[i+1] ; j ++)
+         {
+            t -= L_diag_data[j] * y[L_diag_j[j]];
+         }
+         x[i] = t;
+      }
+      tmp = y; y = x; x = tmp;
+   }
+
+   /* U solve - Jacobi iterations, y and x in use, b is free */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for( i = 0; i < n_total; i++ )
+   {
+      x[i] = D[i] * y[i];
+   }
+   for(iter = 0 ; iter < upper_iters ; iter ++)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j,t) HYPRE_SMP_SCHEDULE
+#endif
+      for( i = 0; i < n_total; i++ )
+      {
+         t = y[i];
+         for(j = U_diag_i[i] ; j < U_diag_i[i+1] ; j ++)
+         {
+            t -= U_diag_data[j] * x[U_diag_j[j]];
+         }
+         b[i] = D[i] * t;
+      }
+      tmp = x; x = b; b = tmp;
+   }
+
+   /* scatter the local part of the correction */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for( i = 0; i < n; i++ )
+   {
+      utemp_data[perm[i]] = x[i];
+   }
+
+   /* Update solution */
+   hypre_ParVectorAxpy(beta, utemp, u);
+
+   return hypre_error_flag;
+}
+
 
 /* solve functions for NSH */
 
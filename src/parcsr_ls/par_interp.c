@@ -118,6 +118,9 @@ hypre_BoomerAMGBuildInterp( hypre_ParCSRMatrix   *A,
    HYPRE_Int          print_level = 0;
    HYPRE_Int         *int_buf_data;
 
+   /* short-lived work arrays come from the AMG setup arena, if any */
+   hypre_Arena       *arena = hypre_HandleSetupArena(hypre_handle());
+
    HYPRE_BigInt col_1 = hypre_ParCSRMatrixFirstRowIndex(A);
    HYPRE_Int local_numrows = hypre_CSRMatrixNumRows(A_diag);
    HYPRE_BigInt col_n = col_1 + (HYPRE_BigInt)local_numrows;
@@ -149,10 +152,10 @@ hypre_BoomerAMGBuildInterp( hypre_ParCSRMatrix   *A,
 
    if (debug_flag==4) wall_time = time_getWallclockSeconds();
 
-   if (num_cols_A_offd) CF_marker_offd = hypre_CTAlloc(HYPRE_Int,  num_cols_A_offd, HYPRE_MEMORY_HOST);
+   if (num_cols_A_offd) CF_marker_offd = hypre_ArenaCTAlloc(arena, HYPRE_Int, num_cols_A_offd);
    if (num_functions > 1 && num_cols_A_offd)
    {
-      dof_func_offd = hypre_CTAlloc(HYPRE_Int,  num_cols_A_offd, HYPRE_MEMORY_HOST);
+      dof_func_offd = hypre_ArenaCTAlloc(arena, HYPRE_Int, num_cols_A_offd);
    }
 
    if (!comm_pkg)
@@ -162,8 +165,8 @@ hypre_BoomerAMGBuildInterp( hypre_ParCSRMatrix   *A,
    }
 
    num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
-   int_buf_data = hypre_CTAlloc(HYPRE_Int,  hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
-                                HYPRE_MEMORY_HOST);
+   int_buf_data = hypre_ArenaCTAlloc(arena, HYPRE_Int,
+                                     hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends));
 
    index = 0;
    for (i = 0; i < num_sends; i++)
@@ -259,11 +262,11 @@ hypre_BoomerAMGBuildInterp( hypre_ParCSRMatrix   *A,
     *  Intialize counters and allocate mapping vector.
     *-----------------------------------------------------------------------*/
 
-   coarse_counter = hypre_CTAlloc(HYPRE_Int,  num_threads, HYPRE_MEMORY_HOST);
-   jj_count = hypre_CTAlloc(HYPRE_Int,  num_threads, HYPRE_MEMORY_HOST);
-   jj_count_offd = hypre_CTAlloc(HYPRE_Int,  num_threads, HYPRE_MEMORY_HOST);
+   coarse_counter = hypre_ArenaCTAlloc(arena, HYPRE_Int, num_threads);
+   jj_count = hypre_ArenaCTAlloc(arena, HYPRE_Int, num_threads);
+   jj_count_offd = hypre_ArenaCTAlloc(arena, HYPRE_Int, num_threads);
 
-   fine_to_coarse = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
+   fine_to_coarse = hypre_ArenaCTAlloc(arena, HYPRE_Int, n_fine);
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
 #endif
@@ -485,9 +488,9 @@ for (i = 0; i < n_fine; i++) fine_to_coarse[i] -= my_first_cpt; */
       jj_counter_offd = 0;
       if (jl > 0) jj_counter_offd = jj_count_offd[jl-1];
 
-      P_marker = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
+      P_marker = hypre_ArenaCTAlloc(arena, HYPRE_Int, n_fine);
       if (num_cols_A_offd)
-         P_marker_offd = hypre_CTAlloc(HYPRE_Int,  num_cols_A_offd, HYPRE_MEMORY_HOST);
+         P_marker_offd = hypre_ArenaCTAlloc(arena, HYPRE_Int, num_cols_A_offd);
       else
          P_marker_offd = NULL;
 
@@ -910,8 +913,8 @@ for (i = 0; i < n_fine; i++) fine_to_coarse[i] -= my_first_cpt; */
 
          P_offd_i[i+1] = jj_counter_offd;
       }
-      hypre_TFree(P_marker, HYPRE_MEMORY_HOST);
-      hypre_TFree(P_marker_offd, HYPRE_MEMORY_HOST);
+      hypre_ArenaTFree(arena, P_marker);
+      hypre_ArenaTFree(arena, P_marker_offd);
    }
 
    P = hypre_ParCSRMatrixCreate(comm,
@@ -951,7 +954,7 @@ for (i = 0; i < n_fine; i++) fine_to_coarse[i] -= my_first_cpt; */
    num_cols_P_offd = 0;
    if (P_offd_size)
    {
-      P_marker = hypre_CTAlloc(HYPRE_Int,  num_cols_A_offd, HYPRE_MEMORY_HOST);
+      P_marker = hypre_ArenaCTAlloc(arena, HYPRE_Int, num_cols_A_offd);
 
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
@@ -973,7 +976,7 @@ for (i = 0; i < n_fine; i++) fine_to_coarse[i] -= my_first_cpt; */
       }
 
       col_map_offd_P = hypre_CTAlloc(HYPRE_BigInt, num_cols_P_offd, HYPRE_MEMORY_HOST);
-      tmp_map_offd = hypre_CTAlloc(HYPRE_Int, num_cols_P_offd, HYPRE_MEMORY_HOST);
+      tmp_map_offd = hypre_ArenaCTAlloc(arena, HYPRE_Int, num_cols_P_offd);
 
       index = 0;
       for (i=0; i < num_cols_P_offd; i++)
@@ -989,7 +992,7 @@ for (i = 0; i < n_fine; i++) fine_to_coarse[i] -= my_first_cpt; */
          P_offd_j[i] = hypre_BinarySearch(tmp_map_offd,
                P_offd_j[i],
                num_cols_P_offd);
-      hypre_TFree(P_marker, HYPRE_MEMORY_HOST);
+      hypre_ArenaTFree(arena, P_marker);
    }
 
    for (i=0; i < n_fine; i++)
@@ -1008,15 +1011,15 @@ for (i = 0; i < n_fine; i++) fine_to_coarse[i] -= my_first_cpt; */
 
    *P_ptr = P;
 
-   hypre_TFree(tmp_map_offd, HYPRE_MEMORY_HOST);
-   hypre_TFree(CF_marker_offd, HYPRE_MEMORY_HOST);
-   hypre_TFree(dof_func_offd, HYPRE_MEMORY_HOST);
-   hypre_TFree(int_buf_data, HYPRE_MEMORY_HOST);
-   hypre_TFree(fine_to_coarse, HYPRE_MEMORY_HOST);
+   hypre_ArenaTFree(arena, tmp_map_offd);
+   hypre_ArenaTFree(arena, CF_marker_offd);
+   hypre_ArenaTFree(arena, dof_func_offd);
+   hypre_ArenaTFree(arena, int_buf_data);
+   hypre_ArenaTFree(arena, fine_to_coarse);
    //hypre_TFree(fine_to_coarse_offd, HYPRE_MEMORY_HOST);
-   hypre_TFree(coarse_counter, HYPRE_MEMORY_HOST);
-   hypre_TFree(jj_count, HYPRE_MEMORY_HOST);
-   hypre_TFree(jj_count_offd, HYPRE_MEMORY_HOST);
+   hypre_ArenaTFree(arena, coarse_counter);
+   hypre_ArenaTFree(arena, jj_count);
+   hypre_ArenaTFree(arena, jj_count_offd);
 
    if (num_procs > 1) hypre_CSRMatrixDestroy(A_ext);
 
@@ -177,6 +177,80 @@ hypre_ParKrylovInnerProd( void *x,
                                       (hypre_ParVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovInnerProdsStart, hypre_ParKrylovInnerProdsFinish
+ *
+ * result[i] = <x[i],y[i]> for i < num, with a single non-blocking reduction.
+ * The results are available after hypre_ParKrylovInnerProdsFinish.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   hypre_MPI_Request  request;
+   HYPRE_Real        *local_result;
+
+} hypre_ParKrylovInnerProdsRequest;
+
+HYPRE_Int
+hypre_ParKrylovInnerProdsStart( HYPRE_Int    num,
+                                void       **x,
+                                void       **y,
+                                HYPRE_Real  *result,
+                                void       **request_ptr )
+{
+   hypre_ParKrylovInnerProdsRequest *request;
+   MPI_Comm                          comm = hypre_ParVectorComm((hypre_ParVector *) x[0]);
+   HYPRE_Int                         i;
+
+   request = hypre_CTAlloc(hypre_ParKrylovInnerProdsRequest, 1, HYPRE_MEMORY_HOST);
+   request -> local_result = hypre_CTAlloc(HYPRE_Real, num, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < num; i++)
+   {
+      (request -> local_result)[i] =
+         hypre_SeqVectorInnerProd(hypre_ParVectorLocalVector((hypre_ParVector *) x[i]),
+                                  hypre_ParVectorLocalVector((hypre_ParVector *) y[i]));
+   }
+
+   hypre_MPI_Iallreduce(request -> local_result, result, num, HYPRE_MPI_REAL,
+                        hypre_MPI_SUM, comm, &(request -> request));
+
+   *request_ptr = (void *) request;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_ParKrylovInnerProdsFinish( void *request_vdata )
+{
+   hypre_ParKrylovInnerProdsRequest *request = (hypre_ParKrylovInnerProdsRequest *) request_vdata;
+   hypre_MPI_Status                  status;
+
+   if (request)
+   {
+      hypre_MPI_Wait(&(request -> request), &status);
+      hypre_TFree(request -> local_result, HYPRE_MEMORY_HOST);
+      hypre_TFree(request, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovBlockInnerProd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovBlockInnerProd( HYPRE_Int    nx,
+                               void       **x,
+                               HYPRE_Int    ny,
+                               void       **y,
+                               HYPRE_Real  *result )
+{
+   return ( hypre_ParVectorBlockInnerProd(nx, (hypre_ParVector **) x,
+                                          ny, (hypre_ParVector **) y, result) );
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParKrylovMassInnerProd
  *--------------------------------------------------------------------------*/
@@ -86,6 +86,9 @@ hypre_BoomerAMGBuildStdInterp(hypre_ParCSRMatrix  *A,
    HYPRE_Int       *tmp_CF_marker_offd = NULL;
    HYPRE_Int       *dof_func_offd = NULL;
 
+   /* short-lived work arrays come from the AMG setup arena, if any */
+   hypre_Arena     *arena = hypre_HandleSetupArena(hypre_handle());
+
    /* Full row information for columns of A that are off diag*/
    hypre_CSRMatrix *A_ext;
    HYPRE_Real      *A_ext_data;
@@ -196,15 +199,15 @@ hypre_BoomerAMGBuildStdInterp(hypre_ParCSRMatrix  *A,
 
    if (n_fine)
    {
-      fine_to_coarse = hypre_CTAlloc(HYPRE_Int, n_fine, HYPRE_MEMORY_HOST);
-      P_marker       = hypre_CTAlloc(HYPRE_Int, n_fine, HYPRE_MEMORY_HOST);
+      fine_to_coarse = hypre_ArenaCTAlloc(arena, HYPRE_Int, n_fine);
+      P_marker       = hypre_ArenaCTAlloc(arena, HYPRE_Int, n_fine);
    }
 
    if (full_off_procNodes)
    {
-      P_marker_offd       = hypre_CTAlloc(HYPRE_Int,    full_off_procNodes, HYPRE_MEMORY_HOST);
-      fine_to_coarse_offd = hypre_CTAlloc(HYPRE_BigInt, full_off_procNodes, HYPRE_MEMORY_HOST);
-      tmp_CF_marker_offd  = hypre_CTAlloc(HYPRE_Int,    full_off_procNodes, HYPRE_MEMORY_HOST);
+      P_marker_offd       = hypre_ArenaCTAlloc(arena, HYPRE_Int, full_off_procNodes);
+      fine_to_coarse_offd = hypre_ArenaCTAlloc(arena, HYPRE_BigInt, full_off_procNodes);
+      tmp_CF_marker_offd  = hypre_ArenaCTAlloc(arena, HYPRE_Int, full_off_procNodes);
    }
 
    hypre_initialize_vecs(n_fine, full_off_procNodes, fine_to_coarse,
@@ -393,15 +396,15 @@ hypre_BoomerAMGBuildStdInterp(hypre_ParCSRMatrix  *A,
     * interpolation routine. */
    if (n_fine)
    {
-      ahat = hypre_CTAlloc(HYPRE_Real, n_fine, HYPRE_MEMORY_HOST);
-      ihat = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
-      ipnt = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
+      ahat = hypre_ArenaCTAlloc(arena, HYPRE_Real, n_fine);
+      ihat = hypre_ArenaCTAlloc(arena, HYPRE_Int, n_fine);
+      ipnt = hypre_ArenaCTAlloc(arena, HYPRE_Int, n_fine);
    }
    if (full_off_procNodes)
    {
-      ahat_offd = hypre_CTAlloc(HYPRE_Real, full_off_procNodes, HYPRE_MEMORY_HOST);
-      ihat_offd = hypre_CTAlloc(HYPRE_Int,  full_off_procNodes, HYPRE_MEMORY_HOST);
-      ipnt_offd = hypre_CTAlloc(HYPRE_Int,  full_off_procNodes, HYPRE_MEMORY_HOST);
+      ahat_offd = hypre_ArenaCTAlloc(arena, HYPRE_Real, full_off_procNodes);
+      ihat_offd = hypre_ArenaCTAlloc(arena, HYPRE_Int, full_off_procNodes);
+      ipnt_offd = hypre_ArenaCTAlloc(arena, HYPRE_Int, full_off_procNodes);
    }
 
    for (i = 0; i < n_fine; i++)
@@ -1002,26 +1005,26 @@ hypre_BoomerAMGBuildStdInterp(hypre_ParCSRMatrix  *A,
    *P_ptr = P;
 
    /* Deallocate memory */
-   hypre_TFree(fine_to_coarse, HYPRE_MEMORY_HOST);
-   hypre_TFree(P_marker, HYPRE_MEMORY_HOST);
-   hypre_TFree(ahat, HYPRE_MEMORY_HOST);
-   hypre_TFree(ihat, HYPRE_MEMORY_HOST);
-   hypre_TFree(ipnt, HYPRE_MEMORY_HOST);
+   hypre_ArenaTFree(arena, fine_to_coarse);
+   hypre_ArenaTFree(arena, P_marker);
+   hypre_ArenaTFree(arena, ahat);
+   hypre_ArenaTFree(arena, ihat);
+   hypre_ArenaTFree(arena, ipnt);
 
    if (full_off_procNodes)
    {
-      hypre_TFree(ahat_offd, HYPRE_MEMORY_HOST);
-      hypre_TFree(ihat_offd, HYPRE_MEMORY_HOST);
-      hypre_TFree(ipnt_offd, HYPRE_MEMORY_HOST);
+      hypre_ArenaTFree(arena, ahat_offd);
+      hypre_ArenaTFree(arena, ihat_offd);
+      hypre_ArenaTFree(arena, ipnt_offd);
    }
    if (num_procs > 1)
    {
       hypre_CSRMatrixDestroy(Sop);
       hypre_CSRMatrixDestroy(A_ext);
-      hypre_TFree(fine_to_coarse_offd, HYPRE_MEMORY_HOST);
-      hypre_TFree(P_marker_offd, HYPRE_MEMORY_HOST);
+      hypre_ArenaTFree(arena, fine_to_coarse_offd);
+      hypre_ArenaTFree(arena, P_marker_offd);
       hypre_TFree(CF_marker_offd, HYPRE_MEMORY_HOST);
-      hypre_TFree(tmp_CF_marker_offd, HYPRE_MEMORY_HOST);
+      hypre_ArenaTFree(arena, tmp_CF_marker_offd);
       if (num_functions > 1)
       {
          hypre_TFree(dof_func_offd, HYPRE_MEMORY_HOST);
@@ -1111,6 +1114,9 @@ hypre_BoomerAMGBuildExtPIInterp(hypre_ParCSRMatrix   *A,
    HYPRE_Int       *tmp_CF_marker_offd = NULL;
    HYPRE_Int       *dof_func_offd = NULL;
 
+   /* short-lived work arrays come from the AMG setup arena, if any */
+   hypre_Arena     *arena = hypre_HandleSetupArena(hypre_handle());
+
    /* Full row information for columns of A that are off diag*/
    hypre_CSRMatrix *A_ext;
    HYPRE_Real      *A_ext_data;
@@ -1216,13 +1222,13 @@ hypre_BoomerAMGBuildExtPIInterp(hypre_ParCSRMatrix   *A,
 
    if (n_fine)
    {
-      fine_to_coarse = hypre_CTAlloc(HYPRE_Int, n_fine, HYPRE_MEMORY_HOST);
+      fine_to_coarse = hypre_ArenaCTAlloc(arena, HYPRE_Int, n_fine);
    }
 
    if (full_off_procNodes)
    {
-      fine_to_coarse_offd = hypre_CTAlloc(HYPRE_BigInt, full_off_procNodes, HYPRE_MEMORY_HOST);
-      tmp_CF_marker_offd  = hypre_CTAlloc(HYPRE_Int,    full_off_procNodes, HYPRE_MEMORY_HOST);
+      fine_to_coarse_offd = hypre_ArenaCTAlloc(arena, HYPRE_BigInt, full_off_procNodes);
+      tmp_CF_marker_offd  = hypre_ArenaCTAlloc(arena, HYPRE_Int, full_off_procNodes);
    }
 
    /* This function is smart enough to check P_marker and P_marker_offd only,
@@ -1236,9 +1242,9 @@ hypre_BoomerAMGBuildExtPIInterp(hypre_ParCSRMatrix   *A,
     *  Initialize threading variables
     *-----------------------------------------------------------------------*/
    max_num_threads[0] = hypre_NumThreads();
-   diag_offset           = hypre_CTAlloc(HYPRE_Int, max_num_threads[0], HYPRE_MEMORY_HOST);
-   fine_to_coarse_offset = hypre_CTAlloc(HYPRE_Int, max_num_threads[0], HYPRE_MEMORY_HOST);
-   offd_offset           = hypre_CTAlloc(HYPRE_Int, max_num_threads[0], HYPRE_MEMORY_HOST);
+   diag_offset           = hypre_ArenaCTAlloc(arena, HYPRE_Int, max_num_threads[0]);
+   fine_to_coarse_offset = hypre_ArenaCTAlloc(arena, HYPRE_Int, max_num_threads[0]);
+   offd_offset           = hypre_ArenaCTAlloc(arena, HYPRE_Int, max_num_threads[0]);
    for (i=0; i < max_num_threads[0]; i++)
    {
       diag_offset[i] = 0;
@@ -1277,13 +1283,13 @@ hypre_BoomerAMGBuildExtPIInterp(hypre_ParCSRMatrix   *A,
       jj_counter_offd = start_indexing;
       if (n_fine)
       {
-         P_marker = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
+         P_marker = hypre_ArenaCTAlloc(arena, HYPRE_Int, n_fine);
          for (i = 0; i < n_fine; i++)
          {  P_marker[i] = -1; }
       }
       if (full_off_procNodes)
       {
-         P_marker_offd = hypre_CTAlloc(HYPRE_Int,  full_off_procNodes, HYPRE_MEMORY_HOST);
+         P_marker_offd = hypre_ArenaCTAlloc(arena, HYPRE_Int, full_off_procNodes);
          for (i = 0; i < full_off_procNodes; i++)
          {  P_marker_offd[i] = -1;}
       }
@@ -1810,12 +1816,12 @@ hypre_BoomerAMGBuildExtPIInterp(hypre_ParCSRMatrix   *A,
 
       if (n_fine)
       {
-         hypre_TFree(P_marker, HYPRE_MEMORY_HOST);
+         hypre_ArenaTFree(arena, P_marker);
       }
 
       if (full_off_procNodes)
       {
-         hypre_TFree(P_marker_offd, HYPRE_MEMORY_HOST);
+         hypre_ArenaTFree(arena, P_marker_offd);
       }
    }
    /*-----------------------------------------------------------------------
@@ -1900,18 +1906,18 @@ hypre_BoomerAMGBuildExtPIInterp(hypre_ParCSRMatrix   *A,
 
    /* Deallocate memory */
    hypre_TFree(max_num_threads, HYPRE_MEMORY_HOST);
-   hypre_TFree(fine_to_coarse, HYPRE_MEMORY_HOST);
-   hypre_TFree(diag_offset, HYPRE_MEMORY_HOST);
-   hypre_TFree(offd_offset, HYPRE_MEMORY_HOST);
-   hypre_TFree(fine_to_coarse_offset, HYPRE_MEMORY_HOST);
+   hypre_ArenaTFree(arena, fine_to_coarse);
+   hypre_ArenaTFree(arena, diag_offset);
+   hypre_ArenaTFree(arena, offd_offset);
+   hypre_ArenaTFree(arena, fine_to_coarse_offset);
 
    if (num_procs > 1)
    {
       hypre_CSRMatrixDestroy(Sop);
       hypre_CSRMatrixDestroy(A_ext);
-      hypre_TFree(fine_to_coarse_offd, HYPRE_MEMORY_HOST);
+      hypre_ArenaTFree(arena, fine_to_coarse_offd);
       hypre_TFree(CF_marker_offd, HYPRE_MEMORY_HOST);
-      hypre_TFree(tmp_CF_marker_offd, HYPRE_MEMORY_HOST);
+      hypre_ArenaTFree(arena, tmp_CF_marker_offd);
       if (num_functions > 1)
       {
          hypre_TFree(dof_func_offd, HYPRE_MEMORY_HOST);
@@ -1992,6 +1998,10 @@ hypre_BoomerAMGBuildExtPICCInterp(hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
    HYPRE_Int       *CF_marker_offd = NULL;
    HYPRE_Int       *tmp_CF_marker_offd = NULL;
    HYPRE_Int       *dof_func_offd = NULL;
+
+   /* short-lived work arrays come from the AMG setup arena, if any */
+   hypre_Arena     *arena = hypre_HandleSetupArena(hypre_handle());
+
    /*HYPRE_Int             **ext_p, **ext_p_offd;*/
    /*HYPRE_Int              ccounter_offd;
      HYPRE_Int             *clist_offd;*/
@@ -2093,15 +2103,15 @@ hypre_BoomerAMGBuildExtPICCInterp(hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
 
    if (n_fine)
    {
-      fine_to_coarse = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
-      P_marker = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
+      fine_to_coarse = hypre_ArenaCTAlloc(arena, HYPRE_Int, n_fine);
+      P_marker = hypre_ArenaCTAlloc(arena, HYPRE_Int, n_fine);
    }
 
    if (full_off_procNodes)
    {
-      P_marker_offd = hypre_CTAlloc(HYPRE_Int,  full_off_procNodes, HYPRE_MEMORY_HOST);
-      fine_to_coarse_offd = hypre_CTAlloc(HYPRE_BigInt,  full_off_procNodes, HYPRE_MEMORY_HOST);
-      tmp_CF_marker_offd = hypre_CTAlloc(HYPRE_Int,  full_off_procNodes, HYPRE_MEMORY_HOST);
+      P_marker_offd = hypre_ArenaCTAlloc(arena, HYPRE_Int, full_off_procNodes);
+      fine_to_coarse_offd = hypre_ArenaCTAlloc(arena, HYPRE_BigInt, full_off_procNodes);
+      tmp_CF_marker_offd = hypre_ArenaCTAlloc(arena, HYPRE_Int, full_off_procNodes);
    }
 
    /*clist = hypre_CTAlloc(HYPRE_Int, MAX_C_CONNECTIONS);
@@ -2855,8 +2865,8 @@ hypre_BoomerAMGBuildExtPICCInterp(hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
    *P_ptr = P;
 
    /* Deallocate memory */
-   hypre_TFree(fine_to_coarse, HYPRE_MEMORY_HOST);
-   hypre_TFree(P_marker, HYPRE_MEMORY_HOST);
+   hypre_ArenaTFree(arena, fine_to_coarse);
+   hypre_ArenaTFree(arena, P_marker);
    /*hypre_TFree(clist);*/
 
    if (num_procs > 1)
@@ -2864,10 +2874,10 @@ hypre_BoomerAMGBuildExtPICCInterp(hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
       /*hypre_TFree(clist_offd);*/
       hypre_CSRMatrixDestroy(Sop);
       hypre_CSRMatrixDestroy(A_ext);
-      hypre_TFree(fine_to_coarse_offd, HYPRE_MEMORY_HOST);
-      hypre_TFree(P_marker_offd, HYPRE_MEMORY_HOST);
+      hypre_ArenaTFree(arena, fine_to_coarse_offd);
+      hypre_ArenaTFree(arena, P_marker_offd);
       hypre_TFree(CF_marker_offd, HYPRE_MEMORY_HOST);
-      hypre_TFree(tmp_CF_marker_offd, HYPRE_MEMORY_HOST);
+      hypre_ArenaTFree(arena, tmp_CF_marker_offd);
       if (num_functions > 1)
          hypre_TFree(dof_func_offd, HYPRE_MEMORY_HOST);
 
@@ -2942,6 +2952,10 @@ hypre_BoomerAMGBuildFFInterp(hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
    HYPRE_Int       *CF_marker_offd = NULL;
    HYPRE_Int       *tmp_CF_marker_offd = NULL;
    HYPRE_Int       *dof_func_offd = NULL;
+
+   /* short-lived work arrays come from the AMG setup arena, if any */
+   hypre_Arena     *arena = hypre_HandleSetupArena(hypre_handle());
+
    /*HYPRE_Int              ccounter_offd;*/
    HYPRE_Int        common_c;
 
@@ -3040,15 +3054,15 @@ hypre_BoomerAMGBuildFFInterp(hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
 
    if (n_fine)
    {
-      fine_to_coarse = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
-      P_marker = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
+      fine_to_coarse = hypre_ArenaCTAlloc(arena, HYPRE_Int, n_fine);
+      P_marker = hypre_ArenaCTAlloc(arena, HYPRE_Int, n_fine);
    }
 
    if (full_off_procNodes)
    {
-      P_marker_offd = hypre_CTAlloc(HYPRE_Int,  full_off_procNodes, HYPRE_MEMORY_HOST);
-      fine_to_coarse_offd = hypre_CTAlloc(HYPRE_BigInt,  full_off_procNodes, HYPRE_MEMORY_HOST);
-      tmp_CF_marker_offd = hypre_CTAlloc(HYPRE_Int,  full_off_procNodes, HYPRE_MEMORY_HOST);
+      P_marker_offd = hypre_ArenaCTAlloc(arena, HYPRE_Int, full_off_procNodes);
+      fine_to_coarse_offd = hypre_ArenaCTAlloc(arena, HYPRE_BigInt, full_off_procNodes);
+      tmp_CF_marker_offd = hypre_ArenaCTAlloc(arena, HYPRE_Int, full_off_procNodes);
    }
 
    hypre_initialize_vecs(n_fine, full_off_procNodes, fine_to_coarse,
@@ -3739,17 +3753,17 @@ hypre_BoomerAMGBuildFFInterp(hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
    *P_ptr = P;
 
    /* Deallocate memory */
-   hypre_TFree(fine_to_coarse, HYPRE_MEMORY_HOST);
-   hypre_TFree(P_marker, HYPRE_MEMORY_HOST);
+   hypre_ArenaTFree(arena, fine_to_coarse);
+   hypre_ArenaTFree(arena, P_marker);
 
    if (num_procs > 1)
    {
       hypre_CSRMatrixDestroy(Sop);
       hypre_CSRMatrixDestroy(A_ext);
-      hypre_TFree(fine_to_coarse_offd, HYPRE_MEMORY_HOST);
-      hypre_TFree(P_marker_offd, HYPRE_MEMORY_HOST);
+      hypre_ArenaTFree(arena, fine_to_coarse_offd);
+      hypre_ArenaTFree(arena, P_marker_offd);
       hypre_TFree(CF_marker_offd, HYPRE_MEMORY_HOST);
-      hypre_TFree(tmp_CF_marker_offd, HYPRE_MEMORY_HOST);
+      hypre_ArenaTFree(arena, tmp_CF_marker_offd);
       if (num_functions > 1)
          hypre_TFree(dof_func_offd, HYPRE_MEMORY_HOST);
 
@@ -3824,6 +3838,10 @@ hypre_BoomerAMGBuildFF1Interp(hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
    HYPRE_Int       *CF_marker_offd = NULL;
    HYPRE_Int       *tmp_CF_marker_offd = NULL;
    HYPRE_Int       *dof_func_offd = NULL;
+
+   /* short-lived work arrays come from the AMG setup arena, if any */
+   hypre_Arena     *arena = hypre_HandleSetupArena(hypre_handle());
+
    /*HYPRE_Int             ccounter_offd;*/
    HYPRE_Int        common_c;
 
@@ -3921,15 +3939,15 @@ hypre_BoomerAMGBuildFF1Interp(hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
 
    if (n_fine)
    {
-      fine_to_coarse = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
-      P_marker = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
+      fine_to_coarse = hypre_ArenaCTAlloc(arena, HYPRE_Int, n_fine);
+      P_marker = hypre_ArenaCTAlloc(arena, HYPRE_Int, n_fine);
    }
 
    if (full_off_procNodes)
    {
-      P_marker_offd = hypre_CTAlloc(HYPRE_Int,  full_off_procNodes, HYPRE_MEMORY_HOST);
-      fine_to_coarse_offd = hypre_CTAlloc(HYPRE_BigInt,  full_off_procNodes, HYPRE_MEMORY_HOST);
-      tmp_CF_marker_offd = hypre_CTAlloc(HYPRE_Int,  full_off_procNodes, HYPRE_MEMORY_HOST);
+      P_marker_offd = hypre_ArenaCTAlloc(arena, HYPRE_Int, full_off_procNodes);
+      fine_to_coarse_offd = hypre_ArenaCTAlloc(arena, HYPRE_BigInt, full_off_procNodes);
+      tmp_CF_marker_offd = hypre_ArenaCTAlloc(arena, HYPRE_Int, full_off_procNodes);
    }
 
    hypre_initialize_vecs(n_fine, full_off_procNodes, fine_to_coarse,
@@ -4632,8 +4650,8 @@ hypre_BoomerAMGBuildFF1Interp(hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
    *P_ptr = P;
 
    /* Deallocate memory */
-   hypre_TFree(fine_to_coarse, HYPRE_MEMORY_HOST);
-   hypre_TFree(P_marker, HYPRE_MEMORY_HOST);
+   hypre_ArenaTFree(arena, fine_to_coarse);
+   hypre_ArenaTFree(arena, P_marker);
    /*hynre_TFree(clist);*/
 
    if (num_procs > 1)
@@ -4642,10 +4660,10 @@ hypre_BoomerAMGBuildFF1Interp(hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
       /*hypre_TFree(clist_offd);*/
       hypre_CSRMatrixDestroy(Sop);
       hypre_CSRMatrixDestroy(A_ext);
-      hypre_TFree(fine_to_coarse_offd, HYPRE_MEMORY_HOST);
-      hypre_TFree(P_marker_offd, HYPRE_MEMORY_HOST);
+      hypre_ArenaTFree(arena, fine_to_coarse_offd);
+      hypre_ArenaTFree(arena, P_marker_offd);
       hypre_TFree(CF_marker_offd, HYPRE_MEMORY_HOST);
-      hypre_TFree(tmp_CF_marker_offd, HYPRE_MEMORY_HOST);
+      hypre_ArenaTFree(arena, tmp_CF_marker_offd);
       if (num_functions > 1)
          hypre_TFree(dof_func_offd, HYPRE_MEMORY_HOST);
 
@@ -4728,6 +4746,9 @@ hypre_BoomerAMGBuildExtInterp(hypre_ParCSRMatrix  *A,
    HYPRE_Int       *tmp_CF_marker_offd = NULL;
    HYPRE_Int       *dof_func_offd = NULL;
 
+   /* short-lived work arrays come from the AMG setup arena, if any */
+   hypre_Arena     *arena = hypre_HandleSetupArena(hypre_handle());
+
    /* Full row information for columns of A that are off diag*/
    hypre_CSRMatrix *A_ext;
    HYPRE_Real      *A_ext_data;
@@ -4830,15 +4851,15 @@ hypre_BoomerAMGBuildExtInterp(hypre_ParCSRMatrix  *A,
 
    if (n_fine)
    {
-      fine_to_coarse = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
-      P_marker       = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
+      fine_to_coarse = hypre_ArenaCTAlloc(arena, HYPRE_Int, n_fine);
+      P_marker       = hypre_ArenaCTAlloc(arena, HYPRE_Int, n_fine);
    }
 
    if (full_off_procNodes)
    {
-      P_marker_offd       = hypre_CTAlloc(HYPRE_Int,    full_off_procNodes, HYPRE_MEMORY_HOST);
-      fine_to_coarse_offd = hypre_CTAlloc(HYPRE_BigInt, full_off_procNodes, HYPRE_MEMORY_HOST);
-      tmp_CF_marker_offd  = hypre_CTAlloc(HYPRE_Int,    full_off_procNodes, HYPRE_MEMORY_HOST);
+      P_marker_offd       = hypre_ArenaCTAlloc(arena, HYPRE_Int, full_off_procNodes);
+      fine_to_coarse_offd = hypre_ArenaCTAlloc(arena, HYPRE_BigInt, full_off_procNodes);
+      tmp_CF_marker_offd  = hypre_ArenaCTAlloc(arena, HYPRE_Int, full_off_procNodes);
    }
 
    hypre_initialize_vecs(n_fine, full_off_procNodes, fine_to_coarse,
@@ -5399,17 +5420,17 @@ hypre_BoomerAMGBuildExtInterp(hypre_ParCSRMatrix  *A,
    *P_ptr = P;
 
    /* Deallocate memory */
-   hypre_TFree(fine_to_coarse, HYPRE_MEMORY_HOST);
-   hypre_TFree(P_marker,       HYPRE_MEMORY_HOST);
+   hypre_ArenaTFree(arena, fine_to_coarse);
+   hypre_ArenaTFree(arena, P_marker);
 
    if (num_procs > 1)
    {
       hypre_CSRMatrixDestroy(Sop);
       hypre_CSRMatrixDestroy(A_ext);
-      hypre_TFree(fine_to_coarse_offd, HYPRE_MEMORY_HOST);
-      hypre_TFree(P_marker_offd,       HYPRE_MEMORY_HOST);
+      hypre_ArenaTFree(arena, fine_to_coarse_offd);
+      hypre_ArenaTFree(arena, P_marker_offd);
       hypre_TFree(CF_marker_offd,      HYPRE_MEMORY_HOST);
-      hypre_TFree(tmp_CF_marker_offd,  HYPRE_MEMORY_HOST);
+      hypre_ArenaTFree(arena, tmp_CF_marker_offd);
       if (num_functions > 1)
       {
          hypre_TFree(dof_func_offd, HYPRE_MEMORY_HOST);
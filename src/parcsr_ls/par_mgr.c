@@ -1958,6 +1958,8 @@ hypre_ParCSRMatrixLeftScale(HYPRE_Real *vector,
       A_offd_data[j] *= factor;
     }
   }
+  hypre_CSRMatrixValuesChanged(A_diag);
+  hypre_CSRMatrixValuesChanged(A_offd);
 
   return(0);
 }
@@ -96,6 +96,9 @@ hypre_BoomerAMGBuildModExtInterp(hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
    HYPRE_Int n_Cpts, n_Fpts;
    HYPRE_Int num_threads = hypre_NumThreads();
 
+   /* short-lived work arrays come from the AMG setup arena, if any */
+   hypre_Arena *arena = hypre_HandleSetupArena(hypre_handle());
+
    //if (debug_flag==4) wall_time = time_getWallclockSeconds();
 
    /* BEGIN */
@@ -129,9 +132,9 @@ hypre_BoomerAMGBuildModExtInterp(hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
 
    D_q = hypre_CTAlloc(HYPRE_Real, n_Fpts, memory_location_P);
    D_w = hypre_CTAlloc(HYPRE_Real, n_Fpts, memory_location_P);
-   cpt_array = hypre_CTAlloc(HYPRE_Int, num_threads, HYPRE_MEMORY_HOST);
-   start_array = hypre_CTAlloc(HYPRE_Int, num_threads+1, HYPRE_MEMORY_HOST);
-   startf_array = hypre_CTAlloc(HYPRE_Int, num_threads+1, HYPRE_MEMORY_HOST);
+   cpt_array = hypre_ArenaCTAlloc(arena, HYPRE_Int, num_threads);
+   start_array = hypre_ArenaCTAlloc(arena, HYPRE_Int, num_threads+1);
+   startf_array = hypre_ArenaCTAlloc(arena, HYPRE_Int, num_threads+1);
 
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel private(i,j,start,stop,startf,stopf,row)
@@ -363,7 +366,7 @@ hypre_BoomerAMGBuildModExtInterp(hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
       col_map_offd_P = hypre_ParCSRMatrixColMapOffd(P);
       if (num_cols_P_offd)
       {
-         P_marker = hypre_CTAlloc(HYPRE_Int, num_cols_P_offd, HYPRE_MEMORY_HOST);
+         P_marker = hypre_ArenaCTAlloc(arena, HYPRE_Int, num_cols_P_offd);
          for (i=0; i < P_offd_size; i++)
          {
             P_marker[P_offd_j[i]] = 1;
@@ -376,7 +379,7 @@ hypre_BoomerAMGBuildModExtInterp(hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
          }
 
          new_col_map_offd = hypre_CTAlloc(HYPRE_BigInt, new_ncols_P_offd, HYPRE_MEMORY_HOST);
-         map = hypre_CTAlloc(HYPRE_Int, new_ncols_P_offd, HYPRE_MEMORY_HOST);
+         map = hypre_ArenaCTAlloc(arena, HYPRE_Int, new_ncols_P_offd);
 
          index = 0;
          for (i=0; i < num_cols_P_offd; i++)
@@ -385,7 +388,7 @@ hypre_BoomerAMGBuildModExtInterp(hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
                new_col_map_offd[index] = col_map_offd_P[i];
                map[index++] = i;
             }
-         hypre_TFree(P_marker, HYPRE_MEMORY_HOST);
+         hypre_ArenaTFree(arena, P_marker);
 
 
 #ifdef HYPRE_USING_OPENMP
@@ -400,7 +403,7 @@ hypre_BoomerAMGBuildModExtInterp(hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
          hypre_TFree(col_map_offd_P, HYPRE_MEMORY_HOST);
          hypre_ParCSRMatrixColMapOffd(P) = new_col_map_offd; 
          hypre_CSRMatrixNumCols(P_offd) = new_ncols_P_offd; 
-         hypre_TFree(map, HYPRE_MEMORY_HOST);
+         hypre_ArenaTFree(arena, map);
       }
    }
 
@@ -411,9 +414,9 @@ hypre_BoomerAMGBuildModExtInterp(hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
    /* Deallocate memory */
    hypre_TFree(D_q, memory_location_P);
    hypre_TFree(D_w, memory_location_P);
-   hypre_TFree(cpt_array, HYPRE_MEMORY_HOST);
-   hypre_TFree(start_array, HYPRE_MEMORY_HOST);
-   hypre_TFree(startf_array, HYPRE_MEMORY_HOST);
+   hypre_ArenaTFree(arena, cpt_array);
+   hypre_ArenaTFree(arena, start_array);
+   hypre_ArenaTFree(arena, startf_array);
    hypre_ParCSRMatrixDestroy(As_FF);
    hypre_ParCSRMatrixDestroy(As_FC);
    hypre_ParCSRMatrixDestroy(W);
@@ -523,6 +526,9 @@ hypre_BoomerAMGBuildModExtPIInterp(hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
    HYPRE_Int n_Cpts, n_Fpts;
    HYPRE_Int num_threads = hypre_NumThreads();
 
+   /* short-lived work arrays come from the AMG setup arena, if any */
+   hypre_Arena *arena = hypre_HandleSetupArena(hypre_handle());
+
    //if (debug_flag==4) wall_time = time_getWallclockSeconds();
 
    /* BEGIN */
@@ -574,9 +580,9 @@ hypre_BoomerAMGBuildModExtPIInterp(hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
    D_q = hypre_CTAlloc(HYPRE_Real, n_Fpts, memory_location_P);
    D_theta = hypre_CTAlloc(HYPRE_Real, n_Fpts, memory_location_P);
    D_w = hypre_CTAlloc(HYPRE_Real, n_Fpts, memory_location_P);
-   cpt_array = hypre_CTAlloc(HYPRE_Int, num_threads, HYPRE_MEMORY_HOST);
-   start_array = hypre_CTAlloc(HYPRE_Int, num_threads+1, HYPRE_MEMORY_HOST);
-   startf_array = hypre_CTAlloc(HYPRE_Int, num_threads+1, HYPRE_MEMORY_HOST);
+   cpt_array = hypre_ArenaCTAlloc(arena, HYPRE_Int, num_threads);
+   start_array = hypre_ArenaCTAlloc(arena, HYPRE_Int, num_threads+1);
+   startf_array = hypre_ArenaCTAlloc(arena, HYPRE_Int, num_threads+1);
 
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel private(i,j,jj,k,kk,start,stop,startf,stopf,row,theta,value,value1)
@@ -884,7 +890,7 @@ hypre_BoomerAMGBuildModExtPIInterp(hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
       col_map_offd_P = hypre_ParCSRMatrixColMapOffd(P);
       if (num_cols_P_offd)
       {
-         P_marker = hypre_CTAlloc(HYPRE_Int, num_cols_P_offd, HYPRE_MEMORY_HOST);
+         P_marker = hypre_ArenaCTAlloc(arena, HYPRE_Int, num_cols_P_offd);
          for (i=0; i < P_offd_size; i++)
             P_marker[P_offd_j[i]] = 1;
       
@@ -893,7 +899,7 @@ hypre_BoomerAMGBuildModExtPIInterp(hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
             if (P_marker[i]) new_ncols_P_offd++;
 
          new_col_map_offd = hypre_CTAlloc(HYPRE_BigInt, new_ncols_P_offd, HYPRE_MEMORY_HOST);
-         map = hypre_CTAlloc(HYPRE_Int, new_ncols_P_offd, HYPRE_MEMORY_HOST);
+         map = hypre_ArenaCTAlloc(arena, HYPRE_Int, new_ncols_P_offd);
 
          index = 0;
          for (i=0; i < num_cols_P_offd; i++)
@@ -902,7 +908,7 @@ hypre_BoomerAMGBuildModExtPIInterp(hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
                 new_col_map_offd[index] = col_map_offd_P[i];
                 map[index++] = i;
             }
-         hypre_TFree(P_marker, HYPRE_MEMORY_HOST);
+         hypre_ArenaTFree(arena, P_marker);
 
 
 #ifdef HYPRE_USING_OPENMP
@@ -916,7 +922,7 @@ hypre_BoomerAMGBuildModExtPIInterp(hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
          hypre_TFree(col_map_offd_P, HYPRE_MEMORY_HOST);
          hypre_ParCSRMatrixColMapOffd(P) = new_col_map_offd; 
          hypre_CSRMatrixNumCols(P_offd) = new_ncols_P_offd; 
-         hypre_TFree(map, HYPRE_MEMORY_HOST);
+         hypre_ArenaTFree(arena, map);
       }
    }
 
@@ -929,9 +935,9 @@ hypre_BoomerAMGBuildModExtPIInterp(hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker,
    hypre_TFree(D_q_offd, memory_location_P);
    hypre_TFree(D_w, memory_location_P);
    hypre_TFree(D_theta, memory_location_P);
-   hypre_TFree(cpt_array, HYPRE_MEMORY_HOST);
-   hypre_TFree(start_array, HYPRE_MEMORY_HOST);
-   hypre_TFree(startf_array, HYPRE_MEMORY_HOST);
+   hypre_ArenaTFree(arena, cpt_array);
+   hypre_ArenaTFree(arena, start_array);
+   hypre_ArenaTFree(arena, startf_array);
    hypre_TFree(buf_data, memory_location_P);
    hypre_TFree(tmp_FF_diag_data, memory_location_P);
    hypre_ParCSRMatrixDestroy(As_FF);
@@ -251,6 +251,11 @@ hypre_GetCommPkgRTFromCommPkgA( hypre_ParCSRMatrix *RT,
    hypre_ParCSRCommPkgRecvVecStarts(comm_pkg) = recv_vec_starts_RT;
    hypre_ParCSRCommPkgSendMapStarts(comm_pkg) = send_map_starts_RT;
    hypre_ParCSRCommPkgSendMapElmts(comm_pkg) = send_map_elmts_RT;
+   hypre_ParCSRCommPkgUsePersistent(comm_pkg) = 1;
+   if (hypre_HandleNeighborComm(hypre_handle()))
+   {
+      hypre_ParCSRCommPkgCreateNeighborComm(comm_pkg);
+   }
 
    hypre_TFree(status, HYPRE_MEMORY_HOST);
    hypre_TFree(requests, HYPRE_MEMORY_HOST);
@@ -337,6 +342,11 @@ hypre_GenerateSendMapAndCommPkg(MPI_Comm comm, HYPRE_Int num_sends, HYPRE_Int nu
    hypre_ParCSRCommPkgRecvVecStarts(comm_pkg) = recv_vec_starts;
    hypre_ParCSRCommPkgSendMapStarts(comm_pkg) = send_map_starts;
    hypre_ParCSRCommPkgSendMapElmts(comm_pkg) = send_map_elmts;
+   hypre_ParCSRCommPkgUsePersistent(comm_pkg) = 1;
+   if (hypre_HandleNeighborComm(hypre_handle()))
+   {
+      hypre_ParCSRCommPkgCreateNeighborComm(comm_pkg);
+   }
 
    hypre_TFree(status, HYPRE_MEMORY_HOST);
    hypre_TFree(requests, HYPRE_MEMORY_HOST);
@@ -99,6 +99,14 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
    HYPRE_Real      one_minus_omega;
    HYPRE_Real      prod;
 
+   /* the coefficients of A must be stored in HYPRE_Complex, see
+    * hypre_BoomerAMGCheckMixedPrecision */
+   if (hypre_CSRMatrixDataSP(A_diag) || hypre_CSRMatrixDataSP(A_offd))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Relaxation of a matrix with reduced-precision values\n");
+      return hypre_error_flag;
+   }
+
    one_minus_weight = 1.0 - relax_weight;
    one_minus_omega = 1.0 - omega;
    hypre_MPI_Comm_size(comm,&num_procs);
@@ -132,6 +140,9 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
     *     relax_type = 19-> Direct Solve, (old version)
     *     relax_type = 29-> Direct solve: use gaussian elimination & BLAS
     *                       (with pivoting) (old version)
+    *     relax_type = 40 -> multicolor hybrid Gauss-Seidel forward solve
+    *     relax_type = 41 -> multicolor hybrid Gauss-Seidel backward solve
+    *     relax_type = 42 -> multicolor hybrid symm. Gauss-Seidel
     *-----------------------------------------------------------------------*/
 
    switch (relax_type)
@@ -380,10 +391,9 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
             Ztemp_data = hypre_VectorData(Ztemp_local);
          }
 
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-         // JSP: persistent comm can be similarly used for other smoothers
-         hypre_ParCSRPersistentCommHandle *persistent_comm_handle;
-#endif
+         /* the halo is packed and unpacked directly in the buffers of the
+          * persistent requests cached on comm_pkg, if these are available */
+         hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
 
          if (num_procs > 1)
          {
@@ -393,15 +403,18 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
 
             num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
-#if defined(HYPRE_USING_PERSISTENT_COMM)
             persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
-            v_buf_data = (HYPRE_Real *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
-            Vext_data  = (HYPRE_Real *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
-#else
-            v_buf_data = hypre_CTAlloc(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends), HYPRE_MEMORY_HOST);
+            if (persistent_comm_handle)
+            {
+               v_buf_data = (HYPRE_Real *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
+               Vext_data  = (HYPRE_Real *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
+            }
+            else
+            {
+               v_buf_data = hypre_CTAlloc(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends), HYPRE_MEMORY_HOST);
 
-            Vext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
-#endif
+               Vext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+            }
 
             if (num_cols_offd)
             {
@@ -424,20 +437,26 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
             hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
 #endif
 
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-            hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, v_buf_data);
-#else
-            comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, Vext_data);
-#endif
+            if (persistent_comm_handle)
+            {
+               hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, v_buf_data);
+            }
+            else
+            {
+               comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, Vext_data);
+            }
 
             /*-----------------------------------------------------------------
              * Copy current approximation into temporary vector.
              *-----------------------------------------------------------------*/
-#if defined(HYPRE_USING_PERSISTENT_COMM)
-            hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, Vext_data);
-#else
-            hypre_ParCSRCommHandleDestroy(comm_handle);
-#endif
+            if (persistent_comm_handle)
+            {
+               hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, Vext_data);
+            }
+            else
+            {
+               hypre_ParCSRCommHandleDestroy(comm_handle);
+            }
             comm_handle = NULL;
 
 #ifdef HYPRE_PROFILE
@@ -832,13 +851,11 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
               }
            }
         }
-#ifndef HYPRE_USING_PERSISTENT_COMM
-        if (num_procs > 1)
+        if (num_procs > 1 && !persistent_comm_handle)
         {
            hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
            hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
         }
-#endif
 #ifdef HYPRE_PROFILE
         hypre_profile_times[HYPRE_TIMER_ID_RELAX] += hypre_MPI_Wtime();
 #endif
@@ -3069,10 +3086,9 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
             Ztemp_data = hypre_VectorData(Ztemp_local);
          }
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
-         // JSP: persistent comm can be similarly used for other smoothers
-         hypre_ParCSRPersistentCommHandle *persistent_comm_handle;
-#endif
+         /* the halo is packed and unpacked directly in the buffers of the
+          * persistent requests cached on comm_pkg, if these are available */
+         hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
 
          if (num_procs > 1)
          {
@@ -3081,16 +3097,19 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
 #endif
             num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
             persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
-            v_buf_data = (HYPRE_Real *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
-            Vext_data  = (HYPRE_Real *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
-#else
-            v_buf_data = hypre_CTAlloc(HYPRE_Real,
-                                       hypre_ParCSRCommPkgSendMapStart(comm_pkg,  num_sends), HYPRE_MEMORY_HOST);
+            if (persistent_comm_handle)
+            {
+               v_buf_data = (HYPRE_Real *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
+               Vext_data  = (HYPRE_Real *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
+            }
+            else
+            {
+               v_buf_data = hypre_CTAlloc(HYPRE_Real,
+                                          hypre_ParCSRCommPkgSendMapStart(comm_pkg,  num_sends), HYPRE_MEMORY_HOST);
 
-            Vext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
-#endif
+               Vext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+            }
 
             if (num_cols_offd)
             {
@@ -3114,20 +3133,26 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
             hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
 #endif
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
-            hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, v_buf_data);
-#else
-            comm_handle = hypre_ParCSRCommHandleCreate( 1, comm_pkg, v_buf_data, Vext_data);
-#endif
+            if (persistent_comm_handle)
+            {
+               hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, v_buf_data);
+            }
+            else
+            {
+               comm_handle = hypre_ParCSRCommHandleCreate( 1, comm_pkg, v_buf_data, Vext_data);
+            }
 
             /*-----------------------------------------------------------------
              * Copy current approximation into temporary vector.
              *-----------------------------------------------------------------*/
-#ifdef HYPRE_USING_PERSISTENT_COMM
-            hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, Vext_data);
-#else
-            hypre_ParCSRCommHandleDestroy(comm_handle);
-#endif
+            if (persistent_comm_handle)
+            {
+               hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, Vext_data);
+            }
+            else
+            {
+               hypre_ParCSRCommHandleDestroy(comm_handle);
+            }
             comm_handle = NULL;
 
 #ifdef HYPRE_PROFILE
@@ -3323,13 +3348,11 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
             }
          }
 
-#ifndef HYPRE_USING_PERSISTENT_COMM
-         if (num_procs > 1)
+         if (num_procs > 1 && !persistent_comm_handle)
          {
             hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
             hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
          }
-#endif
 #ifdef HYPRE_PROFILE
          hypre_profile_times[HYPRE_TIMER_ID_RELAX] += hypre_MPI_Wtime();
 #endif
@@ -4403,6 +4426,32 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
 #endif
       }
       break;
+
+      case 40: /* multicolor hybrid Gauss-Seidel forward solve */
+      case 41: /* multicolor hybrid Gauss-Seidel backward solve */
+      case 42: /* multicolor hybrid symm. Gauss-Seidel */
+      {
+         /* the BoomerAMG cycles use the coloring computed in the setup,
+            other callers get the rows colored here */
+         HYPRE_Int  num_colors;
+         HYPRE_Int *color_starts, *color_rows;
+         HYPRE_Int  direction = (relax_type == 40) ? 1 : (relax_type == 41) ? -1 : 0;
+
+         hypre_BoomerAMGRelaxMulticolorSetup(A, &num_colors, &color_starts, &color_rows);
+         hypre_BoomerAMGRelaxMulticolor(A, f, cf_marker, relax_points, direction,
+                                        relax_weight, num_colors, color_starts,
+                                        color_rows, u);
+         hypre_TFree(color_starts, HYPRE_MEMORY_HOST);
+         hypre_TFree(color_rows, HYPRE_MEMORY_HOST);
+      }
+      break;
+
+      default:
+      {
+         hypre_error_in_arg(4);
+         relax_error = 1;
+      }
+      break;
    }
 
    return (relax_error);
@@ -0,0 +1,287 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Multicolor hybrid Gauss-Seidel (relax types 40, 41 and 42)
+ *
+ * The on-processor rows are colored such that no two rows of one color are
+ * coupled in A_diag.  The rows of a color are then independent and are
+ * relaxed in parallel, and the colors one after the other, so the result
+ * does not depend on the number of threads.  The off-processor couplings
+ * are treated as in the hybrid smoothers, i.e., Jacobi-like, and the rows
+ * are scaled by the truncated l1 norms of the hybrid l1 Gauss-Seidel
+ * (option 4 of hypre_ParCSRComputeL1Norms with one thread).  These are
+ * computed in the sweep, as they depend on the off-processor part only.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMulticolorSetup
+ *
+ * Greedy coloring of the graph of A_diag + A_diag^T in the natural order of
+ * the rows.  Returns the rows sorted by color in color_rows, where color c
+ * holds the rows color_rows[color_starts[c]], ..., color_rows[color_starts[c+1]-1]
+ * in increasing order.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxMulticolorSetup( hypre_ParCSRMatrix  *A,
+                                     HYPRE_Int           *num_colors_ptr,
+                                     HYPRE_Int          **color_starts_ptr,
+                                     HYPRE_Int          **color_rows_ptr )
+{
+   hypre_CSRMatrix *A_diag   = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int       *A_diag_i = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Int        n        = hypre_CSRMatrixNumRows(A_diag);
+   hypre_CSRMatrix *AT_diag;
+   HYPRE_Int       *AT_diag_i, *AT_diag_j;
+
+   HYPRE_Int       *color, *mark;
+   HYPRE_Int       *color_starts, *color_rows;
+   HYPRE_Int        num_colors = 0;
+   HYPRE_Int        i, jj, c;
+
+   hypre_CSRMatrixTranspose(A_diag, &AT_diag, 0);
+   AT_diag_i = hypre_CSRMatrixI(AT_diag);
+   AT_diag_j = hypre_CSRMatrixJ(AT_diag);
+
+   color = hypre_CTAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   mark  = hypre_CTAlloc(HYPRE_Int, n + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < n; i++)
+   {
+      color[i] = -1;
+      mark[i]  = -1;
+   }
+   mark[n] = -1;
+
+   /* smallest color not taken by a colored neighbor */
+   for (i = 0; i < n; i++)
+   {
+      for (jj = A_diag_i[i]; jj < A_diag_i[i+1]; jj++)
+      {
+         if (color[A_diag_j[jj]] > -1)
+         {
+            mark[color[A_diag_j[jj]]] = i;
+         }
+      }
+      for (jj = AT_diag_i[i]; jj < AT_diag_i[i+1]; jj++)
+      {
+         if (color[AT_diag_j[jj]] > -1)
+         {
+            mark[color[AT_diag_j[jj]]] = i;
+         }
+      }
+      for (c = 0; mark[c] == i; c++);
+      color[i]   = c;
+      num_colors = hypre_max(num_colors, c + 1);
+   }
+   hypre_CSRMatrixDestroy(AT_diag);
+
+   /* rows sorted by color */
+   color_starts = hypre_CTAlloc(HYPRE_Int, num_colors + 1, HYPRE_MEMORY_HOST);
+   color_rows   = hypre_CTAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   for (i = 0; i < n; i++)
+   {
+      color_starts[color[i] + 1]++;
+   }
+   for (c = 0; c < num_colors; c++)
+   {
+      color_starts[c + 1] += color_starts[c];
+   }
+   for (c = 0; c < num_colors; c++)
+   {
+      mark[c] = color_starts[c];
+   }
+   for (i = 0; i < n; i++)
+   {
+      color_rows[mark[color[i]]++] = i;
+   }
+
+   hypre_TFree(color, HYPRE_MEMORY_HOST);
+   hypre_TFree(mark, HYPRE_MEMORY_HOST);
+
+   *num_colors_ptr   = num_colors;
+   *color_starts_ptr = color_starts;
+   *color_rows_ptr   = color_rows;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMulticolor
+ *
+ * One sweep of multicolor hybrid Gauss-Seidel over the colors in increasing
+ * (direction = 1), decreasing (direction = -1) or increasing and then
+ * decreasing (direction = 0) order.  Only the points with
+ * cf_marker = relax_points are relaxed, unless relax_points = 0.  The
+ * corrections are damped by relax_weight.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxMulticolor( hypre_ParCSRMatrix *A,
+                                hypre_ParVector    *f,
+                                HYPRE_Int          *cf_marker,
+                                HYPRE_Int           relax_points,
+                                HYPRE_Int           direction,
+                                HYPRE_Real          relax_weight,
+                                HYPRE_Int           num_colors,
+                                HYPRE_Int          *color_starts,
+                                HYPRE_Int          *color_rows,
+                                hypre_ParVector    *u )
+{
+   hypre_CSRMatrix        *A_diag      = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real             *A_diag_data = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int              *A_diag_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int              *A_diag_j    = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix        *A_offd      = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Real             *A_offd_data = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int              *A_offd_i    = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int              *A_offd_j    = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Int               num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   hypre_ParCSRCommPkg    *comm_pkg    = hypre_ParCSRMatrixCommPkg(A);
+   hypre_ParCSRCommHandle *comm_handle;
+
+   HYPRE_Real             *u_data = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Real             *f_data = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Real             *v_buf_data = NULL;
+   HYPRE_Real             *Vext_data  = NULL;
+
+   HYPRE_Int               num_procs, num_sends;
+   HYPRE_Int               sweep, num_passes, c, cc, k, i, jj, start, index;
+   HYPRE_Real              res, diag, offd_norm;
+
+   hypre_MPI_Comm_size(hypre_ParCSRMatrixComm(A), &num_procs);
+
+   /*-----------------------------------------------------------------
+    * Off-processor values of u, fixed during the sweep
+    *-----------------------------------------------------------------*/
+
+   if (num_procs > 1)
+   {
+      num_sends  = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      v_buf_data = hypre_CTAlloc(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends),
+                                 HYPRE_MEMORY_HOST);
+      Vext_data  = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+
+      index = 0;
+      for (i = 0; i < num_sends; i++)
+      {
+         start = hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+         for (jj = start; jj < hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1); jj++)
+         {
+            v_buf_data[index++] = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg, jj)];
+         }
+      }
+
+      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, Vext_data);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+   }
+
+   /*-----------------------------------------------------------------
+    * Relax the colors one after the other, the rows of a color in parallel
+    *-----------------------------------------------------------------*/
+
+   num_passes = (direction == 0) ? 2 : 1;
+   for (sweep = 0; sweep < num_passes; sweep++)
+   {
+      for (cc = 0; cc < num_colors; cc++)
+      {
+         c = (direction < 0 || sweep == 1) ? (num_colors - 1 - cc) : cc;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(k,i,jj,res,diag,offd_norm) HYPRE_SMP_SCHEDULE
+#endif
+         for (k = color_starts[c]; k < color_starts[c+1]; k++)
+         {
+            i = color_rows[k];
+            if (relax_points != 0 && cf_marker[i] != relax_points)
+            {
+               continue;
+            }
+
+            /*-----------------------------------------------------------
+             * If diagonal is nonzero, relax point i; otherwise, skip it.
+             *-----------------------------------------------------------*/
+
+            diag = A_diag_data[A_diag_i[i]];
+            if (diag != 0.0)
+            {
+               res = f_data[i];
+               for (jj = A_diag_i[i]; jj < A_diag_i[i+1]; jj++)
+               {
+                  res -= A_diag_data[jj] * u_data[A_diag_j[jj]];
+               }
+               offd_norm = 0.0;
+               for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+               {
+                  res -= A_offd_data[jj] * Vext_data[A_offd_j[jj]];
+                  offd_norm += fabs(A_offd_data[jj]);
+               }
+
+               /* truncated l1 scaling (Remark 6.2 of "Multigrid Smoothers
+                  for Ultra-Parallel Computing"), with the sign of the diagonal */
+               if (0.5 * offd_norm > fabs(diag) / 3.0)
+               {
+                  diag += (diag > 0.0) ? 0.5 * offd_norm : -0.5 * offd_norm;
+               }
+               u_data[i] += relax_weight * res / diag;
+            }
+         }
+      }
+   }
+
+   hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxMulticolorIF
+ *
+ * Relax types 40-42 with the coloring of the level, with C/F ordering for
+ * the down (cycle_type = 1) and up (cycle_type = 2) cycles if
+ * relax_order = 1, as in hypre_BoomerAMGRelaxIF.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxMulticolorIF( hypre_ParCSRMatrix *A,
+                                  hypre_ParVector    *f,
+                                  HYPRE_Int          *cf_marker,
+                                  HYPRE_Int           relax_type,
+                                  HYPRE_Int           relax_order,
+                                  HYPRE_Int           cycle_type,
+                                  HYPRE_Real          relax_weight,
+                                  HYPRE_Int           num_colors,
+                                  HYPRE_Int          *color_starts,
+                                  HYPRE_Int          *color_rows,
+                                  hypre_ParVector    *u )
+{
+   HYPRE_Int i, num_passes = 1;
+   HYPRE_Int relax_points[2] = {0, 0};
+   HYPRE_Int direction = (relax_type == 40) ? 1 : (relax_type == 41) ? -1 : 0;
+
+   if (relax_order == 1 && cycle_type < 3)
+   {
+      num_passes = 2;
+      relax_points[0] = (cycle_type < 2) ? 1 : -1;
+      relax_points[1] = -relax_points[0];
+   }
+
+   for (i = 0; i < num_passes; i++)
+   {
+      hypre_BoomerAMGRelaxMulticolor(A, f, cf_marker, relax_points[i], direction,
+                                     relax_weight, num_colors, color_starts,
+                                     color_rows, u);
+   }
+
+   return hypre_error_flag;
+}
@@ -1432,3 +1432,38 @@ HYPRE_Int    hypre_BoomerAMGWriteSolverParams(void* data)
    return 0;
 }
 
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGSetupTimesPrint
+ *
+ * Prints the wall clock times of the phases of the last setup (maximum over
+ * all processors)
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGSetupTimesPrint( void     *amg_vdata,
+                                MPI_Comm  comm )
+{
+   hypre_ParAMGData *amg_data = (hypre_ParAMGData*) amg_vdata;
+   HYPRE_Real        times[HYPRE_AMG_SETUP_NUM_TIMES];
+   HYPRE_Int         my_id;
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+   hypre_MPI_Allreduce(hypre_ParAMGDataSetupTimes(amg_data), times, HYPRE_AMG_SETUP_NUM_TIMES,
+                       HYPRE_MPI_REAL, hypre_MPI_MAX, comm);
+
+   if (my_id == 0)
+   {
+      hypre_printf("\n BoomerAMG setup phase times (%s, seconds):\n\n",
+                   hypre_ParAMGDataSetupReused(amg_data) ? "numeric re-setup" : "full setup");
+      hypre_printf("   strength          %10.4e\n", times[HYPRE_AMG_SETUP_TIME_STRENGTH]);
+      hypre_printf("   coarsening        %10.4e\n", times[HYPRE_AMG_SETUP_TIME_COARSEN]);
+      hypre_printf("   interpolation     %10.4e\n", times[HYPRE_AMG_SETUP_TIME_INTERP]);
+      hypre_printf("   coarse operators  %10.4e\n", times[HYPRE_AMG_SETUP_TIME_RAP]);
+      hypre_printf("   smoothers         %10.4e\n", times[HYPRE_AMG_SETUP_TIME_SMOOTHER]);
+      hypre_printf("   other             %10.4e\n", times[HYPRE_AMG_SETUP_TIME_OTHER]);
+      hypre_printf("   total             %10.4e\n\n", times[HYPRE_AMG_SETUP_TIME_TOTAL]);
+   }
+
+   return hypre_error_flag;
+}
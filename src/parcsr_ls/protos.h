@@ -16,6 +16,7 @@ HYPRE_Int hypre_ADSSetMaxIter ( void *solver , HYPRE_Int maxit );
 HYPRE_Int hypre_ADSSetTol ( void *solver , HYPRE_Real tol );
 HYPRE_Int hypre_ADSSetCycleType ( void *solver , HYPRE_Int cycle_type );
 HYPRE_Int hypre_ADSSetPrintLevel ( void *solver , HYPRE_Int print_level );
+HYPRE_Int hypre_ADSSetConcurrentSolve ( void *solver , HYPRE_Int concurrent_solve );
 HYPRE_Int hypre_ADSSetSmoothingOptions ( void *solver , HYPRE_Int A_relax_type , HYPRE_Int A_relax_times , HYPRE_Real A_relax_weight , HYPRE_Real A_omega );
 HYPRE_Int hypre_ADSSetChebySmoothingOptions ( void *solver , HYPRE_Int A_cheby_order , HYPRE_Int A_cheby_fraction );
 HYPRE_Int hypre_ADSSetAMSOptions ( void *solver , HYPRE_Int B_C_cycle_type , HYPRE_Int B_C_coarsen_type , HYPRE_Int B_C_agg_levels , HYPRE_Int B_C_relax_type , HYPRE_Real B_C_theta , HYPRE_Int B_C_interp_type , HYPRE_Int B_C_Pmax );
@@ -137,6 +138,7 @@ HYPRE_Int hypre_AMSSetMaxIter ( void *solver , HYPRE_Int maxit );
 HYPRE_Int hypre_AMSSetTol ( void *solver , HYPRE_Real tol );
 HYPRE_Int hypre_AMSSetCycleType ( void *solver , HYPRE_Int cycle_type );
 HYPRE_Int hypre_AMSSetPrintLevel ( void *solver , HYPRE_Int print_level );
+HYPRE_Int hypre_AMSSetConcurrentSolve ( void *solver , HYPRE_Int concurrent_solve );
 HYPRE_Int hypre_AMSSetSmoothingOptions ( void *solver , HYPRE_Int A_relax_type , HYPRE_Int A_relax_times , HYPRE_Real A_relax_weight , HYPRE_Real A_omega );
 HYPRE_Int hypre_AMSSetChebySmoothingOptions ( void *solver , HYPRE_Int A_cheby_order , HYPRE_Int A_cheby_fraction );
 HYPRE_Int hypre_AMSSetAlphaAMGOptions ( void *solver , HYPRE_Int B_Pi_coarsen_type , HYPRE_Int B_Pi_agg_levels , HYPRE_Int B_Pi_relax_type , HYPRE_Real B_Pi_theta , HYPRE_Int B_Pi_interp_type , HYPRE_Int B_Pi_Pmax );
@@ -148,7 +150,9 @@ HYPRE_Int hypre_AMSComputePixyz ( hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *G
 HYPRE_Int hypre_AMSComputeGPi ( hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *G , hypre_ParVector *Gx , hypre_ParVector *Gy , hypre_ParVector *Gz , HYPRE_Int dim , hypre_ParCSRMatrix **GPi_ptr );
 HYPRE_Int hypre_AMSSetup ( void *solver , hypre_ParCSRMatrix *A , hypre_ParVector *b , hypre_ParVector *x );
 HYPRE_Int hypre_AMSSolve ( void *solver , hypre_ParCSRMatrix *A , hypre_ParVector *b , hypre_ParVector *x );
-HYPRE_Int hypre_ParCSRSubspacePrec ( hypre_ParCSRMatrix *A0 , HYPRE_Int A0_relax_type , HYPRE_Int A0_relax_times , HYPRE_Real *A0_l1_norms , HYPRE_Real A0_relax_weight , HYPRE_Real A0_omega , HYPRE_Real A0_max_eig_est , HYPRE_Real A0_min_eig_est , HYPRE_Int A0_cheby_order , HYPRE_Real A0_cheby_fraction , hypre_ParCSRMatrix **A , HYPRE_Solver *B , HYPRE_PtrToSolverFcn *HB , hypre_ParCSRMatrix **P , hypre_ParVector **r , hypre_ParVector **g , hypre_ParVector *x , hypre_ParVector *y , hypre_ParVector *r0 , hypre_ParVector *g0 , char *cycle , hypre_ParVector *z );
+HYPRE_Int hypre_ParCSRSubspacePrec ( hypre_ParCSRMatrix *A0 , HYPRE_Int A0_relax_type , HYPRE_Int A0_relax_times , HYPRE_Real *A0_l1_norms , HYPRE_Real A0_relax_weight , HYPRE_Real A0_omega , HYPRE_Real A0_max_eig_est , HYPRE_Real A0_min_eig_est , HYPRE_Int A0_cheby_order , HYPRE_Real A0_cheby_fraction , hypre_ParCSRMatrix **A , HYPRE_Solver *B , HYPRE_PtrToSolverFcn *HB , hypre_ParCSRMatrix **P , hypre_ParVector **r , hypre_ParVector **g , hypre_ParVector *x , hypre_ParVector *y , hypre_ParVector *r0 , hypre_ParVector *g0 , char *cycle , hypre_ParVector *z , void *concurrent );
+HYPRE_Int hypre_ParCSRSubspaceConcurrentSetup ( hypre_ParCSRMatrix *A0 , hypre_ParCSRMatrix **A , HYPRE_Solver *B , HYPRE_PtrToSolverFcn *HB , hypre_ParVector **r , char *cycle , void **concurrent_ptr );
+HYPRE_Int hypre_ParCSRSubspaceConcurrentDestroy ( void *concurrent );
 HYPRE_Int hypre_AMSGetNumIterations ( void *solver , HYPRE_Int *num_iterations );
 HYPRE_Int hypre_AMSGetFinalRelativeResidualNorm ( void *solver , HYPRE_Real *rel_resid_norm );
 HYPRE_Int hypre_AMSProjectOutGradients ( void *solver , hypre_ParVector *x );
@@ -209,6 +213,7 @@ HYPRE_Int HYPRE_ADSSetMaxIter ( HYPRE_Solver solver , HYPRE_Int maxit );
 HYPRE_Int HYPRE_ADSSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
 HYPRE_Int HYPRE_ADSSetCycleType ( HYPRE_Solver solver , HYPRE_Int cycle_type );
 HYPRE_Int HYPRE_ADSSetPrintLevel ( HYPRE_Solver solver , HYPRE_Int print_level );
+HYPRE_Int HYPRE_ADSSetConcurrentSolve ( HYPRE_Solver solver , HYPRE_Int concurrent_solve );
 HYPRE_Int HYPRE_ADSSetSmoothingOptions ( HYPRE_Solver solver , HYPRE_Int relax_type , HYPRE_Int relax_times , HYPRE_Real relax_weight , HYPRE_Real omega );
 HYPRE_Int HYPRE_ADSSetChebySmoothingOptions ( HYPRE_Solver solver , HYPRE_Int cheby_order , HYPRE_Int cheby_fraction );
 HYPRE_Int HYPRE_ADSSetAMSOptions ( HYPRE_Solver solver , HYPRE_Int cycle_type , HYPRE_Int coarsen_type , HYPRE_Int agg_levels , HYPRE_Int relax_type , HYPRE_Real strength_threshold , HYPRE_Int interp_type , HYPRE_Int Pmax );
@@ -249,6 +254,7 @@ HYPRE_Int HYPRE_AMSSetMaxIter ( HYPRE_Solver solver , HYPRE_Int maxit );
 HYPRE_Int HYPRE_AMSSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
 HYPRE_Int HYPRE_AMSSetCycleType ( HYPRE_Solver solver , HYPRE_Int cycle_type );
 HYPRE_Int HYPRE_AMSSetPrintLevel ( HYPRE_Solver solver , HYPRE_Int print_level );
+HYPRE_Int HYPRE_AMSSetConcurrentSolve ( HYPRE_Solver solver , HYPRE_Int concurrent_solve );
 HYPRE_Int HYPRE_AMSSetSmoothingOptions ( HYPRE_Solver solver , HYPRE_Int relax_type , HYPRE_Int relax_times , HYPRE_Real relax_weight , HYPRE_Real omega );
 HYPRE_Int HYPRE_AMSSetChebySmoothingOptions ( HYPRE_Solver solver , HYPRE_Int cheby_order , HYPRE_Int cheby_fraction );
 HYPRE_Int HYPRE_AMSSetAlphaAMGOptions ( HYPRE_Solver solver , HYPRE_Int alpha_coarsen_type , HYPRE_Int alpha_agg_levels , HYPRE_Int alpha_relax_type , HYPRE_Real alpha_strength_threshold , HYPRE_Int alpha_interp_type , HYPRE_Int alpha_Pmax );
@@ -291,6 +297,21 @@ HYPRE_Int HYPRE_BoomerAMGSetFilterThresholdR ( HYPRE_Solver solver , HYPRE_Real
 HYPRE_Int HYPRE_BoomerAMGGetFilterThresholdR ( HYPRE_Solver solver , HYPRE_Real *filter_threshold );
 HYPRE_Int HYPRE_BoomerAMGSetGMRESSwitchR ( HYPRE_Solver solver , HYPRE_Int gmres_switch );
 HYPRE_Int HYPRE_BoomerAMGSetSabs ( HYPRE_Solver solver , HYPRE_Int Sabs );
+HYPRE_Int HYPRE_BoomerAMGSetMixedPrecisionLevel ( HYPRE_Solver solver , HYPRE_Int mixed_prec_level );
+HYPRE_Int HYPRE_BoomerAMGGetMixedPrecisionLevel ( HYPRE_Solver solver , HYPRE_Int *mixed_prec_level );
+HYPRE_Int HYPRE_BoomerAMGSetSetupReuse ( HYPRE_Solver solver , HYPRE_Int setup_reuse );
+HYPRE_Int HYPRE_BoomerAMGGetSetupReuse ( HYPRE_Solver solver , HYPRE_Int *setup_reuse );
+HYPRE_Int HYPRE_BoomerAMGSetSetupArena ( HYPRE_Solver solver , HYPRE_Int setup_arena );
+HYPRE_Int HYPRE_BoomerAMGGetSetupArena ( HYPRE_Solver solver , HYPRE_Int *setup_arena );
+HYPRE_Int HYPRE_BoomerAMGSetNodeAwareLevel ( HYPRE_Solver solver , HYPRE_Int node_aware_level );
+HYPRE_Int HYPRE_BoomerAMGGetNodeAwareLevel ( HYPRE_Solver solver , HYPRE_Int *node_aware_level );
+HYPRE_Int HYPRE_BoomerAMGSetNeighborCommLevel ( HYPRE_Solver solver , HYPRE_Int neighbor_comm_level );
+HYPRE_Int HYPRE_BoomerAMGGetNeighborCommLevel ( HYPRE_Solver solver , HYPRE_Int *neighbor_comm_level );
+HYPRE_Int HYPRE_BoomerAMGSetRedistributeThreshold ( HYPRE_Solver solver , HYPRE_Int redist_threshold );
+HYPRE_Int HYPRE_BoomerAMGGetRedistributeThreshold ( HYPRE_Solver solver , HYPRE_Int *redist_threshold );
+HYPRE_Int HYPRE_BoomerAMGSetProfile ( HYPRE_Solver solver , HYPRE_Int profile );
+HYPRE_Int HYPRE_BoomerAMGGetProfile ( HYPRE_Solver solver , HYPRE_Int level , HYPRE_Int phase , HYPRE_Int stat , HYPRE_Real *value );
+HYPRE_Int HYPRE_BoomerAMGPrintProfile ( HYPRE_Solver solver , const char *filename );
 HYPRE_Int HYPRE_BoomerAMGSetMaxRowSum ( HYPRE_Solver solver , HYPRE_Real max_row_sum );
 HYPRE_Int HYPRE_BoomerAMGGetMaxRowSum ( HYPRE_Solver solver , HYPRE_Real *max_row_sum );
 HYPRE_Int HYPRE_BoomerAMGSetTruncFactor ( HYPRE_Solver solver , HYPRE_Real trunc_factor );
@@ -411,6 +432,7 @@ HYPRE_Int HYPRE_BoomerAMGGetGridHierarchy(HYPRE_Solver solver, HYPRE_Int *cgrid
 HYPRE_Int HYPRE_BoomerAMGSetChebyOrder ( HYPRE_Solver solver , HYPRE_Int order );
 HYPRE_Int HYPRE_BoomerAMGSetChebyFraction ( HYPRE_Solver solver , HYPRE_Real ratio );
 HYPRE_Int HYPRE_BoomerAMGSetChebyEigEst ( HYPRE_Solver solver , HYPRE_Int eig_est );
+HYPRE_Int HYPRE_BoomerAMGSetChebyEigReuse ( HYPRE_Solver solver , HYPRE_Int eig_reuse );
 HYPRE_Int HYPRE_BoomerAMGSetChebyVariant ( HYPRE_Solver solver , HYPRE_Int variant );
 HYPRE_Int HYPRE_BoomerAMGSetChebyScale ( HYPRE_Solver solver , HYPRE_Int scale );
 HYPRE_Int HYPRE_BoomerAMGSetInterpVectors ( HYPRE_Solver solver , HYPRE_Int num_vectors , HYPRE_ParVector *vectors );
@@ -760,6 +782,19 @@ HYPRE_Int hypre_BoomerAMGGetStrongThresholdR ( void *data , HYPRE_Real *strong_t
 HYPRE_Int hypre_BoomerAMGSetFilterThresholdR ( void *data , HYPRE_Real filter_threshold );
 HYPRE_Int hypre_BoomerAMGGetFilterThresholdR ( void *data , HYPRE_Real *filter_threshold );
 HYPRE_Int hypre_BoomerAMGSetSabs ( void *data , HYPRE_Int Sabs );
+HYPRE_Int hypre_BoomerAMGSetMixedPrecisionLevel ( void *data , HYPRE_Int mixed_prec_level );
+HYPRE_Int hypre_BoomerAMGGetMixedPrecisionLevel ( void *data , HYPRE_Int *mixed_prec_level );
+HYPRE_Int hypre_BoomerAMGSetSetupReuse ( void *data , HYPRE_Int setup_reuse );
+HYPRE_Int hypre_BoomerAMGGetSetupReuse ( void *data , HYPRE_Int *setup_reuse );
+HYPRE_Int hypre_BoomerAMGSetSetupArena ( void *data , HYPRE_Int setup_arena );
+HYPRE_Int hypre_BoomerAMGGetSetupArena ( void *data , HYPRE_Int *setup_arena );
+HYPRE_Int hypre_BoomerAMGSetNodeAwareLevel ( void *data , HYPRE_Int node_aware_level );
+HYPRE_Int hypre_BoomerAMGGetNodeAwareLevel ( void *data , HYPRE_Int *node_aware_level );
+HYPRE_Int hypre_BoomerAMGSetNeighborCommLevel ( void *data , HYPRE_Int neighbor_comm_level );
+HYPRE_Int hypre_BoomerAMGGetNeighborCommLevel ( void *data , HYPRE_Int *neighbor_comm_level );
+HYPRE_Int hypre_BoomerAMGSetRedistributeThreshold ( void *data , HYPRE_Int redist_threshold );
+HYPRE_Int hypre_BoomerAMGGetRedistributeThreshold ( void *data , HYPRE_Int *redist_threshold );
+HYPRE_Int hypre_BoomerAMGSetProfile ( void *data , HYPRE_Int profile );
 HYPRE_Int hypre_BoomerAMGSetMaxRowSum ( void *data , HYPRE_Real max_row_sum );
 HYPRE_Int hypre_BoomerAMGGetMaxRowSum ( void *data , HYPRE_Real *max_row_sum );
 HYPRE_Int hypre_BoomerAMGSetTruncFactor ( void *data , HYPRE_Real trunc_factor );
@@ -893,6 +928,7 @@ HYPRE_Int hypre_BoomerAMGSetEuBJ ( void *data , HYPRE_Int eu_bj );
 HYPRE_Int hypre_BoomerAMGSetChebyOrder ( void *data , HYPRE_Int order );
 HYPRE_Int hypre_BoomerAMGSetChebyFraction ( void *data , HYPRE_Real ratio );
 HYPRE_Int hypre_BoomerAMGSetChebyEigEst ( void *data , HYPRE_Int eig_est );
+HYPRE_Int hypre_BoomerAMGSetChebyEigReuse ( void *data , HYPRE_Int eig_reuse );
 HYPRE_Int hypre_BoomerAMGSetChebyVariant ( void *data , HYPRE_Int variant );
 HYPRE_Int hypre_BoomerAMGSetChebyScale ( void *data , HYPRE_Int scale );
 HYPRE_Int hypre_BoomerAMGSetInterpVectors ( void *solver , HYPRE_Int num_vectors , hypre_ParVector **interp_vectors );
@@ -924,6 +960,33 @@ HYPRE_Int hypre_BoomerAMGSetFPoints( void *data, HYPRE_Int isolated, HYPRE_Int n
 /* par_amg_setup.c */
 HYPRE_Int hypre_BoomerAMGSetup ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
 
+/* par_amg_mixed_prec.c */
+HYPRE_Int hypre_BoomerAMGSetupMixedPrecision ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGRestoreDoublePrecision ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGCheckMixedPrecision ( void *amg_vdata );
+
+/* par_amg_resetup.c */
+HYPRE_Int hypre_BoomerAMGResetupSupported ( void *amg_vdata , hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_BoomerAMGResetupInitialize ( void *amg_vdata , hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_BoomerAMGResetupDestroy ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGResetup ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u , HYPRE_Int *done );
+
+/* par_amg_profile.c */
+HYPRE_Int hypre_BoomerAMGProfileInitialize ( void *amg_vdata );
+HYPRE_Int hypre_BoomerAMGProfileStart ( void *amg_vdata , HYPRE_Real *mark );
+HYPRE_Int hypre_BoomerAMGProfileStop ( void *amg_vdata , HYPRE_Int level , HYPRE_Int phase , HYPRE_Real *mark );
+HYPRE_Int hypre_BoomerAMGGetProfile ( void *data , HYPRE_Int level , HYPRE_Int phase , HYPRE_Int stat , HYPRE_Real *value );
+HYPRE_Int hypre_BoomerAMGPrintProfile ( void *data , const char *filename );
+
+/* par_amg_redistribute.c */
+HYPRE_Solver hypre_BoomerAMGRedistributeSolverCreate ( hypre_ParAMGData *amg_data , HYPRE_Int p_level );
+HYPRE_Int hypre_ParCSRMatrixCreateFromGlobalRows ( MPI_Comm comm , HYPRE_BigInt global_rows , HYPRE_BigInt first_row , HYPRE_Int num_rows , HYPRE_Int *rows_i , HYPRE_BigInt *rows_j , HYPRE_Complex *rows_data , hypre_ParCSRMatrix **A_ptr );
+HYPRE_Int hypre_BoomerAMGRedistributeSetup ( hypre_ParAMGData *amg_data , HYPRE_Int p_level );
+HYPRE_Int hypre_BoomerAMGRedistributeCycle ( hypre_ParAMGData *amg_data , HYPRE_Int p_level , hypre_ParVector **F_array , hypre_ParVector **U_array );
+
+/* par_amg_multi_solve.c */
+HYPRE_Int hypre_BoomerAMGMultiSolve ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
+
 /* par_amg_solve.c */
 HYPRE_Int hypre_BoomerAMGSolve ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
 
@@ -1112,6 +1175,11 @@ HYPRE_Int hypre_LINPACKcgtql1 ( HYPRE_Int *n , HYPRE_Real *d , HYPRE_Real *e , H
 HYPRE_Real hypre_LINPACKcgpthy ( HYPRE_Real *a , HYPRE_Real *b );
 HYPRE_Int hypre_ParCSRRelax_L1_Jacobi ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_points , HYPRE_Real relax_weight , HYPRE_Real *l1_norms , hypre_ParVector *u , hypre_ParVector *Vtemp );
 
+/* par_relax_multicolor.c */
+HYPRE_Int hypre_BoomerAMGRelaxMulticolorSetup ( hypre_ParCSRMatrix *A , HYPRE_Int *num_colors_ptr , HYPRE_Int **color_starts_ptr , HYPRE_Int **color_rows_ptr );
+HYPRE_Int hypre_BoomerAMGRelaxMulticolor ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_points , HYPRE_Int direction , HYPRE_Real relax_weight , HYPRE_Int num_colors , HYPRE_Int *color_starts , HYPRE_Int *color_rows , hypre_ParVector *u );
+HYPRE_Int hypre_BoomerAMGRelaxMulticolorIF ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_order , HYPRE_Int cycle_type , HYPRE_Real relax_weight , HYPRE_Int num_colors , HYPRE_Int *color_starts , HYPRE_Int *color_rows , hypre_ParVector *u );
+
 /* par_rotate_7pt.c */
 HYPRE_ParCSRMatrix GenerateRotate7pt ( MPI_Comm comm , HYPRE_BigInt nx , HYPRE_BigInt ny , HYPRE_Int P , HYPRE_Int Q , HYPRE_Int p , HYPRE_Int q , HYPRE_Real alpha , HYPRE_Real eps );
 
@@ -1138,6 +1206,7 @@ HYPRE_Int hypre_SchwarzSetDofFunc ( void *data , HYPRE_Int *dof_func );
 /* par_stats.c */
 HYPRE_Int hypre_BoomerAMGSetupStats ( void *amg_vdata , hypre_ParCSRMatrix *A );
 HYPRE_Int hypre_BoomerAMGWriteSolverParams ( void *data );
+HYPRE_Int hypre_BoomerAMGSetupTimesPrint ( void *amg_vdata , MPI_Comm comm );
 
 /* par_strength.c */
 HYPRE_Int hypre_BoomerAMGCreateS ( hypre_ParCSRMatrix *A , HYPRE_Real strength_threshold , HYPRE_Real max_row_sum , HYPRE_Int num_functions , HYPRE_Int *dof_func , hypre_ParCSRMatrix **S_ptr );
@@ -1201,6 +1270,9 @@ HYPRE_Int hypre_ParKrylovMatvec ( void *matvec_data , HYPRE_Complex alpha , void
 HYPRE_Int hypre_ParKrylovMatvecT ( void *matvec_data , HYPRE_Complex alpha , void *A , void *x , HYPRE_Complex beta , void *y );
 HYPRE_Int hypre_ParKrylovMatvecDestroy ( void *matvec_data );
 HYPRE_Real hypre_ParKrylovInnerProd ( void *x , void *y );
+HYPRE_Int hypre_ParKrylovInnerProdsStart ( HYPRE_Int num , void **x , void **y , HYPRE_Real *result , void **request_ptr );
+HYPRE_Int hypre_ParKrylovInnerProdsFinish ( void *request_vdata );
+HYPRE_Int hypre_ParKrylovBlockInnerProd ( HYPRE_Int nx , void **x , HYPRE_Int ny , void **y , HYPRE_Real *result );
 HYPRE_Int hypre_ParKrylovMassInnerProd ( void *x , void **y, HYPRE_Int k, HYPRE_Int unroll, void *result );
 HYPRE_Int hypre_ParKrylovMassDotpTwo ( void *x , void *y , void **z, HYPRE_Int k, HYPRE_Int unroll, void *result_x, void *result_y );
 HYPRE_Int hypre_ParKrylovMassAxpy( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k, HYPRE_Int unroll);
@@ -1339,6 +1411,10 @@ HYPRE_Int hypre_ILUSolve( void *ilu_vdata, hypre_ParCSRMatrix *A, hypre_ParVecto
 HYPRE_Int hypre_ILUSetPrintLevel( void *ilu_vdata, HYPRE_Int print_level );
 HYPRE_Int hypre_ILUSetLogging( void *ilu_vdata, HYPRE_Int logging );
 HYPRE_Int hypre_ILUSetLocalReordering( void *ilu_vdata, HYPRE_Int ordering_type );
+HYPRE_Int hypre_ILUSetTriSolve( void *ilu_vdata, HYPRE_Int tri_solve );
+HYPRE_Int hypre_ILUSetLowerJacobiIters( void *ilu_vdata, HYPRE_Int lower_jacobi_iters );
+HYPRE_Int hypre_ILUSetUpperJacobiIters( void *ilu_vdata, HYPRE_Int upper_jacobi_iters );
+HYPRE_Int hypre_ILUSetIterativeSetupSweeps( void *ilu_vdata, HYPRE_Int iter_setup_sweeps );
 HYPRE_Int hypre_ILUSetSchurSolverKDIM( void *ilu_vdata, HYPRE_Int ss_kDim );
 HYPRE_Int hypre_ILUSetSchurSolverMaxIter( void *ilu_vdata, HYPRE_Int ss_max_iter );
 HYPRE_Int hypre_ILUSetSchurSolverTol( void *ilu_vdata, HYPRE_Real ss_tol );
@@ -1376,6 +1452,8 @@ HYPRE_Int hypre_ILUGetInteriorExteriorPerm(hypre_ParCSRMatrix *A, HYPRE_Int **pe
 HYPRE_Int hypre_ILUGetLocalPerm(hypre_ParCSRMatrix *A, HYPRE_Int **perm, HYPRE_Int *nLU, HYPRE_Int reordering_type);
 HYPRE_Int hypre_ILUWriteSolverParams(void *ilu_vdata);
 HYPRE_Int hypre_ILUBuildRASExternalMatrix(hypre_ParCSRMatrix *A, HYPRE_Int *rperm, HYPRE_Int **E_i, HYPRE_Int **E_j, HYPRE_Real **E_data);
+HYPRE_Int hypre_ILUSetupLevelSchedule(hypre_CSRMatrix *T, HYPRE_Real *D, HYPRE_Int lower, HYPRE_Int *num_levels_ptr, HYPRE_Int **level_starts_ptr, HYPRE_Int **level_rows_ptr, hypre_CSRMatrix **T_lvl_ptr, HYPRE_Real **D_lvl_ptr);
+HYPRE_Int hypre_ILUSetupIterative(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int *perm, HYPRE_Int num_sweeps, hypre_ParCSRMatrix **Lptr, HYPRE_Real **Dptr, hypre_ParCSRMatrix **Uptr);
 HYPRE_Int hypre_ILUSetupILU0(hypre_ParCSRMatrix *A, HYPRE_Int *perm, HYPRE_Int *qperm, HYPRE_Int nLU, HYPRE_Int nI, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr, hypre_ParCSRMatrix **Sptr, HYPRE_Int **u_end);
 HYPRE_Int hypre_ILUSetupILUK(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int *perm, HYPRE_Int *qperm, HYPRE_Int nLU, HYPRE_Int nI, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr, hypre_ParCSRMatrix **Sptr, HYPRE_Int **u_end);
 HYPRE_Int hypre_ILUSetupILUKSymbolic(HYPRE_Int n, HYPRE_Int *A_diag_i, HYPRE_Int *A_diag_j, HYPRE_Int lfil, HYPRE_Int *perm, HYPRE_Int *rperm, HYPRE_Int *iw, HYPRE_Int nLU, HYPRE_Int *L_diag_i, HYPRE_Int *U_diag_i, HYPRE_Int *S_diag_i, HYPRE_Int **L_diag_j, HYPRE_Int **U_diag_j, HYPRE_Int **S_diag_j, HYPRE_Int **u_end);
@@ -1388,6 +1466,9 @@ HYPRE_Int hypre_ILUSolveLU(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParV
 HYPRE_Int hypre_ILUSolveSchurGMRES(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int *qperm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParCSRMatrix *S, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Solver schur_solver, HYPRE_Solver schur_precond, hypre_ParVector *rhs, hypre_ParVector *x, HYPRE_Int *u_end);
 HYPRE_Int hypre_ILUSolveSchurNSH(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParCSRMatrix *S, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Solver schur_solver, hypre_ParVector *rhs, hypre_ParVector *x, HYPRE_Int *u_end);
 HYPRE_Int hypre_ILUSolveLURAS(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Real *fext, HYPRE_Real *uext);
+HYPRE_Int hypre_ILUSolveLevelSchedule(HYPRE_Int num_levels, HYPRE_Int *level_starts, HYPRE_Int *level_rows, hypre_CSRMatrix *T_lvl, HYPRE_Real *D_lvl, HYPRE_Real *w);
+HYPRE_Int hypre_ILUSolveLULevelSchedule(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int L_num_levels, HYPRE_Int *L_level_starts, HYPRE_Int *L_level_rows, hypre_CSRMatrix *L_lvl, HYPRE_Int U_num_levels, HYPRE_Int *U_level_starts, HYPRE_Int *U_level_rows, hypre_CSRMatrix *U_lvl, HYPRE_Real *D_lvl, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Real *fext, HYPRE_Real *uext, HYPRE_Real *w);
+HYPRE_Int hypre_ILUSolveLUIter(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Real *fext, HYPRE_Real *uext, HYPRE_Int lower_iters, HYPRE_Int upper_iters, HYPRE_Real *work);
 HYPRE_Int hypre_ILUSetSchurNSHDropThreshold( void *ilu_vdata, HYPRE_Real threshold);
 HYPRE_Int hypre_ILUSetSchurNSHDropThresholdArray( void *ilu_vdata, HYPRE_Real *threshold);
 HYPRE_Int hypre_ILULocalRCM( hypre_CSRMatrix *A, HYPRE_Int start, HYPRE_Int end, HYPRE_Int **permp, HYPRE_Int **qpermp, HYPRE_Int sym);
@@ -411,3 +411,86 @@ HYPRE_ParCSRMatrixMatvecT( HYPRE_Complex      alpha,
                alpha, (hypre_ParCSRMatrix *) A,
                (hypre_ParVector *) x, beta, (hypre_ParVector *) y) );
 }
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRMatrixSetMatvecOverlap
+ *
+ * Global option: 0 (default) posts the halo exchange, multiplies diag and
+ * waits; 1 uses the split-phase host matvec, which multiplies diag in row
+ * chunks and polls the exchange between chunks.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRMatrixSetMatvecOverlap( HYPRE_Int overlap )
+{
+   hypre_HandleMatvecOverlap(hypre_handle()) = overlap;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRMatrixSetMatvecOverlapChunkSize
+ *
+ * Number of diag rows computed between two polls of the halo exchange.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRMatrixSetMatvecOverlapChunkSize( HYPRE_Int chunk_size )
+{
+   if (chunk_size < 1)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_HandleMatvecOverlapChunkSize(hypre_handle()) = chunk_size;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRMatrixSetSellCSigma
+ *
+ * Per-matrix option: chunk_size > 0 multiplies diag and offd in the
+ * SELL-C-sigma format (C = chunk_size, sigma = sort_scope) in the host
+ * matvec; 0 (default) uses CSR.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRMatrixSetSellCSigma( HYPRE_ParCSRMatrix matrix,
+                                 HYPRE_Int          chunk_size,
+                                 HYPRE_Int          sort_scope )
+{
+   return ( hypre_ParCSRMatrixSetSellCSigma( (hypre_ParCSRMatrix *) matrix,
+                                             chunk_size, sort_scope ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRMatrixGetMatvecCommTimes
+ *
+ * Returns the number of split-phase matvecs done with A and the accumulated
+ * halo exchange time hidden behind the diag multiply and exposed after it.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRMatrixGetMatvecCommTimes( HYPRE_ParCSRMatrix  matrix,
+                                      HYPRE_Int          *num_calls,
+                                      HYPRE_Real         *hidden_time,
+                                      HYPRE_Real         *exposed_time )
+{
+   hypre_ParCSRCommPkg *comm_pkg;
+
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   comm_pkg = hypre_ParCSRMatrixCommPkg((hypre_ParCSRMatrix *) matrix);
+
+   *num_calls    = comm_pkg ? hypre_ParCSRCommPkgMatvecNumOverlapped(comm_pkg) : 0;
+   *hidden_time  = comm_pkg ? hypre_ParCSRCommPkgMatvecHiddenTime(comm_pkg)    : 0.0;
+   *exposed_time = comm_pkg ? hypre_ParCSRCommPkgMatvecExposedTime(comm_pkg)   : 0.0;
+
+   return hypre_error_flag;
+}
@@ -50,6 +50,10 @@ HYPRE_Int HYPRE_ParCSRMatrixRestoreRow( HYPRE_ParCSRMatrix matrix , HYPRE_BigInt
 HYPRE_Int HYPRE_CSRMatrixToParCSRMatrix( MPI_Comm comm , HYPRE_CSRMatrix A_CSR , HYPRE_BigInt *row_partitioning , HYPRE_BigInt *col_partitioning , HYPRE_ParCSRMatrix *matrix );
 HYPRE_Int HYPRE_ParCSRMatrixMatvec( HYPRE_Complex alpha , HYPRE_ParCSRMatrix A , HYPRE_ParVector x , HYPRE_Complex beta , HYPRE_ParVector y );
 HYPRE_Int HYPRE_ParCSRMatrixMatvecT( HYPRE_Complex alpha , HYPRE_ParCSRMatrix A , HYPRE_ParVector x , HYPRE_Complex beta , HYPRE_ParVector y );
+HYPRE_Int HYPRE_ParCSRMatrixSetMatvecOverlap( HYPRE_Int overlap );
+HYPRE_Int HYPRE_ParCSRMatrixSetMatvecOverlapChunkSize( HYPRE_Int chunk_size );
+HYPRE_Int HYPRE_ParCSRMatrixSetSellCSigma( HYPRE_ParCSRMatrix matrix , HYPRE_Int chunk_size , HYPRE_Int sort_scope );
+HYPRE_Int HYPRE_ParCSRMatrixGetMatvecCommTimes( HYPRE_ParCSRMatrix matrix , HYPRE_Int *num_calls , HYPRE_Real *hidden_time , HYPRE_Real *exposed_time );
 
 /* HYPRE_parcsr_vector.c */
 HYPRE_Int HYPRE_ParVectorCreate( MPI_Comm comm , HYPRE_BigInt global_size , HYPRE_BigInt *partitioning , HYPRE_ParVector *vector );
@@ -28,7 +28,6 @@ extern "C" {
  *   Structure containing information for doing communications
  *--------------------------------------------------------------------------*/
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 typedef enum CommPkgJobType
 {
    HYPRE_COMM_PKG_JOB_COMPLEX = 0,
@@ -39,7 +38,6 @@ typedef enum CommPkgJobType
    HYPRE_COMM_PKG_JOB_BIGINT_TRANSPOSE,
    NUM_OF_COMM_PKG_JOB_TYPE,
 } CommPkgJobType;
-#endif
 
 /*--------------------------------------------------------------------------
  * hypre_ParCSRCommHandle, hypre_ParCSRPersistentCommHandle
@@ -59,10 +57,36 @@ typedef struct
    void                 *recv_data_buffer;
    HYPRE_Int             num_requests;
    hypre_MPI_Request    *requests;
+   /* persistent handles (persistent = job) are owned by their comm_pkg and
+    * may be restarted once the previous exchange was waited for (active = 0) */
+   HYPRE_Int             persistent;
+   HYPRE_Int             active;
 } hypre_ParCSRCommHandle;
 
 typedef hypre_ParCSRCommHandle hypre_ParCSRPersistentCommHandle;
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNodeAwareComm:
+ *   Two-level routing of the halo exchanges of a communication package (see
+ *   par_csr_node_aware.c).  The entries travel through three point-to-point
+ *   stages over the work array [send buffer | stage 1 | stage 2 | stage 3]:
+ *   stage s sends work[send_map_elmts] of stage_pkgs[s] and receives into
+ *   work + stage_offsets[s].  Received entry i of the original package
+ *   ends up in work[final_map[i]].
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_NODE_AWARE_NUM_STAGES 3
+
+typedef struct
+{
+   struct _hypre_ParCSRCommPkg *stage_pkgs[HYPRE_NODE_AWARE_NUM_STAGES];
+   HYPRE_Int                    stage_offsets[HYPRE_NODE_AWARE_NUM_STAGES];
+   HYPRE_Int                    work_size;
+   HYPRE_Int                   *final_map;
+   HYPRE_Complex               *work;
+   HYPRE_Complex               *send_buffer;
+} hypre_ParCSRNodeAwareComm;
+
 typedef struct _hypre_ParCSRCommPkg
 {
    MPI_Comm                     comm;
@@ -81,9 +105,32 @@ typedef struct _hypre_ParCSRCommPkg
    hypre_MPI_Datatype          *send_mpi_types;
    hypre_MPI_Datatype          *recv_mpi_types;
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
+   /* persistent handles, cached only on the packages destroyed with
+    * hypre_MatvecCommPkgDestroy (use_persistent = 1) */
+   HYPRE_Int                    use_persistent;
    hypre_ParCSRPersistentCommHandle *persistent_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
-#endif
+
+   /* distributed graph communicators of jobs 1 (recv_procs -> send_procs)
+    * and 2 (reverse), and the message counts and displacements in entries
+    * for MPI_Ineighbor_alltoallv (see hypre_ParCSRCommPkgCreateNeighborComm),
+    * and whether the exchanges use them (see hypre_ParCSRCommPkgSetNeighborComm) */
+   HYPRE_Int                    has_neighbor_comm;
+   HYPRE_Int                    use_neighbor_comm;
+   MPI_Comm                     neighbor_comm[2];
+   hypre_int                   *neighbor_send_counts;
+   hypre_int                   *neighbor_send_displs;
+   hypre_int                   *neighbor_recv_counts;
+   hypre_int                   *neighbor_recv_displs;
+
+   /* two-level routing of jobs 1 and 2 through on-node proxies, with one
+    * inter-node message per pair of nodes (see hypre_ParCSRCommPkgCreateNodeAware) */
+   hypre_ParCSRNodeAwareComm   *node_aware;
+
+   /* halo exchange statistics of the split-phase matvec: communication time
+    * hidden behind the diag multiply and time exposed waiting after it */
+   HYPRE_Int                    matvec_num_overlapped;
+   HYPRE_Real                   matvec_hidden_time;
+   HYPRE_Real                   matvec_exposed_time;
 
    /* temporary memory for matvec. cudaMalloc is expensive. alloc once and reuse */
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
@@ -116,6 +163,20 @@ typedef struct _hypre_ParCSRCommPkg
 #define hypre_ParCSRCommPkgSendMPIType(comm_pkg,i)       (comm_pkg -> send_mpi_types[i])
 #define hypre_ParCSRCommPkgRecvMPITypes(comm_pkg)        (comm_pkg -> recv_mpi_types)
 #define hypre_ParCSRCommPkgRecvMPIType(comm_pkg,i)       (comm_pkg -> recv_mpi_types[i])
+#define hypre_ParCSRCommPkgUsePersistent(comm_pkg)       (comm_pkg -> use_persistent)
+#define hypre_ParCSRCommPkgHasNeighborComm(comm_pkg)     (comm_pkg -> has_neighbor_comm)
+#define hypre_ParCSRCommPkgNeighborComm(comm_pkg, i)     (comm_pkg -> neighbor_comm[i])
+#define hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg)  (comm_pkg -> neighbor_send_counts)
+#define hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg)  (comm_pkg -> neighbor_send_displs)
+#define hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg)  (comm_pkg -> neighbor_recv_counts)
+#define hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg)  (comm_pkg -> neighbor_recv_displs)
+#define hypre_ParCSRCommPkgNodeAware(comm_pkg)          (comm_pkg -> node_aware)
+
+/* exchanges of jobs 1 and 2 use the neighborhood collectives */
+#define hypre_ParCSRCommPkgUseNeighborComm(comm_pkg)     (comm_pkg -> use_neighbor_comm)
+#define hypre_ParCSRCommPkgMatvecNumOverlapped(comm_pkg)  (comm_pkg -> matvec_num_overlapped)
+#define hypre_ParCSRCommPkgMatvecHiddenTime(comm_pkg)     (comm_pkg -> matvec_hidden_time)
+#define hypre_ParCSRCommPkgMatvecExposedTime(comm_pkg)    (comm_pkg -> matvec_exposed_time)
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
 #define hypre_ParCSRCommPkgTmpData(comm_pkg)             ((comm_pkg) -> tmp_data)
@@ -159,6 +220,19 @@ hypre_ParCSRCommPkgCopySendMapElmtsToDevice(hypre_ParCSRCommPkg *comm_pkg)
 #define hypre_ParCSRCommHandleNumRequests(comm_handle)            (comm_handle -> num_requests)
 #define hypre_ParCSRCommHandleRequests(comm_handle)               (comm_handle -> requests)
 #define hypre_ParCSRCommHandleRequest(comm_handle, i)             (comm_handle -> requests[i])
+#define hypre_ParCSRCommHandlePersistent(comm_handle)             (comm_handle -> persistent)
+#define hypre_ParCSRCommHandleActive(comm_handle)                 (comm_handle -> active)
+
+/*--------------------------------------------------------------------------
+ * Accessor macros: hypre_ParCSRNodeAwareComm
+ *--------------------------------------------------------------------------*/
+
+#define hypre_ParCSRNodeAwareCommStagePkg(node_aware, s)     ((node_aware) -> stage_pkgs[s])
+#define hypre_ParCSRNodeAwareCommStageOffset(node_aware, s)  ((node_aware) -> stage_offsets[s])
+#define hypre_ParCSRNodeAwareCommWorkSize(node_aware)        ((node_aware) -> work_size)
+#define hypre_ParCSRNodeAwareCommFinalMap(node_aware)        ((node_aware) -> final_map)
+#define hypre_ParCSRNodeAwareCommWork(node_aware)            ((node_aware) -> work)
+#define hypre_ParCSRNodeAwareCommSendBuffer(node_aware)      ((node_aware) -> send_buffer)
 
 #endif /* HYPRE_PAR_CSR_COMMUNICATION_HEADER */
 
@@ -487,6 +561,14 @@ typedef struct
 #define hypre_ParCSRBooleanMatrix_Get_Rowindices(matrix)    ((matrix)->rowindices)
 #define hypre_ParCSRBooleanMatrix_Get_Getrowactive(matrix)  ((matrix)->getrowactive)
 
+/*--------------------------------------------------------------------------
+ * Plan of a host sparse matrix-matrix product C = A*B or C = A^T*B: the
+ * symbolic structure and communication pattern of the product, reused to
+ * recompute the values of C (see par_csr_triplemat.c)
+ *--------------------------------------------------------------------------*/
+
+typedef struct hypre_ParCSRMatMatPlan_struct hypre_ParCSRMatMatPlan;
+
 #endif
 
 /******************************************************************************
@@ -693,6 +775,10 @@ HYPRE_Int HYPRE_CSRMatrixToParCSRMatrix ( MPI_Comm comm , HYPRE_CSRMatrix A_CSR
 HYPRE_Int HYPRE_CSRMatrixToParCSRMatrix_WithNewPartitioning ( MPI_Comm comm , HYPRE_CSRMatrix A_CSR , HYPRE_ParCSRMatrix *matrix );
 HYPRE_Int HYPRE_ParCSRMatrixMatvec ( HYPRE_Complex alpha , HYPRE_ParCSRMatrix A , HYPRE_ParVector x , HYPRE_Complex beta , HYPRE_ParVector y );
 HYPRE_Int HYPRE_ParCSRMatrixMatvecT ( HYPRE_Complex alpha , HYPRE_ParCSRMatrix A , HYPRE_ParVector x , HYPRE_Complex beta , HYPRE_ParVector y );
+HYPRE_Int HYPRE_ParCSRMatrixSetMatvecOverlap ( HYPRE_Int overlap );
+HYPRE_Int HYPRE_ParCSRMatrixSetMatvecOverlapChunkSize ( HYPRE_Int chunk_size );
+HYPRE_Int HYPRE_ParCSRMatrixSetSellCSigma ( HYPRE_ParCSRMatrix matrix , HYPRE_Int chunk_size , HYPRE_Int sort_scope );
+HYPRE_Int HYPRE_ParCSRMatrixGetMatvecCommTimes ( HYPRE_ParCSRMatrix matrix , HYPRE_Int *num_calls , HYPRE_Real *hidden_time , HYPRE_Real *exposed_time );
 HYPRE_Int hypre_ParCSRMatrixTruncate(hypre_ParCSRMatrix *A, HYPRE_Real tol, HYPRE_Int max_row_elmts, HYPRE_Int rescale, HYPRE_Int nrm_type);
 /* HYPRE_parcsr_vector.c */
 HYPRE_Int HYPRE_ParVectorCreate ( MPI_Comm comm , HYPRE_BigInt global_size , HYPRE_BigInt *partitioning , HYPRE_ParVector *vector );
@@ -749,6 +835,12 @@ HYPRE_Int hypre_GetAssumedPartitionProcFromRow ( MPI_Comm comm , HYPRE_BigInt ro
 HYPRE_Int hypre_GetAssumedPartitionRowRange ( MPI_Comm comm , HYPRE_Int proc_id , HYPRE_BigInt global_first_row , HYPRE_BigInt global_num_rows , HYPRE_BigInt *row_start , HYPRE_BigInt *row_end );
 HYPRE_Int hypre_ParVectorCreateAssumedPartition ( hypre_ParVector *vector );
 
+/* par_csr_binary_io.c */
+HYPRE_Int hypre_ParCSRMatrixPrintBinary ( hypre_ParCSRMatrix *matrix , HYPRE_BigInt base_i , HYPRE_BigInt base_j , const char *filename );
+HYPRE_Int hypre_ParCSRMatrixReadBinary ( MPI_Comm comm , const char *filename , HYPRE_BigInt *base_i_ptr , HYPRE_BigInt *base_j_ptr , hypre_ParCSRMatrix **matrix_ptr );
+HYPRE_Int hypre_ParVectorPrintBinary ( hypre_ParVector *vector , HYPRE_BigInt base_j , const char *filename );
+HYPRE_Int hypre_ParVectorReadBinary ( MPI_Comm comm , const char *filename , HYPRE_BigInt *base_j_ptr , hypre_ParVector **vector_ptr );
+
 /* par_csr_bool_matop.c */
 hypre_ParCSRBooleanMatrix *hypre_ParBooleanMatmul ( hypre_ParCSRBooleanMatrix *A , hypre_ParCSRBooleanMatrix *B );
 hypre_CSRBooleanMatrix *hypre_ParCSRBooleanMatrixExtractBExt ( hypre_ParCSRBooleanMatrix *B , hypre_ParCSRBooleanMatrix *A );
@@ -786,11 +878,15 @@ HYPRE_Int hypre_BooleanGenerateDiagAndOffd ( hypre_CSRBooleanMatrix *A , hypre_P
 /* par_csr_communication.c */
 hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreate ( HYPRE_Int job , hypre_ParCSRCommPkg *comm_pkg , void *send_data , void *recv_data );
 hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg, HYPRE_MemoryLocation send_memory_location, void *send_data_in, HYPRE_MemoryLocation recv_memory_location, void *recv_data_in );
+hypre_ParCSRCommHandle *hypre_ParCSRCommHandleCreateMultiVector ( HYPRE_Int job , HYPRE_Int num_vectors , hypre_ParCSRCommPkg *comm_pkg , void *send_data , void *recv_data );
 HYPRE_Int hypre_ParCSRCommHandleDestroy ( hypre_ParCSRCommHandle *comm_handle );
 void hypre_ParCSRCommPkgCreate_core ( MPI_Comm comm , HYPRE_BigInt *col_map_offd , HYPRE_BigInt first_col_diag , HYPRE_BigInt *col_starts , HYPRE_Int num_cols_diag , HYPRE_Int num_cols_offd , HYPRE_Int *p_num_recvs , HYPRE_Int **p_recv_procs , HYPRE_Int **p_recv_vec_starts , HYPRE_Int *p_num_sends , HYPRE_Int **p_send_procs , HYPRE_Int **p_send_map_starts , HYPRE_Int **p_send_map_elmts );
 HYPRE_Int
 hypre_ParCSRCommPkgCreate(MPI_Comm comm, HYPRE_BigInt *col_map_offd, HYPRE_BigInt first_col_diag, HYPRE_BigInt *col_starts, HYPRE_Int num_cols_diag, HYPRE_Int num_cols_offd, hypre_ParCSRCommPkg *comm_pkg);
 HYPRE_Int hypre_MatvecCommPkgCreate ( hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_ParCSRCommPkgCreateNeighborComm ( hypre_ParCSRCommPkg *comm_pkg );
+HYPRE_Int hypre_ParCSRCommPkgSetNeighborComm ( hypre_ParCSRCommPkg *comm_pkg , HYPRE_Int use );
+HYPRE_Int hypre_ParCSRCommPkgDestroyNeighborComm ( hypre_ParCSRCommPkg *comm_pkg );
 HYPRE_Int hypre_MatvecCommPkgDestroy ( hypre_ParCSRCommPkg *comm_pkg );
 HYPRE_Int hypre_BuildCSRMatrixMPIDataType ( HYPRE_Int num_nonzeros , HYPRE_Int num_rows , HYPRE_Complex *a_data , HYPRE_Int *a_i , HYPRE_Int *a_j , hypre_MPI_Datatype *csr_matrix_datatype );
 HYPRE_Int hypre_BuildCSRJDataType ( HYPRE_Int num_nonzeros , HYPRE_Complex *a_data , HYPRE_Int *a_j , hypre_MPI_Datatype *csr_jdata_datatype );
@@ -819,13 +915,11 @@ HYPRE_Int hypre_ExchangeExternalRowsDeviceInit( hypre_CSRMatrix *B_ext, hypre_Pa
 hypre_CSRMatrix* hypre_ExchangeExternalRowsDeviceWait(void *vrequest);
 HYPRE_Int hypre_ParCSRMatrixGenerateFFFCDevice( hypre_ParCSRMatrix *A, HYPRE_Int *CF_marker_host, HYPRE_BigInt *cpts_starts, hypre_ParCSRMatrix *S, hypre_ParCSRMatrix **A_FC_ptr, hypre_ParCSRMatrix **A_FF_ptr );
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 hypre_ParCSRPersistentCommHandle* hypre_ParCSRPersistentCommHandleCreate(HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg);
 hypre_ParCSRPersistentCommHandle* hypre_ParCSRCommPkgGetPersistentCommHandle(HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg);
 void hypre_ParCSRPersistentCommHandleDestroy(hypre_ParCSRPersistentCommHandle *comm_handle);
 void hypre_ParCSRPersistentCommHandleStart(hypre_ParCSRPersistentCommHandle *comm_handle, HYPRE_MemoryLocation send_memory_location, void *send_data);
 void hypre_ParCSRPersistentCommHandleWait(hypre_ParCSRPersistentCommHandle *comm_handle, HYPRE_MemoryLocation recv_memory_location, void *recv_data);
-#endif
 
 HYPRE_Int hypre_ParcsrGetExternalRowsInit( hypre_ParCSRMatrix *A, HYPRE_Int indices_len, HYPRE_BigInt *indices, hypre_ParCSRCommPkg *comm_pkg, HYPRE_Int want_data, void **request_ptr);
 hypre_CSRMatrix* hypre_ParcsrGetExternalRowsWait(void *vrequest);
@@ -856,6 +950,10 @@ HYPRE_Int hypre_ParCSRMatrixInitialize_v2( hypre_ParCSRMatrix *matrix, HYPRE_Mem
 HYPRE_Int hypre_ParCSRMatrixInitialize ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetNumNonzeros ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetDNumNonzeros ( hypre_ParCSRMatrix *matrix );
+HYPRE_Int hypre_ParCSRMatrixConvertToSP ( hypre_ParCSRMatrix *matrix );
+HYPRE_Int hypre_ParCSRMatrixConvertToDP ( hypre_ParCSRMatrix *matrix );
+HYPRE_Int hypre_ParCSRMatrixValuesChanged ( hypre_ParCSRMatrix *matrix );
+HYPRE_Int hypre_ParCSRMatrixSetSellCSigma ( hypre_ParCSRMatrix *matrix , HYPRE_Int chunk_size , HYPRE_Int sort_scope );
 HYPRE_Int hypre_ParCSRMatrixSetDataOwner ( hypre_ParCSRMatrix *matrix , HYPRE_Int owns_data );
 HYPRE_Int hypre_ParCSRMatrixSetRowStartsOwner ( hypre_ParCSRMatrix *matrix , HYPRE_Int owns_row_starts );
 HYPRE_Int hypre_ParCSRMatrixSetColStartsOwner ( hypre_ParCSRMatrix *matrix , HYPRE_Int owns_col_starts );
@@ -888,6 +986,11 @@ HYPRE_Int hypre_ParCSRMatrixMatvec ( HYPRE_Complex alpha , hypre_ParCSRMatrix *A
 HYPRE_Int hypre_ParCSRMatrixMatvecT ( HYPRE_Complex alpha , hypre_ParCSRMatrix *A , hypre_ParVector *x , HYPRE_Complex beta , hypre_ParVector *y );
 HYPRE_Int hypre_ParCSRMatrixMatvec_FF ( HYPRE_Complex alpha , hypre_ParCSRMatrix *A , hypre_ParVector *x , HYPRE_Complex beta , hypre_ParVector *y , HYPRE_Int *CF_marker , HYPRE_Int fpt );
 
+/* par_csr_node_aware.c */
+HYPRE_Int hypre_ParCSRCommPkgCreateNodeAware ( hypre_ParCSRCommPkg *comm_pkg );
+HYPRE_Int hypre_ParCSRCommPkgDestroyNodeAware ( hypre_ParCSRCommPkg *comm_pkg );
+HYPRE_Int hypre_ParCSRNodeAwareExchange ( HYPRE_Int job , hypre_ParCSRCommPkg *comm_pkg , HYPRE_Complex *send_data , HYPRE_Complex *recv_data );
+
 /* par_csr_triplemat.c */
 hypre_ParCSRMatrix *hypre_ParCSRMatMat( hypre_ParCSRMatrix  *A, hypre_ParCSRMatrix  *B );
 hypre_ParCSRMatrix *hypre_ParCSRMatMatHost( hypre_ParCSRMatrix  *A, hypre_ParCSRMatrix  *B );
@@ -897,6 +1000,11 @@ hypre_ParCSRMatrix *hypre_ParCSRTMatMatKTHost( hypre_ParCSRMatrix  *A, hypre_Par
 hypre_ParCSRMatrix *hypre_ParCSRTMatMatKTDevice( hypre_ParCSRMatrix  *A, hypre_ParCSRMatrix  *B, HYPRE_Int keep_transpose);
 hypre_ParCSRMatrix *hypre_ParCSRTMatMatKT( hypre_ParCSRMatrix  *A, hypre_ParCSRMatrix  *B, HYPRE_Int keep_transpose);
 hypre_ParCSRMatrix *hypre_ParCSRTMatMat( hypre_ParCSRMatrix  *A, hypre_ParCSRMatrix  *B);
+HYPRE_Int hypre_ParCSRMatMatPlanCreate ( hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *B , hypre_ParCSRMatrix *C , HYPRE_Int transpose_A , hypre_ParCSRMatMatPlan **plan_ptr );
+HYPRE_Int hypre_ParCSRMatMatPlanDestroy ( hypre_ParCSRMatMatPlan *plan );
+HYPRE_Int hypre_ParCSRMatMatPlanExecute ( hypre_ParCSRMatMatPlan *plan , hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *B , hypre_ParCSRMatrix *C );
+HYPRE_Int hypre_ParCSRMatMatNumeric ( hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *B , hypre_ParCSRMatrix *C );
+HYPRE_Int hypre_ParCSRTMatMatNumeric ( hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *B , hypre_ParCSRMatrix *C );
 hypre_ParCSRMatrix *hypre_ParCSRMatrixRAPKT( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix  *A, hypre_ParCSRMatrix  *P , HYPRE_Int keepTranspose );
 hypre_ParCSRMatrix *hypre_ParCSRMatrixRAP( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix  *A, hypre_ParCSRMatrix  *P );
 
@@ -926,6 +1034,7 @@ HYPRE_Int hypre_ParVectorAxpy ( HYPRE_Complex alpha , hypre_ParVector *x , hypre
 HYPRE_Int hypre_ParVectorMassAxpy ( HYPRE_Complex *alpha, hypre_ParVector **x, hypre_ParVector *y, HYPRE_Int k, HYPRE_Int unroll);
 HYPRE_Real hypre_ParVectorInnerProd ( hypre_ParVector *x , hypre_ParVector *y );
 HYPRE_Int hypre_ParVectorMassInnerProd ( hypre_ParVector *x , hypre_ParVector **y , HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *prod );
+HYPRE_Int hypre_ParVectorBlockInnerProd ( HYPRE_Int nx , hypre_ParVector **x , HYPRE_Int ny , hypre_ParVector **y , HYPRE_Real *result );
 HYPRE_Int hypre_ParVectorMassDotpTwo ( hypre_ParVector *x , hypre_ParVector *y , hypre_ParVector **z, HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *prod_x , HYPRE_Real *prod_y );
 hypre_ParVector *hypre_VectorToParVector ( MPI_Comm comm , hypre_Vector *v , HYPRE_BigInt *vec_starts );
 hypre_Vector *hypre_ParVectorToVectorAll ( hypre_ParVector *par_v );
@@ -6,9 +6,207 @@
  ******************************************************************************/
 
 #include "_hypre_parcsr_mv.h"
+
+/*--------------------------------------------------------------------------
+ * BuildStencilLaplacian
+ *
+ * 7pt or 27pt Laplacian on an nx x ny x nz grid, assembled on one process.
+ *--------------------------------------------------------------------------*/
+
+static hypre_CSRMatrix *
+BuildStencilLaplacian( HYPRE_Int nx,
+                       HYPRE_Int ny,
+                       HYPRE_Int nz,
+                       HYPRE_Int stencil )
+{
+   hypre_CSRMatrix *A;
+   HYPRE_Int       *A_i, *A_j;
+   HYPRE_Complex   *A_data;
+   HYPRE_Int        num_rows = nx * ny * nz;
+   HYPRE_Int        ix, iy, iz, dx, dy, dz, row, nnz, dist;
+
+   A = hypre_CSRMatrixCreate(num_rows, num_rows, num_rows * stencil);
+   hypre_CSRMatrixInitialize_v2(A, 0, HYPRE_MEMORY_HOST);
+   A_i    = hypre_CSRMatrixI(A);
+   A_j    = hypre_CSRMatrixJ(A);
+   A_data = hypre_CSRMatrixData(A);
+
+   nnz = 0;
+   for (iz = 0; iz < nz; iz++)
+   {
+      for (iy = 0; iy < ny; iy++)
+      {
+         for (ix = 0; ix < nx; ix++)
+         {
+            row = ix + nx*(iy + ny*iz);
+            A_i[row] = nnz;
+
+            /* diagonal first */
+            A_j[nnz]    = row;
+            A_data[nnz] = (stencil == 7) ? 6.0 : 26.0;
+            nnz++;
+
+            for (dz = -1; dz <= 1; dz++)
+            {
+               for (dy = -1; dy <= 1; dy++)
+               {
+                  for (dx = -1; dx <= 1; dx++)
+                  {
+                     dist = hypre_abs(dx) + hypre_abs(dy) + hypre_abs(dz);
+                     if ( dist == 0 || (stencil == 7 && dist > 1) ||
+                          ix+dx < 0 || ix+dx >= nx ||
+                          iy+dy < 0 || iy+dy >= ny ||
+                          iz+dz < 0 || iz+dz >= nz )
+                     {
+                        continue;
+                     }
+                     A_j[nnz]    = row + dx + nx*(dy + ny*dz);
+                     A_data[nnz] = -1.0;
+                     nnz++;
+                  }
+               }
+            }
+         }
+      }
+   }
+   A_i[num_rows] = nnz;
+   hypre_CSRMatrixNumNonzeros(A) = nnz;
+
+   return A;
+}
+
+/*--------------------------------------------------------------------------
+ * RunMatvecBenchmark
+ *
+ * Times reps matvecs with CSR and with the SELL-C-sigma shadow format.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+RunMatvecBenchmark( HYPRE_Int nx,
+                    HYPRE_Int ny,
+                    HYPRE_Int nz,
+                    HYPRE_Int stencil,
+                    HYPRE_Int reps,
+                    HYPRE_Int chunk_size,
+                    HYPRE_Int sort_scope )
+{
+   MPI_Comm            comm = hypre_MPI_COMM_WORLD;
+   hypre_CSRMatrix    *matrix = NULL;
+   hypre_ParCSRMatrix *par_matrix;
+   hypre_ParVector    *x, *y, *y_csr;
+   HYPRE_Int           my_id, mode, i;
+   HYPRE_BigInt        global_nnz;
+   HYPRE_Real          t_setup, t_mv, t_loc, bytes, err, norm;
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   if (my_id == 0)
+   {
+      matrix = BuildStencilLaplacian(nx, ny, nz, stencil);
+   }
+   par_matrix = hypre_CSRMatrixToParCSRMatrix(comm, matrix, NULL, NULL);
+   hypre_MatvecCommPkgCreate(par_matrix);
+   hypre_ParCSRMatrixSetNumNonzeros(par_matrix);
+   global_nnz = hypre_ParCSRMatrixNumNonzeros(par_matrix);
+
+   x = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumCols(par_matrix),
+                             hypre_ParCSRMatrixColStarts(par_matrix));
+   hypre_ParVectorSetPartitioningOwner(x, 0);
+   hypre_ParVectorInitialize(x);
+   hypre_ParVectorSetRandomValues(x, 1);
+
+   y = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(par_matrix),
+                             hypre_ParCSRMatrixRowStarts(par_matrix));
+   hypre_ParVectorSetPartitioningOwner(y, 0);
+   hypre_ParVectorInitialize(y);
+
+   y_csr = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(par_matrix),
+                                 hypre_ParCSRMatrixRowStarts(par_matrix));
+   hypre_ParVectorSetPartitioningOwner(y_csr, 0);
+   hypre_ParVectorInitialize(y_csr);
+
+   if (my_id == 0)
+   {
+      hypre_printf("\n%dpt Laplacian %d x %d x %d, nnz = %b, %d matvecs\n",
+                   stencil, nx, ny, nz, global_nnz, reps);
+   }
+
+   /* mode 0: CSR, mode 1: SELL-C-sigma */
+   for (mode = 0; mode < 2; mode++)
+   {
+      hypre_ParCSRMatrixSetSellCSigma(par_matrix, mode ? chunk_size : 0, sort_scope);
+
+      /* the first matvec builds the SELL shadows */
+      hypre_MPI_Barrier(comm);
+      t_setup = hypre_MPI_Wtime();
+      hypre_ParCSRMatrixMatvec(1.0, par_matrix, x, 0.0, y);
+      t_setup = hypre_MPI_Wtime() - t_setup;
+
+      hypre_MPI_Barrier(comm);
+      t_mv = hypre_MPI_Wtime();
+      for (i = 0; i < reps; i++)
+      {
+         hypre_ParCSRMatrixMatvec(1.0, par_matrix, x, 0.0, y);
+      }
+      t_loc = (hypre_MPI_Wtime() - t_mv) / reps;
+      hypre_MPI_Allreduce(&t_loc, &t_mv, 1, HYPRE_MPI_REAL, hypre_MPI_MAX, comm);
+
+      /* values + column indices + x gathers + y writes */
+      bytes = (HYPRE_Real) global_nnz * (sizeof(HYPRE_Complex) + sizeof(HYPRE_Int)) +
+              (HYPRE_Real) hypre_ParCSRMatrixGlobalNumRows(par_matrix) * 2 * sizeof(HYPRE_Complex);
+
+      if (mode == 0)
+      {
+         hypre_ParVectorCopy(y, y_csr);
+      }
+
+      if (my_id == 0)
+      {
+         if (mode == 0)
+         {
+            hypre_printf("  CSR            : %e s/matvec, %7.2f GB/s\n",
+                         t_mv, bytes / t_mv / 1.0e9);
+         }
+         else
+         {
+            hypre_printf("  SELL-%d-%-6d  : %e s/matvec, %7.2f GB/s (shadow build + first matvec %e s)\n",
+                         chunk_size, sort_scope, t_mv, bytes / t_mv / 1.0e9, t_setup);
+         }
+      }
+   }
+   hypre_ParCSRMatrixSetSellCSigma(par_matrix, 0, 1);
+
+   /* check that both formats give the same result */
+   norm = hypre_ParVectorInnerProd(y_csr, y_csr);
+   hypre_ParVectorAxpy(-1.0, y, y_csr);
+   err = hypre_ParVectorInnerProd(y_csr, y_csr);
+   if (my_id == 0)
+   {
+      hypre_printf("  ||y_sell - y_csr|| / ||y_csr|| = %e\n", sqrt(err / norm));
+   }
+
+   hypre_ParCSRMatrixDestroy(par_matrix);
+   hypre_ParVectorDestroy(x);
+   hypre_ParVectorDestroy(y);
+   hypre_ParVectorDestroy(y_csr);
+   if (my_id == 0)
+   {
+      hypre_CSRMatrixDestroy(matrix);
+   }
+
+   return 0;
+}
+
  
 /*--------------------------------------------------------------------------
- * Test driver for unstructured matrix interface 
+ * Test driver for unstructured matrix interface
+ *
+ * Without arguments, reads the CSR matrix "input" and tests Matvec/MatvecT.
+ * With -bench, compares CSR and SELL-C-sigma matvecs on the 7pt and 27pt
+ * Laplacians:
+ *    -n <nx> <ny> <nz>   : grid size (default 64 64 64)
+ *    -reps <n>           : number of timed matvecs (default 100)
+ *    -sell <C> <sigma>   : SELL chunk size and sorting scope (default 8 256)
  *--------------------------------------------------------------------------*/
  
 HYPRE_Int
@@ -35,12 +233,58 @@ main( HYPRE_Int   argc,
    HYPRE_Complex 	*data, *data2;
    HYPRE_BigInt		*row_starts, *col_starts;
    char		file_name[80];
+   HYPRE_Int   arg_index, bench = 0;
+   HYPRE_Int   nx = 64, ny = 64, nz = 64, reps = 100;
+   HYPRE_Int   chunk_size = 8, sort_scope = 256;
+
    /* Initialize MPI */
    hypre_MPI_Init(&argc, &argv);
 
    hypre_MPI_Comm_size(hypre_MPI_COMM_WORLD, &num_procs);
    hypre_MPI_Comm_rank(hypre_MPI_COMM_WORLD, &my_id);
 
+   arg_index = 1;
+   while (arg_index < argc)
+   {
+      if ( strcmp(argv[arg_index], "-bench") == 0 )
+      {
+         arg_index++;
+         bench = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-n") == 0 )
+      {
+         arg_index++;
+         nx = atoi(argv[arg_index++]);
+         ny = atoi(argv[arg_index++]);
+         nz = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-reps") == 0 )
+      {
+         arg_index++;
+         reps = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-sell") == 0 )
+      {
+         arg_index++;
+         chunk_size = atoi(argv[arg_index++]);
+         sort_scope = atoi(argv[arg_index++]);
+      }
+      else
+      {
+         arg_index++;
+      }
+   }
+
+   if (bench)
+   {
+      RunMatvecBenchmark(nx, ny, nz, 7,  reps, chunk_size, sort_scope);
+      RunMatvecBenchmark(nx, ny, nz, 27, reps, chunk_size, sort_scope);
+
+      hypre_MPI_Finalize();
+
+      return 0;
+   }
+
    hypre_printf(" my_id: %d num_procs: %d\n", my_id, num_procs);
  
    if (my_id == 0) 
@@ -0,0 +1,1106 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Binary file format for ParCSR matrices and vectors
+ *
+ * A matrix or vector is stored in a single file, written concurrently by all
+ * processors, that consists of
+ *
+ *    - a header of HYPRE_BINARY_HEADER_SIZE integers (see HYPRE_BINARY_H_*)
+ *    - a table with HYPRE_BINARY_PART_SIZE integers per part, i.e. per
+ *      processor that wrote the file (see HYPRE_BINARY_P_*)
+ *    - one section per part.  A matrix section holds the arrays diag_i,
+ *      offd_i (integers), diag_j, offd_j (hypre_int), col_map_offd
+ *      (integers), diag_data and offd_data (HYPRE_Complex); a vector
+ *      section holds the local values.
+ *
+ * Integers are of type hypre_longint.  Every array starts at a multiple of
+ * eight bytes, so that the file can be memory mapped and the arrays of a
+ * section used in place.  The file can be read by any number of
+ * processors: each one reads the rows it owns from the parts that hold
+ * them.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+#if !defined(_WIN32)
+#include <sys/types.h>
+#endif
+
+#define HYPRE_BINARY_VERSION       1
+#define HYPRE_BINARY_BYTE_ORDER    0x01020304
+#define HYPRE_BINARY_MATRIX        1
+#define HYPRE_BINARY_VECTOR        2
+
+/* header entries */
+#define HYPRE_BINARY_H_MAGIC       0
+#define HYPRE_BINARY_H_VERSION     1
+#define HYPRE_BINARY_H_BYTE_ORDER  2
+#define HYPRE_BINARY_H_OBJECT      3
+#define HYPRE_BINARY_H_INT_SIZE    4
+#define HYPRE_BINARY_H_VALUE_SIZE  5
+#define HYPRE_BINARY_H_COMPLEX     6
+#define HYPRE_BINARY_H_NUM_ROWS    7
+#define HYPRE_BINARY_H_NUM_COLS    8
+#define HYPRE_BINARY_H_BASE_I      9
+#define HYPRE_BINARY_H_BASE_J      10
+#define HYPRE_BINARY_H_NUM_PARTS   11
+#define HYPRE_BINARY_HEADER_SIZE   16
+
+/* part table entries */
+#define HYPRE_BINARY_P_FIRST_ROW   0
+#define HYPRE_BINARY_P_NUM_ROWS    1
+#define HYPRE_BINARY_P_FIRST_COL   2
+#define HYPRE_BINARY_P_NUM_COLS    3
+#define HYPRE_BINARY_P_NNZ_DIAG    4
+#define HYPRE_BINARY_P_NNZ_OFFD    5
+#define HYPRE_BINARY_P_COLS_OFFD   6
+#define HYPRE_BINARY_P_OFFSET      7
+#define HYPRE_BINARY_PART_SIZE     8
+
+/* arrays of a matrix section */
+#define HYPRE_BINARY_DIAG_I        0
+#define HYPRE_BINARY_OFFD_I        1
+#define HYPRE_BINARY_DIAG_J        2
+#define HYPRE_BINARY_OFFD_J        3
+#define HYPRE_BINARY_COL_MAP       4
+#define HYPRE_BINARY_DIAG_DATA     5
+#define HYPRE_BINARY_OFFD_DATA     6
+#define HYPRE_BINARY_NUM_ARRAYS    7
+
+#define HYPRE_BINARY_CHUNK         4096
+
+static const char hypre_binary_magic[8] = {'H', 'Y', 'P', 'R', 'E', 'B', 'I', 'N'};
+
+/*--------------------------------------------------------------------------
+ * Size in bytes of n items of the given size, padded to eight bytes
+ *--------------------------------------------------------------------------*/
+
+static hypre_longint
+hypre_BinaryPaddedSize( hypre_longint n,
+                        size_t        size )
+{
+   return (hypre_longint) (((size_t) n * size + 7) & ~((size_t) 7));
+}
+
+/*--------------------------------------------------------------------------
+ * Offsets of the arrays of a section (relative to the section) and the
+ * size of the section, from the entries of the part table
+ *--------------------------------------------------------------------------*/
+
+static hypre_longint
+hypre_BinarySectionLayout( HYPRE_Int      object,
+                           hypre_longint *part,
+                           hypre_longint *offsets )
+{
+   hypre_longint num_rows = part[HYPRE_BINARY_P_NUM_ROWS];
+   hypre_longint size = 0;
+
+   if (object == HYPRE_BINARY_VECTOR)
+   {
+      return hypre_BinaryPaddedSize(num_rows, sizeof(HYPRE_Complex));
+   }
+
+   offsets[HYPRE_BINARY_DIAG_I]    = size;
+   size += hypre_BinaryPaddedSize(num_rows + 1, sizeof(hypre_longint));
+   offsets[HYPRE_BINARY_OFFD_I]    = size;
+   size += hypre_BinaryPaddedSize(num_rows + 1, sizeof(hypre_longint));
+   offsets[HYPRE_BINARY_DIAG_J]    = size;
+   size += hypre_BinaryPaddedSize(part[HYPRE_BINARY_P_NNZ_DIAG], sizeof(hypre_int));
+   offsets[HYPRE_BINARY_OFFD_J]    = size;
+   size += hypre_BinaryPaddedSize(part[HYPRE_BINARY_P_NNZ_OFFD], sizeof(hypre_int));
+   offsets[HYPRE_BINARY_COL_MAP]   = size;
+   size += hypre_BinaryPaddedSize(part[HYPRE_BINARY_P_COLS_OFFD], sizeof(hypre_longint));
+   offsets[HYPRE_BINARY_DIAG_DATA] = size;
+   size += hypre_BinaryPaddedSize(part[HYPRE_BINARY_P_NNZ_DIAG], sizeof(HYPRE_Complex));
+   offsets[HYPRE_BINARY_OFFD_DATA] = size;
+   size += hypre_BinaryPaddedSize(part[HYPRE_BINARY_P_NNZ_OFFD], sizeof(HYPRE_Complex));
+
+   return size;
+}
+
+/*--------------------------------------------------------------------------
+ * Writes n items of the given size followed by zeros up to eight bytes.
+ *
+ * The helpers below return 1 if reading or writing failed and 0 otherwise
+ * (errors are also set in hypre_error_flag).  The print and read routines
+ * keep this local status and reduce it over comm, so that all processors
+ * take the same path through the collective calls, also when an error was
+ * set before.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinaryWrite( FILE          *fp,
+                   const void    *data,
+                   size_t         size,
+                   hypre_longint  n )
+{
+   const char pad[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+   size_t     nbytes = (size_t) n * size;
+
+   if ( (n > 0 && fwrite(data, size, (size_t) n, fp) != (size_t) n) ||
+        fwrite(pad, 1, (size_t) hypre_BinaryPaddedSize(n, size) - nbytes, fp) !=
+        (size_t) hypre_BinaryPaddedSize(n, size) - nbytes )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error writing binary file\n");
+      return 1;
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * Writes an array of HYPRE_Int (shift added) or HYPRE_BigInt as hypre_int
+ * (width 4) or hypre_longint (width 8)
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinaryWriteInts( FILE               *fp,
+                       const HYPRE_Int    *ints,
+                       const HYPRE_BigInt *big_ints,
+                       hypre_longint       shift,
+                       HYPRE_Int           width,
+                       hypre_longint       n )
+{
+   hypre_longint buffer[HYPRE_BINARY_CHUNK];
+   hypre_int    *ibuffer = (hypre_int *) buffer;
+   hypre_longint i, k, len;
+   const char    pad[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+
+   for (k = 0; k < n; k += HYPRE_BINARY_CHUNK)
+   {
+      len = hypre_min(HYPRE_BINARY_CHUNK, n - k);
+      for (i = 0; i < len; i++)
+      {
+         hypre_longint value = ints ? (hypre_longint) ints[k + i] + shift :
+                               (hypre_longint) big_ints[k + i] + shift;
+         if (width == 4)
+         {
+            ibuffer[i] = (hypre_int) value;
+         }
+         else
+         {
+            buffer[i] = value;
+         }
+      }
+      if (fwrite(buffer, (size_t) width, (size_t) len, fp) != (size_t) len)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error writing binary file\n");
+         return 1;
+      }
+   }
+   len = hypre_BinaryPaddedSize(n, (size_t) width) - n * width;
+   if (len > 0 && fwrite(pad, 1, (size_t) len, fp) != (size_t) len)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error writing binary file\n");
+      return 1;
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * Moves to the given offset from the beginning of the file.  Unlike fseek,
+ * which takes a long, works for offsets beyond 2 GB on platforms with a
+ * 32-bit long.  Returns 0 on success.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinarySeek( FILE          *fp,
+                  hypre_longint  offset )
+{
+#if defined(_WIN32)
+   return _fseeki64(fp, (__int64) offset, SEEK_SET) != 0;
+#else
+   if ((hypre_longint) (off_t) offset != offset)
+   {
+      return 1;
+   }
+   return fseeko(fp, (off_t) offset, SEEK_SET) != 0;
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * Reads n items of the given size at the given offset
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinaryRead( FILE          *fp,
+                  hypre_longint  offset,
+                  void          *data,
+                  size_t         size,
+                  hypre_longint  n )
+{
+   if (n <= 0)
+   {
+      return 0;
+   }
+
+   if ( hypre_BinarySeek(fp, offset) ||
+        fread(data, size, (size_t) n, fp) != (size_t) n )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error reading binary file\n");
+      return 1;
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * Reads n hypre_int at the given offset into HYPRE_Int
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinaryReadInts( FILE          *fp,
+                      hypre_longint  offset,
+                      HYPRE_Int     *ints,
+                      hypre_longint  n )
+{
+   hypre_int     buffer[HYPRE_BINARY_CHUNK];
+   hypre_longint i, k, len;
+
+   for (k = 0; k < n; k += HYPRE_BINARY_CHUNK)
+   {
+      len = hypre_min(HYPRE_BINARY_CHUNK, n - k);
+      if (hypre_BinaryRead(fp, offset + k * (hypre_longint) sizeof(hypre_int), buffer,
+                           sizeof(hypre_int), len))
+      {
+         return 1;
+      }
+      for (i = 0; i < len; i++)
+      {
+         ints[k + i] = (HYPRE_Int) buffer[i];
+      }
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * Collective.  Returns nonzero on all processors if ierr is nonzero on any
+ * of them.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinaryCheck( MPI_Comm    comm,
+                   HYPRE_Int   ierr,
+                   const char *msg )
+{
+   HYPRE_Int  all_ierr;
+
+   ierr = (ierr != 0);
+   hypre_MPI_Allreduce(&ierr, &all_ierr, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   if (all_ierr && !ierr)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, msg);
+   }
+
+   return all_ierr;
+}
+
+/*--------------------------------------------------------------------------
+ * Writes the header and the part table (processor 0) and returns the
+ * offset of the section of this processor in *offset_ptr.  Collective;
+ * returns 1 on all processors if the file could not be written.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinaryWriteHeader( MPI_Comm       comm,
+                         const char    *filename,
+                         hypre_longint *header,
+                         hypre_longint *part,
+                         HYPRE_Int      object,
+                         hypre_longint *offset_ptr )
+{
+   hypre_longint *table = NULL;
+   hypre_longint  offsets[HYPRE_BINARY_NUM_ARRAYS];
+   hypre_longint  size, end;
+   HYPRE_Int      num_procs, my_id, ok = 1, all_ok;
+   FILE          *fp;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   memcpy(&header[HYPRE_BINARY_H_MAGIC], hypre_binary_magic, sizeof(hypre_longint));
+   header[HYPRE_BINARY_H_VERSION]    = HYPRE_BINARY_VERSION;
+   header[HYPRE_BINARY_H_BYTE_ORDER] = HYPRE_BINARY_BYTE_ORDER;
+   header[HYPRE_BINARY_H_OBJECT]     = object;
+   header[HYPRE_BINARY_H_INT_SIZE]   = sizeof(hypre_longint);
+   header[HYPRE_BINARY_H_VALUE_SIZE] = sizeof(HYPRE_Complex);
+#ifdef HYPRE_COMPLEX
+   header[HYPRE_BINARY_H_COMPLEX]    = 1;
+#else
+   header[HYPRE_BINARY_H_COMPLEX]    = 0;
+#endif
+   header[HYPRE_BINARY_H_NUM_PARTS]  = num_procs;
+
+   /* the sections follow the part table in the order of the processors */
+   size = hypre_BinarySectionLayout(object, part, offsets);
+   hypre_MPI_Scan(&size, &end, 1, hypre_MPI_LONG, hypre_MPI_SUM, comm);
+   *offset_ptr = (hypre_longint) (HYPRE_BINARY_HEADER_SIZE + HYPRE_BINARY_PART_SIZE * num_procs) *
+                 (hypre_longint) sizeof(hypre_longint) + end - size;
+   part[HYPRE_BINARY_P_OFFSET] = *offset_ptr;
+
+   if (my_id == 0)
+   {
+      table = hypre_TAlloc(hypre_longint, HYPRE_BINARY_PART_SIZE * num_procs, HYPRE_MEMORY_HOST);
+   }
+   hypre_MPI_Gather(part, HYPRE_BINARY_PART_SIZE, hypre_MPI_LONG,
+                    table, HYPRE_BINARY_PART_SIZE, hypre_MPI_LONG, 0, comm);
+
+   if (my_id == 0)
+   {
+      if ((fp = fopen(filename, "wb")) == NULL)
+      {
+         ok = 0;
+      }
+      else
+      {
+         if (fwrite(header, sizeof(hypre_longint), HYPRE_BINARY_HEADER_SIZE, fp) !=
+             HYPRE_BINARY_HEADER_SIZE ||
+             fwrite(table, sizeof(hypre_longint), (size_t) (HYPRE_BINARY_PART_SIZE * num_procs), fp) !=
+             (size_t) (HYPRE_BINARY_PART_SIZE * num_procs))
+         {
+            ok = 0;
+         }
+         fclose(fp);
+      }
+      hypre_TFree(table, HYPRE_MEMORY_HOST);
+   }
+
+   /* the file exists before the other processors open it */
+   hypre_MPI_Allreduce(&ok, &all_ok, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+   if (!all_ok)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't write binary file\n");
+      return 1;
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * Reads and checks the header and the part table of a binary file; the
+ * table is returned in *table_ptr
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinaryReadHeader( FILE           *fp,
+                        HYPRE_Int       object,
+                        hypre_longint  *header,
+                        hypre_longint **table_ptr )
+{
+   hypre_longint *table;
+   hypre_longint  num_parts;
+
+   *table_ptr = NULL;
+   if (fread(header, sizeof(hypre_longint), HYPRE_BINARY_HEADER_SIZE, fp) !=
+       HYPRE_BINARY_HEADER_SIZE)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error reading binary file header\n");
+      return 1;
+   }
+   if ( memcmp(&header[HYPRE_BINARY_H_MAGIC], hypre_binary_magic, sizeof(hypre_longint)) ||
+        header[HYPRE_BINARY_H_VERSION]    != HYPRE_BINARY_VERSION ||
+        header[HYPRE_BINARY_H_BYTE_ORDER] != HYPRE_BINARY_BYTE_ORDER ||
+        header[HYPRE_BINARY_H_OBJECT]     != object )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: not a binary hypre file of this kind\n");
+      return 1;
+   }
+#ifdef HYPRE_COMPLEX
+   if (header[HYPRE_BINARY_H_COMPLEX] != 1 ||
+#else
+   if (header[HYPRE_BINARY_H_COMPLEX] != 0 ||
+#endif
+       header[HYPRE_BINARY_H_INT_SIZE]   != (hypre_longint) sizeof(hypre_longint) ||
+       header[HYPRE_BINARY_H_VALUE_SIZE] != (hypre_longint) sizeof(HYPRE_Complex))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: binary file written with other data types\n");
+      return 1;
+   }
+
+   num_parts = header[HYPRE_BINARY_H_NUM_PARTS];
+   table = hypre_TAlloc(hypre_longint, HYPRE_BINARY_PART_SIZE * num_parts, HYPRE_MEMORY_HOST);
+   if (fread(table, sizeof(hypre_longint), (size_t) (HYPRE_BINARY_PART_SIZE * num_parts), fp) !=
+       (size_t) (HYPRE_BINARY_PART_SIZE * num_parts))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error reading binary file part table\n");
+      hypre_TFree(table, HYPRE_MEMORY_HOST);
+      return 1;
+   }
+   *table_ptr = table;
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * Row and column partitionings for reading a file with num_parts parts:
+ * the partitioning of the file if it has one part per processor, NULL
+ * (the default partitioning) otherwise
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BinaryPartitioning( MPI_Comm        comm,
+                          hypre_longint  *header,
+                          hypre_longint  *table,
+                          HYPRE_Int       col_offset,
+                          HYPRE_BigInt  **starts_ptr )
+{
+   hypre_longint *part;
+   HYPRE_BigInt  *starts = NULL;
+   HYPRE_Int      num_procs, my_id;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   if (header[HYPRE_BINARY_H_NUM_PARTS] == num_procs)
+   {
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+      part = table + HYPRE_BINARY_PART_SIZE * my_id;
+      starts = hypre_CTAlloc(HYPRE_BigInt, 2, HYPRE_MEMORY_HOST);
+      starts[0] = (HYPRE_BigInt) part[HYPRE_BINARY_P_FIRST_ROW + col_offset];
+      starts[1] = starts[0] + (HYPRE_BigInt) part[HYPRE_BINARY_P_NUM_ROWS + col_offset];
+#else
+      HYPRE_Int p;
+
+      starts = hypre_CTAlloc(HYPRE_BigInt, num_procs + 1, HYPRE_MEMORY_HOST);
+      for (p = 0; p < num_procs; p++)
+      {
+         part = table + HYPRE_BINARY_PART_SIZE * p;
+         starts[p]   = (HYPRE_BigInt) part[HYPRE_BINARY_P_FIRST_ROW + col_offset];
+         starts[p+1] = starts[p] + (HYPRE_BigInt) part[HYPRE_BINARY_P_NUM_ROWS + col_offset];
+      }
+#endif
+   }
+   *starts_ptr = starts;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixPrintBinary
+ *
+ * Writes the matrix to a single binary file.  The row and column indices
+ * are stored with base 0; base_i and base_j are kept in the header (see
+ * HYPRE_IJMatrixPrintBinary).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixPrintBinary( hypre_ParCSRMatrix *matrix,
+                               HYPRE_BigInt        base_i,
+                               HYPRE_BigInt        base_j,
+                               const char         *filename )
+{
+   MPI_Comm            comm;
+   hypre_ParCSRMatrix *host_matrix = NULL;
+   hypre_CSRMatrix    *diag, *offd;
+   hypre_longint       header[HYPRE_BINARY_HEADER_SIZE];
+   hypre_longint       part[HYPRE_BINARY_PART_SIZE];
+   hypre_longint       offsets[HYPRE_BINARY_NUM_ARRAYS];
+   hypre_longint       offset;
+   HYPRE_Int           num_rows;
+   HYPRE_Int           ierr = 0;
+   FILE               *fp;
+
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (!filename)
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   if ( hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(matrix)) != hypre_MEMORY_HOST )
+   {
+      host_matrix = hypre_ParCSRMatrixClone_v2(matrix, 1, HYPRE_MEMORY_HOST);
+      matrix = host_matrix;
+   }
+
+   comm     = hypre_ParCSRMatrixComm(matrix);
+   diag     = hypre_ParCSRMatrixDiag(matrix);
+   offd     = hypre_ParCSRMatrixOffd(matrix);
+   num_rows = hypre_CSRMatrixNumRows(diag);
+
+   if ( (hypre_CSRMatrixNumNonzeros(diag) && !hypre_CSRMatrixData(diag)) ||
+        (hypre_CSRMatrixNumNonzeros(offd) && !hypre_CSRMatrixData(offd)) )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Binary output needs the matrix values\n");
+      ierr = 1;
+   }
+   if (hypre_BinaryCheck(comm, ierr, "Binary output needs the matrix values\n"))
+   {
+      hypre_ParCSRMatrixDestroy(host_matrix);
+      return hypre_error_flag;
+   }
+
+   header[HYPRE_BINARY_H_NUM_ROWS] = hypre_ParCSRMatrixGlobalNumRows(matrix);
+   header[HYPRE_BINARY_H_NUM_COLS] = hypre_ParCSRMatrixGlobalNumCols(matrix);
+   header[HYPRE_BINARY_H_BASE_I]   = base_i;
+   header[HYPRE_BINARY_H_BASE_J]   = base_j;
+   header[12] = header[13] = header[14] = header[15] = 0;
+
+   part[HYPRE_BINARY_P_FIRST_ROW] = hypre_ParCSRMatrixFirstRowIndex(matrix);
+   part[HYPRE_BINARY_P_NUM_ROWS]  = num_rows;
+   part[HYPRE_BINARY_P_FIRST_COL] = hypre_ParCSRMatrixFirstColDiag(matrix);
+   part[HYPRE_BINARY_P_NUM_COLS]  = hypre_CSRMatrixNumCols(diag);
+   part[HYPRE_BINARY_P_NNZ_DIAG]  = hypre_CSRMatrixNumNonzeros(diag);
+   part[HYPRE_BINARY_P_NNZ_OFFD]  = hypre_CSRMatrixNumNonzeros(offd);
+   part[HYPRE_BINARY_P_COLS_OFFD] = hypre_CSRMatrixNumCols(offd);
+
+   if (hypre_BinaryWriteHeader(comm, filename, header, part, HYPRE_BINARY_MATRIX, &offset))
+   {
+      hypre_ParCSRMatrixDestroy(host_matrix);
+      return hypre_error_flag;
+   }
+
+   hypre_BinarySectionLayout(HYPRE_BINARY_MATRIX, part, offsets);
+   if ((fp = fopen(filename, "r+b")) == NULL || hypre_BinarySeek(fp, offset))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open binary file for writing\n");
+      ierr = 1;
+   }
+   else
+   {
+      ierr = ( hypre_BinaryWriteInts(fp, hypre_CSRMatrixI(diag), NULL, 0, 8, num_rows + 1) ||
+               hypre_BinaryWriteInts(fp, hypre_CSRMatrixI(offd), NULL, 0, 8, num_rows + 1) ||
+               hypre_BinaryWriteInts(fp, hypre_CSRMatrixJ(diag), NULL, 0, 4,
+                                     part[HYPRE_BINARY_P_NNZ_DIAG]) ||
+               hypre_BinaryWriteInts(fp, hypre_CSRMatrixJ(offd), NULL, 0, 4,
+                                     part[HYPRE_BINARY_P_NNZ_OFFD]) ||
+               hypre_BinaryWriteInts(fp, NULL, hypre_ParCSRMatrixColMapOffd(matrix), 0, 8,
+                                     part[HYPRE_BINARY_P_COLS_OFFD]) ||
+               hypre_BinaryWrite(fp, hypre_CSRMatrixData(diag), sizeof(HYPRE_Complex),
+                                 part[HYPRE_BINARY_P_NNZ_DIAG]) ||
+               hypre_BinaryWrite(fp, hypre_CSRMatrixData(offd), sizeof(HYPRE_Complex),
+                                 part[HYPRE_BINARY_P_NNZ_OFFD]) );
+   }
+   if (fp)
+   {
+      fclose(fp);
+   }
+
+   /* the file is complete when all processors return */
+   hypre_BinaryCheck(comm, ierr, "Error writing binary file on another processor\n");
+   hypre_ParCSRMatrixDestroy(host_matrix);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixReadBinary
+ *
+ * Reads a matrix written by hypre_ParCSRMatrixPrintBinary.  If the file
+ * was written by as many processors as comm has, the matrix gets the same
+ * partitioning; otherwise the rows and columns are distributed evenly.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixReadBinary( MPI_Comm             comm,
+                              const char          *filename,
+                              HYPRE_BigInt        *base_i_ptr,
+                              HYPRE_BigInt        *base_j_ptr,
+                              hypre_ParCSRMatrix **matrix_ptr )
+{
+   hypre_ParCSRMatrix *matrix;
+   hypre_CSRMatrix    *diag, *offd;
+   hypre_longint       header[HYPRE_BINARY_HEADER_SIZE];
+   hypre_longint       offsets[HYPRE_BINARY_NUM_ARRAYS];
+   hypre_longint      *table = NULL, *part;
+   hypre_longint      *part_i = NULL, *part_col_map = NULL;
+   HYPRE_BigInt       *row_starts, *col_starts;
+   HYPRE_BigInt        first_row, first_col, last_col, part_first_row, part_first_col;
+   HYPRE_BigInt        J;
+   HYPRE_BigInt       *big_j = NULL, *offd_big_j = NULL, *col_map_offd;
+   HYPRE_Complex      *values = NULL;
+   HYPRE_Int          *row_ptr, *part_j = NULL;
+   HYPRE_Int          *diag_i, *diag_j, *offd_i, *offd_j;
+   HYPRE_Complex      *diag_data, *offd_data, value;
+   HYPRE_Int           num_rows, num_parts, p, a, b, i, j, k, r, nnz, pos;
+   HYPRE_Int           num_cols_offd, diag_cnt, offd_cnt;
+   hypre_longint       d0, d1, o0, o1, len;
+   HYPRE_Complex      *part_data = NULL;
+   HYPRE_Int           ierr = 0;
+   FILE               *fp;
+
+   *matrix_ptr = NULL;
+   if ((fp = fopen(filename, "rb")) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open binary file\n");
+      ierr = 1;
+   }
+   else
+   {
+      ierr = hypre_BinaryReadHeader(fp, HYPRE_BINARY_MATRIX, header, &table);
+   }
+   if (hypre_BinaryCheck(comm, ierr, "Error reading binary file on another processor\n"))
+   {
+      if (fp)
+      {
+         fclose(fp);
+      }
+      hypre_TFree(table, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+   num_parts = (HYPRE_Int) header[HYPRE_BINARY_H_NUM_PARTS];
+
+   hypre_BinaryPartitioning(comm, header, table, 0, &row_starts);
+   hypre_BinaryPartitioning(comm, header, table, 2, &col_starts);
+   if (row_starts && header[HYPRE_BINARY_H_NUM_ROWS] == header[HYPRE_BINARY_H_NUM_COLS])
+   {
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+      k = 2;
+#else
+      hypre_MPI_Comm_size(comm, &k);
+      k++;
+#endif
+      for (i = 0; i < k; i++)
+      {
+         if (row_starts[i] != col_starts[i])
+         {
+            break;
+         }
+      }
+      if (i == k)
+      {
+         hypre_TFree(col_starts, HYPRE_MEMORY_HOST);
+         col_starts = row_starts;
+      }
+   }
+   matrix = hypre_ParCSRMatrixCreate(comm, (HYPRE_BigInt) header[HYPRE_BINARY_H_NUM_ROWS],
+                                     (HYPRE_BigInt) header[HYPRE_BINARY_H_NUM_COLS],
+                                     row_starts, col_starts, 0, 0, 0);
+   diag      = hypre_ParCSRMatrixDiag(matrix);
+   offd      = hypre_ParCSRMatrixOffd(matrix);
+   num_rows  = hypre_CSRMatrixNumRows(diag);
+   first_row = hypre_ParCSRMatrixFirstRowIndex(matrix);
+   first_col = hypre_ParCSRMatrixFirstColDiag(matrix);
+   last_col  = first_col + (HYPRE_BigInt) hypre_CSRMatrixNumCols(diag) - 1;
+
+   /*-----------------------------------------------------------------------
+    * Number of entries of the local rows, from the parts holding them
+    *-----------------------------------------------------------------------*/
+
+   row_ptr = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   for (p = 0; p < num_parts && !ierr; p++)
+   {
+      part = table + HYPRE_BINARY_PART_SIZE * p;
+      part_first_row = (HYPRE_BigInt) part[HYPRE_BINARY_P_FIRST_ROW];
+      a = (HYPRE_Int) (hypre_max(first_row, part_first_row) - part_first_row);
+      b = (HYPRE_Int) (hypre_min(first_row + num_rows,
+                                 part_first_row + (HYPRE_BigInt) part[HYPRE_BINARY_P_NUM_ROWS]) -
+                       part_first_row);
+      if (a >= b)
+      {
+         continue;
+      }
+      hypre_BinarySectionLayout(HYPRE_BINARY_MATRIX, part, offsets);
+      part_i = hypre_TReAlloc(part_i, hypre_longint, 2 * (b - a + 1), HYPRE_MEMORY_HOST);
+      len = (hypre_longint) sizeof(hypre_longint);
+      ierr = ( hypre_BinaryRead(fp, part[HYPRE_BINARY_P_OFFSET] + offsets[HYPRE_BINARY_DIAG_I] +
+                                a * len, part_i, sizeof(hypre_longint), b - a + 1) ||
+               hypre_BinaryRead(fp, part[HYPRE_BINARY_P_OFFSET] + offsets[HYPRE_BINARY_OFFD_I] +
+                                a * len, part_i + (b - a + 1), sizeof(hypre_longint), b - a + 1) );
+      if (ierr)
+      {
+         break;
+      }
+      r = (HYPRE_Int) (part_first_row + a - first_row);
+      for (i = 0; i < b - a; i++)
+      {
+         row_ptr[r + i + 1] = (HYPRE_Int) (part_i[i + 1] - part_i[i] +
+                                           part_i[b - a + 1 + i + 1] - part_i[b - a + 1 + i]);
+      }
+   }
+   for (i = 0; i < num_rows; i++)
+   {
+      row_ptr[i + 1] += row_ptr[i];
+   }
+   nnz = row_ptr[num_rows];
+
+   /*-----------------------------------------------------------------------
+    * Entries of the local rows with global column indices
+    *-----------------------------------------------------------------------*/
+
+   big_j  = hypre_TAlloc(HYPRE_BigInt, nnz, HYPRE_MEMORY_HOST);
+   values = hypre_TAlloc(HYPRE_Complex, nnz, HYPRE_MEMORY_HOST);
+   for (p = 0; p < num_parts && !ierr; p++)
+   {
+      part = table + HYPRE_BINARY_PART_SIZE * p;
+      part_first_row = (HYPRE_BigInt) part[HYPRE_BINARY_P_FIRST_ROW];
+      part_first_col = (HYPRE_BigInt) part[HYPRE_BINARY_P_FIRST_COL];
+      a = (HYPRE_Int) (hypre_max(first_row, part_first_row) - part_first_row);
+      b = (HYPRE_Int) (hypre_min(first_row + num_rows,
+                                 part_first_row + (HYPRE_BigInt) part[HYPRE_BINARY_P_NUM_ROWS]) -
+                       part_first_row);
+      if (a >= b)
+      {
+         continue;
+      }
+      hypre_BinarySectionLayout(HYPRE_BINARY_MATRIX, part, offsets);
+      part_i = hypre_TReAlloc(part_i, hypre_longint, 2 * (b - a + 1), HYPRE_MEMORY_HOST);
+      len = (hypre_longint) sizeof(hypre_longint);
+      ierr = ( hypre_BinaryRead(fp, part[HYPRE_BINARY_P_OFFSET] + offsets[HYPRE_BINARY_DIAG_I] +
+                                a * len, part_i, sizeof(hypre_longint), b - a + 1) ||
+               hypre_BinaryRead(fp, part[HYPRE_BINARY_P_OFFSET] + offsets[HYPRE_BINARY_OFFD_I] +
+                                a * len, part_i + (b - a + 1), sizeof(hypre_longint), b - a + 1) );
+      if (ierr)
+      {
+         break;
+      }
+      d0 = part_i[0];
+      d1 = part_i[b - a];
+      o0 = part_i[b - a + 1];
+      o1 = part_i[2 * (b - a) + 1];
+
+      part_j = hypre_TReAlloc(part_j, HYPRE_Int, hypre_max(d1 - d0, o1 - o0), HYPRE_MEMORY_HOST);
+      part_data = hypre_TReAlloc(part_data, HYPRE_Complex, hypre_max(d1 - d0, o1 - o0),
+                                 HYPRE_MEMORY_HOST);
+      part_col_map = hypre_TReAlloc(part_col_map, hypre_longint,
+                                    part[HYPRE_BINARY_P_COLS_OFFD], HYPRE_MEMORY_HOST);
+      ierr = hypre_BinaryRead(fp, part[HYPRE_BINARY_P_OFFSET] + offsets[HYPRE_BINARY_COL_MAP],
+                              part_col_map, sizeof(hypre_longint), part[HYPRE_BINARY_P_COLS_OFFD]);
+
+      /* diag entries first, then offd entries of each row; the column
+       * indices and values of rows a to b are contiguous in the file */
+      r = (HYPRE_Int) (part_first_row + a - first_row);
+      ierr = ( ierr ||
+               hypre_BinaryReadInts(fp, part[HYPRE_BINARY_P_OFFSET] + offsets[HYPRE_BINARY_DIAG_J] +
+                                    d0 * (hypre_longint) sizeof(hypre_int), part_j, d1 - d0) ||
+               hypre_BinaryRead(fp, part[HYPRE_BINARY_P_OFFSET] + offsets[HYPRE_BINARY_DIAG_DATA] +
+                                d0 * (hypre_longint) sizeof(HYPRE_Complex),
+                                part_data, sizeof(HYPRE_Complex), d1 - d0) );
+      if (ierr)
+      {
+         break;
+      }
+      for (i = 0; i < b - a; i++)
+      {
+         pos = row_ptr[r + i];
+         for (k = (HYPRE_Int) (part_i[i] - d0); k < (HYPRE_Int) (part_i[i + 1] - d0); k++)
+         {
+            values[pos]  = part_data[k];
+            big_j[pos++] = part_first_col + (HYPRE_BigInt) part_j[k];
+         }
+      }
+      ierr = ( hypre_BinaryReadInts(fp, part[HYPRE_BINARY_P_OFFSET] + offsets[HYPRE_BINARY_OFFD_J] +
+                                    o0 * (hypre_longint) sizeof(hypre_int), part_j, o1 - o0) ||
+               hypre_BinaryRead(fp, part[HYPRE_BINARY_P_OFFSET] + offsets[HYPRE_BINARY_OFFD_DATA] +
+                                o0 * (hypre_longint) sizeof(HYPRE_Complex),
+                                part_data, sizeof(HYPRE_Complex), o1 - o0) );
+      if (ierr)
+      {
+         break;
+      }
+      for (i = 0; i < b - a; i++)
+      {
+         pos = row_ptr[r + i] + (HYPRE_Int) (part_i[i + 1] - part_i[i]);
+         for (k = (HYPRE_Int) (part_i[b - a + 1 + i] - o0);
+              k < (HYPRE_Int) (part_i[b - a + 2 + i] - o0); k++)
+         {
+            values[pos]  = part_data[k];
+            big_j[pos++] = (HYPRE_BigInt) part_col_map[part_j[k]];
+         }
+      }
+   }
+   fclose(fp);
+   hypre_TFree(table, HYPRE_MEMORY_HOST);
+   hypre_TFree(part_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(part_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(part_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(part_col_map, HYPRE_MEMORY_HOST);
+
+   if (hypre_BinaryCheck(comm, ierr, "Error reading binary file on another processor\n"))
+   {
+      hypre_TFree(row_ptr, HYPRE_MEMORY_HOST);
+      hypre_TFree(big_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(values, HYPRE_MEMORY_HOST);
+      hypre_ParCSRMatrixDestroy(matrix);
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Split the local rows into diag and offd
+    *-----------------------------------------------------------------------*/
+
+   diag_cnt = 0;
+   for (k = 0; k < nnz; k++)
+   {
+      if (big_j[k] >= first_col && big_j[k] <= last_col)
+      {
+         diag_cnt++;
+      }
+   }
+   offd_cnt = nnz - diag_cnt;
+
+   num_cols_offd = 0;
+   if (offd_cnt)
+   {
+      offd_big_j = hypre_TAlloc(HYPRE_BigInt, offd_cnt, HYPRE_MEMORY_HOST);
+      for (k = 0, j = 0; k < nnz; k++)
+      {
+         if (big_j[k] < first_col || big_j[k] > last_col)
+         {
+            offd_big_j[j++] = big_j[k];
+         }
+      }
+      hypre_BigQsort0(offd_big_j, 0, offd_cnt - 1);
+      for (k = 1, num_cols_offd = 1; k < offd_cnt; k++)
+      {
+         if (offd_big_j[k] > offd_big_j[num_cols_offd - 1])
+         {
+            offd_big_j[num_cols_offd++] = offd_big_j[k];
+         }
+      }
+   }
+
+   hypre_CSRMatrixNumNonzeros(diag) = diag_cnt;
+   hypre_CSRMatrixNumNonzeros(offd) = offd_cnt;
+   hypre_CSRMatrixNumCols(offd)     = num_cols_offd;
+   hypre_ParCSRMatrixInitialize_v2(matrix, HYPRE_MEMORY_HOST);
+
+   diag_i       = hypre_CSRMatrixI(diag);
+   diag_j       = hypre_CSRMatrixJ(diag);
+   diag_data    = hypre_CSRMatrixData(diag);
+   offd_i       = hypre_CSRMatrixI(offd);
+   offd_j       = hypre_CSRMatrixJ(offd);
+   offd_data    = hypre_CSRMatrixData(offd);
+   col_map_offd = hypre_ParCSRMatrixColMapOffd(matrix);
+   for (k = 0; k < num_cols_offd; k++)
+   {
+      col_map_offd[k] = offd_big_j[k];
+   }
+   hypre_TFree(offd_big_j, HYPRE_MEMORY_HOST);
+
+   diag_cnt = offd_cnt = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      for (k = row_ptr[i]; k < row_ptr[i + 1]; k++)
+      {
+         J = big_j[k];
+         if (J >= first_col && J <= last_col)
+         {
+            diag_j[diag_cnt]      = (HYPRE_Int) (J - first_col);
+            diag_data[diag_cnt++] = values[k];
+         }
+         else
+         {
+            offd_j[offd_cnt]      = hypre_BigBinarySearch(col_map_offd, J, num_cols_offd);
+            offd_data[offd_cnt++] = values[k];
+         }
+      }
+      diag_i[i + 1] = diag_cnt;
+      offd_i[i + 1] = offd_cnt;
+
+      /* diagonal entry first */
+      for (k = diag_i[i]; k < diag_i[i + 1]; k++)
+      {
+         if (first_col + (HYPRE_BigInt) diag_j[k] == first_row + (HYPRE_BigInt) i)
+         {
+            j     = diag_j[k];
+            value = diag_data[k];
+            diag_j[k]    = diag_j[diag_i[i]];
+            diag_data[k] = diag_data[diag_i[i]];
+            diag_j[diag_i[i]]    = j;
+            diag_data[diag_i[i]] = value;
+            break;
+         }
+      }
+   }
+   hypre_TFree(row_ptr, HYPRE_MEMORY_HOST);
+   hypre_TFree(big_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+
+   if (base_i_ptr)
+   {
+      *base_i_ptr = (HYPRE_BigInt) header[HYPRE_BINARY_H_BASE_I];
+   }
+   if (base_j_ptr)
+   {
+      *base_j_ptr = (HYPRE_BigInt) header[HYPRE_BINARY_H_BASE_J];
+   }
+   *matrix_ptr = matrix;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorPrintBinary
+ *
+ * Writes the vector to a single binary file (see
+ * hypre_ParCSRMatrixPrintBinary)
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorPrintBinary( hypre_ParVector *vector,
+                            HYPRE_BigInt     base_j,
+                            const char      *filename )
+{
+   MPI_Comm         comm;
+   hypre_ParVector *host_vector = NULL;
+   hypre_longint    header[HYPRE_BINARY_HEADER_SIZE];
+   hypre_longint    part[HYPRE_BINARY_PART_SIZE];
+   hypre_longint    offset;
+   HYPRE_Int        ierr = 0;
+   FILE            *fp;
+
+   if (!vector)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (hypre_ParVectorNumVectors(vector) != 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Binary output of multivectors is not supported\n");
+      return hypre_error_flag;
+   }
+   if (!filename)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   if ( hypre_GetActualMemLocation(hypre_ParVectorMemoryLocation(vector)) != hypre_MEMORY_HOST )
+   {
+      host_vector = hypre_ParVectorCloneDeep_v2(vector, HYPRE_MEMORY_HOST);
+      vector = host_vector;
+   }
+   comm = hypre_ParVectorComm(vector);
+
+   header[HYPRE_BINARY_H_NUM_ROWS] = hypre_ParVectorGlobalSize(vector);
+   header[HYPRE_BINARY_H_NUM_COLS] = 1;
+   header[HYPRE_BINARY_H_BASE_I]   = base_j;
+   header[HYPRE_BINARY_H_BASE_J]   = 0;
+   header[12] = header[13] = header[14] = header[15] = 0;
+
+   part[HYPRE_BINARY_P_FIRST_ROW] = hypre_ParVectorFirstIndex(vector);
+   part[HYPRE_BINARY_P_NUM_ROWS]  = hypre_VectorSize(hypre_ParVectorLocalVector(vector));
+   part[HYPRE_BINARY_P_FIRST_COL] = 0;
+   part[HYPRE_BINARY_P_NUM_COLS]  = 1;
+   part[HYPRE_BINARY_P_NNZ_DIAG]  = part[HYPRE_BINARY_P_NUM_ROWS];
+   part[HYPRE_BINARY_P_NNZ_OFFD]  = 0;
+   part[HYPRE_BINARY_P_COLS_OFFD] = 0;
+
+   if (hypre_BinaryWriteHeader(comm, filename, header, part, HYPRE_BINARY_VECTOR, &offset))
+   {
+      hypre_ParVectorDestroy(host_vector);
+      return hypre_error_flag;
+   }
+
+   if ((fp = fopen(filename, "r+b")) == NULL || hypre_BinarySeek(fp, offset))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open binary file for writing\n");
+      ierr = 1;
+   }
+   else
+   {
+      ierr = hypre_BinaryWrite(fp, hypre_VectorData(hypre_ParVectorLocalVector(vector)),
+                               sizeof(HYPRE_Complex), part[HYPRE_BINARY_P_NUM_ROWS]);
+   }
+   if (fp)
+   {
+      fclose(fp);
+   }
+
+   hypre_BinaryCheck(comm, ierr, "Error writing binary file on another processor\n");
+   hypre_ParVectorDestroy(host_vector);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorReadBinary
+ *
+ * Reads a vector written by hypre_ParVectorPrintBinary, with the
+ * partitioning of the file or an even distribution (see
+ * hypre_ParCSRMatrixReadBinary)
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorReadBinary( MPI_Comm          comm,
+                           const char       *filename,
+                           HYPRE_BigInt     *base_j_ptr,
+                           hypre_ParVector **vector_ptr )
+{
+   hypre_ParVector *vector;
+   hypre_longint    header[HYPRE_BINARY_HEADER_SIZE];
+   hypre_longint   *table = NULL, *part;
+   HYPRE_BigInt    *partitioning;
+   HYPRE_BigInt     first_row, part_first_row;
+   HYPRE_Complex   *data;
+   HYPRE_Int        num_rows, num_parts, p, a, b;
+   HYPRE_Int        ierr = 0;
+   FILE            *fp;
+
+   *vector_ptr = NULL;
+   if ((fp = fopen(filename, "rb")) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open binary file\n");
+      ierr = 1;
+   }
+   else
+   {
+      ierr = hypre_BinaryReadHeader(fp, HYPRE_BINARY_VECTOR, header, &table);
+   }
+   if (hypre_BinaryCheck(comm, ierr, "Error reading binary file on another processor\n"))
+   {
+      if (fp)
+      {
+         fclose(fp);
+      }
+      hypre_TFree(table, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+   num_parts = (HYPRE_Int) header[HYPRE_BINARY_H_NUM_PARTS];
+
+   hypre_BinaryPartitioning(comm, header, table, 0, &partitioning);
+   vector = hypre_ParVectorCreate(comm, (HYPRE_BigInt) header[HYPRE_BINARY_H_NUM_ROWS],
+                                  partitioning);
+   hypre_ParVectorInitialize_v2(vector, HYPRE_MEMORY_HOST);
+   first_row = hypre_ParVectorFirstIndex(vector);
+   num_rows  = hypre_VectorSize(hypre_ParVectorLocalVector(vector));
+   data      = hypre_VectorData(hypre_ParVectorLocalVector(vector));
+
+   for (p = 0; p < num_parts && !ierr; p++)
+   {
+      part = table + HYPRE_BINARY_PART_SIZE * p;
+      part_first_row = (HYPRE_BigInt) part[HYPRE_BINARY_P_FIRST_ROW];
+      a = (HYPRE_Int) (hypre_max(first_row, part_first_row) - part_first_row);
+      b = (HYPRE_Int) (hypre_min(first_row + num_rows,
+                                 part_first_row + (HYPRE_BigInt) part[HYPRE_BINARY_P_NUM_ROWS]) -
+                       part_first_row);
+      if (a < b)
+      {
+         ierr = hypre_BinaryRead(fp, part[HYPRE_BINARY_P_OFFSET] +
+                                 a * (hypre_longint) sizeof(HYPRE_Complex),
+                                 data + (part_first_row + a - first_row),
+                                 sizeof(HYPRE_Complex), b - a);
+      }
+   }
+   fclose(fp);
+   hypre_TFree(table, HYPRE_MEMORY_HOST);
+
+   if (hypre_BinaryCheck(comm, ierr, "Error reading binary file on another processor\n"))
+   {
+      hypre_ParVectorDestroy(vector);
+      return hypre_error_flag;
+   }
+
+   if (base_j_ptr)
+   {
+      *base_j_ptr = (HYPRE_BigInt) header[HYPRE_BINARY_H_BASE_I];
+   }
+   *vector_ptr = vector;
+
+   return hypre_error_flag;
+}
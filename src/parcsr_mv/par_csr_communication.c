@@ -7,9 +7,26 @@
 
 #include "_hypre_parcsr_mv.h"
 
+/*--------------------------------------------------------------------------
+ * Adds the messages and bytes sent by a new exchange to the communication
+ * counters of the hypre handle, if these are enabled
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRCommStatsAddSends( HYPRE_Int num_messages,
+                               HYPRE_Int num_bytes )
+{
+   hypre_Handle *handle = hypre_handle();
+
+   if (hypre_HandleCommStats(handle))
+   {
+      hypre_HandleCommNumMessages(handle) += (HYPRE_Real) num_messages;
+      hypre_HandleCommNumBytes(handle)    += (HYPRE_Real) num_bytes;
+   }
+}
+
 /*==========================================================================*/
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 static CommPkgJobType getJobTypeOf(HYPRE_Int job)
 {
    CommPkgJobType job_type = HYPRE_COMM_PKG_JOB_COMPLEX;
@@ -48,6 +65,8 @@ hypre_ParCSRPersistentCommHandleCreate( HYPRE_Int job, hypre_ParCSRCommPkg *comm
    HYPRE_Int i;
    size_t num_bytes_send, num_bytes_recv;
 
+   hypre_MemoryStatsPushCategory(HYPRE_MEMORY_CATEGORY_COMM);
+
    hypre_ParCSRPersistentCommHandle *comm_handle = hypre_CTAlloc(hypre_ParCSRPersistentCommHandle, 1, HYPRE_MEMORY_HOST);
 
    CommPkgJobType job_type = getJobTypeOf(job);
@@ -209,24 +228,45 @@ hypre_ParCSRPersistentCommHandleCreate( HYPRE_Int job, hypre_ParCSRCommPkg *comm
          break;
    } // switch (job_type)
 
+   hypre_ParCSRCommHandleCommPkg(comm_handle)        = comm_pkg;
    hypre_ParCSRCommHandleRecvDataBuffer(comm_handle) = recv_buff;
    hypre_ParCSRCommHandleSendDataBuffer(comm_handle) = send_buff;
    hypre_ParCSRCommHandleNumSendBytes(comm_handle)   = num_bytes_send;
    hypre_ParCSRCommHandleNumRecvBytes(comm_handle)   = num_bytes_recv;
+   hypre_ParCSRCommHandlePersistent(comm_handle)     = job;
+
+   hypre_MemoryStatsPopCategory();
 
    return ( comm_handle );
 }
 
+/*--------------------------------------------------------------------------
+ * Returns the persistent handle of comm_pkg for job, created on first use,
+ * or NULL if persistent communication is turned off or the handle is still
+ * in use by an exchange that has not been waited for.
+ *--------------------------------------------------------------------------*/
 
 hypre_ParCSRPersistentCommHandle*
 hypre_ParCSRCommPkgGetPersistentCommHandle( HYPRE_Int job, hypre_ParCSRCommPkg *comm_pkg )
 {
    CommPkgJobType type = getJobTypeOf(job);
+
+   if (!hypre_HandlePersistentComm(hypre_handle()) ||
+       hypre_ParCSRCommPkgUseNeighborComm(comm_pkg) ||
+       hypre_ParCSRCommPkgNodeAware(comm_pkg))
+   {
+      return NULL;
+   }
+
    if (!comm_pkg->persistent_comm_handles[type])
    {
       /* data is owned by persistent comm handle */
       comm_pkg->persistent_comm_handles[type] = hypre_ParCSRPersistentCommHandleCreate(job, comm_pkg);
    }
+   else if (hypre_ParCSRCommHandleActive(comm_pkg->persistent_comm_handles[type]))
+   {
+      return NULL;
+   }
 
    return comm_pkg->persistent_comm_handles[type];
 }
@@ -234,6 +274,12 @@ hypre_ParCSRCommPkgGetPersistentCommHandle( HYPRE_Int job, hypre_ParCSRCommPkg *
 void
 hypre_ParCSRPersistentCommHandleDestroy( hypre_ParCSRPersistentCommHandle *comm_handle )
 {
+   HYPRE_Int i;
+
+   for (i = 0; i < hypre_ParCSRCommHandleNumRequests(comm_handle); i++)
+   {
+      hypre_MPI_Request_free(&hypre_ParCSRCommHandleRequest(comm_handle, i));
+   }
    hypre_TFree(hypre_ParCSRCommHandleSendDataBuffer(comm_handle), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParCSRCommHandleRecvDataBuffer(comm_handle), HYPRE_MEMORY_HOST);
    hypre_TFree(comm_handle->requests, HYPRE_MEMORY_HOST);
@@ -244,17 +290,24 @@ void hypre_ParCSRPersistentCommHandleStart( hypre_ParCSRPersistentCommHandle *co
                                             HYPRE_MemoryLocation              send_memory_location,
                                             void                             *send_data )
 {
+   hypre_ParCSRCommPkg *comm_pkg;
+
    hypre_ParCSRCommHandleSendData(comm_handle) = send_data;
    hypre_ParCSRCommHandleSendMemoryLocation(comm_handle) = send_memory_location;
+   hypre_ParCSRCommHandleActive(comm_handle) = 1;
 
    if (hypre_ParCSRCommHandleNumRequests(comm_handle) > 0)
    {
-      hypre_TMemcpy( hypre_ParCSRCommHandleSendDataBuffer(comm_handle),
-                     send_data,
-                     char,
-                     hypre_ParCSRCommHandleNumSendBytes(comm_handle),
-                     HYPRE_MEMORY_HOST,
-                     send_memory_location );
+      /* callers may pack directly into the send buffer */
+      if (send_data != hypre_ParCSRCommHandleSendDataBuffer(comm_handle))
+      {
+         hypre_TMemcpy( hypre_ParCSRCommHandleSendDataBuffer(comm_handle),
+                        send_data,
+                        char,
+                        hypre_ParCSRCommHandleNumSendBytes(comm_handle),
+                        HYPRE_MEMORY_HOST,
+                        send_memory_location );
+      }
 
       HYPRE_Int ret = hypre_MPI_Startall(hypre_ParCSRCommHandleNumRequests(comm_handle),
                                          hypre_ParCSRCommHandleRequests(comm_handle));
@@ -263,6 +316,13 @@ void hypre_ParCSRPersistentCommHandleStart( hypre_ParCSRPersistentCommHandle *co
          hypre_error_w_msg(HYPRE_ERROR_GENERIC,"MPI error\n");
          /*hypre_printf("MPI error %d in %s (%s, line %u)\n", ret, __FUNCTION__, __FILE__, __LINE__);*/
       }
+
+      /* even jobs send in the reverse direction of comm_pkg */
+      comm_pkg = hypre_ParCSRCommHandleCommPkg(comm_handle);
+      hypre_ParCSRCommStatsAddSends((hypre_ParCSRCommHandlePersistent(comm_handle) % 2) ?
+                                    hypre_ParCSRCommPkgNumSends(comm_pkg) :
+                                    hypre_ParCSRCommPkgNumRecvs(comm_pkg),
+                                    hypre_ParCSRCommHandleNumSendBytes(comm_handle));
    }
 }
 
@@ -275,6 +335,13 @@ void hypre_ParCSRPersistentCommHandleWait( hypre_ParCSRPersistentCommHandle *com
 
    if (hypre_ParCSRCommHandleNumRequests(comm_handle) > 0)
    {
+      HYPRE_Int  comm_stats = hypre_HandleCommStats(hypre_handle());
+      HYPRE_Real wait_begin = 0.0;
+
+      if (comm_stats)
+      {
+         wait_begin = hypre_MPI_Wtime();
+      }
       HYPRE_Int ret = hypre_MPI_Waitall(hypre_ParCSRCommHandleNumRequests(comm_handle),
                                         hypre_ParCSRCommHandleRequests(comm_handle),
                                         hypre_MPI_STATUSES_IGNORE);
@@ -283,16 +350,25 @@ void hypre_ParCSRPersistentCommHandleWait( hypre_ParCSRPersistentCommHandle *com
          hypre_error_w_msg(HYPRE_ERROR_GENERIC,"MPI error\n");
          /*hypre_printf("MPI error %d in %s (%s, line %u)\n", ret, __FUNCTION__, __FILE__, __LINE__);*/
       }
+      if (comm_stats)
+      {
+         hypre_HandleCommWaitTime(hypre_handle()) += hypre_MPI_Wtime() - wait_begin;
+      }
 
-      hypre_TMemcpy(recv_data,
-                    hypre_ParCSRCommHandleRecvDataBuffer(comm_handle),
-                    char,
-                    hypre_ParCSRCommHandleNumRecvBytes(comm_handle),
-                    recv_memory_location,
-                    HYPRE_MEMORY_HOST);
+      /* callers may unpack directly from the recv buffer */
+      if (recv_data != hypre_ParCSRCommHandleRecvDataBuffer(comm_handle))
+      {
+         hypre_TMemcpy(recv_data,
+                       hypre_ParCSRCommHandleRecvDataBuffer(comm_handle),
+                       char,
+                       hypre_ParCSRCommHandleNumRecvBytes(comm_handle),
+                       recv_memory_location,
+                       HYPRE_MEMORY_HOST);
+      }
    }
+
+   hypre_ParCSRCommHandleActive(comm_handle) = 0;
 }
-#endif // HYPRE_USING_PERSISTENT_COMM
 
 hypre_ParCSRCommHandle*
 hypre_ParCSRCommHandleCreate ( HYPRE_Int            job,
@@ -325,6 +401,7 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
    HYPRE_Int                  ip, vec_start, vec_len;
    void                      *send_data;
    void                      *recv_data;
+   HYPRE_Int                  use_neighbor_comm;
 
    /*--------------------------------------------------------------------
     * hypre_Initialize sets up a communication handle,
@@ -355,7 +432,51 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
     *           and recv_mpi_types to be set in comm_pkg.
     *           datatypes need to point to absolute
     *           addresses, e.g. generated using hypre_MPI_Address .
+    *
+    * Jobs 1 and 2 on host data restart the persistent requests cached on
+    * comm_pkg, if any (see hypre_ParCSRCommPkgGetPersistentCommHandle).  The
+    * returned handle then belongs to comm_pkg, but is still finalized with
+    * hypre_ParCSRCommHandleDestroy.  Instead, when comm_pkg uses its
+    * distributed graph communicators (see hypre_ParCSRCommPkgSetNeighborComm),
+    * jobs 1 and 2 post one MPI_Ineighbor_alltoallv.  Jobs 1 and 2 of a node-aware comm_pkg on
+    * host data take precedence over both: they complete here (see
+    * hypre_ParCSRNodeAwareExchange) and return a handle without requests.
     *--------------------------------------------------------------------*/
+
+   if ( (job == 1 || job == 2) && hypre_ParCSRCommPkgNodeAware(comm_pkg) &&
+        hypre_GetActualMemLocation(send_memory_location) == hypre_MEMORY_HOST &&
+        hypre_GetActualMemLocation(recv_memory_location) == hypre_MEMORY_HOST )
+   {
+      hypre_ParCSRNodeAwareExchange(job, comm_pkg, (HYPRE_Complex *) send_data_in,
+                                    (HYPRE_Complex *) recv_data_in);
+
+      comm_handle = hypre_CTAlloc(hypre_ParCSRCommHandle,  1, HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommHandleCommPkg(comm_handle)            = comm_pkg;
+      hypre_ParCSRCommHandleSendMemoryLocation(comm_handle) = send_memory_location;
+      hypre_ParCSRCommHandleRecvMemoryLocation(comm_handle) = recv_memory_location;
+      hypre_ParCSRCommHandleSendData(comm_handle)           = send_data_in;
+      hypre_ParCSRCommHandleRecvData(comm_handle)           = recv_data_in;
+      hypre_ParCSRCommHandleSendDataBuffer(comm_handle)     = send_data_in;
+      hypre_ParCSRCommHandleRecvDataBuffer(comm_handle)     = recv_data_in;
+
+      return ( comm_handle );
+   }
+
+   if ( (job == 1 || job == 2) && hypre_ParCSRCommPkgUsePersistent(comm_pkg) &&
+        hypre_GetActualMemLocation(send_memory_location) == hypre_MEMORY_HOST &&
+        hypre_GetActualMemLocation(recv_memory_location) == hypre_MEMORY_HOST )
+   {
+      comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(job, comm_pkg);
+      if (comm_handle)
+      {
+         hypre_ParCSRCommHandleRecvData(comm_handle)           = recv_data_in;
+         hypre_ParCSRCommHandleRecvMemoryLocation(comm_handle) = recv_memory_location;
+         hypre_ParCSRPersistentCommHandleStart(comm_handle, send_memory_location, send_data_in);
+
+         return ( comm_handle );
+      }
+   }
+
 #ifndef HYPRE_WITH_GPU_AWARE_MPI
    switch (job)
    {
@@ -385,6 +506,8 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
          break;
    }
 
+   hypre_MemoryStatsPushCategory(HYPRE_MEMORY_CATEGORY_COMM);
+
    hypre_MemoryLocation act_send_memory_location = hypre_GetActualMemLocation(send_memory_location);
 
    if ( act_send_memory_location == hypre_MEMORY_DEVICE || act_send_memory_location == hypre_MEMORY_UNIFIED )
@@ -416,7 +539,10 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
    HYPRE_CUDA_CALL( cudaStreamSynchronize(hypre_HandleCudaComputeStream(hypre_handle())) );
 #endif
 
-   num_requests = num_sends + num_recvs;
+   /* jobs 1 and 2 may post a single neighborhood collective instead */
+   use_neighbor_comm = (job == 1 || job == 2) && hypre_ParCSRCommPkgUseNeighborComm(comm_pkg);
+
+   num_requests = use_neighbor_comm ? 1 : num_sends + num_recvs;
    requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
 
    hypre_MPI_Comm_size(comm, &num_procs);
@@ -429,6 +555,19 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
       {
          HYPRE_Complex *d_send_data = (HYPRE_Complex *) send_data;
          HYPRE_Complex *d_recv_data = (HYPRE_Complex *) recv_data;
+         if (use_neighbor_comm)
+         {
+            hypre_MPI_Ineighbor_alltoallv(d_send_data,
+                                          hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg),
+                                          hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg),
+                                          HYPRE_MPI_COMPLEX, d_recv_data,
+                                          hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg),
+                                          hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg),
+                                          HYPRE_MPI_COMPLEX,
+                                          hypre_ParCSRCommPkgNeighborComm(comm_pkg, 0),
+                                          &requests[j++]);
+            break;
+         }
          for (i = 0; i < num_recvs; i++)
          {
             ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
@@ -451,6 +590,19 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
       {
          HYPRE_Complex *d_send_data = (HYPRE_Complex *) send_data;
          HYPRE_Complex *d_recv_data = (HYPRE_Complex *) recv_data;
+         if (use_neighbor_comm)
+         {
+            hypre_MPI_Ineighbor_alltoallv(d_send_data,
+                                          hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg),
+                                          hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg),
+                                          HYPRE_MPI_COMPLEX, d_recv_data,
+                                          hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg),
+                                          hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg),
+                                          HYPRE_MPI_COMPLEX,
+                                          hypre_ParCSRCommPkgNeighborComm(comm_pkg, 1),
+                                          &requests[j++]);
+            break;
+         }
          for (i = 0; i < num_sends; i++)
          {
             ip = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
@@ -576,6 +728,109 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
    hypre_ParCSRCommHandleNumRequests(comm_handle)        = num_requests;
    hypre_ParCSRCommHandleRequests(comm_handle)           = requests;
 
+   /* even jobs send in the reverse direction of comm_pkg */
+   hypre_ParCSRCommStatsAddSends((job % 2) ? num_sends : num_recvs, num_send_bytes);
+
+   hypre_MemoryStatsPopCategory();
+
+   return ( comm_handle );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommHandleCreateMultiVector
+ *
+ * Same as jobs 1 and 2 of hypre_ParCSRCommHandleCreate, but exchanges
+ * num_vectors values per entry of send_map_elmts (or per offd column), so
+ * that one message per neighbor carries all vectors of a multivector.  The
+ * values of an entry are stored contiguously (row-wise storage), i.e. the
+ * value of vector jv for entry k is data[k*num_vectors + jv].  Host memory
+ * only; the handle is finalized with hypre_ParCSRCommHandleDestroy.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRCommHandle*
+hypre_ParCSRCommHandleCreateMultiVector ( HYPRE_Int            job,
+                                          HYPRE_Int            num_vectors,
+                                          hypre_ParCSRCommPkg *comm_pkg,
+                                          void                *send_data,
+                                          void                *recv_data )
+{
+   HYPRE_Int                  num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int                  num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   MPI_Comm                   comm      = hypre_ParCSRCommPkgComm(comm_pkg);
+   HYPRE_Complex             *d_send_data = (HYPRE_Complex *) send_data;
+   HYPRE_Complex             *d_recv_data = (HYPRE_Complex *) recv_data;
+   hypre_ParCSRCommHandle    *comm_handle;
+   HYPRE_Int                  num_requests;
+   hypre_MPI_Request         *requests;
+   HYPRE_Int                  i, j;
+   HYPRE_Int                  ip, vec_start, vec_len;
+   HYPRE_Int                  num_recv_procs, num_send_procs;
+   HYPRE_Int                 *recv_procs, *send_procs, *recv_starts, *send_starts;
+
+   /* job = 1: recv per offd column, send per send_map_elmt (Matvec)
+    * job = 2: the reverse (MatvecT) */
+   if (job == 2)
+   {
+      num_recv_procs = num_sends;
+      recv_procs     = hypre_ParCSRCommPkgSendProcs(comm_pkg);
+      recv_starts    = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+      num_send_procs = num_recvs;
+      send_procs     = hypre_ParCSRCommPkgRecvProcs(comm_pkg);
+      send_starts    = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+   }
+   else
+   {
+      num_recv_procs = num_recvs;
+      recv_procs     = hypre_ParCSRCommPkgRecvProcs(comm_pkg);
+      recv_starts    = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+      num_send_procs = num_sends;
+      send_procs     = hypre_ParCSRCommPkgSendProcs(comm_pkg);
+      send_starts    = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+   }
+
+   hypre_MemoryStatsPushCategory(HYPRE_MEMORY_CATEGORY_COMM);
+
+   num_requests = num_sends + num_recvs;
+   requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
+
+   j = 0;
+   for (i = 0; i < num_recv_procs; i++)
+   {
+      ip = recv_procs[i];
+      vec_start = recv_starts[i] * num_vectors;
+      vec_len = recv_starts[i+1] * num_vectors - vec_start;
+      hypre_MPI_Irecv(&d_recv_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
+                      ip, 0, comm, &requests[j++]);
+   }
+   for (i = 0; i < num_send_procs; i++)
+   {
+      ip = send_procs[i];
+      vec_start = send_starts[i] * num_vectors;
+      vec_len = send_starts[i+1] * num_vectors - vec_start;
+      hypre_MPI_Isend(&d_send_data[vec_start], vec_len, HYPRE_MPI_COMPLEX,
+                      ip, 0, comm, &requests[j++]);
+   }
+
+   comm_handle = hypre_CTAlloc(hypre_ParCSRCommHandle,  1, HYPRE_MEMORY_HOST);
+
+   hypre_ParCSRCommHandleCommPkg(comm_handle)            = comm_pkg;
+   hypre_ParCSRCommHandleSendMemoryLocation(comm_handle) = HYPRE_MEMORY_HOST;
+   hypre_ParCSRCommHandleRecvMemoryLocation(comm_handle) = HYPRE_MEMORY_HOST;
+   hypre_ParCSRCommHandleNumSendBytes(comm_handle)       = send_starts[num_send_procs] *
+                                                           num_vectors * sizeof(HYPRE_Complex);
+   hypre_ParCSRCommHandleNumRecvBytes(comm_handle)       = recv_starts[num_recv_procs] *
+                                                           num_vectors * sizeof(HYPRE_Complex);
+   hypre_ParCSRCommHandleSendData(comm_handle)           = send_data;
+   hypre_ParCSRCommHandleRecvData(comm_handle)           = recv_data;
+   hypre_ParCSRCommHandleSendDataBuffer(comm_handle)     = send_data;
+   hypre_ParCSRCommHandleRecvDataBuffer(comm_handle)     = recv_data;
+   hypre_ParCSRCommHandleNumRequests(comm_handle)        = num_requests;
+   hypre_ParCSRCommHandleRequests(comm_handle)           = requests;
+
+   hypre_ParCSRCommStatsAddSends(num_send_procs, hypre_ParCSRCommHandleNumSendBytes(comm_handle));
+
+   hypre_MemoryStatsPopCategory();
+
    return ( comm_handle );
 }
 
@@ -587,13 +842,32 @@ hypre_ParCSRCommHandleDestroy( hypre_ParCSRCommHandle *comm_handle )
       return hypre_error_flag;
    }
 
+   if (hypre_ParCSRCommHandlePersistent(comm_handle))
+   {
+      hypre_ParCSRPersistentCommHandleWait(comm_handle,
+                                           hypre_ParCSRCommHandleRecvMemoryLocation(comm_handle),
+                                           hypre_ParCSRCommHandleRecvData(comm_handle));
+      return hypre_error_flag;
+   }
+
    if (hypre_ParCSRCommHandleNumRequests(comm_handle))
    {
       hypre_MPI_Status *status0;
+      HYPRE_Int         comm_stats = hypre_HandleCommStats(hypre_handle());
+      HYPRE_Real        wait_begin = 0.0;
+
       status0 = hypre_CTAlloc(hypre_MPI_Status,
                               hypre_ParCSRCommHandleNumRequests(comm_handle), HYPRE_MEMORY_HOST);
+      if (comm_stats)
+      {
+         wait_begin = hypre_MPI_Wtime();
+      }
       hypre_MPI_Waitall(hypre_ParCSRCommHandleNumRequests(comm_handle),
                         hypre_ParCSRCommHandleRequests(comm_handle), status0);
+      if (comm_stats)
+      {
+         hypre_HandleCommWaitTime(hypre_handle()) += hypre_MPI_Wtime() - wait_begin;
+      }
       hypre_TFree(status0, HYPRE_MEMORY_HOST);
    }
 
@@ -929,8 +1203,10 @@ hypre_MatvecCommPkgCreate ( hypre_ParCSRMatrix *A )
    /*-----------------------------------------------------------
     * setup commpkg
     *----------------------------------------------------------*/
+   hypre_MemoryStatsPushCategory(HYPRE_MEMORY_CATEGORY_COMM);
    hypre_ParCSRCommPkg *comm_pkg = hypre_CTAlloc(hypre_ParCSRCommPkg, 1, HYPRE_MEMORY_HOST);
    hypre_ParCSRMatrixCommPkg(A) = comm_pkg;
+   hypre_ParCSRCommPkgUsePersistent(comm_pkg) = 1;
 #ifdef HYPRE_NO_GLOBAL_PARTITION
    hypre_ParCSRCommPkgCreateApart ( comm, col_map_offd, first_col_diag,
                                     num_cols_offd, global_num_cols,
@@ -943,14 +1219,116 @@ hypre_MatvecCommPkgCreate ( hypre_ParCSRMatrix *A )
                                     comm_pkg );
 #endif
 
+   if (hypre_HandleNeighborComm(hypre_handle()))
+   {
+      hypre_ParCSRCommPkgCreateNeighborComm(comm_pkg);
+   }
+
+   hypre_MemoryStatsPopCategory();
+
+   return hypre_error_flag;
+}
+
+/* ----------------------------------------------------------------------
+ * hypre_ParCSRCommPkgCreateNeighborComm
+ * builds the distributed graph communicators of comm_pkg (collective over
+ * its communicator) and the message counts and displacements of jobs 1
+ * and 2 for MPI_Ineighbor_alltoallv.  Only for the packages destroyed with
+ * hypre_MatvecCommPkgDestroy.
+ * ---------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRCommPkgCreateNeighborComm( hypre_ParCSRCommPkg *comm_pkg )
+{
+   MPI_Comm   comm      = hypre_ParCSRCommPkgComm(comm_pkg);
+   HYPRE_Int  num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int  num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   hypre_int *send_counts, *send_displs;
+   hypre_int *recv_counts, *recv_displs;
+   HYPRE_Int  i;
+
+   if (hypre_ParCSRCommPkgHasNeighborComm(comm_pkg))
+   {
+      return hypre_error_flag;
+   }
+
+   /* job 1 receives from recv_procs and sends to send_procs, job 2 the reverse */
+   hypre_MPI_Dist_graph_create_adjacent(comm, num_recvs, hypre_ParCSRCommPkgRecvProcs(comm_pkg),
+                                        num_sends, hypre_ParCSRCommPkgSendProcs(comm_pkg),
+                                        &hypre_ParCSRCommPkgNeighborComm(comm_pkg, 0));
+   hypre_MPI_Dist_graph_create_adjacent(comm, num_sends, hypre_ParCSRCommPkgSendProcs(comm_pkg),
+                                        num_recvs, hypre_ParCSRCommPkgRecvProcs(comm_pkg),
+                                        &hypre_ParCSRCommPkgNeighborComm(comm_pkg, 1));
+
+   send_counts = hypre_TAlloc(hypre_int, num_sends, HYPRE_MEMORY_HOST);
+   send_displs = hypre_TAlloc(hypre_int, num_sends, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_sends; i++)
+   {
+      send_displs[i] = (hypre_int) hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+      send_counts[i] = (hypre_int) (hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1) -
+                                    hypre_ParCSRCommPkgSendMapStart(comm_pkg, i));
+   }
+
+   recv_counts = hypre_TAlloc(hypre_int, num_recvs, HYPRE_MEMORY_HOST);
+   recv_displs = hypre_TAlloc(hypre_int, num_recvs, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_recvs; i++)
+   {
+      recv_displs[i] = (hypre_int) hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
+      recv_counts[i] = (hypre_int) (hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i+1) -
+                                    hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i));
+   }
+
+   hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg) = send_counts;
+   hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg) = send_displs;
+   hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg) = recv_counts;
+   hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg) = recv_displs;
+   hypre_ParCSRCommPkgHasNeighborComm(comm_pkg)    = 1;
+   hypre_ParCSRCommPkgUseNeighborComm(comm_pkg)    = 1;
+
    return hypre_error_flag;
 }
 
+/* ----------------------------------------------------------------------
+ * hypre_ParCSRCommPkgSetNeighborComm
+ * turns the neighborhood collectives of the exchanges of comm_pkg on (1)
+ * or off (0).  Turning them on builds the graph communicators if needed,
+ * which is collective; turning them off keeps them for later use.
+ * ---------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRCommPkgSetNeighborComm( hypre_ParCSRCommPkg *comm_pkg,
+                                    HYPRE_Int            use )
+{
+   if (use)
+   {
+      hypre_ParCSRCommPkgCreateNeighborComm(comm_pkg);
+   }
+   hypre_ParCSRCommPkgUseNeighborComm(comm_pkg) = use && hypre_ParCSRCommPkgHasNeighborComm(comm_pkg);
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_ParCSRCommPkgDestroyNeighborComm( hypre_ParCSRCommPkg *comm_pkg )
+{
+   if (hypre_ParCSRCommPkgHasNeighborComm(comm_pkg))
+   {
+      hypre_MPI_Comm_free(&hypre_ParCSRCommPkgNeighborComm(comm_pkg, 0));
+      hypre_MPI_Comm_free(&hypre_ParCSRCommPkgNeighborComm(comm_pkg, 1));
+      hypre_TFree(hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgHasNeighborComm(comm_pkg) = 0;
+      hypre_ParCSRCommPkgUseNeighborComm(comm_pkg) = 0;
+   }
+
+   return hypre_error_flag;
+}
 
 HYPRE_Int
 hypre_MatvecCommPkgDestroy( hypre_ParCSRCommPkg *comm_pkg )
 {
-#ifdef HYPRE_USING_PERSISTENT_COMM
    HYPRE_Int i;
    for (i = HYPRE_COMM_PKG_JOB_COMPLEX; i < NUM_OF_COMM_PKG_JOB_TYPE; ++i)
    {
@@ -959,7 +1337,8 @@ hypre_MatvecCommPkgDestroy( hypre_ParCSRCommPkg *comm_pkg )
          hypre_ParCSRPersistentCommHandleDestroy(comm_pkg->persistent_comm_handles[i]);
       }
    }
-#endif
+   hypre_ParCSRCommPkgDestroyNeighborComm(comm_pkg);
+   hypre_ParCSRCommPkgDestroyNodeAware(comm_pkg);
 
    if (hypre_ParCSRCommPkgNumSends(comm_pkg))
    {
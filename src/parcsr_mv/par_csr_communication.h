@@ -13,7 +13,6 @@
  *   Structure containing information for doing communications
  *--------------------------------------------------------------------------*/
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
 typedef enum CommPkgJobType
 {
    HYPRE_COMM_PKG_JOB_COMPLEX = 0,
@@ -24,7 +23,6 @@ typedef enum CommPkgJobType
    HYPRE_COMM_PKG_JOB_BIGINT_TRANSPOSE,
    NUM_OF_COMM_PKG_JOB_TYPE,
 } CommPkgJobType;
-#endif
 
 /*--------------------------------------------------------------------------
  * hypre_ParCSRCommHandle, hypre_ParCSRPersistentCommHandle
@@ -44,10 +42,36 @@ typedef struct
    void                 *recv_data_buffer;
    HYPRE_Int             num_requests;
    hypre_MPI_Request    *requests;
+   /* persistent handles (persistent = job) are owned by their comm_pkg and
+    * may be restarted once the previous exchange was waited for (active = 0) */
+   HYPRE_Int             persistent;
+   HYPRE_Int             active;
 } hypre_ParCSRCommHandle;
 
 typedef hypre_ParCSRCommHandle hypre_ParCSRPersistentCommHandle;
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNodeAwareComm:
+ *   Two-level routing of the halo exchanges of a communication package (see
+ *   par_csr_node_aware.c).  The entries travel through three point-to-point
+ *   stages over the work array [send buffer | stage 1 | stage 2 | stage 3]:
+ *   stage s sends work[send_map_elmts] of stage_pkgs[s] and receives into
+ *   work + stage_offsets[s].  Received entry i of the original package
+ *   ends up in work[final_map[i]].
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_NODE_AWARE_NUM_STAGES 3
+
+typedef struct
+{
+   struct _hypre_ParCSRCommPkg *stage_pkgs[HYPRE_NODE_AWARE_NUM_STAGES];
+   HYPRE_Int                    stage_offsets[HYPRE_NODE_AWARE_NUM_STAGES];
+   HYPRE_Int                    work_size;
+   HYPRE_Int                   *final_map;
+   HYPRE_Complex               *work;
+   HYPRE_Complex               *send_buffer;
+} hypre_ParCSRNodeAwareComm;
+
 typedef struct _hypre_ParCSRCommPkg
 {
    MPI_Comm                     comm;
@@ -66,9 +90,32 @@ typedef struct _hypre_ParCSRCommPkg
    hypre_MPI_Datatype          *send_mpi_types;
    hypre_MPI_Datatype          *recv_mpi_types;
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
+   /* persistent handles, cached only on the packages destroyed with
+    * hypre_MatvecCommPkgDestroy (use_persistent = 1) */
+   HYPRE_Int                    use_persistent;
    hypre_ParCSRPersistentCommHandle *persistent_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
-#endif
+
+   /* distributed graph communicators of jobs 1 (recv_procs -> send_procs)
+    * and 2 (reverse), and the message counts and displacements in entries
+    * for MPI_Ineighbor_alltoallv (see hypre_ParCSRCommPkgCreateNeighborComm),
+    * and whether the exchanges use them (see hypre_ParCSRCommPkgSetNeighborComm) */
+   HYPRE_Int                    has_neighbor_comm;
+   HYPRE_Int                    use_neighbor_comm;
+   MPI_Comm                     neighbor_comm[2];
+   hypre_int                   *neighbor_send_counts;
+   hypre_int                   *neighbor_send_displs;
+   hypre_int                   *neighbor_recv_counts;
+   hypre_int                   *neighbor_recv_displs;
+
+   /* two-level routing of jobs 1 and 2 through on-node proxies, with one
+    * inter-node message per pair of nodes (see hypre_ParCSRCommPkgCreateNodeAware) */
+   hypre_ParCSRNodeAwareComm   *node_aware;
+
+   /* halo exchange statistics of the split-phase matvec: communication time
+    * hidden behind the diag multiply and time exposed waiting after it */
+   HYPRE_Int                    matvec_num_overlapped;
+   HYPRE_Real                   matvec_hidden_time;
+   HYPRE_Real                   matvec_exposed_time;
 
    /* temporary memory for matvec. cudaMalloc is expensive. alloc once and reuse */
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
@@ -101,6 +148,20 @@ typedef struct _hypre_ParCSRCommPkg
 #define hypre_ParCSRCommPkgSendMPIType(comm_pkg,i)       (comm_pkg -> send_mpi_types[i])
 #define hypre_ParCSRCommPkgRecvMPITypes(comm_pkg)        (comm_pkg -> recv_mpi_types)
 #define hypre_ParCSRCommPkgRecvMPIType(comm_pkg,i)       (comm_pkg -> recv_mpi_types[i])
+#define hypre_ParCSRCommPkgUsePersistent(comm_pkg)       (comm_pkg -> use_persistent)
+#define hypre_ParCSRCommPkgHasNeighborComm(comm_pkg)     (comm_pkg -> has_neighbor_comm)
+#define hypre_ParCSRCommPkgNeighborComm(comm_pkg, i)     (comm_pkg -> neighbor_comm[i])
+#define hypre_ParCSRCommPkgNeighborSendCounts(comm_pkg)  (comm_pkg -> neighbor_send_counts)
+#define hypre_ParCSRCommPkgNeighborSendDispls(comm_pkg)  (comm_pkg -> neighbor_send_displs)
+#define hypre_ParCSRCommPkgNeighborRecvCounts(comm_pkg)  (comm_pkg -> neighbor_recv_counts)
+#define hypre_ParCSRCommPkgNeighborRecvDispls(comm_pkg)  (comm_pkg -> neighbor_recv_displs)
+#define hypre_ParCSRCommPkgNodeAware(comm_pkg)          (comm_pkg -> node_aware)
+
+/* exchanges of jobs 1 and 2 use the neighborhood collectives */
+#define hypre_ParCSRCommPkgUseNeighborComm(comm_pkg)     (comm_pkg -> use_neighbor_comm)
+#define hypre_ParCSRCommPkgMatvecNumOverlapped(comm_pkg)  (comm_pkg -> matvec_num_overlapped)
+#define hypre_ParCSRCommPkgMatvecHiddenTime(comm_pkg)     (comm_pkg -> matvec_hidden_time)
+#define hypre_ParCSRCommPkgMatvecExposedTime(comm_pkg)    (comm_pkg -> matvec_exposed_time)
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
 #define hypre_ParCSRCommPkgTmpData(comm_pkg)             ((comm_pkg) -> tmp_data)
@@ -144,6 +205,19 @@ hypre_ParCSRCommPkgCopySendMapElmtsToDevice(hypre_ParCSRCommPkg *comm_pkg)
 #define hypre_ParCSRCommHandleNumRequests(comm_handle)            (comm_handle -> num_requests)
 #define hypre_ParCSRCommHandleRequests(comm_handle)               (comm_handle -> requests)
 #define hypre_ParCSRCommHandleRequest(comm_handle, i)             (comm_handle -> requests[i])
+#define hypre_ParCSRCommHandlePersistent(comm_handle)             (comm_handle -> persistent)
+#define hypre_ParCSRCommHandleActive(comm_handle)                 (comm_handle -> active)
+
+/*--------------------------------------------------------------------------
+ * Accessor macros: hypre_ParCSRNodeAwareComm
+ *--------------------------------------------------------------------------*/
+
+#define hypre_ParCSRNodeAwareCommStagePkg(node_aware, s)     ((node_aware) -> stage_pkgs[s])
+#define hypre_ParCSRNodeAwareCommStageOffset(node_aware, s)  ((node_aware) -> stage_offsets[s])
+#define hypre_ParCSRNodeAwareCommWorkSize(node_aware)        ((node_aware) -> work_size)
+#define hypre_ParCSRNodeAwareCommFinalMap(node_aware)        ((node_aware) -> final_map)
+#define hypre_ParCSRNodeAwareCommWork(node_aware)            ((node_aware) -> work)
+#define hypre_ParCSRNodeAwareCommSendBuffer(node_aware)      ((node_aware) -> send_buffer)
 
 #endif /* HYPRE_PAR_CSR_COMMUNICATION_HEADER */
 
@@ -394,6 +394,129 @@ hypre_ParCSRMatrixSetNumNonzeros_core( hypre_ParCSRMatrix *matrix, const char* f
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixConvertToSP
+ *
+ * Switches the coefficients of diag and offd (and of their stored
+ * transposes) to reduced-precision storage.  See hypre_CSRMatrixConvertToSP.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixConvertToSP( hypre_ParCSRMatrix *matrix )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixConvertToSP(hypre_ParCSRMatrixDiag(matrix));
+   hypre_CSRMatrixConvertToSP(hypre_ParCSRMatrixOffd(matrix));
+
+   if (hypre_ParCSRMatrixDiagT(matrix))
+   {
+      hypre_CSRMatrixConvertToSP(hypre_ParCSRMatrixDiagT(matrix));
+   }
+   if (hypre_ParCSRMatrixOffdT(matrix))
+   {
+      hypre_CSRMatrixConvertToSP(hypre_ParCSRMatrixOffdT(matrix));
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixConvertToDP
+ *
+ * Restores the HYPRE_Complex coefficients of a matrix converted by
+ * hypre_ParCSRMatrixConvertToSP.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixConvertToDP( hypre_ParCSRMatrix *matrix )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixConvertToDP(hypre_ParCSRMatrixDiag(matrix));
+   hypre_CSRMatrixConvertToDP(hypre_ParCSRMatrixOffd(matrix));
+
+   if (hypre_ParCSRMatrixDiagT(matrix))
+   {
+      hypre_CSRMatrixConvertToDP(hypre_ParCSRMatrixDiagT(matrix));
+   }
+   if (hypre_ParCSRMatrixOffdT(matrix))
+   {
+      hypre_CSRMatrixConvertToDP(hypre_ParCSRMatrixOffdT(matrix));
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixValuesChanged
+ *
+ * Updates the data derived from the values of diag and offd after they have
+ * been changed in place: the values versions of diag and offd are bumped (so
+ * that their SELL-C-sigma shadows are rebuilt on the next matvec) and stored
+ * transposes are recomputed.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixValuesChanged( hypre_ParCSRMatrix *matrix )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixValuesChanged(hypre_ParCSRMatrixDiag(matrix));
+   hypre_CSRMatrixValuesChanged(hypre_ParCSRMatrixOffd(matrix));
+
+   if (hypre_ParCSRMatrixDiagT(matrix))
+   {
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatrixDiagT(matrix));
+      hypre_CSRMatrixTranspose(hypre_ParCSRMatrixDiag(matrix),
+                               &hypre_ParCSRMatrixDiagT(matrix), 1);
+   }
+   if (hypre_ParCSRMatrixOffdT(matrix))
+   {
+      hypre_CSRMatrixDestroy(hypre_ParCSRMatrixOffdT(matrix));
+      hypre_CSRMatrixTranspose(hypre_ParCSRMatrixOffd(matrix),
+                               &hypre_ParCSRMatrixOffdT(matrix), 1);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixSetSellCSigma
+ *
+ * Enables (chunk_size > 0) or disables (chunk_size = 0) the SELL-C-sigma
+ * format of diag and offd in the host matvec of this matrix.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixSetSellCSigma( hypre_ParCSRMatrix *matrix,
+                                 HYPRE_Int           chunk_size,
+                                 HYPRE_Int           sort_scope )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixSetSellCSigma(hypre_ParCSRMatrixDiag(matrix), chunk_size, sort_scope);
+   hypre_CSRMatrixSetSellCSigma(hypre_ParCSRMatrixOffd(matrix), chunk_size, sort_scope);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixSetNumNonzeros
  *--------------------------------------------------------------------------*/
@@ -735,6 +858,12 @@ hypre_ParCSRMatrixPrintIJ( const hypre_ParCSRMatrix *matrix,
    num_rows        = hypre_ParCSRMatrixNumRows(matrix);
    row_starts      = hypre_ParCSRMatrixRowStarts(matrix);
    col_starts      = hypre_ParCSRMatrixColStarts(matrix);
+   if (hypre_CSRMatrixDataSP(diag) || hypre_CSRMatrixDataSP(offd))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Matrix with reduced-precision values, see hypre_ParCSRMatrixConvertToDP\n");
+      return hypre_error_flag;
+   }
    hypre_MPI_Comm_rank(comm, &myid);
    hypre_MPI_Comm_size(comm, &num_procs);
 
@@ -2749,6 +2878,8 @@ hypre_ParCSRMatrixDropSmallEntries( hypre_ParCSRMatrix *A,
    hypre_CSRMatrixNumNonzeros(A_offd) = nnz_offd;
    hypre_ParCSRMatrixSetNumNonzeros(A);
    hypre_ParCSRMatrixDNumNonzeros(A) = (HYPRE_Real) hypre_ParCSRMatrixNumNonzeros(A);
+   hypre_CSRMatrixValuesChanged(A_diag);
+   hypre_CSRMatrixValuesChanged(A_offd);
 
    for (i = 0, k = 0; i < num_cols_A_offd; i++)
    {
@@ -3372,6 +3503,9 @@ hypre_ParCSRMatrixTruncate(hypre_ParCSRMatrix *A,
    hypre_TFree(num_lost_per_thread, HYPRE_MEMORY_HOST);
    hypre_TFree(num_lost_offd_per_thread, HYPRE_MEMORY_HOST);
 
+   hypre_CSRMatrixValuesChanged(A_diag);
+   hypre_CSRMatrixValuesChanged(A_offd);
+
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_INTERP_TRUNC] += hypre_MPI_Wtime();
 #endif
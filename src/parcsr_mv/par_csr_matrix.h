@@ -204,5 +204,13 @@ typedef struct
 #define hypre_ParCSRBooleanMatrix_Get_Rowindices(matrix)    ((matrix)->rowindices)
 #define hypre_ParCSRBooleanMatrix_Get_Getrowactive(matrix)  ((matrix)->getrowactive)
 
+/*--------------------------------------------------------------------------
+ * Plan of a host sparse matrix-matrix product C = A*B or C = A^T*B: the
+ * symbolic structure and communication pattern of the product, reused to
+ * recompute the values of C (see par_csr_triplemat.c)
+ *--------------------------------------------------------------------------*/
+
+typedef struct hypre_ParCSRMatMatPlan_struct hypre_ParCSRMatMatPlan;
+
 #endif
 
@@ -12,6 +12,110 @@
  *****************************************************************************/
 
 #include "_hypre_parcsr_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecDiagRows
+ *
+ * y[row_start:row_end] = alpha*diag[row_start:row_end,:]*x + beta*b[row_start:row_end]
+ * Host kernel for one chunk of the split-phase matvec (single vector only).
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatrixMatvecDiagRows( HYPRE_Complex    alpha,
+                                  hypre_CSRMatrix *diag,
+                                  hypre_Vector    *x,
+                                  HYPRE_Complex    beta,
+                                  hypre_Vector    *b,
+                                  hypre_Vector    *y,
+                                  HYPRE_Int        row_start,
+                                  HYPRE_Int        row_end )
+{
+   HYPRE_Complex *A_data = hypre_CSRMatrixData(diag);
+   HYPRE_Int     *A_i    = hypre_CSRMatrixI(diag);
+   HYPRE_Int     *A_j    = hypre_CSRMatrixJ(diag);
+   HYPRE_Complex *x_data = hypre_VectorData(x);
+   HYPRE_Complex *b_data = hypre_VectorData(b);
+   HYPRE_Complex *y_data = hypre_VectorData(y);
+   HYPRE_Complex  temp;
+   HYPRE_Int      i, jj;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,jj,temp) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = row_start; i < row_end; i++)
+   {
+      temp = 0.0;
+      for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+      {
+         temp += A_data[jj] * x_data[A_j[jj]];
+      }
+
+      if (beta == 0.0)
+      {
+         y_data[i] = alpha * temp;
+      }
+      else
+      {
+         y_data[i] = alpha * temp + beta * b_data[i];
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMatvecOverlapDiag
+ *
+ * Split-phase diag multiply: the rows of diag are processed in chunks and
+ * the pending halo exchange is driven with MPI_Testall between chunks, so
+ * that MPI libraries without asynchronous progress still receive messages
+ * while the local computation runs. The time at which the exchange is
+ * observed complete is returned in *done_time (0.0 if still pending).
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatrixMatvecOverlapDiag( HYPRE_Complex           alpha,
+                                     hypre_CSRMatrix        *diag,
+                                     hypre_Vector           *x,
+                                     HYPRE_Complex           beta,
+                                     hypre_Vector           *b,
+                                     hypre_Vector           *y,
+                                     hypre_ParCSRCommHandle *comm_handle,
+                                     HYPRE_Real             *done_time )
+{
+   HYPRE_Int  num_rows     = hypre_CSRMatrixNumRows(diag);
+   HYPRE_Int  chunk_size   = hypre_HandleMatvecOverlapChunkSize(hypre_handle());
+   HYPRE_Int  num_requests = hypre_ParCSRCommHandleNumRequests(comm_handle);
+   HYPRE_Int  done         = (num_requests == 0);
+   HYPRE_Int  row_start, row_end;
+
+   *done_time = done ? hypre_MPI_Wtime() : 0.0;
+
+   if (chunk_size <= 0)
+   {
+      chunk_size = num_rows;
+   }
+
+   for (row_start = 0; row_start < num_rows; row_start += chunk_size)
+   {
+      row_end = hypre_min(row_start + chunk_size, num_rows);
+
+      hypre_ParCSRMatrixMatvecDiagRows(alpha, diag, x, beta, b, y, row_start, row_end);
+
+      if (!done)
+      {
+         hypre_MPI_Testall(num_requests, hypre_ParCSRCommHandleRequests(comm_handle),
+                           &done, hypre_MPI_STATUSES_IGNORE);
+         if (done)
+         {
+            *done_time = hypre_MPI_Wtime();
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixMatvec
  *--------------------------------------------------------------------------*/
@@ -52,6 +156,9 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    HYPRE_Complex *x_tmp_data, **x_buf_data;
    HYPRE_Complex *x_local_data = hypre_VectorData(x_local);
 
+   HYPRE_Int  use_overlap = 0, use_sell = 0, use_packed = 0;
+   HYPRE_Real comm_start_time = 0.0, comm_done_time = 0.0, diag_end_time = 0.0;
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    HYPRE_Int sync_stream = hypre_HandleCudaComputeStreamSync(hypre_handle());
    hypre_HandleCudaComputeStreamSync(hypre_handle()) = 0;
@@ -116,26 +223,40 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
 #endif
 
    HYPRE_Int use_persistent_comm = 0;
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
-   use_persistent_comm = num_vectors == 1;
+   /* a single vector is packed and unpacked directly in the buffers of the
+    * persistent requests cached on comm_pkg (the split-phase matvec polls
+    * the handle returned by hypre_ParCSRCommHandleCreate_v2 instead) */
    // JSP TODO: we can use persistent communication for multi-vectors,
    // but then we need different communication handles for different
    // num_vectors.
-   hypre_ParCSRPersistentCommHandle *persistent_comm_handle;
-#endif
-
-   if (use_persistent_comm)
+   if (num_vectors == 1 && !hypre_HandleMatvecOverlap(hypre_handle()))
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
-#endif
+      use_persistent_comm = persistent_comm_handle != NULL;
    }
-   else
+
+   if (!use_persistent_comm)
    {
       comm_handle = hypre_CTAlloc(hypre_ParCSRCommHandle*, num_vectors, HYPRE_MEMORY_HOST);
    }
 
+   /* SELL-C-sigma shadows of diag and offd, and split-phase diag multiply:
+    * host only, single vector (the split phase also needs regular comm handles
+    * and double precision coefficients in diag) */
+#if !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_DEVICE_OPENMP)
+   use_sell    = hypre_CSRMatrixSellChunkSize(diag) > 0 && num_vectors == 1;
+   use_overlap = hypre_HandleMatvecOverlap(hypre_handle()) && num_vectors == 1 &&
+                 !use_persistent_comm && !use_sell && !hypre_CSRMatrixDataSP(diag);
+#endif
+
+   /* multivectors on the host: one message per neighbor carries all vectors,
+    * and x_tmp is stored row-wise so the offd multiply reads it contiguously */
+#if !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_DEVICE_OPENMP)
+   use_packed = num_vectors > 1 && !use_persistent_comm;
+#endif
+
    /* x_tmp */
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    /* for GPU and single vector, alloc persistent memory for x_tmp (in comm_pkg) and reuse */
@@ -152,13 +273,16 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
 #else
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       hypre_VectorData(x_tmp) = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
       hypre_SeqVectorSetDataOwner(x_tmp, 0);
-#endif
    }
 #endif
 
+   if (use_packed)
+   {
+      hypre_VectorMultiVecStorageMethod(x_tmp) = 1;
+   }
+
    hypre_SeqVectorInitialize_v2(x_tmp, HYPRE_MEMORY_DEVICE);
    x_tmp_data = hypre_VectorData(x_tmp);
 
@@ -167,6 +291,16 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
 
    for (jv = 0; jv < num_vectors; ++jv)
    {
+      if (use_packed)
+      {
+         if (jv == 0)
+         {
+            x_buf_data[0] = hypre_TAlloc(HYPRE_Complex,
+                                         hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends) * num_vectors,
+                                         HYPRE_MEMORY_DEVICE);
+         }
+         continue;
+      }
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
       if (jv == 0)
       {
@@ -187,10 +321,8 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
 #endif
       if (use_persistent_comm)
       {
-#ifdef HYPRE_USING_PERSISTENT_COMM
          x_buf_data[0] = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
          continue;
-#endif
       }
 
       x_buf_data[jv] = hypre_TAlloc(HYPRE_Complex,
@@ -207,14 +339,35 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
       CommHandleCreate (perhaps a new multivector variant of it).
    */
 
-   hypre_assert( idxstride == 1 );
+   hypre_assert( idxstride == 1 || use_packed );
 
    //hypre_SeqVectorPrefetch(x_local, HYPRE_MEMORY_DEVICE);
 
    /* send_map_elmts on device */
    hypre_ParCSRCommPkgCopySendMapElmtsToDevice(comm_pkg);
 
-   for (jv = 0; jv < num_vectors; ++jv)
+   if (use_packed)
+   {
+      HYPRE_Complex *send_data = (HYPRE_Complex *) x_buf_data[0];
+      HYPRE_Int i, k;
+
+      /* pack all vectors, entry by entry */
+#if defined(HYPRE_USING_OPENMP)
+#pragma omp parallel for private(i,jv,k) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+           i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+           i ++)
+      {
+         k = hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i) * idxstride;
+         for (jv = 0; jv < num_vectors; ++jv)
+         {
+            send_data[i*num_vectors + jv] = x_local_data[jv*vecstride + k];
+         }
+      }
+   }
+
+   for (jv = 0; jv < num_vectors && !use_packed; ++jv)
    {
       HYPRE_Complex *send_data = (HYPRE_Complex *) x_buf_data[jv];
       HYPRE_Complex *locl_data = x_local_data + jv * vecstride;
@@ -260,11 +413,19 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
 #endif
 
    /* nonblocking communication starts */
+   if (use_overlap)
+   {
+      comm_start_time = hypre_MPI_Wtime();
+   }
+
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_DEVICE, x_buf_data[0]);
-#endif
+   }
+   else if (use_packed)
+   {
+      comm_handle[0] = hypre_ParCSRCommHandleCreateMultiVector( 1, num_vectors, comm_pkg,
+                                                                x_buf_data[0], x_tmp_data );
    }
    else
    {
@@ -280,7 +441,20 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
 #endif
 
    /* overlapped local computation */
-   hypre_CSRMatrixMatvecOutOfPlace( alpha, diag, x_local, beta, b_local, y_local, 0 );
+   if (use_overlap)
+   {
+      hypre_ParCSRMatrixMatvecOverlapDiag( alpha, diag, x_local, beta, b_local, y_local,
+                                           comm_handle[0], &comm_done_time );
+      diag_end_time = hypre_MPI_Wtime();
+   }
+   else if (use_sell)
+   {
+      hypre_CSRMatrixMatvecSell( alpha, diag, x_local, beta, b_local, y_local );
+   }
+   else
+   {
+      hypre_CSRMatrixMatvecOutOfPlace( alpha, diag, x_local, beta, b_local, y_local, 0 );
+   }
 
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
@@ -289,9 +463,7 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    /* nonblocking communication ends */
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_DEVICE, x_tmp_data);
-#endif
    }
    else
    {
@@ -307,10 +479,38 @@ hypre_ParCSRMatrixMatvecOutOfPlace( HYPRE_Complex       alpha,
    hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
 #endif
 
+   /* hidden: exchange time covered by the diag multiply, exposed: waiting after it */
+   if (use_overlap)
+   {
+      HYPRE_Real hidden_time, exposed_time;
+
+      if (comm_done_time > 0.0)
+      {
+         hidden_time  = comm_done_time - comm_start_time;
+         exposed_time = 0.0;
+      }
+      else
+      {
+         hidden_time  = diag_end_time - comm_start_time;
+         exposed_time = hypre_MPI_Wtime() - diag_end_time;
+      }
+
+      hypre_ParCSRCommPkgMatvecNumOverlapped(comm_pkg) ++;
+      hypre_ParCSRCommPkgMatvecHiddenTime(comm_pkg)  += hidden_time;
+      hypre_ParCSRCommPkgMatvecExposedTime(comm_pkg) += exposed_time;
+   }
+
    /* computation offd part */
    if (num_cols_offd)
    {
-      hypre_CSRMatrixMatvec( alpha, offd, x_tmp, 1.0, y_local );
+      if (use_sell)
+      {
+         hypre_CSRMatrixMatvecSell( alpha, offd, x_tmp, 1.0, y_local, y_local );
+      }
+      else
+      {
+         hypre_CSRMatrixMatvec( alpha, offd, x_tmp, 1.0, y_local );
+      }
    }
 
 #ifdef HYPRE_PROFILE
@@ -398,6 +598,8 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
    HYPRE_Complex *y_tmp_data, **y_buf_data;
    HYPRE_Complex *y_local_data = hypre_VectorData(y_local);
 
+   HYPRE_Int use_packed = 0;
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    HYPRE_Int sync_stream = hypre_HandleCudaComputeStreamSync(hypre_handle());
    hypre_HandleCudaComputeStreamSync(hypre_handle()) = 0;
@@ -460,26 +662,29 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
 #endif
 
    HYPRE_Int use_persistent_comm = 0;
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
 
-#ifdef HYPRE_USING_PERSISTENT_COMM
-   use_persistent_comm = num_vectors == 1;
+   /* a single vector is packed and unpacked directly in the buffers of the
+    * persistent requests cached on comm_pkg */
    // JSP TODO: we can use persistent communication for multi-vectors,
    // but then we need different communication handles for different
    // num_vectors.
-   hypre_ParCSRPersistentCommHandle *persistent_comm_handle;
-#endif
-
-   if (use_persistent_comm)
+   if (num_vectors == 1)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(2, comm_pkg);
-#endif
+      use_persistent_comm = persistent_comm_handle != NULL;
    }
-   else
+
+   if (!use_persistent_comm)
    {
       comm_handle = hypre_CTAlloc(hypre_ParCSRCommHandle*, num_vectors, HYPRE_MEMORY_HOST);
    }
 
+   /* multivectors on the host: one message per neighbor carries all vectors */
+#if !defined(HYPRE_USING_CUDA) && !defined(HYPRE_USING_DEVICE_OPENMP)
+   use_packed = num_vectors > 1 && !use_persistent_comm;
+#endif
+
    /* y_tmp */
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    /* for GPU and single vector, alloc persistent memory for y_tmp (in comm_pkg) and reuse */
@@ -496,13 +701,16 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
 #else
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       hypre_VectorData(y_tmp) = (HYPRE_Complex *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
       hypre_SeqVectorSetDataOwner(y_tmp, 0);
-#endif
    }
 #endif
 
+   if (use_packed)
+   {
+      hypre_VectorMultiVecStorageMethod(y_tmp) = 1;
+   }
+
    hypre_SeqVectorInitialize_v2(y_tmp, HYPRE_MEMORY_DEVICE);
    y_tmp_data = hypre_VectorData(y_tmp);
 
@@ -511,6 +719,16 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
 
    for (jv = 0; jv < num_vectors; ++jv)
    {
+      if (use_packed)
+      {
+         if (jv == 0)
+         {
+            y_buf_data[0] = hypre_TAlloc(HYPRE_Complex,
+                                         hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends) * num_vectors,
+                                         HYPRE_MEMORY_DEVICE);
+         }
+         continue;
+      }
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
       if (jv == 0)
       {
@@ -531,10 +749,8 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
 #endif
       if (use_persistent_comm)
       {
-#ifdef HYPRE_USING_PERSISTENT_COMM
          y_buf_data[0] = (HYPRE_Complex *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
          continue;
-#endif
       }
 
       y_buf_data[jv] = hypre_TAlloc(HYPRE_Complex,
@@ -565,9 +781,12 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
 
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_DEVICE, y_tmp_data);
-#endif
+   }
+   else if (use_packed)
+   {
+      comm_handle[0] = hypre_ParCSRCommHandleCreateMultiVector( 2, num_vectors, comm_pkg,
+                                                                y_tmp_data, y_buf_data[0] );
    }
    else
    {
@@ -601,9 +820,7 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
    /* nonblocking communication ends */
    if (use_persistent_comm)
    {
-#ifdef HYPRE_USING_PERSISTENT_COMM
       hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_DEVICE, y_buf_data[0]);
-#endif
    }
    else
    {
@@ -629,12 +846,30 @@ hypre_ParCSRMatrixMatvecT( HYPRE_Complex       alpha,
       CommHandleCreate (perhaps a new multivector variant of it).
    */
 
-   hypre_assert( idxstride == 1 );
+   hypre_assert( idxstride == 1 || use_packed );
 
    /* send_map_elmts on device */
    hypre_ParCSRCommPkgCopySendMapElmtsToDevice(comm_pkg);
 
-   for (jv = 0; jv < num_vectors; ++jv)
+   if (use_packed)
+   {
+      HYPRE_Complex *recv_data = (HYPRE_Complex *) y_buf_data[0];
+      HYPRE_Int i, k;
+
+      /* unpack all vectors, entry by entry (entries may repeat: not threaded) */
+      for (i = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+           i < hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+           i ++)
+      {
+         k = hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i) * idxstride;
+         for (jv = 0; jv < num_vectors; ++jv)
+         {
+            y_local_data[jv*vecstride + k] += recv_data[i*num_vectors + jv];
+         }
+      }
+   }
+
+   for (jv = 0; jv < num_vectors && !use_packed; ++jv)
    {
       HYPRE_Complex *recv_data = (HYPRE_Complex *) y_buf_data[jv];
       HYPRE_Complex *locl_data = y_local_data + jv * vecstride;
@@ -0,0 +1,545 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Node-aware (two-level) halo exchanges of ParCSR communication packages
+ *
+ * On the coarse AMG levels every processor talks to many others, and most
+ * messages are short, so the exchanges are dominated by the message counts
+ * between nodes.  A node-aware package routes an entry sent by processor r
+ * on node A to processor p on node B (A != B) through two proxies,
+ *
+ *    stage 1:  r -> a = proxy(A,B)   on-node
+ *    stage 2:  a -> b = proxy(B,A)   inter-node
+ *    stage 3:  b -> p                on-node
+ *
+ * where proxy(A,B) is the processor with local index ord(B) mod size(A) on
+ * node A and ord(B) is the ordinal of node B.  All entries from A to B
+ * thus share one inter-node message, and the inter-node traffic of a node
+ * is spread over its processors.  Entries between processors of the same
+ * node are sent directly in stage 1, and a stage is skipped for an entry
+ * when the processor is its own proxy.
+ *
+ * Each stage is a plain communication package over a work array that holds
+ * the send buffer of the original package followed by the entries received
+ * in the three stages.  Setting up the stages is collective; the exchanges
+ * are blocking and run on host memory only.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNodeAwareStageCreate
+ *
+ * Creates the package of one stage, in which entry e moves from
+ * work[slot[e]] to processor dest[e], and forwards the metadata (original
+ * source processor, final destination processor and position in the
+ * original message) of the entries.  On return, (*recv_src_ptr)[t],
+ * (*recv_dst_ptr)[t] and (*recv_k_ptr)[t] describe the entry received at
+ * position t of the stage.
+ *--------------------------------------------------------------------------*/
+
+static hypre_ParCSRCommPkg *
+hypre_ParCSRNodeAwareStageCreate( MPI_Comm    comm,
+                                  HYPRE_Int   num_procs,
+                                  HYPRE_Int   num_entries,
+                                  HYPRE_Int  *dest,
+                                  HYPRE_Int  *slot,
+                                  HYPRE_Int  *src,
+                                  HYPRE_Int  *dst,
+                                  HYPRE_Int  *k,
+                                  HYPRE_Int **recv_src_ptr,
+                                  HYPRE_Int **recv_dst_ptr,
+                                  HYPRE_Int **recv_k_ptr )
+{
+   hypre_ParCSRCommPkg    *stage_pkg;
+   hypre_ParCSRCommHandle *comm_handle;
+   HYPRE_Int              *send_counts, *recv_counts;
+   HYPRE_Int              *send_procs = NULL, *send_map_starts, *send_map_elmts = NULL;
+   HYPRE_Int              *recv_procs = NULL, *recv_vec_starts;
+   HYPRE_Int              *send_src, *send_dst, *send_k;
+   HYPRE_Int              *recv_src, *recv_dst, *recv_k;
+   HYPRE_Int               num_sends, num_recvs, num_recv_entries;
+   HYPRE_Int               e, q, pos;
+
+   send_counts = hypre_CTAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   recv_counts = hypre_CTAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   for (e = 0; e < num_entries; e++)
+   {
+      send_counts[dest[e]]++;
+   }
+   hypre_MPI_Alltoall(send_counts, 1, HYPRE_MPI_INT, recv_counts, 1, HYPRE_MPI_INT, comm);
+
+   num_sends = 0;
+   num_recvs = 0;
+   for (q = 0; q < num_procs; q++)
+   {
+      num_sends += (send_counts[q] > 0);
+      num_recvs += (recv_counts[q] > 0);
+   }
+
+   /* the entries sorted by destination (stable), one message per processor */
+   send_map_starts = hypre_CTAlloc(HYPRE_Int, num_sends + 1, HYPRE_MEMORY_HOST);
+   if (num_sends)
+   {
+      send_procs = hypre_CTAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+   }
+   num_sends = 0;
+   for (q = 0; q < num_procs; q++)
+   {
+      if (send_counts[q] > 0)
+      {
+         send_procs[num_sends] = q;
+         send_map_starts[num_sends + 1] = send_map_starts[num_sends] + send_counts[q];
+         /* send_counts[q] becomes the next free position of the message to q */
+         send_counts[q] = send_map_starts[num_sends];
+         num_sends++;
+      }
+   }
+
+   if (num_entries)
+   {
+      send_map_elmts = hypre_CTAlloc(HYPRE_Int, num_entries, HYPRE_MEMORY_HOST);
+   }
+   send_src = hypre_CTAlloc(HYPRE_Int, num_entries, HYPRE_MEMORY_HOST);
+   send_dst = hypre_CTAlloc(HYPRE_Int, num_entries, HYPRE_MEMORY_HOST);
+   send_k   = hypre_CTAlloc(HYPRE_Int, num_entries, HYPRE_MEMORY_HOST);
+   for (e = 0; e < num_entries; e++)
+   {
+      pos = send_counts[dest[e]]++;
+      send_map_elmts[pos] = slot[e];
+      send_src[pos] = src[e];
+      send_dst[pos] = dst[e];
+      send_k[pos]   = k[e];
+   }
+
+   recv_vec_starts = hypre_CTAlloc(HYPRE_Int, num_recvs + 1, HYPRE_MEMORY_HOST);
+   if (num_recvs)
+   {
+      recv_procs = hypre_CTAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   }
+   num_recvs = 0;
+   for (q = 0; q < num_procs; q++)
+   {
+      if (recv_counts[q] > 0)
+      {
+         recv_procs[num_recvs] = q;
+         recv_vec_starts[num_recvs + 1] = recv_vec_starts[num_recvs] + recv_counts[q];
+         num_recvs++;
+      }
+   }
+   num_recv_entries = recv_vec_starts[num_recvs];
+
+   stage_pkg = hypre_CTAlloc(hypre_ParCSRCommPkg, 1, HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgComm(stage_pkg)          = comm;
+   hypre_ParCSRCommPkgNumSends(stage_pkg)      = num_sends;
+   hypre_ParCSRCommPkgSendProcs(stage_pkg)     = send_procs;
+   hypre_ParCSRCommPkgSendMapStarts(stage_pkg) = send_map_starts;
+   hypre_ParCSRCommPkgSendMapElmts(stage_pkg)  = send_map_elmts;
+   hypre_ParCSRCommPkgNumRecvs(stage_pkg)      = num_recvs;
+   hypre_ParCSRCommPkgRecvProcs(stage_pkg)     = recv_procs;
+   hypre_ParCSRCommPkgRecvVecStarts(stage_pkg) = recv_vec_starts;
+
+   /* forward the metadata along with the entries */
+   recv_src = hypre_CTAlloc(HYPRE_Int, num_recv_entries, HYPRE_MEMORY_HOST);
+   recv_dst = hypre_CTAlloc(HYPRE_Int, num_recv_entries, HYPRE_MEMORY_HOST);
+   recv_k   = hypre_CTAlloc(HYPRE_Int, num_recv_entries, HYPRE_MEMORY_HOST);
+
+   comm_handle = hypre_ParCSRCommHandleCreate(11, stage_pkg, send_src, recv_src);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+   comm_handle = hypre_ParCSRCommHandleCreate(11, stage_pkg, send_dst, recv_dst);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+   comm_handle = hypre_ParCSRCommHandleCreate(11, stage_pkg, send_k, recv_k);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   hypre_TFree(send_counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_src, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_dst, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_k, HYPRE_MEMORY_HOST);
+
+   *recv_src_ptr = recv_src;
+   *recv_dst_ptr = recv_dst;
+   *recv_k_ptr   = recv_k;
+
+   return stage_pkg;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommPkgCreateNodeAware
+ *
+ * Builds the node-aware routing of the jobs 1 and 2 of comm_pkg (collective
+ * over its communicator).  The nodes are the shared-memory domains of
+ * MPI_Comm_split_type, or groups of consecutive ranks if set with
+ * HYPRE_SetNodeAwareRanksPerNode.  Only for the packages destroyed with
+ * hypre_MatvecCommPkgDestroy.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRCommPkgCreateNodeAware( hypre_ParCSRCommPkg *comm_pkg )
+{
+   MPI_Comm                   comm            = hypre_ParCSRCommPkgComm(comm_pkg);
+   HYPRE_Int                  num_sends       = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int                  num_recvs       = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   HYPRE_Int                 *send_map_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+   HYPRE_Int                 *recv_vec_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+   HYPRE_Int                  ranks_per_node  = hypre_HandleNodeAwareRanksPerNode(hypre_handle());
+   HYPRE_Int                  num_send_entries = send_map_starts[num_sends];
+   HYPRE_Int                  num_recv_entries = recv_vec_starts[num_recvs];
+
+   hypre_ParCSRNodeAwareComm *node_aware;
+   hypre_ParCSRCommPkg       *stage_pkg;
+   HYPRE_Int                  my_id, num_procs;
+   HYPRE_Int                  my_node, node, leader;
+
+   /* nodes, indexed by the rank of their first processor */
+   HYPRE_Int                 *node_of, *node_size, *node_ord, *node_start, *node_ranks;
+   HYPRE_Int                 *recv_proc_index;
+
+   /* entries of the current stage and entries received in the previous one */
+   HYPRE_Int                 *dest, *slot, *src, *dst, *k;
+   HYPRE_Int                 *recv_src, *recv_dst, *recv_k;
+   HYPRE_Int                  num_entries, max_entries, num_stage_recvs;
+   HYPRE_Int                  max_stage_sends;
+   HYPRE_Int                 *final_map;
+   HYPRE_Int                  offset, stage;
+   HYPRE_Int                  i, q, t, p;
+
+   if (hypre_ParCSRCommPkgNodeAware(comm_pkg))
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+   if (num_procs == 1)
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_MemoryStatsPushCategory(HYPRE_MEMORY_CATEGORY_COMM);
+
+   /*-----------------------------------------------------------------------
+    * Node of each processor, and the processors of each node
+    *-----------------------------------------------------------------------*/
+
+   node_of = hypre_CTAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   if (ranks_per_node > 0)
+   {
+      for (q = 0; q < num_procs; q++)
+      {
+         node_of[q] = (q / ranks_per_node) * ranks_per_node;
+      }
+   }
+   else
+   {
+      MPI_Comm node_comm;
+
+      hypre_MPI_Comm_split_type(comm, hypre_MPI_COMM_TYPE_SHARED, my_id,
+                                hypre_MPI_INFO_NULL, &node_comm);
+      hypre_MPI_Allreduce(&my_id, &leader, 1, HYPRE_MPI_INT, hypre_MPI_MIN, node_comm);
+      hypre_MPI_Comm_free(&node_comm);
+      hypre_MPI_Allgather(&leader, 1, HYPRE_MPI_INT, node_of, 1, HYPRE_MPI_INT, comm);
+   }
+   my_node = node_of[my_id];
+
+   node_size  = hypre_CTAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   node_ord   = hypre_CTAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   node_start = hypre_CTAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   node_ranks = hypre_CTAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   for (q = 0; q < num_procs; q++)
+   {
+      node_size[node_of[q]]++;
+   }
+   t = 0;
+   for (q = 0, node = 0; q < num_procs; q++)
+   {
+      if (node_size[q])
+      {
+         node_ord[q]   = node++;
+         node_start[q] = t;
+         t += node_size[q];
+         node_size[q]  = 0;
+      }
+   }
+   for (q = 0; q < num_procs; q++)
+   {
+      node = node_of[q];
+      node_ranks[node_start[node] + node_size[node]++] = q;
+   }
+
+   /* proxy(A,B): the processor of node A that talks to node B */
+#define hypre_NodeAwareProxy(A, B) \
+   node_ranks[node_start[A] + node_ord[B] % node_size[A]]
+
+   /*-----------------------------------------------------------------------
+    * Route the entries of the send buffer through the three stages
+    *-----------------------------------------------------------------------*/
+
+   node_aware = hypre_CTAlloc(hypre_ParCSRNodeAwareComm, 1, HYPRE_MEMORY_HOST);
+
+   recv_proc_index = hypre_CTAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_recvs; i++)
+   {
+      recv_proc_index[hypre_ParCSRCommPkgRecvProc(comm_pkg, i)] = i;
+   }
+   final_map = hypre_CTAlloc(HYPRE_Int, num_recv_entries, HYPRE_MEMORY_HOST);
+
+   max_entries = num_send_entries;
+   dest = hypre_CTAlloc(HYPRE_Int, max_entries, HYPRE_MEMORY_HOST);
+   slot = hypre_CTAlloc(HYPRE_Int, max_entries, HYPRE_MEMORY_HOST);
+   src  = hypre_CTAlloc(HYPRE_Int, max_entries, HYPRE_MEMORY_HOST);
+   dst  = hypre_CTAlloc(HYPRE_Int, max_entries, HYPRE_MEMORY_HOST);
+   k    = hypre_CTAlloc(HYPRE_Int, max_entries, HYPRE_MEMORY_HOST);
+
+   /* stage 1 sends on-node entries directly and the others to the proxy of
+    * this node, unless this processor is that proxy: those entries are held
+    * for stage 2 (at the end of the lists, in reverse order) */
+   num_entries = 0;
+   for (i = 0; i < num_sends; i++)
+   {
+      p = hypre_ParCSRCommPkgSendProc(comm_pkg, i);
+      for (q = send_map_starts[i]; q < send_map_starts[i+1]; q++)
+      {
+         if (node_of[p] == my_node)
+         {
+            t = num_entries++;
+            dest[t] = p;
+         }
+         else if (hypre_NodeAwareProxy(my_node, node_of[p]) != my_id)
+         {
+            t = num_entries++;
+            dest[t] = hypre_NodeAwareProxy(my_node, node_of[p]);
+         }
+         else
+         {
+            t = max_entries - 1 - (q - num_entries);
+            dest[t] = hypre_NodeAwareProxy(node_of[p], my_node);
+         }
+         slot[t] = q;
+         src[t]  = my_id;
+         dst[t]  = p;
+         k[t]    = q - send_map_starts[i];
+      }
+   }
+
+   offset = num_send_entries;
+   max_stage_sends = 0;
+   for (stage = 0; stage < HYPRE_NODE_AWARE_NUM_STAGES; stage++)
+   {
+      stage_pkg = hypre_ParCSRNodeAwareStageCreate(comm, num_procs, num_entries,
+                                                   dest, slot, src, dst, k,
+                                                   &recv_src, &recv_dst, &recv_k);
+      num_stage_recvs = hypre_ParCSRCommPkgRecvVecStart(stage_pkg,
+                                                        hypre_ParCSRCommPkgNumRecvs(stage_pkg));
+      max_stage_sends = hypre_max(max_stage_sends, num_entries);
+
+      hypre_ParCSRNodeAwareCommStagePkg(node_aware, stage)    = stage_pkg;
+      hypre_ParCSRNodeAwareCommStageOffset(node_aware, stage) = offset;
+
+      /* the entries held in stage 1 go first in stage 2 */
+      if (stage == 0)
+      {
+         t = num_entries;
+         num_entries = 0;
+         for (q = t; q < num_send_entries; q++)
+         {
+            dest[num_entries] = dest[q];
+            slot[num_entries] = slot[q];
+            src[num_entries]  = src[q];
+            dst[num_entries]  = dst[q];
+            k[num_entries]    = k[q];
+            num_entries++;
+         }
+      }
+      else
+      {
+         num_entries = 0;
+      }
+
+      if (num_entries + num_stage_recvs > max_entries)
+      {
+         max_entries = num_entries + num_stage_recvs;
+         dest = hypre_TReAlloc(dest, HYPRE_Int, max_entries, HYPRE_MEMORY_HOST);
+         slot = hypre_TReAlloc(slot, HYPRE_Int, max_entries, HYPRE_MEMORY_HOST);
+         src  = hypre_TReAlloc(src,  HYPRE_Int, max_entries, HYPRE_MEMORY_HOST);
+         dst  = hypre_TReAlloc(dst,  HYPRE_Int, max_entries, HYPRE_MEMORY_HOST);
+         k    = hypre_TReAlloc(k,    HYPRE_Int, max_entries, HYPRE_MEMORY_HOST);
+      }
+
+      /* received entries are either final or go on to the next stage:
+       * from the proxy of this node to the proxy of the destination node
+       * (stage 2), and from there to the destination (stage 3) */
+      for (t = 0; t < num_stage_recvs; t++)
+      {
+         if (recv_dst[t] == my_id)
+         {
+            final_map[recv_vec_starts[recv_proc_index[recv_src[t]]] + recv_k[t]] = offset + t;
+            continue;
+         }
+         if (stage == HYPRE_NODE_AWARE_NUM_STAGES - 1)
+         {
+            hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Node-aware routing did not terminate!\n");
+            continue;
+         }
+         p = recv_dst[t];
+         dest[num_entries] = (stage == 0) ? hypre_NodeAwareProxy(node_of[p], my_node) : p;
+         slot[num_entries] = offset + t;
+         src[num_entries]  = recv_src[t];
+         dst[num_entries]  = p;
+         k[num_entries]    = recv_k[t];
+         num_entries++;
+      }
+      offset += num_stage_recvs;
+
+      hypre_TFree(recv_src, HYPRE_MEMORY_HOST);
+      hypre_TFree(recv_dst, HYPRE_MEMORY_HOST);
+      hypre_TFree(recv_k, HYPRE_MEMORY_HOST);
+   }
+
+#undef hypre_NodeAwareProxy
+
+   hypre_ParCSRNodeAwareCommWorkSize(node_aware)   = offset;
+   hypre_ParCSRNodeAwareCommFinalMap(node_aware)   = final_map;
+   hypre_ParCSRNodeAwareCommWork(node_aware)       = hypre_CTAlloc(HYPRE_Complex, offset,
+                                                                   HYPRE_MEMORY_HOST);
+   hypre_ParCSRNodeAwareCommSendBuffer(node_aware) = hypre_CTAlloc(HYPRE_Complex, max_stage_sends,
+                                                                   HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgNodeAware(comm_pkg) = node_aware;
+
+   hypre_TFree(node_of, HYPRE_MEMORY_HOST);
+   hypre_TFree(node_size, HYPRE_MEMORY_HOST);
+   hypre_TFree(node_ord, HYPRE_MEMORY_HOST);
+   hypre_TFree(node_start, HYPRE_MEMORY_HOST);
+   hypre_TFree(node_ranks, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_proc_index, HYPRE_MEMORY_HOST);
+   hypre_TFree(dest, HYPRE_MEMORY_HOST);
+   hypre_TFree(slot, HYPRE_MEMORY_HOST);
+   hypre_TFree(src, HYPRE_MEMORY_HOST);
+   hypre_TFree(dst, HYPRE_MEMORY_HOST);
+   hypre_TFree(k, HYPRE_MEMORY_HOST);
+
+   hypre_MemoryStatsPopCategory();
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRCommPkgDestroyNodeAware
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRCommPkgDestroyNodeAware( hypre_ParCSRCommPkg *comm_pkg )
+{
+   hypre_ParCSRNodeAwareComm *node_aware = hypre_ParCSRCommPkgNodeAware(comm_pkg);
+   HYPRE_Int                  stage;
+
+   if (node_aware)
+   {
+      for (stage = 0; stage < HYPRE_NODE_AWARE_NUM_STAGES; stage++)
+      {
+         hypre_MatvecCommPkgDestroy(hypre_ParCSRNodeAwareCommStagePkg(node_aware, stage));
+      }
+      hypre_TFree(hypre_ParCSRNodeAwareCommFinalMap(node_aware), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRNodeAwareCommWork(node_aware), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRNodeAwareCommSendBuffer(node_aware), HYPRE_MEMORY_HOST);
+      hypre_TFree(node_aware, HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgNodeAware(comm_pkg) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRNodeAwareExchange
+ *
+ * Performs the exchange of job 1 (send_data is the send buffer of comm_pkg,
+ * recv_data receives the offd entries) or job 2 (the reverse) of a
+ * node-aware comm_pkg on host memory.  Blocking.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRNodeAwareExchange( HYPRE_Int            job,
+                               hypre_ParCSRCommPkg *comm_pkg,
+                               HYPRE_Complex       *send_data,
+                               HYPRE_Complex       *recv_data )
+{
+   hypre_ParCSRNodeAwareComm *node_aware  = hypre_ParCSRCommPkgNodeAware(comm_pkg);
+   HYPRE_Int                 *final_map   = hypre_ParCSRNodeAwareCommFinalMap(node_aware);
+   HYPRE_Complex             *work        = hypre_ParCSRNodeAwareCommWork(node_aware);
+   HYPRE_Complex             *send_buffer = hypre_ParCSRNodeAwareCommSendBuffer(node_aware);
+   HYPRE_Int                  num_send_entries;
+   HYPRE_Int                  num_recv_entries;
+   hypre_ParCSRCommPkg       *stage_pkg;
+   hypre_ParCSRCommHandle    *comm_handle;
+   HYPRE_Int                 *send_map_elmts;
+   HYPRE_Int                  num_stage_sends;
+   HYPRE_Int                  stage, i;
+
+   num_send_entries = hypre_ParCSRCommPkgSendMapStart(comm_pkg,
+                                                      hypre_ParCSRCommPkgNumSends(comm_pkg));
+   num_recv_entries = hypre_ParCSRCommPkgRecvVecStart(comm_pkg,
+                                                      hypre_ParCSRCommPkgNumRecvs(comm_pkg));
+
+   if (job == 1)
+   {
+      for (i = 0; i < num_send_entries; i++)
+      {
+         work[i] = send_data[i];
+      }
+      for (stage = 0; stage < HYPRE_NODE_AWARE_NUM_STAGES; stage++)
+      {
+         stage_pkg       = hypre_ParCSRNodeAwareCommStagePkg(node_aware, stage);
+         send_map_elmts  = hypre_ParCSRCommPkgSendMapElmts(stage_pkg);
+         num_stage_sends = hypre_ParCSRCommPkgSendMapStart(stage_pkg,
+                                                           hypre_ParCSRCommPkgNumSends(stage_pkg));
+         for (i = 0; i < num_stage_sends; i++)
+         {
+            send_buffer[i] = work[send_map_elmts[i]];
+         }
+         comm_handle = hypre_ParCSRCommHandleCreate(1, stage_pkg, send_buffer,
+                                                    work + hypre_ParCSRNodeAwareCommStageOffset(node_aware, stage));
+         hypre_ParCSRCommHandleDestroy(comm_handle);
+      }
+      for (i = 0; i < num_recv_entries; i++)
+      {
+         recv_data[i] = work[final_map[i]];
+      }
+   }
+   else
+   {
+      /* every slot of the work array is either final or forwarded exactly
+       * once, so the reverse stages simply assign */
+      for (i = 0; i < num_recv_entries; i++)
+      {
+         work[final_map[i]] = send_data[i];
+      }
+      for (stage = HYPRE_NODE_AWARE_NUM_STAGES - 1; stage >= 0; stage--)
+      {
+         stage_pkg       = hypre_ParCSRNodeAwareCommStagePkg(node_aware, stage);
+         send_map_elmts  = hypre_ParCSRCommPkgSendMapElmts(stage_pkg);
+         num_stage_sends = hypre_ParCSRCommPkgSendMapStart(stage_pkg,
+                                                           hypre_ParCSRCommPkgNumSends(stage_pkg));
+         comm_handle = hypre_ParCSRCommHandleCreate(2, stage_pkg,
+                                                    work + hypre_ParCSRNodeAwareCommStageOffset(node_aware, stage),
+                                                    send_buffer);
+         hypre_ParCSRCommHandleDestroy(comm_handle);
+         for (i = 0; i < num_stage_sends; i++)
+         {
+            work[send_map_elmts[i]] = send_buffer[i];
+         }
+      }
+      for (i = 0; i < num_send_entries; i++)
+      {
+         recv_data[i] = work[i];
+      }
+   }
+
+   return hypre_error_flag;
+}
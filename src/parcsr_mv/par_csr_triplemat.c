@@ -498,6 +498,879 @@ hypre_ParCSRTMatMat( hypre_ParCSRMatrix  *A,
    return hypre_ParCSRTMatMatKT( A, B, 0);
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlan
+ *
+ * Symbolic data of a product C = A*B or C = A^T*B of host matrices, kept to
+ * recompute the values of C for new values of A and B with the same
+ * sparsity patterns:
+ *
+ *   - the columns of the rows of B (or of A_offd^T*B) exchanged with other
+ *     processors, already mapped to the column space of C (C_diag columns
+ *     followed by C_offd columns), and a communication package that only
+ *     exchanges their values;
+ *   - the columns of B_offd in the column space of C;
+ *   - for A^T*B, the patterns of A_diag^T and A_offd^T and the permutations
+ *     that give their values from those of A.
+ *--------------------------------------------------------------------------*/
+
+struct hypre_ParCSRMatMatPlan_struct
+{
+   HYPRE_Int            transpose_A;
+   HYPRE_Int            nnz[6];        /* diag and offd sizes of A, B and C */
+
+   HYPRE_Int           *B_offd_j_C;    /* columns of B_offd in C */
+
+   /* values exchanged with other processors (NULL for one processor) */
+   hypre_ParCSRCommPkg *comm_pkg;
+   HYPRE_Int            num_rows_send;
+   HYPRE_Int           *rows_send;     /* A*B: rows of B sent;
+                                          A^T*B: rows of C receiving C_ext */
+   HYPRE_Complex       *send_data;     /* A*B: values of the rows sent */
+   hypre_CSRMatrix     *ext;           /* A*B: B_ext; A^T*B: C_ext.  Columns
+                                          in the column space of C */
+
+   /* A^T*B */
+   hypre_CSRMatrix     *AT_diag;
+   hypre_CSRMatrix     *AT_offd;
+   HYPRE_Int           *AT_diag_perm;
+   HYPRE_Int           *AT_offd_perm;
+   hypre_CSRMatrix     *C_int;         /* A_offd^T*B, columns of B */
+   HYPRE_Int           *B_offd_j_B;    /* columns of B_offd in C_int */
+};
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatNumericRow
+ *
+ * Accumulates a * B(k,:) into a row of C.  The columns of B are given in the
+ * column space of C (diag columns followed by offd columns) and C_marker
+ * maps this column space to the positions of the row in C_diag
+ * (< num_cols_diag_C) or C_offd.  Returns the number of entries that fall
+ * outside the pattern of C.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatMatNumericRow( HYPRE_Int      num_cols_diag_C,
+                              HYPRE_Int     *C_marker,
+                              HYPRE_Complex *C_diag_data,
+                              HYPRE_Complex *C_offd_data,
+                              HYPRE_Complex  a,
+                              HYPRE_Int      B_begin,
+                              HYPRE_Int      B_end,
+                              HYPRE_Int     *B_j_C,
+                              HYPRE_Complex *B_data )
+{
+   HYPRE_Int missing = 0;
+   HYPRE_Int kk, c, pos;
+
+   for (kk = B_begin; kk < B_end; kk++)
+   {
+      c   = B_j_C[kk];
+      pos = c < 0 ? -1 : C_marker[c];
+      if (pos < 0)
+      {
+         missing++;
+      }
+      else if (c < num_cols_diag_C)
+      {
+         C_diag_data[pos] += a * B_data[kk];
+      }
+      else
+      {
+         C_offd_data[pos] += a * B_data[kk];
+      }
+   }
+
+   return missing;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatNumericRows
+ *
+ * Adds sum_k AL(i,k) * [B1(k,:) B2(k,:)] to row i of C = [C_diag C_offd]
+ * for all rows i of AL, after setting the rows to zero if zero_C is set.
+ * The columns of B1 and B2 are given by B1_j_C and B2_j_C in the column
+ * space of C (the columns of B1 itself if B1_j_C is NULL).  B2 and C_offd
+ * may be NULL.  Returns the number of product entries outside the pattern
+ * of C.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatMatNumericRows( hypre_CSRMatrix *AL,
+                               hypre_CSRMatrix *B1,
+                               HYPRE_Int       *B1_j_C,
+                               hypre_CSRMatrix *B2,
+                               HYPRE_Int       *B2_j_C,
+                               hypre_CSRMatrix *C_diag,
+                               hypre_CSRMatrix *C_offd,
+                               HYPRE_Int        zero_C )
+{
+   HYPRE_Int       *AL_i            = hypre_CSRMatrixI(AL);
+   HYPRE_Int       *AL_j            = hypre_CSRMatrixJ(AL);
+   HYPRE_Complex   *AL_data         = hypre_CSRMatrixData(AL);
+   HYPRE_Int       *B1_i            = hypre_CSRMatrixI(B1);
+   HYPRE_Complex   *B1_data         = hypre_CSRMatrixData(B1);
+   HYPRE_Int       *B2_i            = B2 ? hypre_CSRMatrixI(B2) : NULL;
+   HYPRE_Complex   *B2_data         = B2 ? hypre_CSRMatrixData(B2) : NULL;
+   HYPRE_Int       *C_diag_i        = hypre_CSRMatrixI(C_diag);
+   HYPRE_Int       *C_diag_j        = hypre_CSRMatrixJ(C_diag);
+   HYPRE_Complex   *C_diag_data     = hypre_CSRMatrixData(C_diag);
+   HYPRE_Int       *C_offd_i        = C_offd ? hypre_CSRMatrixI(C_offd) : NULL;
+   HYPRE_Int       *C_offd_j        = C_offd ? hypre_CSRMatrixJ(C_offd) : NULL;
+   HYPRE_Complex   *C_offd_data     = C_offd ? hypre_CSRMatrixData(C_offd) : NULL;
+   HYPRE_Int        num_rows        = hypre_CSRMatrixNumRows(AL);
+   HYPRE_Int        num_cols_diag_C = hypre_CSRMatrixNumCols(C_diag);
+   HYPRE_Int        num_cols_C      = num_cols_diag_C + (C_offd ? hypre_CSRMatrixNumCols(C_offd) : 0);
+   HYPRE_Int        missing         = 0;
+
+   if (!B1_j_C)
+   {
+      B1_j_C = hypre_CSRMatrixJ(B1);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel reduction(+:missing)
+#endif
+   {
+      HYPRE_Int *C_marker = hypre_TAlloc(HYPRE_Int, num_cols_C, HYPRE_MEMORY_HOST);
+      HYPRE_Int  i, jj, k, c;
+
+      for (c = 0; c < num_cols_C; c++)
+      {
+         C_marker[c] = -1;
+      }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         for (jj = C_diag_i[i]; jj < C_diag_i[i+1]; jj++)
+         {
+            C_marker[C_diag_j[jj]] = jj;
+            if (zero_C)
+            {
+               C_diag_data[jj] = 0.0;
+            }
+         }
+         if (C_offd)
+         {
+            for (jj = C_offd_i[i]; jj < C_offd_i[i+1]; jj++)
+            {
+               C_marker[num_cols_diag_C + C_offd_j[jj]] = jj;
+               if (zero_C)
+               {
+                  C_offd_data[jj] = 0.0;
+               }
+            }
+         }
+
+         for (jj = AL_i[i]; jj < AL_i[i+1]; jj++)
+         {
+            k = AL_j[jj];
+            missing += hypre_ParCSRMatMatNumericRow(num_cols_diag_C, C_marker,
+                                                    C_diag_data, C_offd_data, AL_data[jj],
+                                                    B1_i[k], B1_i[k+1], B1_j_C, B1_data);
+            if (B2)
+            {
+               missing += hypre_ParCSRMatMatNumericRow(num_cols_diag_C, C_marker,
+                                                       C_diag_data, C_offd_data, AL_data[jj],
+                                                       B2_i[k], B2_i[k+1], B2_j_C, B2_data);
+            }
+         }
+
+         for (jj = C_diag_i[i]; jj < C_diag_i[i+1]; jj++)
+         {
+            C_marker[C_diag_j[jj]] = -1;
+         }
+         if (C_offd)
+         {
+            for (jj = C_offd_i[i]; jj < C_offd_i[i+1]; jj++)
+            {
+               C_marker[num_cols_diag_C + C_offd_j[jj]] = -1;
+            }
+         }
+      }
+
+      hypre_TFree(C_marker, HYPRE_MEMORY_HOST);
+   }
+
+   return missing;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixColToLocal
+ *
+ * Maps the global columns col[0:n] to the column space of C, i.e. column
+ * index in C_diag, or num_cols_diag_C + column index in C_offd, or -1 if
+ * the column is in neither.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRMatrixColToLocal( hypre_ParCSRMatrix *C,
+                              HYPRE_Int           n,
+                              HYPRE_BigInt       *col,
+                              HYPRE_Int          *col_C )
+{
+   HYPRE_BigInt  first_col_diag  = hypre_ParCSRMatrixFirstColDiag(C);
+   HYPRE_Int     num_cols_diag   = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixDiag(C));
+   HYPRE_Int     num_cols_offd   = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(C));
+   HYPRE_BigInt *col_map_offd    = hypre_ParCSRMatrixColMapOffd(C);
+   HYPRE_Int     i, k;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,k) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < n; i++)
+   {
+      if (col[i] >= first_col_diag && col[i] < first_col_diag + num_cols_diag)
+      {
+         col_C[i] = (HYPRE_Int) (col[i] - first_col_diag);
+      }
+      else
+      {
+         k = hypre_BigBinarySearch(col_map_offd, col[i], num_cols_offd);
+         col_C[i] = k < 0 ? -1 : num_cols_diag + k;
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatExtToLocal
+ *
+ * Replaces the global columns of the exchanged rows ext by their columns in
+ * the column space of C, and allocates its values.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRMatMatExtToLocal( hypre_CSRMatrix    *ext,
+                              hypre_ParCSRMatrix *C )
+{
+   HYPRE_Int  nnz = hypre_CSRMatrixI(ext)[hypre_CSRMatrixNumRows(ext)];
+   HYPRE_Int *ext_j;
+
+   ext_j = hypre_TAlloc(HYPRE_Int, nnz, HYPRE_MEMORY_HOST);
+   hypre_ParCSRMatrixColToLocal(C, nnz, hypre_CSRMatrixBigJ(ext), ext_j);
+
+   hypre_TFree(hypre_CSRMatrixBigJ(ext), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_CSRMatrixData(ext), HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixBigJ(ext)        = NULL;
+   hypre_CSRMatrixJ(ext)           = ext_j;
+   hypre_CSRMatrixData(ext)        = hypre_CTAlloc(HYPRE_Complex, nnz, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixNumNonzeros(ext) = nnz;
+   hypre_CSRMatrixNumCols(ext)     = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixDiag(C)) +
+                                     hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(C));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixTransposePerm
+ *
+ * Builds AT = A^T and perm such that AT_data[k] = A_data[perm[k]].  The
+ * columns in each row of AT are in increasing order.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_CSRMatrixTransposePerm( hypre_CSRMatrix  *A,
+                              hypre_CSRMatrix **AT_ptr,
+                              HYPRE_Int       **perm_ptr )
+{
+   HYPRE_Int        num_rows = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int        num_cols = hypre_CSRMatrixNumCols(A);
+   HYPRE_Int       *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int       *A_j      = hypre_CSRMatrixJ(A);
+   HYPRE_Int        nnz      = A_i[num_rows];
+   hypre_CSRMatrix *AT;
+   HYPRE_Int       *AT_i, *AT_j, *perm;
+   HYPRE_Int        i, jj, pos;
+
+   AT = hypre_CSRMatrixCreate(num_cols, num_rows, nnz);
+   hypre_CSRMatrixInitialize_v2(AT, 0, HYPRE_MEMORY_HOST);
+   AT_i = hypre_CSRMatrixI(AT);
+   AT_j = hypre_CSRMatrixJ(AT);
+   perm = hypre_TAlloc(HYPRE_Int, nnz, HYPRE_MEMORY_HOST);
+
+   for (jj = 0; jj < nnz; jj++)
+   {
+      AT_i[A_j[jj]+1]++;
+   }
+   for (i = 0; i < num_cols; i++)
+   {
+      AT_i[i+1] += AT_i[i];
+   }
+   for (i = 0; i < num_rows; i++)
+   {
+      for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+      {
+         pos = AT_i[A_j[jj]]++;
+         AT_j[pos] = i;
+         perm[pos] = jj;
+      }
+   }
+   for (i = num_cols; i > 0; i--)
+   {
+      AT_i[i] = AT_i[i-1];
+   }
+   AT_i[0] = 0;
+
+   *AT_ptr   = AT;
+   *perm_ptr = perm;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlanCommPkg
+ *
+ * Communication package for the values of exchanged CSR rows, given the
+ * row pointers of the rows sent and received, and the package comm_pkg of
+ * the row exchange itself (reversed if reverse is set).  The package owns
+ * copies of all its arrays.
+ *--------------------------------------------------------------------------*/
+
+static hypre_ParCSRCommPkg *
+hypre_ParCSRMatMatPlanCommPkg( hypre_ParCSRCommPkg *comm_pkg,
+                               HYPRE_Int            reverse,
+                               HYPRE_Int           *send_row_i,
+                               HYPRE_Int           *recv_row_i )
+{
+   hypre_ParCSRCommPkg *comm_pkg_j = hypre_CTAlloc(hypre_ParCSRCommPkg, 1, HYPRE_MEMORY_HOST);
+   HYPRE_Int            num_sends, num_recvs, i;
+   HYPRE_Int           *send_procs, *recv_procs, *send_row_starts, *recv_row_starts;
+
+   if (reverse)
+   {
+      num_sends       = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+      num_recvs       = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      send_procs      = hypre_ParCSRCommPkgRecvProcs(comm_pkg);
+      recv_procs      = hypre_ParCSRCommPkgSendProcs(comm_pkg);
+      send_row_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+      recv_row_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+   }
+   else
+   {
+      num_sends       = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      num_recvs       = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+      send_procs      = hypre_ParCSRCommPkgSendProcs(comm_pkg);
+      recv_procs      = hypre_ParCSRCommPkgRecvProcs(comm_pkg);
+      send_row_starts = hypre_ParCSRCommPkgSendMapStarts(comm_pkg);
+      recv_row_starts = hypre_ParCSRCommPkgRecvVecStarts(comm_pkg);
+   }
+
+   hypre_ParCSRCommPkgComm(comm_pkg_j)          = hypre_ParCSRCommPkgComm(comm_pkg);
+   hypre_ParCSRCommPkgNumSends(comm_pkg_j)      = num_sends;
+   hypre_ParCSRCommPkgNumRecvs(comm_pkg_j)      = num_recvs;
+   hypre_ParCSRCommPkgSendProcs(comm_pkg_j)     = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgRecvProcs(comm_pkg_j)     = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgSendMapStarts(comm_pkg_j) = hypre_TAlloc(HYPRE_Int, num_sends+1, HYPRE_MEMORY_HOST);
+   hypre_ParCSRCommPkgRecvVecStarts(comm_pkg_j) = hypre_TAlloc(HYPRE_Int, num_recvs+1, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < num_sends; i++)
+   {
+      hypre_ParCSRCommPkgSendProc(comm_pkg_j, i) = send_procs[i];
+   }
+   for (i = 0; i <= num_sends; i++)
+   {
+      hypre_ParCSRCommPkgSendMapStart(comm_pkg_j, i) = send_row_i[send_row_starts[i]];
+   }
+   for (i = 0; i < num_recvs; i++)
+   {
+      hypre_ParCSRCommPkgRecvProc(comm_pkg_j, i) = recv_procs[i];
+   }
+   for (i = 0; i <= num_recvs; i++)
+   {
+      hypre_ParCSRCommPkgRecvVecStart(comm_pkg_j, i) = recv_row_i[recv_row_starts[i]];
+   }
+
+   return comm_pkg_j;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlanSizes
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_ParCSRMatMatPlanSizes( hypre_ParCSRMatrix *A,
+                             hypre_ParCSRMatrix *B,
+                             hypre_ParCSRMatrix *C,
+                             HYPRE_Int          *nnz )
+{
+   nnz[0] = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(A));
+   nnz[1] = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(A));
+   nnz[2] = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(B));
+   nnz[3] = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(B));
+   nnz[4] = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(C));
+   nnz[5] = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(C));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlanCheck
+ *
+ * Common argument checks of the numeric products: host matrices with
+ * double precision values, and C not aliasing A or B.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatMatPlanCheck( hypre_ParCSRMatrix *A,
+                             hypre_ParCSRMatrix *B,
+                             hypre_ParCSRMatrix *C )
+{
+   hypre_ParCSRMatrix *M[3];
+   hypre_CSRMatrix    *M_diag, *M_offd;
+   HYPRE_Int           i;
+
+   M[0] = A; M[1] = B; M[2] = C;
+   for (i = 0; i < 3; i++)
+   {
+      M_diag = M[i] ? hypre_ParCSRMatrixDiag(M[i]) : NULL;
+      M_offd = M[i] ? hypre_ParCSRMatrixOffd(M[i]) : NULL;
+      if (!M[i] ||
+          hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(M[i])) != hypre_MEMORY_HOST ||
+          (hypre_CSRMatrixNumNonzeros(M_diag) && !hypre_CSRMatrixData(M_diag)) ||
+          (hypre_CSRMatrixNumNonzeros(M_offd) && !hypre_CSRMatrixData(M_offd)))
+      {
+         hypre_error_in_arg((i+1));
+         return hypre_error_flag;
+      }
+   }
+
+   if (C == A || C == B)
+   {
+      hypre_error_in_arg(3);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlanCreate
+ *
+ * Creates the plan of the product C = A*B (transpose_A = 0) or C = A^T*B
+ * (transpose_A = 1), where C was computed by hypre_ParCSRMatMat or
+ * hypre_ParCSRTMatMat(KT) (or has a pattern containing the product).  The
+ * plan does not reference A, B or C; hypre_ParCSRMatMatPlanExecute accepts
+ * any matrices with the same sparsity patterns and partitionings.  Host
+ * only.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatMatPlanCreate( hypre_ParCSRMatrix      *A,
+                              hypre_ParCSRMatrix      *B,
+                              hypre_ParCSRMatrix      *C,
+                              HYPRE_Int                transpose_A,
+                              hypre_ParCSRMatMatPlan **plan_ptr )
+{
+   MPI_Comm                comm            = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix        *A_diag          = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix        *A_offd          = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix        *B_diag          = hypre_ParCSRMatrixDiag(B);
+   hypre_CSRMatrix        *B_offd          = hypre_ParCSRMatrixOffd(B);
+   HYPRE_Int               num_cols_diag_B = hypre_CSRMatrixNumCols(B_diag);
+   HYPRE_Int               num_cols_offd_B = hypre_CSRMatrixNumCols(B_offd);
+   HYPRE_Int               nnz_offd_B      = hypre_CSRMatrixNumNonzeros(B_offd);
+   hypre_ParCSRMatMatPlan *plan;
+   hypre_ParCSRCommPkg    *comm_pkg_A      = NULL;
+   HYPRE_Int              *map_B_to_C;
+   HYPRE_Int               num_procs, i;
+
+   *plan_ptr = NULL;
+
+   if (hypre_ParCSRMatMatPlanCheck(A, B, C))
+   {
+      return hypre_error_flag;
+   }
+
+   if ((!transpose_A &&
+        (hypre_CSRMatrixNumCols(A_diag) != hypre_CSRMatrixNumRows(B_diag) ||
+         hypre_CSRMatrixNumRows(A_diag) != hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(C)))) ||
+       (transpose_A &&
+        (hypre_CSRMatrixNumRows(A_diag) != hypre_CSRMatrixNumRows(B_diag) ||
+         hypre_CSRMatrixNumCols(A_diag) != hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(C)))) ||
+       hypre_ParCSRMatrixFirstColDiag(B) != hypre_ParCSRMatrixFirstColDiag(C) ||
+       num_cols_diag_B != hypre_CSRMatrixNumCols(hypre_ParCSRMatrixDiag(C)))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Incompatible matrix dimensions!\n");
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   plan = hypre_CTAlloc(hypre_ParCSRMatMatPlan, 1, HYPRE_MEMORY_HOST);
+   plan->transpose_A = transpose_A;
+   hypre_ParCSRMatMatPlanSizes(A, B, C, plan->nnz);
+
+   /* columns of B_offd in the column space of C */
+   map_B_to_C = hypre_TAlloc(HYPRE_Int, num_cols_offd_B, HYPRE_MEMORY_HOST);
+   hypre_ParCSRMatrixColToLocal(C, num_cols_offd_B, hypre_ParCSRMatrixColMapOffd(B), map_B_to_C);
+   plan->B_offd_j_C = hypre_TAlloc(HYPRE_Int, nnz_offd_B, HYPRE_MEMORY_HOST);
+   for (i = 0; i < nnz_offd_B; i++)
+   {
+      plan->B_offd_j_C[i] = map_B_to_C[hypre_CSRMatrixJ(B_offd)[i]];
+   }
+   hypre_TFree(map_B_to_C, HYPRE_MEMORY_HOST);
+
+   if (num_procs > 1)
+   {
+      if (!hypre_ParCSRMatrixCommPkg(A))
+      {
+         hypre_MatvecCommPkgCreate(A);
+      }
+      comm_pkg_A = hypre_ParCSRMatrixCommPkg(A);
+      plan->num_rows_send = hypre_ParCSRCommPkgSendMapStart(comm_pkg_A,
+                                                            hypre_ParCSRCommPkgNumSends(comm_pkg_A));
+      plan->rows_send = hypre_TAlloc(HYPRE_Int, plan->num_rows_send, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(plan->rows_send, hypre_ParCSRCommPkgSendMapElmts(comm_pkg_A), HYPRE_Int,
+                    plan->num_rows_send, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   }
+
+   if (!transpose_A)
+   {
+      /* rows of B for the columns of A_offd, with diag columns first in
+       * each row (see hypre_ParcsrGetExternalRowsInit) */
+      if (num_procs > 1)
+      {
+         HYPRE_Int *B_diag_i = hypre_CSRMatrixI(B_diag);
+         HYPRE_Int *B_offd_i = hypre_CSRMatrixI(B_offd);
+         HYPRE_Int *send_row_i;
+         void      *request;
+
+         hypre_ParcsrGetExternalRowsInit(B, hypre_CSRMatrixNumCols(A_offd),
+                                         hypre_ParCSRMatrixColMapOffd(A), comm_pkg_A, 0, &request);
+         plan->ext = hypre_ParcsrGetExternalRowsWait(request);
+         hypre_ParCSRMatMatExtToLocal(plan->ext, C);
+
+         send_row_i = hypre_TAlloc(HYPRE_Int, plan->num_rows_send+1, HYPRE_MEMORY_HOST);
+         send_row_i[0] = 0;
+         for (i = 0; i < plan->num_rows_send; i++)
+         {
+            HYPRE_Int row = plan->rows_send[i];
+            send_row_i[i+1] = send_row_i[i] + B_diag_i[row+1] - B_diag_i[row] +
+                              B_offd_i[row+1] - B_offd_i[row];
+         }
+         plan->comm_pkg  = hypre_ParCSRMatMatPlanCommPkg(comm_pkg_A, 0, send_row_i,
+                                                          hypre_CSRMatrixI(plan->ext));
+         plan->send_data = hypre_TAlloc(HYPRE_Complex, send_row_i[plan->num_rows_send],
+                                        HYPRE_MEMORY_HOST);
+         hypre_TFree(send_row_i, HYPRE_MEMORY_HOST);
+      }
+   }
+   else
+   {
+      hypre_CSRMatrixTransposePerm(A_diag, &plan->AT_diag, &plan->AT_diag_perm);
+
+      /* rows of A_offd^T*B, sent to the owners of the columns of A_offd */
+      if (num_procs > 1)
+      {
+         hypre_CSRMatrix *C_int_diag, *C_int_offd, *C_int;
+         void            *request;
+
+         hypre_CSRMatrixTransposePerm(A_offd, &plan->AT_offd, &plan->AT_offd_perm);
+
+         C_int_diag = hypre_CSRMatrixMultiply(plan->AT_offd, B_diag);
+         C_int_offd = hypre_CSRMatrixMultiply(plan->AT_offd, B_offd);
+         hypre_ParCSRMatrixDiag(B) = C_int_diag;
+         hypre_ParCSRMatrixOffd(B) = C_int_offd;
+         C_int = hypre_MergeDiagAndOffd(B);
+         hypre_ParCSRMatrixDiag(B) = B_diag;
+         hypre_ParCSRMatrixOffd(B) = B_offd;
+         hypre_CSRMatrixDestroy(C_int_diag);
+         hypre_CSRMatrixDestroy(C_int_offd);
+
+         hypre_ExchangeExternalRowsInit(C_int, comm_pkg_A, &request);
+         plan->ext = hypre_ExchangeExternalRowsWait(request);
+         hypre_ParCSRMatMatExtToLocal(plan->ext, C);
+
+         /* C_int with the columns of B, in the order sent */
+         hypre_ParCSRMatMatExtToLocal(C_int, B);
+         plan->C_int = C_int;
+         plan->B_offd_j_B = hypre_TAlloc(HYPRE_Int, nnz_offd_B, HYPRE_MEMORY_HOST);
+         for (i = 0; i < nnz_offd_B; i++)
+         {
+            plan->B_offd_j_B[i] = num_cols_diag_B + hypre_CSRMatrixJ(B_offd)[i];
+         }
+
+         plan->comm_pkg = hypre_ParCSRMatMatPlanCommPkg(comm_pkg_A, 1, hypre_CSRMatrixI(C_int),
+                                                         hypre_CSRMatrixI(plan->ext));
+      }
+   }
+
+   *plan_ptr = plan;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlanDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatMatPlanDestroy( hypre_ParCSRMatMatPlan *plan )
+{
+   if (plan)
+   {
+      if (plan->comm_pkg)
+      {
+         hypre_TFree(hypre_ParCSRCommPkgSendProcs(plan->comm_pkg), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParCSRCommPkgRecvProcs(plan->comm_pkg), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParCSRCommPkgSendMapStarts(plan->comm_pkg), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_ParCSRCommPkgRecvVecStarts(plan->comm_pkg), HYPRE_MEMORY_HOST);
+         hypre_TFree(plan->comm_pkg, HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(plan->B_offd_j_C, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan->rows_send, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan->send_data, HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixDestroy(plan->ext);
+      hypre_CSRMatrixDestroy(plan->AT_diag);
+      hypre_CSRMatrixDestroy(plan->AT_offd);
+      hypre_TFree(plan->AT_diag_perm, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan->AT_offd_perm, HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixDestroy(plan->C_int);
+      hypre_TFree(plan->B_offd_j_B, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatPlanExecute
+ *
+ * Recomputes the values of C = A*B or C = A^T*B in place with the plan of
+ * the product.  Only the values are exchanged with other processors; the
+ * local products overlap with the exchange.  An error is returned if a
+ * product entry falls outside the pattern of C.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatMatPlanExecute( hypre_ParCSRMatMatPlan *plan,
+                               hypre_ParCSRMatrix     *A,
+                               hypre_ParCSRMatrix     *B,
+                               hypre_ParCSRMatrix     *C )
+{
+   hypre_CSRMatrix        *A_diag = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix        *A_offd = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix        *B_diag = hypre_ParCSRMatrixDiag(B);
+   hypre_CSRMatrix        *B_offd = hypre_ParCSRMatrixOffd(B);
+   hypre_CSRMatrix        *C_diag = hypre_ParCSRMatrixDiag(C);
+   hypre_CSRMatrix        *C_offd = hypre_ParCSRMatrixOffd(C);
+   hypre_CSRMatrix        *ext;
+   hypre_ParCSRCommHandle *comm_handle = NULL;
+   HYPRE_Int               nnz[6];
+   HYPRE_Int               missing = 0;
+   HYPRE_Int               i;
+
+   if (!plan)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (hypre_ParCSRMatMatPlanCheck(A, B, C))
+   {
+      return hypre_error_flag;
+   }
+
+   hypre_ParCSRMatMatPlanSizes(A, B, C, nnz);
+   for (i = 0; i < 6; i++)
+   {
+      if (nnz[i] != plan->nnz[i])
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Sparsity patterns differ from the plan!\n");
+         return hypre_error_flag;
+      }
+   }
+
+   ext = plan->ext;
+
+   if (!plan->transpose_A)
+   {
+      /* values of the rows of B needed by other processors */
+      if (plan->comm_pkg)
+      {
+         HYPRE_Int     *B_diag_i    = hypre_CSRMatrixI(B_diag);
+         HYPRE_Complex *B_diag_data = hypre_CSRMatrixData(B_diag);
+         HYPRE_Int     *B_offd_i    = hypre_CSRMatrixI(B_offd);
+         HYPRE_Complex *B_offd_data = hypre_CSRMatrixData(B_offd);
+         HYPRE_Complex *send_data   = plan->send_data;
+         HYPRE_Int      row, jj, k = 0;
+
+         for (i = 0; i < plan->num_rows_send; i++)
+         {
+            row = plan->rows_send[i];
+            for (jj = B_diag_i[row]; jj < B_diag_i[row+1]; jj++)
+            {
+               send_data[k++] = B_diag_data[jj];
+            }
+            for (jj = B_offd_i[row]; jj < B_offd_i[row+1]; jj++)
+            {
+               send_data[k++] = B_offd_data[jj];
+            }
+         }
+
+         comm_handle = hypre_ParCSRCommHandleCreate(1, plan->comm_pkg, send_data,
+                                                    hypre_CSRMatrixData(ext));
+      }
+
+      missing = hypre_ParCSRMatMatNumericRows(A_diag, B_diag, NULL, B_offd, plan->B_offd_j_C,
+                                              C_diag, C_offd, 1);
+
+      if (comm_handle)
+      {
+         hypre_ParCSRCommHandleDestroy(comm_handle);
+         missing += hypre_ParCSRMatMatNumericRows(A_offd, ext, NULL, NULL, NULL,
+                                                  C_diag, C_offd, 0);
+      }
+   }
+   else
+   {
+      hypre_CSRMatrix *AT_diag      = plan->AT_diag;
+      HYPRE_Complex   *AT_diag_data = hypre_CSRMatrixData(AT_diag);
+      HYPRE_Complex   *A_diag_data  = hypre_CSRMatrixData(A_diag);
+
+      /* rows of A_offd^T*B for other processors */
+      if (plan->comm_pkg)
+      {
+         hypre_CSRMatrix *AT_offd      = plan->AT_offd;
+         HYPRE_Complex   *AT_offd_data = hypre_CSRMatrixData(AT_offd);
+         HYPRE_Complex   *A_offd_data  = hypre_CSRMatrixData(A_offd);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < plan->nnz[1]; i++)
+         {
+            AT_offd_data[i] = A_offd_data[plan->AT_offd_perm[i]];
+         }
+
+         missing = hypre_ParCSRMatMatNumericRows(AT_offd, B_diag, NULL, B_offd, plan->B_offd_j_B,
+                                                 plan->C_int, NULL, 1);
+
+         comm_handle = hypre_ParCSRCommHandleCreate(1, plan->comm_pkg,
+                                                    hypre_CSRMatrixData(plan->C_int),
+                                                    hypre_CSRMatrixData(ext));
+      }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < plan->nnz[0]; i++)
+      {
+         AT_diag_data[i] = A_diag_data[plan->AT_diag_perm[i]];
+      }
+
+      missing += hypre_ParCSRMatMatNumericRows(AT_diag, B_diag, NULL, B_offd, plan->B_offd_j_C,
+                                               C_diag, C_offd, 1);
+
+      /* add the received rows; several of them may go to the same row of C */
+      if (comm_handle)
+      {
+         HYPRE_Int     *C_diag_i        = hypre_CSRMatrixI(C_diag);
+         HYPRE_Int     *C_diag_j        = hypre_CSRMatrixJ(C_diag);
+         HYPRE_Int     *C_offd_i        = hypre_CSRMatrixI(C_offd);
+         HYPRE_Int     *C_offd_j        = hypre_CSRMatrixJ(C_offd);
+         HYPRE_Int      num_cols_diag_C = hypre_CSRMatrixNumCols(C_diag);
+         HYPRE_Int      num_cols_C      = hypre_CSRMatrixNumCols(ext);
+         HYPRE_Int     *ext_i           = hypre_CSRMatrixI(ext);
+         HYPRE_Int     *C_marker;
+         HYPRE_Int      row, jj;
+
+         hypre_ParCSRCommHandleDestroy(comm_handle);
+
+         C_marker = hypre_TAlloc(HYPRE_Int, num_cols_C, HYPRE_MEMORY_HOST);
+         for (i = 0; i < num_cols_C; i++)
+         {
+            C_marker[i] = -1;
+         }
+
+         for (i = 0; i < plan->num_rows_send; i++)
+         {
+            row = plan->rows_send[i];
+            for (jj = C_diag_i[row]; jj < C_diag_i[row+1]; jj++)
+            {
+               C_marker[C_diag_j[jj]] = jj;
+            }
+            for (jj = C_offd_i[row]; jj < C_offd_i[row+1]; jj++)
+            {
+               C_marker[num_cols_diag_C + C_offd_j[jj]] = jj;
+            }
+
+            missing += hypre_ParCSRMatMatNumericRow(num_cols_diag_C, C_marker,
+                                                    hypre_CSRMatrixData(C_diag),
+                                                    hypre_CSRMatrixData(C_offd), 1.0,
+                                                    ext_i[i], ext_i[i+1],
+                                                    hypre_CSRMatrixJ(ext),
+                                                    hypre_CSRMatrixData(ext));
+
+            for (jj = C_diag_i[row]; jj < C_diag_i[row+1]; jj++)
+            {
+               C_marker[C_diag_j[jj]] = -1;
+            }
+            for (jj = C_offd_i[row]; jj < C_offd_i[row+1]; jj++)
+            {
+               C_marker[num_cols_diag_C + C_offd_j[jj]] = -1;
+            }
+         }
+
+         hypre_TFree(C_marker, HYPRE_MEMORY_HOST);
+      }
+   }
+
+   hypre_ParCSRMatrixValuesChanged(C);
+
+   if (missing)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Product entry outside the sparsity pattern of C!\n");
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatNumeric
+ *
+ * Recomputes the values of C = A*B in place, where C was computed by
+ * hypre_ParCSRMatMat from matrices with the same sparsity patterns as A
+ * and B.  Builds and discards a plan; keep a hypre_ParCSRMatMatPlan for
+ * repeated products.  Host only.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatMatNumeric( hypre_ParCSRMatrix *A,
+                           hypre_ParCSRMatrix *B,
+                           hypre_ParCSRMatrix *C )
+{
+   hypre_ParCSRMatMatPlan *plan;
+
+   if (!hypre_ParCSRMatMatPlanCreate(A, B, C, 0, &plan))
+   {
+      hypre_ParCSRMatMatPlanExecute(plan, A, B, C);
+   }
+   hypre_ParCSRMatMatPlanDestroy(plan);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRTMatMatNumeric
+ *
+ * Recomputes the values of C = A^T*B in place, where C was computed by
+ * hypre_ParCSRTMatMat(KT) from matrices with the same sparsity patterns as
+ * A and B.  Builds and discards a plan.  Host only.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRTMatMatNumeric( hypre_ParCSRMatrix *A,
+                            hypre_ParCSRMatrix *B,
+                            hypre_ParCSRMatrix *C )
+{
+   hypre_ParCSRMatMatPlan *plan;
+
+   if (!hypre_ParCSRMatMatPlanCreate(A, B, C, 1, &plan))
+   {
+      hypre_ParCSRMatMatPlanExecute(plan, A, B, C);
+   }
+   hypre_ParCSRMatMatPlanDestroy(plan);
+
+   return hypre_error_flag;
+}
+
 hypre_ParCSRMatrix *hypre_ParCSRMatrixRAPKT( hypre_ParCSRMatrix *R,
                                              hypre_ParCSRMatrix *A,
                                              hypre_ParCSRMatrix *P,
@@ -542,6 +542,49 @@ hypre_ParVectorMassInnerProd( hypre_ParVector  *x,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorBlockInnerProd
+ *
+ * result[j*nx+i] = <x[i],y[j]> for all i < nx and j < ny, with a single
+ * global reduction.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorBlockInnerProd( HYPRE_Int         nx,
+                               hypre_ParVector **x,
+                               HYPRE_Int         ny,
+                               hypre_ParVector **y,
+                               HYPRE_Real       *result )
+{
+   MPI_Comm      comm = hypre_ParVectorComm(x[0]);
+   HYPRE_Real   *local_result;
+   HYPRE_Int     i, j;
+
+   local_result = hypre_CTAlloc(HYPRE_Real, nx*ny, HYPRE_MEMORY_HOST);
+
+   for (j = 0; j < ny; j++)
+   {
+      for (i = 0; i < nx; i++)
+      {
+         local_result[j*nx+i] = hypre_SeqVectorInnerProd(hypre_ParVectorLocalVector(x[i]),
+                                                         hypre_ParVectorLocalVector(y[j]));
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] -= hypre_MPI_Wtime();
+#endif
+   hypre_MPI_Allreduce(local_result, result, nx*ny, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, comm);
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_ALL_REDUCE] += hypre_MPI_Wtime();
+#endif
+
+   hypre_TFree(local_result, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParVectorMassDotpTwo
  *--------------------------------------------------------------------------*/
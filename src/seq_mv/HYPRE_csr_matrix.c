@@ -95,6 +95,45 @@ HYPRE_CSRMatrixGetNumRows( HYPRE_CSRMatrix matrix, HYPRE_Int *num_rows )
    return 0;
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_CSRMatrixSetSellCSigma
+ *
+ * chunk_size > 0 enables the SELL-C-sigma shadow format of the matrix
+ * (C = chunk_size, sigma = sort_scope) in the host matvec; chunk_size = 0
+ * disables it.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_CSRMatrixSetSellCSigma( HYPRE_CSRMatrix matrix,
+                              HYPRE_Int       chunk_size,
+                              HYPRE_Int       sort_scope )
+{
+   return( hypre_CSRMatrixSetSellCSigma( (hypre_CSRMatrix *) matrix,
+                                         chunk_size, sort_scope ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_CSRMatrixHostSpGemmSetAlgorithm
+ *
+ * Global option: accumulator of the host sparse matrix-matrix product.
+ * 0 chooses it per row from the number of products (default), 1 dense,
+ * 2 hash, 3 expand-sort-compress.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_CSRMatrixHostSpGemmSetAlgorithm( HYPRE_Int value )
+{
+   if (value < HYPRE_SPGEMM_HOST_AUTO || value > HYPRE_SPGEMM_HOST_ESC)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_HandleSpgemmHostAlgorithm(hypre_handle()) = value;
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 HYPRE_CSRMatrixDeviceSpGemmSetRownnzEstimateMethod( HYPRE_Int value )
 {
@@ -78,6 +78,8 @@ HYPRE_Int HYPRE_VectorInitialize( HYPRE_Vector vector );
 HYPRE_Int HYPRE_VectorPrint( HYPRE_Vector vector , char *file_name );
 HYPRE_Vector HYPRE_VectorRead( char *file_name );
 
+HYPRE_Int HYPRE_CSRMatrixSetSellCSigma( HYPRE_CSRMatrix matrix, HYPRE_Int chunk_size, HYPRE_Int sort_scope );
+HYPRE_Int HYPRE_CSRMatrixHostSpGemmSetAlgorithm( HYPRE_Int value );
 HYPRE_Int HYPRE_CSRMatrixDeviceSpGemmSetRownnzEstimateMethod( HYPRE_Int value );
 HYPRE_Int HYPRE_CSRMatrixDeviceSpGemmSetRownnzEstimateNSamples( HYPRE_Int value );
 HYPRE_Int HYPRE_CSRMatrixDeviceSpGemmSetRownnzEstimateMultFactor( HYPRE_Real value );
@@ -13,6 +13,7 @@
 
 #include "seq_mv.h"
 #include "csr_matrix.h"
+#include "hypre_hopscotch_hash.h"
 
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixAdd:
@@ -284,6 +285,327 @@ hypre_CSRMatrixBigAdd( hypre_CSRMatrix *A,
    return C;
 }
 
+/*--------------------------------------------------------------------------
+ * Accumulators of the host sparse matrix-matrix product
+ *
+ * Each row of C = A*B is formed with one of three accumulators, chosen
+ * from the number of products of the row (an upper bound of its number of
+ * nonzeros):
+ *
+ *   dense: a marker array over the columns of B, allocated per thread.
+ *          Used unless B is very wide (the array would not stay in cache
+ *          and costs memory per thread) and the row is sparse relative
+ *          to the width of B.
+ *   ESC:   the products are expanded, sorted by column and compressed.
+ *          Used for short rows of wide matrices.
+ *   hash:  an open addressing table sized by the number of products.
+ *          Used for the remaining rows of wide matrices.
+ *
+ * All accumulators sum the products of an entry in the same order and
+ * store the entries of a row in the order in which their columns first
+ * appear (the diagonal first for square C), so C does not depend on the
+ * accumulator.  HYPRE_CSRMatrixHostSpGemmSetAlgorithm forces one of them.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_SPGEMM_HOST_DENSE_MAX_COLS 1048576
+#define HYPRE_SPGEMM_HOST_DENSE_RATIO    8
+#define HYPRE_SPGEMM_HOST_ESC_MAX_NNZ    32
+
+static inline HYPRE_Int
+hypre_CSRMatrixMultiplyHostBin( HYPRE_Int algorithm,
+                                HYPRE_Int num_products,
+                                HYPRE_Int ncols_B )
+{
+   if (algorithm != HYPRE_SPGEMM_HOST_AUTO)
+   {
+      return algorithm;
+   }
+   if (ncols_B <= HYPRE_SPGEMM_HOST_DENSE_MAX_COLS ||
+       num_products >= ncols_B / HYPRE_SPGEMM_HOST_DENSE_RATIO)
+   {
+      return HYPRE_SPGEMM_HOST_DENSE;
+   }
+   if (num_products <= HYPRE_SPGEMM_HOST_ESC_MAX_NNZ)
+   {
+      return HYPRE_SPGEMM_HOST_ESC;
+   }
+   return HYPRE_SPGEMM_HOST_HASH;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMultiplyRowDense
+ *
+ * Row ic of C = A*B with the dense accumulator.  Without C_j, only counts
+ * the nonzeros of the row (marker holds row numbers); otherwise stores the
+ * row from position counter on (marker holds positions in C).  Returns the
+ * number of nonzeros of the row.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CSRMatrixMultiplyRowDense( HYPRE_Int      ic,
+                                 HYPRE_Int      diag,
+                                 HYPRE_Int     *A_i,
+                                 HYPRE_Int     *A_j,
+                                 HYPRE_Complex *A_data,
+                                 HYPRE_Int     *B_i,
+                                 HYPRE_Int     *B_j,
+                                 HYPRE_Complex *B_data,
+                                 HYPRE_Int     *marker,
+                                 HYPRE_Int      counter,
+                                 HYPRE_Int     *C_j,
+                                 HYPRE_Complex *C_data )
+{
+   HYPRE_Int     row_start = counter;
+   HYPRE_Int     ia, ib, ja, jb;
+   HYPRE_Complex a_entry;
+
+   if (!C_j)
+   {
+      if (diag)
+      {
+         marker[ic] = ic;
+         counter++;
+      }
+      for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+      {
+         ja = A_j[ia];
+         for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+         {
+            jb = B_j[ib];
+            if (marker[jb] != ic)
+            {
+               marker[jb] = ic;
+               counter++;
+            }
+         }
+      }
+      return counter - row_start;
+   }
+
+   if (diag)
+   {
+      marker[ic] = counter;
+      C_data[counter] = 0;
+      C_j[counter] = ic;
+      counter++;
+   }
+   for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+   {
+      ja = A_j[ia];
+      a_entry = A_data[ia];
+      for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+      {
+         jb = B_j[ib];
+         if (marker[jb] < row_start)
+         {
+            marker[jb] = counter;
+            C_j[counter] = jb;
+            C_data[counter] = a_entry*B_data[ib];
+            counter++;
+         }
+         else
+         {
+            C_data[marker[jb]] += a_entry*B_data[ib];
+         }
+      }
+   }
+
+   return counter - row_start;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMultiplyRowHash
+ *
+ * Row ic of C = A*B with a linear probing hash table of hash_size (a power
+ * of two, at least twice the number of products) keys.  Without C_j, only
+ * counts the nonzeros of the row.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CSRMatrixMultiplyRowHash( HYPRE_Int      ic,
+                                HYPRE_Int      diag,
+                                HYPRE_Int     *A_i,
+                                HYPRE_Int     *A_j,
+                                HYPRE_Complex *A_data,
+                                HYPRE_Int     *B_i,
+                                HYPRE_Int     *B_j,
+                                HYPRE_Complex *B_data,
+                                HYPRE_Int      hash_size,
+                                HYPRE_Int     *hash_key,
+                                HYPRE_Int     *hash_pos,
+                                HYPRE_Int      counter,
+                                HYPRE_Int     *C_j,
+                                HYPRE_Complex *C_data )
+{
+   HYPRE_Int     row_start = counter;
+   HYPRE_Int     mask      = hash_size - 1;
+   HYPRE_Int     ia, ib, ja, jb, h;
+   HYPRE_Complex a_entry;
+
+   for (h = 0; h < hash_size; h++)
+   {
+      hash_key[h] = -1;
+   }
+
+   if (diag)
+   {
+      h = hypre_Hash(ic) & mask;
+      hash_key[h] = ic;
+      hash_pos[h] = counter;
+      if (C_j)
+      {
+         C_data[counter] = 0;
+         C_j[counter] = ic;
+      }
+      counter++;
+   }
+   for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+   {
+      ja = A_j[ia];
+      a_entry = C_j ? A_data[ia] : 0.0;
+      for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+      {
+         jb = B_j[ib];
+         h  = hypre_Hash(jb) & mask;
+         while (hash_key[h] != jb && hash_key[h] != -1)
+         {
+            h = (h + 1) & mask;
+         }
+         if (hash_key[h] == -1)
+         {
+            hash_key[h] = jb;
+            hash_pos[h] = counter;
+            if (C_j)
+            {
+               C_j[counter] = jb;
+               C_data[counter] = a_entry*B_data[ib];
+            }
+            counter++;
+         }
+         else if (C_j)
+         {
+            C_data[hash_pos[h]] += a_entry*B_data[ib];
+         }
+      }
+   }
+
+   return counter - row_start;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMultiplyRowESC
+ *
+ * Row ic of C = A*B by expansion, sorting and compression.  The work
+ * arrays hold at least as many entries as the row has products.  Without
+ * C_j, only counts the nonzeros of the row.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_CSRMatrixMultiplyRowESC( HYPRE_Int      ic,
+                               HYPRE_Int      diag,
+                               HYPRE_Int     *A_i,
+                               HYPRE_Int     *A_j,
+                               HYPRE_Complex *A_data,
+                               HYPRE_Int     *B_i,
+                               HYPRE_Int     *B_j,
+                               HYPRE_Complex *B_data,
+                               HYPRE_Int     *esc_j,
+                               HYPRE_Complex *esc_data,
+                               HYPRE_Int     *esc_key,
+                               HYPRE_Int     *esc_perm,
+                               HYPRE_Int     *esc_keep,
+                               HYPRE_Int      counter,
+                               HYPRE_Int     *C_j,
+                               HYPRE_Complex *C_data )
+{
+   HYPRE_Int     row_start = counter;
+   HYPRE_Int     n = 0;
+   HYPRE_Int     ia, ib, ja, k, kk, first, key, p;
+   HYPRE_Complex a_entry, sum;
+
+   /* expand */
+   if (diag)
+   {
+      esc_j[n] = ic;
+      esc_data[n++] = 0;
+   }
+   for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+   {
+      ja = A_j[ia];
+      a_entry = C_j ? A_data[ia] : 0.0;
+      for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+      {
+         esc_j[n] = B_j[ib];
+         esc_data[n++] = a_entry*(C_j ? B_data[ib] : 0.0);
+      }
+   }
+
+   /* sort by column, keeping the expansion order within a column */
+   for (k = 0; k < n; k++)
+   {
+      esc_key[k]  = esc_j[k];
+      esc_perm[k] = k;
+   }
+   if (n <= HYPRE_SPGEMM_HOST_ESC_MAX_NNZ)
+   {
+      for (k = 1; k < n; k++)
+      {
+         key = esc_key[k];
+         p   = esc_perm[k];
+         for (kk = k; kk > 0 && esc_key[kk-1] > key; kk--)
+         {
+            esc_key[kk]  = esc_key[kk-1];
+            esc_perm[kk] = esc_perm[kk-1];
+         }
+         esc_key[kk]  = key;
+         esc_perm[kk] = p;
+      }
+   }
+   else if (n > 1)
+   {
+      hypre_qsort2i(esc_key, esc_perm, 0, n-1);
+      for (k = 0; k < n; k = kk)
+      {
+         for (kk = k + 1; kk < n && esc_key[kk] == esc_key[k]; kk++);
+         if (kk - k > 1)
+         {
+            hypre_qsort0(esc_perm, k, kk-1);
+         }
+      }
+   }
+
+   /* compress: each column is kept at its first product */
+   for (k = 0; k < n; k++)
+   {
+      esc_keep[k] = 0;
+   }
+   for (k = 0; k < n; k = kk)
+   {
+      first = esc_perm[k];
+      sum   = esc_data[first];
+      for (kk = k + 1; kk < n && esc_key[kk] == esc_key[k]; kk++)
+      {
+         sum += esc_data[esc_perm[kk]];
+      }
+      esc_data[first] = sum;
+      esc_keep[first] = 1;
+   }
+   for (k = 0; k < n; k++)
+   {
+      if (esc_keep[k])
+      {
+         if (C_j)
+         {
+            C_j[counter]    = esc_j[k];
+            C_data[counter] = esc_data[k];
+         }
+         counter++;
+      }
+   }
+
+   return counter - row_start;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixMultiply
  * multiplies two CSR Matrices A and B and returns a CSR Matrix C;
@@ -306,17 +628,16 @@ hypre_CSRMatrixMultiplyHost( hypre_CSRMatrix *A,
    HYPRE_Int        *B_j      = hypre_CSRMatrixJ(B);
    HYPRE_Int         nrows_B  = hypre_CSRMatrixNumRows(B);
    HYPRE_Int         ncols_B  = hypre_CSRMatrixNumCols(B);
+   HYPRE_Int         algorithm = hypre_HandleSpgemmHostAlgorithm(hypre_handle());
    hypre_CSRMatrix  *C;
    HYPRE_Complex    *C_data;
    HYPRE_Int        *C_i;
    HYPRE_Int        *C_j;
 
-   HYPRE_Int         ia, ib, ic, ja, jb, num_nonzeros=0;
-   HYPRE_Int         row_start, counter;
-   HYPRE_Complex     a_entry, b_entry;
    HYPRE_Int         allsquare = 0;
    HYPRE_Int         max_num_threads;
    HYPRE_Int         *jj_count;
+   HYPRE_Int         *num_products;
 
    HYPRE_MemoryLocation memory_location_A = hypre_CSRMatrixMemoryLocation(A);
    HYPRE_MemoryLocation memory_location_B = hypre_CSRMatrixMemoryLocation(B);
@@ -347,15 +668,20 @@ hypre_CSRMatrixMultiplyHost( hypre_CSRMatrix *A,
    max_num_threads = hypre_NumThreads();
 
    jj_count = hypre_CTAlloc(HYPRE_Int, max_num_threads, HYPRE_MEMORY_HOST);
+   num_products = hypre_TAlloc(HYPRE_Int, nrows_A, HYPRE_MEMORY_HOST);
 
 #ifdef HYPRE_USING_OPENMP
-#pragma omp parallel private(ia, ib, ic, ja, jb, num_nonzeros, row_start, counter, a_entry, b_entry)
+#pragma omp parallel
 #endif
    {
-      HYPRE_Int *B_marker = NULL;
-      HYPRE_Int ns, ne, ii, jj;
-      HYPRE_Int size, rest, num_threads;
-      HYPRE_Int i1;
+      HYPRE_Int     *B_marker = NULL;
+      HYPRE_Int     *hash_key = NULL, *hash_pos = NULL;
+      HYPRE_Int     *esc_j = NULL, *esc_key = NULL, *esc_perm = NULL, *esc_keep = NULL;
+      HYPRE_Complex *esc_data = NULL;
+      HYPRE_Int      max_hash_size = 0, max_esc_size = 0, hash_size;
+      HYPRE_Int      ns, ne, ii, jj, ia, ib, ic, bin, num_nonzeros, counter;
+      HYPRE_Int      size, rest, num_threads;
+      HYPRE_Int      i1;
       ii = hypre_GetThreadNum();
       num_threads = hypre_NumActiveThreads();
 
@@ -372,32 +698,76 @@ hypre_CSRMatrixMultiplyHost( hypre_CSRMatrix *A,
          ne = (ii+1)*size+rest;
       }
 
-      B_marker = hypre_CTAlloc(HYPRE_Int, ncols_B, HYPRE_MEMORY_HOST);
+      /* number of products of the rows, and work space of the bins used */
+      for (ic = ns; ic < ne; ic++)
+      {
+         num_products[ic] = allsquare;
+         for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+         {
+            num_products[ic] += B_i[A_j[ia]+1] - B_i[A_j[ia]];
+         }
+
+         bin = hypre_CSRMatrixMultiplyHostBin(algorithm, num_products[ic], ncols_B);
+         if (bin == HYPRE_SPGEMM_HOST_DENSE && !B_marker)
+         {
+            B_marker = hypre_TAlloc(HYPRE_Int, ncols_B, HYPRE_MEMORY_HOST);
+         }
+         else if (bin == HYPRE_SPGEMM_HOST_HASH)
+         {
+            for (hash_size = 1; hash_size < 2*num_products[ic]; hash_size *= 2);
+            max_hash_size = hypre_max(max_hash_size, hash_size);
+         }
+         else if (bin == HYPRE_SPGEMM_HOST_ESC)
+         {
+            max_esc_size = hypre_max(max_esc_size, num_products[ic]);
+         }
+      }
+      if (max_hash_size)
+      {
+         hash_key = hypre_TAlloc(HYPRE_Int, max_hash_size, HYPRE_MEMORY_HOST);
+         hash_pos = hypre_TAlloc(HYPRE_Int, max_hash_size, HYPRE_MEMORY_HOST);
+      }
+      if (max_esc_size)
+      {
+         esc_j    = hypre_TAlloc(HYPRE_Int, max_esc_size, HYPRE_MEMORY_HOST);
+         esc_key  = hypre_TAlloc(HYPRE_Int, max_esc_size, HYPRE_MEMORY_HOST);
+         esc_perm = hypre_TAlloc(HYPRE_Int, max_esc_size, HYPRE_MEMORY_HOST);
+         esc_keep = hypre_TAlloc(HYPRE_Int, max_esc_size, HYPRE_MEMORY_HOST);
+         esc_data = hypre_TAlloc(HYPRE_Complex, max_esc_size, HYPRE_MEMORY_HOST);
+      }
 
-      for (ib = 0; ib < ncols_B; ib++)
-         B_marker[ib] = -1;
+      /* symbolic pass: number of nonzeros of the rows */
+      if (B_marker)
+      {
+         for (ib = 0; ib < ncols_B; ib++)
+            B_marker[ib] = -1;
+      }
 
       num_nonzeros = 0;
       for (ic = ns; ic < ne; ic++)
       {
          C_i[ic] = num_nonzeros;
-         if (allsquare)
+         bin = hypre_CSRMatrixMultiplyHostBin(algorithm, num_products[ic], ncols_B);
+         if (bin == HYPRE_SPGEMM_HOST_DENSE)
          {
-            B_marker[ic] = ic;
-            num_nonzeros++;
+            num_nonzeros += hypre_CSRMatrixMultiplyRowDense(ic, allsquare, A_i, A_j, A_data,
+                                                            B_i, B_j, B_data, B_marker,
+                                                            num_nonzeros, NULL, NULL);
          }
-         for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+         else if (bin == HYPRE_SPGEMM_HOST_HASH)
          {
-            ja = A_j[ia];
-            for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
-            {
-               jb = B_j[ib];
-               if (B_marker[jb] != ic)
-               {
-                  B_marker[jb] = ic;
-                  num_nonzeros++;
-               }
-            }
+            for (hash_size = 1; hash_size < 2*num_products[ic]; hash_size *= 2);
+            num_nonzeros += hypre_CSRMatrixMultiplyRowHash(ic, allsquare, A_i, A_j, A_data,
+                                                           B_i, B_j, B_data, hash_size,
+                                                           hash_key, hash_pos,
+                                                           num_nonzeros, NULL, NULL);
+         }
+         else
+         {
+            num_nonzeros += hypre_CSRMatrixMultiplyRowESC(ic, allsquare, A_i, A_j, A_data,
+                                                          B_i, B_j, B_data, esc_j, esc_data,
+                                                          esc_key, esc_perm, esc_keep,
+                                                          num_nonzeros, NULL, NULL);
          }
       }
       jj_count[ii] = num_nonzeros;
@@ -432,43 +802,51 @@ hypre_CSRMatrixMultiplyHost( hypre_CSRMatrix *A,
 #pragma omp barrier
 #endif
 
-      for (ib = 0; ib < ncols_B; ib++)
-         B_marker[ib] = -1;
+      /* numeric pass */
+      if (B_marker)
+      {
+         for (ib = 0; ib < ncols_B; ib++)
+            B_marker[ib] = -1;
+      }
 
       counter = C_i[ns];
       for (ic = ns; ic < ne; ic++)
       {
-         row_start = C_i[ic];
-         if (allsquare)
+         bin = hypre_CSRMatrixMultiplyHostBin(algorithm, num_products[ic], ncols_B);
+         if (bin == HYPRE_SPGEMM_HOST_DENSE)
          {
-            B_marker[ic] = counter;
-            C_data[counter] = 0;
-            C_j[counter] = ic;
-            counter++;
+            counter += hypre_CSRMatrixMultiplyRowDense(ic, allsquare, A_i, A_j, A_data,
+                                                       B_i, B_j, B_data, B_marker,
+                                                       counter, C_j, C_data);
          }
-         for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+         else if (bin == HYPRE_SPGEMM_HOST_HASH)
          {
-            ja = A_j[ia];
-            a_entry = A_data[ia];
-            for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
-            {
-               jb = B_j[ib];
-               b_entry = B_data[ib];
-               if (B_marker[jb] < row_start)
-               {
-                  B_marker[jb] = counter;
-                  C_j[B_marker[jb]] = jb;
-                  C_data[B_marker[jb]] = a_entry*b_entry;
-                  counter++;
-               }
-               else
-                  C_data[B_marker[jb]] += a_entry*b_entry;
-            }
+            for (hash_size = 1; hash_size < 2*num_products[ic]; hash_size *= 2);
+            counter += hypre_CSRMatrixMultiplyRowHash(ic, allsquare, A_i, A_j, A_data,
+                                                      B_i, B_j, B_data, hash_size,
+                                                      hash_key, hash_pos,
+                                                      counter, C_j, C_data);
+         }
+         else
+         {
+            counter += hypre_CSRMatrixMultiplyRowESC(ic, allsquare, A_i, A_j, A_data,
+                                                     B_i, B_j, B_data, esc_j, esc_data,
+                                                     esc_key, esc_perm, esc_keep,
+                                                     counter, C_j, C_data);
          }
       }
+
       hypre_TFree(B_marker, HYPRE_MEMORY_HOST);
+      hypre_TFree(hash_key, HYPRE_MEMORY_HOST);
+      hypre_TFree(hash_pos, HYPRE_MEMORY_HOST);
+      hypre_TFree(esc_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(esc_key, HYPRE_MEMORY_HOST);
+      hypre_TFree(esc_perm, HYPRE_MEMORY_HOST);
+      hypre_TFree(esc_keep, HYPRE_MEMORY_HOST);
+      hypre_TFree(esc_data, HYPRE_MEMORY_HOST);
    } /*end parallel region */
    hypre_TFree(jj_count, HYPRE_MEMORY_HOST);
+   hypre_TFree(num_products, HYPRE_MEMORY_HOST);
    return C;
 }
 
@@ -1060,6 +1438,8 @@ HYPRE_Int hypre_CSRMatrixReorder(hypre_CSRMatrix *A)
    if (num_rowsA != num_colsA)
       return -1;
 
+   hypre_CSRMatrixValuesChanged(A);
+
    for (i = 0; i < num_rowsA; i++)
    {
       row_size = A_i[i+1]-A_i[i];
@@ -555,6 +555,8 @@ hypre_CSRMatrixMoveDiagFirstDevice( hypre_CSRMatrix  *A )
 
    hypre_SyncCudaComputeStream(hypre_handle());
 
+   hypre_CSRMatrixValuesChanged(A);
+
    return hypre_error_flag;
 }
 
@@ -35,6 +35,11 @@ hypre_CSRMatrixCreate( HYPRE_Int num_rows,
    hypre_CSRMatrixJ(matrix)              = NULL;
    hypre_CSRMatrixBigJ(matrix)           = NULL;
    hypre_CSRMatrixRownnz(matrix)         = NULL;
+   hypre_CSRMatrixValuesVersion(matrix)  = 0;
+   hypre_CSRMatrixSellChunkSize(matrix)  = 0;
+   hypre_CSRMatrixSellSortScope(matrix)  = 1;
+   hypre_CSRMatrixSell(matrix)           = NULL;
+   hypre_CSRMatrixDataSP(matrix)         = NULL;
    hypre_CSRMatrixNumRows(matrix)        = num_rows;
    hypre_CSRMatrixNumCols(matrix)        = num_cols;
    hypre_CSRMatrixNumNonzeros(matrix)    = num_nonzeros;
@@ -62,6 +67,8 @@ hypre_CSRMatrixDestroy( hypre_CSRMatrix *matrix )
 
       hypre_TFree(hypre_CSRMatrixI(matrix),      memory_location);
       hypre_TFree(hypre_CSRMatrixRownnz(matrix), HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixSellDestroy(matrix);
+      hypre_TFree(hypre_CSRMatrixDataSP(matrix), HYPRE_MEMORY_HOST);
 
       if ( hypre_CSRMatrixOwnsData(matrix) )
       {
@@ -94,6 +101,8 @@ hypre_CSRMatrixInitialize_v2( hypre_CSRMatrix *matrix, HYPRE_Int bigInit, HYPRE_
    /* Caveat: for pre-existing i, j, data, their memory location must be guaranteed to be consistent with `memory_location'
     * Otherwise, mismatches will exist and problems will be encountered when being used, and freed */
 
+   hypre_MemoryStatsPushCategory(HYPRE_MEMORY_CATEGORY_MATRIX);
+
    if ( !hypre_CSRMatrixData(matrix) && num_nonzeros )
    {
       hypre_CSRMatrixData(matrix) = hypre_CTAlloc(HYPRE_Complex, num_nonzeros, memory_location);
@@ -132,6 +141,8 @@ hypre_CSRMatrixInitialize_v2( hypre_CSRMatrix *matrix, HYPRE_Int bigInit, HYPRE_
       }
    }
 
+   hypre_MemoryStatsPopCategory();
+
    return ierr;
 }
 
@@ -468,6 +479,13 @@ hypre_CSRMatrixPrintMM( hypre_CSRMatrix *matrix,
     * Print the matrix data
     *----------------------------------------------------------*/
 
+   if (hypre_CSRMatrixDataSP(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Matrix with reduced-precision values, see hypre_CSRMatrixConvertToDP\n");
+      return hypre_error_flag;
+   }
+
    matrix_data = hypre_CSRMatrixData(matrix);
    matrix_i    = hypre_CSRMatrixI(matrix);
    matrix_j    = hypre_CSRMatrixJ(matrix);
@@ -548,6 +566,13 @@ hypre_CSRMatrixPrintHB( hypre_CSRMatrix *matrix_input,
     * Print the matrix data
     *----------------------------------------------------------*/
 
+   if (hypre_CSRMatrixDataSP(matrix_input))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Matrix with reduced-precision values, see hypre_CSRMatrixConvertToDP\n");
+      return hypre_error_flag;
+   }
+
    /* First transpose the input matrix, since HB is in CSC format */
    hypre_CSRMatrixTranspose(matrix_input, &matrix, 1);
 
@@ -648,10 +673,71 @@ hypre_CSRMatrixCopy( hypre_CSRMatrix *A, hypre_CSRMatrix *B, HYPRE_Int copy_data
       B_data = hypre_CSRMatrixData(B);
       hypre_TMemcpy(B_data, A_data, HYPRE_Complex, num_nonzeros, memory_location_B, memory_location_A);
    }
+   hypre_CSRMatrixValuesChanged(B);
 
    return ierr;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixValuesChanged
+ *
+ * Marks the values (or the pattern) of A as changed in place, so that data
+ * derived from them, such as the SELL-C-sigma shadow, is rebuilt.  Every
+ * routine that modifies an existing matrix calls it.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixValuesChanged( hypre_CSRMatrix *matrix )
+{
+   if (matrix)
+   {
+      hypre_CSRMatrixValuesVersion(matrix)++;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSetSellCSigma
+ *
+ * chunk_size > 0 enables the SELL-C-sigma shadow of the matrix (C =
+ * chunk_size, sigma = sort_scope) in the host matvec; chunk_size = 0
+ * disables it.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSetSellCSigma( hypre_CSRMatrix *matrix,
+                              HYPRE_Int        chunk_size,
+                              HYPRE_Int        sort_scope )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (chunk_size < 0 || chunk_size > HYPRE_SELL_MAX_CHUNK_SIZE)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   if (sort_scope < 1)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixSellChunkSize(matrix) = chunk_size;
+   hypre_CSRMatrixSellSortScope(matrix) = sort_scope;
+   if (chunk_size == 0)
+   {
+      hypre_CSRMatrixSellDestroy(matrix);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_CSRMatrixClone
  * Creates and returns a new copy of the argument, A.
@@ -0,0 +1,330 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * SELL-C-sigma (sliced ELLPACK) shadow format for hypre_CSRMatrix
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_SellMatrixCreateFromCSR
+ *
+ * Builds the SELL-C-sigma representation of the host CSR matrix A with
+ * chunk size C = chunk_size and sorting scope sigma = sort_scope.
+ *--------------------------------------------------------------------------*/
+
+hypre_SellMatrix *
+hypre_SellMatrixCreateFromCSR( hypre_CSRMatrix *A,
+                               HYPRE_Int        chunk_size,
+                               HYPRE_Int        sort_scope )
+{
+   HYPRE_Int         num_rows = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int        *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int        *A_j      = hypre_CSRMatrixJ(A);
+   HYPRE_Complex    *A_data   = hypre_CSRMatrixData(A);
+
+   hypre_SellMatrix *sell;
+   HYPRE_Int         num_chunks, num_slots;
+   HYPRE_Int        *chunk_ptr, *chunk_len, *perm, *sell_j;
+   HYPRE_Complex    *sell_data;
+   HYPRE_Int        *row_len;
+   HYPRE_Int         c, r, k, row, slot, start, end, width, pos;
+
+   chunk_size = hypre_max(1, hypre_min(chunk_size, HYPRE_SELL_MAX_CHUNK_SIZE));
+   sort_scope = hypre_max(1, sort_scope);
+
+   num_chunks = (num_rows + chunk_size - 1) / chunk_size;
+   num_slots  = num_chunks * chunk_size;
+
+   chunk_ptr = hypre_CTAlloc(HYPRE_Int, num_chunks + 1, HYPRE_MEMORY_HOST);
+   chunk_len = hypre_CTAlloc(HYPRE_Int, num_chunks,     HYPRE_MEMORY_HOST);
+   perm      = hypre_TAlloc(HYPRE_Int,  num_slots,      HYPRE_MEMORY_HOST);
+   row_len   = hypre_TAlloc(HYPRE_Int,  num_slots,      HYPRE_MEMORY_HOST);
+
+   /* stable counting sort of the rows by decreasing length within each
+    * window of sort_scope rows; row_len holds the length of each slot */
+   for (slot = 0; slot < num_slots; slot++)
+   {
+      perm[slot]    = slot < num_rows ? slot : -1;
+      row_len[slot] = slot < num_rows ? A_i[slot+1] - A_i[slot] : 0;
+   }
+
+   if (sort_scope > 1)
+   {
+      HYPRE_Int *count, *win_rows, max_len, len;
+
+      win_rows = hypre_TAlloc(HYPRE_Int, hypre_min(sort_scope, num_rows), HYPRE_MEMORY_HOST);
+      for (start = 0; start < num_rows; start += sort_scope)
+      {
+         end = hypre_min(start + sort_scope, num_rows);
+
+         max_len = 0;
+         for (row = start; row < end; row++)
+         {
+            max_len = hypre_max(max_len, row_len[row]);
+         }
+
+         count = hypre_CTAlloc(HYPRE_Int, max_len + 2, HYPRE_MEMORY_HOST);
+         for (row = start; row < end; row++)
+         {
+            count[max_len - row_len[row] + 1]++;
+         }
+         for (len = 0; len <= max_len; len++)
+         {
+            count[len+1] += count[len];
+         }
+         for (row = start; row < end; row++)
+         {
+            win_rows[count[max_len - row_len[row]]++] = row;
+         }
+         for (row = start; row < end; row++)
+         {
+            perm[row] = win_rows[row - start];
+         }
+         for (row = start; row < end; row++)
+         {
+            row_len[row] = A_i[perm[row]+1] - A_i[perm[row]];
+         }
+         hypre_TFree(count, HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(win_rows, HYPRE_MEMORY_HOST);
+   }
+
+   /* chunk widths and offsets */
+   for (c = 0; c < num_chunks; c++)
+   {
+      width = 0;
+      for (r = 0; r < chunk_size; r++)
+      {
+         width = hypre_max(width, row_len[c*chunk_size + r]);
+      }
+      chunk_len[c]   = width;
+      chunk_ptr[c+1] = chunk_ptr[c] + width * chunk_size;
+   }
+   hypre_TFree(row_len, HYPRE_MEMORY_HOST);
+
+   sell_j    = hypre_CTAlloc(HYPRE_Int,     chunk_ptr[num_chunks], HYPRE_MEMORY_HOST);
+   sell_data = hypre_CTAlloc(HYPRE_Complex, chunk_ptr[num_chunks], HYPRE_MEMORY_HOST);
+
+   /* column-major fill of each chunk; padding has value zero and column 0 */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(c,r,k,row,pos) HYPRE_SMP_SCHEDULE
+#endif
+   for (c = 0; c < num_chunks; c++)
+   {
+      for (r = 0; r < chunk_size; r++)
+      {
+         row = perm[c*chunk_size + r];
+         if (row < 0)
+         {
+            continue;
+         }
+         pos = chunk_ptr[c] + r;
+         for (k = A_i[row]; k < A_i[row+1]; k++)
+         {
+            sell_j[pos]    = A_j[k];
+            sell_data[pos] = A_data[k];
+            pos += chunk_size;
+         }
+      }
+   }
+
+   sell = hypre_CTAlloc(hypre_SellMatrix, 1, HYPRE_MEMORY_HOST);
+
+   hypre_SellMatrixNumRows(sell)   = num_rows;
+   hypre_SellMatrixChunkSize(sell) = chunk_size;
+   hypre_SellMatrixSortScope(sell) = sort_scope;
+   hypre_SellMatrixNumChunks(sell) = num_chunks;
+   hypre_SellMatrixChunkPtr(sell)  = chunk_ptr;
+   hypre_SellMatrixChunkLen(sell)  = chunk_len;
+   hypre_SellMatrixPerm(sell)      = perm;
+   hypre_SellMatrixJ(sell)         = sell_j;
+   hypre_SellMatrixData(sell)      = sell_data;
+   hypre_SellMatrixCSRI(sell)      = A_i;
+   hypre_SellMatrixCSRData(sell)   = A_data;
+   hypre_SellMatrixCSRValuesVersion(sell) = hypre_CSRMatrixValuesVersion(A);
+
+   return sell;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SellMatrixDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SellMatrixDestroy( hypre_SellMatrix *sell )
+{
+   if (sell)
+   {
+      hypre_TFree(hypre_SellMatrixChunkPtr(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_SellMatrixChunkLen(sell), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_SellMatrixPerm(sell),     HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_SellMatrixJ(sell),        HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_SellMatrixData(sell),     HYPRE_MEMORY_HOST);
+      hypre_TFree(sell, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellSetup
+ *
+ * Returns the SELL-C-sigma shadow of A, (re)building it if it does not
+ * exist, if the C/sigma options changed, or if the values of A changed
+ * (see hypre_CSRMatrixValuesChanged) or its arrays were replaced since it
+ * was built. Returns NULL if the SELL format is disabled for A (see
+ * hypre_CSRMatrixSetSellCSigma) or A is not on the host.
+ *
+ * Note: code that modifies the data of A directly must call
+ * hypre_CSRMatrixValuesChanged.
+ *--------------------------------------------------------------------------*/
+
+hypre_SellMatrix *
+hypre_CSRMatrixSellSetup( hypre_CSRMatrix *A )
+{
+   HYPRE_Int         chunk_size = hypre_CSRMatrixSellChunkSize(A);
+   HYPRE_Int         sort_scope = hypre_CSRMatrixSellSortScope(A);
+   hypre_SellMatrix *sell       = hypre_CSRMatrixSell(A);
+
+   if (chunk_size <= 0 || !hypre_CSRMatrixData(A) ||
+       hypre_GetActualMemLocation(hypre_CSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST)
+   {
+      return NULL;
+   }
+
+   if ( sell &&
+        hypre_SellMatrixNumRows(sell)   == hypre_CSRMatrixNumRows(A) &&
+        hypre_SellMatrixChunkSize(sell) == hypre_min(chunk_size, HYPRE_SELL_MAX_CHUNK_SIZE) &&
+        hypre_SellMatrixSortScope(sell) == hypre_max(1, sort_scope) &&
+        hypre_SellMatrixCSRI(sell)      == hypre_CSRMatrixI(A) &&
+        hypre_SellMatrixCSRData(sell)   == hypre_CSRMatrixData(A) &&
+        hypre_SellMatrixCSRValuesVersion(sell) == hypre_CSRMatrixValuesVersion(A) )
+   {
+      return sell;
+   }
+
+   hypre_SellMatrixDestroy(sell);
+   sell = hypre_SellMatrixCreateFromCSR(A, chunk_size, sort_scope);
+   hypre_CSRMatrixSell(A) = sell;
+
+   return sell;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixSellDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixSellDestroy( hypre_CSRMatrix *A )
+{
+   if (A)
+   {
+      hypre_SellMatrixDestroy(hypre_CSRMatrixSell(A));
+      hypre_CSRMatrixSell(A) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecSell
+ *
+ * y = alpha*A*x + beta*b using the SELL-C-sigma shadow of A. b may be y.
+ * Falls back to the CSR kernel for multivectors or if the shadow is
+ * not available.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecSell( HYPRE_Complex    alpha,
+                           hypre_CSRMatrix *A,
+                           hypre_Vector    *x,
+                           HYPRE_Complex    beta,
+                           hypre_Vector    *b,
+                           hypre_Vector    *y )
+{
+   hypre_SellMatrix *sell;
+   HYPRE_Int         num_chunks, chunk_size;
+   HYPRE_Int        *chunk_ptr, *chunk_len, *perm, *sell_j;
+   HYPRE_Complex    *sell_data;
+   HYPRE_Complex    *x_data = hypre_VectorData(x);
+   HYPRE_Complex    *b_data = hypre_VectorData(b);
+   HYPRE_Complex    *y_data = hypre_VectorData(y);
+   HYPRE_Int         c, r, k, row, pos;
+
+   if (hypre_VectorNumVectors(x) > 1)
+   {
+      return hypre_CSRMatrixMatvecOutOfPlace(alpha, A, x, beta, b, y, 0);
+   }
+
+   sell = hypre_CSRMatrixSellSetup(A);
+   if (!sell)
+   {
+      return hypre_CSRMatrixMatvecOutOfPlace(alpha, A, x, beta, b, y, 0);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_MATVEC] -= hypre_MPI_Wtime();
+#endif
+
+   num_chunks = hypre_SellMatrixNumChunks(sell);
+   chunk_size = hypre_SellMatrixChunkSize(sell);
+   chunk_ptr  = hypre_SellMatrixChunkPtr(sell);
+   chunk_len  = hypre_SellMatrixChunkLen(sell);
+   perm       = hypre_SellMatrixPerm(sell);
+   sell_j     = hypre_SellMatrixJ(sell);
+   sell_data  = hypre_SellMatrixData(sell);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(c,r,k,row,pos) HYPRE_SMP_SCHEDULE
+#endif
+   for (c = 0; c < num_chunks; c++)
+   {
+      HYPRE_Complex temp[HYPRE_SELL_MAX_CHUNK_SIZE];
+
+      for (r = 0; r < chunk_size; r++)
+      {
+         temp[r] = 0.0;
+      }
+
+      pos = chunk_ptr[c];
+      for (k = 0; k < chunk_len[c]; k++)
+      {
+         for (r = 0; r < chunk_size; r++)
+         {
+            temp[r] += sell_data[pos + r] * x_data[sell_j[pos + r]];
+         }
+         pos += chunk_size;
+      }
+
+      for (r = 0; r < chunk_size; r++)
+      {
+         row = perm[c*chunk_size + r];
+         if (row < 0)
+         {
+            continue;
+         }
+         if (beta == 0.0)
+         {
+            y_data[row] = alpha * temp[r];
+         }
+         else
+         {
+            y_data[row] = alpha * temp[r] + beta * b_data[row];
+         }
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_MATVEC] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,295 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Reduced-precision coefficient storage for hypre_CSRMatrix.  The values are
+ * kept in hypre_ComplexSP, while the vectors and all accumulations stay in
+ * HYPRE_Complex.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixConvertToSP
+ *
+ * Replaces the coefficients of the host matrix A by a reduced-precision copy
+ * and releases the HYPRE_Complex array.  Afterwards, only the matvec
+ * routines may be applied to A, until hypre_CSRMatrixConvertToDP restores
+ * the HYPRE_Complex coefficients.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixConvertToSP( hypre_CSRMatrix *A )
+{
+   HYPRE_Int         num_nonzeros = hypre_CSRMatrixNumNonzeros(A);
+   HYPRE_Complex    *A_data       = hypre_CSRMatrixData(A);
+   hypre_ComplexSP  *A_data_sp;
+   HYPRE_Int         i;
+
+   if (hypre_CSRMatrixDataSP(A))
+   {
+      return hypre_error_flag;
+   }
+
+   if (!hypre_CSRMatrixOwnsData(A) ||
+       hypre_GetActualMemLocation(hypre_CSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   A_data_sp = hypre_TAlloc(hypre_ComplexSP, num_nonzeros, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_nonzeros; i++)
+   {
+      A_data_sp[i] = (hypre_ComplexSP) A_data[i];
+   }
+
+   hypre_CSRMatrixSellDestroy(A);
+   hypre_TFree(A_data, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixData(A)   = NULL;
+   hypre_CSRMatrixDataSP(A) = A_data_sp;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixConvertToDP
+ *
+ * Restores the HYPRE_Complex coefficients of a matrix converted by
+ * hypre_CSRMatrixConvertToSP (the values rounded to reduced precision).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixConvertToDP( hypre_CSRMatrix *A )
+{
+   HYPRE_Int         num_nonzeros = hypre_CSRMatrixNumNonzeros(A);
+   hypre_ComplexSP  *A_data_sp    = hypre_CSRMatrixDataSP(A);
+   HYPRE_Complex    *A_data;
+   HYPRE_Int         i;
+
+   if (!A_data_sp)
+   {
+      return hypre_error_flag;
+   }
+
+   A_data = hypre_TAlloc(HYPRE_Complex, num_nonzeros, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_nonzeros; i++)
+   {
+      A_data[i] = (HYPRE_Complex) A_data_sp[i];
+   }
+
+   hypre_TFree(A_data_sp, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixDataSP(A) = NULL;
+   hypre_CSRMatrixData(A)   = A_data;
+   hypre_CSRMatrixValuesChanged(A);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecOutOfPlaceSP
+ *
+ * y[offset:end] = alpha*A[offset:end,:]*x + beta*b[offset:end] for a matrix
+ * with reduced-precision coefficients
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecOutOfPlaceSP( HYPRE_Complex    alpha,
+                                   hypre_CSRMatrix *A,
+                                   hypre_Vector    *x,
+                                   HYPRE_Complex    beta,
+                                   hypre_Vector    *b,
+                                   hypre_Vector    *y,
+                                   HYPRE_Int        offset )
+{
+   hypre_ComplexSP  *A_data      = hypre_CSRMatrixDataSP(A);
+   HYPRE_Int        *A_i         = hypre_CSRMatrixI(A) + offset;
+   HYPRE_Int        *A_j         = hypre_CSRMatrixJ(A);
+   HYPRE_Int         num_rows    = hypre_CSRMatrixNumRows(A) - offset;
+
+   HYPRE_Complex    *x_data      = hypre_VectorData(x);
+   HYPRE_Complex    *b_data      = hypre_VectorData(b) + offset;
+   HYPRE_Complex    *y_data      = hypre_VectorData(y) + offset;
+   HYPRE_Int         num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int         idxstride_x = hypre_VectorIndexStride(x);
+   HYPRE_Int         vecstride_x = hypre_VectorVectorStride(x);
+   HYPRE_Int         idxstride_b = hypre_VectorIndexStride(b);
+   HYPRE_Int         vecstride_b = hypre_VectorVectorStride(b);
+   HYPRE_Int         idxstride_y = hypre_VectorIndexStride(y);
+   HYPRE_Int         vecstride_y = hypre_VectorVectorStride(y);
+   HYPRE_Complex     tempx;
+   HYPRE_Int         i, jj, jv;
+   hypre_Vector     *x_tmp = NULL;
+
+   if (x == y)
+   {
+      x_tmp  = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+   if (num_vectors == 1)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,jj,tempx) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         tempx = 0.0;
+         for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+         {
+            tempx += (HYPRE_Complex) A_data[jj] * x_data[A_j[jj]];
+         }
+         y_data[i] = beta == 0.0 ? alpha*tempx : alpha*tempx + beta*b_data[i];
+      }
+   }
+   else
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,jj,jv,tempx) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            tempx = 0.0;
+            for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+            {
+               tempx += (HYPRE_Complex) A_data[jj] *
+                        x_data[jv*vecstride_x + A_j[jj]*idxstride_x];
+            }
+            tempx *= alpha;
+            if (beta != 0.0)
+            {
+               tempx += beta*b_data[jv*vecstride_b + i*idxstride_b];
+            }
+            y_data[jv*vecstride_y + i*idxstride_y] = tempx;
+         }
+      }
+   }
+
+   hypre_SeqVectorDestroy(x_tmp);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecTSP
+ *
+ * y = alpha*A^T*x + beta*y for a matrix with reduced-precision coefficients
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecTSP( HYPRE_Complex    alpha,
+                          hypre_CSRMatrix *A,
+                          hypre_Vector    *x,
+                          HYPRE_Complex    beta,
+                          hypre_Vector    *y )
+{
+   hypre_ComplexSP  *A_data      = hypre_CSRMatrixDataSP(A);
+   HYPRE_Int        *A_i         = hypre_CSRMatrixI(A);
+   HYPRE_Int        *A_j         = hypre_CSRMatrixJ(A);
+   HYPRE_Int         num_rows    = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int         num_cols    = hypre_CSRMatrixNumCols(A);
+
+   HYPRE_Complex    *x_data      = hypre_VectorData(x);
+   HYPRE_Complex    *y_data      = hypre_VectorData(y);
+   HYPRE_Int         y_size      = hypre_VectorSize(y);
+   HYPRE_Int         num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int         idxstride_x = hypre_VectorIndexStride(x);
+   HYPRE_Int         vecstride_x = hypre_VectorVectorStride(x);
+   HYPRE_Int         idxstride_y = hypre_VectorIndexStride(y);
+   HYPRE_Int         vecstride_y = hypre_VectorVectorStride(y);
+   HYPRE_Int         num_threads = hypre_NumThreads();
+   HYPRE_Complex    *y_data_expand;
+   HYPRE_Complex     xval;
+   HYPRE_Int         i, j, jj, jv, my_thread_num, thread_offset;
+   hypre_Vector     *x_tmp = NULL;
+
+   if (x == y)
+   {
+      x_tmp  = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+   /* y = beta*y; alpha is applied to x on the fly */
+   if (beta != 1.0)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_cols*num_vectors; i++)
+      {
+         y_data[i] = beta == 0.0 ? 0.0 : beta*y_data[i];
+      }
+   }
+
+   if (num_threads > 1 && num_vectors == 1)
+   {
+      y_data_expand = hypre_CTAlloc(HYPRE_Complex, num_threads*y_size, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i,jj,j,xval,my_thread_num,thread_offset)
+#endif
+      {
+         my_thread_num = hypre_GetThreadNum();
+         thread_offset = y_size*my_thread_num;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+         {
+            xval = alpha*x_data[i];
+            for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+            {
+               y_data_expand[thread_offset + A_j[jj]] += (HYPRE_Complex) A_data[jj] * xval;
+            }
+         }
+
+         /* implied barrier (for threads)*/
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < y_size; i++)
+         {
+            for (j = 0; j < num_threads; j++)
+            {
+               y_data[i] += y_data_expand[j*y_size + i];
+            }
+         }
+      } /* end parallel threaded region */
+
+      hypre_TFree(y_data_expand, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      for (i = 0; i < num_rows; i++)
+      {
+         for (jv = 0; jv < num_vectors; jv++)
+         {
+            xval = alpha*x_data[jv*vecstride_x + i*idxstride_x];
+            for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+            {
+               y_data[jv*vecstride_y + A_j[jj]*idxstride_y] += (HYPRE_Complex) A_data[jj] * xval;
+            }
+         }
+      }
+   }
+
+   hypre_SeqVectorDestroy(x_tmp);
+
+   return hypre_error_flag;
+}
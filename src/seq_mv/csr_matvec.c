@@ -91,6 +91,21 @@ hypre_CSRMatrixMatvecOutOfPlace( HYPRE_Complex    alpha,
    if (num_cols != x_size && (num_rows != y_size || num_rows != b_size))
       ierr = 3;
 
+   /*-----------------------------------------------------------------------
+    * Reduced-precision coefficients
+    *-----------------------------------------------------------------------*/
+
+   if (hypre_CSRMatrixDataSP(A))
+   {
+      hypre_CSRMatrixMatvecOutOfPlaceSP(alpha, A, x, beta, b, y, offset);
+
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_MATVEC] += hypre_MPI_Wtime() - time_begin;
+#endif
+
+      return ierr;
+   }
+
    /*-----------------------------------------------------------------------
     * Do (alpha == 0.0) computation - RDF: USE MACHINE EPS
     *-----------------------------------------------------------------------*/
@@ -491,6 +506,13 @@ hypre_CSRMatrixMatvecT( HYPRE_Complex    alpha,
 
    if (num_rows != x_size && num_cols != y_size)
       ierr = 3;
+
+   if (hypre_CSRMatrixDataSP(A))
+   {
+      hypre_CSRMatrixMatvecTSP(alpha, A, x, beta, y);
+      return ierr;
+   }
+
    /*-----------------------------------------------------------------------
     * Do (alpha == 0.0) computation - RDF: USE MACHINE EPS
     *-----------------------------------------------------------------------*/
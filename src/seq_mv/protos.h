@@ -58,6 +58,21 @@ hypre_CSRMatrix *hypre_CSRMatrixClone_v2( hypre_CSRMatrix *A, HYPRE_Int copy_dat
 hypre_CSRMatrix *hypre_CSRMatrixUnion ( hypre_CSRMatrix *A , hypre_CSRMatrix *B , HYPRE_BigInt *col_map_offd_A , HYPRE_BigInt *col_map_offd_B , HYPRE_BigInt **col_map_offd_C );
 HYPRE_Int hypre_CSRMatrixPrefetch( hypre_CSRMatrix *A, HYPRE_MemoryLocation memory_location);
 HYPRE_Int hypre_CSRMatrixCheckSetNumNonzeros( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixValuesChanged ( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixSetSellCSigma ( hypre_CSRMatrix *matrix , HYPRE_Int chunk_size , HYPRE_Int sort_scope );
+
+/* csr_matrix_sell.c */
+hypre_SellMatrix *hypre_SellMatrixCreateFromCSR ( hypre_CSRMatrix *A , HYPRE_Int chunk_size , HYPRE_Int sort_scope );
+HYPRE_Int hypre_SellMatrixDestroy ( hypre_SellMatrix *sell );
+hypre_SellMatrix *hypre_CSRMatrixSellSetup ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixSellDestroy ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecSell ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b , hypre_Vector *y );
+
+/* csr_matrix_sp.c */
+HYPRE_Int hypre_CSRMatrixConvertToSP ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixConvertToDP ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecOutOfPlaceSP ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b , hypre_Vector *y , HYPRE_Int offset );
+HYPRE_Int hypre_CSRMatrixMatvecTSP ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y );
 
 /* csr_matvec.c */
 // y[offset:end] = alpha*A[offset:end,:]*x + beta*b[offset:end]
@@ -36,6 +36,67 @@ extern "C" {
 #ifndef hypre_CSR_MATRIX_HEADER
 #define hypre_CSR_MATRIX_HEADER
 
+/*--------------------------------------------------------------------------
+ * SELL-C-sigma Matrix: sliced ELLPACK shadow of a CSR Matrix
+ *
+ * Rows are sorted by decreasing length within windows of sigma rows and
+ * packed into chunks of C rows. Each chunk is padded to its longest row
+ * and stored column-major, so that the C rows of a chunk are processed in
+ * SIMD fashion. perm[k] is the CSR row stored in slot k (-1 for padding).
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_SELL_MAX_CHUNK_SIZE 32
+
+/* accumulators of the host sparse matrix-matrix product */
+#define HYPRE_SPGEMM_HOST_AUTO  0
+#define HYPRE_SPGEMM_HOST_DENSE 1
+#define HYPRE_SPGEMM_HOST_HASH  2
+#define HYPRE_SPGEMM_HOST_ESC   3
+
+typedef struct
+{
+   HYPRE_Int      num_rows;
+   HYPRE_Int      chunk_size;
+   HYPRE_Int      sort_scope;
+   HYPRE_Int      num_chunks;
+   HYPRE_Int     *chunk_ptr;
+   HYPRE_Int     *chunk_len;
+   HYPRE_Int     *perm;
+   HYPRE_Int     *j;
+   HYPRE_Complex *data;
+
+   /* CSR arrays and values version the shadow was built from (to detect
+    * a stale shadow) */
+   HYPRE_Int     *csr_i;
+   HYPRE_Complex *csr_data;
+   HYPRE_Int      csr_values_version;
+
+} hypre_SellMatrix;
+
+#define hypre_SellMatrixNumRows(matrix)       ((matrix) -> num_rows)
+#define hypre_SellMatrixChunkSize(matrix)     ((matrix) -> chunk_size)
+#define hypre_SellMatrixSortScope(matrix)     ((matrix) -> sort_scope)
+#define hypre_SellMatrixNumChunks(matrix)     ((matrix) -> num_chunks)
+#define hypre_SellMatrixChunkPtr(matrix)      ((matrix) -> chunk_ptr)
+#define hypre_SellMatrixChunkLen(matrix)      ((matrix) -> chunk_len)
+#define hypre_SellMatrixPerm(matrix)          ((matrix) -> perm)
+#define hypre_SellMatrixJ(matrix)             ((matrix) -> j)
+#define hypre_SellMatrixData(matrix)          ((matrix) -> data)
+#define hypre_SellMatrixCSRI(matrix)          ((matrix) -> csr_i)
+#define hypre_SellMatrixCSRData(matrix)       ((matrix) -> csr_data)
+#define hypre_SellMatrixCSRValuesVersion(matrix) ((matrix) -> csr_values_version)
+
+/*--------------------------------------------------------------------------
+ * Reduced-precision value type used for the storage of matrix coefficients
+ * (the arithmetic is still done in HYPRE_Complex)
+ *--------------------------------------------------------------------------*/
+
+#ifdef HYPRE_COMPLEX
+typedef float _Complex hypre_ComplexSP;
+#else
+typedef float hypre_ComplexSP;
+#endif
+
 /*--------------------------------------------------------------------------
  * CSR Matrix
  *--------------------------------------------------------------------------*/
@@ -63,6 +124,19 @@ typedef struct
    /* memory location of arrays i, j, data */
    HYPRE_MemoryLocation      memory_location;
 
+   /* incremented whenever the values are changed in place, see
+    * hypre_CSRMatrixValuesChanged */
+   HYPRE_Int         values_version;
+
+   /* SELL-C-sigma shadow used by the host matvec, built on demand with
+    * C = sell_chunk_size (0: disabled) and sigma = sell_sort_scope */
+   HYPRE_Int         sell_chunk_size;
+   HYPRE_Int         sell_sort_scope;
+   hypre_SellMatrix *sell;
+
+   /* reduced-precision copy of `data'; if set, `data' is NULL */
+   hypre_ComplexSP  *data_sp;
+
 } hypre_CSRMatrix;
 
 /*--------------------------------------------------------------------------
@@ -80,6 +154,11 @@ typedef struct
 #define hypre_CSRMatrixNumRownnz(matrix)      ((matrix) -> num_rownnz)
 #define hypre_CSRMatrixOwnsData(matrix)       ((matrix) -> owns_data)
 #define hypre_CSRMatrixMemoryLocation(matrix) ((matrix) -> memory_location)
+#define hypre_CSRMatrixValuesVersion(matrix)  ((matrix) -> values_version)
+#define hypre_CSRMatrixSellChunkSize(matrix)  ((matrix) -> sell_chunk_size)
+#define hypre_CSRMatrixSellSortScope(matrix)  ((matrix) -> sell_sort_scope)
+#define hypre_CSRMatrixSell(matrix)           ((matrix) -> sell)
+#define hypre_CSRMatrixDataSP(matrix)         ((matrix) -> data_sp)
 
 HYPRE_Int hypre_CSRMatrixGetLoadBalancedPartitionBegin( hypre_CSRMatrix *A );
 HYPRE_Int hypre_CSRMatrixGetLoadBalancedPartitionEnd( hypre_CSRMatrix *A );
@@ -315,6 +394,21 @@ hypre_CSRMatrix *hypre_CSRMatrixClone_v2( hypre_CSRMatrix *A, HYPRE_Int copy_dat
 hypre_CSRMatrix *hypre_CSRMatrixUnion ( hypre_CSRMatrix *A , hypre_CSRMatrix *B , HYPRE_BigInt *col_map_offd_A , HYPRE_BigInt *col_map_offd_B , HYPRE_BigInt **col_map_offd_C );
 HYPRE_Int hypre_CSRMatrixPrefetch( hypre_CSRMatrix *A, HYPRE_MemoryLocation memory_location);
 HYPRE_Int hypre_CSRMatrixCheckSetNumNonzeros( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixValuesChanged ( hypre_CSRMatrix *matrix );
+HYPRE_Int hypre_CSRMatrixSetSellCSigma ( hypre_CSRMatrix *matrix , HYPRE_Int chunk_size , HYPRE_Int sort_scope );
+
+/* csr_matrix_sell.c */
+hypre_SellMatrix *hypre_SellMatrixCreateFromCSR ( hypre_CSRMatrix *A , HYPRE_Int chunk_size , HYPRE_Int sort_scope );
+HYPRE_Int hypre_SellMatrixDestroy ( hypre_SellMatrix *sell );
+hypre_SellMatrix *hypre_CSRMatrixSellSetup ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixSellDestroy ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecSell ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b , hypre_Vector *y );
+
+/* csr_matrix_sp.c */
+HYPRE_Int hypre_CSRMatrixConvertToSP ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixConvertToDP ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecOutOfPlaceSP ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b , hypre_Vector *y , HYPRE_Int offset );
+HYPRE_Int hypre_CSRMatrixMatvecTSP ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y );
 
 /* csr_matvec.c */
 // y[offset:end] = alpha*A[offset:end,:]*x + beta*b[offset:end]
@@ -95,7 +95,9 @@ hypre_SeqVectorInitialize_v2( hypre_Vector *vector, HYPRE_MemoryLocation memory_
     * when being used, and freed */
    if ( !hypre_VectorData(vector) )
    {
+      hypre_MemoryStatsPushCategory(HYPRE_MEMORY_CATEGORY_VECTOR);
       hypre_VectorData(vector) = hypre_CTAlloc(HYPRE_Complex, num_vectors*size, memory_location);
+      hypre_MemoryStatsPopCategory();
    }
 
    if ( multivec_storage_method == 0 )
@@ -26,6 +26,8 @@ HYPRE_SStructGMRESCreate( MPI_Comm             comm,
          hypre_SStructKrylovScaleVector, hypre_SStructKrylovAxpy,
          hypre_SStructKrylovIdentitySetup, hypre_SStructKrylovIdentity );
 
+   /* single reduction per block for s-step GMRES */
+   gmres_functions->BlockInnerProd = hypre_SStructKrylovBlockInnerProd;
    *solver = ( (HYPRE_SStructSolver) hypre_GMRESCreate( gmres_functions ) );
 
    return hypre_error_flag;
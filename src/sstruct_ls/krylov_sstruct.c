@@ -214,6 +214,20 @@ hypre_SStructKrylovInnerProd( void *x,
    return result;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructKrylovBlockInnerProd( HYPRE_Int    nx,
+                                   void       **x,
+                                   HYPRE_Int    ny,
+                                   void       **y,
+                                   HYPRE_Real  *result )
+{
+   return ( hypre_SStructBlockInnerProd( nx, (hypre_SStructVector **) x,
+                                         ny, (hypre_SStructVector **) y, result ) );
+}
+
 
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
@@ -940,6 +940,94 @@ HYPRE_SStructMatrixPrint( const char          *filename,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructMatrixPrintBinary( const char          *filename,
+                                HYPRE_SStructMatrix  matrix,
+                                HYPRE_Int            compress )
+{
+   HYPRE_Int  nparts = hypre_SStructMatrixNParts(matrix);
+   HYPRE_Int  part;
+   char new_filename[255];
+
+   for (part = 0; part < nparts; part++)
+   {
+      hypre_sprintf(new_filename, "%s.%02d", filename, part);
+      hypre_SStructPMatrixPrintBinary(new_filename,
+                                      hypre_SStructMatrixPMatrix(matrix, part),
+                                      compress);
+   }
+
+   /* U-matrix */
+   hypre_sprintf(new_filename, "%s.UMatrix", filename);
+   HYPRE_IJMatrixPrintBinary(hypre_SStructMatrixIJMatrix(matrix), new_filename);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * The matrix must have been assembled with the same graph that was used for
+ * the matrix in the files, so that the U-matrix values can be copied in place
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructMatrixReadBinaryValues( const char          *filename,
+                                     HYPRE_SStructMatrix  matrix )
+{
+   HYPRE_Int           nparts = hypre_SStructMatrixNParts(matrix);
+   HYPRE_Int           part;
+   char                new_filename[255];
+
+   hypre_ParCSRMatrix *parcsr;
+   hypre_ParCSRMatrix *parcsr_read = NULL;
+   HYPRE_BigInt        base_i, base_j;
+   HYPRE_Int           ierr = 0;
+
+   /* the struct reads return the same status on all processors */
+   for (part = 0; part < nparts; part++)
+   {
+      hypre_sprintf(new_filename, "%s.%02d", filename, part);
+      ierr |= hypre_SStructPMatrixReadBinaryValues(new_filename,
+                                                   hypre_SStructMatrixPMatrix(matrix, part));
+   }
+   if (ierr)
+   {
+      return hypre_error_flag;
+   }
+
+   /* U-matrix */
+   HYPRE_IJMatrixGetObject(hypre_SStructMatrixIJMatrix(matrix), (void **) &parcsr);
+   hypre_sprintf(new_filename, "%s.UMatrix", filename);
+   hypre_ParCSRMatrixReadBinary(hypre_SStructMatrixComm(matrix), new_filename,
+                                &base_i, &base_j, &parcsr_read);
+   if (parcsr_read == NULL)
+   {
+      return hypre_error_flag;
+   }
+
+   if ( hypre_ParCSRMatrixFirstRowIndex(parcsr_read) !=
+        hypre_ParCSRMatrixFirstRowIndex(parcsr) ||
+        hypre_ParCSRMatrixNumRows(parcsr_read) != hypre_ParCSRMatrixNumRows(parcsr) ||
+        hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(parcsr_read)) !=
+        hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(parcsr)) ||
+        hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(parcsr_read)) !=
+        hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(parcsr)) ||
+        hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(parcsr_read)) !=
+        hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(parcsr)) )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "U-matrix in file does not match the graph\n");
+   }
+   else
+   {
+      hypre_ParCSRMatrixCopy(parcsr_read, parcsr, 1);
+   }
+   hypre_ParCSRMatrixDestroy(parcsr_read);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -791,6 +791,25 @@ HYPRE_SStructMatrixPrint(const char          *filename,
                          HYPRE_SStructMatrix  matrix,
                          HYPRE_Int            all);
 
+/**
+ * Print the matrix values to binary checkpoint files, one per processor and
+ * part/variable pair, plus one shared file for the non-stencil entries.  If
+ * \e compress is nonzero, runs of equal values are run-length encoded.
+ **/
+HYPRE_Int
+HYPRE_SStructMatrixPrintBinary(const char          *filename,
+                               HYPRE_SStructMatrix  matrix,
+                               HYPRE_Int            compress);
+
+/**
+ * Read the matrix values from files written by \ref
+ * HYPRE_SStructMatrixPrintBinary.  The matrix must already be assembled with
+ * the same graph, on the same number of processors.
+ **/
+HYPRE_Int
+HYPRE_SStructMatrixReadBinaryValues(const char          *filename,
+                                    HYPRE_SStructMatrix  matrix);
+
 /**@}*/
 
 /*--------------------------------------------------------------------------
@@ -1048,6 +1067,25 @@ HYPRE_SStructVectorPrint(const char          *filename,
                          HYPRE_SStructVector  vector,
                          HYPRE_Int            all);
 
+/**
+ * Print the vector values to binary checkpoint files, one per processor and
+ * part/variable pair.  If \e compress is nonzero, runs of equal values are
+ * run-length encoded.
+ **/
+HYPRE_Int
+HYPRE_SStructVectorPrintBinary(const char          *filename,
+                               HYPRE_SStructVector  vector,
+                               HYPRE_Int            compress);
+
+/**
+ * Read the vector values from files written by \ref
+ * HYPRE_SStructVectorPrintBinary.  The vector must already be initialized on
+ * the same grid, on the same number of processors.
+ **/
+HYPRE_Int
+HYPRE_SStructVectorReadBinaryValues(const char          *filename,
+                                    HYPRE_SStructVector  vector);
+
 /**@}*/
 /**@}*/
 
@@ -806,6 +806,61 @@ HYPRE_SStructVectorPrint( const char          *filename,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructVectorPrintBinary( const char          *filename,
+                                HYPRE_SStructVector  vector,
+                                HYPRE_Int            compress )
+{
+   HYPRE_Int  nparts = hypre_SStructVectorNParts(vector);
+   HYPRE_Int  part;
+   char new_filename[255];
+
+   /* the parcsr vector has its own copy of the values */
+   if (hypre_SStructVectorObjectType(vector) == HYPRE_PARCSR)
+   {
+      hypre_SStructVectorParRestore(vector, hypre_SStructVectorParVector(vector));
+   }
+
+   for (part = 0; part < nparts; part++)
+   {
+      hypre_sprintf(new_filename, "%s.%02d", filename, part);
+      hypre_SStructPVectorPrintBinary(new_filename,
+                                      hypre_SStructVectorPVector(vector, part),
+                                      compress);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SStructVectorReadBinaryValues( const char          *filename,
+                                     HYPRE_SStructVector  vector )
+{
+   HYPRE_Int  nparts = hypre_SStructVectorNParts(vector);
+   HYPRE_Int  part;
+   char new_filename[255];
+
+   for (part = 0; part < nparts; part++)
+   {
+      hypre_sprintf(new_filename, "%s.%02d", filename, part);
+      hypre_SStructPVectorReadBinaryValues(new_filename,
+                                           hypre_SStructVectorPVector(vector, part));
+   }
+
+   if (hypre_SStructVectorObjectType(vector) == HYPRE_PARCSR)
+   {
+      hypre_SStructVectorParConvert(vector, &hypre_SStructVectorParVector(vector));
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * copy x to y, y should already exist and be the same size
  *--------------------------------------------------------------------------*/
@@ -48,6 +48,8 @@ HYPRE_Int HYPRE_SStructMatrixSetNSSymmetric ( HYPRE_SStructMatrix matrix , HYPRE
 HYPRE_Int HYPRE_SStructMatrixSetObjectType ( HYPRE_SStructMatrix matrix , HYPRE_Int type );
 HYPRE_Int HYPRE_SStructMatrixGetObject ( HYPRE_SStructMatrix matrix , void **object );
 HYPRE_Int HYPRE_SStructMatrixPrint ( const char *filename , HYPRE_SStructMatrix matrix , HYPRE_Int all );
+HYPRE_Int HYPRE_SStructMatrixPrintBinary ( const char *filename , HYPRE_SStructMatrix matrix , HYPRE_Int compress );
+HYPRE_Int HYPRE_SStructMatrixReadBinaryValues ( const char *filename , HYPRE_SStructMatrix matrix );
 HYPRE_Int HYPRE_SStructMatrixMatvec ( HYPRE_Complex alpha , HYPRE_SStructMatrix A , HYPRE_SStructVector x , HYPRE_Complex beta , HYPRE_SStructVector y );
 
 /* HYPRE_sstruct_stencil.c */
@@ -73,6 +75,8 @@ HYPRE_Int HYPRE_SStructVectorSetConstantValues ( HYPRE_SStructVector vector , HY
 HYPRE_Int HYPRE_SStructVectorSetObjectType ( HYPRE_SStructVector vector , HYPRE_Int type );
 HYPRE_Int HYPRE_SStructVectorGetObject ( HYPRE_SStructVector vector , void **object );
 HYPRE_Int HYPRE_SStructVectorPrint ( const char *filename , HYPRE_SStructVector vector , HYPRE_Int all );
+HYPRE_Int HYPRE_SStructVectorPrintBinary ( const char *filename , HYPRE_SStructVector vector , HYPRE_Int compress );
+HYPRE_Int HYPRE_SStructVectorReadBinaryValues ( const char *filename , HYPRE_SStructVector vector );
 HYPRE_Int HYPRE_SStructVectorCopy ( HYPRE_SStructVector x , HYPRE_SStructVector y );
 HYPRE_Int HYPRE_SStructVectorScale ( HYPRE_Complex alpha , HYPRE_SStructVector y );
 HYPRE_Int HYPRE_SStructInnerProd ( HYPRE_SStructVector x , HYPRE_SStructVector y , HYPRE_Real *result );
@@ -132,6 +136,8 @@ HYPRE_Int hypre_SStructGridIntersect ( hypre_SStructGrid *grid , HYPRE_Int part
 /* sstruct_innerprod.c */
 HYPRE_Int hypre_SStructPInnerProd ( hypre_SStructPVector *px , hypre_SStructPVector *py , HYPRE_Real *presult_ptr );
 HYPRE_Int hypre_SStructInnerProd ( hypre_SStructVector *x , hypre_SStructVector *y , HYPRE_Real *result_ptr );
+HYPRE_Real hypre_SStructInnerProdLocal ( hypre_SStructVector *x , hypre_SStructVector *y );
+HYPRE_Int hypre_SStructBlockInnerProd ( HYPRE_Int nx , hypre_SStructVector **x , HYPRE_Int ny , hypre_SStructVector **y , HYPRE_Real *result );
 
 /* sstruct_matrix.c */
 HYPRE_Int hypre_SStructPMatrixRef ( hypre_SStructPMatrix *matrix , hypre_SStructPMatrix **matrix_ref );
@@ -144,6 +150,8 @@ HYPRE_Int hypre_SStructPMatrixAccumulate ( hypre_SStructPMatrix *pmatrix );
 HYPRE_Int hypre_SStructPMatrixAssemble ( hypre_SStructPMatrix *pmatrix );
 HYPRE_Int hypre_SStructPMatrixSetSymmetric ( hypre_SStructPMatrix *pmatrix , HYPRE_Int var , HYPRE_Int to_var , HYPRE_Int symmetric );
 HYPRE_Int hypre_SStructPMatrixPrint ( const char *filename , hypre_SStructPMatrix *pmatrix , HYPRE_Int all );
+HYPRE_Int hypre_SStructPMatrixPrintBinary ( const char *filename , hypre_SStructPMatrix *pmatrix , HYPRE_Int compress );
+HYPRE_Int hypre_SStructPMatrixReadBinaryValues ( const char *filename , hypre_SStructPMatrix *pmatrix );
 HYPRE_Int hypre_SStructUMatrixInitialize ( hypre_SStructMatrix *matrix );
 HYPRE_Int hypre_SStructUMatrixSetValues ( hypre_SStructMatrix *matrix , HYPRE_Int part , hypre_Index index , HYPRE_Int var , HYPRE_Int nentries , HYPRE_Int *entries , HYPRE_Complex *values , HYPRE_Int action );
 HYPRE_Int hypre_SStructUMatrixSetBoxValues( hypre_SStructMatrix *matrix , HYPRE_Int part , hypre_Box *set_box , HYPRE_Int var , HYPRE_Int nentries , HYPRE_Int *entries , hypre_Box *value_box , HYPRE_Complex *values , HYPRE_Int action );
@@ -187,6 +195,8 @@ HYPRE_Int hypre_SStructPVectorGetValues ( hypre_SStructPVector *pvector , hypre_
 HYPRE_Int hypre_SStructPVectorGetBoxValues( hypre_SStructPVector *pvector , hypre_Box *set_box , HYPRE_Int var , hypre_Box *value_box , HYPRE_Complex *values );
 HYPRE_Int hypre_SStructPVectorSetConstantValues ( hypre_SStructPVector *pvector , HYPRE_Complex value );
 HYPRE_Int hypre_SStructPVectorPrint ( const char *filename , hypre_SStructPVector *pvector , HYPRE_Int all );
+HYPRE_Int hypre_SStructPVectorPrintBinary ( const char *filename , hypre_SStructPVector *pvector , HYPRE_Int compress );
+HYPRE_Int hypre_SStructPVectorReadBinaryValues ( const char *filename , hypre_SStructPVector *pvector );
 HYPRE_Int hypre_SStructVectorRef ( hypre_SStructVector *vector , hypre_SStructVector **vector_ref );
 HYPRE_Int hypre_SStructVectorSetConstantValues ( hypre_SStructVector *vector , HYPRE_Complex value );
 HYPRE_Int hypre_SStructVectorConvert ( hypre_SStructVector *vector , hypre_ParVector **parvector_ptr );
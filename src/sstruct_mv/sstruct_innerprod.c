@@ -91,3 +91,97 @@ hypre_SStructInnerProd( hypre_SStructVector *x,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_SStructInnerProdLocal
+ *
+ * Contribution of the local part of x and y to their inner product
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_SStructInnerProdLocal( hypre_SStructVector *x,
+                             hypre_SStructVector *y )
+{
+   HYPRE_Int              nparts = hypre_SStructVectorNParts(x);
+   HYPRE_Int              x_object_type = hypre_SStructVectorObjectType(x);
+   hypre_SStructPVector  *px, *py;
+   hypre_ParVector       *x_par, *y_par;
+   HYPRE_Real             result = 0.0;
+   HYPRE_Int              part, var;
+
+   if ( (x_object_type == HYPRE_SSTRUCT) || (x_object_type == HYPRE_STRUCT) )
+   {
+      for (part = 0; part < nparts; part++)
+      {
+         px = hypre_SStructVectorPVector(x, part);
+         py = hypre_SStructVectorPVector(y, part);
+         for (var = 0; var < hypre_SStructPVectorNVars(px); var++)
+         {
+            result += hypre_StructInnerProdLocal(hypre_SStructPVectorSVector(px, var),
+                                                 hypre_SStructPVectorSVector(py, var));
+         }
+      }
+   }
+   else if (x_object_type == HYPRE_PARCSR)
+   {
+      hypre_SStructVectorConvert(x, &x_par);
+      hypre_SStructVectorConvert(y, &y_par);
+
+      result = hypre_SeqVectorInnerProd(hypre_ParVectorLocalVector(x_par),
+                                        hypre_ParVectorLocalVector(y_par));
+   }
+
+   return result;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SStructBlockInnerProd
+ *
+ * result[j*nx+i] = <x[i],y[j]> for all i < nx and j < ny, with a single
+ * global reduction.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructBlockInnerProd( HYPRE_Int             nx,
+                             hypre_SStructVector **x,
+                             HYPRE_Int             ny,
+                             hypre_SStructVector **y,
+                             HYPRE_Real           *result )
+{
+   HYPRE_Real  *local_result;
+   HYPRE_Int    i, j;
+
+   for (j = 0; j < ny; j++)
+   {
+      if (hypre_SStructVectorObjectType(y[j]) != hypre_SStructVectorObjectType(x[0]))
+      {
+         hypre_error_in_arg(4);
+         return hypre_error_flag;
+      }
+   }
+   for (i = 0; i < nx; i++)
+   {
+      if (hypre_SStructVectorObjectType(x[i]) != hypre_SStructVectorObjectType(x[0]))
+      {
+         hypre_error_in_arg(2);
+         return hypre_error_flag;
+      }
+   }
+
+   local_result = hypre_CTAlloc(HYPRE_Real, nx*ny, HYPRE_MEMORY_HOST);
+
+   for (j = 0; j < ny; j++)
+   {
+      for (i = 0; i < nx; i++)
+      {
+         local_result[j*nx+i] = hypre_SStructInnerProdLocal(x[i], y[j]);
+      }
+   }
+
+   hypre_MPI_Allreduce(local_result, result, nx*ny, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, hypre_SStructVectorComm(x[0]));
+
+   hypre_TFree(local_result, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
@@ -631,6 +631,66 @@ hypre_SStructPMatrixPrint( const char           *filename,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructPMatrixPrintBinary( const char           *filename,
+                                 hypre_SStructPMatrix *pmatrix,
+                                 HYPRE_Int             compress )
+{
+   HYPRE_Int           nvars = hypre_SStructPMatrixNVars(pmatrix);
+   hypre_StructMatrix *smatrix;
+   HYPRE_Int           vi, vj;
+   char                new_filename[255];
+
+   for (vi = 0; vi < nvars; vi++)
+   {
+      for (vj = 0; vj < nvars; vj++)
+      {
+         smatrix = hypre_SStructPMatrixSMatrix(pmatrix, vi, vj);
+         if (smatrix != NULL)
+         {
+            hypre_sprintf(new_filename, "%s.%02d.%02d", filename, vi, vj);
+            hypre_StructMatrixPrintBinary(new_filename, smatrix, compress);
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Collective.  Returns nonzero on all processors if reading failed on any
+ * of them.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructPMatrixReadBinaryValues( const char           *filename,
+                                      hypre_SStructPMatrix *pmatrix )
+{
+   HYPRE_Int           nvars = hypre_SStructPMatrixNVars(pmatrix);
+   hypre_StructMatrix *smatrix;
+   HYPRE_Int           vi, vj;
+   HYPRE_Int           ierr = 0;
+   char                new_filename[255];
+
+   for (vi = 0; vi < nvars; vi++)
+   {
+      for (vj = 0; vj < nvars; vj++)
+      {
+         smatrix = hypre_SStructPMatrixSMatrix(pmatrix, vi, vj);
+         if (smatrix != NULL)
+         {
+            hypre_sprintf(new_filename, "%s.%02d.%02d", filename, vi, vj);
+            ierr |= hypre_StructMatrixReadBinaryValues(new_filename, smatrix);
+         }
+      }
+   }
+
+   return ierr;
+}
+
 /*==========================================================================
  * SStructUMatrix routines
  *==========================================================================*/
@@ -532,6 +532,52 @@ hypre_SStructPVectorPrint( const char           *filename,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructPVectorPrintBinary( const char           *filename,
+                                 hypre_SStructPVector *pvector,
+                                 HYPRE_Int             compress )
+{
+   HYPRE_Int  nvars = hypre_SStructPVectorNVars(pvector);
+   HYPRE_Int  var;
+   char new_filename[255];
+
+   for (var = 0; var < nvars; var++)
+   {
+      hypre_sprintf(new_filename, "%s.%02d", filename, var);
+      hypre_StructVectorPrintBinary(new_filename,
+                                    hypre_SStructPVectorSVector(pvector, var),
+                                    compress);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Returns 1 if reading failed.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructPVectorReadBinaryValues( const char           *filename,
+                                      hypre_SStructPVector *pvector )
+{
+   HYPRE_Int  nvars = hypre_SStructPVectorNVars(pvector);
+   HYPRE_Int  var;
+   HYPRE_Int  ierr = 0;
+   char new_filename[255];
+
+   for (var = 0; var < nvars; var++)
+   {
+      hypre_sprintf(new_filename, "%s.%02d", filename, var);
+      ierr |= hypre_StructVectorReadBinaryValues(new_filename,
+                                                 hypre_SStructPVectorSVector(pvector, var));
+   }
+
+   return ierr;
+}
+
 /*==========================================================================
  * SStructVector routines
  *==========================================================================*/
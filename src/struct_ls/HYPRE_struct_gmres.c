@@ -25,6 +25,8 @@ HYPRE_StructGMRESCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
 
+   /* single reduction per block for s-step GMRES */
+   gmres_functions->BlockInnerProd = hypre_StructKrylovBlockInnerProd;
    *solver = ( (HYPRE_StructSolver) hypre_GMRESCreate( gmres_functions ) );
 
    return hypre_error_flag;
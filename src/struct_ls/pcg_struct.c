@@ -137,6 +137,20 @@ hypre_StructKrylovInnerProd( void *x,
                                    (hypre_StructVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructKrylovBlockInnerProd( HYPRE_Int    nx,
+                                  void       **x,
+                                  HYPRE_Int    ny,
+                                  void       **y,
+                                  HYPRE_Real  *result )
+{
+   return ( hypre_StructBlockInnerProd( nx, (hypre_StructVector **) x,
+                                        ny, (hypre_StructVector **) y, result ) );
+}
+
 
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
@@ -389,6 +389,29 @@ HYPRE_StructMatrixPrint( const char         *filename,
    return ( hypre_StructMatrixPrint(filename, matrix, all) );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructMatrixPrintBinary( const char         *filename,
+                               HYPRE_StructMatrix  matrix,
+                               HYPRE_Int           compress )
+{
+   return ( hypre_StructMatrixPrintBinary(filename, matrix, compress) );
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructMatrixReadBinaryValues( const char         *filename,
+                                    HYPRE_StructMatrix  matrix )
+{
+   hypre_StructMatrixReadBinaryValues(filename, matrix);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -359,6 +359,22 @@ HYPRE_Int HYPRE_StructMatrixPrint(const char         *filename,
                                   HYPRE_StructMatrix  matrix,
                                   HYPRE_Int           all);
 
+/**
+ * Print the matrix values to binary checkpoint files, one per processor.
+ * If \e compress is nonzero, runs of equal values are run-length encoded.
+ **/
+HYPRE_Int HYPRE_StructMatrixPrintBinary(const char         *filename,
+                                        HYPRE_StructMatrix  matrix,
+                                        HYPRE_Int           compress);
+
+/**
+ * Read the matrix values from files written by \ref
+ * HYPRE_StructMatrixPrintBinary.  The matrix must already be initialized
+ * on the same grid and stencil, and the same number of processors.
+ **/
+HYPRE_Int HYPRE_StructMatrixReadBinaryValues(const char         *filename,
+                                             HYPRE_StructMatrix  matrix);
+
 /**
  * Matvec operator.  This operation is \f$y = \alpha A x + \beta y\f$ .
  * Note that you can do a simple matrix-vector multiply by setting
@@ -520,6 +536,22 @@ HYPRE_Int HYPRE_StructVectorPrint(const char         *filename,
                                   HYPRE_StructVector  vector,
                                   HYPRE_Int           all);
 
+/**
+ * Print the vector values to binary checkpoint files, one per processor.
+ * If \e compress is nonzero, runs of equal values are run-length encoded.
+ **/
+HYPRE_Int HYPRE_StructVectorPrintBinary(const char         *filename,
+                                        HYPRE_StructVector  vector,
+                                        HYPRE_Int           compress);
+
+/**
+ * Read the vector values from files written by \ref
+ * HYPRE_StructVectorPrintBinary.  The vector must already be initialized
+ * on the same grid and the same number of processors.
+ **/
+HYPRE_Int HYPRE_StructVectorReadBinaryValues(const char         *filename,
+                                             HYPRE_StructVector  vector);
+
 /**@}*/
 /**@}*/
 
@@ -299,6 +299,31 @@ HYPRE_StructVectorPrint( const char         *filename,
    return ( hypre_StructVectorPrint(filename, vector, all) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_StructVectorPrintBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructVectorPrintBinary( const char         *filename,
+                               HYPRE_StructVector  vector,
+                               HYPRE_Int           compress )
+{
+   return ( hypre_StructVectorPrintBinary(filename, vector, compress) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_StructVectorReadBinaryValues
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructVectorReadBinaryValues( const char         *filename,
+                                    HYPRE_StructVector  vector )
+{
+   hypre_StructVectorReadBinaryValues(filename, vector);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_StructVectorSetNumGhost
  *--------------------------------------------------------------------------*/
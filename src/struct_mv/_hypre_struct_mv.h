@@ -3191,6 +3191,25 @@ typedef struct hypre_CommPkg_struct
    hypre_Index       identity_dir;
    HYPRE_Int        *identity_order;
 
+   /* persistent requests and buffers for the exchanges after the first one,
+    * created for the tag 'persistent_tag' (see hypre_CommPkgPersistentCreate) */
+   HYPRE_Int            persistent_tag;
+   HYPRE_Int            persistent_active;
+   hypre_MPI_Request   *persistent_requests;
+   hypre_MPI_Status    *persistent_status;
+   HYPRE_Complex      **persistent_send_buffers;
+   HYPRE_Complex      **persistent_recv_buffers;
+
+   /* distributed graph communicator (recv procs -> send procs) and message
+    * counts and displacements of the buffers for MPI_Ineighbor_alltoallv
+    * (see hypre_CommPkgCreateNeighborComm) */
+   HYPRE_Int            has_neighbor_comm;
+   MPI_Comm             neighbor_comm;
+   hypre_int           *neighbor_send_counts;
+   hypre_int           *neighbor_send_displs;
+   hypre_int           *neighbor_recv_counts;
+   hypre_int           *neighbor_recv_displs;
+
 } hypre_CommPkg;
 
 /*--------------------------------------------------------------------------
@@ -3216,6 +3235,9 @@ typedef struct hypre_CommHandle_struct
    /* set = 0, add = 1 */
    HYPRE_Int       action;
 
+   /* requests and buffers belong to comm_pkg */
+   HYPRE_Int       persistent;
+
 } hypre_CommHandle;
 
 /*--------------------------------------------------------------------------
@@ -3307,6 +3329,20 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommPkgIdentityDir(comm_pkg)     (comm_pkg -> identity_dir)
 #define hypre_CommPkgIdentityOrder(comm_pkg)   (comm_pkg -> identity_order)
 
+#define hypre_CommPkgPersistentTag(comm_pkg)         (comm_pkg -> persistent_tag)
+#define hypre_CommPkgPersistentActive(comm_pkg)      (comm_pkg -> persistent_active)
+#define hypre_CommPkgPersistentRequests(comm_pkg)    (comm_pkg -> persistent_requests)
+#define hypre_CommPkgPersistentStatus(comm_pkg)      (comm_pkg -> persistent_status)
+#define hypre_CommPkgPersistentSendBuffers(comm_pkg) (comm_pkg -> persistent_send_buffers)
+#define hypre_CommPkgPersistentRecvBuffers(comm_pkg) (comm_pkg -> persistent_recv_buffers)
+
+#define hypre_CommPkgHasNeighborComm(comm_pkg)       (comm_pkg -> has_neighbor_comm)
+#define hypre_CommPkgNeighborComm(comm_pkg)          (comm_pkg -> neighbor_comm)
+#define hypre_CommPkgNeighborSendCounts(comm_pkg)    (comm_pkg -> neighbor_send_counts)
+#define hypre_CommPkgNeighborSendDispls(comm_pkg)    (comm_pkg -> neighbor_send_displs)
+#define hypre_CommPkgNeighborRecvCounts(comm_pkg)    (comm_pkg -> neighbor_recv_counts)
+#define hypre_CommPkgNeighborRecvDispls(comm_pkg)    (comm_pkg -> neighbor_recv_displs)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommHandle
  *--------------------------------------------------------------------------*/
@@ -3320,6 +3356,7 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommHandleSendBuffers(comm_handle) (comm_handle -> send_buffers)
 #define hypre_CommHandleRecvBuffers(comm_handle) (comm_handle -> recv_buffers)
 #define hypre_CommHandleAction(comm_handle)      (comm_handle -> action)
+#define hypre_CommHandlePersistent(comm_handle)  (comm_handle -> persistent)
 #define hypre_CommHandleSendBuffersDevice(comm_handle)    (comm_handle -> send_buffers_data)
 #define hypre_CommHandleRecvBuffersDevice(comm_handle)    (comm_handle -> recv_buffers_data)
 
@@ -3728,6 +3765,8 @@ HYPRE_Int HYPRE_StructMatrixGetGrid ( HYPRE_StructMatrix matrix , HYPRE_StructGr
 HYPRE_Int HYPRE_StructMatrixSetSymmetric ( HYPRE_StructMatrix matrix , HYPRE_Int symmetric );
 HYPRE_Int HYPRE_StructMatrixSetConstantEntries ( HYPRE_StructMatrix matrix , HYPRE_Int nentries , HYPRE_Int *entries );
 HYPRE_Int HYPRE_StructMatrixPrint ( const char *filename , HYPRE_StructMatrix matrix , HYPRE_Int all );
+HYPRE_Int HYPRE_StructMatrixPrintBinary ( const char *filename , HYPRE_StructMatrix matrix , HYPRE_Int compress );
+HYPRE_Int HYPRE_StructMatrixReadBinaryValues ( const char *filename , HYPRE_StructMatrix matrix );
 HYPRE_Int HYPRE_StructMatrixMatvec ( HYPRE_Complex alpha , HYPRE_StructMatrix A , HYPRE_StructVector x , HYPRE_Complex beta , HYPRE_StructVector y );
 HYPRE_Int HYPRE_StructMatrixClearBoundary( HYPRE_StructMatrix matrix );
 
@@ -3749,6 +3788,8 @@ HYPRE_Int HYPRE_StructVectorGetValues ( HYPRE_StructVector vector , HYPRE_Int *g
 HYPRE_Int HYPRE_StructVectorGetBoxValues ( HYPRE_StructVector vector , HYPRE_Int *ilower , HYPRE_Int *iupper , HYPRE_Complex *values );
 HYPRE_Int HYPRE_StructVectorAssemble ( HYPRE_StructVector vector );
 HYPRE_Int HYPRE_StructVectorPrint ( const char *filename , HYPRE_StructVector vector , HYPRE_Int all );
+HYPRE_Int HYPRE_StructVectorPrintBinary ( const char *filename , HYPRE_StructVector vector , HYPRE_Int compress );
+HYPRE_Int HYPRE_StructVectorReadBinaryValues ( const char *filename , HYPRE_StructVector vector );
 HYPRE_Int HYPRE_StructVectorSetNumGhost ( HYPRE_StructVector vector , HYPRE_Int *num_ghost );
 HYPRE_Int HYPRE_StructVectorCopy ( HYPRE_StructVector x , HYPRE_StructVector y );
 HYPRE_Int HYPRE_StructVectorSetConstantValues ( HYPRE_StructVector vector , HYPRE_Complex values );
@@ -3768,6 +3809,10 @@ HYPRE_Int hypre_StructAxpy ( HYPRE_Complex alpha , hypre_StructVector *x , hypre
 HYPRE_Int hypre_CommPkgCreate ( hypre_CommInfo *comm_info , hypre_BoxArray *send_data_space , hypre_BoxArray *recv_data_space , HYPRE_Int num_values , HYPRE_Int **orders , HYPRE_Int reverse , MPI_Comm comm , hypre_CommPkg **comm_pkg_ptr );
 HYPRE_Int hypre_CommTypeSetEntries ( hypre_CommType *comm_type , HYPRE_Int *boxnums , hypre_Box *boxes , hypre_Index stride , hypre_Index coord , hypre_Index dir , HYPRE_Int *order , hypre_BoxArray *data_space , HYPRE_Int *data_offsets );
 HYPRE_Int hypre_CommTypeSetEntry ( hypre_Box *box , hypre_Index stride , hypre_Index coord , hypre_Index dir , HYPRE_Int *order , hypre_Box *data_box , HYPRE_Int data_box_offset , hypre_CommEntryType *comm_entry );
+HYPRE_Int hypre_CommPkgPersistentCreate ( hypre_CommPkg *comm_pkg , HYPRE_Int tag );
+HYPRE_Int hypre_CommPkgPersistentDestroy ( hypre_CommPkg *comm_pkg );
+HYPRE_Int hypre_CommPkgCreateNeighborComm ( hypre_CommPkg *comm_pkg );
+HYPRE_Int hypre_CommPkgDestroyNeighborComm ( hypre_CommPkg *comm_pkg );
 HYPRE_Int hypre_InitializeCommunication ( hypre_CommPkg *comm_pkg , HYPRE_Complex *send_data , HYPRE_Complex *recv_data , HYPRE_Int action , HYPRE_Int tag , hypre_CommHandle **comm_handle_ptr );
 HYPRE_Int hypre_FinalizeCommunication ( hypre_CommHandle *comm_handle );
 HYPRE_Int hypre_ExchangeLocalData ( hypre_CommPkg *comm_pkg , HYPRE_Complex *send_data , HYPRE_Complex *recv_data , HYPRE_Int action );
@@ -3793,13 +3838,18 @@ HYPRE_Int hypre_GatherAllBoxes ( MPI_Comm comm , hypre_BoxArray *boxes , HYPRE_I
 HYPRE_Int hypre_ComputeBoxnums ( hypre_BoxArray *boxes , HYPRE_Int *procs , HYPRE_Int **boxnums_ptr );
 HYPRE_Int hypre_StructGridPrint ( FILE *file , hypre_StructGrid *grid );
 HYPRE_Int hypre_StructGridRead ( MPI_Comm comm , FILE *file , hypre_StructGrid **grid_ptr );
+HYPRE_Int hypre_StructGridPrintBinary ( FILE *file , hypre_StructGrid *grid );
+HYPRE_Int hypre_StructGridReadBinary ( MPI_Comm comm , FILE *file , HYPRE_Int ierr , hypre_StructGrid **grid_ptr );
+HYPRE_Int hypre_StructGridCheckBinary ( FILE *file , hypre_StructGrid *grid );
 HYPRE_Int hypre_StructGridSetNumGhost ( hypre_StructGrid *grid , HYPRE_Int *num_ghost );
 #if defined(HYPRE_USING_CUDA)
 HYPRE_Int hypre_StructGridGetMaxBoxSize(hypre_StructGrid *grid);
 HYPRE_Int hypre_StructGridSetDataLocation( HYPRE_StructGrid grid, HYPRE_Int data_location );
 #endif
 /* struct_innerprod.c */
+HYPRE_Real hypre_StructInnerProdLocal ( hypre_StructVector *x , hypre_StructVector *y );
 HYPRE_Real hypre_StructInnerProd ( hypre_StructVector *x , hypre_StructVector *y );
+HYPRE_Int hypre_StructBlockInnerProd ( HYPRE_Int nx , hypre_StructVector **x , HYPRE_Int ny , hypre_StructVector **y , HYPRE_Real *result );
 
 /* struct_io.c */
 HYPRE_Int hypre_PrintBoxArrayData ( FILE *file , hypre_BoxArray *box_array , hypre_BoxArray *data_space , HYPRE_Int num_values , HYPRE_Int dim , HYPRE_Complex *data );
@@ -3807,6 +3857,15 @@ HYPRE_Int hypre_PrintCCVDBoxArrayData ( FILE *file , hypre_BoxArray *box_array ,
 HYPRE_Int hypre_PrintCCBoxArrayData ( FILE *file , hypre_BoxArray *box_array , hypre_BoxArray *data_space , HYPRE_Int num_values , HYPRE_Complex *data );
 HYPRE_Int hypre_ReadBoxArrayData ( FILE *file , hypre_BoxArray *box_array , hypre_BoxArray *data_space , HYPRE_Int num_values , HYPRE_Int dim , HYPRE_Complex *data );
 HYPRE_Int hypre_ReadBoxArrayData_CC ( FILE *file , hypre_BoxArray *box_array , hypre_BoxArray *data_space , HYPRE_Int stencil_size , HYPRE_Int real_stencil_size , HYPRE_Int constant_coefficient , HYPRE_Int dim , HYPRE_Complex *data );
+HYPRE_Int hypre_WriteBinary ( FILE *file , const void *data , size_t size , HYPRE_Int n );
+HYPRE_Int hypre_ReadBinary ( FILE *file , void *data , size_t size , HYPRE_Int n );
+HYPRE_Int hypre_PrintBinaryHeader ( FILE *file , const char *object , HYPRE_Int compress );
+HYPRE_Int hypre_ReadBinaryHeader ( FILE *file , const char *object , HYPRE_Int *compress_ptr );
+HYPRE_Int hypre_ReadBinaryCheck ( MPI_Comm comm , HYPRE_Int local_error );
+HYPRE_Int hypre_PrintBoxArrayBinary ( FILE *file , hypre_BoxArray *box_array , HYPRE_Int dim );
+HYPRE_Int hypre_ReadBoxArrayBinary ( FILE *file , HYPRE_Int dim , hypre_BoxArray **box_array_ptr );
+HYPRE_Int hypre_PrintBoxArrayDataBinary ( FILE *file , hypre_BoxArray *box_array , hypre_BoxArray *data_space , HYPRE_Int num_values , HYPRE_Int dim , HYPRE_Complex *data , HYPRE_Int compress );
+HYPRE_Int hypre_ReadBoxArrayDataBinary ( FILE *file , hypre_BoxArray *box_array , hypre_BoxArray *data_space , HYPRE_Int num_values , HYPRE_Int dim , HYPRE_Complex *data );
 
 /* struct_matrix.c */
 HYPRE_Complex *hypre_StructMatrixExtractPointerByIndex ( hypre_StructMatrix *matrix , HYPRE_Int b , hypre_Index index );
@@ -3829,6 +3888,9 @@ HYPRE_Int hypre_StructMatrixClearGhostValues ( hypre_StructMatrix *matrix );
 HYPRE_Int hypre_StructMatrixPrint ( const char *filename , hypre_StructMatrix *matrix , HYPRE_Int all );
 HYPRE_Int hypre_StructMatrixMigrate ( hypre_StructMatrix *from_matrix , hypre_StructMatrix *to_matrix );
 hypre_StructMatrix *hypre_StructMatrixRead ( MPI_Comm comm , const char *filename , HYPRE_Int *num_ghost );
+HYPRE_Int hypre_StructMatrixPrintBinary ( const char *filename , hypre_StructMatrix *matrix , HYPRE_Int compress );
+hypre_StructMatrix *hypre_StructMatrixReadBinary ( MPI_Comm comm , const char *filename , HYPRE_Int *num_ghost );
+HYPRE_Int hypre_StructMatrixReadBinaryValues ( const char *filename , hypre_StructMatrix *matrix );
 HYPRE_Int hypre_StructMatrixClearBoundary( hypre_StructMatrix *matrix);
 
 /* struct_matrix_mask.c */
@@ -3879,6 +3941,9 @@ hypre_CommPkg *hypre_StructVectorGetMigrateCommPkg ( hypre_StructVector *from_ve
 HYPRE_Int hypre_StructVectorMigrate ( hypre_CommPkg *comm_pkg , hypre_StructVector *from_vector , hypre_StructVector *to_vector );
 HYPRE_Int hypre_StructVectorPrint ( const char *filename , hypre_StructVector *vector , HYPRE_Int all );
 hypre_StructVector *hypre_StructVectorRead ( MPI_Comm comm , const char *filename , HYPRE_Int *num_ghost );
+HYPRE_Int hypre_StructVectorPrintBinary ( const char *filename , hypre_StructVector *vector , HYPRE_Int compress );
+hypre_StructVector *hypre_StructVectorReadBinary ( MPI_Comm comm , const char *filename , HYPRE_Int *num_ghost );
+HYPRE_Int hypre_StructVectorReadBinaryValues ( const char *filename , hypre_StructVector *vector );
 hypre_StructVector *hypre_StructVectorClone ( hypre_StructVector *vector );
 
 #ifdef __cplusplus
@@ -602,6 +602,11 @@ hypre_CommPkgCreate( hypre_CommInfo   *comm_info,
    hypre_TFree(comm_boxes_i, HYPRE_MEMORY_HOST);
    hypre_TFree(comm_boxes_j, HYPRE_MEMORY_HOST);
 
+   if (hypre_HandleNeighborComm(hypre_handle()))
+   {
+      hypre_CommPkgCreateNeighborComm(comm_pkg);
+   }
+
    *comm_pkg_ptr = comm_pkg;
 
    return hypre_error_flag;
@@ -758,11 +763,199 @@ hypre_CommTypeSetEntry( hypre_Box           *box,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Create the persistent requests (MPI_Send_init/Recv_init) and buffers that
+ * the exchanges with the given tag reuse once the first communication of
+ * comm_pkg has set the final message sizes.  Requests previously created
+ * for another tag are freed first.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommPkgPersistentCreate( hypre_CommPkg *comm_pkg,
+                               HYPRE_Int      tag )
+{
+   HYPRE_Int            num_sends = hypre_CommPkgNumSends(comm_pkg);
+   HYPRE_Int            num_recvs = hypre_CommPkgNumRecvs(comm_pkg);
+   MPI_Comm             comm      = hypre_CommPkgComm(comm_pkg);
+
+   hypre_MPI_Request   *requests;
+   HYPRE_Complex      **send_buffers;
+   HYPRE_Complex      **recv_buffers;
+   hypre_CommType      *comm_type;
+   HYPRE_Int            i, j;
+
+   hypre_CommPkgPersistentDestroy(comm_pkg);
+
+   requests = hypre_CTAlloc(hypre_MPI_Request, num_sends + num_recvs, HYPRE_MEMORY_HOST);
+
+   send_buffers = hypre_TAlloc(HYPRE_Complex *, num_sends, HYPRE_MEMORY_HOST);
+   if (num_sends > 0)
+   {
+      send_buffers[0] = hypre_CTAlloc(HYPRE_Complex, hypre_CommPkgSendBufsize(comm_pkg),
+                                      HYPRE_MEMORY_HOST);
+      for (i = 1; i < num_sends; i++)
+      {
+         comm_type = hypre_CommPkgSendType(comm_pkg, i-1);
+         send_buffers[i] = send_buffers[i-1] + hypre_CommTypeBufsize(comm_type);
+      }
+   }
+
+   recv_buffers = hypre_TAlloc(HYPRE_Complex *, num_recvs, HYPRE_MEMORY_HOST);
+   if (num_recvs > 0)
+   {
+      recv_buffers[0] = hypre_TAlloc(HYPRE_Complex, hypre_CommPkgRecvBufsize(comm_pkg),
+                                     HYPRE_MEMORY_HOST);
+      for (i = 1; i < num_recvs; i++)
+      {
+         comm_type = hypre_CommPkgRecvType(comm_pkg, i-1);
+         recv_buffers[i] = recv_buffers[i-1] + hypre_CommTypeBufsize(comm_type);
+      }
+   }
+
+   /* same request order as hypre_InitializeCommunication: receives first */
+   j = 0;
+   for (i = 0; i < num_recvs; i++)
+   {
+      comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+      hypre_MPI_Recv_init(recv_buffers[i],
+                          hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                          hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                          tag, comm, &requests[j++]);
+   }
+   for (i = 0; i < num_sends; i++)
+   {
+      comm_type = hypre_CommPkgSendType(comm_pkg, i);
+      hypre_MPI_Send_init(send_buffers[i],
+                          hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                          hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                          tag, comm, &requests[j++]);
+   }
+
+   hypre_CommPkgPersistentTag(comm_pkg)         = tag;
+   hypre_CommPkgPersistentActive(comm_pkg)      = 0;
+   hypre_CommPkgPersistentRequests(comm_pkg)    = requests;
+   hypre_CommPkgPersistentStatus(comm_pkg)      =
+      hypre_CTAlloc(hypre_MPI_Status, num_sends + num_recvs, HYPRE_MEMORY_HOST);
+   hypre_CommPkgPersistentSendBuffers(comm_pkg) = send_buffers;
+   hypre_CommPkgPersistentRecvBuffers(comm_pkg) = recv_buffers;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommPkgPersistentDestroy( hypre_CommPkg *comm_pkg )
+{
+   hypre_MPI_Request   *requests = hypre_CommPkgPersistentRequests(comm_pkg);
+   HYPRE_Complex      **send_buffers = hypre_CommPkgPersistentSendBuffers(comm_pkg);
+   HYPRE_Complex      **recv_buffers = hypre_CommPkgPersistentRecvBuffers(comm_pkg);
+   HYPRE_Int            num_requests;
+   HYPRE_Int            i;
+
+   if (requests)
+   {
+      num_requests = hypre_CommPkgNumSends(comm_pkg) + hypre_CommPkgNumRecvs(comm_pkg);
+      for (i = 0; i < num_requests; i++)
+      {
+         hypre_MPI_Request_free(&requests[i]);
+      }
+      if (hypre_CommPkgNumSends(comm_pkg) > 0)
+      {
+         hypre_TFree(send_buffers[0], HYPRE_MEMORY_HOST);
+      }
+      if (hypre_CommPkgNumRecvs(comm_pkg) > 0)
+      {
+         hypre_TFree(recv_buffers[0], HYPRE_MEMORY_HOST);
+      }
+      hypre_TFree(send_buffers, HYPRE_MEMORY_HOST);
+      hypre_TFree(recv_buffers, HYPRE_MEMORY_HOST);
+      hypre_TFree(requests, HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CommPkgPersistentStatus(comm_pkg), HYPRE_MEMORY_HOST);
+
+      hypre_CommPkgPersistentRequests(comm_pkg)    = NULL;
+      hypre_CommPkgPersistentStatus(comm_pkg)      = NULL;
+      hypre_CommPkgPersistentSendBuffers(comm_pkg) = NULL;
+      hypre_CommPkgPersistentRecvBuffers(comm_pkg) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Create the distributed graph communicator of comm_pkg (collective over its
+ * communicator) that the exchanges after the first one use for
+ * MPI_Ineighbor_alltoallv.  Called for the packages created while
+ * HYPRE_SetNeighborComm is on.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommPkgCreateNeighborComm( hypre_CommPkg *comm_pkg )
+{
+   HYPRE_Int   num_sends = hypre_CommPkgNumSends(comm_pkg);
+   HYPRE_Int   num_recvs = hypre_CommPkgNumRecvs(comm_pkg);
+   HYPRE_Int  *send_procs, *recv_procs;
+   hypre_CommType *comm_type;
+   HYPRE_Int   i;
+
+   if (hypre_CommPkgHasNeighborComm(comm_pkg))
+   {
+      return hypre_error_flag;
+   }
+
+   send_procs = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_sends; i++)
+   {
+      comm_type = hypre_CommPkgSendType(comm_pkg, i);
+      send_procs[i] = hypre_CommTypeProc(comm_type);
+   }
+   recv_procs = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_recvs; i++)
+   {
+      comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+      recv_procs[i] = hypre_CommTypeProc(comm_type);
+   }
+
+   hypre_MPI_Dist_graph_create_adjacent(hypre_CommPkgComm(comm_pkg), num_recvs, recv_procs,
+                                        num_sends, send_procs,
+                                        &hypre_CommPkgNeighborComm(comm_pkg));
+   hypre_CommPkgHasNeighborComm(comm_pkg) = 1;
+
+   hypre_TFree(send_procs, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_procs, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CommPkgDestroyNeighborComm( hypre_CommPkg *comm_pkg )
+{
+   if (hypre_CommPkgHasNeighborComm(comm_pkg))
+   {
+      hypre_MPI_Comm_free(&hypre_CommPkgNeighborComm(comm_pkg));
+      hypre_TFree(hypre_CommPkgNeighborSendCounts(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CommPkgNeighborSendDispls(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CommPkgNeighborRecvCounts(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CommPkgNeighborRecvDispls(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_CommPkgHasNeighborComm(comm_pkg) = 0;
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * Initialize a non-blocking communication exchange.
  *
  * The communication buffers are created, the send buffer is manually
- * packed, and the communication requests are posted.
+ * packed, and the communication requests are posted.  After the first
+ * exchange, the persistent requests and buffers of comm_pkg are restarted
+ * instead, unless these are turned off (HYPRE_SetPersistentComm) or in use.
+ * With a distributed graph communicator on comm_pkg and HYPRE_SetNeighborComm
+ * on, one MPI_Ineighbor_alltoallv replaces the point-to-point messages.
  *
  * Different "actions" are possible when the buffer data is unpacked:
  *   action = 0    - copy the data over existing values in memory
@@ -807,34 +1000,9 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
 
    HYPRE_Int            i, j, d, ll;
    HYPRE_Int            size;
+   HYPRE_Int            persistent;
+   HYPRE_Int            neighbor;
 
-   /*--------------------------------------------------------------------
-    * allocate requests and status
-    *--------------------------------------------------------------------*/
-
-   num_requests = num_sends + num_recvs;
-   requests = hypre_CTAlloc(hypre_MPI_Request,  num_requests, HYPRE_MEMORY_HOST);
-   status   = hypre_CTAlloc(hypre_MPI_Status,  num_requests, HYPRE_MEMORY_HOST);
-
-   /*--------------------------------------------------------------------
-    * allocate buffers
-    *--------------------------------------------------------------------*/
-
-   /* allocate send buffers */
-   send_buffers = hypre_TAlloc(HYPRE_Complex *,  num_sends, HYPRE_MEMORY_HOST);
-   if (num_sends > 0)
-   {
-      size = hypre_CommPkgSendBufsize(comm_pkg);
-      send_buffers[0] =  hypre_CTAlloc(HYPRE_Complex,  size, HYPRE_MEMORY_HOST);
-      for (i = 1; i < num_sends; i++)
-      {
-         comm_type = hypre_CommPkgSendType(comm_pkg, i-1);
-         size = hypre_CommTypeBufsize(comm_type);
-         send_buffers[i] = send_buffers[i-1] + size;
-      }
-   }
-
-   /* Prepare send buffers: allocate device buffer */
    HYPRE_Int alloc_dev_buffer = 0;
    /* In the case of running on device and cannot access host memory from device */
 #if (defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP))
@@ -847,6 +1015,107 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
 #endif
 #endif
 
+   num_requests = num_sends + num_recvs;
+
+   /* the first exchange also sends the box prefixes, so the message sizes
+    * are final only after it */
+   neighbor = hypre_CommPkgHasNeighborComm(comm_pkg) && !hypre_CommPkgFirstComm(comm_pkg);
+   persistent = hypre_HandlePersistentComm(hypre_handle()) && !alloc_dev_buffer && !neighbor &&
+                num_requests > 0 && !hypre_CommPkgFirstComm(comm_pkg) &&
+                !hypre_CommPkgPersistentActive(comm_pkg);
+
+   if (neighbor)
+   {
+      num_requests = 1;
+      if (!hypre_CommPkgNeighborSendCounts(comm_pkg))
+      {
+         hypre_int *counts, *displs;
+
+         counts = hypre_TAlloc(hypre_int, num_sends, HYPRE_MEMORY_HOST);
+         displs = hypre_TAlloc(hypre_int, num_sends, HYPRE_MEMORY_HOST);
+         size = 0;
+         for (i = 0; i < num_sends; i++)
+         {
+            comm_type = hypre_CommPkgSendType(comm_pkg, i);
+            counts[i] = (hypre_int) hypre_CommTypeBufsize(comm_type);
+            displs[i] = (hypre_int) size;
+            size += hypre_CommTypeBufsize(comm_type);
+         }
+         hypre_CommPkgNeighborSendCounts(comm_pkg) = counts;
+         hypre_CommPkgNeighborSendDispls(comm_pkg) = displs;
+
+         counts = hypre_TAlloc(hypre_int, num_recvs, HYPRE_MEMORY_HOST);
+         displs = hypre_TAlloc(hypre_int, num_recvs, HYPRE_MEMORY_HOST);
+         size = 0;
+         for (i = 0; i < num_recvs; i++)
+         {
+            comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+            counts[i] = (hypre_int) hypre_CommTypeBufsize(comm_type);
+            displs[i] = (hypre_int) size;
+            size += hypre_CommTypeBufsize(comm_type);
+         }
+         hypre_CommPkgNeighborRecvCounts(comm_pkg) = counts;
+         hypre_CommPkgNeighborRecvDispls(comm_pkg) = displs;
+      }
+   }
+
+   if (persistent)
+   {
+      if (!hypre_CommPkgPersistentRequests(comm_pkg) ||
+          hypre_CommPkgPersistentTag(comm_pkg) != tag)
+      {
+         hypre_CommPkgPersistentCreate(comm_pkg, tag);
+      }
+      hypre_CommPkgPersistentActive(comm_pkg) = 1;
+
+      requests     = hypre_CommPkgPersistentRequests(comm_pkg);
+      status       = hypre_CommPkgPersistentStatus(comm_pkg);
+      send_buffers = hypre_CommPkgPersistentSendBuffers(comm_pkg);
+      recv_buffers = hypre_CommPkgPersistentRecvBuffers(comm_pkg);
+   }
+   else
+   {
+      /*-----------------------------------------------------------------
+       * allocate requests and status
+       *-----------------------------------------------------------------*/
+
+      requests = hypre_CTAlloc(hypre_MPI_Request,  num_requests, HYPRE_MEMORY_HOST);
+      status   = hypre_CTAlloc(hypre_MPI_Status,  num_requests, HYPRE_MEMORY_HOST);
+
+      /*-----------------------------------------------------------------
+       * allocate buffers
+       *-----------------------------------------------------------------*/
+
+      /* allocate send buffers */
+      send_buffers = hypre_TAlloc(HYPRE_Complex *,  num_sends, HYPRE_MEMORY_HOST);
+      if (num_sends > 0)
+      {
+         size = hypre_CommPkgSendBufsize(comm_pkg);
+         send_buffers[0] =  hypre_CTAlloc(HYPRE_Complex,  size, HYPRE_MEMORY_HOST);
+         for (i = 1; i < num_sends; i++)
+         {
+            comm_type = hypre_CommPkgSendType(comm_pkg, i-1);
+            size = hypre_CommTypeBufsize(comm_type);
+            send_buffers[i] = send_buffers[i-1] + size;
+         }
+      }
+
+      /* allocate recv buffers */
+      recv_buffers = hypre_TAlloc(HYPRE_Complex *,  num_recvs, HYPRE_MEMORY_HOST);
+      if (num_recvs > 0)
+      {
+         size = hypre_CommPkgRecvBufsize(comm_pkg);
+         recv_buffers[0] =  hypre_TAlloc(HYPRE_Complex,  size, HYPRE_MEMORY_HOST);
+         for (i = 1; i < num_recvs; i++)
+         {
+            comm_type = hypre_CommPkgRecvType(comm_pkg, i-1);
+            size = hypre_CommTypeBufsize(comm_type);
+            recv_buffers[i] = recv_buffers[i-1] + size;
+         }
+      }
+   }
+
+   /* Prepare send buffers: allocate device buffer */
    if (alloc_dev_buffer)
    {
       send_buffers_data = hypre_TAlloc(HYPRE_Complex *, num_sends,HYPRE_MEMORY_HOST);
@@ -874,20 +1143,6 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
       send_buffers_data = send_buffers;
    }
 
-   /* allocate recv buffers */
-   recv_buffers = hypre_TAlloc(HYPRE_Complex *,  num_recvs, HYPRE_MEMORY_HOST);
-   if (num_recvs > 0)
-   {
-      size = hypre_CommPkgRecvBufsize(comm_pkg);
-      recv_buffers[0] =  hypre_TAlloc(HYPRE_Complex,  size, HYPRE_MEMORY_HOST);
-      for (i = 1; i < num_recvs; i++)
-      {
-         comm_type = hypre_CommPkgRecvType(comm_pkg, i-1);
-         size = hypre_CommTypeBufsize(comm_type);
-         recv_buffers[i] = recv_buffers[i-1] + size;
-      }
-   }
-
    /* Prepare recv buffers */
    if (alloc_dev_buffer)
    {
@@ -1017,8 +1272,25 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
     * post receives and initiate sends
     *--------------------------------------------------------------------*/
 
+   if (persistent)
+   {
+      hypre_MPI_Startall(num_requests, requests);
+   }
+   else if (neighbor)
+   {
+      hypre_MPI_Ineighbor_alltoallv((num_sends > 0) ? send_buffers[0] : NULL,
+                                    hypre_CommPkgNeighborSendCounts(comm_pkg),
+                                    hypre_CommPkgNeighborSendDispls(comm_pkg),
+                                    HYPRE_MPI_COMPLEX,
+                                    (num_recvs > 0) ? recv_buffers[0] : NULL,
+                                    hypre_CommPkgNeighborRecvCounts(comm_pkg),
+                                    hypre_CommPkgNeighborRecvDispls(comm_pkg),
+                                    HYPRE_MPI_COMPLEX,
+                                    hypre_CommPkgNeighborComm(comm_pkg), &requests[0]);
+   }
+
    j = 0;
-   for(i = 0; i < num_recvs; i++)
+   for(i = 0; i < num_recvs && !persistent && !neighbor; i++)
    {
       comm_type = hypre_CommPkgRecvType(comm_pkg, i);
       hypre_MPI_Irecv(recv_buffers[i],
@@ -1033,7 +1305,7 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
       }
    }
 
-   for(i = 0; i < num_sends; i++)
+   for(i = 0; i < num_sends && !persistent && !neighbor; i++)
    {
       comm_type = hypre_CommPkgSendType(comm_pkg, i);
       hypre_MPI_Isend(send_buffers[i],
@@ -1090,6 +1362,7 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
    hypre_CommHandleSendBuffers(comm_handle) = send_buffers;
    hypre_CommHandleRecvBuffers(comm_handle) = recv_buffers;
    hypre_CommHandleAction(comm_handle)      = action;
+   hypre_CommHandlePersistent(comm_handle)  = persistent;
    hypre_CommHandleSendBuffersDevice(comm_handle) = send_buffers_data;
    hypre_CommHandleRecvBuffersDevice(comm_handle) = recv_buffers_data;
 
@@ -1296,6 +1569,15 @@ hypre_FinalizeCommunication( hypre_CommHandle *comm_handle )
     * Free up communication handle
     *--------------------------------------------------------------------*/
 
+   if (hypre_CommHandlePersistent(comm_handle))
+   {
+      /* requests and buffers stay with comm_pkg */
+      hypre_CommPkgPersistentActive(comm_pkg) = 0;
+      hypre_TFree(comm_handle, HYPRE_MEMORY_HOST);
+
+      return hypre_error_flag;
+   }
+
    hypre_TFree(hypre_CommHandleRequests(comm_handle), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_CommHandleStatus(comm_handle), HYPRE_MEMORY_HOST);
    if (num_sends > 0)
@@ -1428,6 +1710,9 @@ hypre_CommPkgDestroy( hypre_CommPkg *comm_pkg )
 
    if (comm_pkg)
    {
+      hypre_CommPkgPersistentDestroy(comm_pkg);
+      hypre_CommPkgDestroyNeighborComm(comm_pkg);
+
       /* note that entries are allocated in two stages for To/Recv */
       if (hypre_CommPkgNumRecvs(comm_pkg) > 0)
       {
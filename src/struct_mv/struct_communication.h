@@ -113,6 +113,25 @@ typedef struct hypre_CommPkg_struct
    hypre_Index       identity_dir;
    HYPRE_Int        *identity_order;
 
+   /* persistent requests and buffers for the exchanges after the first one,
+    * created for the tag 'persistent_tag' (see hypre_CommPkgPersistentCreate) */
+   HYPRE_Int            persistent_tag;
+   HYPRE_Int            persistent_active;
+   hypre_MPI_Request   *persistent_requests;
+   hypre_MPI_Status    *persistent_status;
+   HYPRE_Complex      **persistent_send_buffers;
+   HYPRE_Complex      **persistent_recv_buffers;
+
+   /* distributed graph communicator (recv procs -> send procs) and message
+    * counts and displacements of the buffers for MPI_Ineighbor_alltoallv
+    * (see hypre_CommPkgCreateNeighborComm) */
+   HYPRE_Int            has_neighbor_comm;
+   MPI_Comm             neighbor_comm;
+   hypre_int           *neighbor_send_counts;
+   hypre_int           *neighbor_send_displs;
+   hypre_int           *neighbor_recv_counts;
+   hypre_int           *neighbor_recv_displs;
+
 } hypre_CommPkg;
 
 /*--------------------------------------------------------------------------
@@ -138,6 +157,9 @@ typedef struct hypre_CommHandle_struct
    /* set = 0, add = 1 */
    HYPRE_Int       action;
 
+   /* requests and buffers belong to comm_pkg */
+   HYPRE_Int       persistent;
+
 } hypre_CommHandle;
 
 /*--------------------------------------------------------------------------
@@ -229,6 +251,20 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommPkgIdentityDir(comm_pkg)     (comm_pkg -> identity_dir)
 #define hypre_CommPkgIdentityOrder(comm_pkg)   (comm_pkg -> identity_order)
 
+#define hypre_CommPkgPersistentTag(comm_pkg)         (comm_pkg -> persistent_tag)
+#define hypre_CommPkgPersistentActive(comm_pkg)      (comm_pkg -> persistent_active)
+#define hypre_CommPkgPersistentRequests(comm_pkg)    (comm_pkg -> persistent_requests)
+#define hypre_CommPkgPersistentStatus(comm_pkg)      (comm_pkg -> persistent_status)
+#define hypre_CommPkgPersistentSendBuffers(comm_pkg) (comm_pkg -> persistent_send_buffers)
+#define hypre_CommPkgPersistentRecvBuffers(comm_pkg) (comm_pkg -> persistent_recv_buffers)
+
+#define hypre_CommPkgHasNeighborComm(comm_pkg)       (comm_pkg -> has_neighbor_comm)
+#define hypre_CommPkgNeighborComm(comm_pkg)          (comm_pkg -> neighbor_comm)
+#define hypre_CommPkgNeighborSendCounts(comm_pkg)    (comm_pkg -> neighbor_send_counts)
+#define hypre_CommPkgNeighborSendDispls(comm_pkg)    (comm_pkg -> neighbor_send_displs)
+#define hypre_CommPkgNeighborRecvCounts(comm_pkg)    (comm_pkg -> neighbor_recv_counts)
+#define hypre_CommPkgNeighborRecvDispls(comm_pkg)    (comm_pkg -> neighbor_recv_displs)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommHandle
  *--------------------------------------------------------------------------*/
@@ -242,6 +278,7 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommHandleSendBuffers(comm_handle) (comm_handle -> send_buffers)
 #define hypre_CommHandleRecvBuffers(comm_handle) (comm_handle -> recv_buffers)
 #define hypre_CommHandleAction(comm_handle)      (comm_handle -> action)
+#define hypre_CommHandlePersistent(comm_handle)  (comm_handle -> persistent)
 #define hypre_CommHandleSendBuffersDevice(comm_handle)    (comm_handle -> send_buffers_data)
 #define hypre_CommHandleRecvBuffersDevice(comm_handle)    (comm_handle -> recv_buffers_data)
 
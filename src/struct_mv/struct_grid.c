@@ -835,6 +835,146 @@ hypre_StructGridRead( MPI_Comm           comm,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_StructGridPrintBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructGridPrintBinary( FILE             *file,
+                             hypre_StructGrid *grid )
+{
+   HYPRE_Int  ndim = hypre_StructGridNDim(grid);
+
+   hypre_WriteBinary(file, &ndim, sizeof(HYPRE_Int), 1);
+   hypre_PrintBoxArrayBinary(file, hypre_StructGridBoxes(grid), ndim);
+   hypre_WriteBinary(file, hypre_StructGridPeriodic(grid), sizeof(HYPRE_Int), ndim);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Reads the grid section of a binary file.  The periodicity is returned
+ * in periodic.  Returns 1 if reading failed.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_StructGridReadBinaryBoxes( FILE            *file,
+                                 HYPRE_Int       *ndim_ptr,
+                                 hypre_BoxArray **boxes_ptr,
+                                 hypre_Index      periodic )
+{
+   HYPRE_Int  ndim;
+
+   *boxes_ptr = NULL;
+   if (hypre_ReadBinary(file, &ndim, sizeof(HYPRE_Int), 1) || ndim < 1 || ndim > HYPRE_MAXDIM)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error reading grid from binary file\n");
+      return 1;
+   }
+   hypre_SetIndex(periodic, 0);
+   *ndim_ptr = ndim;
+
+   return ( hypre_ReadBoxArrayBinary(file, ndim, boxes_ptr) ||
+            hypre_ReadBinary(file, periodic, sizeof(HYPRE_Int), ndim) );
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructGridReadBinary
+ *
+ * Collective.  Must be called on all processors, also by those on which
+ * reading the file already failed (ierr nonzero), since the grid is
+ * assembled only if the boxes were read everywhere.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructGridReadBinary( MPI_Comm           comm,
+                            FILE              *file,
+                            HYPRE_Int          ierr,
+                            hypre_StructGrid **grid_ptr )
+{
+   hypre_StructGrid *grid;
+   hypre_BoxArray   *boxes;
+   hypre_Box        *box;
+   hypre_Index       periodic;
+   HYPRE_Int         ndim, i;
+
+   *grid_ptr = NULL;
+   boxes = NULL;
+   if (!ierr)
+   {
+      ierr = hypre_StructGridReadBinaryBoxes(file, &ndim, &boxes, periodic);
+   }
+   if (hypre_ReadBinaryCheck(comm, ierr))
+   {
+      hypre_BoxArrayDestroy(boxes);
+      return hypre_error_flag;
+   }
+
+   hypre_StructGridCreate(comm, ndim, &grid);
+   hypre_ForBoxI(i, boxes)
+   {
+      box = hypre_BoxArrayBox(boxes, i);
+      hypre_StructGridSetExtents(grid, hypre_BoxIMin(box), hypre_BoxIMax(box));
+   }
+   hypre_StructGridSetPeriodic(grid, periodic);
+   hypre_StructGridAssemble(grid);
+   hypre_BoxArrayDestroy(boxes);
+
+   *grid_ptr = grid;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructGridCheckBinary
+ *
+ * Reads the grid section of a binary file and checks that it describes
+ * the local boxes of grid, for reading data into existing objects.
+ * Returns 1 if reading failed or the grids differ.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructGridCheckBinary( FILE             *file,
+                             hypre_StructGrid *grid )
+{
+   hypre_BoxArray   *boxes, *grid_boxes = hypre_StructGridBoxes(grid);
+   hypre_Index       periodic;
+   HYPRE_Int         ndim, i;
+   HYPRE_Int         ierr;
+
+   ierr = hypre_StructGridReadBinaryBoxes(file, &ndim, &boxes, periodic);
+   if (ierr)
+   {
+      hypre_BoxArrayDestroy(boxes);
+      return ierr;
+   }
+
+   if ( ndim != hypre_StructGridNDim(grid) ||
+        hypre_BoxArraySize(boxes) != hypre_BoxArraySize(grid_boxes) )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: binary file is for another grid\n");
+      ierr = 1;
+   }
+   else
+   {
+      hypre_ForBoxI(i, boxes)
+      {
+         if ( !hypre_IndexesEqual(hypre_BoxIMin(hypre_BoxArrayBox(boxes, i)),
+                                  hypre_BoxIMin(hypre_BoxArrayBox(grid_boxes, i)), ndim) ||
+              !hypre_IndexesEqual(hypre_BoxIMax(hypre_BoxArrayBox(boxes, i)),
+                                  hypre_BoxIMax(hypre_BoxArrayBox(grid_boxes, i)), ndim) )
+         {
+            hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: binary file is for another grid\n");
+            ierr = 1;
+            break;
+         }
+      }
+   }
+   hypre_BoxArrayDestroy(boxes);
+
+   return ierr;
+}
+
 /*------------------------------------------------------------------------------
  * GEC0902  hypre_StructGridSetNumGhost
  *
@@ -14,16 +14,15 @@
 #include "_hypre_struct_mv.h"
 
 /*--------------------------------------------------------------------------
- * hypre_StructInnerProd
+ * hypre_StructInnerProdLocal
+ *
+ * Contribution of the local boxes to the inner product of x and y
  *--------------------------------------------------------------------------*/
 
 HYPRE_Real
-hypre_StructInnerProd( hypre_StructVector *x,
-                       hypre_StructVector *y )
+hypre_StructInnerProdLocal( hypre_StructVector *x,
+                            hypre_StructVector *y )
 {
-   HYPRE_Real       final_innerprod_result;
-   HYPRE_Real       process_result;
-
    hypre_Box       *x_data_box;
    hypre_Box       *y_data_box;
 
@@ -95,7 +94,21 @@ hypre_StructInnerProd( hypre_StructVector *x,
       local_result += (HYPRE_Real) box_sum;
    }
 
-   process_result = (HYPRE_Real) local_result;
+   return local_result;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructInnerProd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_StructInnerProd( hypre_StructVector *x,
+                       hypre_StructVector *y )
+{
+   HYPRE_Real       final_innerprod_result;
+   HYPRE_Real       process_result;
+
+   process_result = hypre_StructInnerProdLocal(x, y);
 
    hypre_MPI_Allreduce(&process_result, &final_innerprod_result, 1,
                        HYPRE_MPI_REAL, hypre_MPI_SUM, hypre_StructVectorComm(x));
@@ -104,3 +117,40 @@ hypre_StructInnerProd( hypre_StructVector *x,
 
    return final_innerprod_result;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_StructBlockInnerProd
+ *
+ * result[j*nx+i] = <x[i],y[j]> for all i < nx and j < ny, with a single
+ * global reduction.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructBlockInnerProd( HYPRE_Int            nx,
+                            hypre_StructVector **x,
+                            HYPRE_Int            ny,
+                            hypre_StructVector **y,
+                            HYPRE_Real          *result )
+{
+   HYPRE_Real  *local_result;
+   HYPRE_Int    i, j;
+
+   local_result = hypre_CTAlloc(HYPRE_Real, nx*ny, HYPRE_MEMORY_HOST);
+
+   for (j = 0; j < ny; j++)
+   {
+      for (i = 0; i < nx; i++)
+      {
+         local_result[j*nx+i] = hypre_StructInnerProdLocal(x[i], y[j]);
+      }
+   }
+
+   hypre_MPI_Allreduce(local_result, result, nx*ny,
+                       HYPRE_MPI_REAL, hypre_MPI_SUM, hypre_StructVectorComm(x[0]));
+
+   hypre_IncFLOPCount(2*nx*ny*hypre_StructVectorGlobalSize(x[0]));
+
+   hypre_TFree(local_result, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
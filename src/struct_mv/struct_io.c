@@ -378,3 +378,514 @@ hypre_ReadBoxArrayData_CC( FILE            *file,
    return hypre_error_flag;
 }
 
+
+/*--------------------------------------------------------------------------
+ * Binary files
+ *
+ * A binary file starts with a header (magic string, object name, format
+ * version, sizes of HYPRE_Int and HYPRE_Complex, compression flag).  The
+ * data of each box and value is written in box loop order as a block
+ * that is either raw or, with compression, run-length encoded.  Runs of
+ * equal values are common in coefficient data (constant stencils, zero
+ * boundary coefficients), and a block is only encoded when that makes it
+ * smaller.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_BINARY_IO_VERSION  1
+#define HYPRE_BINARY_IO_RAW      0
+#define HYPRE_BINARY_IO_RLE      1
+
+static const char hypre_binary_io_magic[8] = {'H', 'Y', 'P', 'R', 'E', 'S', 'T', 'R'};
+
+/*--------------------------------------------------------------------------
+ * hypre_WriteBinary, hypre_ReadBinary
+ *
+ * The binary readers below return 1 if reading failed and 0 otherwise
+ * (errors are also set in hypre_error_flag).  Their callers keep this local
+ * status, so that an error set before the read does not make it fail.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_WriteBinary( FILE       *file,
+                   const void *data,
+                   size_t      size,
+                   HYPRE_Int   n )
+{
+   if (n > 0 && fwrite(data, size, (size_t) n, file) != (size_t) n)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error writing binary file\n");
+   }
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_ReadBinary( FILE      *file,
+                  void      *data,
+                  size_t     size,
+                  HYPRE_Int  n )
+{
+   if (n > 0 && fread(data, size, (size_t) n, file) != (size_t) n)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error reading binary file\n");
+      return 1;
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PrintBinaryHeader
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PrintBinaryHeader( FILE       *file,
+                         const char *object,
+                         HYPRE_Int   compress )
+{
+   char      name[16];
+   hypre_int info[4];
+
+   memset(name, 0, sizeof(name));
+   strncpy(name, object, sizeof(name) - 1);
+   info[0] = HYPRE_BINARY_IO_VERSION;
+   info[1] = (hypre_int) sizeof(HYPRE_Int);
+   info[2] = (hypre_int) sizeof(HYPRE_Complex);
+   info[3] = (hypre_int) compress;
+
+   hypre_WriteBinary(file, hypre_binary_io_magic, 1, 8);
+   hypre_WriteBinary(file, name, 1, 16);
+   hypre_WriteBinary(file, info, sizeof(hypre_int), 4);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ReadBinaryHeader
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ReadBinaryHeader( FILE       *file,
+                        const char *object,
+                        HYPRE_Int  *compress_ptr )
+{
+   char      magic[8];
+   char      name[16];
+   hypre_int info[4];
+
+   if ( hypre_ReadBinary(file, magic, 1, 8) ||
+        hypre_ReadBinary(file, name, 1, 16) ||
+        hypre_ReadBinary(file, info, sizeof(hypre_int), 4) )
+   {
+      return 1;
+   }
+
+   name[15] = '\0';
+   if ( memcmp(magic, hypre_binary_io_magic, 8) || strcmp(name, object) ||
+        info[0] != HYPRE_BINARY_IO_VERSION )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: not a binary file of this kind\n");
+      return 1;
+   }
+   if ( info[1] != (hypre_int) sizeof(HYPRE_Int) ||
+        info[2] != (hypre_int) sizeof(HYPRE_Complex) )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: binary file written with other data types\n");
+      return 1;
+   }
+
+   if (compress_ptr)
+   {
+      *compress_ptr = (HYPRE_Int) info[3];
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ReadBinaryCheck
+ *
+ * Collective.  Returns nonzero on all processors if reading failed on any of
+ * them (local_error is the read status of this processor), so that the
+ * collective assemble steps are skipped consistently.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ReadBinaryCheck( MPI_Comm  comm,
+                       HYPRE_Int local_error )
+{
+   HYPRE_Int  error;
+
+   local_error = (local_error != 0);
+
+   hypre_MPI_Allreduce(&local_error, &error, 1, HYPRE_MPI_INT, hypre_MPI_MAX, comm);
+   if (error && !local_error)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error reading binary file on another processor\n");
+   }
+
+   return error;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PrintBoxArrayBinary, hypre_ReadBoxArrayBinary
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PrintBoxArrayBinary( FILE           *file,
+                           hypre_BoxArray *box_array,
+                           HYPRE_Int       dim )
+{
+   hypre_Box  *box;
+   HYPRE_Int   extents[2*HYPRE_MAXDIM];
+   HYPRE_Int   i, d;
+
+   i = hypre_BoxArraySize(box_array);
+   hypre_WriteBinary(file, &i, sizeof(HYPRE_Int), 1);
+
+   hypre_ForBoxI(i, box_array)
+   {
+      box = hypre_BoxArrayBox(box_array, i);
+      for (d = 0; d < dim; d++)
+      {
+         extents[d]       = hypre_BoxIMinD(box, d);
+         extents[dim + d] = hypre_BoxIMaxD(box, d);
+      }
+      hypre_WriteBinary(file, extents, sizeof(HYPRE_Int), 2*dim);
+   }
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_ReadBoxArrayBinary( FILE            *file,
+                          HYPRE_Int        dim,
+                          hypre_BoxArray **box_array_ptr )
+{
+   hypre_BoxArray *box_array;
+   hypre_Box      *box;
+   HYPRE_Int       extents[2*HYPRE_MAXDIM];
+   HYPRE_Int       num_boxes, i, d;
+   HYPRE_Int       ierr = 0;
+
+   *box_array_ptr = NULL;
+   if (hypre_ReadBinary(file, &num_boxes, sizeof(HYPRE_Int), 1) || num_boxes < 0)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error reading boxes from binary file\n");
+      return 1;
+   }
+
+   box_array = hypre_BoxArrayCreate(num_boxes, dim);
+   for (i = 0; i < num_boxes && !ierr; i++)
+   {
+      ierr = hypre_ReadBinary(file, extents, sizeof(HYPRE_Int), 2*dim);
+      box = hypre_BoxArrayBox(box_array, i);
+      for (d = 0; d < dim; d++)
+      {
+         hypre_BoxIMinD(box, d) = extents[d];
+         hypre_BoxIMaxD(box, d) = extents[dim + d];
+      }
+   }
+   *box_array_ptr = box_array;
+
+   return ierr;
+}
+
+/*--------------------------------------------------------------------------
+ * Writes a block of n values, run-length encoded if compress is set and
+ * this saves space.  The run arrays must hold n entries.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_WriteValuesBinary( FILE          *file,
+                         HYPRE_Complex *values,
+                         HYPRE_Int      n,
+                         HYPRE_Int      compress,
+                         HYPRE_Int     *run_lengths,
+                         HYPRE_Complex *run_values )
+{
+   HYPRE_Int  mode = HYPRE_BINARY_IO_RAW;
+   HYPRE_Int  num_runs = 0, k;
+
+   if (compress && n > 0)
+   {
+      run_lengths[0] = 1;
+      run_values[0]  = values[0];
+      num_runs = 1;
+      for (k = 1; k < n; k++)
+      {
+         if (values[k] == run_values[num_runs - 1])
+         {
+            run_lengths[num_runs - 1]++;
+         }
+         else
+         {
+            run_lengths[num_runs] = 1;
+            run_values[num_runs]  = values[k];
+            num_runs++;
+         }
+      }
+      if ( sizeof(HYPRE_Int) + (size_t) num_runs * (sizeof(HYPRE_Int) + sizeof(HYPRE_Complex)) <
+           (size_t) n * sizeof(HYPRE_Complex) )
+      {
+         mode = HYPRE_BINARY_IO_RLE;
+      }
+   }
+
+   hypre_WriteBinary(file, &mode, sizeof(HYPRE_Int), 1);
+   if (mode == HYPRE_BINARY_IO_RLE)
+   {
+      hypre_WriteBinary(file, &num_runs, sizeof(HYPRE_Int), 1);
+      hypre_WriteBinary(file, run_lengths, sizeof(HYPRE_Int), num_runs);
+      hypre_WriteBinary(file, run_values, sizeof(HYPRE_Complex), num_runs);
+   }
+   else
+   {
+      hypre_WriteBinary(file, values, sizeof(HYPRE_Complex), n);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Reads a block of n values written by hypre_WriteValuesBinary.  The run
+ * arrays must hold n entries.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ReadValuesBinary( FILE          *file,
+                        HYPRE_Complex *values,
+                        HYPRE_Int      n,
+                        HYPRE_Int     *run_lengths,
+                        HYPRE_Complex *run_values )
+{
+   HYPRE_Int  mode, num_runs, r, k, m;
+
+   if (hypre_ReadBinary(file, &mode, sizeof(HYPRE_Int), 1))
+   {
+      return 1;
+   }
+   if (mode == HYPRE_BINARY_IO_RAW)
+   {
+      return hypre_ReadBinary(file, values, sizeof(HYPRE_Complex), n);
+   }
+   else if (mode == HYPRE_BINARY_IO_RLE)
+   {
+      if (hypre_ReadBinary(file, &num_runs, sizeof(HYPRE_Int), 1))
+      {
+         return 1;
+      }
+      if (num_runs < 0 || num_runs > n)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error in binary file data\n");
+         return 1;
+      }
+      if ( hypre_ReadBinary(file, run_lengths, sizeof(HYPRE_Int), num_runs) ||
+           hypre_ReadBinary(file, run_values, sizeof(HYPRE_Complex), num_runs) )
+      {
+         return 1;
+      }
+      for (r = 0, k = 0; r < num_runs; r++)
+      {
+         if (run_lengths[r] < 0 || k + run_lengths[r] > n)
+         {
+            hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error in binary file data\n");
+            return 1;
+         }
+         for (m = 0; m < run_lengths[r]; m++)
+         {
+            values[k++] = run_values[r];
+         }
+      }
+      if (k != n)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error in binary file data\n");
+         return 1;
+      }
+   }
+   else
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error in binary file data\n");
+      return 1;
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PrintBoxArrayDataBinary
+ *
+ * Binary version of hypre_PrintBoxArrayData.  Each box is packed and
+ * written separately, so only one data box is buffered at a time.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PrintBoxArrayDataBinary( FILE            *file,
+                               hypre_BoxArray  *box_array,
+                               hypre_BoxArray  *data_space,
+                               HYPRE_Int        num_values,
+                               HYPRE_Int        dim,
+                               HYPRE_Complex   *data,
+                               HYPRE_Int        compress )
+{
+   hypre_Box       *box;
+   hypre_Box       *data_box;
+
+   HYPRE_Int        data_box_volume, box_volume, max_volume = 0;
+
+   hypre_Index      loop_size;
+   hypre_IndexRef   start;
+   hypre_Index      stride;
+
+   HYPRE_Int        i, j;
+   HYPRE_Int        device = (hypre_GetActualMemLocation(HYPRE_MEMORY_DEVICE) != hypre_MEMORY_HOST);
+   HYPRE_Complex   *data_host = NULL, *buffer, *run_values = NULL;
+   HYPRE_Int       *run_lengths = NULL;
+
+   hypre_ForBoxI(i, box_array)
+   {
+      max_volume = hypre_max(max_volume, hypre_BoxVolume(hypre_BoxArrayBox(box_array, i)));
+   }
+   buffer = hypre_TAlloc(HYPRE_Complex, max_volume, HYPRE_MEMORY_HOST);
+   if (compress)
+   {
+      run_lengths = hypre_TAlloc(HYPRE_Int, max_volume, HYPRE_MEMORY_HOST);
+      run_values  = hypre_TAlloc(HYPRE_Complex, max_volume, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_SetIndex(stride, 1);
+
+   hypre_ForBoxI(i, box_array)
+   {
+      box      = hypre_BoxArrayBox(box_array, i);
+      data_box = hypre_BoxArrayBox(data_space, i);
+
+      start = hypre_BoxIMin(box);
+      data_box_volume = hypre_BoxVolume(data_box);
+      box_volume = hypre_BoxVolume(box);
+
+      hypre_BoxGetSize(box, loop_size);
+
+      if (device)
+      {
+         data_host = hypre_TReAlloc(data_host, HYPRE_Complex, num_values*data_box_volume,
+                                    HYPRE_MEMORY_HOST);
+         hypre_TMemcpy(data_host, data, HYPRE_Complex, num_values*data_box_volume,
+                       HYPRE_MEMORY_HOST, HYPRE_MEMORY_DEVICE);
+      }
+
+      for (j = 0; j < num_values; j++)
+      {
+         HYPRE_Complex *datap = (device ? data_host : data) + j*data_box_volume;
+
+         hypre_SerialBoxLoop2Begin(dim, loop_size,
+                                   data_box, start, stride, datai,
+                                   box, start, stride, bufi);
+         {
+            buffer[bufi] = datap[datai];
+         }
+         hypre_SerialBoxLoop2End(datai, bufi);
+
+         hypre_WriteValuesBinary(file, buffer, box_volume, compress, run_lengths, run_values);
+      }
+
+      data += num_values*data_box_volume;
+   }
+
+   hypre_TFree(buffer, HYPRE_MEMORY_HOST);
+   hypre_TFree(run_lengths, HYPRE_MEMORY_HOST);
+   hypre_TFree(run_values, HYPRE_MEMORY_HOST);
+   hypre_TFree(data_host, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ReadBoxArrayDataBinary
+ *
+ * Reads data written by hypre_PrintBoxArrayDataBinary for the same boxes
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ReadBoxArrayDataBinary( FILE            *file,
+                              hypre_BoxArray  *box_array,
+                              hypre_BoxArray  *data_space,
+                              HYPRE_Int        num_values,
+                              HYPRE_Int        dim,
+                              HYPRE_Complex   *data       )
+{
+   hypre_Box       *box;
+   hypre_Box       *data_box;
+
+   HYPRE_Int        data_box_volume, box_volume, max_volume = 0;
+
+   hypre_Index      loop_size;
+   hypre_IndexRef   start;
+   hypre_Index      stride;
+
+   HYPRE_Int        i, j;
+   HYPRE_Int        device = (hypre_GetActualMemLocation(HYPRE_MEMORY_DEVICE) != hypre_MEMORY_HOST);
+   HYPRE_Complex   *data_host = NULL, *buffer, *run_values;
+   HYPRE_Int       *run_lengths;
+   HYPRE_Int        ierr = 0;
+
+   hypre_ForBoxI(i, box_array)
+   {
+      max_volume = hypre_max(max_volume, hypre_BoxVolume(hypre_BoxArrayBox(box_array, i)));
+   }
+   buffer      = hypre_TAlloc(HYPRE_Complex, max_volume, HYPRE_MEMORY_HOST);
+   run_lengths = hypre_TAlloc(HYPRE_Int, max_volume, HYPRE_MEMORY_HOST);
+   run_values  = hypre_TAlloc(HYPRE_Complex, max_volume, HYPRE_MEMORY_HOST);
+
+   hypre_SetIndex(stride, 1);
+
+   hypre_ForBoxI(i, box_array)
+   {
+      box      = hypre_BoxArrayBox(box_array, i);
+      data_box = hypre_BoxArrayBox(data_space, i);
+
+      start = hypre_BoxIMin(box);
+      data_box_volume = hypre_BoxVolume(data_box);
+      box_volume = hypre_BoxVolume(box);
+
+      hypre_BoxGetSize(box, loop_size);
+
+      if (device)
+      {
+         data_host = hypre_TReAlloc(data_host, HYPRE_Complex, num_values*data_box_volume,
+                                    HYPRE_MEMORY_HOST);
+         hypre_TMemcpy(data_host, data, HYPRE_Complex, num_values*data_box_volume,
+                       HYPRE_MEMORY_HOST, HYPRE_MEMORY_DEVICE);
+      }
+
+      for (j = 0; j < num_values && !ierr; j++)
+      {
+         HYPRE_Complex *datap = (device ? data_host : data) + j*data_box_volume;
+
+         ierr = hypre_ReadValuesBinary(file, buffer, box_volume, run_lengths, run_values);
+
+         hypre_SerialBoxLoop2Begin(dim, loop_size,
+                                   data_box, start, stride, datai,
+                                   box, start, stride, bufi);
+         {
+            datap[datai] = buffer[bufi];
+         }
+         hypre_SerialBoxLoop2End(datai, bufi);
+      }
+
+      if (device)
+      {
+         hypre_TMemcpy(data, data_host, HYPRE_Complex, num_values*data_box_volume,
+                       HYPRE_MEMORY_DEVICE, HYPRE_MEMORY_HOST);
+      }
+
+      data += num_values*data_box_volume;
+   }
+
+   hypre_TFree(buffer, HYPRE_MEMORY_HOST);
+   hypre_TFree(run_lengths, HYPRE_MEMORY_HOST);
+   hypre_TFree(run_values, HYPRE_MEMORY_HOST);
+   hypre_TFree(data_host, HYPRE_MEMORY_HOST);
+
+   return ierr;
+}
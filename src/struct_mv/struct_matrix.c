@@ -1959,6 +1959,315 @@ hypre_StructMatrixRead( MPI_Comm    comm,
 
    return matrix;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixPrintBinary
+ *
+ * Binary version of hypre_StructMatrixPrint, one file per processor.  Only
+ * the values of the grid boxes are written, as blocks that are run-length
+ * encoded when compress is nonzero and this makes them smaller.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixPrintBinary( const char         *filename,
+                               hypre_StructMatrix *matrix,
+                               HYPRE_Int           compress )
+{
+   FILE                 *file;
+   char                  new_filename[255];
+
+   hypre_StructGrid     *grid = hypre_StructMatrixGrid(matrix);
+   hypre_BoxArray       *boxes = hypre_StructGridBoxes(grid);
+   hypre_StructStencil  *stencil = hypre_StructMatrixStencil(matrix);
+   hypre_Index          *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int             stencil_size = hypre_StructStencilSize(stencil);
+   HYPRE_Int            *symm_elements = hypre_StructMatrixSymmElements(matrix);
+   HYPRE_Int             ndim = hypre_StructMatrixNDim(matrix);
+   HYPRE_Int             constant_coefficient = hypre_StructMatrixConstantCoefficient(matrix);
+   hypre_Index           center_index;
+   HYPRE_Int             info[2], num_stored, const_size, center_rank, i;
+   HYPRE_Int             myid;
+
+   hypre_MPI_Comm_rank(hypre_StructMatrixComm(matrix), &myid);
+   hypre_sprintf(new_filename, "%s.%05d", filename, myid);
+   if ((file = fopen(new_filename, "wb")) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open output file\n");
+      return hypre_error_flag;
+   }
+
+   /* header, grid and stored stencil entries */
+   hypre_PrintBinaryHeader(file, "StructMatrix", compress);
+   info[0] = hypre_StructMatrixSymmetric(matrix);
+   info[1] = constant_coefficient;
+   hypre_WriteBinary(file, info, sizeof(HYPRE_Int), 2);
+   hypre_StructGridPrintBinary(file, grid);
+
+   num_stored = 0;
+   for (i = 0; i < stencil_size; i++)
+   {
+      num_stored += (symm_elements[i] < 0);
+   }
+   hypre_WriteBinary(file, &num_stored, sizeof(HYPRE_Int), 1);
+   for (i = 0; i < stencil_size; i++)
+   {
+      if (symm_elements[i] < 0)
+      {
+         hypre_WriteBinary(file, stencil_shape[i], sizeof(HYPRE_Int), ndim);
+      }
+   }
+
+   /* constant coefficients, then variable coefficients of the boxes */
+   const_size = (constant_coefficient == 1) ? hypre_StructMatrixDataConstSize(matrix) :
+                (constant_coefficient == 2) ? stencil_size : 0;
+   hypre_WriteBinary(file, &const_size, sizeof(HYPRE_Int), 1);
+   hypre_WriteBinary(file, hypre_StructMatrixDataConst(matrix), sizeof(HYPRE_Complex), const_size);
+
+   if (constant_coefficient == 0)
+   {
+      hypre_PrintBoxArrayDataBinary(file, boxes, hypre_StructMatrixDataSpace(matrix),
+                                    hypre_StructMatrixNumValues(matrix), ndim,
+                                    hypre_StructMatrixData(matrix), compress);
+   }
+   else if (constant_coefficient == 2 && hypre_BoxArraySize(boxes) > 0)
+   {
+      hypre_SetIndex(center_index, 0);
+      center_rank = hypre_StructStencilElementRank(stencil, center_index);
+      hypre_PrintBoxArrayDataBinary(file, boxes, hypre_StructMatrixDataSpace(matrix), 1, ndim,
+                                    hypre_StructMatrixBoxData(matrix, 0, center_rank), compress);
+   }
+
+   fclose(file);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Reads the coefficients of a binary matrix file into matrix, which has
+ * the grid and stencil of the file.  Returns 1 if reading failed.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_StructMatrixReadBinaryData( FILE               *file,
+                                  hypre_StructMatrix *matrix )
+{
+   hypre_BoxArray       *boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(matrix));
+   hypre_StructStencil  *stencil = hypre_StructMatrixStencil(matrix);
+   HYPRE_Int             ndim = hypre_StructMatrixNDim(matrix);
+   HYPRE_Int             constant_coefficient = hypre_StructMatrixConstantCoefficient(matrix);
+   hypre_Index           center_index;
+   HYPRE_Int             const_size, center_rank;
+
+   if (hypre_ReadBinary(file, &const_size, sizeof(HYPRE_Int), 1))
+   {
+      return 1;
+   }
+   if ( const_size != ((constant_coefficient == 1) ? hypre_StructMatrixDataConstSize(matrix) :
+                       (constant_coefficient == 2) ? hypre_StructStencilSize(stencil) : 0) )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: binary file is for another matrix\n");
+      return 1;
+   }
+   if (hypre_ReadBinary(file, hypre_StructMatrixDataConst(matrix), sizeof(HYPRE_Complex), const_size))
+   {
+      return 1;
+   }
+
+   if (constant_coefficient == 0)
+   {
+      return hypre_ReadBoxArrayDataBinary(file, boxes, hypre_StructMatrixDataSpace(matrix),
+                                          hypre_StructMatrixNumValues(matrix), ndim,
+                                          hypre_StructMatrixData(matrix));
+   }
+   else if (constant_coefficient == 2 && hypre_BoxArraySize(boxes) > 0)
+   {
+      hypre_SetIndex(center_index, 0);
+      center_rank = hypre_StructStencilElementRank(stencil, center_index);
+      return hypre_ReadBoxArrayDataBinary(file, boxes, hypre_StructMatrixDataSpace(matrix), 1, ndim,
+                                          hypre_StructMatrixBoxData(matrix, 0, center_rank));
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixReadBinary
+ *
+ * Creates a matrix from the files written by hypre_StructMatrixPrintBinary
+ * on the same number of processors.  Returns NULL on error.
+ *--------------------------------------------------------------------------*/
+
+hypre_StructMatrix *
+hypre_StructMatrixReadBinary( MPI_Comm    comm,
+                              const char *filename,
+                              HYPRE_Int  *num_ghost )
+{
+   FILE                 *file;
+   char                  new_filename[255];
+
+   hypre_StructMatrix   *matrix = NULL;
+   hypre_StructGrid     *grid = NULL;
+   hypre_StructStencil  *stencil;
+   hypre_Index          *stencil_shape;
+   HYPRE_Int             ndim, stencil_size, info[2], i;
+   HYPRE_Int             myid;
+   HYPRE_Int             ierr = 0;
+
+   hypre_MPI_Comm_rank(comm, &myid);
+   hypre_sprintf(new_filename, "%s.%05d", filename, myid);
+   if ((file = fopen(new_filename, "rb")) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open input file\n");
+      ierr = 1;
+   }
+   else
+   {
+      ierr = ( hypre_ReadBinaryHeader(file, "StructMatrix", NULL) ||
+               hypre_ReadBinary(file, info, sizeof(HYPRE_Int), 2) );
+   }
+   hypre_StructGridReadBinary(comm, file, ierr, &grid);
+   if (grid == NULL)
+   {
+      if (file)
+      {
+         fclose(file);
+      }
+      return NULL;
+   }
+
+   ierr = hypre_ReadBinary(file, &stencil_size, sizeof(HYPRE_Int), 1);
+   if (!ierr && stencil_size < 1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error reading binary matrix file\n");
+      ierr = 1;
+   }
+   if (!ierr)
+   {
+      ndim = hypre_StructGridNDim(grid);
+      stencil_shape = hypre_CTAlloc(hypre_Index, stencil_size, HYPRE_MEMORY_HOST);
+      for (i = 0; i < stencil_size && !ierr; i++)
+      {
+         ierr = hypre_ReadBinary(file, stencil_shape[i], sizeof(HYPRE_Int), ndim);
+      }
+      stencil = hypre_StructStencilCreate(ndim, stencil_size, stencil_shape);
+
+      matrix = hypre_StructMatrixCreate(comm, grid, stencil);
+      hypre_StructMatrixSymmetric(matrix) = info[0];
+      hypre_StructMatrixConstantCoefficient(matrix) = info[1];
+      hypre_StructMatrixSetNumGhost(matrix, num_ghost);
+      hypre_StructMatrixInitialize(matrix);
+      hypre_StructStencilDestroy(stencil);
+
+      if (!ierr)
+      {
+         ierr = hypre_StructMatrixReadBinaryData(file, matrix);
+      }
+   }
+   hypre_StructGridDestroy(grid);
+   fclose(file);
+
+   if (hypre_ReadBinaryCheck(comm, ierr))
+   {
+      hypre_StructMatrixDestroy(matrix);
+      return NULL;
+   }
+   hypre_StructMatrixAssemble(matrix);
+
+   return matrix;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixReadBinaryValues
+ *
+ * Reads the coefficients of an existing matrix from the files written by
+ * hypre_StructMatrixPrintBinary for a matrix with the same grid, stencil
+ * and storage type (e.g., to restart from a checkpoint).  Collective.
+ * Returns nonzero on all processors if reading failed on any of them.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixReadBinaryValues( const char         *filename,
+                                    hypre_StructMatrix *matrix )
+{
+   FILE                 *file;
+   char                  new_filename[255];
+
+   hypre_StructStencil  *stencil = hypre_StructMatrixStencil(matrix);
+   hypre_Index          *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int             stencil_size = hypre_StructStencilSize(stencil);
+   HYPRE_Int            *symm_elements = hypre_StructMatrixSymmElements(matrix);
+   HYPRE_Int             ndim = hypre_StructMatrixNDim(matrix);
+   hypre_Index           shape;
+   HYPRE_Int             info[2], num_stored, i;
+   HYPRE_Int             myid;
+   HYPRE_Int             ierr = 0;
+
+   hypre_MPI_Comm_rank(hypre_StructMatrixComm(matrix), &myid);
+   hypre_sprintf(new_filename, "%s.%05d", filename, myid);
+   if ((file = fopen(new_filename, "rb")) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open input file\n");
+      ierr = 1;
+   }
+   else
+   {
+      ierr = ( hypre_ReadBinaryHeader(file, "StructMatrix", NULL) ||
+               hypre_ReadBinary(file, info, sizeof(HYPRE_Int), 2) );
+   }
+   if ( !ierr &&
+        (info[0] != hypre_StructMatrixSymmetric(matrix) ||
+         info[1] != hypre_StructMatrixConstantCoefficient(matrix)) )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: binary file is for another matrix\n");
+      ierr = 1;
+   }
+   if (!ierr)
+   {
+      ierr = hypre_StructGridCheckBinary(file, hypre_StructMatrixGrid(matrix));
+   }
+
+   /* the stored stencil entries must be the same */
+   if (!ierr)
+   {
+      ierr = hypre_ReadBinary(file, &num_stored, sizeof(HYPRE_Int), 1);
+      for (i = 0; i < stencil_size && !ierr; i++)
+      {
+         if (symm_elements[i] < 0)
+         {
+            hypre_SetIndex(shape, 0);
+            ierr = hypre_ReadBinary(file, shape, sizeof(HYPRE_Int), ndim);
+            num_stored--;
+            if (!hypre_IndexesEqual(shape, stencil_shape[i], ndim))
+            {
+               break;
+            }
+         }
+      }
+      if (!ierr && (i < stencil_size || num_stored != 0))
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: binary file is for another stencil\n");
+         ierr = 1;
+      }
+   }
+
+   if (!ierr)
+   {
+      ierr = hypre_StructMatrixReadBinaryData(file, matrix);
+   }
+   if (file)
+   {
+      fclose(file);
+   }
+
+   ierr = hypre_ReadBinaryCheck(hypre_StructMatrixComm(matrix), ierr);
+   if (!ierr)
+   {
+      hypre_StructMatrixAssemble(matrix);
+   }
+
+   return ierr;
+}
+
 /*--------------------------------------------------------------------------
  * clears matrix stencil coefficients reaching outside of the physical boundaries
  *--------------------------------------------------------------------------*/
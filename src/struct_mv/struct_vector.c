@@ -1179,6 +1179,150 @@ hypre_StructVectorRead( MPI_Comm    comm,
    return vector;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_StructVectorPrintBinary
+ *
+ * Binary version of hypre_StructVectorPrint for the values of the grid
+ * boxes (see hypre_StructMatrixPrintBinary)
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructVectorPrintBinary( const char         *filename,
+                               hypre_StructVector *vector,
+                               HYPRE_Int           compress )
+{
+   FILE              *file;
+   char               new_filename[255];
+
+   hypre_StructGrid  *grid = hypre_StructVectorGrid(vector);
+   HYPRE_Int          myid;
+
+   hypre_MPI_Comm_rank(hypre_StructVectorComm(vector), &myid);
+   hypre_sprintf(new_filename, "%s.%05d", filename, myid);
+   if ((file = fopen(new_filename, "wb")) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open output file\n");
+      return hypre_error_flag;
+   }
+
+   hypre_PrintBinaryHeader(file, "StructVector", compress);
+   hypre_StructGridPrintBinary(file, grid);
+   hypre_PrintBoxArrayDataBinary(file, hypre_StructGridBoxes(grid),
+                                 hypre_StructVectorDataSpace(vector), 1,
+                                 hypre_StructGridNDim(grid),
+                                 hypre_StructVectorData(vector), compress);
+
+   fclose(file);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructVectorReadBinary
+ *
+ * Creates a vector from the files written by hypre_StructVectorPrintBinary
+ * on the same number of processors.  Returns NULL on error.
+ *--------------------------------------------------------------------------*/
+
+hypre_StructVector *
+hypre_StructVectorReadBinary( MPI_Comm    comm,
+                              const char *filename,
+                              HYPRE_Int  *num_ghost )
+{
+   FILE                 *file;
+   char                  new_filename[255];
+
+   hypre_StructVector   *vector;
+   hypre_StructGrid     *grid = NULL;
+   HYPRE_Int             myid;
+   HYPRE_Int             ierr = 0;
+
+   hypre_MPI_Comm_rank(comm, &myid);
+   hypre_sprintf(new_filename, "%s.%05d", filename, myid);
+   if ((file = fopen(new_filename, "rb")) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open input file\n");
+      ierr = 1;
+   }
+   else
+   {
+      ierr = hypre_ReadBinaryHeader(file, "StructVector", NULL);
+   }
+   hypre_StructGridReadBinary(comm, file, ierr, &grid);
+   if (grid == NULL)
+   {
+      if (file)
+      {
+         fclose(file);
+      }
+      return NULL;
+   }
+
+   vector = hypre_StructVectorCreate(comm, grid);
+   hypre_StructVectorSetNumGhost(vector, num_ghost);
+   hypre_StructVectorInitialize(vector);
+   hypre_StructGridDestroy(grid);
+
+   ierr = hypre_ReadBoxArrayDataBinary(file, hypre_StructGridBoxes(hypre_StructVectorGrid(vector)),
+                                       hypre_StructVectorDataSpace(vector), 1,
+                                       hypre_StructVectorNDim(vector),
+                                       hypre_StructVectorData(vector));
+   fclose(file);
+
+   if (hypre_ReadBinaryCheck(comm, ierr))
+   {
+      hypre_StructVectorDestroy(vector);
+      return NULL;
+   }
+   hypre_StructVectorAssemble(vector);
+
+   return vector;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructVectorReadBinaryValues
+ *
+ * Reads the values of an existing vector from the files written by
+ * hypre_StructVectorPrintBinary for a vector on the same grid.  Returns 1
+ * if reading failed.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructVectorReadBinaryValues( const char         *filename,
+                                    hypre_StructVector *vector )
+{
+   FILE                 *file;
+   char                  new_filename[255];
+
+   hypre_StructGrid     *grid = hypre_StructVectorGrid(vector);
+   HYPRE_Int             myid;
+   HYPRE_Int             ierr;
+
+   hypre_MPI_Comm_rank(hypre_StructVectorComm(vector), &myid);
+   hypre_sprintf(new_filename, "%s.%05d", filename, myid);
+   if ((file = fopen(new_filename, "rb")) == NULL)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Error: can't open input file\n");
+      return 1;
+   }
+
+   ierr = hypre_ReadBinaryHeader(file, "StructVector", NULL);
+   if (!ierr)
+   {
+      ierr = hypre_StructGridCheckBinary(file, grid);
+   }
+   if (!ierr)
+   {
+      ierr = hypre_ReadBoxArrayDataBinary(file, hypre_StructGridBoxes(grid),
+                                          hypre_StructVectorDataSpace(vector), 1,
+                                          hypre_StructGridNDim(grid),
+                                          hypre_StructVectorData(vector));
+   }
+   fclose(file);
+
+   return ierr;
+}
+
 /*--------------------------------------------------------------------------
  * The following is used only as a debugging aid.
  *
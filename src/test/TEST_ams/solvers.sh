@@ -41,6 +41,8 @@ FILES="\
  ${TNAME}.out.6\
  ${TNAME}.out.7\
  ${TNAME}.out.12\
+ ${TNAME}.out.13\
+ ${TNAME}.out.14\
 "
 for i in $FILES
 do
@@ -32,6 +32,171 @@ tail -17 ${TNAME}.out.200 | head -6 > ${TNAME}.mgr_testdata
 tail -17 ${TNAME}.out.202 | head -6 > ${TNAME}.mgr_testdata.temp
 diff ${TNAME}.mgr_testdata ${TNAME}.mgr_testdata.temp >&2
 
+#=============================================================================
+# IJ: split-phase and SELL-C-sigma matvecs should give the same results as
+#     the default matvec
+#=============================================================================
+
+grep -A1 "^Iterations" ${TNAME}.out.0 > ${TNAME}.mvo_testdata
+grep -A1 "^Iterations" ${TNAME}.out.mvo > ${TNAME}.mvo_testdata.temp
+diff ${TNAME}.mvo_testdata ${TNAME}.mvo_testdata.temp >&2
+grep -A1 "^Iterations" ${TNAME}.out.sell > ${TNAME}.mvo_testdata.temp
+diff ${TNAME}.mvo_testdata ${TNAME}.mvo_testdata.temp >&2
+grep -A1 "^Iterations" ${TNAME}.out.mixp.2 > ${TNAME}.mvo_testdata
+grep -A1 "^Iterations" ${TNAME}.out.sell.cheby > ${TNAME}.mvo_testdata.temp
+diff ${TNAME}.mvo_testdata ${TNAME}.mvo_testdata.temp >&2
+tail -4 ${TNAME}.out.reuse.1 > ${TNAME}.mvo_testdata
+tail -4 ${TNAME}.out.reuse.sell > ${TNAME}.mvo_testdata.temp
+diff ${TNAME}.mvo_testdata ${TNAME}.mvo_testdata.temp >&2
+
+#=============================================================================
+# IJ: single precision storage of the AMG hierarchy should not change the
+#     number of iterations
+#=============================================================================
+
+grep "^Iterations" ${TNAME}.out.mixp.0 > ${TNAME}.mixp_testdata
+grep "^Iterations" ${TNAME}.out.mixp.1 > ${TNAME}.mixp_testdata.temp
+diff ${TNAME}.mixp_testdata ${TNAME}.mixp_testdata.temp >&2
+grep "^Iterations" ${TNAME}.out.mixp.2 > ${TNAME}.mixp_testdata
+grep "^Iterations" ${TNAME}.out.mixp.3 > ${TNAME}.mixp_testdata.temp
+diff ${TNAME}.mixp_testdata ${TNAME}.mixp_testdata.temp >&2
+grep "Iterations" ${TNAME}.out.reuse.1 > ${TNAME}.mixp_testdata
+grep "Iterations" ${TNAME}.out.mixp.4 > ${TNAME}.mixp_testdata.temp
+diff ${TNAME}.mixp_testdata ${TNAME}.mixp_testdata.temp >&2
+
+#=============================================================================
+# IJ: pipelined CG should take the same number of iterations as standard CG
+#=============================================================================
+
+grep "^Iterations" ${TNAME}.out.0 > ${TNAME}.pcgp_testdata
+grep "^Iterations" ${TNAME}.out.pcgp.0 > ${TNAME}.pcgp_testdata.temp
+diff ${TNAME}.pcgp_testdata ${TNAME}.pcgp_testdata.temp >&2
+grep "^Iterations" ${TNAME}.out.1 > ${TNAME}.pcgp_testdata
+grep "^Iterations" ${TNAME}.out.pcgp.1 > ${TNAME}.pcgp_testdata.temp
+diff ${TNAME}.pcgp_testdata ${TNAME}.pcgp_testdata.temp >&2
+
+#=============================================================================
+# IJ: s-step GMRES should take the same number of iterations as standard GMRES
+#=============================================================================
+
+grep "Iterations" ${TNAME}.out.2 > ${TNAME}.sstep_testdata
+grep "Iterations" ${TNAME}.out.sstep.0 > ${TNAME}.sstep_testdata.temp
+diff ${TNAME}.sstep_testdata ${TNAME}.sstep_testdata.temp >&2
+grep "Iterations" ${TNAME}.out.3 > ${TNAME}.sstep_testdata
+grep "Iterations" ${TNAME}.out.sstep.1 > ${TNAME}.sstep_testdata.temp
+diff ${TNAME}.sstep_testdata ${TNAME}.sstep_testdata.temp >&2
+
+#=============================================================================
+# IJ: the AMG profile should not change the solve and should write the levels
+#=============================================================================
+
+grep "^BoomerAMG Iterations" ${TNAME}.out.reuse.1 > ${TNAME}.profile_testdata
+grep "^BoomerAMG Iterations" ${TNAME}.out.profile > ${TNAME}.profile_testdata.temp
+diff ${TNAME}.profile_testdata ${TNAME}.profile_testdata.temp >&2
+if ! grep -q "\"num_levels\"" ${TNAME}.out.profile.json; then
+   echo "Missing \"num_levels\" in ${TNAME}.out.profile.json" >&2
+fi
+
+#=============================================================================
+# IJ: reading the binary files on the writing processors should give the same solve
+#=============================================================================
+
+tail -2 ${TNAME}.out.bin.0 > ${TNAME}.bin_testdata
+tail -2 ${TNAME}.out.bin.2 > ${TNAME}.bin_testdata.temp
+diff ${TNAME}.bin_testdata ${TNAME}.bin_testdata.temp >&2
+
+#=============================================================================
+# IJ: the setup arena should not change the solve
+#=============================================================================
+
+tail -2 ${TNAME}.out.arena.0 > ${TNAME}.arena_testdata
+tail -2 ${TNAME}.out.arena.1 > ${TNAME}.arena_testdata.temp
+diff ${TNAME}.arena_testdata ${TNAME}.arena_testdata.temp >&2
+
+tail -2 ${TNAME}.out.arena.2 > ${TNAME}.arena_testdata
+tail -2 ${TNAME}.out.arena.3 > ${TNAME}.arena_testdata.temp
+diff ${TNAME}.arena_testdata ${TNAME}.arena_testdata.temp >&2
+
+#=============================================================================
+# IJ: the memory statistics should be printed and not change the solve
+#=============================================================================
+
+tail -2 ${TNAME}.out.memstats.0 > ${TNAME}.memstats_testdata
+tail -2 ${TNAME}.out.memstats.1 > ${TNAME}.memstats_testdata.temp
+diff ${TNAME}.memstats_testdata ${TNAME}.memstats_testdata.temp >&2
+
+MEM_COUNT=`grep "memory (MB" ${TNAME}.out.memstats.1 | wc -l`
+if [ "$MEM_COUNT" != "2" ]; then
+   echo "Incorrect number of memory statistics in ${TNAME}.out.memstats.1" >&2
+fi
+
+#=============================================================================
+# IJ: persistent requests should not change the solve, and the halo exchange
+# benchmark should time both modes
+#=============================================================================
+
+tail -2 ${TNAME}.out.persistent.0 > ${TNAME}.persistent_testdata
+tail -2 ${TNAME}.out.persistent.1 > ${TNAME}.persistent_testdata.temp
+diff ${TNAME}.persistent_testdata ${TNAME}.persistent_testdata.temp >&2
+
+BENCH_COUNT=`grep "seconds per exchange" ${TNAME}.out.persistent.2 | wc -l`
+if [ "$BENCH_COUNT" != "3" ]; then
+   echo "Incorrect number of halo exchange timings in ${TNAME}.out.persistent.2" >&2
+fi
+
+#=============================================================================
+# IJ: neighborhood collectives should not change the solve
+#=============================================================================
+
+tail -2 ${TNAME}.out.neighbor.0 > ${TNAME}.neighbor_testdata
+tail -2 ${TNAME}.out.neighbor.1 > ${TNAME}.neighbor_testdata.temp
+diff ${TNAME}.neighbor_testdata ${TNAME}.neighbor_testdata.temp >&2
+if ! grep -q "\"comm_backend\": \"neighbor\"" ${TNAME}.out.neighbor.json; then
+   echo "Missing neighbor backend in ${TNAME}.out.neighbor.json" >&2
+fi
+tail -2 ${TNAME}.out.neighbor.2 > ${TNAME}.neighbor_testdata.temp
+diff ${TNAME}.neighbor_testdata ${TNAME}.neighbor_testdata.temp >&2
+if ! grep -q "\"comm_backend\": \"neighbor\"" ${TNAME}.out.neighbor.2.json ||
+   grep "\"comm_backend\"" ${TNAME}.out.neighbor.2.json | head -n 1 | grep -q "neighbor"; then
+   echo "Incorrect per-level backends in ${TNAME}.out.neighbor.2.json" >&2
+fi
+
+#=============================================================================
+# IJ: node-aware halo exchanges should not change the solve
+#=============================================================================
+
+tail -2 ${TNAME}.out.nodeaware.0 > ${TNAME}.nodeaware_testdata
+tail -2 ${TNAME}.out.nodeaware.1 > ${TNAME}.nodeaware_testdata.temp
+diff ${TNAME}.nodeaware_testdata ${TNAME}.nodeaware_testdata.temp >&2
+tail -2 ${TNAME}.out.nodeaware.2 > ${TNAME}.nodeaware_testdata.temp
+diff ${TNAME}.nodeaware_testdata ${TNAME}.nodeaware_testdata.temp >&2
+
+#=============================================================================
+# IJ: level-scheduled ILU triangular solves should not change the solve
+#=============================================================================
+
+tail -3 ${TNAME}.out.303 > ${TNAME}.ilutri_testdata
+tail -3 ${TNAME}.out.ilutri.0 > ${TNAME}.ilutri_testdata.temp
+diff ${TNAME}.ilutri_testdata ${TNAME}.ilutri_testdata.temp >&2
+tail -3 ${TNAME}.out.309 > ${TNAME}.ilutri_testdata
+tail -3 ${TNAME}.out.ilutri.1 > ${TNAME}.ilutri_testdata.temp
+diff ${TNAME}.ilutri_testdata ${TNAME}.ilutri_testdata.temp >&2
+tail -3 ${TNAME}.out.313 > ${TNAME}.ilutri_testdata
+tail -3 ${TNAME}.out.ilutri.2 > ${TNAME}.ilutri_testdata.temp
+diff ${TNAME}.ilutri_testdata ${TNAME}.ilutri_testdata.temp >&2
+
+#=============================================================================
+# IJ: the ILU benchmark should not change the solve
+#=============================================================================
+
+grep "Iterations\|Residual Norm" ${TNAME}.out.iluiter.1 > ${TNAME}.iluiter_testdata
+grep "Iterations\|Residual Norm" ${TNAME}.out.iluiter.3 > ${TNAME}.iluiter_testdata.temp
+diff ${TNAME}.iluiter_testdata ${TNAME}.iluiter_testdata.temp >&2
+BENCH_COUNT=`grep "seconds per application" ${TNAME}.out.iluiter.3 | wc -l`
+if [ "$BENCH_COUNT" != "2" ]; then
+   echo "Incorrect number of ILU timings in ${TNAME}.out.iluiter.3" >&2
+fi
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -163,6 +328,23 @@ FILES="\
  ${TNAME}.out.322\
  ${TNAME}.out.323\
  ${TNAME}.out.324\
+ ${TNAME}.out.mrhs\
+ ${TNAME}.out.reuse.1\
+ ${TNAME}.out.reuse.2\
+ ${TNAME}.out.reuse.3\
+ ${TNAME}.out.spgemm\
+ ${TNAME}.out.bin.1\
+ ${TNAME}.out.bin.3\
+ ${TNAME}.out.redist.1\
+ ${TNAME}.out.redist.2\
+ ${TNAME}.out.redist.3\
+ ${TNAME}.out.iluiter.1\
+ ${TNAME}.out.iluiter.2\
+ ${TNAME}.out.parasails.1\
+ ${TNAME}.out.parasails.2\
+ ${TNAME}.out.parasails.3\
+ ${TNAME}.out.euclid.1\
+ ${TNAME}.out.euclid.2\
 "
 
 for i in $FILES
@@ -189,3 +371,17 @@ fi
 
 rm -f ${TNAME}.testdata*
 rm -r ${TNAME}.mgr_testdata*
+rm -f ${TNAME}.mvo_testdata*
+rm -f ${TNAME}.mixp_testdata*
+rm -f ${TNAME}.pcgp_testdata*
+rm -f ${TNAME}.sstep_testdata*
+rm -f ${TNAME}.profile_testdata*
+rm -f ${TNAME}.bin_testdata*
+rm -f ${TNAME}.arena_testdata*
+rm -f ${TNAME}.memstats_testdata*
+rm -f ${TNAME}.persistent_testdata*
+rm -f ${TNAME}.neighbor_testdata* ${TNAME}.out.neighbor.json ${TNAME}.out.neighbor.2.json
+rm -f ${TNAME}.nodeaware_testdata*
+rm -f ${TNAME}.ilutri_testdata*
+rm -f ${TNAME}.iluiter_testdata*
+rm -f IJ.out.A.bin IJ.out.b.bin
@@ -8,6 +8,30 @@ TNAME=`basename $0 .sh`
 RTOL=$1
 ATOL=$2
 
+#=============================================================================
+# reading the binary files should give the same solve as the writing run
+#=============================================================================
+
+tail -3 ${TNAME}.out.bin.0 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.bin.1 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+tail -3 ${TNAME}.out.bin.2 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.bin.3 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+#=============================================================================
+# threaded ParaSails should give the same solves
+#=============================================================================
+
+tail -3 ${TNAME}.out.6 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.21 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+tail -3 ${TNAME}.out.13 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.22 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -34,6 +58,8 @@ FILES="\
  ${TNAME}.out.18\
  ${TNAME}.out.19\
  ${TNAME}.out.20\
+ ${TNAME}.out.21\
+ ${TNAME}.out.22\
 "
 
 for i in $FILES
@@ -59,3 +85,4 @@ fi
 #=============================================================================
 
 # rm -f ${TNAME}.testdata*
+rm -f sstruct.out.*.bin.*
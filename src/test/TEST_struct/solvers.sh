@@ -8,6 +8,30 @@ TNAME=`basename $0 .sh`
 RTOL=$1
 ATOL=$2
 
+#=============================================================================
+# reading the binary files should give the same solve as the writing run
+#=============================================================================
+
+tail -3 ${TNAME}.out.bin.0 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.bin.1 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+tail -3 ${TNAME}.out.bin.2 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.bin.3 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+#=============================================================================
+# persistent requests and neighborhood collectives should not change the solve
+#=============================================================================
+
+tail -3 ${TNAME}.out.persistent.0 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.persistent.1 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+tail -3 ${TNAME}.out.neighbor.0 > ${TNAME}.testdata
+tail -3 ${TNAME}.out.neighbor.1 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -43,3 +67,4 @@ fi
 #=============================================================================
 
 # rm -f ${TNAME}.testdata*
+rm -f struct.out.*.bin.*
@@ -109,6 +109,7 @@ hypre_int main (hypre_int argc, char *argv[])
    HYPRE_Real rtol;
    HYPRE_Int rr;
    HYPRE_Int zero_cond;
+   HYPRE_Int concurrent;
    HYPRE_Int blockSize;
    HYPRE_Solver solver, precond;
 
@@ -149,6 +150,7 @@ hypre_int main (hypre_int argc, char *argv[])
    rtol = 0;
    rr = 0;
    zero_cond = 0;
+   concurrent = 0;
 
    /* Parse command line */
    {
@@ -267,6 +269,11 @@ hypre_int main (hypre_int argc, char *argv[])
             arg_index++;
             zero_cond = 1;
          }
+         else if ( strcmp(argv[arg_index], "-concurrent") == 0 )
+         {
+            arg_index++;
+            concurrent = 1;
+         }
          else if ( strcmp(argv[arg_index], "-help") == 0 )
          {
             print_usage = 1;
@@ -313,6 +320,7 @@ hypre_int main (hypre_int argc, char *argv[])
          hypre_printf("    -coord               : use coordinate vectors              \n");
          hypre_printf("    -h1                  : use block-diag Poisson solves       \n");
          hypre_printf("    -sing                : curl-curl only (singular) problem   \n");
+         hypre_printf("    -concurrent          : concurrent additive subspace solves \n");
          hypre_printf("\n");
          hypre_printf("  AME eigensolver options:                                     \n");
          hypre_printf("    -bsize<num>          : number of eigenvalues to compute    \n");
@@ -458,6 +466,7 @@ hypre_int main (hypre_int argc, char *argv[])
       HYPRE_AMSSetMaxIter(solver, maxit);
       HYPRE_AMSSetTol(solver, tol);
       HYPRE_AMSSetCycleType(solver, cycle_type);
+      HYPRE_AMSSetConcurrentSolve(solver, concurrent);
       HYPRE_AMSSetPrintLevel(solver, 1);
       HYPRE_AMSSetDiscreteGradient(solver, G);
 
@@ -563,6 +572,7 @@ hypre_int main (hypre_int argc, char *argv[])
          HYPRE_AMSSetMaxIter(precond, 1);
          HYPRE_AMSSetTol(precond, 0.0);
          HYPRE_AMSSetCycleType(precond, cycle_type);
+         HYPRE_AMSSetConcurrentSolve(precond, concurrent);
          HYPRE_AMSSetPrintLevel(precond, 0);
          HYPRE_AMSSetDiscreteGradient(precond, G);
 
@@ -674,6 +684,7 @@ hypre_int main (hypre_int argc, char *argv[])
       HYPRE_AMSSetMaxIter(precond, 1);
       HYPRE_AMSSetTol(precond, 0.0);
       HYPRE_AMSSetCycleType(precond, cycle_type);
+      HYPRE_AMSSetConcurrentSolve(precond, concurrent);
       HYPRE_AMSSetPrintLevel(precond, 0);
       HYPRE_AMSSetDiscreteGradient(precond, G);
 
@@ -97,6 +97,13 @@ main( hypre_int argc,
    HYPRE_Int           off_proc = 0;
    HYPRE_Int           chunk = 0;
    HYPRE_Int           omp_flag = 0;
+   HYPRE_Int           mv_overlap = 0;
+   HYPRE_Int           persistent_comm = 1;
+   HYPRE_Int           neighbor_comm = 0;
+   HYPRE_Int           halo_bench = 0;
+   HYPRE_Int           num_threads = 0;
+   HYPRE_Int           sell_chunk_size = 0;
+   HYPRE_Int           sell_sort_scope = 1;
    HYPRE_Int           build_matrix_type;
    HYPRE_Int           build_matrix_arg_index;
    HYPRE_Int           build_rhs_type;
@@ -113,6 +120,8 @@ main( hypre_int argc,
    HYPRE_Int           solver_id;
    HYPRE_Int           solver_type = 1;
    HYPRE_Int           recompute_res = 0;   /* What should be the default here? */
+   HYPRE_Int           pcg_pipelined = 0;
+   HYPRE_Int           gmres_sstep = 1;
    HYPRE_Int           ioutdat;
    HYPRE_Int           poutdat;
    HYPRE_Int           debug_flag;
@@ -222,6 +231,17 @@ main( hypre_int argc,
    HYPRE_Int      min_coarse_size = 0;
    /* redundant coarse grid solve */
    HYPRE_Int      seq_threshold = 0;
+   /* single precision storage of the hierarchy */
+   HYPRE_Int      mixed_prec_level = -1;
+   HYPRE_Int      num_rhs = 1;
+   HYPRE_Int      setup_reuse = 0;
+   HYPRE_Int      setup_arena = 0;
+   HYPRE_Int      node_aware_level = -1;
+   HYPRE_Int      neighbor_comm_level = -1;
+   HYPRE_Int      redist_threshold = 0;
+   HYPRE_Int      node_size = 0;
+   char          *amg_profile_file = NULL;
+   HYPRE_Int      mem_stats = 0;
    HYPRE_Int      redundant = 0;
    /* additive versions */
    HYPRE_Int    additive = -1;
@@ -252,6 +272,7 @@ main( hypre_int argc,
 
    HYPRE_Int  cheby_order = 2;
    HYPRE_Int  cheby_eig_est = 10;
+   HYPRE_Int  cheby_eig_reuse = 0;
    HYPRE_Int  cheby_variant = 0;
    HYPRE_Int  cheby_scale = 1;
    HYPRE_Real cheby_fraction = .3;
@@ -267,6 +288,7 @@ main( hypre_int argc,
    /* parameters for ParaSAILS */
    HYPRE_Real   sai_threshold = 0.1;
    HYPRE_Real   sai_filter = 0.1;
+   HYPRE_Real   sai_loadbal = 0.0;
 
    /* parameters for PILUT */
    HYPRE_Real   drop_tol = -1;
@@ -303,6 +325,7 @@ main( hypre_int argc,
    HYPRE_Real   agg_P12_trunc_factor  = 0; /* default value */
 
    HYPRE_Int    print_system = 0;
+   HYPRE_Int    print_binary = 0;
    HYPRE_Int    rel_change = 0;
 
    /* begin lobpcg */
@@ -379,6 +402,11 @@ main( hypre_int argc,
    HYPRE_Int ilu_max_row_nnz = 1000;
    HYPRE_Int ilu_schur_max_iter = 3;
    HYPRE_Real ilu_nsh_droptol = 1.0e-02;
+   HYPRE_Int ilu_tri_solve = 0;
+   HYPRE_Int ilu_lower_jacobi_iters = 5;
+   HYPRE_Int ilu_upper_jacobi_iters = 5;
+   HYPRE_Int ilu_iter_setup = 0;
+   HYPRE_Int ilu_bench = 0;
    /* end hypre ILU options */
 
    HYPRE_Real     *nongalerk_tol = NULL;
@@ -457,6 +485,12 @@ main( hypre_int argc,
          build_matrix_type      = -1;
          build_matrix_arg_index = arg_index;
       }
+      else if ( strcmp(argv[arg_index], "-frombinfile") == 0 )
+      {
+         arg_index++;
+         build_matrix_type      = -2;
+         build_matrix_arg_index = arg_index;
+      }
       else if ( strcmp(argv[arg_index], "-fromparcsrfile") == 0 )
       {
          arg_index++;
@@ -552,6 +586,37 @@ main( hypre_int argc,
          arg_index++;
          omp_flag = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-mv_overlap") == 0 )
+      {
+         arg_index++;
+         mv_overlap = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-persistent") == 0 )
+      {
+         arg_index++;
+         persistent_comm = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-neighbor_comm") == 0 )
+      {
+         arg_index++;
+         neighbor_comm = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-halo_bench") == 0 )
+      {
+         arg_index++;
+         halo_bench = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-nthreads") == 0 )
+      {
+         arg_index++;
+         num_threads = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-sell") == 0 )
+      {
+         arg_index++;
+         sell_chunk_size = atoi(argv[arg_index++]);
+         sell_sort_scope = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-check_constant") == 0 )
       {
          arg_index++;
@@ -594,6 +659,12 @@ main( hypre_int argc,
          build_rhs_type      = 1;
          build_rhs_arg_index = arg_index;
       }
+      else if ( strcmp(argv[arg_index], "-rhsbinfile") == 0 )
+      {
+         arg_index++;
+         build_rhs_type      = 8;
+         build_rhs_arg_index = arg_index;
+      }
       else if ( strcmp(argv[arg_index], "-rhsparcsrfile") == 0 )
       {
          arg_index++;
@@ -1081,6 +1152,31 @@ main( hypre_int argc,
          arg_index++;
          ilu_nsh_droptol = atof(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-ilu_tri_solve") == 0 )
+      {
+         arg_index++;
+         ilu_tri_solve = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-ilu_lower_jacobi_iters") == 0 )
+      {
+         arg_index++;
+         ilu_lower_jacobi_iters = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-ilu_upper_jacobi_iters") == 0 )
+      {
+         arg_index++;
+         ilu_upper_jacobi_iters = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-ilu_iter_setup") == 0 )
+      {
+         arg_index++;
+         ilu_iter_setup = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-ilu_bench") == 0 )
+      {
+         arg_index++;
+         ilu_bench = atoi(argv[arg_index++]);
+      }
       /* end ilu options */
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
       else if ( strcmp(argv[arg_index], "-exec_host") == 0 )
@@ -1153,7 +1249,7 @@ main( hypre_int argc,
 
    /* end lobpcg */
 
-   if (solver_id == 8 || solver_id == 18)
+   if (solver_id == 8 || solver_id == 18 || solver_id == 19)
    {
       max_levels = 1;
    }
@@ -1279,6 +1375,56 @@ main( hypre_int argc,
          arg_index++;
          seq_threshold  = atof(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-mixed_prec") == 0 )
+      {
+         arg_index++;
+         mixed_prec_level  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-mrhs") == 0 )
+      {
+         arg_index++;
+         num_rhs  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-setup_reuse") == 0 )
+      {
+         arg_index++;
+         setup_reuse  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-amg_arena") == 0 )
+      {
+         arg_index++;
+         setup_arena  = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-node_aware") == 0 )
+      {
+         arg_index++;
+         node_aware_level  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-neighbor_level") == 0 )
+      {
+         arg_index++;
+         neighbor_comm_level  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-redist") == 0 )
+      {
+         arg_index++;
+         redist_threshold  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-node_size") == 0 )
+      {
+         arg_index++;
+         node_size  = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-amg_profile") == 0 )
+      {
+         arg_index++;
+         amg_profile_file = argv[arg_index++];
+      }
+      else if ( strcmp(argv[arg_index], "-mem_stats") == 0 )
+      {
+         arg_index++;
+         mem_stats = 1;
+      }
       else if ( strcmp(argv[arg_index], "-red") == 0 )
       {
          arg_index++;
@@ -1339,6 +1485,11 @@ main( hypre_int argc,
          arg_index++;
          sai_filter  = atof(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-sai_loadbal") == 0 )
+      {
+         arg_index++;
+         sai_loadbal  = atof(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-drop_tol") == 0 )
       {
          arg_index++;
@@ -1429,6 +1580,16 @@ main( hypre_int argc,
          arg_index++;
          recompute_res = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-pipelined") == 0 )
+      {
+         arg_index++;
+         pcg_pipelined = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-sstep") == 0 )
+      {
+         arg_index++;
+         gmres_sstep = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-iout") == 0 )
       {
          arg_index++;
@@ -1542,6 +1703,11 @@ main( hypre_int argc,
          arg_index++;
          cheby_eig_est = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-cheby_eig_reuse") == 0 )
+      {
+         arg_index++;
+         cheby_eig_reuse = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-cheby_variant") == 0 )
       {
          arg_index++;
@@ -1634,6 +1800,11 @@ main( hypre_int argc,
          arg_index++;
          print_system = 1;
       }
+      else if ( strcmp(argv[arg_index], "-print_bin") == 0 )
+      {
+         arg_index++;
+         print_binary = 1;
+      }
       /* BM Oct 23, 2006 */
       else if ( strcmp(argv[arg_index], "-plot_grids") == 0 )
       {
@@ -1716,6 +1887,8 @@ main( hypre_int argc,
          hypre_printf("matrix read from multiple files (ParCSR format)\n");
          hypre_printf("  -fromonecsrfile <filename> : ");
          hypre_printf("matrix read from a single file (CSR format)\n");
+         hypre_printf("  -frombinfile <filename>    : ");
+         hypre_printf("matrix read from a single file (binary format)\n");
          hypre_printf("\n");
          hypre_printf("  -laplacian [<options>] : build 5pt 2D laplacian problem (default) \n");
          hypre_printf("  -sysL <num functions>  : build SYSTEMS laplacian 7pt operator\n");
@@ -1740,6 +1913,8 @@ main( hypre_int argc,
          hypre_printf("rhs read from a single file (CSR format)\n");
          hypre_printf("  -rhsparcsrfile        :  ");
          hypre_printf("rhs read from multiple files (ParCSR format)\n");
+         hypre_printf("  -rhsbinfile            : ");
+         hypre_printf("rhs read from a single file (binary format)\n");
          hypre_printf("  -Ffromonefile          : ");
          hypre_printf("list of F points from a single file\n");
          hypre_printf("  -SFfromonefile          : ");
@@ -1775,7 +1950,7 @@ main( hypre_int argc,
          hypre_printf("       12=Schwarz-PCG     13=GSMG           \n");
          hypre_printf("       14=GSMG-PCG        15=GSMG-GMRES\n");
          hypre_printf("       16=AMG-COGMRES     17=DIAG-COGMRES\n");
-         hypre_printf("       18=ParaSails-GMRES\n");
+         hypre_printf("       18=ParaSails-GMRES 19=ParaSails-CGNR\n");
          hypre_printf("       20=Hybrid solver/ DiagScale, AMG \n");
          hypre_printf("       43=Euclid-PCG      44=Euclid-GMRES   \n");
          hypre_printf("       45=Euclid-BICGSTAB 46=Euclid-COGMRES\n");
@@ -1851,6 +2026,9 @@ main( hypre_int argc,
          hypre_printf("       16=Chebyshev  \n");
          hypre_printf("       17=FCF-Jacobi  \n");
          hypre_printf("       18=L1-Jacobi (may be used with -CF) \n");
+         hypre_printf("       40= forward multicolor L1-Gauss-Seidel  \n");
+         hypre_printf("       41= backward multicolor L1-Gauss-Seidel  \n");
+         hypre_printf("       42= symmetric multicolor L1-Gauss-Seidel  \n");
          hypre_printf("       9=Gauss elimination (use for coarsest grid only)  \n");
          hypre_printf("       99=Gauss elimination with pivoting (use for coarsest grid only)  \n");
          hypre_printf("       20= Nodal Weighted Jacobi (for systems only) \n");
@@ -1862,6 +2040,28 @@ main( hypre_int argc,
          hypre_printf("  -rlx_up      <val>       : set relaxation type for up cycle\n");
          hypre_printf("  -cheby_order  <val> : set order (1-4) for Chebyshev poly. smoother (default is 2)\n");
          hypre_printf("  -cheby_fraction <val> : fraction of the spectrum for Chebyshev poly. smoother (default is .3)\n");
+         hypre_printf("  -cheby_variant <val> : Chebyshev poly. (0: standard, 1: modified, 2: fourth kind,\n");
+         hypre_printf("                         3: fourth kind with optimized weights)\n");
+         hypre_printf("  -cheby_eig_reuse <val> : keep Chebyshev eigenvalue estimates for val re-setups\n");
+         hypre_printf("  -mixed_prec <val>        : store P, and A if only used in matvecs, in single\n");
+         hypre_printf("                             precision on levels >= val (default -1, none)\n");
+         hypre_printf("  -mrhs <val>              : after the AMG solve (solver 0), solve for val\n");
+         hypre_printf("                             random right-hand sides at once\n");
+         hypre_printf("  -setup_reuse <val>       : numeric-only re-setup (1: recompute P, 2: keep P);\n");
+         hypre_printf("                             solver 0 repeats setup and solve after\n");
+         hypre_printf("                             scaling the diagonal of A by 1.1\n");
+         hypre_printf("  -amg_arena               : interpolation work arrays from a per-level arena\n");
+         hypre_printf("  -node_aware <val>        : node-aware halo exchanges on levels >= val\n");
+         hypre_printf("  -neighbor_level <val>    : neighborhood collectives on levels >= val,\n");
+         hypre_printf("                             point-to-point messages below\n");
+         hypre_printf("  -redist <val>            : gather coarse levels below val rows per proc\n");
+         hypre_printf("                             (solvers 0 and 1, default -1, none)\n");
+         hypre_printf("  -node_size <val>         : node-aware exchanges group val consecutive\n");
+         hypre_printf("                             ranks into a node (default 0, shared memory)\n");
+         hypre_printf("  -amg_profile <file>      : write the per-level BoomerAMG profile of\n");
+         hypre_printf("                             solver 0 in JSON format to file\n");
+         hypre_printf("  -mem_stats               : print the live and peak memory per category\n");
+         hypre_printf("                             after setup and solve (solvers 0 and 1)\n");
          hypre_printf("  -nodal  <val>            : nodal system type\n");
          hypre_printf("       0 = Unknown approach \n");
          hypre_printf("       1 = Frobenius norm  \n");
@@ -1908,12 +2108,15 @@ main( hypre_int argc,
          hypre_printf("  -tol  <val>            : set solver convergence tolerance = val\n");
          hypre_printf("  -atol  <val>           : set solver absolute convergence tolerance = val\n");
          hypre_printf("  -max_iter  <val>       : set max iterations\n");
+         hypre_printf("  -pipelined             : use pipelined CG for the PCG solvers\n");
+         hypre_printf("  -sstep  <val>          : use s-step GMRES with block size val for the GMRES solvers\n");
          hypre_printf("  -mg_max_iter  <val>    : set max iterations for mg solvers\n");
          hypre_printf("  -agg_nl  <val>         : set number of aggressive coarsening levels (default:0)\n");
          hypre_printf("  -np  <val>             : set number of paths of length 2 for aggr. coarsening\n");
          hypre_printf("\n");
          hypre_printf("  -sai_th   <val>        : set ParaSAILS threshold = val \n");
          hypre_printf("  -sai_filt <val>        : set ParaSAILS filter = val \n");
+         hypre_printf("  -sai_loadbal <val>     : set ParaSAILS load balance = val \n");
          hypre_printf("\n");
          hypre_printf("  -level   <val>         : set k in ILU(k) for Euclid \n");
          hypre_printf("  -bj <val>              : enable block Jacobi ILU for Euclid \n");
@@ -1934,6 +2137,17 @@ main( hypre_int argc,
          hypre_printf("\n");
          hypre_printf("  -print                 : print out the system\n");
          hypre_printf("\n");
+         hypre_printf("  -mv_overlap <val>      : split-phase matvec, <val> diag rows between\n");
+         hypre_printf("                           polls of the halo exchange (0 = off)\n");
+         hypre_printf("  -persistent <val>      : persistent requests in the repeated halo\n");
+         hypre_printf("                           exchanges (1 = on, default; 0 = off)\n");
+         hypre_printf("  -neighbor_comm <val>   : halo exchanges with MPI neighborhood\n");
+         hypre_printf("                           collectives (1) or point-to-point (0, default)\n");
+         hypre_printf("  -halo_bench <val>      : time <val> halo exchanges of A with Isend/Irecv,\n");
+         hypre_printf("                           persistent requests and neighborhood collectives\n");
+         hypre_printf("  -nthreads <val>        : number of OpenMP threads (default: OMP_NUM_THREADS)\n");
+         hypre_printf("  -sell <C> <sigma>      : SELL-C-sigma format in the host matvec\n");
+         hypre_printf("\n");
          /* begin lobpcg */
 
          hypre_printf("LOBPCG options:\n");
@@ -2043,6 +2257,13 @@ main( hypre_int argc,
          hypre_printf("  -ilu_max_row_nnz   <val>         : set max. num of nonzeros to keep per row = val \n");
          hypre_printf("  -ilu_schur_max_iter   <val>      : set max. num of iteration for GMRES/NSH Schur = val \n");
          hypre_printf("  -ilu_nsh_droptol   <val>         : set drop tolerance threshold for NSH = val \n");
+         hypre_printf("  -ilu_tri_solve   <val>           : 0 = sequential, 1 = level-scheduled, 2 = Jacobi iteration triangular solves \n");
+         hypre_printf("  -ilu_lower_jacobi_iters   <val>  : set num of Jacobi iterations for the L solve = val \n");
+         hypre_printf("  -ilu_upper_jacobi_iters   <val>  : set num of Jacobi iterations for the U solve = val \n");
+         hypre_printf("  -ilu_iter_setup   <val>          : set num of sweeps of iterative ILU(k) setup = val (0 = exact) \n");
+         hypre_printf("  -ilu_bench   <val>               : time the setup and <val> applications of the exact ILU with\n");
+         hypre_printf("                                     sequential triangular solves and of the iterative ILU with\n");
+         hypre_printf("                                     Jacobi triangular solves (-ilu_iter_setup sweeps, default 3)\n");
          /* end ILU options */
       }
 
@@ -2077,6 +2298,22 @@ main( hypre_int argc,
                             mempool_max_bin, mempool_max_cached_bytes );
 
    hypre_HandleMemoryLocation(hypre_handle())    = memory_location;
+   HYPRE_SetPersistentComm(persistent_comm);
+   HYPRE_SetNeighborComm(neighbor_comm);
+   HYPRE_SetNodeAwareRanksPerNode(node_size);
+   if (num_threads > 0)
+   {
+      hypre_SetNumThreads(num_threads);
+   }
+   if (mv_overlap > 0)
+   {
+      HYPRE_ParCSRMatrixSetMatvecOverlap(1);
+      HYPRE_ParCSRMatrixSetMatvecOverlapChunkSize(mv_overlap);
+   }
+   if (mem_stats)
+   {
+      HYPRE_MemoryStatsSetEnabled(1);
+   }
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    hypre_HandleDefaultExecPolicy(hypre_handle()) = default_exec_policy;
    hypre_HandleSpgemmUseCusparse(hypre_handle()) = spgemm_use_cusparse;
@@ -2104,6 +2341,16 @@ main( hypre_int argc,
          exit(1);
       }
    }
+   else if ( build_matrix_type == -2 )
+   {
+      ierr = HYPRE_IJMatrixReadBinary( argv[build_matrix_arg_index], comm,
+                                       HYPRE_PARCSR, &ij_A );
+      if (ierr)
+      {
+         hypre_printf("ERROR: Problem reading in the system matrix!\n");
+         exit(1);
+      }
+   }
    else if ( build_matrix_type == 0 )
    {
       BuildParFromFile(argc, argv, build_matrix_arg_index, &parcsr_A);
@@ -2506,6 +2753,11 @@ main( hypre_int argc,
       parcsr_A = (HYPRE_ParCSRMatrix) object;
    }
 
+   if (sell_chunk_size > 0)
+   {
+      HYPRE_ParCSRMatrixSetSellCSigma(parcsr_A, sell_chunk_size, sell_sort_scope);
+   }
+
    /*-----------------------------------------------------------
     * Set up the interp vector
     *-----------------------------------------------------------*/
@@ -2567,7 +2819,7 @@ main( hypre_int argc,
    time_index = hypre_InitializeTiming("RHS and Initial Guess");
    hypre_BeginTiming(time_index);
 
-   if ( build_rhs_type == 0 )
+   if ( build_rhs_type == 0 || build_rhs_type == 8 )
    {
       if (myid == 0)
       {
@@ -2576,8 +2828,16 @@ main( hypre_int argc,
       }
 
       /* RHS */
-      ierr = HYPRE_IJVectorRead( argv[build_rhs_arg_index], hypre_MPI_COMM_WORLD,
-                                 HYPRE_PARCSR, &ij_b );
+      if (build_rhs_type == 8)
+      {
+         ierr = HYPRE_IJVectorReadBinary( argv[build_rhs_arg_index], hypre_MPI_COMM_WORLD,
+                                          HYPRE_PARCSR, &ij_b );
+      }
+      else
+      {
+         ierr = HYPRE_IJVectorRead( argv[build_rhs_arg_index], hypre_MPI_COMM_WORLD,
+                                    HYPRE_PARCSR, &ij_b );
+      }
       if (ierr)
       {
          hypre_printf("ERROR: Problem reading in the right-hand-side!\n");
@@ -3081,6 +3341,26 @@ main( hypre_int argc,
       HYPRE_IJVectorPrint(ij_x, "IJ.out.x0");
    }
 
+   if (print_binary)
+   {
+      if (ij_A)
+      {
+         HYPRE_IJMatrixPrintBinary(ij_A, "IJ.out.A.bin");
+      }
+      else if (parcsr_A)
+      {
+         hypre_ParCSRMatrixPrintBinary(parcsr_A, 0, 0, "IJ.out.A.bin");
+      }
+      if (ij_b)
+      {
+         HYPRE_IJVectorPrintBinary(ij_b, "IJ.out.b.bin");
+      }
+      else if (b)
+      {
+         hypre_ParVectorPrintBinary(b, 0, "IJ.out.b.bin");
+      }
+   }
+
    /*-----------------------------------------------------------
     * Migrate the system to the wanted memory space
     *-----------------------------------------------------------*/
@@ -3292,6 +3572,13 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetTol(amg_solver, tol);
       HYPRE_BoomerAMGSetStrongThreshold(amg_solver, strong_threshold);
       HYPRE_BoomerAMGSetSeqThreshold(amg_solver, seq_threshold);
+      HYPRE_BoomerAMGSetMixedPrecisionLevel(amg_solver, mixed_prec_level);
+      HYPRE_BoomerAMGSetSetupReuse(amg_solver, setup_reuse);
+      HYPRE_BoomerAMGSetSetupArena(amg_solver, setup_arena);
+      HYPRE_BoomerAMGSetNodeAwareLevel(amg_solver, node_aware_level);
+      HYPRE_BoomerAMGSetNeighborCommLevel(amg_solver, neighbor_comm_level);
+      HYPRE_BoomerAMGSetRedistributeThreshold(amg_solver, redist_threshold);
+      HYPRE_BoomerAMGSetProfile(amg_solver, amg_profile_file != NULL);
       HYPRE_BoomerAMGSetRedundant(amg_solver, redundant);
       HYPRE_BoomerAMGSetMaxCoarseSize(amg_solver, coarse_threshold);
       HYPRE_BoomerAMGSetMinCoarseSize(amg_solver, min_coarse_size);
@@ -3323,6 +3610,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetChebyOrder(amg_solver, cheby_order);
       HYPRE_BoomerAMGSetChebyFraction(amg_solver, cheby_fraction);
       HYPRE_BoomerAMGSetChebyEigEst(amg_solver, cheby_eig_est);
+      HYPRE_BoomerAMGSetChebyEigReuse(amg_solver, cheby_eig_reuse);
       HYPRE_BoomerAMGSetChebyVariant(amg_solver, cheby_variant);
       HYPRE_BoomerAMGSetChebyScale(amg_solver, cheby_scale);
       HYPRE_BoomerAMGSetRelaxOrder(amg_solver, relax_order);
@@ -3426,6 +3714,12 @@ main( hypre_int argc,
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
 
+      if (mem_stats)
+      {
+         HYPRE_MemoryStatsPrint(hypre_MPI_COMM_WORLD, "BoomerAMG Setup");
+         HYPRE_MemoryStatsResetPeak();
+      }
+
       time_index = hypre_InitializeTiming("BoomerAMG Solve");
       hypre_BeginTiming(time_index);
 
@@ -3452,6 +3746,11 @@ main( hypre_int argc,
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
 
+      if (mem_stats)
+      {
+         HYPRE_MemoryStatsPrint(hypre_MPI_COMM_WORLD, "BoomerAMG Solve");
+      }
+
       HYPRE_BoomerAMGGetNumIterations(amg_solver, &num_iterations);
       HYPRE_BoomerAMGGetFinalRelativeResidualNorm(amg_solver, &final_res_norm);
 
@@ -3463,6 +3762,92 @@ main( hypre_int argc,
          hypre_printf("\n");
       }
 
+      if (num_rhs > 1)
+      {
+         /* block solve with the same hierarchy */
+         hypre_ParVector *b_mv, *x_mv;
+
+         b_mv = hypre_ParMultiVectorCreate(hypre_MPI_COMM_WORLD,
+                                           hypre_ParCSRMatrixGlobalNumRows(parcsr_A),
+                                           hypre_ParCSRMatrixRowStarts(parcsr_A), num_rhs);
+         hypre_ParVectorSetPartitioningOwner(b_mv, 0);
+         hypre_ParVectorInitialize(b_mv);
+         hypre_ParVectorSetRandomValues(b_mv, 22775);
+
+         x_mv = hypre_ParMultiVectorCreate(hypre_MPI_COMM_WORLD,
+                                           hypre_ParCSRMatrixGlobalNumRows(parcsr_A),
+                                           hypre_ParCSRMatrixRowStarts(parcsr_A), num_rhs);
+         hypre_ParVectorSetPartitioningOwner(x_mv, 0);
+         hypre_ParVectorInitialize(x_mv);
+
+         time_index = hypre_InitializeTiming("BoomerAMG Multi-RHS Solve");
+         hypre_BeginTiming(time_index);
+
+         HYPRE_BoomerAMGSolve(amg_solver, parcsr_A, (HYPRE_ParVector) b_mv, (HYPRE_ParVector) x_mv);
+
+         hypre_EndTiming(time_index);
+         hypre_PrintTiming("Multi-RHS solve phase times", hypre_MPI_COMM_WORLD);
+         hypre_FinalizeTiming(time_index);
+         hypre_ClearTiming();
+
+         HYPRE_BoomerAMGGetNumIterations(amg_solver, &num_iterations);
+         HYPRE_BoomerAMGGetFinalRelativeResidualNorm(amg_solver, &final_res_norm);
+
+         if (myid == 0)
+         {
+            hypre_printf("\n");
+            hypre_printf("BoomerAMG Multi-RHS (%d) Iterations = %d\n", num_rhs, num_iterations);
+            hypre_printf("Final Max Relative Residual Norm = %e\n", final_res_norm);
+            hypre_printf("\n");
+         }
+
+         hypre_ParVectorDestroy(b_mv);
+         hypre_ParVectorDestroy(x_mv);
+      }
+
+      if (setup_reuse > 0)
+      {
+         /* same pattern, new coefficients: setup and solve again */
+         hypre_CSRMatrix *A_diag      = hypre_ParCSRMatrixDiag(parcsr_A);
+         HYPRE_Int       *A_diag_i    = hypre_CSRMatrixI(A_diag);
+         HYPRE_Complex   *A_diag_data = hypre_CSRMatrixData(A_diag);
+
+         for (i = 0; i < hypre_CSRMatrixNumRows(A_diag); i++)
+         {
+            A_diag_data[A_diag_i[i]] *= 1.1;
+         }
+         hypre_ParCSRMatrixValuesChanged(parcsr_A);
+         HYPRE_ParVectorSetConstantValues(x, 0.0);
+
+         time_index = hypre_InitializeTiming("BoomerAMG Re-setup");
+         hypre_BeginTiming(time_index);
+
+         HYPRE_BoomerAMGSetup(amg_solver, parcsr_A, b, x);
+
+         hypre_EndTiming(time_index);
+         hypre_PrintTiming("Re-setup phase times", hypre_MPI_COMM_WORLD);
+         hypre_FinalizeTiming(time_index);
+         hypre_ClearTiming();
+
+         HYPRE_BoomerAMGSolve(amg_solver, parcsr_A, b, x);
+
+         HYPRE_BoomerAMGGetNumIterations(amg_solver, &num_iterations);
+         HYPRE_BoomerAMGGetFinalRelativeResidualNorm(amg_solver, &final_res_norm);
+
+         if (myid == 0)
+         {
+            hypre_printf("\n");
+            hypre_printf("BoomerAMG Re-setup Iterations = %d\n", num_iterations);
+            hypre_printf("Final Relative Residual Norm = %e\n", final_res_norm);
+            hypre_printf("\n");
+         }
+      }
+
+      if (amg_profile_file)
+      {
+         HYPRE_BoomerAMGPrintProfile(amg_solver, amg_profile_file);
+      }
+
 #if SECOND_TIME
       /* run a second time to check for memory leaks */
       HYPRE_ParVectorSetRandomValues(x, 775);
@@ -3557,6 +3942,7 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetTol(amg_solver, tol);
       HYPRE_BoomerAMGSetStrongThreshold(amg_solver, strong_threshold);
       HYPRE_BoomerAMGSetSeqThreshold(amg_solver, seq_threshold);
+      HYPRE_BoomerAMGSetMixedPrecisionLevel(amg_solver, mixed_prec_level);
       HYPRE_BoomerAMGSetRedundant(amg_solver, redundant);
       HYPRE_BoomerAMGSetMaxCoarseSize(amg_solver, coarse_threshold);
       HYPRE_BoomerAMGSetMinCoarseSize(amg_solver, min_coarse_size);
@@ -3708,6 +4094,7 @@ main( hypre_int argc,
       HYPRE_PCGSetPrintLevel(pcg_solver, ioutdat);
       HYPRE_PCGSetAbsoluteTol(pcg_solver, atol);
       HYPRE_PCGSetRecomputeResidual(pcg_solver, recompute_res);
+      HYPRE_PCGSetPipelined(pcg_solver, pcg_pipelined);
 
       if (solver_id == 1)
       {
@@ -3728,6 +4115,10 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetIsolatedFPoints(pcg_precond, num_isolated_fpt, isolated_fpt_index);
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mixed_prec_level);
+         HYPRE_BoomerAMGSetNodeAwareLevel(pcg_precond, node_aware_level);
+         HYPRE_BoomerAMGSetNeighborCommLevel(pcg_precond, neighbor_comm_level);
+         HYPRE_BoomerAMGSetRedistributeThreshold(pcg_precond, redist_threshold);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
@@ -3846,6 +4237,7 @@ main( hypre_int argc,
          HYPRE_ParaSailsCreate(hypre_MPI_COMM_WORLD, &pcg_precond);
          HYPRE_ParaSailsSetParams(pcg_precond, sai_threshold, max_levels);
          HYPRE_ParaSailsSetFilter(pcg_precond, sai_filter);
+         HYPRE_ParaSailsSetLoadbal(pcg_precond, sai_loadbal);
          HYPRE_ParaSailsSetLogging(pcg_precond, poutdat);
 
          HYPRE_PCGSetPrecond(pcg_solver,
@@ -3895,6 +4287,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetIsolatedFPoints(pcg_precond, num_isolated_fpt, isolated_fpt_index);
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mixed_prec_level);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
@@ -4116,6 +4509,12 @@ main( hypre_int argc,
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
 
+      if (mem_stats)
+      {
+         HYPRE_MemoryStatsPrint(hypre_MPI_COMM_WORLD, "PCG Setup");
+         HYPRE_MemoryStatsResetPeak();
+      }
+
       time_index = hypre_InitializeTiming("PCG Solve");
       hypre_BeginTiming(time_index);
 
@@ -4127,6 +4526,11 @@ main( hypre_int argc,
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
 
+      if (mem_stats)
+      {
+         HYPRE_MemoryStatsPrint(hypre_MPI_COMM_WORLD, "PCG Solve");
+      }
+
       HYPRE_PCGGetNumIterations(pcg_solver, &num_iterations);
       HYPRE_PCGGetFinalRelativeResidualNorm(pcg_solver, &final_res_norm);
 
@@ -4427,6 +4831,7 @@ main( hypre_int argc,
             HYPRE_ParaSailsCreate(hypre_MPI_COMM_WORLD, &pcg_precond);
             HYPRE_ParaSailsSetParams(pcg_precond, sai_threshold, max_levels);
             HYPRE_ParaSailsSetFilter(pcg_precond, sai_filter);
+            HYPRE_ParaSailsSetLoadbal(pcg_precond, sai_loadbal);
             HYPRE_ParaSailsSetLogging(pcg_precond, poutdat);
 
             HYPRE_PCGSetPrecond(pcg_solver,
@@ -4813,6 +5218,7 @@ main( hypre_int argc,
             HYPRE_ParaSailsCreate(hypre_MPI_COMM_WORLD, &pcg_precond);
             HYPRE_ParaSailsSetParams(pcg_precond, sai_threshold, max_levels);
             HYPRE_ParaSailsSetFilter(pcg_precond, sai_filter);
+            HYPRE_ParaSailsSetLoadbal(pcg_precond, sai_loadbal);
             HYPRE_ParaSailsSetLogging(pcg_precond, poutdat);
 
             HYPRE_LOBPCGSetPrecond(pcg_solver,
@@ -5121,6 +5527,7 @@ main( hypre_int argc,
       HYPRE_GMRESSetLogging(pcg_solver, 1);
       HYPRE_GMRESSetPrintLevel(pcg_solver, ioutdat);
       HYPRE_GMRESSetRelChange(pcg_solver, rel_change);
+      HYPRE_GMRESSetSStep(pcg_solver, gmres_sstep);
 
       if (solver_id == 3)
       {
@@ -5152,6 +5559,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mixed_prec_level);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
@@ -5316,6 +5724,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mixed_prec_level);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
@@ -5415,6 +5824,7 @@ main( hypre_int argc,
          HYPRE_ParaSailsCreate(hypre_MPI_COMM_WORLD, &pcg_precond);
          HYPRE_ParaSailsSetParams(pcg_precond, sai_threshold, max_levels);
          HYPRE_ParaSailsSetFilter(pcg_precond, sai_filter);
+         HYPRE_ParaSailsSetLoadbal(pcg_precond, sai_loadbal);
          HYPRE_ParaSailsSetLogging(pcg_precond, poutdat);
          HYPRE_ParaSailsSetSym(pcg_precond, 0);
 
@@ -5464,6 +5874,10 @@ main( hypre_int argc,
          HYPRE_ILUSetDropThreshold(pcg_precond,ilu_droptol);
          /* set max iterations for Schur system solve */
          HYPRE_ILUSetSchurMaxIter( pcg_precond, ilu_schur_max_iter );
+         HYPRE_ILUSetTriSolve( pcg_precond, ilu_tri_solve );
+         HYPRE_ILUSetLowerJacobiIters( pcg_precond, ilu_lower_jacobi_iters );
+         HYPRE_ILUSetUpperJacobiIters( pcg_precond, ilu_upper_jacobi_iters );
+         HYPRE_ILUSetIterativeSetupSweeps( pcg_precond, ilu_iter_setup );
          if(ilu_type == 20 || ilu_type == 21)
          {
             HYPRE_ILUSetNSHDropThreshold( pcg_precond, ilu_nsh_droptol);
@@ -5607,6 +6021,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mixed_prec_level);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
@@ -5793,6 +6208,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mixed_prec_level);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
@@ -6016,6 +6432,10 @@ main( hypre_int argc,
          HYPRE_ILUSetDropThreshold(pcg_precond,ilu_droptol);
          /* set max iterations for Schur system solve */
          HYPRE_ILUSetSchurMaxIter( pcg_precond, ilu_schur_max_iter );
+         HYPRE_ILUSetTriSolve( pcg_precond, ilu_tri_solve );
+         HYPRE_ILUSetLowerJacobiIters( pcg_precond, ilu_lower_jacobi_iters );
+         HYPRE_ILUSetUpperJacobiIters( pcg_precond, ilu_upper_jacobi_iters );
+         HYPRE_ILUSetIterativeSetupSweeps( pcg_precond, ilu_iter_setup );
          if(ilu_type == 20 || ilu_type == 21)
          {
             HYPRE_ILUSetNSHDropThreshold( pcg_precond, ilu_nsh_droptol);
@@ -6160,6 +6580,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mixed_prec_level);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
@@ -6509,6 +6930,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mixed_prec_level);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
@@ -6796,7 +7218,7 @@ main( hypre_int argc,
     * Solve the system using CGNR
     *-----------------------------------------------------------*/
 
-   if (solver_id == 5 || solver_id == 6)
+   if (solver_id == 5 || solver_id == 6 || solver_id == 19)
    {
       time_index = hypre_InitializeTiming("CGNR Setup");
       hypre_BeginTiming(time_index);
@@ -6824,6 +7246,7 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mixed_prec_level);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
@@ -6916,6 +7339,24 @@ main( hypre_int argc,
                               (HYPRE_PtrToSolverFcn) HYPRE_ParCSRDiagScaleSetup,
                               pcg_precond);
       }
+      else if (solver_id == 19)
+      {
+         /* use ParaSails preconditioner, transposed on the A^T solves */
+         if (myid == 0) hypre_printf("Solver: ParaSails-CGNR\n");
+
+         HYPRE_ParaSailsCreate(hypre_MPI_COMM_WORLD, &pcg_precond);
+         HYPRE_ParaSailsSetParams(pcg_precond, sai_threshold, max_levels);
+         HYPRE_ParaSailsSetFilter(pcg_precond, sai_filter);
+         HYPRE_ParaSailsSetLoadbal(pcg_precond, sai_loadbal);
+         HYPRE_ParaSailsSetLogging(pcg_precond, poutdat);
+         HYPRE_ParaSailsSetSym(pcg_precond, 0);
+
+         HYPRE_CGNRSetPrecond(pcg_solver,
+                              (HYPRE_PtrToSolverFcn) HYPRE_ParaSailsSolve,
+                              (HYPRE_PtrToSolverFcn) HYPRE_ParaSailsSolveT,
+                              (HYPRE_PtrToSolverFcn) HYPRE_ParaSailsSetup,
+                              pcg_precond);
+      }
 
       HYPRE_CGNRGetPrecond(pcg_solver, &pcg_precond_gotten);
       if (pcg_precond_gotten != pcg_precond)
@@ -6963,6 +7404,10 @@ main( hypre_int argc,
       {
          HYPRE_BoomerAMGDestroy(pcg_precond);
       }
+      else if (solver_id == 19)
+      {
+         HYPRE_ParaSailsDestroy(pcg_precond);
+      }
       if (myid == 0 /* begin lobpcg */ && !lobpcgFlag /* end lobpcg */)
       {
          hypre_printf("\n");
@@ -7158,6 +7603,10 @@ main( hypre_int argc,
       HYPRE_ILUSetTol(ilu_solver, tol);
       /* set max iterations for Schur system solve */
       HYPRE_ILUSetSchurMaxIter( ilu_solver, ilu_schur_max_iter );
+      HYPRE_ILUSetTriSolve( ilu_solver, ilu_tri_solve );
+      HYPRE_ILUSetLowerJacobiIters( ilu_solver, ilu_lower_jacobi_iters );
+      HYPRE_ILUSetUpperJacobiIters( ilu_solver, ilu_upper_jacobi_iters );
+      HYPRE_ILUSetIterativeSetupSweeps( ilu_solver, ilu_iter_setup );
 
       /* setting for NSH */
       if(ilu_type == 20 || ilu_type == 21)
@@ -7216,6 +7665,146 @@ main( hypre_int argc,
       HYPRE_IJVectorPrint(ij_x, "IJ.out.x");
    }
 
+   if (halo_bench > 0)
+   {
+      hypre_ParCSRCommPkg    *bench_comm_pkg;
+      hypre_ParCSRCommHandle *bench_comm_handle;
+      HYPRE_Complex          *bench_send_data, *bench_recv_data;
+      HYPRE_Real              bench_time[3], bench_max_time[3];
+      HYPRE_Int               bench_num_send, bench_num_recv, bench_neighbor, k, m;
+
+      if (!hypre_ParCSRMatrixCommPkg(parcsr_A))
+      {
+         hypre_MatvecCommPkgCreate(parcsr_A);
+      }
+      bench_comm_pkg = hypre_ParCSRMatrixCommPkg(parcsr_A);
+      bench_num_send = hypre_ParCSRCommPkgSendMapStart(bench_comm_pkg,
+                                                      hypre_ParCSRCommPkgNumSends(bench_comm_pkg));
+      bench_num_recv = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(parcsr_A));
+      bench_send_data = hypre_CTAlloc(HYPRE_Complex, bench_num_send, HYPRE_MEMORY_HOST);
+      bench_recv_data = hypre_CTAlloc(HYPRE_Complex, bench_num_recv, HYPRE_MEMORY_HOST);
+
+      /* m = 0: MPI_Isend/Irecv, m = 1: persistent requests, m = 2: neighborhood collectives */
+      bench_neighbor = hypre_ParCSRCommPkgUseNeighborComm(bench_comm_pkg);
+      for (m = 0; m < 3; m++)
+      {
+         HYPRE_SetPersistentComm(m == 1);
+         hypre_ParCSRCommPkgSetNeighborComm(bench_comm_pkg, m == 2);
+         /* warm-up exchange, creates the persistent requests */
+         bench_comm_handle = hypre_ParCSRCommHandleCreate(1, bench_comm_pkg,
+                                                          bench_send_data, bench_recv_data);
+         hypre_ParCSRCommHandleDestroy(bench_comm_handle);
+
+         hypre_MPI_Barrier(hypre_MPI_COMM_WORLD);
+         bench_time[m] = hypre_MPI_Wtime();
+         for (k = 0; k < halo_bench; k++)
+         {
+            bench_comm_handle = hypre_ParCSRCommHandleCreate(1, bench_comm_pkg,
+                                                             bench_send_data, bench_recv_data);
+            hypre_ParCSRCommHandleDestroy(bench_comm_handle);
+         }
+         bench_time[m] = (hypre_MPI_Wtime() - bench_time[m]) / halo_bench;
+      }
+      HYPRE_SetPersistentComm(persistent_comm);
+      hypre_ParCSRCommPkgSetNeighborComm(bench_comm_pkg, bench_neighbor);
+
+      hypre_MPI_Allreduce(bench_time, bench_max_time, 3, HYPRE_MPI_REAL, hypre_MPI_MAX,
+                          hypre_MPI_COMM_WORLD);
+      if (myid == 0)
+      {
+         hypre_printf("\nHalo exchange of A (%d exchanges, max over ranks):\n", halo_bench);
+         hypre_printf("  Isend/Irecv         = %e seconds per exchange\n", bench_max_time[0]);
+         hypre_printf("  persistent requests = %e seconds per exchange\n", bench_max_time[1]);
+         hypre_printf("  neighbor collective = %e seconds per exchange\n", bench_max_time[2]);
+      }
+
+      hypre_TFree(bench_send_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(bench_recv_data, HYPRE_MEMORY_HOST);
+   }
+
+   if (ilu_bench > 0)
+   {
+      HYPRE_Solver     bench_ilu;
+      hypre_ParVector *bench_x, *bench_r;
+      HYPRE_Real       bench_time[4], bench_max_time[4], bench_res[2], bench_b_norm;
+      HYPRE_Int        k, m;
+
+      bench_x = hypre_ParVectorCloneDeep_v2(b, hypre_ParVectorMemoryLocation(b));
+      bench_r = hypre_ParVectorCloneDeep_v2(b, hypre_ParVectorMemoryLocation(b));
+      HYPRE_ParVectorInnerProd(b, b, &bench_b_norm);
+      bench_b_norm = sqrt(bench_b_norm);
+
+      /* m = 0: exact factorization and substitutions,
+       * m = 1: iterative factorization and Jacobi triangular solves */
+      for (m = 0; m < 2; m++)
+      {
+         HYPRE_ILUCreate(&bench_ilu);
+         HYPRE_ILUSetType(bench_ilu, ilu_type);
+         HYPRE_ILUSetLevelOfFill(bench_ilu, ilu_lfil);
+         HYPRE_ILUSetMaxIter(bench_ilu, 1);
+         HYPRE_ILUSetTol(bench_ilu, 0.0);
+         HYPRE_ILUSetTriSolve(bench_ilu, m == 1 ? 2 : 0);
+         HYPRE_ILUSetLowerJacobiIters(bench_ilu, ilu_lower_jacobi_iters);
+         HYPRE_ILUSetUpperJacobiIters(bench_ilu, ilu_upper_jacobi_iters);
+         HYPRE_ILUSetIterativeSetupSweeps(bench_ilu, m == 1 ? (ilu_iter_setup > 0 ? ilu_iter_setup : 3) : 0);
+
+         hypre_MPI_Barrier(hypre_MPI_COMM_WORLD);
+         bench_time[2 * m] = hypre_MPI_Wtime();
+         HYPRE_ILUSetup(bench_ilu, parcsr_A, b, bench_x);
+         bench_time[2 * m] = hypre_MPI_Wtime() - bench_time[2 * m];
+
+         /* quality of one application: || b - A M^{-1} b || / || b || */
+         hypre_ParVectorSetConstantValues(bench_x, 0.0);
+         HYPRE_ILUSolve(bench_ilu, parcsr_A, b, bench_x);
+         hypre_ParVectorCopy(b, bench_r);
+         HYPRE_ParCSRMatrixMatvec(-1.0, parcsr_A, bench_x, 1.0, bench_r);
+         HYPRE_ParVectorInnerProd(bench_r, bench_r, &bench_res[m]);
+         bench_res[m] = bench_b_norm > 0.0 ? sqrt(bench_res[m]) / bench_b_norm : 0.0;
+
+         hypre_MPI_Barrier(hypre_MPI_COMM_WORLD);
+         bench_time[2 * m + 1] = hypre_MPI_Wtime();
+         for (k = 0; k < ilu_bench; k++)
+         {
+            hypre_ParVectorSetConstantValues(bench_x, 0.0);
+            HYPRE_ILUSolve(bench_ilu, parcsr_A, b, bench_x);
+         }
+         bench_time[2 * m + 1] = (hypre_MPI_Wtime() - bench_time[2 * m + 1]) / ilu_bench;
+
+         HYPRE_ILUDestroy(bench_ilu);
+      }
+
+      hypre_MPI_Allreduce(bench_time, bench_max_time, 4, HYPRE_MPI_REAL, hypre_MPI_MAX,
+                          hypre_MPI_COMM_WORLD);
+      if (myid == 0)
+      {
+         hypre_printf("\nILU of A (%d applications, max over ranks):\n", ilu_bench);
+         hypre_printf("  exact ILU, substitutions = %e seconds setup, %e seconds per application,"
+                      " residual %e\n", bench_max_time[0], bench_max_time[1], bench_res[0]);
+         hypre_printf("  iterative ILU, Jacobi    = %e seconds setup, %e seconds per application,"
+                      " residual %e\n", bench_max_time[2], bench_max_time[3], bench_res[1]);
+      }
+
+      hypre_ParVectorDestroy(bench_x);
+      hypre_ParVectorDestroy(bench_r);
+   }
+
+   if (mv_overlap > 0)
+   {
+      HYPRE_Int  mv_num_calls;
+      HYPRE_Real mv_hidden_time, mv_exposed_time;
+
+      HYPRE_ParCSRMatrixGetMatvecCommTimes(parcsr_A, &mv_num_calls, &mv_hidden_time,
+                                           &mv_exposed_time);
+      if (myid == 0 && mv_num_calls > 0)
+      {
+         hypre_printf("\nSplit-phase matvec with A (rank 0): %d calls\n", mv_num_calls);
+         hypre_printf("  hidden  halo exchange time = %e (%e per call)\n",
+                      mv_hidden_time, mv_hidden_time / mv_num_calls);
+         hypre_printf("  exposed halo exchange time = %e (%e per call)\n",
+                      mv_exposed_time, mv_exposed_time / mv_num_calls);
+      }
+   }
+
    /*-----------------------------------------------------------
     * Finalize things
     *-----------------------------------------------------------*/
@@ -7224,7 +7813,7 @@ main( hypre_int argc,
 
    HYPRE_ParVectorDestroy(x0_save);
 
-   if (test_ij || build_matrix_type == -1)
+   if (test_ij || build_matrix_type < 0)
    {
       HYPRE_IJMatrixDestroy(ij_A);
    }
@@ -0,0 +1,297 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/*--------------------------------------------------------------------------
+ * Benchmark driver for the accumulators of the host sparse matrix-matrix
+ * product.  Builds a Laplacian A and an AMG interpolation P, then times
+ * A*P and P^T*(A*P) with each accumulator and compares the products with
+ * those of the dense accumulator.  Finally changes the values of A and P
+ * and checks the products recomputed in place with SpGEMM plans (see
+ * hypre_ParCSRMatMatPlanCreate) against new products.
+ * Do `ij_spgemm -help' for usage info.
+ *--------------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "_hypre_utilities.h"
+#include "HYPRE.h"
+#include "HYPRE_parcsr_mv.h"
+#include "HYPRE_parcsr_ls.h"
+#include "_hypre_parcsr_ls.h"
+#include "_hypre_parcsr_mv.h"
+
+static HYPRE_Real
+RelativeError( hypre_ParCSRMatrix *A,
+               hypre_ParCSRMatrix *B )
+{
+   hypre_ParCSRMatrix *E = NULL;
+   HYPRE_Real          fnorm, fnorm0;
+
+   hypre_ParcsrAdd(1.0, A, -1.0, B, &E);
+   fnorm  = hypre_ParCSRMatrixFnorm(E);
+   fnorm0 = hypre_ParCSRMatrixFnorm(A);
+   hypre_ParCSRMatrixDestroy(E);
+
+   return fnorm0 > 0 ? fnorm / fnorm0 : fnorm;
+}
+
+hypre_int
+main( hypre_int argc,
+      char *argv[] )
+{
+   HYPRE_Int           arg_index;
+   HYPRE_Int           print_usage = 0;
+   HYPRE_Int           num_procs, myid;
+   MPI_Comm            comm = hypre_MPI_COMM_WORLD;
+
+   HYPRE_BigInt        nx = 32, ny = 32, nz = 32;
+   HYPRE_Int           P, Q, R, p, q, r;
+   HYPRE_Int           stencil = 7;
+   HYPRE_Int           reps = 5;
+   HYPRE_Int           alg_first = 0, alg_last = 3;
+   HYPRE_Real         *values;
+
+   hypre_ParCSRMatrix *A = NULL, *S = NULL, *Pm = NULL;
+   hypre_ParCSRMatrix *AP_ref = NULL, *RAP_ref = NULL, *AP = NULL, *RAP = NULL;
+   hypre_ParCSRMatMatPlan *AP_plan = NULL, *RAP_plan = NULL;
+   hypre_CSRMatrix    *M[4];
+   HYPRE_Int           i, j, k;
+   HYPRE_Int          *CF_marker = NULL;
+   HYPRE_BigInt       *coarse_pnts_global = NULL;
+   HYPRE_Int          *coarse_dof_func = NULL;
+
+   const char         *alg_names[4] = {"per row", "dense", "hash", "ESC"};
+   HYPRE_Int           alg, rep;
+   HYPRE_Real          t0, t_AP, t_RAP, t;
+
+   /* Initialize MPI */
+   hypre_MPI_Init(&argc, &argv);
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &myid);
+
+   /* Initialize Hypre */
+   HYPRE_Init();
+
+   P = num_procs; Q = 1; R = 1;
+
+   /*-----------------------------------------------------------
+    * Parse command line
+    *-----------------------------------------------------------*/
+
+   arg_index = 1;
+   while ( (arg_index < argc) && (!print_usage) )
+   {
+      if ( strcmp(argv[arg_index], "-n") == 0 )
+      {
+         arg_index++;
+         nx = atoi(argv[arg_index++]);
+         ny = atoi(argv[arg_index++]);
+         nz = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-P") == 0 )
+      {
+         arg_index++;
+         P = atoi(argv[arg_index++]);
+         Q = atoi(argv[arg_index++]);
+         R = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-27pt") == 0 )
+      {
+         arg_index++;
+         stencil = 27;
+      }
+      else if ( strcmp(argv[arg_index], "-reps") == 0 )
+      {
+         arg_index++;
+         reps = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-alg") == 0 )
+      {
+         arg_index++;
+         alg_first = alg_last = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-help") == 0 )
+      {
+         print_usage = 1;
+      }
+      else
+      {
+         arg_index++;
+      }
+   }
+
+   if (P*Q*R != num_procs || reps < 1 || alg_first < 0 || alg_last > 3)
+   {
+      print_usage = 1;
+   }
+
+   if ( print_usage )
+   {
+      if ( myid == 0 )
+      {
+         hypre_printf("\n");
+         hypre_printf("Usage: %s [<options>]\n", argv[0]);
+         hypre_printf("\n");
+         hypre_printf("  -n <nx> <ny> <nz>    : problem size (default: 32 32 32)\n");
+         hypre_printf("  -P <Px> <Py> <Pz>    : processor topology (default: np 1 1)\n");
+         hypre_printf("  -27pt                : 27pt instead of 7pt Laplacian\n");
+         hypre_printf("  -reps <n>            : timed repetitions (default: 5)\n");
+         hypre_printf("  -alg <n>             : only this accumulator\n");
+         hypre_printf("       0=chosen per row  1=dense  2=hash  3=ESC\n");
+         hypre_printf("\n");
+      }
+      goto final;
+   }
+
+   /*-----------------------------------------------------------
+    * Build A and P
+    *-----------------------------------------------------------*/
+
+   p = myid % P;
+   q = (( myid - p)/P) % Q;
+   r = ( myid - p - P*q)/( P*Q );
+
+   values = hypre_CTAlloc(HYPRE_Real, 4, HYPRE_MEMORY_HOST);
+   if (stencil == 27)
+   {
+      values[0] = 26.0;
+      values[1] = -1.0;
+      A = (hypre_ParCSRMatrix *) GenerateLaplacian27pt(comm, nx, ny, nz, P, Q, R, p, q, r, values);
+   }
+   else
+   {
+      values[0] = 6.0;
+      values[1] = values[2] = values[3] = -1.0;
+      A = (hypre_ParCSRMatrix *) GenerateLaplacian(comm, nx, ny, nz, P, Q, R, p, q, r, values);
+   }
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+
+   hypre_BoomerAMGCreateS(A, 0.25, 1.0, 1, NULL, &S);
+   hypre_BoomerAMGCoarsenHMIS(S, A, 0, 0, 0, &CF_marker);
+   hypre_BoomerAMGCoarseParms(comm, hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A)), 1, NULL,
+                              CF_marker, &coarse_dof_func, &coarse_pnts_global);
+   hypre_BoomerAMGBuildExtPIInterp(A, CF_marker, S, coarse_pnts_global, 1, NULL, 0, 0.0, 4,
+                                   NULL, &Pm);
+
+   if (myid == 0)
+   {
+      hypre_printf("A %b x %b, P %b x %b, %d threads\n",
+                   hypre_ParCSRMatrixGlobalNumRows(A), hypre_ParCSRMatrixGlobalNumCols(A),
+                   hypre_ParCSRMatrixGlobalNumRows(Pm), hypre_ParCSRMatrixGlobalNumCols(Pm),
+                   hypre_NumThreads());
+   }
+
+   /* reference products */
+   HYPRE_CSRMatrixHostSpGemmSetAlgorithm(1);
+   AP_ref  = hypre_ParCSRMatMat(A, Pm);
+   RAP_ref = hypre_ParCSRTMatMat(Pm, AP_ref);
+
+   /*-----------------------------------------------------------
+    * Time the accumulators
+    *-----------------------------------------------------------*/
+
+   for (alg = alg_first; alg <= alg_last; alg++)
+   {
+      HYPRE_CSRMatrixHostSpGemmSetAlgorithm(alg);
+
+      t_AP = t_RAP = 0.0;
+      for (rep = 0; rep < reps; rep++)
+      {
+         hypre_ParCSRMatrixDestroy(AP);
+         hypre_ParCSRMatrixDestroy(RAP);
+
+         hypre_MPI_Barrier(comm);
+         t0 = hypre_MPI_Wtime();
+         AP = hypre_ParCSRMatMat(A, Pm);
+         t  = hypre_MPI_Wtime();
+         RAP = hypre_ParCSRTMatMat(Pm, AP);
+         t_RAP += hypre_MPI_Wtime() - t;
+         t_AP  += t - t0;
+      }
+      t_AP /= reps; t_RAP /= reps;
+      t = t_AP;
+      hypre_MPI_Allreduce(&t, &t_AP, 1, HYPRE_MPI_REAL, hypre_MPI_MAX, comm);
+      t = t_RAP;
+      hypre_MPI_Allreduce(&t, &t_RAP, 1, HYPRE_MPI_REAL, hypre_MPI_MAX, comm);
+
+      t = hypre_max(RelativeError(AP_ref, AP), RelativeError(RAP_ref, RAP));
+      if (myid == 0)
+      {
+         hypre_printf("%-8s: A*P %e s, P^T*(AP) %e s, err %e\n",
+                      alg_names[alg], t_AP, t_RAP, t);
+      }
+   }
+
+   /*-----------------------------------------------------------
+    * Recompute the products with plans after changing A and P
+    *-----------------------------------------------------------*/
+
+   hypre_ParCSRMatMatPlanCreate(A, Pm, AP, 0, &AP_plan);
+   hypre_ParCSRMatMatPlanCreate(Pm, AP, RAP, 1, &RAP_plan);
+
+   /* row-dependent scaling, so that the products change nonuniformly */
+   M[0] = hypre_ParCSRMatrixDiag(A);
+   M[1] = hypre_ParCSRMatrixOffd(A);
+   M[2] = hypre_ParCSRMatrixDiag(Pm);
+   M[3] = hypre_ParCSRMatrixOffd(Pm);
+   for (k = 0; k < 4; k++)
+   {
+      for (i = 0; i < hypre_CSRMatrixNumRows(M[k]); i++)
+      {
+         for (j = hypre_CSRMatrixI(M[k])[i]; j < hypre_CSRMatrixI(M[k])[i+1]; j++)
+         {
+            hypre_CSRMatrixData(M[k])[j] *= 1.0 + 0.1 * (HYPRE_Real) ((i + k) % 3);
+         }
+      }
+   }
+   hypre_ParCSRMatrixValuesChanged(A);
+   hypre_ParCSRMatrixValuesChanged(Pm);
+
+   hypre_ParCSRMatMatPlanExecute(AP_plan, A, Pm, AP);
+   hypre_ParCSRMatMatPlanExecute(RAP_plan, Pm, AP, RAP);
+
+   hypre_ParCSRMatrixDestroy(AP_ref);
+   hypre_ParCSRMatrixDestroy(RAP_ref);
+   AP_ref  = hypre_ParCSRMatMat(A, Pm);
+   RAP_ref = hypre_ParCSRTMatMat(Pm, AP_ref);
+
+   t = hypre_max(RelativeError(AP_ref, AP), RelativeError(RAP_ref, RAP));
+   if (myid == 0)
+   {
+      hypre_printf("\n");
+      hypre_printf("Products recomputed with plans: %s\n",
+                   hypre_error_flag == 0 && t < 1.0e-12 ? "match" : "differ");
+      hypre_printf("\n");
+   }
+
+   /*-----------------------------------------------------------
+    * Finalize things
+    *-----------------------------------------------------------*/
+
+   hypre_ParCSRMatMatPlanDestroy(AP_plan);
+   hypre_ParCSRMatMatPlanDestroy(RAP_plan);
+   hypre_ParCSRMatrixDestroy(AP);
+   hypre_ParCSRMatrixDestroy(RAP);
+   hypre_ParCSRMatrixDestroy(AP_ref);
+   hypre_ParCSRMatrixDestroy(RAP_ref);
+   hypre_ParCSRMatrixDestroy(Pm);
+   hypre_ParCSRMatrixDestroy(S);
+   hypre_ParCSRMatrixDestroy(A);
+   hypre_TFree(CF_marker, HYPRE_MEMORY_HOST);
+   hypre_TFree(coarse_dof_func, HYPRE_MEMORY_HOST);
+
+ final:
+
+   /* Finalize Hypre */
+   HYPRE_Finalize();
+
+   /* Finalize MPI */
+   hypre_MPI_Finalize();
+
+   return (0);
+}
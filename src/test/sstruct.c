@@ -2237,9 +2237,14 @@ PrintUsage( char *progname,
       hypre_printf("                        248- Struct BiCGSTAB with diagonal scaling\n");
       hypre_printf("                        249- Struct BiCGSTAB\n");
       hypre_printf("  -print             : print out the system\n");
+      hypre_printf("  -print_bin <c>     : write binary sstruct.out.A.bin, b.bin, x0.bin\n");
+      hypre_printf("                       (c = 1: run-length compressed)\n");
+      hypre_printf("  -read_bin          : read the values of A, b, x0 from the binary files\n");
+      hypre_printf("  -nthreads <n>      : number of OpenMP threads (default: OMP_NUM_THREADS)\n");
       hypre_printf("  -rhsfromcosine     : solution is cosine function (default)\n");
       hypre_printf("  -rhsone            : rhs is vector with unit components\n");
       hypre_printf("  -tol <val>         : convergence tolerance (default 1e-6)\n");
+      hypre_printf("  -sstep <s>         : s-step GMRES with block size s (default 1)\n");
       hypre_printf("  -solver_type <ID>  : Solver type for Hybrid\n");
       hypre_printf("                        1 - PCG (default)\n");
       hypre_printf("                        2 - GMRES\n");
@@ -2329,6 +2334,9 @@ main( hypre_int argc,
    Index                *block;
    HYPRE_Int             solver_id, object_type;
    HYPRE_Int             print_system;
+   HYPRE_Int             print_binary;
+   HYPRE_Int             read_binary;
+   HYPRE_Int             num_threads;
    HYPRE_Int             cosine;
    HYPRE_Real            scale;
 
@@ -2398,6 +2406,7 @@ main( hypre_int argc,
    HYPRE_Int pcgIterations = 0;
    HYPRE_Int pcgMode = 0;
    HYPRE_Real tol = 1e-6;
+   HYPRE_Int  gmres_sstep = 1;
    HYPRE_Real pcgTol = 1e-2;
    HYPRE_Real nonOrthF;
 
@@ -2515,6 +2524,9 @@ main( hypre_int argc,
 
    solver_id = 39;
    print_system = 0;
+   print_binary = -1;
+   read_binary = 0;
+   num_threads = 0;
    cosine = 1;
    if (global_data.rhs_true || global_data.fem_rhs_true)
    {
@@ -2606,6 +2618,21 @@ main( hypre_int argc,
          arg_index++;
          print_system = 1;
       }
+      else if ( strcmp(argv[arg_index], "-print_bin") == 0 )
+      {
+         arg_index++;
+         print_binary = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-read_bin") == 0 )
+      {
+         arg_index++;
+         read_binary = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-nthreads") == 0 )
+      {
+         arg_index++;
+         num_threads = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-rhsfromcosine") == 0 )
       {
          arg_index++;
@@ -2621,6 +2648,11 @@ main( hypre_int argc,
          arg_index++;
          tol = atof(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-sstep") == 0 )
+      {
+         arg_index++;
+         gmres_sstep = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-v") == 0 )
       {
          arg_index++;
@@ -2771,6 +2803,11 @@ main( hypre_int argc,
    DistributeData(global_data, pooldist, refine, distribute, block,
                   num_procs, myid, &data);
 
+   if (num_threads > 0)
+   {
+      hypre_SetNumThreads(num_threads);
+   }
+
    /*-----------------------------------------------------------
     * Check a few things
     *-----------------------------------------------------------*/
@@ -3551,6 +3588,17 @@ main( hypre_int argc,
       HYPRE_SStructMatrixAssemble(G);
    }
 
+   /*-----------------------------------------------------------
+    * Read in the values of the system and initial guess
+    *-----------------------------------------------------------*/
+
+   if (read_binary)
+   {
+      HYPRE_SStructMatrixReadBinaryValues("sstruct.out.A.bin",  A);
+      HYPRE_SStructVectorReadBinaryValues("sstruct.out.b.bin",  b);
+      HYPRE_SStructVectorReadBinaryValues("sstruct.out.x0.bin", x);
+   }
+
    /*-----------------------------------------------------------
     * Print out the system and initial guess
     *-----------------------------------------------------------*/
@@ -3569,6 +3617,13 @@ main( hypre_int argc,
       }
    }
 
+   if (print_binary >= 0)
+   {
+      HYPRE_SStructMatrixPrintBinary("sstruct.out.A.bin",  A, print_binary);
+      HYPRE_SStructVectorPrintBinary("sstruct.out.b.bin",  b, print_binary);
+      HYPRE_SStructVectorPrintBinary("sstruct.out.x0.bin", x, print_binary);
+   }
+
    /*-----------------------------------------------------------
     * Debugging code
     *-----------------------------------------------------------*/
@@ -4334,6 +4389,7 @@ main( hypre_int argc,
 
       HYPRE_SStructGMRESCreate(hypre_MPI_COMM_WORLD, &solver);
       HYPRE_GMRESSetKDim( (HYPRE_Solver) solver, 5 );
+      HYPRE_GMRESSetSStep( (HYPRE_Solver) solver, gmres_sstep );
       HYPRE_GMRESSetMaxIter( (HYPRE_Solver) solver, 100 );
       HYPRE_GMRESSetTol( (HYPRE_Solver) solver, tol );
       HYPRE_GMRESSetPrintLevel( (HYPRE_Solver) solver, 1 );
@@ -4410,6 +4466,7 @@ main( hypre_int argc,
 
       HYPRE_ParCSRGMRESCreate(hypre_MPI_COMM_WORLD, &par_solver);
       HYPRE_GMRESSetKDim(par_solver, 5);
+      HYPRE_GMRESSetSStep(par_solver, gmres_sstep);
       HYPRE_GMRESSetMaxIter(par_solver, 100);
       HYPRE_GMRESSetTol(par_solver, tol);
       HYPRE_GMRESSetPrintLevel(par_solver, 1);
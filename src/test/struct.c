@@ -137,6 +137,10 @@ main( hypre_int argc,
    HYPRE_Int           sum;
 
    HYPRE_Int           print_system = 0;
+   HYPRE_Int           print_binary = -1;
+   HYPRE_Int           read_binary = 0;
+   HYPRE_Int           persistent_comm = 1;
+   HYPRE_Int           neighbor_comm = 0;
 
    /* begin lobpcg */
 
@@ -151,6 +155,7 @@ main( hypre_int argc,
    HYPRE_Int pcgIterations = 0;
    HYPRE_Int pcgMode = 0;
    HYPRE_Real tol = 1e-6;
+   HYPRE_Int  gmres_sstep = 1;
    HYPRE_Real pcgTol = 1e-2;
    HYPRE_Real nonOrthF;
 
@@ -413,6 +418,26 @@ main( hypre_int argc,
          arg_index++;
          print_system = 1;
       }
+      else if ( strcmp(argv[arg_index], "-persistent") == 0 )
+      {
+         arg_index++;
+         persistent_comm = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-neighbor_comm") == 0 )
+      {
+         arg_index++;
+         neighbor_comm = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-print_bin") == 0 )
+      {
+         arg_index++;
+         print_binary = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-read_bin") == 0 )
+      {
+         arg_index++;
+         read_binary = 1;
+      }
       else if ( strcmp(argv[arg_index], "-help") == 0 )
       {
          print_usage = 1;
@@ -460,6 +485,11 @@ main( hypre_int argc,
          arg_index++;
          tol = atof(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-sstep") == 0 )
+      {
+         arg_index++;
+         gmres_sstep = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-pcgitr") == 0 )
       {
          /* lobpcg: max inner pcg iterations */
@@ -505,6 +535,9 @@ main( hypre_int argc,
 
    /*end lobpcg */
 
+   HYPRE_SetPersistentComm(persistent_comm);
+   HYPRE_SetNeighborComm(neighbor_comm);
+
    sum = read_x0fromfile_param + read_rhsfromfile_param + read_fromfile_param;
 
    /*-----------------------------------------------------------
@@ -583,6 +616,13 @@ main( hypre_int argc,
       hypre_printf("                        2 - GMRES\n");
       hypre_printf("  -recompute <bool>   : Recompute residual in PCG?\n");
       hypre_printf("  -cf <cf>            : convergence factor for Hybrid\n");
+      hypre_printf("  -print_bin <c>      : write binary struct.out.A.bin, b.bin, x0.bin\n");
+      hypre_printf("                        (c = 1: run-length compressed)\n");
+      hypre_printf("  -read_bin           : read the values of A, b, x0 from the binary files\n");
+      hypre_printf("  -persistent <val>   : persistent requests in the repeated halo\n");
+      hypre_printf("                        exchanges (1 = on, default; 0 = off)\n");
+      hypre_printf("  -neighbor_comm <b>  : halo exchanges with MPI neighborhood\n");
+      hypre_printf("                        collectives (1) or point-to-point (0, default)\n");
       hypre_printf("\n");
 
       /* begin lobpcg */
@@ -596,6 +636,7 @@ main( hypre_int argc,
       hypre_printf("  -itr <val>          : maximal number of LOBPCG iterations (default 100);\n");
       hypre_printf("\n");
       hypre_printf("  -tol <val>          : residual tolerance (default 1e-6)\n");
+      hypre_printf("  -sstep <s>          : s-step GMRES with block size s (default 1)\n");
       hypre_printf("\n");
       hypre_printf("  -vrand <val>        : compute <val> eigenpairs using random initial vectors (default 1)\n");
       hypre_printf("\n");
@@ -1322,6 +1363,17 @@ main( hypre_int argc,
          hypre_FinalizeTiming(time_index);
       }
 
+      /*-----------------------------------------------------------
+       * Read in the values of the system and initial guess
+       *-----------------------------------------------------------*/
+
+      if (read_binary)
+      {
+         HYPRE_StructMatrixReadBinaryValues("struct.out.A.bin", A);
+         HYPRE_StructVectorReadBinaryValues("struct.out.b.bin", b);
+         HYPRE_StructVectorReadBinaryValues("struct.out.x0.bin", x);
+      }
+
       /*-----------------------------------------------------------
        * Print out the system and initial guess
        *-----------------------------------------------------------*/
@@ -1333,6 +1385,13 @@ main( hypre_int argc,
          HYPRE_StructVectorPrint("struct.out.x0", x, 0);
       }
 
+      if (print_binary >= 0)
+      {
+         HYPRE_StructMatrixPrintBinary("struct.out.A.bin", A, print_binary);
+         HYPRE_StructVectorPrintBinary("struct.out.b.bin", b, print_binary);
+         HYPRE_StructVectorPrintBinary("struct.out.x0.bin", x, print_binary);
+      }
+
       /*-----------------------------------------------------------
        * Solve the system using SMG
        *-----------------------------------------------------------*/
@@ -2325,6 +2384,7 @@ main( hypre_int argc,
 
          HYPRE_StructGMRESCreate(hypre_MPI_COMM_WORLD, &solver);
          HYPRE_GMRESSetKDim( (HYPRE_Solver) solver, 5 );
+         HYPRE_GMRESSetSStep( (HYPRE_Solver) solver, gmres_sstep );
          HYPRE_GMRESSetMaxIter( (HYPRE_Solver)solver, 100 );
          HYPRE_GMRESSetTol( (HYPRE_Solver)solver, tol );
          HYPRE_GMRESSetRelChange( (HYPRE_Solver)solver, 0 );
@@ -177,6 +177,61 @@ typedef enum _HYPRE_ExecutionPolicy
    HYPRE_EXEC_DEVICE
 } HYPRE_ExecutionPolicy;
 
+/* Turns the persistent requests (MPI_Send_init/Recv_init) of the repeated
+   halo exchanges on (1, default) or off (0) */
+HYPRE_Int HYPRE_SetPersistentComm(HYPRE_Int persistent);
+
+/* Turns the neighborhood collectives (MPI_Ineighbor_alltoallv) of the halo
+   exchanges on (1) or off (0, default).  The communication packages created
+   while on build a distributed graph communicator (collective) and keep
+   using it after the option is turned off */
+HYPRE_Int HYPRE_SetNeighborComm(HYPRE_Int neighbor);
+
+/* Groups ranks_per_node consecutive ranks into one node for the node-aware
+   halo exchanges; 0 (default) uses the shared-memory nodes */
+HYPRE_Int HYPRE_SetNodeAwareRanksPerNode(HYPRE_Int ranks_per_node);
+
+/*--------------------------------------------------------------------------
+ * HYPRE memory statistics
+ *
+ * When enabled, the bytes allocated through hypre's allocator (in all memory
+ * locations) are counted per category and, while BoomerAMG builds its
+ * hierarchy, per level.  The solver categories (AMG, KRYLOV, ILU) take
+ * precedence over the data categories, e.g., a matrix created by the AMG
+ * setup counts as AMG data of the level being built, while the MATRIX and
+ * VECTOR categories hold the data created outside of the solvers.  Memory
+ * allocated before enabling the statistics is not counted.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_MEMORY_CATEGORY_TOTAL  -1 /* sum over all categories */
+#define HYPRE_MEMORY_CATEGORY_OTHER   0
+#define HYPRE_MEMORY_CATEGORY_MATRIX  1 /* CSR/ParCSR matrix data */
+#define HYPRE_MEMORY_CATEGORY_VECTOR  2 /* vector data */
+#define HYPRE_MEMORY_CATEGORY_COMM    3 /* comm packages and buffers */
+#define HYPRE_MEMORY_CATEGORY_AMG     4 /* BoomerAMG hierarchy */
+#define HYPRE_MEMORY_CATEGORY_KRYLOV  5 /* Krylov work vectors */
+#define HYPRE_MEMORY_CATEGORY_ILU     6 /* ILU factors and work data */
+#define HYPRE_MEMORY_NUM_CATEGORIES   7
+
+/* Turns the memory statistics on (1) or off (0); turning them on clears them */
+HYPRE_Int HYPRE_MemoryStatsSetEnabled(HYPRE_Int enabled);
+
+/* Returns the live and peak bytes of a category on this process */
+HYPRE_Int HYPRE_MemoryStatsGet(HYPRE_Int   category,
+                               HYPRE_Real *live_bytes,
+                               HYPRE_Real *peak_bytes);
+
+/* Returns the live and peak bytes allocated while building AMG level 'level' */
+HYPRE_Int HYPRE_MemoryStatsGetLevel(HYPRE_Int   level,
+                                    HYPRE_Real *live_bytes,
+                                    HYPRE_Real *peak_bytes);
+
+/* Sets the peaks to the live bytes, e.g., to measure setup and solve separately */
+HYPRE_Int HYPRE_MemoryStatsResetPeak();
+
+/* Prints the maximum over the processes in comm of the live and peak bytes */
+HYPRE_Int HYPRE_MemoryStatsPrint(MPI_Comm comm, const char *label);
+
 #ifdef __cplusplus
 }
 #endif
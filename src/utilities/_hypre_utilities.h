@@ -233,6 +233,8 @@ extern "C" {
 #define MPI_Address         hypre_MPI_Address
 #define MPI_Get_count       hypre_MPI_Get_count
 #define MPI_Alltoall        hypre_MPI_Alltoall
+#define MPI_Dist_graph_create_adjacent hypre_MPI_Dist_graph_create_adjacent
+#define MPI_Ineighbor_alltoallv hypre_MPI_Ineighbor_alltoallv
 #define MPI_Allgather       hypre_MPI_Allgather
 #define MPI_Allgatherv      hypre_MPI_Allgatherv
 #define MPI_Gather          hypre_MPI_Gather
@@ -258,6 +260,7 @@ extern "C" {
 #define MPI_Allreduce       hypre_MPI_Allreduce
 #define MPI_Reduce          hypre_MPI_Reduce
 #define MPI_Scan            hypre_MPI_Scan
+#define MPI_Iallreduce      hypre_MPI_Iallreduce
 #define MPI_Request_free    hypre_MPI_Request_free
 #define MPI_Type_contiguous hypre_MPI_Type_contiguous
 #define MPI_Type_vector     hypre_MPI_Type_vector
@@ -404,6 +407,8 @@ HYPRE_Int hypre_MPI_Group_free( hypre_MPI_Group *group );
 HYPRE_Int hypre_MPI_Address( void *location , hypre_MPI_Aint *address );
 HYPRE_Int hypre_MPI_Get_count( hypre_MPI_Status *status , hypre_MPI_Datatype datatype , HYPRE_Int *count );
 HYPRE_Int hypre_MPI_Alltoall( void *sendbuf , HYPRE_Int sendcount , hypre_MPI_Datatype sendtype , void *recvbuf , HYPRE_Int recvcount , hypre_MPI_Datatype recvtype , hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm comm , HYPRE_Int indegree , HYPRE_Int *sources , HYPRE_Int outdegree , HYPRE_Int *destinations , hypre_MPI_Comm *newcomm );
+HYPRE_Int hypre_MPI_Ineighbor_alltoallv( void *sendbuf , hypre_int *sendcounts , hypre_int *sdispls , hypre_MPI_Datatype sendtype , void *recvbuf , hypre_int *recvcounts , hypre_int *rdispls , hypre_MPI_Datatype recvtype , hypre_MPI_Comm comm , hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Allgather( void *sendbuf , HYPRE_Int sendcount , hypre_MPI_Datatype sendtype , void *recvbuf , HYPRE_Int recvcount , hypre_MPI_Datatype recvtype , hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Allgatherv( void *sendbuf , HYPRE_Int sendcount , hypre_MPI_Datatype sendtype , void *recvbuf , HYPRE_Int *recvcounts , HYPRE_Int *displs , hypre_MPI_Datatype recvtype , hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Gather( void *sendbuf , HYPRE_Int sendcount , hypre_MPI_Datatype sendtype , void *recvbuf , HYPRE_Int recvcount , hypre_MPI_Datatype recvtype , HYPRE_Int root , hypre_MPI_Comm comm );
@@ -429,6 +434,7 @@ HYPRE_Int hypre_MPI_Waitany( HYPRE_Int count , hypre_MPI_Request *array_of_reque
 HYPRE_Int hypre_MPI_Allreduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Reduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , HYPRE_Int root , hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Scan( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Iallreduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm , hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Request_free( hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Type_contiguous( HYPRE_Int count , hypre_MPI_Datatype oldtype , hypre_MPI_Datatype *newtype );
 HYPRE_Int hypre_MPI_Type_vector( HYPRE_Int count , HYPRE_Int blocklength , HYPRE_Int stride , hypre_MPI_Datatype oldtype , hypre_MPI_Datatype *newtype );
@@ -438,8 +444,8 @@ HYPRE_Int hypre_MPI_Type_commit( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Type_free( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Op_free( hypre_MPI_Op *op );
 HYPRE_Int hypre_MPI_Op_create( hypre_MPI_User_function *function , hypre_int commute , hypre_MPI_Op *op );
-#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
 HYPRE_Int hypre_MPI_Comm_split_type(hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key, hypre_MPI_Info info, hypre_MPI_Comm *newcomm);
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
 HYPRE_Int hypre_MPI_Info_create(hypre_MPI_Info *info);
 HYPRE_Int hypre_MPI_Info_free( hypre_MPI_Info *info );
 #endif
@@ -743,6 +749,59 @@ static inline void hypre_MemoryTrackerInsert(struct hypre_memory_tracker_t const
 
 #endif /* #ifdef HYPRE_USING_MEMORY_TRACKER */
 
+/*--------------------------------------------------------------------------
+ * Arena (bump) allocator for short-lived host work arrays.
+ *
+ * Allocations are carved out of large host blocks and are never freed
+ * individually; hypre_ArenaReset releases everything at once. Each OpenMP
+ * thread owns a sub-arena so that no locking is needed inside parallel
+ * regions. The hypre_Arena*Alloc macros fall back to the regular host
+ * allocator when the arena is NULL, and hypre_ArenaTFree is then a free.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_ARENA_ALIGNMENT  16
+#define HYPRE_ARENA_BLOCK_SIZE (1 << 20)
+
+typedef struct hypre_ArenaBlock_struct
+{
+   struct hypre_ArenaBlock_struct *next;
+   size_t                          size;  /* usable bytes following the header */
+   size_t                          used;
+
+} hypre_ArenaBlock;
+
+typedef struct
+{
+   hypre_ArenaBlock *head;
+   size_t            total;    /* bytes held in all blocks */
+   size_t            reserve;  /* minimum size of the next block */
+   char              pad[64 - 3 * sizeof(size_t)]; /* avoid false sharing */
+
+} hypre_ArenaSub;
+
+typedef struct
+{
+   HYPRE_Int         num_subs; /* one per thread, plus a shared overflow one */
+   size_t            block_size;
+   hypre_ArenaSub   *subs;
+
+} hypre_Arena;
+
+#define hypre_ArenaNumSubs(arena)   ((arena) -> num_subs)
+#define hypre_ArenaBlockSize(arena) ((arena) -> block_size)
+#define hypre_ArenaSubs(arena)      ((arena) -> subs)
+
+#define hypre_ArenaTAlloc(arena, type, count) \
+( (arena) ? (type *) hypre_ArenaAlloc(arena, (size_t)(sizeof(type) * (count)), 0) : \
+            hypre_TAlloc(type, count, HYPRE_MEMORY_HOST) )
+
+#define hypre_ArenaCTAlloc(arena, type, count) \
+( (arena) ? (type *) hypre_ArenaAlloc(arena, (size_t)(sizeof(type) * (count)), 1) : \
+            hypre_CTAlloc(type, count, HYPRE_MEMORY_HOST) )
+
+#define hypre_ArenaTFree(arena, ptr) \
+( (arena) ? (void) ((ptr) = NULL) : (void) hypre_TFree(ptr, HYPRE_MEMORY_HOST) )
+
 
 /*--------------------------------------------------------------------------
  * Prototypes
@@ -768,6 +827,16 @@ HYPRE_Int hypre_GetPointerLocation(const void *ptr, hypre_MemoryLocation *memory
 HYPRE_Int hypre_PrintMemoryTracker();
 HYPRE_Int hypre_SetCubMemPoolSize( hypre_uint bin_growth, hypre_uint min_bin, hypre_uint max_bin, size_t max_cached_bytes );
 
+hypre_Arena * hypre_ArenaCreate(size_t block_size);
+HYPRE_Int hypre_ArenaDestroy(hypre_Arena *arena);
+void * hypre_ArenaAlloc(hypre_Arena *arena, size_t size, HYPRE_Int zeroinit);
+HYPRE_Int hypre_ArenaReset(hypre_Arena *arena);
+size_t hypre_ArenaBytes(hypre_Arena *arena);
+
+void hypre_MemoryStatsPushCategory(HYPRE_Int category);
+void hypre_MemoryStatsPopCategory(void);
+HYPRE_Int hypre_MemoryStatsSetLevel(HYPRE_Int level);
+
 /* memory_dmalloc.c */
 HYPRE_Int hypre_InitMemoryDebugDML( HYPRE_Int id );
 HYPRE_Int hypre_FinalizeMemoryDebugDML( void );
@@ -2639,6 +2708,26 @@ typedef struct
    HYPRE_Complex*                    struct_comm_send_buffer;
    HYPRE_Int                         struct_comm_recv_buffer_size;
    HYPRE_Int                         struct_comm_send_buffer_size;
+   /* host ParCSR matvec options */
+   HYPRE_Int                         matvec_overlap;
+   HYPRE_Int                         matvec_overlap_chunk_size;
+   /* host spgemm accumulator (0: chosen per row) */
+   HYPRE_Int                         spgemm_host_algorithm;
+   /* ParCSR communication counters, updated only while comm_stats is set */
+   HYPRE_Int                         comm_stats;
+   HYPRE_Real                        comm_num_messages;
+   HYPRE_Real                        comm_num_bytes;
+   HYPRE_Real                        comm_wait_time;
+   /* arena for short-lived host work arrays of the current AMG setup level */
+   hypre_Arena                      *setup_arena;
+   /* repeated halo exchanges reuse persistent MPI requests and buffers */
+   HYPRE_Int                         persistent_comm;
+   /* halo exchanges of the packages created while set use neighborhood
+    * collectives on a distributed graph communicator */
+   HYPRE_Int                         neighbor_comm;
+   /* node-aware halo exchanges group this many consecutive ranks into one
+    * node instead of querying the shared-memory nodes (0) */
+   HYPRE_Int                         node_aware_ranks_per_node;
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    HYPRE_ExecutionPolicy             default_exec_policy;
    HYPRE_Int                         cuda_device;
@@ -2679,6 +2768,17 @@ typedef struct
 #define hypre_HandleStructCommRecvBufferSize(hypre_handle_) ((hypre_handle_) -> struct_comm_recv_buffer_size)
 #define hypre_HandleStructCommSendBufferSize(hypre_handle_) ((hypre_handle_) -> struct_comm_send_buffer_size)
 #define hypre_HandleCudaReduceBuffer(hypre_handle_)         ((hypre_handle_) -> cuda_reduce_buffer)
+#define hypre_HandleMatvecOverlap(hypre_handle_)            ((hypre_handle_) -> matvec_overlap)
+#define hypre_HandleMatvecOverlapChunkSize(hypre_handle_)   ((hypre_handle_) -> matvec_overlap_chunk_size)
+#define hypre_HandleSpgemmHostAlgorithm(hypre_handle_)      ((hypre_handle_) -> spgemm_host_algorithm)
+#define hypre_HandleCommStats(hypre_handle_)                ((hypre_handle_) -> comm_stats)
+#define hypre_HandleCommNumMessages(hypre_handle_)          ((hypre_handle_) -> comm_num_messages)
+#define hypre_HandleCommNumBytes(hypre_handle_)             ((hypre_handle_) -> comm_num_bytes)
+#define hypre_HandleCommWaitTime(hypre_handle_)             ((hypre_handle_) -> comm_wait_time)
+#define hypre_HandleSetupArena(hypre_handle_)               ((hypre_handle_) -> setup_arena)
+#define hypre_HandlePersistentComm(hypre_handle_)           ((hypre_handle_) -> persistent_comm)
+#define hypre_HandleNeighborComm(hypre_handle_)             ((hypre_handle_) -> neighbor_comm)
+#define hypre_HandleNodeAwareRanksPerNode(hypre_handle_)    ((hypre_handle_) -> node_aware_ranks_per_node)
 
 /* accessor inline functions to hypre_Handle */
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
@@ -37,6 +37,16 @@ hypre_HandleCreate()
 
    hypre_HandleMemoryLocation(hypre_handle_) = HYPRE_MEMORY_DEVICE;
 
+   /* 0: diag multiply, then wait; 1: split-phase diag multiply polling the halo exchange */
+   hypre_HandleMatvecOverlap(hypre_handle_)          = 0;
+   hypre_HandleMatvecOverlapChunkSize(hypre_handle_) = 4096;
+   hypre_HandleSpgemmHostAlgorithm(hypre_handle_)    = 0;
+   hypre_HandleCommStats(hypre_handle_)              = 0;
+   hypre_HandleSetupArena(hypre_handle_)             = NULL;
+   hypre_HandlePersistentComm(hypre_handle_)         = 1;
+   hypre_HandleNeighborComm(hypre_handle_)           = 0;
+   hypre_HandleNodeAwareRanksPerNode(hypre_handle_)  = 0;
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
 
    /* default CUDA options */
@@ -287,3 +297,64 @@ HYPRE_Finalize()
    return hypre_error_flag;
 }
 
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetPersistentComm
+ *
+ * Global option: 1 (default) lets the halo exchanges repeated in solve
+ * cycles reuse MPI persistent requests (MPI_Send_init/Recv_init) and
+ * buffers cached on the ParCSR and struct communication packages; 0 posts
+ * MPI_Isend/Irecv for every exchange.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SetPersistentComm( HYPRE_Int persistent )
+{
+   hypre_HandlePersistentComm(hypre_handle()) = persistent;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetNeighborComm
+ *
+ * Global option: 1 builds an MPI-3 distributed graph communicator for each
+ * ParCSR matrix and struct communication package created from now on, and
+ * performs their halo exchanges with MPI_Ineighbor_alltoallv; 0 (default)
+ * uses point-to-point messages.  Creating a package then is collective over
+ * its communicator.  The choice is stored in each package and does not
+ * change with the option; the backend of a ParCSR package can be switched
+ * with hypre_ParCSRCommPkgSetNeighborComm, and per AMG level with
+ * HYPRE_BoomerAMGSetNeighborCommLevel.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SetNeighborComm( HYPRE_Int neighbor )
+{
+   hypre_HandleNeighborComm(hypre_handle()) = neighbor;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_SetNodeAwareRanksPerNode
+ *
+ * Global option for the node-aware halo exchanges: 0 (default) takes the
+ * nodes from MPI_Comm_split_type(MPI_COMM_TYPE_SHARED); a positive value
+ * instead groups that many consecutive ranks into one node, e.g., to study
+ * the two-level exchange on a single node.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_SetNodeAwareRanksPerNode( HYPRE_Int ranks_per_node )
+{
+   if (ranks_per_node < 0)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_HandleNodeAwareRanksPerNode(hypre_handle()) = ranks_per_node;
+
+   return hypre_error_flag;
+}
@@ -27,6 +27,26 @@ typedef struct
    HYPRE_Complex*                    struct_comm_send_buffer;
    HYPRE_Int                         struct_comm_recv_buffer_size;
    HYPRE_Int                         struct_comm_send_buffer_size;
+   /* host ParCSR matvec options */
+   HYPRE_Int                         matvec_overlap;
+   HYPRE_Int                         matvec_overlap_chunk_size;
+   /* host spgemm accumulator (0: chosen per row) */
+   HYPRE_Int                         spgemm_host_algorithm;
+   /* ParCSR communication counters, updated only while comm_stats is set */
+   HYPRE_Int                         comm_stats;
+   HYPRE_Real                        comm_num_messages;
+   HYPRE_Real                        comm_num_bytes;
+   HYPRE_Real                        comm_wait_time;
+   /* arena for short-lived host work arrays of the current AMG setup level */
+   hypre_Arena                      *setup_arena;
+   /* repeated halo exchanges reuse persistent MPI requests and buffers */
+   HYPRE_Int                         persistent_comm;
+   /* halo exchanges of the packages created while set use neighborhood
+    * collectives on a distributed graph communicator */
+   HYPRE_Int                         neighbor_comm;
+   /* node-aware halo exchanges group this many consecutive ranks into one
+    * node instead of querying the shared-memory nodes (0) */
+   HYPRE_Int                         node_aware_ranks_per_node;
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    HYPRE_ExecutionPolicy             default_exec_policy;
    HYPRE_Int                         cuda_device;
@@ -67,6 +87,17 @@ typedef struct
 #define hypre_HandleStructCommRecvBufferSize(hypre_handle_) ((hypre_handle_) -> struct_comm_recv_buffer_size)
 #define hypre_HandleStructCommSendBufferSize(hypre_handle_) ((hypre_handle_) -> struct_comm_send_buffer_size)
 #define hypre_HandleCudaReduceBuffer(hypre_handle_)         ((hypre_handle_) -> cuda_reduce_buffer)
+#define hypre_HandleMatvecOverlap(hypre_handle_)            ((hypre_handle_) -> matvec_overlap)
+#define hypre_HandleMatvecOverlapChunkSize(hypre_handle_)   ((hypre_handle_) -> matvec_overlap_chunk_size)
+#define hypre_HandleSpgemmHostAlgorithm(hypre_handle_)      ((hypre_handle_) -> spgemm_host_algorithm)
+#define hypre_HandleCommStats(hypre_handle_)                ((hypre_handle_) -> comm_stats)
+#define hypre_HandleCommNumMessages(hypre_handle_)          ((hypre_handle_) -> comm_num_messages)
+#define hypre_HandleCommNumBytes(hypre_handle_)             ((hypre_handle_) -> comm_num_bytes)
+#define hypre_HandleCommWaitTime(hypre_handle_)             ((hypre_handle_) -> comm_wait_time)
+#define hypre_HandleSetupArena(hypre_handle_)               ((hypre_handle_) -> setup_arena)
+#define hypre_HandlePersistentComm(hypre_handle_)           ((hypre_handle_) -> persistent_comm)
+#define hypre_HandleNeighborComm(hypre_handle_)             ((hypre_handle_) -> neighbor_comm)
+#define hypre_HandleNodeAwareRanksPerNode(hypre_handle_)    ((hypre_handle_) -> node_aware_ranks_per_node)
 
 /* accessor inline functions to hypre_Handle */
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
@@ -43,6 +43,260 @@ hypre_WrongMemoryLocation()
    fflush(stdout);
 }
 
+/*==========================================================================
+ * Memory statistics
+ *
+ * While enabled, every pointer returned by the allocator is recorded in an
+ * open-addressing hash table together with its size, category and AMG
+ * level, so that hypre_Free can subtract the right amount.  The table is
+ * allocated with the system allocator to avoid recursion.
+ *
+ * The table and the counters are updated in a critical section; the
+ * number of entries, which hypre_Free checks first, is read atomically.
+ * Categories pushed inside OpenMP parallel regions go to a stack of the
+ * calling thread, on top of the stack of the serial code, which the
+ * threads only read.
+ *==========================================================================*/
+
+#define HYPRE_MEMORY_STATS_MAX_LEVELS 64
+#define HYPRE_MEMORY_STATS_MAX_DEPTH  32
+
+typedef struct
+{
+   void      *ptr;
+   size_t     size;
+   HYPRE_Int  category;
+   HYPRE_Int  level;
+
+} hypre_MemoryStatsEntry;
+
+static HYPRE_Int               hypre_memory_stats_enabled = 0;
+static hypre_MemoryStatsEntry *hypre_memory_stats_table = NULL;
+static size_t                  hypre_memory_stats_capacity = 0;
+static size_t                  hypre_memory_stats_count = 0;
+static HYPRE_Int               hypre_memory_category_stack[HYPRE_MEMORY_STATS_MAX_DEPTH];
+static HYPRE_Int               hypre_memory_category_depth = 0;
+#ifdef HYPRE_USING_OPENMP
+static HYPRE_Int               hypre_memory_thread_category_stack[HYPRE_MEMORY_STATS_MAX_DEPTH];
+static HYPRE_Int               hypre_memory_thread_category_depth = 0;
+#pragma omp threadprivate(hypre_memory_thread_category_stack, hypre_memory_thread_category_depth)
+#endif
+static HYPRE_Int               hypre_memory_stats_level = -1;
+/* index HYPRE_MEMORY_NUM_CATEGORIES holds the total */
+static size_t hypre_memory_live[HYPRE_MEMORY_NUM_CATEGORIES + 1];
+static size_t hypre_memory_peak[HYPRE_MEMORY_NUM_CATEGORIES + 1];
+static size_t hypre_memory_level_live[HYPRE_MEMORY_STATS_MAX_LEVELS];
+static size_t hypre_memory_level_peak[HYPRE_MEMORY_STATS_MAX_LEVELS];
+static HYPRE_Int hypre_memory_num_levels = 0;
+
+static inline size_t
+hypre_MemoryStatsHash(void *ptr)
+{
+   size_t key = (size_t) ptr;
+
+   key ^= key >> 17;
+   key *= (size_t) 0x9E3779B97F4A7C15ULL;
+
+   return key ^ (key >> 29);
+}
+
+static void
+hypre_MemoryStatsInsert(hypre_MemoryStatsEntry *entry)
+{
+   size_t mask = hypre_memory_stats_capacity - 1;
+   size_t pos  = hypre_MemoryStatsHash(entry -> ptr) & mask;
+
+   while (hypre_memory_stats_table[pos].ptr)
+   {
+      pos = (pos + 1) & mask;
+   }
+   hypre_memory_stats_table[pos] = *entry;
+}
+
+static inline void
+hypre_MemoryStatsCountUpdate(HYPRE_Int delta)
+{
+#ifdef HYPRE_USING_OPENMP
+#pragma omp atomic
+#endif
+   hypre_memory_stats_count += (size_t) delta;
+}
+
+/* number of entries of the table; may be called outside the critical section */
+static inline size_t
+hypre_MemoryStatsNumEntries()
+{
+   size_t count;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp atomic read
+#endif
+   count = hypre_memory_stats_count;
+
+   return count;
+}
+
+static void
+hypre_MemoryStatsGrow()
+{
+   hypre_MemoryStatsEntry *old_table = hypre_memory_stats_table;
+   size_t                  old_capacity = hypre_memory_stats_capacity;
+   size_t                  i;
+
+   hypre_memory_stats_capacity = old_capacity ? 2 * old_capacity : 4096;
+   hypre_memory_stats_table = (hypre_MemoryStatsEntry *)
+      calloc(hypre_memory_stats_capacity, sizeof(hypre_MemoryStatsEntry));
+   for (i = 0; i < old_capacity; i++)
+   {
+      if (old_table[i].ptr)
+      {
+         hypre_MemoryStatsInsert(&old_table[i]);
+      }
+   }
+   free(old_table);
+}
+
+/* removes ptr from the table (backward-shift deletion); returns 0 if absent */
+static HYPRE_Int
+hypre_MemoryStatsExtract(void *ptr, hypre_MemoryStatsEntry *entry)
+{
+   size_t mask = hypre_memory_stats_capacity - 1;
+   size_t pos, next, home;
+
+   if (!hypre_memory_stats_count)
+   {
+      return 0;
+   }
+
+   pos = hypre_MemoryStatsHash(ptr) & mask;
+   while (hypre_memory_stats_table[pos].ptr != ptr)
+   {
+      if (!hypre_memory_stats_table[pos].ptr)
+      {
+         return 0;
+      }
+      pos = (pos + 1) & mask;
+   }
+   *entry = hypre_memory_stats_table[pos];
+
+   next = (pos + 1) & mask;
+   while (hypre_memory_stats_table[next].ptr)
+   {
+      home = hypre_MemoryStatsHash(hypre_memory_stats_table[next].ptr) & mask;
+      /* move the entry back if its home slot is not in (pos, next] */
+      if ( ((next - home) & mask) >= ((next - pos) & mask) )
+      {
+         hypre_memory_stats_table[pos] = hypre_memory_stats_table[next];
+         pos = next;
+      }
+      next = (next + 1) & mask;
+   }
+   hypre_memory_stats_table[pos].ptr = NULL;
+   hypre_MemoryStatsCountUpdate(-1);
+
+   return 1;
+}
+
+static inline void
+hypre_MemoryStatsCount(hypre_MemoryStatsEntry *entry, HYPRE_Int add)
+{
+   HYPRE_Int c = entry -> category;
+   HYPRE_Int t = HYPRE_MEMORY_NUM_CATEGORIES;
+   HYPRE_Int l = entry -> level;
+
+   if (add)
+   {
+      hypre_memory_live[c] += entry -> size;
+      hypre_memory_live[t] += entry -> size;
+      hypre_memory_peak[c] = hypre_max(hypre_memory_peak[c], hypre_memory_live[c]);
+      hypre_memory_peak[t] = hypre_max(hypre_memory_peak[t], hypre_memory_live[t]);
+      if (l >= 0)
+      {
+         hypre_memory_level_live[l] += entry -> size;
+         hypre_memory_level_peak[l] = hypre_max(hypre_memory_level_peak[l],
+                                                hypre_memory_level_live[l]);
+      }
+   }
+   else
+   {
+      hypre_memory_live[c] -= entry -> size;
+      hypre_memory_live[t] -= entry -> size;
+      if (l >= 0)
+      {
+         hypre_memory_level_live[l] -= entry -> size;
+      }
+   }
+}
+
+/* innermost category of the calling thread, -1 if none */
+static HYPRE_Int
+hypre_MemoryStatsCategory()
+{
+   HYPRE_Int depth;
+
+#ifdef HYPRE_USING_OPENMP
+   depth = hypre_memory_thread_category_depth;
+   if (depth > 0)
+   {
+      return hypre_memory_thread_category_stack[hypre_min(depth, HYPRE_MEMORY_STATS_MAX_DEPTH) - 1];
+   }
+#endif
+   depth = hypre_memory_category_depth;
+
+   return depth > 0 ? hypre_memory_category_stack[hypre_min(depth, HYPRE_MEMORY_STATS_MAX_DEPTH) - 1] : -1;
+}
+
+static void
+hypre_MemoryStatsRecord(hypre_MemoryStatsEntry *entry)
+{
+#ifdef HYPRE_USING_OPENMP
+#pragma omp critical (hypre_memory_stats)
+#endif
+   {
+      if (2 * (hypre_memory_stats_count + 1) > hypre_memory_stats_capacity)
+      {
+         hypre_MemoryStatsGrow();
+      }
+      hypre_MemoryStatsInsert(entry);
+      hypre_MemoryStatsCountUpdate(1);
+      hypre_MemoryStatsCount(entry, 1);
+   }
+}
+
+static void
+hypre_MemoryStatsAdd(void *ptr, size_t size)
+{
+   hypre_MemoryStatsEntry entry;
+   HYPRE_Int              category = hypre_MemoryStatsCategory();
+
+   entry.ptr      = ptr;
+   entry.size     = size;
+   entry.category = category >= 0 ? category : HYPRE_MEMORY_CATEGORY_OTHER;
+   entry.level    = hypre_memory_stats_level;
+
+   hypre_MemoryStatsRecord(&entry);
+}
+
+/* removes the entry of ptr, returned in *entry; returns 0 if ptr is not recorded */
+static HYPRE_Int
+hypre_MemoryStatsRemove(void *ptr, hypre_MemoryStatsEntry *entry)
+{
+   HYPRE_Int found;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp critical (hypre_memory_stats)
+#endif
+   {
+      found = hypre_MemoryStatsExtract(ptr, entry);
+      if (found)
+      {
+         hypre_MemoryStatsCount(entry, 0);
+      }
+   }
+
+   return found;
+}
+
 /*==========================================================================
  * Physical memory location (hypre_MemoryLocation) interface
  *==========================================================================*/
@@ -244,6 +498,11 @@ hypre_MAlloc_core(size_t size, HYPRE_Int zeroinit, hypre_MemoryLocation location
       hypre_MPI_Abort(hypre_MPI_COMM_WORLD, -1);
    }
 
+   if (hypre_memory_stats_enabled)
+   {
+      hypre_MemoryStatsAdd(ptr, size);
+   }
+
    return ptr;
 }
 
@@ -314,6 +573,14 @@ hypre_Free_core(void *ptr, hypre_MemoryLocation location)
    assert(location == tmp);
 #endif
 
+   /* entries may outlive the statistics; look them up as long as any remain */
+   if (hypre_MemoryStatsNumEntries())
+   {
+      hypre_MemoryStatsEntry entry;
+
+      hypre_MemoryStatsRemove(ptr, &entry);
+   }
+
    switch (location)
    {
       case hypre_MEMORY_HOST :
@@ -656,14 +923,33 @@ hypre_ReAlloc(void *ptr, size_t size, HYPRE_MemoryLocation location)
       return NULL;
    }
 
-   ptr = realloc(ptr, size);
+   /* the entry of ptr is taken out before realloc frees it; the new block
+    * keeps the category and level of the original allocation */
+   hypre_MemoryStatsEntry entry;
+   HYPRE_Int              recorded = 0;
 
-   if (!ptr)
+   if (hypre_MemoryStatsNumEntries())
+   {
+      recorded = hypre_MemoryStatsRemove(ptr, &entry);
+   }
+
+   void *new_ptr = realloc(ptr, size);
+
+   if (!new_ptr)
    {
       hypre_OutOfMemory(size);
    }
+   else if (recorded)
+   {
+      entry.ptr  = new_ptr;
+      entry.size = size;
+   }
+   if (recorded)
+   {
+      hypre_MemoryStatsRecord(&entry);
+   }
 
-   return ptr;
+   return new_ptr;
 }
 
 void *
@@ -899,3 +1185,408 @@ hypre_SetCubMemPoolSize(hypre_uint cub_bin_growth,
    return ierr;
 }
 
+
+/*--------------------------------------------------------------------------*
+ * Arena allocator
+ *--------------------------------------------------------------------------*/
+
+#define hypre_ArenaRoundUp(n) \
+( ((n) + HYPRE_ARENA_ALIGNMENT - 1) & ~((size_t) HYPRE_ARENA_ALIGNMENT - 1) )
+
+#define hypre_ArenaBlockData(block) \
+( (char *) (block) + hypre_ArenaRoundUp(sizeof(hypre_ArenaBlock)) )
+
+hypre_Arena *
+hypre_ArenaCreate(size_t block_size)
+{
+   hypre_Arena *arena = hypre_CTAlloc(hypre_Arena, 1, HYPRE_MEMORY_HOST);
+
+   hypre_ArenaNumSubs(arena)   = hypre_NumThreads() + 1;
+   hypre_ArenaBlockSize(arena) = block_size > 0 ? block_size : HYPRE_ARENA_BLOCK_SIZE;
+   hypre_ArenaSubs(arena)      = hypre_CTAlloc(hypre_ArenaSub, hypre_ArenaNumSubs(arena),
+                                               HYPRE_MEMORY_HOST);
+
+   return arena;
+}
+
+static void
+hypre_ArenaSubFree(hypre_ArenaSub *sub)
+{
+   hypre_ArenaBlock *block = sub -> head, *next;
+
+   while (block)
+   {
+      next = block -> next;
+      hypre_TFree(block, HYPRE_MEMORY_HOST);
+      block = next;
+   }
+   sub -> head  = NULL;
+   sub -> total = 0;
+}
+
+HYPRE_Int
+hypre_ArenaDestroy(hypre_Arena *arena)
+{
+   HYPRE_Int i;
+
+   if (arena)
+   {
+      for (i = 0; i < hypre_ArenaNumSubs(arena); i++)
+      {
+         hypre_ArenaSubFree(&hypre_ArenaSubs(arena)[i]);
+      }
+      hypre_TFree(hypre_ArenaSubs(arena), HYPRE_MEMORY_HOST);
+      hypre_TFree(arena, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+static void *
+hypre_ArenaSubAlloc(hypre_ArenaSub *sub, size_t block_size, size_t size)
+{
+   hypre_ArenaBlock *block = sub -> head;
+   void             *ptr;
+
+   if (!block || block -> used + size > block -> size)
+   {
+      block_size = hypre_max(block_size, sub -> reserve);
+      block_size = hypre_ArenaRoundUp(hypre_max(block_size, size));
+      block = (hypre_ArenaBlock *)
+         hypre_MAlloc(hypre_ArenaRoundUp(sizeof(hypre_ArenaBlock)) + block_size, HYPRE_MEMORY_HOST);
+      block -> next  = sub -> head;
+      block -> size  = block_size;
+      block -> used  = 0;
+      sub -> head    = block;
+      sub -> total  += block_size;
+      sub -> reserve = 0;
+   }
+
+   ptr = hypre_ArenaBlockData(block) + block -> used;
+   block -> used += size;
+
+   return ptr;
+}
+
+/*--------------------------------------------------------------------------
+ * Returns size bytes aligned to HYPRE_ARENA_ALIGNMENT from the calling
+ * thread's sub-arena. Threads beyond the count seen at creation (e.g., in
+ * nested parallel regions) share a locked overflow sub-arena.
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_ArenaAlloc(hypre_Arena *arena, size_t size, HYPRE_Int zeroinit)
+{
+   HYPRE_Int  my_thread = hypre_GetThreadNum();
+   HYPRE_Int  num_subs = hypre_ArenaNumSubs(arena);
+   size_t     block_size = hypre_ArenaBlockSize(arena);
+   void      *ptr;
+
+   if (size == 0)
+   {
+      return NULL;
+   }
+   size = hypre_ArenaRoundUp(size);
+
+   if (my_thread < num_subs - 1)
+   {
+      ptr = hypre_ArenaSubAlloc(&hypre_ArenaSubs(arena)[my_thread], block_size, size);
+   }
+   else
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp critical (hypre_arena_overflow)
+#endif
+      ptr = hypre_ArenaSubAlloc(&hypre_ArenaSubs(arena)[num_subs - 1], block_size, size);
+   }
+
+   if (zeroinit)
+   {
+      memset(ptr, 0, size);
+   }
+
+   return ptr;
+}
+
+/*--------------------------------------------------------------------------
+ * Makes all memory of the arena available again. A sub-arena that had to
+ * grow beyond one block is coalesced: its blocks are released and the next
+ * allocation gets one block large enough for the whole previous demand.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ArenaReset(hypre_Arena *arena)
+{
+   hypre_ArenaSub *sub;
+   HYPRE_Int       i;
+   size_t          total;
+
+   if (!arena)
+   {
+      return hypre_error_flag;
+   }
+
+   for (i = 0; i < hypre_ArenaNumSubs(arena); i++)
+   {
+      sub = &hypre_ArenaSubs(arena)[i];
+      if (sub -> head && sub -> head -> next)
+      {
+         total = sub -> total;
+         hypre_ArenaSubFree(sub);
+         sub -> reserve = total;
+      }
+      else if (sub -> head)
+      {
+         sub -> head -> used = 0;
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Total number of bytes currently held by the arena
+ *--------------------------------------------------------------------------*/
+
+size_t
+hypre_ArenaBytes(hypre_Arena *arena)
+{
+   HYPRE_Int i;
+   size_t    total = 0;
+
+   if (arena)
+   {
+      for (i = 0; i < hypre_ArenaNumSubs(arena); i++)
+      {
+         total += hypre_ArenaSubs(arena)[i].total;
+      }
+   }
+
+   return total;
+}
+
+/*--------------------------------------------------------------------------*
+ * Memory statistics
+ *--------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------
+ * Allocations made until the matching pop are attributed to category.
+ * Solver categories (AMG, Krylov, ILU) take precedence over the data
+ * categories (matrix, vector, comm), so that, e.g., the matrices built by
+ * the AMG setup count as AMG data.
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_MemoryStatsPushCategory(HYPRE_Int category)
+{
+   HYPRE_Int *stack = hypre_memory_category_stack;
+   HYPRE_Int *depth = &hypre_memory_category_depth;
+   HYPRE_Int  outer = hypre_MemoryStatsCategory();
+
+   if (category < HYPRE_MEMORY_CATEGORY_AMG && outer >= HYPRE_MEMORY_CATEGORY_AMG)
+   {
+      category = outer;
+   }
+#ifdef HYPRE_USING_OPENMP
+   if (omp_in_parallel())
+   {
+      stack = hypre_memory_thread_category_stack;
+      depth = &hypre_memory_thread_category_depth;
+   }
+#endif
+   if (*depth < HYPRE_MEMORY_STATS_MAX_DEPTH)
+   {
+      stack[*depth] = category;
+   }
+   (*depth)++;
+}
+
+void
+hypre_MemoryStatsPopCategory()
+{
+   HYPRE_Int *depth = &hypre_memory_category_depth;
+
+#ifdef HYPRE_USING_OPENMP
+   if (omp_in_parallel())
+   {
+      depth = &hypre_memory_thread_category_depth;
+   }
+#endif
+   if (*depth > 0)
+   {
+      (*depth)--;
+   }
+}
+
+/* sets the AMG level allocations are attributed to (-1: none); returns the previous one */
+HYPRE_Int
+hypre_MemoryStatsSetLevel(HYPRE_Int level)
+{
+   HYPRE_Int prev_level = hypre_memory_stats_level;
+
+   if (level >= HYPRE_MEMORY_STATS_MAX_LEVELS)
+   {
+      level = HYPRE_MEMORY_STATS_MAX_LEVELS - 1;
+   }
+   if (level >= hypre_memory_num_levels)
+   {
+      hypre_memory_num_levels = level + 1;
+   }
+   hypre_memory_stats_level = level;
+
+   return prev_level;
+}
+
+HYPRE_Int
+HYPRE_MemoryStatsSetEnabled(HYPRE_Int enabled)
+{
+   HYPRE_Int i;
+
+   if (enabled && !hypre_memory_stats_enabled)
+   {
+      free(hypre_memory_stats_table);
+      hypre_memory_stats_table    = NULL;
+      hypre_memory_stats_capacity = 0;
+      hypre_memory_stats_count    = 0;
+      hypre_memory_num_levels     = 0;
+      for (i = 0; i <= HYPRE_MEMORY_NUM_CATEGORIES; i++)
+      {
+         hypre_memory_live[i] = 0;
+         hypre_memory_peak[i] = 0;
+      }
+      for (i = 0; i < HYPRE_MEMORY_STATS_MAX_LEVELS; i++)
+      {
+         hypre_memory_level_live[i] = 0;
+         hypre_memory_level_peak[i] = 0;
+      }
+   }
+   hypre_memory_stats_enabled = enabled != 0;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+HYPRE_MemoryStatsGet(HYPRE_Int   category,
+                     HYPRE_Real *live_bytes,
+                     HYPRE_Real *peak_bytes)
+{
+   if (category < HYPRE_MEMORY_CATEGORY_TOTAL || category >= HYPRE_MEMORY_NUM_CATEGORIES)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (category == HYPRE_MEMORY_CATEGORY_TOTAL)
+   {
+      category = HYPRE_MEMORY_NUM_CATEGORIES;
+   }
+
+   if (live_bytes)
+   {
+      *live_bytes = (HYPRE_Real) hypre_memory_live[category];
+   }
+   if (peak_bytes)
+   {
+      *peak_bytes = (HYPRE_Real) hypre_memory_peak[category];
+   }
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+HYPRE_MemoryStatsGetLevel(HYPRE_Int   level,
+                          HYPRE_Real *live_bytes,
+                          HYPRE_Real *peak_bytes)
+{
+   if (level < 0)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (live_bytes)
+   {
+      *live_bytes = level < hypre_memory_num_levels ?
+                    (HYPRE_Real) hypre_memory_level_live[level] : 0.0;
+   }
+   if (peak_bytes)
+   {
+      *peak_bytes = level < hypre_memory_num_levels ?
+                    (HYPRE_Real) hypre_memory_level_peak[level] : 0.0;
+   }
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+HYPRE_MemoryStatsResetPeak()
+{
+   HYPRE_Int i;
+
+   for (i = 0; i <= HYPRE_MEMORY_NUM_CATEGORIES; i++)
+   {
+      hypre_memory_peak[i] = hypre_memory_live[i];
+   }
+   for (i = 0; i < HYPRE_MEMORY_STATS_MAX_LEVELS; i++)
+   {
+      hypre_memory_level_peak[i] = hypre_memory_level_live[i];
+   }
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+HYPRE_MemoryStatsPrint(MPI_Comm comm, const char *label)
+{
+   const char *names[HYPRE_MEMORY_NUM_CATEGORIES + 1] =
+   {
+      "other", "matrix", "vector", "comm", "AMG", "Krylov", "ILU", "total"
+   };
+   HYPRE_Int   num_values, num_levels, i;
+   HYPRE_Int   my_id;
+   HYPRE_Real *values, *max_values;
+   HYPRE_Real  mb = 1024.0 * 1024.0;
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+   hypre_MPI_Allreduce(&hypre_memory_num_levels, &num_levels, 1, HYPRE_MPI_INT,
+                       hypre_MPI_MAX, comm);
+
+   /* live and peak of the categories, the total and the levels */
+   num_values = 2 * (HYPRE_MEMORY_NUM_CATEGORIES + 1 + num_levels);
+   values     = hypre_CTAlloc(HYPRE_Real, num_values, HYPRE_MEMORY_HOST);
+   max_values = hypre_CTAlloc(HYPRE_Real, num_values, HYPRE_MEMORY_HOST);
+   for (i = 0; i <= HYPRE_MEMORY_NUM_CATEGORIES; i++)
+   {
+      values[2 * i]     = (HYPRE_Real) hypre_memory_live[i] / mb;
+      values[2 * i + 1] = (HYPRE_Real) hypre_memory_peak[i] / mb;
+   }
+   for (i = 0; i < hypre_memory_num_levels; i++)
+   {
+      values[2 * (HYPRE_MEMORY_NUM_CATEGORIES + 1 + i)]     =
+         (HYPRE_Real) hypre_memory_level_live[i] / mb;
+      values[2 * (HYPRE_MEMORY_NUM_CATEGORIES + 1 + i) + 1] =
+         (HYPRE_Real) hypre_memory_level_peak[i] / mb;
+   }
+   hypre_MPI_Allreduce(values, max_values, num_values, HYPRE_MPI_REAL, hypre_MPI_MAX, comm);
+
+   if (my_id == 0)
+   {
+      hypre_printf("\n%s memory (MB, max over processes):\n", label ? label : "hypre");
+      hypre_printf("                     live        peak\n");
+      for (i = 0; i <= HYPRE_MEMORY_NUM_CATEGORIES; i++)
+      {
+         hypre_printf("   %-12s  %10.3f  %10.3f\n", names[i],
+                      max_values[2 * i], max_values[2 * i + 1]);
+      }
+      for (i = 0; i < num_levels; i++)
+      {
+         hypre_printf("   AMG level %-2d  %10.3f  %10.3f\n", i,
+                      max_values[2 * (HYPRE_MEMORY_NUM_CATEGORIES + 1 + i)],
+                      max_values[2 * (HYPRE_MEMORY_NUM_CATEGORIES + 1 + i) + 1]);
+      }
+   }
+
+   hypre_TFree(values, HYPRE_MEMORY_HOST);
+   hypre_TFree(max_values, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
@@ -278,6 +278,59 @@ static inline void hypre_MemoryTrackerInsert(struct hypre_memory_tracker_t const
 
 #endif /* #ifdef HYPRE_USING_MEMORY_TRACKER */
 
+/*--------------------------------------------------------------------------
+ * Arena (bump) allocator for short-lived host work arrays.
+ *
+ * Allocations are carved out of large host blocks and are never freed
+ * individually; hypre_ArenaReset releases everything at once. Each OpenMP
+ * thread owns a sub-arena so that no locking is needed inside parallel
+ * regions. The hypre_Arena*Alloc macros fall back to the regular host
+ * allocator when the arena is NULL, and hypre_ArenaTFree is then a free.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_ARENA_ALIGNMENT  16
+#define HYPRE_ARENA_BLOCK_SIZE (1 << 20)
+
+typedef struct hypre_ArenaBlock_struct
+{
+   struct hypre_ArenaBlock_struct *next;
+   size_t                          size;  /* usable bytes following the header */
+   size_t                          used;
+
+} hypre_ArenaBlock;
+
+typedef struct
+{
+   hypre_ArenaBlock *head;
+   size_t            total;    /* bytes held in all blocks */
+   size_t            reserve;  /* minimum size of the next block */
+   char              pad[64 - 3 * sizeof(size_t)]; /* avoid false sharing */
+
+} hypre_ArenaSub;
+
+typedef struct
+{
+   HYPRE_Int         num_subs; /* one per thread, plus a shared overflow one */
+   size_t            block_size;
+   hypre_ArenaSub   *subs;
+
+} hypre_Arena;
+
+#define hypre_ArenaNumSubs(arena)   ((arena) -> num_subs)
+#define hypre_ArenaBlockSize(arena) ((arena) -> block_size)
+#define hypre_ArenaSubs(arena)      ((arena) -> subs)
+
+#define hypre_ArenaTAlloc(arena, type, count) \
+( (arena) ? (type *) hypre_ArenaAlloc(arena, (size_t)(sizeof(type) * (count)), 0) : \
+            hypre_TAlloc(type, count, HYPRE_MEMORY_HOST) )
+
+#define hypre_ArenaCTAlloc(arena, type, count) \
+( (arena) ? (type *) hypre_ArenaAlloc(arena, (size_t)(sizeof(type) * (count)), 1) : \
+            hypre_CTAlloc(type, count, HYPRE_MEMORY_HOST) )
+
+#define hypre_ArenaTFree(arena, ptr) \
+( (arena) ? (void) ((ptr) = NULL) : (void) hypre_TFree(ptr, HYPRE_MEMORY_HOST) )
+
 
 /*--------------------------------------------------------------------------
  * Prototypes
@@ -303,6 +356,16 @@ HYPRE_Int hypre_GetPointerLocation(const void *ptr, hypre_MemoryLocation *memory
 HYPRE_Int hypre_PrintMemoryTracker();
 HYPRE_Int hypre_SetCubMemPoolSize( hypre_uint bin_growth, hypre_uint min_bin, hypre_uint max_bin, size_t max_cached_bytes );
 
+hypre_Arena * hypre_ArenaCreate(size_t block_size);
+HYPRE_Int hypre_ArenaDestroy(hypre_Arena *arena);
+void * hypre_ArenaAlloc(hypre_Arena *arena, size_t size, HYPRE_Int zeroinit);
+HYPRE_Int hypre_ArenaReset(hypre_Arena *arena);
+size_t hypre_ArenaBytes(hypre_Arena *arena);
+
+void hypre_MemoryStatsPushCategory(HYPRE_Int category);
+void hypre_MemoryStatsPopCategory(void);
+HYPRE_Int hypre_MemoryStatsSetLevel(HYPRE_Int level);
+
 /* memory_dmalloc.c */
 HYPRE_Int hypre_InitMemoryDebugDML( HYPRE_Int id );
 HYPRE_Int hypre_FinalizeMemoryDebugDML( void );
@@ -163,6 +163,33 @@ hypre_MPI_Alltoall( void               *sendbuf,
    return(0);
 }
 
+HYPRE_Int
+hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm   comm,
+                                      HYPRE_Int        indegree,
+                                      HYPRE_Int       *sources,
+                                      HYPRE_Int        outdegree,
+                                      HYPRE_Int       *destinations,
+                                      hypre_MPI_Comm  *newcomm )
+{
+   *newcomm = comm;
+   return(0);
+}
+
+HYPRE_Int
+hypre_MPI_Ineighbor_alltoallv( void               *sendbuf,
+                               hypre_int          *sendcounts,
+                               hypre_int          *sdispls,
+                               hypre_MPI_Datatype  sendtype,
+                               void               *recvbuf,
+                               hypre_int          *recvcounts,
+                               hypre_int          *rdispls,
+                               hypre_MPI_Datatype  recvtype,
+                               hypre_MPI_Comm      comm,
+                               hypre_MPI_Request  *request )
+{
+   return(0);
+}
+
 HYPRE_Int
 hypre_MPI_Allgather( void               *sendbuf,
                      HYPRE_Int           sendcount,
@@ -578,6 +605,20 @@ hypre_MPI_Scan( void               *sendbuf,
    return 0;
 }
 
+HYPRE_Int
+hypre_MPI_Iallreduce( void               *sendbuf,
+                      void               *recvbuf,
+                      HYPRE_Int           count,
+                      hypre_MPI_Datatype  datatype,
+                      hypre_MPI_Op        op,
+                      hypre_MPI_Comm      comm,
+                      hypre_MPI_Request  *request )
+{
+   hypre_MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
+   *request = hypre_MPI_REQUEST_NULL;
+   return 0;
+}
+
 HYPRE_Int
 hypre_MPI_Request_free( hypre_MPI_Request *request )
 {
@@ -646,12 +687,13 @@ hypre_MPI_Op_free( hypre_MPI_Op *op )
    return(0);
 }
 
-#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
 HYPRE_Int hypre_MPI_Comm_split_type( hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key, hypre_MPI_Info info, hypre_MPI_Comm *newcomm )
 {
    return (0);
 }
 
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+
 HYPRE_Int hypre_MPI_Info_create( hypre_MPI_Info *info )
 {
    return (0);
@@ -829,6 +871,67 @@ hypre_MPI_Alltoall( void               *sendbuf,
                                    recvbuf, (hypre_int)recvcount, recvtype, comm);
 }
 
+/* Graph with unit weights and without reordering of the ranks.  The weights
+ * are passed explicitly rather than as MPI_UNWEIGHTED, a sentinel address
+ * that some MPI headers declare as an array read by the call */
+HYPRE_Int
+hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm   comm,
+                                      HYPRE_Int        indegree,
+                                      HYPRE_Int       *sources,
+                                      HYPRE_Int        outdegree,
+                                      HYPRE_Int       *destinations,
+                                      hypre_MPI_Comm  *newcomm )
+{
+   hypre_int *mpi_sources, *mpi_destinations, *mpi_weights;
+   HYPRE_Int  num_weights = hypre_max(hypre_max(indegree, outdegree), 1);
+   HYPRE_Int  i;
+   HYPRE_Int  ierr;
+
+   mpi_sources = hypre_TAlloc(hypre_int, indegree, HYPRE_MEMORY_HOST);
+   mpi_destinations = hypre_TAlloc(hypre_int, outdegree, HYPRE_MEMORY_HOST);
+   mpi_weights = hypre_TAlloc(hypre_int, num_weights, HYPRE_MEMORY_HOST);
+   for (i = 0; i < indegree; i++)
+   {
+      mpi_sources[i] = (hypre_int) sources[i];
+   }
+   for (i = 0; i < outdegree; i++)
+   {
+      mpi_destinations[i] = (hypre_int) destinations[i];
+   }
+   for (i = 0; i < num_weights; i++)
+   {
+      mpi_weights[i] = 1;
+   }
+   ierr = (HYPRE_Int) MPI_Dist_graph_create_adjacent(comm, (hypre_int)indegree, mpi_sources,
+                                                     mpi_weights, (hypre_int)outdegree,
+                                                     mpi_destinations, mpi_weights,
+                                                     MPI_INFO_NULL, 0, newcomm);
+   hypre_TFree(mpi_sources, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_destinations, HYPRE_MEMORY_HOST);
+   hypre_TFree(mpi_weights, HYPRE_MEMORY_HOST);
+
+   return ierr;
+}
+
+/* The count and displacement arrays are passed through unconverted since
+ * they must stay valid until the request completes */
+HYPRE_Int
+hypre_MPI_Ineighbor_alltoallv( void               *sendbuf,
+                               hypre_int          *sendcounts,
+                               hypre_int          *sdispls,
+                               hypre_MPI_Datatype  sendtype,
+                               void               *recvbuf,
+                               hypre_int          *recvcounts,
+                               hypre_int          *rdispls,
+                               hypre_MPI_Datatype  recvtype,
+                               hypre_MPI_Comm      comm,
+                               hypre_MPI_Request  *request )
+{
+   return (HYPRE_Int) MPI_Ineighbor_alltoallv(sendbuf, sendcounts, sdispls, sendtype,
+                                              recvbuf, recvcounts, rdispls, recvtype,
+                                              comm, request);
+}
+
 HYPRE_Int
 hypre_MPI_Allgather( void               *sendbuf,
                      HYPRE_Int           sendcount,
@@ -1206,6 +1309,26 @@ hypre_MPI_Scan( void               *sendbuf,
                                datatype, op, comm);
 }
 
+/* without MPI-3, the reduction is completed immediately */
+HYPRE_Int
+hypre_MPI_Iallreduce( void               *sendbuf,
+                      void               *recvbuf,
+                      HYPRE_Int           count,
+                      hypre_MPI_Datatype  datatype,
+                      hypre_MPI_Op        op,
+                      hypre_MPI_Comm      comm,
+                      hypre_MPI_Request  *request )
+{
+#if MPI_VERSION > 2
+   return (HYPRE_Int) MPI_Iallreduce(sendbuf, recvbuf, (hypre_int)count,
+                                     datatype, op, comm, request);
+#else
+   *request = hypre_MPI_REQUEST_NULL;
+   return (HYPRE_Int) MPI_Allreduce(sendbuf, recvbuf, (hypre_int)count,
+                                    datatype, op, comm);
+#endif
+}
+
 HYPRE_Int
 hypre_MPI_Request_free( hypre_MPI_Request *request )
 {
@@ -1303,13 +1426,14 @@ hypre_MPI_Op_create( hypre_MPI_User_function *function, hypre_int commute, hypre
    return (HYPRE_Int) MPI_Op_create(function, commute, op);
 }
 
-#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
 HYPRE_Int
 hypre_MPI_Comm_split_type( hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key, hypre_MPI_Info info, hypre_MPI_Comm *newcomm )
 {
    return (HYPRE_Int) MPI_Comm_split_type(comm, split_type, key, info, newcomm );
 }
 
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+
 HYPRE_Int
 hypre_MPI_Info_create( hypre_MPI_Info *info )
 {